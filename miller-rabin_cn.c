@@ -5,6 +5,85 @@
     可生成一个指定位长和 Miller-Rabin 测试次数的素数
     在生成一个大素前，请确保宏定义 BIG_INT_BIT_LEN 足够大
 
+    函数: GenRandomPrime(bitLen, times, result)
+    生成一个随机素数，最高两位都是 1
+
+    Function: SetCheckpoint(path, resume, interval)
+    每interval秒把GenPrime和GenRandomPrime的搜索状态保存到文件
+    resume = 1: 重启后从文件继续 或者用 -c file -r 运行
+
+    Function: GenPrimePipeline(bitLen, times, threadNum, result)
+    用筛法、Fermat 过滤和 Miller-Rabin 组成的流水线生成与 GenPrime 相同的素数，各级由无锁环形队列连接
+    DoGenPrimePipeline 可设置每一级的线程数
+
+    Function: GenPrimeAsync(bitLen, times, random, timeoutMs, progress, arg)
+    在新线程中运行 GenPrime 或 GenRandomPrime，用 GenPrimeWait 或 GenPrimePoll 等待句柄
+    GenPrimeCancel 或截止时间使其在一轮 Miller-Rabin 内停止，GenPrimeFree 释放它
+
+    Function: OpenPrimeCache(path), ClosePrimeCache()
+    把GenPrime和random = 0的GenSafePrime的素数保存到文件，或者用 -p file 运行
+    同一 bitLen 的下一次调用直接从文件中取出，运行一轮 Miller-Rabin，或者它尚未通过的那些轮
+
+    函数: GenSafePrime(bitLen, times, random, result)
+    生成一个安全素数 p = 2q + 1，q 也是素数
+    random = 0: 最大的一个，random = 1: 随机的一个
+
+    函数: GenRsaKey(bitLen, times, n, d)
+    生成 e = 65537 的 RSA 密钥对，p 和 q 并行生成
+
+    Function: NextPrime(x, times, result), PrevPrime(x, times, result)
+    大于x的最小素数 小于x的最大素数
+    DoPrimeIterInit和DoPrimeIterNext向任一方向逐个给出素数
+
+    Function: DoPrimeRange(a, b, times, threadNum, cb, arg, bitmap), PrimeRange(a, b, times, threadNum)
+    多线程分段筛出[a, b]中的所有素数 按顺序通过回调或位图给出
+
+    函数: MillerRabin64(n), MillerRabin64Batch(n, count, result)
+    64 位整数的确定性 Miller-Rabin 测试，结果总是正确的
+    批量版本同时测试 8 个数，CPU 支持时在 AVX2 通道中运行
+
+    函数: LucasLehmer(p), ScanMersenne(low, high, result)
+    对梅森数 2^p - 1 做 Lucas-Lehmer 测试
+
+    Function: MillerRabinLarge(s, times), LimbsMulFast(r, a, aLen, b, bLen)
+    任意位长十进制字符串的Miller-Rabin测试 不受BIG_INT_BIT_LEN限制
+    乘法按字数选择竖式，Karatsuba, Toom-3或NTT
+
+    Function: GenPrimeBitmap(path), OpenPrimeBitmap(path)
+    把小于2^32的素数的模30轮位图写入文件，或者用 -w file 运行
+    只读映射它，或者用 -b file 运行，然后小于2^32的数只需查一次表
+
+    Function: InitVerdictCache(size), MillerRabin(s, times)
+    把MillerRabin的结论最多保存size个数，分片保存，每片有自己的锁
+    再次询问的数如果times更大，只运行剩下的轮数
+
+    Function: RunDaemon(path, threadNum)
+    在Unix域套接字上回答is-prime, gen-prime和next-prime，或者用 -d path -j threadNum 运行
+    所有客户端的请求合并成批，64位的检查不会排在生成素数后面等待
+
+    Function: DoShardRange(a, b, times, path, procNum, limit, cb, arg), RunShardWorker(path)
+    把 [a, b] 切成分片交给 Unix 域套接字上的工作进程，死掉的工作进程的分片会重新分配
+    用 -s path a b -j procNum 运行，用 -k path 启动更多工作进程
+
+    Function: GenPrimeTable(path)
+    把小素数和试除的表写入miller-rabin_table.h，或者用 -t file 运行
+    它们编译进程序，所以启动时不用筛
+
+    Function: InitCombCache(size), PowModFixed(g, e, p, result)
+    固定底数 g 的 g^e mod p，(g, p) 的 Lim-Lee 梳状表只构建一次并保存在有界缓存中
+    之后每次调用只需约 bits / 6 次乘法和少量平方
+
+    函数: DoMulWs(a, b, result, ws), DoDivWs, DoModWs, DoMulModWs, DoPowWs, DoPowModWs
+    BigInt运算 临时变量从工作区ws中取
+    result可以是操作数之一 不带Ws的函数使用本线程的工作区
+
+    Function: InitContext(ctx), UseContext(ctx), GetError()
+    Do* 函数的随机数生成器、工作区、计数器和错误都在 Context 中
+    每个线程有自己的 Context，因此线程之间不需要锁，UseContext 可为线程设置另一个
+
+    函数: DoMillerRabinCtx(n, times, ctx), DoPowModCtx, DoGenPrimeCtx, DoGenRandomPrimeCtx, DoNextPrimeCtx
+    常用的Do*函数在上下文ctx中运行 不带Ctx的函数和字符串函数使用本线程的上下文
+
     生成一个 1024 bit 的素数大约需要 6 小时
     生成一个 512 bit 的素数大约需要 3 小时
     生成一个 100 bit 的素数大约需要 1 分钟
@@ -13,21 +92,184 @@
     注意:
     素数的生成不是随机的
     他首先检测指定位长中最大的一个奇数，也就是全 1 的情况
+    这个数是梅森数，因此用 Lucas-Lehmer 测试
     然后再每次减 2，再测试，直到通过 Miller-Rabin 测试为止
     因此程序总是生成指定整型位数中最大的一个素数
+    需要随机素数时请用 GenRandomPrime
 */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <string.h>
 #include <math.h>
 #include <time.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#include <bcrypt.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "bcrypt.lib")
+#endif
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#endif
+
+#ifdef __linux__
+#include <sys/random.h>
+#endif
+
+// AVX2 代码只在 x86-64 上编译，CPU 支持时才使用
+// MULX/ADCX/ADOX代码是GCC和Clang的内联汇编 MSVC使用C代码
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#include <cpuid.h>
+#define USE_AVX2
+#define USE_ADX
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define USE_AVX2
+#define TARGET_AVX2
+#endif
+
 #define BIG_INT_BIT_LEN 2400           // 定义BigInt的位数
 #define SIGN_BIT BIG_INT_BIT_LEN - 1   // 符号位的位置
 #define BUFFER_SIZE BIG_INT_BIT_LEN    // 缓冲区大小
 #define POSITIVE 0                     // 0表示正数
 #define NEGATIVE 1                     // 1表示负数
+#define SMALL_PRIME_BOUND 65536        // 筛法所用小素数的上界
+#define SMALL_PRIME_NUM 6541           // 小于上界的奇素数个数
+#define SIEVE_WINDOW 8192              // 筛窗口中候选数的个数
+#define RSA_E 65537                    // 默认的 RSA 公钥指数
+#define MR_BASE64_NUM 7                // 64 位整数的确定性 Miller-Rabin 底数个数
+#define MR_BASE32_NUM 3                // 32 位整数的确定性 Miller-Rabin 底数个数
+#define MR64_LANES 8                   // MillerRabin64Batch 同时测试的数的个数
+#define TINY_PRIME_NUM 15              // 64 位整数试除用的奇素数个数
+#define FERMAT_BATCH 4                 // 一批 Fermat 测试的候选数个数，每个 AVX2 通道一个
+#define WORKSPACE_SIZE 16              // 工作区中临时BigInt的个数
+#define ERROR_NONE 0                   // Context 的错误：无
+#define ERROR_OVERFLOW 1               // Context 的错误：DoAdd、DoSub 或 DoMul 溢出，结果被截断回绕
+#define ERROR_ENTROPY 2                // Context 的错误：操作系统没有给出 CSPRNG 所需的熵
+#define ERROR_RANGE 3                  // Context 的错误：DoPrimeRange 的范围太大
+#define ERROR_ARGUMENT 4               // Context 的错误: 参数不在函数接受的范围内
+#define ERROR_MEMORY 5                 // Context 的错误: 没有内存，或 Workspace 中没有剩余的临时 BigInt
+#define ADX_LANES_MAX_LIMBS 8          // 有MULX/ADX时 AVX2通道只在不超过这个字数时更快
+#define MR_MAX_WINDOW 6                // Miller-Rabin指数滑动窗口的最大位数
+#define COMB_TEETH 6                   // DoPowModFixed的Lim-Lee梳的齿数，每块一张2^6个乘积的表
+#define COMB_MAX_BLOCKS 32             // 梳的最大块数，块越多平方越少，表越大
+#define NTT_PRIME_NUM 3                // 数论变换的素数个数
+#define MUL_TMP_SIZE(n) (16 * (n) + 4096)  // n个字时LimbsMulFast的临时字数
+#define RANGE_SEGMENT 32768            // DoPrimeRange一段中的数的个数 奇数的标记能放进L1缓存
+#define RANGE_ROUND 4                  // DoPrimeRange每轮中每个线程的段数
+#define RANGE_MAX_THREADS 64           // DoPrimeRange的最大线程数
+#define CHECKPOINT_MAGIC 0x4b43524dU   // "MRCK"，检查点文件的第一个字
+#define CHECKPOINT_GEN_PRIME 0         // DoGenPrime的检查点
+#define CHECKPOINT_RANDOM_PRIME 1      // DoGenRandomPrime的检查点
+#define PRIME_CACHE_MAGIC 0x434d524dU  // "MRMC"，素数缓存文件的第一个字
+#define PRIME_CACHE_GEN_PRIME 0        // DoGenPrime的缓存素数
+#define PRIME_CACHE_SAFE_PRIME 1       // random = 0时DoGenSafePrime的缓存素数
+#define PRIME_CACHE_MODES 2            // 素数缓存的模式数
+#define VERDICT_SHARDS 16              // 结论缓存的分片数，每片有自己的锁
+#define PRIME_BITMAP_MAGIC 0x4d42524dU // "MRBM"，素数位图文件的第一个字
+#define PRIME_BITMAP_BYTES 143165577U  // 小于2^32的数的轮位图字节数，每字节30个数
+#define PRIME_BITMAP_HEADER 64         // 素数位图文件头的字节数，位图从缓存行开始
+#define PRIME_BITMAP_SEGMENT 32768     // GenPrimeBitmap一段的字节数，可放入L1缓存
+#define DAEMON_OP_IS_PRIME 1           // 守护进程请求: n是否素数
+#define DAEMON_OP_GEN_PRIME 2          // 守护进程请求: bitLen位的素数
+#define DAEMON_OP_NEXT_PRIME 3         // 守护进程请求: 大于n的最小素数
+#define DAEMON_OK 0                    // 守护进程响应的状态
+#define DAEMON_BAD_REQUEST 1           // 守护进程对不认识的请求的响应状态
+#define DAEMON_LANE_FAST 0             // 守护进程64位is-prime的通道，用MillerRabin64Batch成批测试
+#define DAEMON_LANE_NORMAL 1           // 守护进程大数is-prime和next-prime的通道
+#define DAEMON_LANE_SLOW 2             // 守护进程gen-prime的通道
+#define DAEMON_LANES 3                 // 守护进程的通道数
+#define DAEMON_MAX_CLIENTS 256         // 守护进程的最大连接数
+#define DAEMON_MAX_THREADS 64          // 守护进程的最大工作线程数
+#define DAEMON_MAX_BITS (BIG_INT_BIT_LEN - 64)  // 守护进程的数的最大位长
+#define DAEMON_MAX_PAYLOAD (MAX_LIMBS * 8)      // 守护进程请求负载的最大字节数
+#define DAEMON_VERDICT_CACHE 65536     // 守护进程的结论缓存大小
+#define DAEMON_MAX_BACKLOG (1 << 20)   // 客户端未发送的响应的最大字节数，超过后暂停读取其请求
+#define DAEMON_MAX_PENDING 4096        // 客户端未应答的任务的最大个数，超过后暂停读取其请求
+#define SHARD_SIZE 1048576             // DoShardRange 每个分片的数的个数，其位图为 128KB
+#define SHARD_MAX_WORKERS 64           // DoShardRange 工作进程的最大个数
+#define SHARD_WINDOW 4                 // 每个工作进程对应的正在运行或等待前面分片的分片数
+#define SHARD_RETRIES 3                // 被这么多工作进程丢失的分片由协调者自己测试
+#define SHARD_PENDING 0                // DoShardRange 分片的状态：未分配给工作进程
+#define SHARD_RUNNING 1                // DoShardRange 分片的状态：已分配给工作进程
+#define SHARD_FINISHED 2               // DoShardRange 分片的状态：位图已就绪
+#define PIPE_RING 32                   // 流水线两级之间环形队列的槽数，2 的幂
+#define PIPE_MAX_THREADS 16            // 流水线每一级的最大线程数
+#define PIPE_NONE 0x7fffffffffffffffLL // 流水线找到素数之前最佳素数的 seq
+#define GEN_TASK_RUNNING 0             // GenPrimeTask 的状态：正在搜索
+#define GEN_TASK_FOUND 1               // GenPrimeTask 的状态：已找到素数
+#define GEN_TASK_CANCELED 2            // GenPrimeTask 的状态：被 GenPrimeCancel 停止
+#define GEN_TASK_EXPIRED 3             // GenPrimeTask 的状态：因截止时间停止
+
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)  // 每个线程各有一份的变量
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+#ifdef _MSC_VER
+#define INLINE __inline
+#else
+#define INLINE inline
+#endif
+
+// 环形队列的下标在它覆盖的槽之后读、之前写，p 指向 volatile 变量
+#ifdef _MSC_VER
+#define LOAD_ACQUIRE(p) (*(p))  // MSVC 的 volatile 在 x86 上具有 acquire 和 release 语义
+#define STORE_RELEASE(p, v) (*(p) = (v))
+#define FENCE_RELEASE() MemoryBarrier()  // 它之前的写不会被移到它之后的写之后
+#else
+#define LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif
+
+typedef unsigned long long Limb;       // Montgomery 乘法所用的机器字
+#define LIMB_BITS 64                   // Limb 的位数
+#define MAX_LIMBS (BIG_INT_BIT_LEN / LIMB_BITS + 1)  // 一个 BigInt 所需的字数
+
+// NTT素数p1, p2, p3的CRT常量 逆元是Montgomery形式
+#define NTT_INV12 0x16c15c9882b93111ULL    // p1^-1 * 2^64 mod p2
+#define NTT_INV123 0x010b8fb0b8fb0b72ULL   // (p1 * p2)^-1 * 2^64 mod p3
+#define NTT_P1_MOD3 0x1612f684bda12f74ULL  // p1 * 2^64 mod p3
+#define NTT_P12_LO 0x5c80000000000001ULL   // p1 * p2，低位字
+#define NTT_P12_HI 0x07d1000000000000ULL   // p1 * p2，高位字
+
+#ifdef _WIN32
+typedef HANDLE Thread;                 // 工作线程的句柄
+typedef CRITICAL_SECTION Mutex;        // 线程共享数据的锁
+typedef CONDITION_VARIABLE Cond;       // 条件变量，和Mutex一起等待
+#else
+typedef pthread_t Thread;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t Cond;
+#endif
+
+#define ROTL64(x, n) ((x) << (n) | (x) >> (64 - (n)))
+#define ROTL32(x, n) ((x) << (n) | (x) >> (32 - (n)))
+
+// ChaCha20 的四分之一轮
+#define CHACHA_QUARTER_ROUND(a, b, c, d) \
+    a += b; d ^= a; d = ROTL32(d, 16);   \
+    c += d; b ^= c; b = ROTL32(b, 12);   \
+    a += b; d ^= a; d = ROTL32(d, 8);    \
+    c += d; b ^= c; b = ROTL32(b, 7)
 
 typedef struct    // 大整数类型，均用补码表示
 {
@@ -41,6 +283,427 @@ typedef struct    // Number均用真值表示
     int sign;                     // 符号标记
 }Number;
 
+typedef struct    // Do*运算的临时BigInt 像栈一样使用
+{
+    BigInt t[WORKSPACE_SIZE];     // 临时BigInt
+    BigInt spare;                 // t 用完时由 WsAlloc 给出，此时结果是错的
+    int top;                      // 正在使用的个数
+}Workspace;
+
+typedef struct    // 随机数生成器的状态
+{
+    int secure;                   // 0: xoshiro256**, 1: ChaCha20 安全随机数生成器
+    unsigned long long s[4];      // xoshiro256** 的状态
+    unsigned int key[16];         // ChaCha20 输入块
+    unsigned int block[16];       // ChaCha20 输出块
+    int pos;                      // block 中下一个未用的字
+}Rng;
+
+typedef struct    // type:Context，一个线程中 Do* 函数的状态，线程之间不共享任何状态
+{
+    Rng rng;                      // 随机数生成器
+    int rngReady;                 // rng 已设置种子时为 1
+    Workspace ws;                 // 不带 Ws 的函数使用的临时 BigInt
+    int error;                    // 上次 GetError 以来的第一个错误，ERROR_NONE 表示没有
+    int quiet;                    // 为 1 时不打印生成素数的进度
+    int noCheckpoint;             // 为 1 时不保存也不加载检查点，用于同时运行的搜索
+    long long powMod;             // DoPowMod 的次数
+    long long mrRound;            // Miller-Rabin 测试的轮数
+}Context;
+
+typedef struct    // 奇数模 n 的 Montgomery 形式
+{
+    Limb n[MAX_LIMBS];    // modulus
+    Limb rr[MAX_LIMBS];   // R^2 mod n
+    Limb one[MAX_LIMBS];  // R mod n，也就是 Montgomery 形式的 1
+    Limb nInv;            // -n^-1 mod 2^64
+    int len;              // n 的字数
+}Mont;
+
+typedef struct    // type:MrModulus，模数n的预计算，由它的所有Miller-Rabin轮共用
+{
+    Mont mt;                                        // n的Montgomery形式
+    Limb minusOne[MAX_LIMBS];                       // Montgomery形式的n - 1
+    Limb t[MAX_LIMBS];                              // n - 1 = 2^s * t, t为奇数
+    int tLen;                                       // t的字数
+    int s;
+    int window;                                     // t的滑动窗口位数
+    int stepNum;                                    // t的窗口数
+    int tail;                                       // 最后一个窗口之后的平方次数
+    unsigned short square[MAX_LIMBS * LIMB_BITS];   // 窗口之前的平方次数，第一个窗口的被跳过
+    unsigned char digit[MAX_LIMBS * LIMB_BITS];     // 窗口的奇数值，从最高的开始
+}MrModulus;
+
+typedef struct    // 64 位整数批量 Miller-Rabin 测试中各通道的数
+{
+    Limb n[MR64_LANES];           // 被测试的数
+    Limb nInv[MR64_LANES];        // -n^-1 mod 2^64
+    Limb one[MR64_LANES];         // R mod n, R = 2^64
+    Limb r2[MR64_LANES];          // R^2 mod n
+    Limb d[MR64_LANES];           // n - 1 = 2^s * d
+    int s[MR64_LANES];
+    long long s64[MR64_LANES];    // 64 位的 s，用于 AVX2 通道
+    Limb a[MR64_LANES];           // 本轮的底数
+    Limb pass[MR64_LANES];        // n 通过本轮测试时不为 0
+    int maxBits;                  // d 的最大位长
+    int maxS;                     // s 的最大值
+}MrLanes;
+
+typedef struct    // type:LargeMont，任意字数奇模数的Montgomery形式，R = 2^(64 * len)
+{
+    Limb* n;      // modulus
+    Limb* nInv;   // -n^-1 mod R
+    Limb* one;    // R mod n
+    Limb* rr;     // R^2 mod n
+    Limb* t;      // LargeMontMul的临时空间，6 * len个字
+    Limb* tmp;    // 乘法的临时空间，MUL_TMP_SIZE(len)个字
+    int len;      // n 的字数
+}LargeMont;
+
+typedef struct    // type:NttPrime，数论变换的素数 p = c * 2^k + 1
+{
+    Limb p;       // 素数 小于2^62
+    Limb pInv;    // -p^-1 mod 2^64
+    Limb r2;      // 2^128 mod p
+    Limb g;       // 原根
+}NttPrime;
+
+#ifdef USE_AVX2
+typedef struct    // 字数相同的 4 个奇数模的 Montgomery 形式
+{
+    __m256i n[2 * MAX_LIMBS];    // 模的 32 位字，每个模占一个通道
+    __m256i rr[2 * MAX_LIMBS];   // R^2 mod n
+    __m256i one[2 * MAX_LIMBS];  // R mod n
+    __m256i nInv;                // -n^-1 mod 2^32
+    int len;                     // 32 位字的个数
+}Mont4;
+#endif
+
+typedef struct    // 筛窗口，候选奇数为 base, base+2*dir, base+4*dir, ...
+{
+    BigInt base;                            // 窗口中第一个候选数
+    int dir;                                // 1 表示向上，-1 表示向下
+    int safe;                               // 为 1 时同时筛 2x+1，用于安全素数
+    unsigned int e;                         // 0 或 RSA 指数，gcd(x-1, e) 必须为 1
+    unsigned int eResidue;                  // base % e
+    int primeNum;                           // 使用的小素数个数
+    unsigned int residue[SMALL_PRIME_NUM];  // base % smallPrime[k]
+    char composite[SIEVE_WINDOW];           // base + 2i 有小素因子时为 1
+}Sieve;
+
+typedef struct    // type:PrimeIter，从起点向上或向下的素数惰性迭代器
+{
+    Sieve sv;                    // 奇数候选的筛窗口
+    int pos;                     // 筛窗口的下一个下标
+    int times;                   // Miller-Rabin 测试次数
+    int two;                     // 2还没给出则为1 它不在筛中
+    int end;                     // 没有剩余的奇数候选则为1 只在向下时
+    int num;                     // 批中候选的个数
+    int next;                    // 批中的下一个候选
+    char pass[FERMAT_BATCH];     // 2: 素数，1: 通过Fermat测试，0: 合数
+    BigInt cand[FERMAT_BATCH];   // 批中通过筛的数
+}PrimeIter;
+
+typedef struct    // RSA 密钥对及其 CRT 参数
+{
+    BigInt n;     // modulus, n = p * q
+    BigInt e;     // 公钥指数
+    BigInt d;     // private exponent, d = e^-1 mod lcm(p-1, q-1)
+    BigInt p;     // 较大的素因子
+    BigInt q;     // 较小的素因子
+    BigInt dp;    // d mod (p - 1)
+    BigInt dq;    // d mod (q - 1)
+    BigInt qInv;  // q^-1 mod p
+}RsaKey;
+
+typedef struct    // 生成 RSA 素数的线程的参数
+{
+    int bitLen;       // 素数的位长
+    int times;        // Miller-Rabin 测试次数
+    unsigned int e;   // 公钥指数
+    int seeded;       // 线程无法为它的 CSPRNG 设置种子时为 0，此时没有素数
+    BigInt result;    // 生成的素数
+}RsaPrimeTask;
+
+typedef struct    // type:RangeState，分段枚举[a, b]中素数的共享状态
+{
+    Limb a[MAX_LIMBS];                      // 区间的起点
+    int len;                                // a的字数
+    unsigned long long total;               // 数的个数，b - a + 1
+    int times;                              // Miller-Rabin 测试次数
+    unsigned int residue[SMALL_PRIME_NUM];  // a % smallPrime[k]
+}RangeState;
+
+typedef struct    // type:RangeTask，处理一轮中若干段的线程的参数
+{
+    RangeState* pr;             // 共享状态
+    unsigned long long origin;  // 这一轮相对a的偏移
+    unsigned long long end;     // 这一轮之后的偏移
+    int first;                  // 线程在这一轮中第一段的下标
+    int step;                   // 线程数 各段轮流处理
+    unsigned char* bitmap;      // a + origin + i 是素数则第i位为1
+    long long count;            // 线程找到的素数个数
+}RangeTask;
+
+typedef void (*PrimeRangeCallback)(BigInt* p, void* arg);  // DoPrimeRange对每个素数调用
+
+typedef struct    // type:Checkpoint，保存在文件中的GenPrime和GenRandomPrime的搜索状态
+{
+    unsigned int magic;      // CHECKPOINT_MAGIC
+    int size;                // sizeof(Checkpoint)，不加载其他编译版本的文件
+    int kind;                // CHECKPOINT_GEN_PRIME或CHECKPOINT_RANDOM_PRIME
+    int bitLen;              // 素数的位长
+    int times;               // Miller-Rabin 测试次数
+    long long tested;        // 已测试的数的个数
+    Limb cand[MAX_LIMBS];    // 下一个要测试的数 筛从它重新开始
+    Rng rng;                 // 线程的随机数生成器
+}Checkpoint;
+
+typedef struct    // type:PrimeCacheEntry, GenPrime或GenSafePrime找到的素数
+{
+    volatile int ready;      // 素数已填入则为1，它最先清除，最后设置
+    int bitLen;              // 素数的位长
+    int mode;                // PRIME_CACHE_GEN_PRIME 或 PRIME_CACHE_SAFE_PRIME
+    int times;               // 该素数已通过的Miller-Rabin测试次数
+    Limb p[MAX_LIMBS];       // 生成的素数
+}PrimeCacheEntry;
+
+typedef struct    // type:PrimeCache，确定性素数的文件，映射到内存
+{
+    unsigned int magic;      // PRIME_CACHE_MAGIC
+    int size;                // sizeof(PrimeCacheEntry)，其他编译版本的文件会被清空
+    int bitLen;              // BIG_INT_BIT_LEN
+    int pad;
+    PrimeCacheEntry entry[PRIME_CACHE_MODES][BIG_INT_BIT_LEN];  // entry[mode][bitLen]
+}PrimeCache;
+
+typedef struct    // type:VerdictEntry，结论缓存中的一个数和它的Miller-Rabin结论
+{
+    Limb n[MAX_LIMBS];       // 这个数
+    Limb hash;               // n的字的哈希
+    int rounds;              // 通过的轮数，n是合数时为-1
+    int chain;               // 同一个桶的下一个条目，没有为-1
+    int prev, next;          // 按使用顺序的链表，头部是最新的，没有为-1
+}VerdictEntry;
+
+typedef struct    // type:VerdictShard，结论缓存的一片，有自己的锁
+{
+    Mutex lock;              // 分片的锁
+    VerdictEntry* entry;     // verdictCacheSize个条目
+    int* bucket;             // 每个桶的第一个条目，没有为-1，共verdictCacheSize个桶
+    int count;               // 使用中的条目数
+    int head, tail;          // 最新和最旧的条目，没有为-1
+}VerdictShard;
+
+typedef struct    // type:CombTable，固定底数g和奇模数p的Lim-Lee梳，由DoPowModFixed使用
+{
+    Mont mt;                 // p的Montgomery形式
+    Limb g[MAX_LIMBS];       // 底数，小于p
+    int bits;                // 指数最多bits位，即p的位长
+    int a;                   // 一个齿的位数，a * COMB_TEETH >= bits
+    int v;                   // 一个齿的块数
+    int b;                   // 一个块的位数，b * v >= a
+    Limb* table;             // v * 2^COMB_TEETH个mt.len字的数，Montgomery形式
+    int refs;                // 缓存和每个使用它的DoPowModFixed各持有一个，为0时释放
+    long long used;          // 最后一次使用的时刻，最旧的被丢弃以放入新的
+}CombTable;
+
+typedef struct    // type:DaemonMsg，守护进程请求或响应的头，主机字节序
+{
+    unsigned char op;        // DAEMON_OP_IS_PRIME, DAEMON_OP_GEN_PRIME 或 DAEMON_OP_NEXT_PRIME
+    unsigned char flags;     // 请求: gen-prime为1时生成随机素数，响应: DAEMON_OK 或 DAEMON_BAD_REQUEST
+    unsigned short times;    // Miller-Rabin 测试次数
+    unsigned int id;         // 由客户端选择，响应有相同的id
+    unsigned int len;        // 头之后负载的字节数
+}DaemonMsg;
+
+typedef struct DaemonJob    // type:DaemonJob，守护进程客户端的一个请求，然后是它的响应
+{
+    DaemonMsg msg;              // 请求的头，然后是响应的头
+    int client;                 // 客户端的槽
+    unsigned int serial;        // 槽中客户端的序号，已关闭客户端的响应被丢弃
+    int bitLen;                 // gen-prime的位长
+    int len;                    // n 的字数
+    Limb n[MAX_LIMBS];          // is-prime和next-prime的数，然后是结果
+    struct DaemonJob* next;     // 通道或完成列表中的下一个任务
+}DaemonJob;
+
+typedef struct    // type:DaemonClient，守护进程的一个连接，只由I/O线程使用
+{
+    int fd;                     // 套接字，空槽为-1
+    unsigned int serial;        // 槽中的连接计数
+    int inLen;                  // in中的字节数
+    unsigned char in[sizeof(DaemonMsg) + DAEMON_MAX_PAYLOAD];  // 正在读的请求
+    unsigned char* out;         // 还没发送的响应
+    int outLen;                 // out中的字节数
+    int outSize;                // out的大小
+    int pending;                // 已排队但未应答的任务个数
+}DaemonClient;
+
+typedef struct    // type:Daemon，守护进程I/O线程和工作线程共享的队列
+{
+    Mutex lock;                     // 队列的锁
+    Cond ready;                     // 有任务入队，或者一个慢任务完成
+    DaemonJob* head[DAEMON_LANES];  // 每个通道的队列
+    DaemonJob* tail[DAEMON_LANES];
+    DaemonJob* done;                // 给I/O线程的已完成任务
+    int slowBusy;                   // 慢通道上的工作线程数
+    int slowMax;                    // slowBusy的最大值，总留一个工作线程给便宜的通道
+    int wake[2];                    // 管道，工作线程完成任务时写一个字节
+}Daemon;
+
+typedef struct    // type:DaemonWorker，守护进程的工作线程和它的暂存区
+{
+    Daemon* dm;                                 // 守护进程
+    DaemonJob* job[8 * MR64_LANES];             // 从通道取出的一批任务
+    unsigned long long n64[8 * MR64_LANES];     // 快速批的数
+    char prime[8 * MR64_LANES];                 // 快速批的结论
+    BigInt cand[FERMAT_BATCH];                  // 普通批的大数is-prime
+    DaemonJob* candJob[FERMAT_BATCH];           // cand的任务
+    char pass[FERMAT_BATCH];                    // cand的Fermat测试
+}DaemonWorker;
+
+typedef struct    // type:ShardMsg，协调者发给工作进程的分片，主机字节序
+{
+    int times;            // Miller-Rabin 测试次数，0 表示让工作进程停止
+    int pad;
+    long long id;         // 分片的序号
+    long long size;       // 数的个数，a, a + 1, ..., a + size - 1
+    Limb a[MAX_LIMBS];    // 分片的第一个数
+}ShardMsg;
+
+typedef struct    // type:ShardResult，工作进程发回的分片结果，之后是 (size + 7) / 8 字节的位图
+{
+    long long id;         // 分片的序号
+    long long count;      // 分片中素数的个数
+}ShardResult;
+
+typedef struct    // type:ShardWorker, DoShardRange 的一个工作进程连接
+{
+    int fd;               // 套接字，空槽为-1
+    long long shard;      // 分配给工作进程的分片序号，-1 表示没有
+    int need;             // 分片结果的字节数
+    int inLen;            // in中的字节数
+    unsigned char* in;    // 正在读取的结果，一个 ShardResult 和位图
+}ShardWorker;
+
+typedef struct    // type:ShardSlot, DoShardRange 窗口中的分片，分片 id 位于槽 id % window
+{
+    int state;            // SHARD_PENDING、SHARD_RUNNING 或 SHARD_FINISHED
+    int tries;            // 丢失它的工作进程个数
+    long long count;      // 素数的个数
+    unsigned char* bits;  // 分片的第 i 个数是素数时第 i 位置 1
+}ShardSlot;
+
+typedef struct    // type:PipeItem，在流水线各级之间传递的候选数
+{
+    long long seq;              // 候选数在搜索中的顺序，seq 最小的素数就是答案
+    BigInt n;                   // 候选数
+}PipeItem;
+
+typedef struct    // type:PipeRing，一个生产者线程和一个消费者线程之间的有界环形队列，无锁
+{
+    volatile unsigned int head;    // 已取出的个数，只由消费者写
+    char pad0[60];                 // head 和 tail 位于各自的缓存行
+    volatile unsigned int tail;    // 已放入的个数，只由生产者写
+    volatile unsigned int closed;  // 生产者放入最后一个后设置
+    char pad1[56];
+    PipeItem item[PIPE_RING];      // 槽
+}PipeRing;
+
+typedef struct    // type:Pipeline, DoGenPrimePipeline 各级共享的状态
+{
+    int times;                  // Miller-Rabin 测试次数
+    int num[3];                 // 筛选、过滤和确认各级的线程数
+    unsigned long minPrime;     // 筛法只用小于它的小素数
+    BigInt start;               // seq 为 0 的候选数，seq i 为 start - 2i
+    PipeRing* ring[2];          // 筛选 i 到过滤 j: ring[0][i * num[1] + j]，过滤 i 到确认 j: ring[1][i * num[2] + j]
+    volatile long long best;    // 已找到的最佳素数的 seq，PIPE_NONE 表示没有
+    BigInt result;              // seq 为 best 的素数
+    Mutex lock;                 // best 和 result 的锁
+}Pipeline;
+
+typedef struct    // type:PipeWorker，流水线某一级的线程
+{
+    Pipeline* pl;               // 流水线
+    int index;                  // 线程在其所在级中的序号
+}PipeWorker;
+
+typedef void (*GenPrimeProgress)(long long tested, void* arg);  // GenPrimeTask 每测试完一批候选数后调用
+
+typedef struct    // type:GenPrimeTask，在独立线程中运行的素数搜索的句柄
+{
+    int bitLen;                 // 素数的位长
+    int times;                  // Miller-Rabin 测试次数
+    int random;                 // 0 为 GenPrime，1 为 GenRandomPrime
+    long long deadline;         // 搜索停止时的 NowMs()，0 表示没有截止时间
+    volatile int cancel;        // 由 GenPrimeCancel 设置
+    int state;                  // GEN_TASK_RUNNING、GEN_TASK_FOUND、GEN_TASK_CANCELED 或 GEN_TASK_EXPIRED
+    long long tested;           // 已测试的候选数个数，Fermat 或 Miller-Rabin 测试
+    GenPrimeProgress progress;  // 在搜索线程中调用，NULL 表示没有
+    void* arg;                  // progress 的参数
+    BigInt result;              // state 为 GEN_TASK_FOUND 时的素数
+    Mutex lock;                 // state 的锁
+    Cond finish;                // state 不再是 GEN_TASK_RUNNING
+    Thread thread;              // 搜索线程
+}GenPrimeTask;
+
+char* checkpointPath = NULL;   // 素数搜索的检查点文件 NULL表示没有检查点
+int checkpointResume = 0;      // 1表示从检查点文件继续
+int checkpointInterval = 60;   // 两次检查点之间的秒数
+
+PrimeCache* primeCache = NULL;  // 映射的素数缓存文件，NULL表示不缓存
+Mutex primeCacheLock;           // 素数缓存条目的锁，一个进程的多个线程会同时填写它们
+
+THREAD_LOCAL GenPrimeTask* threadTask = NULL;  // 本线程的搜索任务，NULL 表示没有
+
+VerdictShard verdictShard[VERDICT_SHARDS];  // MillerRabin结论缓存的分片
+int verdictCacheSize = 0;                   // 一个分片最多的数的个数，0表示不缓存
+
+CombTable** combCache = NULL;  // DoPowModFixed的梳状表，NULL表示无缓存
+int combCacheSize = 0;         // 梳状表的最大数量，0表示无缓存
+long long combTick = 0;        // 梳状表缓存的时刻，每次使用加一
+Mutex combLock;                // 梳状表缓存及其表的refs的锁
+
+// smallPrime: 小于SMALL_PRIME_BOUND的奇素数，以及试除的表
+// 它们由GenPrimeTable生成并编译进程序，所以启动时不用筛
+#include "miller-rabin_table.h"
+
+// 内核用的常数，编译时设置，从不写入
+BigInt bigZero = {{0}};
+BigInt bigOne = {{1}};
+BigInt bigTwo = {{0, 1}};
+BigInt bigThree = {{1, 1}};
+
+// 确定性 Miller-Rabin 底数，所有 64 位整数都能测试正确
+unsigned long long mrBase64[MR_BASE64_NUM] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+unsigned long long mrBase32[MR_BASE32_NUM] = {2, 7, 61};
+unsigned int tinyPrime[TINY_PRIME_NUM] = {3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+// 模30与30互素的8个余数，以及每个余数在轮位图字节中的位
+const unsigned char wheelResidue[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+const unsigned char wheelBit[30] = {0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 4, 0, 8, 0, 0, 0, 16, 0, 32, 0, 0, 0, 64, 0, 0, 0, 0, 0, 128};
+
+unsigned char* primeBitmap = NULL;  // 映射的小于2^32的素数轮位图，NULL表示没有
+
+// 29 * 2^57 + 1, 69 * 2^55 + 1, 27 * 2^56 + 1
+NttPrime nttPrime[NTT_PRIME_NUM] = {
+    {0x3a00000000000001ULL, 0x39ffffffffffffffULL, 0x1a11a7b9611a7baaULL, 3},
+    {0x2280000000000001ULL, 0x227fffffffffffffULL, 0x1b67e2519f8946b6ULL, 5},
+    {0x1b00000000000001ULL, 0x1affffffffffffffULL, 0x03bda12f684bda6dULL, 5}
+};
+
+// LimbsMulFast的阈值 单位是字 按较短的操作数 可以调整
+int karatsubaThreshold = 32;      // 从它开始用Karatsuba 以下用竖式
+int toom3Threshold = 800;         // 从它开始用Toom-3
+int nttThreshold = 8000;          // 从它开始用数论变换
+
+int useSimd = 1;                  // 为 0 时强制使用标量代码，用于基准测试
+int useAsm = 1;                   // 为0时字运算强制使用C代码 用于性能测试
+
+THREAD_LOCAL Context threadContext;          // 每个线程的默认 Context
+THREAD_LOCAL Context* threadCtx = NULL;      // UseContext 设置的 Context，NULL 表示 threadContext
+
 // 打印BigInt
 void PrintBigInt(BigInt* a)
 {
@@ -379,6 +1042,22 @@ char* BigIntToStr(BigInt* a, char* s)
     return ChangeStringRadix(buf, 2, 10, s);  // 二进制转十进制
 }
 
+// 把long转为BigInt，用补码表示
+BigInt* LongToBigInt(long v, BigInt* a)
+{
+    int i;
+    unsigned long t = v < 0 ? -(unsigned long)v : (unsigned long)v;
+
+    memset(a->bit, 0, BIG_INT_BIT_LEN);
+
+    for (i = 0; t != 0; i++, t >>= 1)
+        a->bit[i] = (char)(t & 1);
+
+    a->bit[SIGN_BIT] = v < 0 ? NEGATIVE : POSITIVE;
+
+    return ToComplement(a, a);
+}
+
 // 复制BigInt
 BigInt* CopyBigInt(BigInt* src, BigInt* dst)
 {
@@ -428,7 +1107,111 @@ BigInt* ShiftArithmeticRight(BigInt* src, int indent, BigInt* dst)
     return dst;
 }
 
-// 加法实现
+// 获取本线程的 Context，即 UseContext 设置的或线程默认的
+// 字符串函数也使用它
+Context* GetContext()
+{
+    Context* ctx = threadCtx;
+
+    return ctx != NULL ? ctx : &threadContext;
+}
+
+// 把 ctx 设为本线程 Do* 函数的 Context，NULL 表示默认的
+// 返回之前使用的 Context，一个 Context 同一时间只能由一个线程使用
+Context* UseContext(Context* ctx)
+{
+    Context* old = GetContext();
+
+    threadCtx = ctx;
+
+    return old;
+}
+
+// 初始化 Context，其随机数生成器在第一次使用时由操作系统设置种子
+Context* InitContext(Context* ctx)
+{
+    memset(ctx, 0, sizeof(Context));
+
+    return ctx;
+}
+
+// 返回本线程 Context 自上次调用以来的第一个错误，并清除它
+int GetError()
+{
+    Context* ctx = GetContext();
+    int error = ctx->error;
+
+    ctx->error = ERROR_NONE;
+
+    return error;
+}
+
+// 在本线程的 Context 中记录第一个错误
+void SetError(int error)
+{
+    Context* ctx = GetContext();
+
+    if (ctx->error == ERROR_NONE)
+        ctx->error = error;
+}
+
+// 清除本线程 Context 的错误，字符串函数一开始就调用它
+void ClearError()
+{
+    GetContext()->error = ERROR_NONE;
+}
+
+// 类型转换：把字符串函数的结果 BigInt 转成字符串(10进制)
+// a 为 NULL 或 ClearError 之后出现错误时返回 NULL
+char* ResultToStr(BigInt* a, char* s)
+{
+    if (GetError() != ERROR_NONE || a == NULL)
+        return NULL;
+
+    return BigIntToStr(a, s);
+}
+
+// 像 printf 一样打印生成素数的进度，本线程的上下文为 quiet 时什么也不打印
+void PrintProgress(char* format, ...)
+{
+    va_list ap;
+
+    if (GetContext()->quiet)
+        return;
+
+    va_start(ap, format);
+    vprintf(format, ap);
+    va_end(ap);
+}
+
+// 获取本线程的工作区 不带Ws的Do*函数使用它
+Workspace* GetThreadWorkspace()
+{
+    return &GetContext()->ws;
+}
+
+// 从工作区取一个临时BigInt 未初始化
+// 工作区用完时设置 ERROR_MEMORY 并给出备用的一个，这样 WsFree 仍然对应，
+// 字符串函数会返回 NULL
+BigInt* WsAlloc(Workspace* ws)
+{
+    if (ws->top >= WORKSPACE_SIZE)
+    {
+        SetError(ERROR_MEMORY);
+        ws->top++;
+        return &ws->spare;
+    }
+
+    return &ws->t[ws->top++];
+}
+
+// 归还最后取的n个临时BigInt
+void WsFree(Workspace* ws, int n)
+{
+    ws->top -= n;
+}
+
+// 加法实现 result = a + b 溢出时在本线程的 Context 中设置 ERROR_OVERFLOW
 BigInt* DoAdd(BigInt* a, BigInt* b, BigInt* result)
 {
     int i, t, carryFlag;           // 进位标志
@@ -443,71 +1226,143 @@ BigInt* DoAdd(BigInt* a, BigInt* b, BigInt* result)
     }
 
     if (aSign == bSign && aSign != result->bit[SIGN_BIT])
-    {
-        printf("Overflow XD\n");
-        exit(1);
-    }
+        SetError(ERROR_OVERFLOW);
 
     return result;
 }
 
-// 减法实现
+// 减法实现 result = a - b = a + ~b + 1 不复制-b result可以是a或b
+// 溢出时在本线程的 Context 中设置 ERROR_OVERFLOW
 BigInt* DoSub(BigInt* a, BigInt* b, BigInt* result)
 {
-    BigInt t;
+    int i, t, carryFlag;
+    int aSign = a->bit[SIGN_BIT];   // a的符号
+    int bSign = !b->bit[SIGN_BIT];  // ~b的符号
+
+    for (carryFlag = 1, i = 0; i < BIG_INT_BIT_LEN; i++)
+    {
+        t = a->bit[i] + !b->bit[i] + carryFlag;
+        result->bit[i] = t & 1;
+        carryFlag = t >> 1;
+    }
 
-    ToOppositeNumberComplement(b, &t);
-    DoAdd(a, &t, result);
+    if (aSign == bSign && aSign != result->bit[SIGN_BIT])
+        SetError(ERROR_OVERFLOW);
 
     return result;
 }
 
-// 乘法实现 Booth算法[补码1位乘] 转化为移位和加法
-BigInt* DoMul(BigInt* a, BigInt* b, BigInt* result)
+// 最高的不等于符号位的位 没有则为-1
+int GetTopBit(BigInt* a)
 {
     int i;
-    BigInt c, t;
+    char s = a->bit[SIGN_BIT];
 
-    ToOppositeNumberComplement(a, &c);  // c=[-a]的补
+    for (i = SIGN_BIT - 1; i >= 0 && a->bit[i] == s; i--);
 
-    memset(t.bit, 0, BIG_INT_BIT_LEN);  // 初始化为0
+    return i;
+}
 
-    // 从高位处开始，过滤相同的位，因为相减为0
-    for (i = SIGN_BIT; i > 0 && b->bit[i] == b->bit[i - 1]; i--);
+// t = t + (a << k), top: GetTopBit(a)
+// a在top以上的位都等于符号位 所以进位等于符号位后
+// 和就不再变化
+void DoAddShifted(BigInt* t, BigInt* a, int k, int top)
+{
+    int i, j, s, carryFlag;
+    char sign = a->bit[SIGN_BIT];
 
-    while (i > 0)
+    for (carryFlag = 0, i = k, j = 0; i < BIG_INT_BIT_LEN; i++, j++)
     {
-        ShiftArithmeticLeft(&t, 1, &t);
+        if (j > top && carryFlag == sign)
+            break;
 
-        if (b->bit[i] != b->bit[i - 1])
-        {
-            DoAdd(&t, b->bit[i - 1] > b->bit[i] ? a : &c, &t);
-        }
+        s = t->bit[i] + a->bit[j] + carryFlag;
+        t->bit[i] = s & 1;
+        carryFlag = s >> 1;
+    }
+}
 
-        i--;
+// 乘法实现 Booth算法[补码1位乘] 转化为移位和加法
+// b = (b[k-1] - b[k]) * 2^k 之和，b[-1] = 0
+// 所以在b的位变化处加上 a << k 或 -a << k 不用移动部分积
+// result = a * b, result可以是a或b，溢出时在本线程的上下文中设置ERROR_OVERFLOW
+BigInt* DoMulWs(BigInt* a, BigInt* b, BigInt* result, Workspace* ws)
+{
+    int i, aTop, bTop, cTop, used = 1;
+    char sign = a->bit[SIGN_BIT] ^ b->bit[SIGN_BIT];  // 积的符号
+    BigInt *c, *t;
+
+    c = WsAlloc(ws);
+    ToOppositeNumberComplement(a, c);  // c=[-a]的补
+    aTop = GetTopBit(a);
+    bTop = GetTopBit(b);
+    cTop = GetTopBit(c);
+
+    // result不是操作数时直接写入result
+    if (result == a || result == b)
+    {
+        t = WsAlloc(ws);
+        used++;
     }
+    else
+        t = result;
+
+    memset(t->bit, 0, BIG_INT_BIT_LEN);  // 初始化为0
 
-    // 最后一步的移位
-    ShiftArithmeticLeft(&t, 1, &t);
     if (b->bit[0] != 0)
+        DoAddShifted(t, c, 0, cTop);
+
+    for (i = 1; i < BIG_INT_BIT_LEN; i++)
     {
-        DoAdd(&t, &c, &t);
+        if (b->bit[i] != b->bit[i - 1])
+        {
+            if (b->bit[i - 1] > b->bit[i])
+                DoAddShifted(t, a, i, aTop);
+            else
+                DoAddShifted(t, c, i, cTop);
+        }
     }
 
-    return CopyBigInt(&t, result);
+    // |a|在[2^aTop, 2^(aTop+1)]中，所以|a * b|在[2^(aTop+bTop), 2^(aTop+bTop+2)]中
+    // 和是积 mod 2^BIG_INT_BIT_LEN，接近上限时若符号不对或为0则溢出了
+    if (aTop + bTop >= SIGN_BIT ||
+        (aTop + bTop >= SIGN_BIT - 2 && (t->bit[SIGN_BIT] != sign || GetTopBit(t) < 0)))
+        SetError(ERROR_OVERFLOW);
+
+    if (t != result)
+        CopyBigInt(t, result);
+
+    WsFree(ws, used);
+
+    return result;
+}
+
+// result = a * b
+BigInt* DoMul(BigInt* a, BigInt* b, BigInt* result)
+{
+    return DoMulWs(a, b, result, GetThreadWorkspace());
 }
 
-// 在不溢出的情况下，获取最大算术左移的长度
+// 获取最大左移长度 直接从补码读取
+// 负数 |a| = ~a + 1 低位全为0时长一位
 int GetMaxLeftShiftLen(BigInt* a)
 {
-    int i, k;
-    BigInt t;
+    int i, j;
 
-    ToTrueForm(a, &t);
+    i = GetTopBit(a);
+
+    if (a->bit[SIGN_BIT] == NEGATIVE)
+    {
+        for (j = 0; j < i && a->bit[j] == 0; j++);
+
+        if (j >= i)
+            i++;
 
-    for (i = SIGN_BIT - 1, k = 0; i >= 0 && t.bit[i] == 0; i--, k++);
+        if (i == SIGN_BIT)  // -0
+            return SIGN_BIT;
+    }
 
-    return k;
+    return SIGN_BIT - 1 - i;
 }
 
 // 在不溢出的情况下，获取最大算术右移的位数
@@ -533,32 +1388,38 @@ int IsZero(BigInt* a)
 }
 
 // 除法实现 用2分法去求商的各个为1的位 写得不够简洁><
-BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
+// 临时变量从ws中取 result和remainder可以是a或b
+BigInt* DoDivWs(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder, Workspace* ws)
 {
     int low, high, mid;
-    BigInt c, d, e, t;
+    BigInt *c, *d, *e, *t;
+
+    c = WsAlloc(ws);  // dividend
+    d = WsAlloc(ws);  // 移位后的除数
+    e = WsAlloc(ws);  // 试减的差
+    t = WsAlloc(ws);  // quotient
 
     low = 0;                       // 初始化左移下限值
     high = GetMaxLeftShiftLen(b);  // 获取最大算术左移的长度
 
-    memset(t.bit, 0, BIG_INT_BIT_LEN);  // 初始化商为0
-    CopyBigInt(a, &c);                  // 初始化c为被除数a
+    memset(t->bit, 0, BIG_INT_BIT_LEN);  // 初始化为0
+    CopyBigInt(a, c);                   // 初始化c为被除数a
 
     // 同号情况作减
     if (a->bit[SIGN_BIT] == b->bit[SIGN_BIT])
     {
-        t.bit[SIGN_BIT] = POSITIVE;
+        t->bit[SIGN_BIT] = POSITIVE;
 
         while (1)
         {
             while (low <= high)
             {
                 mid = (low + high) / 2;
-                ShiftArithmeticLeft(b, mid, &d);
-                DoSub(&c, &d, &e);  // e = c - d
+                ShiftArithmeticLeft(b, mid, d);
+                DoSub(c, d, e);  // e = c - d
 
                 // e >= 0，表示够减
-                if (d.bit[SIGN_BIT] == e.bit[SIGN_BIT] || IsZero(&e))
+                if (d->bit[SIGN_BIT] == e->bit[SIGN_BIT] || IsZero(e))
                     low = mid + 1;
                 else
                     high = mid - 1;
@@ -568,11 +1429,11 @@ BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
             // high == -1 表示已经连1倍的除数都不够减了
             if (high != -1)
             {
-                t.bit[high] = 1;
+                t->bit[high] = 1;
 
                 // 这里统一操作了，可改进
-                ShiftArithmeticLeft(b, high, &d);
-                DoSub(&c, &d, &c);  // c = c - d
+                ShiftArithmeticLeft(b, high, d);
+                DoSub(c, d, c);
                 
                 low = 0;
                 high--;
@@ -580,7 +1441,7 @@ BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
             else
             {
                 // 这时c所表示的被除数即为最后的余数
-                CopyBigInt(&c, remainder);
+                CopyBigInt(c, remainder);
                 break;
             }
         }
@@ -589,18 +1450,18 @@ BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
     // 异号情况作加
     else
     {
-        t.bit[SIGN_BIT] = NEGATIVE;
+        t->bit[SIGN_BIT] = NEGATIVE;
 
         while (1)
         {
             while (low <= high)
             {
                 mid = (low + high) / 2;
-                ShiftArithmeticLeft(b, mid, &d);
-                DoAdd(&c, &d, &e);  // e = c + d
+                ShiftArithmeticLeft(b, mid, d);
+                DoAdd(c, d, e);  // e = c + d
 
                 // e >= 0
-                if (d.bit[SIGN_BIT] != e.bit[SIGN_BIT] || IsZero(&e))
+                if (d->bit[SIGN_BIT] != e->bit[SIGN_BIT] || IsZero(e))
                     low = mid + 1;
                 else
                     high = mid - 1;
@@ -610,11 +1471,11 @@ BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
             // high == -1 表示已经连1倍的除数都不够减了
             if (high != -1)
             {
-                t.bit[high] = 1;
+                t->bit[high] = 1;
 
                 // 这里统一操作了，可改进
-                ShiftArithmeticLeft(b, high, &d);
-                DoAdd(&c, &d, &c);  // c = c + d
+                ShiftArithmeticLeft(b, high, d);
+                DoAdd(c, d, c);
 
                 low = 0;
                 high--;
@@ -622,73 +1483,89 @@ BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
             else
             {
                 // 这时c所表示的被除数即为最后的余数
-                CopyBigInt(&c, remainder);
+                CopyBigInt(c, remainder);
                 break;
             }
         }
     }
 
-    return ToComplement(&t, result);
+    ToComplement(t, result);
+    WsFree(ws, 4);
+
+    return result;
+}
+
+// result = a / b
+BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
+{
+    return DoDivWs(a, b, result, remainder, GetThreadWorkspace());
 }
 
 char* Add(char* s1, char* s2, char* result)
 {
     BigInt a, b, c;
-    
+
+    ClearError();
     StrToBigInt(s1, &a);
     StrToBigInt(s2, &b);
     DoAdd(&a, &b, &c);
 
-    return BigIntToStr(&c, result);
+    return ResultToStr(&c, result);
 }
 
 char* Sub(char* s1, char* s2, char* result)
 {
     BigInt a, b, c;
 
+    ClearError();
     StrToBigInt(s1, &a);
     StrToBigInt(s2, &b);
     DoSub(&a, &b, &c);
-    
-    return BigIntToStr(&c, result);
+
+    return ResultToStr(&c, result);
 }
 
 char* Mul(char* s1, char* s2, char* result)
 {
     BigInt a, b, c;
 
+    ClearError();
     StrToBigInt(s1, &a);
     StrToBigInt(s2, &b);
     DoMul(&a, &b, &c);
 
-    return BigIntToStr(&c, result);
+    return ResultToStr(&c, result);
 }
 
 char* Div(char* s1, char* s2, char* result, char* remainder)
 {
     BigInt a, b, c, d;
 
+    ClearError();
     StrToBigInt(s1, &a);
     StrToBigInt(s2, &b);
     DoDiv(&a, &b, &c, &d);
-    BigIntToStr(&d, remainder);
+    if (ResultToStr(&d, remainder) == NULL)
+        return NULL;
 
     return BigIntToStr(&c, result);
 }
 
 // 比较两个BigInt的大小
+// 符号相同时 补码可以像无符号数一样比较
 int DoCompare(BigInt* a, BigInt* b)
 {
-    BigInt c;
+    int i;
+
+    if (a->bit[SIGN_BIT] != b->bit[SIGN_BIT])
+        return a->bit[SIGN_BIT] == POSITIVE ? 1 : -1;
 
-    DoSub(a, b, &c);
+    for (i = SIGN_BIT - 1; i >= 0 && a->bit[i] == b->bit[i]; i--);
 
-    if (IsZero(&c))
+    if (i < 0)
         return 0;
-    if (c.bit[SIGN_BIT] == POSITIVE)
-        return 1;
-    else
-        return -1;
+
+    return a->bit[i] > b->bit[i] ? 1 : -1;
 }
 
 int Compare(char* s1, char* s2)
@@ -702,285 +1579,7151 @@ int Compare(char* s1, char* s2)
 }
 
 // 求模实现
+BigInt* DoModWs(BigInt* a, BigInt* b, BigInt* remainder, Workspace* ws)
+{
+    DoDivWs(a, b, WsAlloc(ws), remainder, ws);
+    WsFree(ws, 1);
+
+    return remainder;
+}
+
 BigInt* DoMod(BigInt* a, BigInt* b, BigInt* remainder)
 {
-    BigInt c;
+    return DoModWs(a, b, remainder, GetThreadWorkspace());
+}
 
-    DoDiv(a, b, &c, remainder);
+// result = a * b % n, result可以是a, b或n
+BigInt* DoMulModWs(BigInt* a, BigInt* b, BigInt* n, BigInt* result, Workspace* ws)
+{
+    BigInt* t = WsAlloc(ws);
 
-    return remainder;
+    DoMulWs(a, b, t, ws);
+    DoModWs(t, n, result, ws);
+    WsFree(ws, 1);
+
+    return result;
+}
+
+BigInt* DoMulMod(BigInt* a, BigInt* b, BigInt* n, BigInt* result)
+{
+    return DoMulModWs(a, b, n, result, GetThreadWorkspace());
 }
 
 char* Mod(char* s1, char* s2, char* remainder)
 {
     BigInt a, b, c;
 
+    ClearError();
     StrToBigInt(s1, &a);
     StrToBigInt(s2, &b);
     DoMod(&a, &b, &c);
 
-    return BigIntToStr(&c, remainder);
+    return ResultToStr(&c, remainder);
 }
 
 // 获取BigInt真值的位长度
 int GetTrueValueLen(BigInt* a)
 {
-    int i;
-    BigInt t;
-
-    ToTrueForm(a, &t);
-
-    for (i = SIGN_BIT - 1; i >= 0 && t.bit[i] == 0; i--);
+    return SIGN_BIT - GetMaxLeftShiftLen(a);
+}
 
-    return i + 1;
+// (hi, lo) = a * b，两个字的 128 位乘积，返回 lo
+static INLINE Limb MulLimb(Limb a, Limb b, Limb* hi)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 t = (unsigned __int128)a * b;
+
+    *hi = (Limb)(t >> 64);
+    return (Limb)t;
+#else
+    Limb a0 = a & 0xffffffff, a1 = a >> 32;
+    Limb b0 = b & 0xffffffff, b1 = b >> 32;
+    Limb p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    Limb mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return mid << 32 | (p00 & 0xffffffff);
+#endif
 }
 
-// 幂运算(二进制实现) 不能求负幂
-BigInt* DoPow(BigInt* a, BigInt* b, BigInt* result)
+// q = (hi, lo) / d, r = (hi, lo) % d，hi 必须小于 d
+static INLINE Limb DivLimb(Limb hi, Limb lo, Limb d, Limb* r)
 {
-    int i, len;
-    BigInt t, buf;
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 t = (unsigned __int128)hi << 64 | lo;
 
-    CopyBigInt(a, &buf);
-    StrToBigInt("1", &t);
-    len = GetTrueValueLen(b);  // 获取BigInt真值的位长度
+    *r = (Limb)(t % d);
+    return (Limb)(t / d);
+#else
+    int i;
+    Limb c, q = 0;
 
-    for (i = 0; i < len; i++)
+    for (i = 0; i < LIMB_BITS; i++)
     {
-        if (b->bit[i] == 1)
-            DoMul(&t, &buf, &t);  // t = t * buf
+        c = hi >> 63;
+        hi = hi << 1 | lo >> 63;
+        lo <<= 1;
+        q <<= 1;
 
-        // 这里最后多做了一次
-        DoMul(&buf, &buf, &buf);  // buf = buf * buf
+        if (c || hi >= d)
+        {
+            hi -= d;
+            q |= 1;
+        }
     }
-    
-    return CopyBigInt(&t, result);
-}
-
-char* Pow(char* s1, char* s2, char* result)
-{
-    BigInt a, b, c;
-
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    DoPow(&a, &b, &c);
 
-    return BigIntToStr(&c, result);
+    *r = hi;
+    return q;
+#endif
 }
 
-// 模幂运算(二进制实现)
-BigInt* DoPowMod(BigInt* a, BigInt* b, BigInt* c, BigInt* result)
+// 把BigInt转为字数组，a 必须非负
+// x 有 MAX_LIMBS 个字，返回去掉前导 0 后的字数
+int BigIntToLimbs(BigInt* a, Limb* x)
 {
-    int i, len;
-    unsigned long t1, t2;
-    BigInt t, buf;
+    int i, j, len;
 
-    printf("    doing PowMod...\n");
-    t1 = time(0);
-    CopyBigInt(a, &buf);
-    StrToBigInt("1", &t);
-    len = GetTrueValueLen(b);  // 获取BigInt真值的位长度
-
-    for (i = 0; i < len; i++)
+    for (i = 0; i < MAX_LIMBS; i++)
     {
-        if (b->bit[i] == 1)
+        x[i] = 0;
+        for (j = LIMB_BITS - 1; j >= 0; j--)
         {
-            DoMul(&t, &buf, &t);  // t = t * buf
-            DoMod(&t, c, &t);     // t = t % c;
+            if (i * LIMB_BITS + j < SIGN_BIT)
+                x[i] = x[i] << 1 | a->bit[i * LIMB_BITS + j];
+            else
+                x[i] <<= 1;
         }
-
-        // 这里最后多做了一次
-        DoMul(&buf, &buf, &buf);  // buf = buf * buf
-        DoMod(&buf, c, &buf);     // buf = buf % c
     }
-    t2 = time(0);
-    printf("    finish PowMod (t=%lds)\n", t2 - t1);
 
-    return CopyBigInt(&t, result);
+    for (len = MAX_LIMBS; len > 0 && x[len - 1] == 0; len--);
+
+    return len;
 }
 
-char* PowMod(char* s1, char* s2, char* s3, char* result)
+// 把 n 个字转为BigInt
+BigInt* LimbsToBigInt(Limb* x, int n, BigInt* a)
 {
-    BigInt a, b, c, d;
+    int i;
 
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    StrToBigInt(s3, &c);
-    DoPowMod(&a, &b, &c, &d);
+    memset(a->bit, 0, BIG_INT_BIT_LEN);
+
+    for (i = 0; i < n * LIMB_BITS && i < SIGN_BIT; i++)
+        a->bit[i] = (char)(x[i / LIMB_BITS] >> (i % LIMB_BITS) & 1);
 
-    return BigIntToStr(&d, result);
+    return a;
 }
 
-// 获取指定位数的奇数BigInt
-BigInt* DoGetOddRandBigInt(int bitLen, BigInt* result)
+// 比较两个 n 个字的数
+// a > b, return 1
+// a = b, return 0
+// 比较两个BigInt的大小
+int LimbsCompare(Limb* a, Limb* b, int n)
 {
     int i;
-    static unsigned long seed = 0;
-
-    memset(result->bit, 0, BIG_INT_BIT_LEN);
-    result->bit[0] = 1;
 
-    srand(time(0) + seed++);
-    for (i = 1; i < bitLen - 1; i++)
+    for (i = n - 1; i >= 0; i--)
     {
-        result->bit[i] = rand() % 2;
+        if (a[i] != b[i])
+            return a[i] > b[i] ? 1 : -1;
     }
 
-    result->bit[i] = 1;
-
-    return result;
+    return 0;
 }
 
-char* GetOddRandBigInt(int bitLen, char* result)
+// 检查CPU是否支持BMI2(MULX)和ADX(ADCX, ADOX)
+int CpuHasAdx()
 {
-    BigInt a;
+#ifdef USE_ADX
+    static THREAD_LOCAL int has = -1;  // 每个线程检查一次，这样线程之间不共享状态
+    unsigned int a, b, c, d;
 
-    DoGetOddRandBigInt(bitLen, &a);
+    if (has < 0)
+        has = __get_cpuid_count(7, 0, &a, &b, &c, &d) && (b >> 8 & 1) && (b >> 19 & 1);
 
-    return BigIntToStr(&a, result);
+    return has;
+#else
+    return 0;
+#endif
+}
+
+#ifdef USE_ADX
+// r = a * b, r和a都是n个字(n > 0) 返回进位字
+// 一条进位链: CF用于lo + 上一个hi
+static Limb LimbsMul1Adx(Limb* r, Limb* a, long n, Limb b)
+{
+    Limb lo, hi, c = 0;
+
+    __asm__ volatile(
+        "xorl %k[lo], %k[lo]\n\t"           // 清除CF和OF
+        "1:\n\t"
+        "mulxq (%[a]), %[lo], %[hi]\n\t"    // hi:lo = a[i] * b
+        "adcxq %[c], %[lo]\n\t"             // lo = lo + c + CF
+        "movq %[lo], (%[r])\n\t"
+        "movq %[hi], %[c]\n\t"
+        "leaq 8(%[a]), %[a]\n\t"            // lea和jrcxz不改变标志位
+        "leaq 8(%[r]), %[r]\n\t"
+        "leaq -1(%%rcx), %%rcx\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %k[lo]\n\t"
+        "adcxq %[lo], %[c]\n\t"             // c = c + CF
+        : [c] "+&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [a] "+&r"(a), [r] "+&r"(r), "+c"(n)
+        : "d"(b)
+        : "cc", "memory");
+
+    return c;
+}
+
+// r = r + a * b, r和a都是n个字(n > 0) 返回进位字
+// 两条进位链: CF用于lo + 上一个hi, OF用于把它加到r[i]
+// 循环每次处理2个字 奇数时第一个字先用C计算
+static Limb LimbsAddMul1Adx(Limb* r, Limb* a, long n, Limb b)
+{
+    Limb lo, hi, lo2, hi2, c = 0;
+
+    if (n & 1)
+    {
+        lo = MulLimb(a[0], b, &hi);
+        r[0] += lo;
+        c = hi + (r[0] < lo);
+
+        if (--n == 0)
+            return c;
+        r++;
+        a++;
+    }
+    n /= 2;
+
+    __asm__ volatile(
+        "xorl %k[lo], %k[lo]\n\t"           // 清除CF和OF
+        "1:\n\t"
+        "mulxq (%[a]), %[lo], %[hi]\n\t"    // hi:lo = a[i] * b
+        "mulxq 8(%[a]), %[lo2], %[hi2]\n\t" // hi2:lo2 = a[i+1] * b
+        "adcxq %[c], %[lo]\n\t"             // lo = lo + c + CF
+        "adoxq (%[r]), %[lo]\n\t"           // lo = lo + r[i] + OF
+        "movq %[lo], (%[r])\n\t"
+        "adcxq %[hi], %[lo2]\n\t"           // lo2 = lo2 + hi + CF
+        "adoxq 8(%[r]), %[lo2]\n\t"         // lo2 = lo2 + r[i+1] + OF
+        "movq %[lo2], 8(%[r])\n\t"
+        "movq %[hi2], %[c]\n\t"
+        "leaq 16(%[a]), %[a]\n\t"
+        "leaq 16(%[r]), %[r]\n\t"
+        "leaq -1(%%rcx), %%rcx\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %k[lo]\n\t"
+        "adcxq %[lo], %[c]\n\t"             // c = c + CF + OF，不会溢出
+        "adoxq %[lo], %[c]\n\t"
+        : [c] "+&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [lo2] "=&r"(lo2), [hi2] "=&r"(hi2),
+          [a] "+&r"(a), [r] "+&r"(r), "+c"(n)
+        : "d"(b)
+        : "cc", "memory");
+
+    return c;
+}
+
+// r = r - a * b, r和a都是n个字(n > 0) 返回借位字
+// r - t = r + ~t + 1，所以减法是OF链上的加法 OF初始为1
+static Limb LimbsSubMul1Adx(Limb* r, Limb* a, long n, Limb b)
+{
+    Limb lo, hi, t, c = 0;
+
+    __asm__ volatile(
+        "xorl %k[lo], %k[lo]\n\t"           // 清除CF和OF
+        "movq $-1, %[t]\n\t"
+        "adoxq %[t], %[t]\n\t"              // 设置OF
+        "1:\n\t"
+        "mulxq (%[a]), %[lo], %[hi]\n\t"    // hi:lo = a[i] * b
+        "adcxq %[c], %[lo]\n\t"             // lo = lo + c + CF
+        "notq %[lo]\n\t"
+        "movq (%[r]), %[t]\n\t"
+        "adoxq %[lo], %[t]\n\t"             // r[i] = r[i] + ~lo + OF
+        "movq %[t], (%[r])\n\t"
+        "movq %[hi], %[c]\n\t"
+        "leaq 8(%[a]), %[a]\n\t"
+        "leaq 8(%[r]), %[r]\n\t"
+        "leaq -1(%%rcx), %%rcx\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %k[lo]\n\t"
+        "movl $0, %k[t]\n\t"
+        "adcxq %[lo], %[c]\n\t"             // c = c + CF
+        "adoxq %[lo], %[t]\n\t"             // t = OF, 0表示有借位
+        "xorq $1, %[t]\n\t"
+        "addq %[t], %[c]\n\t"
+        : [c] "+&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [t] "=&r"(t), [a] "+&r"(a), [r] "+&r"(r), "+c"(n)
+        : "d"(b)
+        : "cc", "memory");
+
+    return c;
+}
+#endif
+
+// r = a + b，都是 n 个字，返回进位
+Limb LimbsAdd(Limb* r, Limb* a, Limb* b, int n)
+{
+    int i;
+    Limb t, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        t = a[i] + c;
+        c = t < c;
+        r[i] = t + b[i];
+        c += r[i] < t;
+    }
+
+    return c;
+}
+
+// r = a - b，都是 n 个字，返回借位
+Limb LimbsSub(Limb* r, Limb* a, Limb* b, int n)
+{
+    int i;
+    Limb t, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        t = a[i] - c;
+        c = t > a[i];
+        r[i] = t - b[i];
+        c += r[i] > t;
+    }
+
+    return c;
+}
+
+// r = a * b, r和a都是n个字 返回进位字
+static INLINE Limb Mul1C(Limb* r, Limb* a, int n, Limb b)
+{
+    int i;
+    Limb hi, lo, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        lo = MulLimb(a[i], b, &hi);
+        r[i] = lo + c;
+        c = hi + (r[i] < lo);
+    }
+
+    return c;
+}
+
+// r = r + a * b，r 和 a 都是 n 个字，返回进位的字
+static INLINE Limb AddMul1C(Limb* r, Limb* a, int n, Limb b)
+{
+    int i;
+    Limb hi, lo, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        lo = MulLimb(a[i], b, &hi);
+        lo += c;
+        hi += lo < c;
+        r[i] += lo;
+        c = hi + (r[i] < lo);
+    }
+
+    return c;
+}
+
+// r = r - a * b，r 和 a 都是 n 个字，返回借位字
+static INLINE Limb SubMul1C(Limb* r, Limb* a, int n, Limb b)
+{
+    int i;
+    Limb hi, lo, t, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        lo = MulLimb(a[i], b, &hi);
+        lo += c;
+        hi += lo < c;
+        t = r[i];
+        r[i] = t - lo;
+        c = hi + (r[i] > t);
+    }
+
+    return c;
+}
+
+// r = r + a * b, adx: 1表示使用汇编代码 此时n必须大于0
+static INLINE Limb AddMul1(Limb* r, Limb* a, int n, Limb b, int adx)
+{
+#ifdef USE_ADX
+    if (adx)
+        return LimbsAddMul1Adx(r, a, n, b);
+#else
+    (void)adx;
+#endif
+    return AddMul1C(r, a, n, b);
+}
+
+// r = a * b, adx: 1表示使用汇编代码 此时n必须大于0
+static INLINE Limb Mul1(Limb* r, Limb* a, int n, Limb b, int adx)
+{
+#ifdef USE_ADX
+    if (adx)
+        return LimbsMul1Adx(r, a, n, b);
+#else
+    (void)adx;
+#endif
+    return Mul1C(r, a, n, b);
+}
+
+// r = a * b, r和a都是n个字 返回进位字
+Limb LimbsMul1(Limb* r, Limb* a, int n, Limb b)
+{
+    return Mul1(r, a, n, b, n > 0 && useAsm && CpuHasAdx());
+}
+
+// r = r + a * b，r 和 a 都是 n 个字，返回进位的字
+Limb LimbsAddMul1(Limb* r, Limb* a, int n, Limb b)
+{
+    return AddMul1(r, a, n, b, n > 0 && useAsm && CpuHasAdx());
+}
+
+// r = r - a * b，r 和 a 都是 n 个字，返回借位字
+Limb LimbsSubMul1(Limb* r, Limb* a, int n, Limb b)
+{
+#ifdef USE_ADX
+    if (n > 0 && useAsm && CpuHasAdx())
+        return LimbsSubMul1Adx(r, a, n, b);
+#endif
+    return SubMul1C(r, a, n, b);
+}
+
+// 获取去掉前导 0 后的字数
+int LimbsLen(Limb* a, int n)
+{
+    for (; n > 0 && a[n - 1] == 0; n--);
+
+    return n;
+}
+
+// 获取 n 个字的数的位长
+int LimbsBitLen(Limb* a, int n)
+{
+    int i;
+
+    n = LimbsLen(a, n);
+    if (n == 0)
+        return 0;
+
+    for (i = LIMB_BITS - 1; (a[n - 1] >> i & 1) == 0; i--);
+
+    return (n - 1) * LIMB_BITS + i + 1;
+}
+
+// r = a * b，r 有 aLen + bLen 个字，不能和 a 或 b 相同
+void LimbsMul(Limb* r, Limb* a, int aLen, Limb* b, int bLen)
+{
+    int i;
+
+    if (bLen == 0)
+    {
+        memset(r, 0, aLen * sizeof(Limb));
+        return;
+    }
+
+    r[aLen] = LimbsMul1(r, a, aLen, b[0]);
+
+    for (i = 1; i < bLen; i++)
+        r[i + aLen] = LimbsAddMul1(r + i, a, aLen, b[i]);
+}
+
+// 用 Knuth 算法 D 计算 q = a / b, r = a % b
+// a 有 aLen 个字，b 有 bLen 个字且 b[bLen-1] 不能为 0
+// aLen >= bLen 时 q 有 aLen - bLen + 1 个字，r 有 bLen 个字
+void LimbsDivMod(Limb* a, int aLen, Limb* b, int bLen, Limb* q, Limb* r)
+{
+    int i, j, s;
+    Limb qh, rh, hi, lo, t;
+    Limb u[2 * MAX_LIMBS + 1], v[2 * MAX_LIMBS];
+
+    if (aLen < bLen)
+    {
+        memset(r, 0, bLen * sizeof(Limb));
+        memcpy(r, a, aLen * sizeof(Limb));
+        return;
+    }
+
+    if (bLen == 1)
+    {
+        for (rh = 0, i = aLen - 1; i >= 0; i--)
+            q[i] = DivLimb(rh, a[i], b[0], &rh);
+
+        r[0] = rh;
+        return;
+    }
+
+    // 规格化，使 v 的最高位为 1
+    for (s = 0; (b[bLen - 1] << s >> (LIMB_BITS - 1)) == 0; s++);
+
+    for (i = bLen - 1; i > 0; i--)
+        v[i] = s ? b[i] << s | b[i - 1] >> (LIMB_BITS - s) : b[i];
+    v[0] = b[0] << s;
+
+    u[aLen] = s ? a[aLen - 1] >> (LIMB_BITS - s) : 0;
+    for (i = aLen - 1; i > 0; i--)
+        u[i] = s ? a[i] << s | a[i - 1] >> (LIMB_BITS - s) : a[i];
+    u[0] = a[0] << s;
+
+    for (j = aLen - bLen; j >= 0; j--)
+    {
+        // 用最高两个字估计商
+        // 估计值最多比正确值大 2
+        if (u[j + bLen] >= v[bLen - 1])
+        {
+            qh = ~(Limb)0;
+            rh = u[j + bLen - 1] + v[bLen - 1];
+            t = rh < v[bLen - 1];  // rh 溢出
+        }
+        else
+        {
+            qh = DivLimb(u[j + bLen], u[j + bLen - 1], v[bLen - 1], &rh);
+            t = 0;
+        }
+
+        while (!t)
+        {
+            lo = MulLimb(qh, v[bLen - 2], &hi);
+            if (hi < rh || (hi == rh && lo <= u[j + bLen - 2]))
+                break;
+
+            qh--;
+            rh += v[bLen - 1];
+            t = rh < v[bLen - 1];
+        }
+
+        // u = u - qh * v，为负时加回
+        t = LimbsSubMul1(u + j, v, bLen, qh);
+        if (u[j + bLen] < t)
+        {
+            qh--;
+            u[j + bLen] += LimbsAdd(u + j, u + j, v, bLen);
+        }
+        u[j + bLen] -= t;
+
+        q[j] = qh;
+    }
+
+    for (i = 0; i < bLen - 1; i++)
+        r[i] = s ? u[i] >> s | u[i + 1] << (LIMB_BITS - s) : u[i];
+    r[bLen - 1] = u[bLen - 1] >> s;
+}
+
+// 用欧几里得算法计算 r = gcd(a, b)，都是 n 个字
+void LimbsGcd(Limb* a, Limb* b, int n, Limb* r)
+{
+    int len0, len1;
+    Limb r0[MAX_LIMBS], r1[MAX_LIMBS], q[MAX_LIMBS + 1], rem[MAX_LIMBS];
+
+    memcpy(r0, a, n * sizeof(Limb));
+    memcpy(r1, b, n * sizeof(Limb));
+
+    while ((len1 = LimbsLen(r1, n)) > 0)
+    {
+        len0 = LimbsLen(r0, n);
+        memset(rem, 0, n * sizeof(Limb));
+        LimbsDivMod(r0, len0, r1, len1, q, rem);  // rem = r0 % r1
+
+        memcpy(r0, r1, n * sizeof(Limb));
+        memcpy(r1, rem, n * sizeof(Limb));
+    }
+
+    memcpy(r, r0, n * sizeof(Limb));
+}
+
+// 用扩展欧几里得算法计算 r = a^-1 mod m，a < m，m > 1，都是 n 个字
+// a 的系数正负交替，因此只保存绝对值
+// t(k+1) = t(k-1) + q(k) * t(k)，且它们都小于 m
+// gcd(a, m) != 1 时返回 0
+int LimbsInverse(Limb* a, Limb* m, int n, Limb* r)
+{
+    int len0, len1, sign = 0;
+    Limb r0[MAX_LIMBS], r1[MAX_LIMBS], t0[MAX_LIMBS], t1[MAX_LIMBS];
+    Limb q[MAX_LIMBS + 1], rem[MAX_LIMBS], t[2 * MAX_LIMBS + 1];
+
+    memcpy(r0, m, n * sizeof(Limb));
+    memcpy(r1, a, n * sizeof(Limb));
+    memset(t0, 0, n * sizeof(Limb));
+    memset(t1, 0, n * sizeof(Limb));
+    t1[0] = 1;
+
+    while ((len1 = LimbsLen(r1, n)) > 0)
+    {
+        len0 = LimbsLen(r0, n);
+        memset(rem, 0, n * sizeof(Limb));
+        LimbsDivMod(r0, len0, r1, len1, q, rem);  // r0 = q * r1 + rem
+
+        LimbsMul(t, q, len0 - len1 + 1, t1, n);
+        LimbsAdd(t, t, t0, n);                    // t = t0 + q * t1
+
+        memcpy(t0, t1, n * sizeof(Limb));
+        memcpy(t1, t, n * sizeof(Limb));
+        memcpy(r0, r1, n * sizeof(Limb));
+        memcpy(r1, rem, n * sizeof(Limb));
+        sign ^= 1;
+    }
+
+    // r0 = gcd(a, m) 必须为 1
+    if (LimbsLen(r0, n) != 1 || r0[0] != 1)
+        return 0;
+
+    // 奇数步后系数为 t0，偶数步后为 -t0
+    if (sign)
+        memcpy(r, t0, n * sizeof(Limb));
+    else
+        LimbsSub(r, m, t0, n);
+
+    return 1;
+}
+
+// 初始化奇数模 n 的 Montgomery 形式，R = 2^(64 * len)
+// n 不是大于 1 的奇数时返回 0
+int MontInit(Mont* mt, BigInt* n)
+{
+    int i, len;
+    Limb c, inv;
+
+    if (n->bit[SIGN_BIT] == NEGATIVE || n->bit[0] == 0 || GetTrueValueLen(n) == 1)
+        return 0;
+
+    len = mt->len = BigIntToLimbs(n, mt->n);
+
+    // 牛顿迭代，每一步使 n^-1 mod 2^64 的正确位数加倍
+    for (inv = mt->n[0], i = 0; i < 5; i++)
+        inv *= 2 - mt->n[0] * inv;
+    mt->nInv = -inv;
+
+    // R^2 mod n，从 1 开始加倍 2 * 64 * len 次
+    // 中途顺便得到 one = R mod n
+    memset(mt->rr, 0, sizeof(mt->rr));
+    mt->rr[0] = 1;
+
+    for (i = 0; i < 2 * LIMB_BITS * len; i++)
+    {
+        c = LimbsAdd(mt->rr, mt->rr, mt->rr, len);  // rr = rr * 2
+
+        if (c || LimbsCompare(mt->rr, mt->n, len) >= 0)
+            LimbsSub(mt->rr, mt->rr, mt->n, len);   // rr = rr - n
+
+        if (i == LIMB_BITS * len - 1)
+            memcpy(mt->one, mt->rr, sizeof(mt->one));
+    }
+
+    return 1;
+}
+
+// 用Montgomery乘法(CIOS)计算 r = a * b / R mod n, n个字
+// 每步不计算 t = t / 2^64 而是把窗口t + i上移一个字
+// adx: 1表示使用汇编代码
+static INLINE void MontMulN(Mont* mt, Limb* a, Limb* b, Limb* r, int n, int adx)
+{
+    int i;
+    Limb m, c, s;
+    Limb t[2 * MAX_LIMBS + 1];
+
+    t[n] = Mul1(t, b, n, a[0], adx);  // t = a[0] * b
+    memset(t + n + 1, 0, n * sizeof(Limb));
+
+    for (i = 0; i < n; i++)
+    {
+        if (i > 0)
+        {
+            c = AddMul1(t + i, b, n, a[i], adx);  // t = t + a[i] * b
+            s = t[i + n] + c;
+            t[i + n + 1] += s < c;
+            t[i + n] = s;
+        }
+
+        m = t[i] * mt->nInv;                      // t + m * n = 0 (mod 2^64)
+        c = AddMul1(t + i, mt->n, n, m, adx);     // t = t + m * n
+        s = t[i + n] + c;
+        t[i + n + 1] += s < c;
+        t[i + n] = s;
+    }
+
+    // 此时 t / R = t + n < 2n
+    if (t[2 * n] || LimbsCompare(t + n, mt->n, n) >= 0)
+        LimbsSub(r, t + n, mt->n, n);
+    else
+        memcpy(r, t + n, n * sizeof(Limb));
+}
+
+// 用Montgomery乘法计算 r = a * b / R mod n
+// a 和 b 必须小于 n，r 可以和 a 或 b 相同
+// 512, 1024和2048位的模数有固定字数的单独版本
+void MontMul(Mont* mt, Limb* a, Limb* b, Limb* r)
+{
+    if (!useAsm || !CpuHasAdx())
+    {
+        MontMulN(mt, a, b, r, mt->len, 0);
+        return;
+    }
+
+    switch (mt->len)
+    {
+    case 8:
+        MontMulN(mt, a, b, r, 8, 1);
+        break;
+    case 16:
+        MontMulN(mt, a, b, r, 16, 1);
+        break;
+    case 32:
+        MontMulN(mt, a, b, r, 32, 1);
+        break;
+    default:
+        MontMulN(mt, a, b, r, mt->len, 1);
+    }
+}
+
+// 用 Montgomery 乘法计算 r = a^e mod n，a 必须小于 n
+// e 有 eLen 个字，从最高位开始二进制求幂
+void MontPow(Mont* mt, Limb* a, Limb* e, int eLen, Limb* r)
+{
+    int i;
+    Limb x[MAX_LIMBS], t[MAX_LIMBS];
+    Limb one[MAX_LIMBS] = {1};
+
+    MontMul(mt, a, mt->rr, x);                     // x = a * R mod n
+    memcpy(t, mt->one, mt->len * sizeof(Limb));    // t = R mod n
+
+    for (i = eLen * LIMB_BITS - 1; i >= 0; i--)
+    {
+        MontMul(mt, t, t, t);  // t = t * t
+
+        if (e[i / LIMB_BITS] >> (i % LIMB_BITS) & 1)
+            MontMul(mt, t, x, t);  // t = t * x
+    }
+
+    MontMul(mt, t, one, r);  // r = t / R mod n
+}
+
+// 预计算奇模数n > 1的Miller-Rabin轮: 它的Montgomery形式，n - 1 = 2^s * t,
+// Montgomery形式的-1，以及从最高位起按滑动窗口重编码的t
+// 这样每轮只需计算其证据的表，不用扫描t的位
+// n 不是大于 1 的奇数时返回 0
+int MrModulusInit(MrModulus* mm, BigInt* n)
+{
+    int i, j, len, bits, sq;
+    Limb* t = mm->t;
+
+    if (!MontInit(&mm->mt, n))
+        return 0;
+
+    len = mm->mt.len;
+    memcpy(t, mm->mt.n, sizeof(mm->t));
+    t[0]--;  // t = n - 1, n为奇数，所以没有借位
+
+    // n - 1 = 2^s * t
+    for (mm->s = 0; (t[mm->s / LIMB_BITS] >> (mm->s % LIMB_BITS) & 1) == 0; mm->s++);
+
+    for (i = 0; i < len; i++)
+    {
+        j = i + mm->s / LIMB_BITS;
+        t[i] = j < len ? t[j] >> (mm->s % LIMB_BITS) : 0;
+        if (mm->s % LIMB_BITS && j + 1 < len)
+            t[i] |= t[j + 1] << (LIMB_BITS - mm->s % LIMB_BITS);
+    }
+
+    LimbsSub(mm->minusOne, mm->mt.n, mm->mt.one, len);  // -R mod n = n - R mod n
+
+    for (bits = len * LIMB_BITS; (t[(bits - 1) / LIMB_BITS] >> ((bits - 1) % LIMB_BITS) & 1) == 0; bits--);
+    mm->tLen = (bits + LIMB_BITS - 1) / LIMB_BITS;
+
+    // 窗口越大省下的乘法越多，但表也越大
+    mm->window = bits <= 128 ? 3 : bits <= 512 ? 4 : bits <= 1536 ? 5 : MR_MAX_WINDOW;
+    mm->stepNum = 0;
+
+    for (sq = 0, i = bits - 1; i >= 0; )
+    {
+        if ((t[i / LIMB_BITS] >> (i % LIMB_BITS) & 1) == 0)
+        {
+            sq++;
+            i--;
+            continue;
+        }
+
+        // 窗口i..j结束于1位，所以其值为奇数
+        for (j = i - mm->window + 1 < 0 ? 0 : i - mm->window + 1; (t[j / LIMB_BITS] >> (j % LIMB_BITS) & 1) == 0; j++);
+
+        mm->square[mm->stepNum] = (unsigned short)(sq + i - j + 1);
+        mm->digit[mm->stepNum] = 0;
+        for (; i >= j; i--)
+            mm->digit[mm->stepNum] = (unsigned char)(mm->digit[mm->stepNum] << 1 | (t[i / LIMB_BITS] >> (i % LIMB_BITS) & 1));
+
+        mm->stepNum++;
+        sq = 0;
+    }
+
+    mm->tail = sq;
+
+    return 1;
+}
+
+// 按MrModulusInit的窗口求Montgomery形式的r = x^t, x为Montgomery形式
+// 先求x, x^3, x^5, ...，然后每个窗口是若干次平方和一次乘法
+void MontPowWindow(MrModulus* mm, Limb* x, Limb* r)
+{
+    int i, k, len = mm->mt.len;
+    Limb x2[MAX_LIMBS];
+    Limb table[1 << (MR_MAX_WINDOW - 1)][MAX_LIMBS];
+
+    memcpy(table[0], x, len * sizeof(Limb));
+    MontMul(&mm->mt, x, x, x2);  // x2 = x * x
+
+    for (k = 1; k < 1 << (mm->window - 1); k++)
+        MontMul(&mm->mt, table[k - 1], x2, table[k]);  // table[k] = x^(2k+1)
+
+    memcpy(r, table[mm->digit[0] >> 1], len * sizeof(Limb));
+
+    for (i = 1; i < mm->stepNum; i++)
+    {
+        for (k = 0; k < mm->square[i]; k++)
+            MontMul(&mm->mt, r, r, r);  // r = r * r
+
+        MontMul(&mm->mt, r, table[mm->digit[i] >> 1], r);  // r = r * x^digit
+    }
+
+    for (k = 0; k < mm->tail; k++)
+        MontMul(&mm->mt, r, r, r);
+}
+
+// 模幂运算(Montgomery 乘法实现)
+// c 必须是正奇数，a 和 b 必须非负，a < c
+BigInt* DoMontPowMod(BigInt* a, BigInt* b, Mont* mt, BigInt* result)
+{
+    int eLen;
+    Limb x[MAX_LIMBS], e[MAX_LIMBS], r[MAX_LIMBS];
+
+    BigIntToLimbs(a, x);
+    eLen = BigIntToLimbs(b, e);
+    MontPow(mt, x, e, eLen, r);
+
+    return LimbsToBigInt(r, mt->len, result);
+}
+
+// 以 2 为底的 Fermat 测试，n 必须是大于 2 的奇数
+// n 是合数返回 0，n 可能是素数返回 1
+// 它比一轮 Miller-Rabin 测试便宜得多，因此用来做过滤
+int DoFermatTest(BigInt* n)
+{
+    int i, eLen;
+    Mont mt;
+    Limb x[MAX_LIMBS] = {2}, e[MAX_LIMBS], r[MAX_LIMBS];
+
+    MontInit(&mt, n);
+    eLen = BigIntToLimbs(n, e);
+    e[0]--;  // e = n - 1，n 是奇数，所以没有借位
+
+    MontPow(&mt, x, e, eLen, r);
+
+    for (i = 1; i < mt.len && r[i] == 0; i++);
+
+    return r[0] == 1 && i == mt.len;  // r = 1
+}
+
+// 检查 CPU 和操作系统是否支持 AVX2
+int CpuHasAvx2()
+{
+#if defined(USE_AVX2) && defined(__GNUC__)
+    static THREAD_LOCAL int has = -1;
+
+    if (has < 0)
+    {
+        __builtin_cpu_init();
+        has = __builtin_cpu_supports("avx2") != 0;
+    }
+
+    return has;
+#elif defined(USE_AVX2)
+    static THREAD_LOCAL int has = -1;
+    int info[4];
+
+    if (has < 0)
+    {
+        __cpuid(info, 1);
+        has = (info[2] >> 27 & 1) && (_xgetbv(0) & 6) == 6;  // OSXSAVE，XMM 和 YMM 状态
+
+        __cpuidex(info, 7, 0);
+        has = has && (info[1] >> 5 & 1);
+    }
+
+    return has;
+#else
+    return 0;
+#endif
+}
+
+#ifdef USE_AVX2
+// 把 4 个数的 64 位字转为 4 个通道中的 32 位字
+TARGET_AVX2 static void LimbsToLanes(Limb** x, int len, __m256i* v)
+{
+    int j, k;
+    long long w[4];
+
+    for (j = 0; j < 2 * len; j++)
+    {
+        for (k = 0; k < 4; k++)
+            w[k] = (long long)(x[k][j / 2] >> (j % 2 * 32) & 0xffffffff);
+
+        v[j] = _mm256_set_epi64x(w[3], w[2], w[1], w[0]);
+    }
+}
+
+// 把 4 个通道中的 32 位字转为 4 个数的 64 位字
+TARGET_AVX2 static void LanesToLimbs(__m256i* v, int len, Limb** x)
+{
+    int j, k;
+    Limb w[4];
+
+    for (j = 0; j < len; j++)
+    {
+        for (k = 0; k < 4; k++)
+            x[k][j] = 0;
+    }
+
+    for (j = 0; j < 2 * len; j++)
+    {
+        _mm256_storeu_si256((__m256i*)w, v[j]);
+
+        for (k = 0; k < 4; k++)
+            x[k][j / 2] |= w[k] << (j % 2 * 32);
+    }
+}
+
+// 用 Montgomery 乘法 (FIOS) 计算每个通道的 r = a * b / R mod n
+// 字是 32 位的，所以 32 x 32 位的积加上两个字不会超出一个通道
+// r 可以和 a 或 b 相同
+TARGET_AVX2 static void MontMul4(Mont4* mt, __m256i* a, __m256i* b, __m256i* r)
+{
+    int i, j, n = mt->len;
+    __m256i s, c, h, m, sel;
+    __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    __m256i t[2 * MAX_LIMBS + 1], d[2 * MAX_LIMBS];
+
+    for (j = 0; j < n + 1; j++)
+        t[j] = _mm256_setzero_si256();
+
+    for (i = 0; i < n; i++)
+    {
+        // t = (t + a[i] * b + m * n) / 2^32 in one pass, t + a[i] * b + m * n = 0 (mod 2^32)
+        // c 是 t + a[i] * b 的进位，h 是 + m * n 的进位
+        s = _mm256_add_epi64(t[0], _mm256_mul_epu32(a[i], b[0]));
+        c = _mm256_srli_epi64(s, 32);
+        s = _mm256_and_si256(s, mask);
+        m = _mm256_and_si256(_mm256_mul_epu32(s, mt->nInv), mask);
+        h = _mm256_srli_epi64(_mm256_add_epi64(s, _mm256_mul_epu32(m, mt->n[0])), 32);
+
+        for (j = 1; j < n; j++)
+        {
+            s = _mm256_add_epi64(_mm256_add_epi64(t[j], c), _mm256_mul_epu32(a[i], b[j]));
+            c = _mm256_srli_epi64(s, 32);
+            s = _mm256_add_epi64(_mm256_add_epi64(_mm256_and_si256(s, mask), h), _mm256_mul_epu32(m, mt->n[j]));
+            t[j - 1] = _mm256_and_si256(s, mask);
+            h = _mm256_srli_epi64(s, 32);
+        }
+
+        s = _mm256_add_epi64(_mm256_add_epi64(t[n], c), h);
+        t[n - 1] = _mm256_and_si256(s, mask);
+        t[n] = _mm256_srli_epi64(s, 32);
+    }
+
+    // 此时 t < 2n，d = t - n，c 是借位
+    c = _mm256_setzero_si256();
+    for (j = 0; j < n; j++)
+    {
+        s = _mm256_sub_epi64(_mm256_sub_epi64(t[j], mt->n[j]), c);
+        d[j] = _mm256_and_si256(s, mask);
+        c = _mm256_srli_epi64(s, 63);
+    }
+
+    // t >= n if t[n] >= c
+    sel = _mm256_cmpgt_epi64(_mm256_add_epi64(t[n], _mm256_set1_epi64x(1)), c);
+    for (j = 0; j < n; j++)
+        r[j] = _mm256_blendv_epi8(t[j], d[j], sel);
+}
+
+// 在 AVX2 通道中对字数相同的 4 个模计算 r[k] = a[k]^e[k] mod n[k]
+// 4 位固定窗口，所有通道一起平方，
+// 然后每个通道乘以各自的表项
+TARGET_AVX2 static void MontPow4(Mont** mt, Limb** a, Limb** e, int* eLen, Limb** r)
+{
+    int i, j, k, w, len, maxLen = 0, idx[4];
+    Limb nInv[4];
+    Limb* tmp[4];
+    Mont4 mt4;
+    __m256i x[2 * MAX_LIMBS], t[2 * MAX_LIMBS];
+    __m256i tbl[16][2 * MAX_LIMBS];
+
+    len = mt[0]->len;
+    mt4.len = 2 * len;
+
+    for (k = 0; k < 4; k++)
+    {
+        nInv[k] = mt[k]->nInv & 0xffffffff;  // -n^-1 mod 2^32
+        maxLen = eLen[k] > maxLen ? eLen[k] : maxLen;
+    }
+    mt4.nInv = _mm256_set_epi64x((long long)nInv[3], (long long)nInv[2], (long long)nInv[1], (long long)nInv[0]);
+
+    for (k = 0; k < 4; k++)
+        tmp[k] = mt[k]->n;
+    LimbsToLanes(tmp, len, mt4.n);
+    for (k = 0; k < 4; k++)
+        tmp[k] = mt[k]->rr;
+    LimbsToLanes(tmp, len, mt4.rr);
+    for (k = 0; k < 4; k++)
+        tmp[k] = mt[k]->one;
+    LimbsToLanes(tmp, len, mt4.one);
+    LimbsToLanes(a, len, x);
+
+    // tbl[i] = a^i * R mod n
+    memcpy(tbl[0], mt4.one, mt4.len * sizeof(__m256i));
+    MontMul4(&mt4, x, mt4.rr, tbl[1]);
+    for (i = 2; i < 16; i++)
+        MontMul4(&mt4, tbl[i - 1], tbl[1], tbl[i]);
+
+    memcpy(t, mt4.one, mt4.len * sizeof(__m256i));
+
+    for (w = maxLen * LIMB_BITS / 4 - 1; w >= 0; w--)
+    {
+        for (i = 0; i < 4; i++)
+            MontMul4(&mt4, t, t, t);  // t = t^16
+
+        for (k = 0; k < 4; k++)
+            idx[k] = w / 16 < eLen[k] ? (int)(e[k][w / 16] >> (w % 16 * 4) & 15) : 0;
+
+        // 通道 k 中 x = tbl[idx[k]]
+        for (j = 0; j < mt4.len; j++)
+        {
+            x[j] = _mm256_blend_epi32(tbl[idx[0]][j], tbl[idx[1]][j], 0x0c);
+            x[j] = _mm256_blend_epi32(x[j], tbl[idx[2]][j], 0x30);
+            x[j] = _mm256_blend_epi32(x[j], tbl[idx[3]][j], 0xc0);
+        }
+
+        MontMul4(&mt4, t, x, t);  // t = t * x
+    }
+
+    // r = t / R mod n
+    memset(x, 0, mt4.len * sizeof(__m256i));
+    x[0] = _mm256_set1_epi64x(1);
+    MontMul4(&mt4, t, x, t);
+    LanesToLimbs(t, len, r);
+}
+#endif
+
+// 若MontPowBatch在AVX2通道中运行4个len字的幂运算则返回1，此时它比逐个计算快
+// 有MULX/ADX时，超过ADX_LANES_MAX_LIMBS字标量代码一样快
+int MontLanes(int len)
+{
+#ifdef USE_AVX2
+    return useSimd && CpuHasAvx2() && len <= (useAsm && CpuHasAdx() ? ADX_LANES_MAX_LIMBS : MAX_LIMBS);
+#else
+    return 0;
+#endif
+}
+
+// 和 MontPow 一样计算 r[k] = a[k]^e[k] mod n[k], k = 0, 1, ..., count - 1
+// CPU 支持时，每 4 个字数相同的模在 AVX2 通道中运行，
+// 其他的逐个运行
+// 大模数时标量MULX/ADX代码比通道更快
+void MontPowBatch(Mont** mt, Limb** a, Limb** e, int* eLen, int count, Limb** r)
+{
+    int k = 0;
+
+#ifdef USE_AVX2
+    if (useSimd && CpuHasAvx2())
+    {
+        for (; k + 4 <= count; k += 4)
+        {
+            if (mt[k]->len == mt[k + 1]->len && mt[k]->len == mt[k + 2]->len &&
+                mt[k]->len == mt[k + 3]->len && MontLanes(mt[k]->len))
+            {
+                MontPow4(mt + k, a + k, e + k, eLen + k, r + k);
+            }
+            else
+            {
+                MontPow(mt[k], a[k], e[k], eLen[k], r[k]);
+                MontPow(mt[k + 1], a[k + 1], e[k + 1], eLen[k + 1], r[k + 1]);
+                MontPow(mt[k + 2], a[k + 2], e[k + 2], eLen[k + 2], r[k + 2]);
+                MontPow(mt[k + 3], a[k + 3], e[k + 3], eLen[k + 3], r[k + 3]);
+            }
+        }
+    }
+#endif
+
+    for (; k < count; k++)
+        MontPow(mt[k], a[k], e[k], eLen[k], r[k]);
+}
+
+// 对 count 个数求模幂，result[k] = a[k]^b[k] % c[k]
+// c[k] 必须是正奇数，a[k] 和 b[k] 必须非负
+// 它有 AVX2 通道的吞吐量，用于批量任务
+BigInt* DoPowModBatch(BigInt* a, BigInt* b, BigInt* c, int count, BigInt* result)
+{
+    int i, k, num;
+    int eLen[FERMAT_BATCH];
+    Mont mt[FERMAT_BATCH];
+    Limb x[FERMAT_BATCH][MAX_LIMBS], e[FERMAT_BATCH][MAX_LIMBS], r[FERMAT_BATCH][MAX_LIMBS];
+    Mont* pm[FERMAT_BATCH];
+    Limb *px[FERMAT_BATCH], *pe[FERMAT_BATCH], *pr[FERMAT_BATCH];
+    BigInt t;
+
+    for (i = 0; i < count; i += FERMAT_BATCH)
+    {
+        num = count - i < FERMAT_BATCH ? count - i : FERMAT_BATCH;
+
+        for (k = 0; k < num; k++)
+        {
+            MontInit(&mt[k], &c[i + k]);
+
+            if (DoCompare(&a[i + k], &c[i + k]) >= 0)
+                BigIntToLimbs(DoMod(&a[i + k], &c[i + k], &t), x[k]);  // t = a % c
+            else
+                BigIntToLimbs(&a[i + k], x[k]);
+
+            eLen[k] = BigIntToLimbs(&b[i + k], e[k]);
+            pm[k] = &mt[k];
+            px[k] = x[k];
+            pe[k] = e[k];
+            pr[k] = r[k];
+        }
+
+        MontPowBatch(pm, px, pe, eLen, num, pr);
+
+        for (k = 0; k < num; k++)
+            LimbsToBigInt(r[k], mt[k].len, &result[i + k]);
+    }
+
+    return result;
+}
+
+// 对 count 个数做以 2 为底的 Fermat 测试，它们都必须是大于 2 的奇数
+// n[k] 可能是素数时 pass[k] = 1，返回这样的数的个数
+int DoFermatTestBatch(BigInt* n, int count, char* pass)
+{
+    int i, j, k, num, passNum = 0;
+    int eLen[FERMAT_BATCH];
+    Mont mt[FERMAT_BATCH];
+    Limb x[FERMAT_BATCH][MAX_LIMBS], e[FERMAT_BATCH][MAX_LIMBS], r[FERMAT_BATCH][MAX_LIMBS];
+    Mont* pm[FERMAT_BATCH];
+    Limb *px[FERMAT_BATCH], *pe[FERMAT_BATCH], *pr[FERMAT_BATCH];
+
+    for (i = 0; i < count; i += FERMAT_BATCH)
+    {
+        num = count - i < FERMAT_BATCH ? count - i : FERMAT_BATCH;
+
+        for (k = 0; k < num; k++)
+        {
+            MontInit(&mt[k], &n[i + k]);
+            eLen[k] = BigIntToLimbs(&n[i + k], e[k]);
+            e[k][0]--;  // e = n - 1，n 是奇数，所以没有借位
+
+            memset(x[k], 0, sizeof(x[k]));
+            x[k][0] = 2;
+
+            pm[k] = &mt[k];
+            px[k] = x[k];
+            pe[k] = e[k];
+            pr[k] = r[k];
+        }
+
+        MontPowBatch(pm, px, pe, eLen, num, pr);
+
+        for (k = 0; k < num; k++)
+        {
+            for (j = 1; j < mt[k].len && r[k][j] == 0; j++);
+
+            pass[i + k] = r[k][0] == 1 && j == mt[k].len;  // r = 1
+            passNum += pass[i + k];
+        }
+    }
+
+    return passNum;
+}
+
+// 幂运算(二进制实现) 不能求负幂
+BigInt* DoPowWs(BigInt* a, BigInt* b, BigInt* result, Workspace* ws)
+{
+    int i, len;
+    BigInt *t, *buf;
+
+    t = WsAlloc(ws);
+    buf = WsAlloc(ws);
+
+    CopyBigInt(a, buf);
+    CopyBigInt(&bigOne, t);
+    len = GetTrueValueLen(b);  // 获取BigInt真值的位长度
+
+    for (i = 0; i < len; i++)
+    {
+        if (b->bit[i] == 1)
+            DoMulWs(t, buf, t, ws);  // t = t * buf
+
+        // 这里最后多做了一次
+        if (i + 1 < len)
+            DoMulWs(buf, buf, buf, ws);  // buf = buf * buf
+    }
+
+    CopyBigInt(t, result);
+    WsFree(ws, 2);
+
+    return result;
+}
+
+BigInt* DoPow(BigInt* a, BigInt* b, BigInt* result)
+{
+    return DoPowWs(a, b, result, GetThreadWorkspace());
+}
+
+char* Pow(char* s1, char* s2, char* result)
+{
+    BigInt a, b, c;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    DoPow(&a, &b, &c);
+
+    return ResultToStr(&c, result);
+}
+
+// 模幂运算(二进制实现)
+// 临时变量从ws中取 result可以是a, b或c
+BigInt* DoPowModWs(BigInt* a, BigInt* b, BigInt* c, BigInt* result, Workspace* ws)
+{
+    int i, len;
+    BigInt *t, *buf;
+    Mont mt;
+
+    GetContext()->powMod++;
+    t = WsAlloc(ws);
+    buf = WsAlloc(ws);
+    CopyBigInt(a, buf);
+
+    // 模是奇数时，用基于字的 Montgomery 乘法
+    if (a->bit[SIGN_BIT] == POSITIVE && b->bit[SIGN_BIT] == POSITIVE && MontInit(&mt, c))
+    {
+        if (DoCompare(a, c) >= 0)
+            DoModWs(a, c, buf, ws);  // buf = a % c
+
+        DoMontPowMod(buf, b, &mt, t);
+    }
+    else
+    {
+        CopyBigInt(&bigOne, t);
+        len = GetTrueValueLen(b);  // 获取BigInt真值的位长度
+
+        for (i = 0; i < len; i++)
+        {
+            if (b->bit[i] == 1)
+                DoMulModWs(t, buf, c, t, ws);  // t = t * buf % c
+
+            // 这里最后多做了一次
+            if (i + 1 < len)
+                DoMulModWs(buf, buf, c, buf, ws);  // buf = buf * buf % c
+        }
+    }
+
+    CopyBigInt(t, result);
+    WsFree(ws, 2);
+
+    return result;
+}
+
+BigInt* DoPowMod(BigInt* a, BigInt* b, BigInt* c, BigInt* result)
+{
+    return DoPowModWs(a, b, c, result, GetThreadWorkspace());
+}
+
+// 在上下文 ctx 中运行 DoPowMod，临时变量从它的工作区中取
+BigInt* DoPowModCtx(BigInt* a, BigInt* b, BigInt* c, BigInt* result, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+
+    DoPowModWs(a, b, c, result, &ctx->ws);
+    UseContext(old);
+
+    return result;
+}
+
+char* PowMod(char* s1, char* s2, char* s3, char* result)
+{
+    BigInt a, b, c, d;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    StrToBigInt(s3, &c);
+    DoPowMod(&a, &b, &c, &d);
+
+    return ResultToStr(&d, result);
+}
+
+// splitmix64，用于把种子扩展为生成器的状态
+unsigned long long SplitMix64(unsigned long long* x)
+{
+    unsigned long long z = (*x += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+    return z ^ (z >> 31);
+}
+
+// 从操作系统读取 len 字节的熵
+// Windows 上用 BCryptGenRandom，Linux 上用 getrandom，没有 getrandom 时用 /dev/urandom
+// 无法取得时返回 0，此时不能生成密钥
+int GetSecureEntropy(unsigned char* buf, int len)
+{
+#ifdef _WIN32
+    return BCryptGenRandom(NULL, buf, (ULONG)len, BCRYPT_USE_SYSTEM_PREFERRED_RNG) >= 0;
+#else
+    int i = 0;
+    FILE* fp;
+#ifdef __linux__
+    long n;
+
+    while (i < len)
+    {
+        n = getrandom(buf + i, len - i, 0);
+        if (n > 0)
+            i += (int)n;
+        else if (n == 0 || errno != EINTR)
+            break;
+    }
+
+    if (i == len)
+        return 1;
+#endif
+
+    fp = fopen("/dev/urandom", "rb");
+    if (fp == NULL)
+        return 0;
+
+    i = (int)fread(buf, 1, len, fp);
+    fclose(fp);
+
+    return i == len;
+#endif
+}
+
+// 读取 len 字节的熵作为 xoshiro256** 的种子，不能用于密钥
+// 操作系统给不出时，混合时间、时钟和地址作为较弱的后备
+void GetEntropy(unsigned char* buf, int len)
+{
+    int i;
+    unsigned long long x;
+
+    if (GetSecureEntropy(buf, len))
+        return;
+
+    x = (unsigned long long)time(0) ^ ((unsigned long long)clock() << 32);
+    x ^= (unsigned long long)(size_t)buf;
+
+    for (i = 0; i < len; i++)
+        buf[i] = (unsigned char)SplitMix64(&x);
+}
+
+// 设置 xoshiro256** 生成器的种子，相同的种子得到相同的序列
+Rng* DoSeedRand(Rng* rng, unsigned long long seed)
+{
+    int i;
+
+    rng->secure = 0;
+    for (i = 0; i < 4; i++)
+        rng->s[i] = SplitMix64(&seed);
+
+    return rng;
+}
+
+// ChaCha20 块函数，out = ChaCha20(in)
+void ChaChaBlock(unsigned int* in, unsigned int* out)
+{
+    int i;
+    unsigned int x[16];
+
+    for (i = 0; i < 16; i++)
+        x[i] = in[i];
+
+    for (i = 0; i < 10; i++)  // 20 轮，每次一个列轮和一个对角轮
+    {
+        CHACHA_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        CHACHA_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        CHACHA_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        CHACHA_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        CHACHA_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        CHACHA_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        CHACHA_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        CHACHA_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    for (i = 0; i < 16; i++)
+        out[i] = x[i] + in[i];
+}
+
+// 用操作系统提供的密钥初始化 ChaCha20 生成器
+// 它是密码学安全的随机数生成器，用于生成密钥
+// 操作系统给不出熵时返回 NULL 并设置 ERROR_ENTROPY，此时 rng 不变
+Rng* DoSeedSecureRand(Rng* rng)
+{
+    unsigned char key[32];
+    int i;
+
+    if (!GetSecureEntropy(key, 32))
+    {
+        SetError(ERROR_ENTROPY);
+        return NULL;
+    }
+
+    rng->secure = 1;
+    rng->key[0] = 0x61707865;  // "expand 32-byte k"
+    rng->key[1] = 0x3320646e;
+    rng->key[2] = 0x79622d32;
+    rng->key[3] = 0x6b206574;
+
+    for (i = 0; i < 8; i++)
+    {
+        rng->key[4 + i] = key[4 * i] | key[4 * i + 1] << 8 |
+            key[4 * i + 2] << 16 | (unsigned int)key[4 * i + 3] << 24;
+    }
+
+    for (i = 12; i < 16; i++)  // 块计数器和 nonce
+        rng->key[i] = 0;
+
+    rng->pos = 16;  // 还没有生成任何块
+
+    return rng;
+}
+
+// 获取一个 64 位的随机字
+unsigned long long DoRandWord(Rng* rng)
+{
+    unsigned long long r, t;
+    unsigned long long* s = rng->s;
+
+    if (rng->secure)
+    {
+        if (rng->pos >= 16)
+        {
+            ChaChaBlock(rng->key, rng->block);
+            if (++rng->key[12] == 0)  // 64 位的块计数器
+                rng->key[13]++;
+            rng->pos = 0;
+        }
+
+        r = rng->block[rng->pos++];
+        return r | (unsigned long long)rng->block[rng->pos++] << 32;
+    }
+
+    // xoshiro256**
+    r = ROTL64(s[1] * 5, 7) * 9;
+    t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = ROTL64(s[3], 45);
+
+    return r;
+}
+
+// 获取当前线程的随机数生成器
+// 第一次调用时从操作系统获取种子
+Rng* GetThreadRng()
+{
+    unsigned long long seed;
+    Context* ctx = GetContext();
+
+    if (!ctx->rngReady)
+    {
+        GetEntropy((unsigned char*)&seed, sizeof(seed));
+        DoSeedRand(&ctx->rng, seed);
+        ctx->rngReady = 1;
+    }
+
+    return &ctx->rng;
+}
+
+// 当前线程使用指定的种子，便于重复基准测试
+void SeedRand(unsigned long long seed)
+{
+    Context* ctx = GetContext();
+
+    DoSeedRand(&ctx->rng, seed);
+    ctx->rngReady = 1;
+}
+
+// 当前线程使用 ChaCha20 安全随机数生成器，用于生成密钥
+// 操作系统给不出熵时返回 0 并设置 ERROR_ENTROPY，此时生成器不变
+int SeedSecureRand()
+{
+    Context* ctx = GetContext();
+
+    if (DoSeedSecureRand(&ctx->rng) == NULL)
+        return 0;
+    ctx->rngReady = 1;
+
+    return 1;
+}
+
+// 获取 {0, 1, ..., 2^bitLen - 1} 中的随机 BigInt
+// 每次填充一整个 64 位的字
+BigInt* DoGetRandBits(int bitLen, BigInt* result)
+{
+    int i, j;
+    unsigned long long w;
+    Rng* rng = GetThreadRng();
+
+    memset(result->bit, 0, BIG_INT_BIT_LEN);
+
+    for (i = 0; i < bitLen; i += 64)
+    {
+        w = DoRandWord(rng);
+        for (j = i; j < bitLen && j < i + 64; j++, w >>= 1)
+            result->bit[j] = (char)(w & 1);
+    }
+
+    return result;
+}
+
+// 获取指定位数的奇数BigInt
+BigInt* DoGetOddRandBigInt(int bitLen, BigInt* result)
+{
+    DoGetRandBits(bitLen, result);
+
+    result->bit[0] = 1;           // 奇数
+    result->bit[bitLen - 1] = 1;  // 恰好 bitLen 位
+
+    return result;
+}
+
+char* GetOddRandBigInt(int bitLen, char* result)
+{
+    BigInt a;
+
+    DoGetOddRandBigInt(bitLen, &a);
+
+    return BigIntToStr(&a, result);
+}
+
+// 用拒绝采样获取 {0, 1, ..., m-1} 中的随机 BigInt
+// 取与 m 位数相同的随机位，不小于 m 时重取
+// 平均不到 2 次，并且不需要除法
+BigInt* DoGetRandBelow(BigInt* m, BigInt* result)
+{
+    int len;
+
+    if (m->bit[SIGN_BIT] == NEGATIVE || IsZero(m))
+    {
+        memset(result->bit, 0, BIG_INT_BIT_LEN);
+        return result;
+    }
+
+    len = GetTrueValueLen(m);
+
+    do
+    {
+        DoGetRandBits(len, result);
+    } while (DoCompare(result, m) >= 0);
+
+    return result;
+}
+
+// 随机获取小于n的正整数
+BigInt* DoGetRand(BigInt* n, BigInt* result)
+{
+    BigInt t;
+
+    DoSub(n, &bigOne, &t);      // t = n - 1
+    DoGetRandBelow(&t, result); // result 为 {0, 1, ..., n-2} 中的随机数
+
+    return DoAdd(result, &bigOne, result);
+}
+
+char* GetRand(char* s, char* result)
+{
+    BigInt a, b;
+
+    StrToBigInt(s, &a);
+    DoGetRand(&a, &b);
+
+    return BigIntToStr(&b, result);
+}
+
+// 用OpenPrimeBitmap的轮位图判断，n是素数返回1, n必须小于2^32
+// 第n / 30字节对每个与30互素的余数有一位，所以只读一个缓存行
+INLINE int PrimeBitmapLookup(unsigned long long n)
+{
+    if (n < 6)
+        return n == 2 || n == 3 || n == 5;
+
+    return (primeBitmap[n / 30] & wheelBit[n % 30]) != 0;
+}
+
+// 解除素数位图文件的映射
+void ClosePrimeBitmap()
+{
+    if (primeBitmap == NULL)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(primeBitmap - PRIME_BITMAP_HEADER);
+#else
+    munmap(primeBitmap - PRIME_BITMAP_HEADER, PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES);
+#endif
+    primeBitmap = NULL;
+}
+
+// 只读映射GenPrimeBitmap的素数位图文件，所有进程共享这些页
+// 之后小于2^32的数由位图回答，不需要测试
+// 文件无法打开或不是素数位图时返回0
+int OpenPrimeBitmap(char* path)
+{
+    unsigned char* p;
+#ifdef _WIN32
+    HANDLE file, map;
+
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return 0;
+
+    if (GetFileSize(file, NULL) != PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES)
+    {
+        CloseHandle(file);
+        return 0;
+    }
+
+    map = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (map == NULL)
+        return 0;
+
+    p = (unsigned char*)MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(map);
+    if (p == NULL)
+        return 0;
+
+    if (*(unsigned int*)p != PRIME_BITMAP_MAGIC || *(unsigned int*)(p + 4) != PRIME_BITMAP_BYTES)
+    {
+        UnmapViewOfFile(p);
+        return 0;
+    }
+#else
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+        return 0;
+
+    if (lseek(fd, 0, SEEK_END) != PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES)
+    {
+        close(fd);
+        return 0;
+    }
+
+    p = (unsigned char*)mmap(NULL, PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+        return 0;
+
+    if (*(unsigned int*)p != PRIME_BITMAP_MAGIC || *(unsigned int*)(p + 4) != PRIME_BITMAP_BYTES)
+    {
+        munmap(p, PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES);
+        return 0;
+    }
+#endif
+
+    ClosePrimeBitmap();
+    primeBitmap = p + PRIME_BITMAP_HEADER;
+
+    return 1;
+}
+
+// bitLen位的数的试除上界
+// 一个合数花费一轮Miller-Rabin，约bitLen^2.6，素数p排除其中的1/p,
+// 而它分摊的bitLen / 64个字的除法约为bitLen，所以上界按bitLen^2增长
+unsigned long TrialBound(int bitLen)
+{
+    unsigned long bound = (unsigned long)bitLen * bitLen / 16;
+
+    if (bound < 64)
+        return 64;
+
+    return bound < SMALL_PRIME_BOUND ? bound : SMALL_PRIME_BOUND;
+}
+
+// 用小于bound的奇素数试除len个字的n
+// n对一组的积取模一次，然后对组内每个素数p测试余数r,
+// p | r 当且仅当 r * p^-1 mod 2^64 <= (2^64 - 1) / p，即Granlund-Montgomery方法，不用除法
+// n有小因子返回0，由此确定n是素数返回1，未知返回-1
+int LimbsTrialDivision(Limb* n, int len, unsigned long bound)
+{
+    int g, k;
+    Limb r, p = 3;
+
+    for (; len > 0 && n[len - 1] == 0; len--);
+
+    if (len == 0 || (len == 1 && n[0] < 2))
+        return 0;
+
+    if ((n[0] & 1) == 0)
+        return len == 1 && n[0] == 2;
+
+    for (g = 0; g < TRIAL_GROUP_NUM && smallPrime[trialFirst[g]] < bound; g++)
+    {
+        for (r = 0, k = len - 1; k >= 0; k--)
+            DivLimb(r, n[k], trialProduct[g], &r);  // r = n % product
+
+        for (k = trialFirst[g]; k < trialFirst[g + 1]; k++)
+        {
+            p = smallPrime[k];
+            if (r * trialInv[k] <= trialLim[k])
+                return len == 1 && n[0] == p;
+        }
+
+        p = k < SMALL_PRIME_NUM ? smallPrime[k] : SMALL_PRIME_BOUND;
+    }
+
+    // 没有小于p的因子
+    return len == 1 && n[0] / p < p ? 1 : -1;
+}
+
+// Miller-Rabin测试之前试除n，上界按位长选择
+// n有小因子返回0，由此确定n是素数返回1，未知返回-1
+int DoTrialDivision(BigInt* n)
+{
+    int len;
+    Limb x[MAX_LIMBS];
+
+    if (n->bit[SIGN_BIT] == NEGATIVE)
+        return -1;
+
+    len = BigIntToLimbs(n, x);
+
+    return LimbsTrialDivision(x, len, TrialBound(GetTrueValueLen(n)));
+}
+
+// 单调时钟的毫秒数，用于截止时间
+long long NowMs()
+{
+#ifdef _WIN32
+    return (long long)GetTickCount64();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+}
+
+// 本线程的搜索任务被取消或超时返回 1，线程没有任务返回 0
+// 在候选数之间和 Miller-Rabin 各轮之间检查
+int TaskStopped()
+{
+    GenPrimeTask* task = threadTask;
+
+    if (task == NULL)
+        return 0;
+
+    return task->cancel || (task->deadline && NowMs() >= task->deadline);
+}
+
+// 向本线程的搜索任务报告又测试了 count 个候选数
+void TaskProgress(int count)
+{
+    GenPrimeTask* task = threadTask;
+
+    if (task == NULL)
+        return;
+
+    task->tested += count;
+    if (task->progress != NULL)
+        task->progress(task->tested, task->arg);
+}
+
+// 获取 {2, 3, ..., n-2} 中的随机数作为 Miller-Rabin 测试的底数
+// 1 和 n-1 总能通过测试，所以没有用
+BigInt* DoGetWitness(BigInt* n, BigInt* result)
+{
+    BigInt t;
+
+    DoSub(n, &bigThree, &t);  // t = n - 3
+
+    // n <= 3 时 {2, ..., n-2} 为空
+    if (t.bit[SIGN_BIT] == NEGATIVE || IsZero(&t))
+        return DoGetRand(n, result);
+
+    DoGetRandBelow(&t, result);  // result 为 {0, 1, ..., n-4} 中的随机数
+
+    return DoAdd(result, &bigTwo, result);
+}
+
+int DoMillerRabin(BigInt* n, int times)
+{
+    int i, j, k, s, num;
+    unsigned long long v;
+    int tLen[FERMAT_BATCH];
+    Limb w[FERMAT_BATCH][MAX_LIMBS], r[FERMAT_BATCH][MAX_LIMBS];
+    Mont* pm[FERMAT_BATCH];
+    Limb *pw[FERMAT_BATCH], *pt[FERMAT_BATCH], *pr[FERMAT_BATCH];
+    BigInt a, t, x;
+    BigInt nMinusOne;
+    MrModulus mm;
+
+    // 小于2^32的数在素数位图中
+    if (primeBitmap != NULL && n->bit[SIGN_BIT] == POSITIVE && GetTrueValueLen(n) <= 32)
+    {
+        for (v = 0, i = 31; i >= 0; i--)
+            v = v << 1 | n->bit[i];
+
+        return PrimeBitmapLookup(v);
+    }
+
+    // 奇数n > 7: Montgomery形式，t及其窗口只为所有轮计算一次，
+    // 每轮都在字上保持Montgomery形式
+    if (GetTrueValueLen(n) > 3 && MrModulusInit(&mm, n))
+    {
+        for (k = 0; k < FERMAT_BATCH; k++)
+        {
+            pm[k] = &mm.mt;
+            pw[k] = w[k];
+            pt[k] = mm.t;
+            pr[k] = r[k];
+            tLen[k] = mm.tLen;
+        }
+
+        for (i = 0; i < times; i += num)
+        {
+            if (TaskStopped())
+                return 0;
+
+            // 第一轮单独运行，因为大多数合数在这一轮失败，
+            // 之后若AVX2通道更快则每4轮一起运行
+            num = i > 0 && times - i >= FERMAT_BATCH && MontLanes(mm.mt.len) ? FERMAT_BATCH : 1;
+            GetContext()->mrRound += num;
+
+            for (k = 0; k < num; k++)
+            {
+                DoGetWitness(n, &x);  // 获取 {2, 3, ..., n-2} 中的随机数
+                BigIntToLimbs(&x, w[k]);
+            }
+
+            if (num > 1)
+            {
+                MontPowBatch(pm, pw, pt, tLen, num, pr);  // r = x^t mod n
+                for (k = 0; k < num; k++)
+                    MontMul(&mm.mt, r[k], mm.mt.rr, r[k]);  // 转为Montgomery形式
+            }
+            else
+            {
+                MontMul(&mm.mt, w[0], mm.mt.rr, w[0]);  // w = x * R mod n
+                MontPowWindow(&mm, w[0], r[0]);         // r = x^t
+            }
+
+            for (k = 0; k < num; k++)
+            {
+                if (LimbsCompare(r[k], mm.mt.one, mm.mt.len) == 0)
+                    continue;
+
+                for (j = 0; j < mm.s && LimbsCompare(r[k], mm.minusOne, mm.mt.len) != 0; j++)
+                    MontMul(&mm.mt, r[k], r[k], r[k]);  // r = r^2
+
+                if (j == mm.s)
+                    return 0;
+            }
+        }
+
+        return 1;
+    }
+
+    DoSub(n, &bigOne, &nMinusOne);  // nMinusOne = n - 1
+
+    s = GetMaxRightShiftLen(&nMinusOne);      // 获取最大的右移长度
+    ShiftArithmeticRight(&nMinusOne, s, &t);  // 右移并保存到t中
+
+    for (i = 0; i < times; i++)    // 做times次测试
+    {
+        // 已停止的搜索把 n 当作合数，由它自己检查是否停止
+        if (TaskStopped())
+            return 0;
+
+        GetContext()->mrRound++;
+        DoGetWitness(n, &x);      // 获取 {2, 3, ..., n-2} 中的随机数
+        DoPowMod(&x, &t, n, &a);  // a = x^t % n, 这里时间用得长
+
+        if (DoCompare(&a, &bigOne) == 0)
+            continue;
+
+        for (j = 0; j < s; j++)
+        {
+            if (DoCompare(&a, &nMinusOne) == 0)
+                goto LOOP;
+
+            DoPowMod(&a, &bigTwo, n, &a);  // a = a^2 % n
+        }
+
+        /* 第二种写法
+        if (DoCompare(&a, &one) == 0 || DoCompare(&a, &nMinusOne) == 0)
+            continue;
+        for (j = 0; j < s - 1; j++)
+        {
+            DoPowMod(&a, &two, n, &a);  // a = a^2 % n
+            if (DoCompare(&a, &nMinusOne) == 0)
+                goto LOOP;
+        }
+        */
+
+        return 0;
+
+        LOOP:;
+    }
+
+    // 返回n可能是素数
+    return 1;
+}
+
+// 在上下文 ctx 中运行 DoMillerRabin，它调用的函数也从 ctx 中取状态
+int DoMillerRabinCtx(BigInt* n, int times, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+    int r = DoMillerRabin(n, times);
+
+    UseContext(old);
+
+    return r;
+}
+
+void MutexInit(Mutex* m)
+{
+#ifdef _WIN32
+    InitializeCriticalSection(m);
+#else
+    pthread_mutex_init(m, NULL);
+#endif
+}
+
+void MutexFree(Mutex* m)
+{
+#ifdef _WIN32
+    DeleteCriticalSection(m);
+#else
+    pthread_mutex_destroy(m);
+#endif
+}
+
+void MutexLock(Mutex* m)
+{
+#ifdef _WIN32
+    EnterCriticalSection(m);
+#else
+    pthread_mutex_lock(m);
+#endif
+}
+
+void MutexUnlock(Mutex* m)
+{
+#ifdef _WIN32
+    LeaveCriticalSection(m);
+#else
+    pthread_mutex_unlock(m);
+#endif
+}
+
+void CondInit(Cond* c)
+{
+#ifdef _WIN32
+    InitializeConditionVariable(c);
+#else
+    pthread_cond_init(c, NULL);
+#endif
+}
+
+void CondFree(Cond* c)
+{
+#ifdef _WIN32
+    (void)c;  // Windows的条件变量不需要释放
+#else
+    pthread_cond_destroy(c);
+#endif
+}
+
+// 解锁m并等待c，返回时m再次加锁
+void CondWait(Cond* c, Mutex* m)
+{
+#ifdef _WIN32
+    SleepConditionVariableCS(c, m, INFINITE);
+#else
+    pthread_cond_wait(c, m);
+#endif
+}
+
+// 唤醒所有等待c的线程
+void CondBroadcast(Cond* c)
+{
+#ifdef _WIN32
+    WakeAllConditionVariable(c);
+#else
+    pthread_cond_broadcast(c);
+#endif
+}
+
+// 释放结论缓存的内存，之后MillerRabin不使用缓存
+// 调用时不能有线程在MillerRabin中
+void FreeVerdictCache()
+{
+    int k;
+
+    if (verdictCacheSize == 0)
+        return;
+
+    for (k = 0; k < VERDICT_SHARDS; k++)
+    {
+        MutexFree(&verdictShard[k].lock);
+        free(verdictShard[k].entry);
+        free(verdictShard[k].bucket);
+    }
+
+    verdictCacheSize = 0;
+}
+
+// 把MillerRabin的结论最多保存size个数，为新的数丢弃最旧的
+// 缓存按哈希分成VERDICT_SHARDS片，每片有自己的锁，
+// 所以线程很少互相等待，size: 0表示不缓存
+// 调用时不能有线程在MillerRabin中
+// 没有内存时返回 0 并设置 ERROR_MEMORY，此时 MillerRabin 不用缓存
+int InitVerdictCache(int size)
+{
+    int i, k;
+    VerdictShard* vs;
+
+    FreeVerdictCache();
+
+    if (size <= 0)
+        return 1;
+
+    size = (size + VERDICT_SHARDS - 1) / VERDICT_SHARDS;
+
+    for (k = 0; k < VERDICT_SHARDS; k++)
+    {
+        vs = &verdictShard[k];
+        vs->entry = (VerdictEntry*)malloc(size * sizeof(VerdictEntry));
+        vs->bucket = (int*)malloc(size * sizeof(int));
+        if (vs->entry == NULL || vs->bucket == NULL)
+        {
+            free(vs->entry);
+            free(vs->bucket);
+            for (k--; k >= 0; k--)
+            {
+                MutexFree(&verdictShard[k].lock);
+                free(verdictShard[k].entry);
+                free(verdictShard[k].bucket);
+            }
+
+            SetError(ERROR_MEMORY);
+            return 0;
+        }
+
+        for (i = 0; i < size; i++)
+            vs->bucket[i] = -1;
+
+        vs->count = 0;
+        vs->head = vs->tail = -1;
+        MutexInit(&vs->lock);
+    }
+
+    // 所有分片都准备好后才启用缓存
+    verdictCacheSize = size;
+
+    return 1;
+}
+
+// x的len个字的哈希
+Limb HashLimbs(Limb* x, int len)
+{
+    int i;
+    Limb h = len;
+
+    for (i = 0; i < len; i++)
+    {
+        h = (h ^ x[i]) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 29;
+    }
+
+    return h;
+}
+
+// 把条目i从使用顺序链表中取出
+void VerdictUnlink(VerdictShard* vs, int i)
+{
+    VerdictEntry* e = &vs->entry[i];
+
+    if (e->prev >= 0)
+        vs->entry[e->prev].next = e->next;
+    else
+        vs->head = e->next;
+
+    if (e->next >= 0)
+        vs->entry[e->next].prev = e->prev;
+    else
+        vs->tail = e->prev;
+}
+
+// 把条目i放到链表头部，作为最新的
+void VerdictPushHead(VerdictShard* vs, int i)
+{
+    VerdictEntry* e = &vs->entry[i];
+
+    e->prev = -1;
+    e->next = vs->head;
+
+    if (vs->head >= 0)
+        vs->entry[vs->head].prev = i;
+    else
+        vs->tail = i;
+
+    vs->head = i;
+}
+
+// 查找MAX_LIMBS个字的数x的条目，不在分片中返回-1
+int VerdictFind(VerdictShard* vs, Limb* x, Limb hash)
+{
+    int i;
+
+    for (i = vs->bucket[hash % verdictCacheSize]; i >= 0; i = vs->entry[i].chain)
+    {
+        if (vs->entry[i].hash == hash && memcmp(vs->entry[i].n, x, sizeof(vs->entry[i].n)) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+// 保存x的结论，rounds: 通过的轮数，x是合数时为-1
+// 分片满时丢弃最旧的条目
+void VerdictPut(VerdictShard* vs, Limb* x, Limb hash, int rounds)
+{
+    int i, *p;
+    VerdictEntry* e;
+
+    i = VerdictFind(vs, x, hash);
+
+    if (i >= 0)
+    {
+        e = &vs->entry[i];
+        if (rounds < 0 || (e->rounds >= 0 && rounds > e->rounds))
+            e->rounds = rounds;
+
+        VerdictUnlink(vs, i);
+        VerdictPushHead(vs, i);
+        return;
+    }
+
+    if (vs->count < verdictCacheSize)
+    {
+        i = vs->count++;
+    }
+    else
+    {
+        i = vs->tail;
+        VerdictUnlink(vs, i);
+
+        // 把它从桶中取出
+        for (p = &vs->bucket[vs->entry[i].hash % verdictCacheSize]; *p != i; p = &vs->entry[*p].chain);
+        *p = vs->entry[i].chain;
+    }
+
+    e = &vs->entry[i];
+    memcpy(e->n, x, sizeof(e->n));
+    e->hash = hash;
+    e->rounds = rounds;
+    e->chain = vs->bucket[hash % verdictCacheSize];
+    vs->bucket[hash % verdictCacheSize] = i;
+    VerdictPushHead(vs, i);
+}
+
+// 使用InitVerdictCache结论缓存的Miller-Rabin测试
+// 缓存的合数立即返回，通过了r轮的数
+// 只运行剩下的times - r轮，测试时不持有锁
+int DoMillerRabinCached(BigInt* n, int times)
+{
+    int i, len, rounds = 0, prime;
+    Limb x[MAX_LIMBS], hash;
+    VerdictShard* vs;
+
+    if (verdictCacheSize == 0 || n->bit[SIGN_BIT] == NEGATIVE)
+        return DoMillerRabin(n, times);
+
+    len = BigIntToLimbs(n, x);
+    hash = HashLimbs(x, len);
+    vs = &verdictShard[(hash >> 32) % VERDICT_SHARDS];
+
+    MutexLock(&vs->lock);
+    i = VerdictFind(vs, x, hash);
+    if (i >= 0)
+    {
+        rounds = vs->entry[i].rounds;
+        VerdictUnlink(vs, i);
+        VerdictPushHead(vs, i);
+    }
+    MutexUnlock(&vs->lock);
+
+    if (rounds < 0)
+        return 0;
+
+    if (rounds >= times)
+        return 1;
+
+    // 证据是随机的，所以两次调用的轮数可以相加
+    prime = DoMillerRabin(n, times - rounds);
+
+    MutexLock(&vs->lock);
+    VerdictPut(vs, x, hash, prime ? times : -1);
+    MutexUnlock(&vs->lock);
+
+    return prime;
+}
+
+// 十进制字符串的Miller-Rabin测试，调用了InitVerdictCache时缓存结论
+// 大部分合数在任何PowMod之前就被试除排除
+int MillerRabin(char* s, int times)
+{
+    int k;
+    BigInt n;
+    char* end;
+    unsigned long long v;
+
+    // 小于2^32的数只查一次素数位图，不需要BigInt
+    if (primeBitmap != NULL && s[0] >= '0' && s[0] <= '9' && strlen(s) <= 10)
+    {
+        v = strtoull(s, &end, 10);
+        if (*end == '\0' && v < 0x100000000ULL)
+            return PrimeBitmapLookup(v);
+    }
+
+    StrToBigInt(s, &n);
+
+    if ((k = DoTrialDivision(&n)) >= 0)
+        return k;
+    
+    return DoMillerRabinCached(&n, times);
+}
+
+// 释放DoPowModFixed的梳状表，之后它运行DoPowMod
+// 调用时不能有线程在DoPowModFixed中
+void FreeCombCache()
+{
+    int i;
+
+    if (combCacheSize == 0)
+        return;
+
+    for (i = 0; i < combCacheSize; i++)
+    {
+        if (combCache[i] != NULL)
+        {
+            free(combCache[i]->table);
+            free(combCache[i]);
+        }
+    }
+
+    MutexFree(&combLock);
+    free(combCache);
+    combCache = NULL;
+    combCacheSize = 0;
+}
+
+// 保存DoPowModFixed最多size对(g, p)的梳状表，最旧的被丢弃以放入新的
+// 2048位的表约占512KB, size: 0表示无缓存
+// 调用时不能有线程在DoPowModFixed中
+// 没有内存时返回 0 并设置 ERROR_MEMORY，此时 DoPowModFixed 改用 DoPowMod
+int InitCombCache(int size)
+{
+    FreeCombCache();
+
+    if (size <= 0)
+        return 1;
+
+    combCache = (CombTable**)calloc(size, sizeof(CombTable*));
+    if (combCache == NULL)
+    {
+        SetError(ERROR_MEMORY);
+        return 0;
+    }
+
+    combTick = 0;
+    MutexInit(&combLock);
+    combCacheSize = size;
+
+    return 1;
+}
+
+// 为底数g < p构建Montgomery形式mt下的Lim-Lee梳，用于位长不超过p的指数
+// 指数被切成COMB_TEETH个a位的齿，每个齿再切成v个b位的块，
+// table[k][j]是j的各位i对应的g^(2^(i * a + k * b))之积，因此所有齿同一位置的位
+// 只需一次乘法，且各块共用平方
+// 没有内存时返回 NULL 并设置 ERROR_MEMORY
+CombTable* CombBuild(Mont* mt, Limb* g)
+{
+    int i, j, k, len = mt->len;
+    Limb x[MAX_LIMBS];
+    Limb* row;
+    CombTable* ct;
+
+    ct = (CombTable*)malloc(sizeof(CombTable));
+    if (ct == NULL)
+    {
+        SetError(ERROR_MEMORY);
+        return NULL;
+    }
+
+    ct->mt = *mt;
+    memcpy(ct->g, g, sizeof(ct->g));
+    for (ct->bits = len * LIMB_BITS; (mt->n[(ct->bits - 1) / LIMB_BITS] >> ((ct->bits - 1) % LIMB_BITS) & 1) == 0; ct->bits--);
+
+    // 一个齿是v个整块，所以a可能比bits / COMB_TEETH稍大
+    ct->a = (ct->bits + COMB_TEETH - 1) / COMB_TEETH;
+    ct->v = ct->a < COMB_MAX_BLOCKS ? ct->a : COMB_MAX_BLOCKS;
+    ct->b = (ct->a + ct->v - 1) / ct->v;
+    ct->a = ct->v * ct->b;
+    ct->refs = 1;
+    ct->used = 0;
+
+    ct->table = (Limb*)malloc(((size_t)ct->v << COMB_TEETH) * len * sizeof(Limb));
+    if (ct->table == NULL)
+    {
+        free(ct);
+        SetError(ERROR_MEMORY);
+        return NULL;
+    }
+
+    // x依次取g^(2^(i * a + k * b))，即块k中只有位i的项
+    MontMul(mt, g, mt->rr, x);  // x = g * R mod n
+
+    for (i = 0; i < COMB_TEETH; i++)
+    {
+        for (k = 0; k < ct->v; k++)
+        {
+            memcpy(&ct->table[((k << COMB_TEETH) + (1 << i)) * len], x, len * sizeof(Limb));
+
+            for (j = 0; j < ct->b; j++)
+                MontMul(mt, x, x, x);  // x = x * x
+        }
+    }
+
+    for (k = 0; k < ct->v; k++)
+    {
+        row = &ct->table[(k << COMB_TEETH) * len];
+        memcpy(row, mt->one, len * sizeof(Limb));
+
+        // table[k][j] = table[k][j去掉最低位] * table[k][其最低位]
+        for (j = 3; j < 1 << COMB_TEETH; j++)
+        {
+            if (j & (j - 1))
+                MontMul(mt, &row[(j & (j - 1)) * len], &row[(j & -j) * len], &row[j * len]);
+        }
+    }
+
+    return ct;
+}
+
+// 释放ct的一个引用，最后一个引用释放它，必须持有combLock
+void CombUnref(CombTable* ct)
+{
+    if (--ct->refs == 0)
+    {
+        free(ct->table);
+        free(ct);
+    }
+}
+
+// 查找MAX_LIMBS字的底数g和模数p的梳状表，必须持有combLock
+// 不在缓存中则返回NULL
+CombTable* CombFind(Limb* g, Limb* p)
+{
+    int i;
+
+    for (i = 0; i < combCacheSize; i++)
+    {
+        if (combCache[i] != NULL && memcmp(combCache[i]->mt.n, p, sizeof(combCache[i]->mt.n)) == 0 &&
+            memcmp(combCache[i]->g, g, sizeof(combCache[i]->g)) == 0)
+            return combCache[i];
+    }
+
+    return NULL;
+}
+
+// 把新的梳状表ct放入缓存中空的或最旧的位置，必须持有combLock
+void CombPut(CombTable* ct)
+{
+    int i, k = 0;
+
+    for (i = 0; i < combCacheSize; i++)
+    {
+        if (combCache[i] == NULL)
+        {
+            k = i;
+            break;
+        }
+
+        if (combCache[i]->used < combCache[k]->used)
+            k = i;
+    }
+
+    // 被丢弃的表在最后一个使用它的DoPowModFixed结束时释放
+    if (combCache[k] != NULL)
+        CombUnref(combCache[k]);
+
+    combCache[k] = ct;
+    ct->refs++;
+}
+
+// 用梳ct求r = g^e, r不是Montgomery形式，e有eLen个字且最多COMB_TEETH * a位
+// b - 1次平方，每个块的每个位置最多一次乘法
+void CombPow(CombTable* ct, Limb* e, int eLen, Limb* r)
+{
+    int i, j, k, t, bit, len = ct->mt.len;
+    Limb x[MAX_LIMBS];
+    Limb one[MAX_LIMBS] = {1};
+
+    memcpy(x, ct->mt.one, len * sizeof(Limb));  // x = R mod n
+
+    for (t = ct->b - 1; t >= 0; t--)
+    {
+        if (t < ct->b - 1)
+            MontMul(&ct->mt, x, x, x);  // x = x * x
+
+        for (k = 0; k < ct->v; k++)
+        {
+            // j: 所有齿中块k位置t的位
+            for (j = 0, i = COMB_TEETH - 1; i >= 0; i--)
+            {
+                bit = i * ct->a + k * ct->b + t;
+                j = j << 1 | (bit < eLen * LIMB_BITS && (e[bit / LIMB_BITS] >> (bit % LIMB_BITS) & 1));
+            }
+
+            if (j)
+                MontMul(&ct->mt, x, &ct->table[((k << COMB_TEETH) + j) * len], x);  // x = x * table[k][j]
+        }
+    }
+
+    MontMul(&ct->mt, x, one, r);  // r = x / R mod n
+}
+
+// 固定底数g和奇模数p的result = g^e mod p，例如Diffie-Hellman的g^x mod p
+// (g, p)的梳由第一次调用构建并保存在InitCombCache的缓存中，之后每次调用
+// 约需bits / COMB_TEETH次乘法和bits / COMB_TEETH / COMB_MAX_BLOCKS次平方
+// 指数比p长，p为偶数，有负数或无缓存时运行DoPowMod, result可以是g, e或p
+// 梳表没有内存时返回 NULL 并设置 ERROR_MEMORY
+BigInt* DoPowModFixed(BigInt* g, BigInt* e, BigInt* p, BigInt* result)
+{
+    int eLen;
+    Limb x[MAX_LIMBS], y[MAX_LIMBS], r[MAX_LIMBS];
+    BigInt t;
+    Mont mt;
+    CombTable *ct, *built;
+
+    if (combCacheSize == 0 || g->bit[SIGN_BIT] == NEGATIVE || e->bit[SIGN_BIT] == NEGATIVE ||
+        p->bit[SIGN_BIT] == NEGATIVE || p->bit[0] == 0 || GetTrueValueLen(p) == 1 ||
+        GetTrueValueLen(e) > GetTrueValueLen(p))
+        return DoPowMod(g, e, p, result);
+
+    if (DoCompare(g, p) >= 0)
+        g = DoMod(g, p, &t);  // t = g % p
+
+    BigIntToLimbs(g, x);
+    BigIntToLimbs(p, y);
+
+    MutexLock(&combLock);
+    ct = CombFind(x, y);
+    if (ct != NULL)
+    {
+        ct->refs++;
+        ct->used = ++combTick;
+    }
+    MutexUnlock(&combLock);
+
+    if (ct == NULL)
+    {
+        // 不持锁构建，这样其他底数的调用不用等待
+        MontInit(&mt, p);
+        built = CombBuild(&mt, x);
+        if (built == NULL)
+            return NULL;
+
+        MutexLock(&combLock);
+        ct = CombFind(x, y);  // 另一个线程可能同时构建了它
+        if (ct != NULL)
+        {
+            ct->refs++;
+            CombUnref(built);
+        }
+        else
+        {
+            ct = built;
+            CombPut(ct);
+        }
+        ct->used = ++combTick;
+        MutexUnlock(&combLock);
+    }
+
+    eLen = BigIntToLimbs(e, y);
+    CombPow(ct, y, eLen, r);
+    LimbsToBigInt(r, ct->mt.len, result);
+
+    MutexLock(&combLock);
+    CombUnref(ct);
+    MutexUnlock(&combLock);
+
+    return result;
+}
+
+char* PowModFixed(char* s1, char* s2, char* s3, char* result)
+{
+    BigInt a, b, c, d;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    StrToBigInt(s3, &c);
+    DoPowModFixed(&a, &b, &c, &d);
+
+    return ResultToStr(&d, result);
+}
+
+// 用单字的 Montgomery 乘法计算 r = a * b / 2^64 mod n
+// n 是奇数，nInv = -n^-1 mod 2^64，a 和 b 必须小于 n
+static INLINE Limb MontMul64(Limb a, Limb b, Limb n, Limb nInv)
+{
+    Limb lo, hi, mHi, r;
+
+    lo = MulLimb(a, b, &hi);
+    MulLimb(lo * nInv, n, &mHi);  // lo + m * n = 0 (mod 2^64)
+    r = hi + mHi + (lo != 0);
+
+    // a * b + m * n < 2n * 2^64，n >= 2^63 时 r 可能溢出
+    // 不用分支，因为条件是随机的
+    return r - (n & (0 - (Limb)(r < hi || r >= n)));
+}
+
+// 用很小的素数对 64 位整数试除
+// n 是合数返回 0，是素数返回 1，未知返回 -1
+int TrialDivision64(unsigned long long n)
+{
+    int i;
+
+    if (n < 2)
+        return 0;
+
+    if (n % 2 == 0)
+        return n == 2;
+
+    for (i = 0; i < TINY_PRIME_NUM; i++)
+    {
+        if (n % tinyPrime[i] == 0)
+            return n == tinyPrime[i];
+    }
+
+    // 没有小于 59 的因子
+    return n < 59 * 59 ? 1 : -1;
+}
+
+// 64 位奇数 n 的 Montgomery 参数，R = 2^64
+// nInv = -n^-1 mod 2^64, one = R mod n, r2 = R^2 mod n
+void MontInit64(Limb n, Limb* nInv, Limb* one, Limb* r2)
+{
+    int i;
+    Limb inv, hi, lo;
+
+    for (inv = n, i = 0; i < 5; i++)
+        inv *= 2 - n * inv;
+    *nInv = -inv;
+
+    *one = (0 - n) % n;
+    lo = MulLimb(*one, *one, &hi);
+    DivLimb(hi, lo, n, r2);
+}
+
+// 获取 64 位整数的确定性 Miller-Rabin 底数
+// n < 2^32 时 3 个底数就够了，返回底数个数
+int GetMrBase64(unsigned long long n, unsigned long long** base)
+{
+    if (n >> 32 == 0)
+    {
+        *base = mrBase32;
+        return MR_BASE32_NUM;
+    }
+
+    *base = mrBase64;
+    return MR_BASE64_NUM;
+}
+
+// 64 位整数的确定性 Miller-Rabin 测试
+// n 是素数返回 1，是合数返回 0，结果总是正确的
+int MillerRabin64(unsigned long long n)
+{
+    int i, j, k, s, baseNum;
+    unsigned long long* base;
+    Limb nInv, one, r2, nm1, d, a, x;
+
+    if (primeBitmap != NULL && n < 0x100000000ULL)
+        return PrimeBitmapLookup(n);
+
+    if ((k = TrialDivision64(n)) >= 0)
+        return k;
+
+    MontInit64(n, &nInv, &one, &r2);
+    nm1 = n - one;  // Montgomery 形式的 -1
+    baseNum = GetMrBase64(n, &base);
+
+    // n - 1 = 2^s * d
+    for (d = n - 1, s = 0; (d & 1) == 0; d >>= 1, s++);
+
+    for (k = 0; k < baseNum; k++)
+    {
+        a = base[k] % n;
+        if (a == 0)
+            continue;
+
+        a = MontMul64(a, r2, n, nInv);  // a * R mod n
+
+        // x = a^d，从最高位开始的二进制幂
+        for (i = LIMB_BITS - 1; (d >> i & 1) == 0; i--);
+        for (x = a, i--; i >= 0; i--)
+        {
+            x = MontMul64(x, x, n, nInv);
+            if (d >> i & 1)
+                x = MontMul64(x, a, n, nInv);
+        }
+
+        if (x == one || x == nm1)
+            continue;
+
+        for (j = 1; j < s; j++)
+        {
+            x = MontMul64(x, x, n, nInv);
+            if (x == nm1)
+                break;
+        }
+
+        if (j >= s)
+            return 0;
+    }
+
+    return 1;
+}
+
+// 批量 Miller-Rabin 测试的一轮，每个通道测试自己的底数 a
+// 各通道步调一致，所以不同通道的乘法
+// 互不依赖，CPU 可以重叠执行
+void MrLanesRound(MrLanes* ln)
+{
+    int i, j, k;
+    Limb x[MR64_LANES], a[MR64_LANES], t, bit;
+
+    for (k = 0; k < MR64_LANES; k++)
+    {
+        a[k] = MontMul64(ln->a[k], ln->r2[k], ln->n[k], ln->nInv[k]);  // a * R mod n
+        x[k] = ln->one[k];
+    }
+
+    // x = a^d，从最低位开始的二进制幂
+    for (i = 0; i < ln->maxBits; i++)
+    {
+        for (k = 0; k < MR64_LANES; k++)
+        {
+            t = MontMul64(x[k], a[k], ln->n[k], ln->nInv[k]);
+            bit = 0 - (ln->d[k] >> i & 1);
+            x[k] = (t & bit) | (x[k] & ~bit);  // 不用分支，因为这些位是随机的
+            a[k] = MontMul64(a[k], a[k], ln->n[k], ln->nInv[k]);
+        }
+    }
+
+    for (k = 0; k < MR64_LANES; k++)
+        ln->pass[k] = x[k] == ln->one[k] || x[k] == ln->n[k] - ln->one[k];
+
+    // 前 s 次平方中出现 x = -1，所有通道都通过时停止
+    for (j = 1; j < ln->maxS; j++)
+    {
+        for (k = 0; k < MR64_LANES && ln->pass[k]; k++);
+        if (k == MR64_LANES)
+            break;
+
+        for (k = 0; k < MR64_LANES; k++)
+        {
+            x[k] = MontMul64(x[k], x[k], ln->n[k], ln->nInv[k]);
+            ln->pass[k] |= j < ln->s[k] && x[k] == ln->n[k] - ln->one[k];
+        }
+    }
+}
+
+#ifdef USE_AVX2
+// 把每个通道当作无符号数比较 x < y
+TARGET_AVX2 static INLINE __m256i LessThan4(__m256i x, __m256i y)
+{
+    __m256i sign = _mm256_set1_epi64x((long long)1 << 63);
+
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(y, sign), _mm256_xor_si256(x, sign));
+}
+
+// 用 32 x 32 位乘法求每个通道的 128 位积，返回低位
+TARGET_AVX2 static INLINE __m256i MulLimb4(__m256i a, __m256i b, __m256i* hi)
+{
+    __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    __m256i a1 = _mm256_srli_epi64(a, 32), b1 = _mm256_srli_epi64(b, 32);
+    __m256i p00 = _mm256_mul_epu32(a, b), p01 = _mm256_mul_epu32(a, b1);
+    __m256i p10 = _mm256_mul_epu32(a1, b), p11 = _mm256_mul_epu32(a1, b1);
+    __m256i mid;
+
+    mid = _mm256_add_epi64(_mm256_srli_epi64(p00, 32), _mm256_and_si256(p01, mask));
+    mid = _mm256_add_epi64(mid, _mm256_and_si256(p10, mask));
+
+    *hi = _mm256_add_epi64(p11, _mm256_srli_epi64(mid, 32));
+    *hi = _mm256_add_epi64(*hi, _mm256_add_epi64(_mm256_srli_epi64(p01, 32), _mm256_srli_epi64(p10, 32)));
+
+    return _mm256_or_si256(_mm256_slli_epi64(mid, 32), _mm256_and_si256(p00, mask));
+}
+
+// 和 MontMul64 一样，计算每个通道的 r = a * b / 2^64 mod n
+TARGET_AVX2 static INLINE __m256i MontMul64x4(__m256i a, __m256i b, __m256i n, __m256i nInv)
+{
+    __m256i lo, hi, m, mHi, r, c, t;
+
+    lo = MulLimb4(a, b, &hi);
+
+    // m = lo * nInv mod 2^64，只需要 3 次乘法
+    t = _mm256_add_epi64(_mm256_mul_epu32(lo, _mm256_srli_epi64(nInv, 32)),
+                         _mm256_mul_epu32(_mm256_srli_epi64(lo, 32), nInv));
+    m = _mm256_add_epi64(_mm256_mul_epu32(lo, nInv), _mm256_slli_epi64(t, 32));
+
+    MulLimb4(m, n, &mHi);
+
+    // r = hi + mHi + (lo != 0)
+    c = _mm256_andnot_si256(_mm256_cmpeq_epi64(lo, _mm256_setzero_si256()), _mm256_set1_epi64x(1));
+    r = _mm256_add_epi64(_mm256_add_epi64(hi, mHi), c);
+
+    // r 溢出或 r >= n 时减去 n
+    t = _mm256_or_si256(LessThan4(r, hi), _mm256_xor_si256(LessThan4(r, n), _mm256_set1_epi64x(-1)));
+
+    return _mm256_sub_epi64(r, _mm256_and_si256(n, t));
+}
+
+// 和 MrLanesRound 一样，在 AVX2 通道中进行批量 Miller-Rabin 测试的一轮
+// 通道分为 2 个 4 通道的向量，交错执行以隐藏延迟
+TARGET_AVX2 static void MrLanesRound4(MrLanes* ln)
+{
+    int i, j, h;
+    __m256i n[2], nInv[2], one[2], nm1[2], d[2], s[2], a[2], x[2], pass[2], t, bit;
+    __m256i vOne = _mm256_set1_epi64x(1);
+
+    for (h = 0; h < 2; h++)
+    {
+        n[h] = _mm256_loadu_si256((__m256i*)(ln->n + 4 * h));
+        nInv[h] = _mm256_loadu_si256((__m256i*)(ln->nInv + 4 * h));
+        one[h] = _mm256_loadu_si256((__m256i*)(ln->one + 4 * h));
+        nm1[h] = _mm256_sub_epi64(n[h], one[h]);
+        d[h] = _mm256_loadu_si256((__m256i*)(ln->d + 4 * h));
+        s[h] = _mm256_loadu_si256((__m256i*)(ln->s64 + 4 * h));
+        a[h] = _mm256_loadu_si256((__m256i*)(ln->a + 4 * h));
+        t = _mm256_loadu_si256((__m256i*)(ln->r2 + 4 * h));
+        a[h] = MontMul64x4(a[h], t, n[h], nInv[h]);  // a * R mod n
+        x[h] = one[h];
+    }
+
+    // x = a^d，从最低位开始的二进制幂
+    for (i = 0; i < ln->maxBits; i++)
+    {
+        for (h = 0; h < 2; h++)
+        {
+            bit = _mm256_cmpeq_epi64(_mm256_and_si256(d[h], vOne), vOne);
+            x[h] = _mm256_blendv_epi8(x[h], MontMul64x4(x[h], a[h], n[h], nInv[h]), bit);
+            a[h] = MontMul64x4(a[h], a[h], n[h], nInv[h]);
+            d[h] = _mm256_srli_epi64(d[h], 1);
+        }
+    }
+
+    for (h = 0; h < 2; h++)
+        pass[h] = _mm256_or_si256(_mm256_cmpeq_epi64(x[h], one[h]), _mm256_cmpeq_epi64(x[h], nm1[h]));
+
+    // 前 s 次平方中出现 x = -1，所有通道都通过时停止
+    for (j = 1; j < ln->maxS; j++)
+    {
+        if (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_and_si256(pass[0], pass[1]))) == 15)
+            break;
+
+        for (h = 0; h < 2; h++)
+        {
+            x[h] = MontMul64x4(x[h], x[h], n[h], nInv[h]);
+            t = _mm256_and_si256(_mm256_cmpeq_epi64(x[h], nm1[h]), _mm256_cmpgt_epi64(s[h], _mm256_set1_epi64x(j)));
+            pass[h] = _mm256_or_si256(pass[h], t);
+        }
+    }
+
+    for (h = 0; h < 2; h++)
+        _mm256_storeu_si256((__m256i*)(ln->pass + 4 * h), pass[h]);
+}
+#endif
+
+// count 个 64 位整数的确定性 Miller-Rabin 测试
+// n[k] 是素数时 result[k] = 1，返回素数个数
+// 同时测试 MR64_LANES 个数，每轮每个通道测试自己的数的一个底数
+// 一个通道的数测试完后立刻换上下一个数，
+// 所以在其他通道还在测试剩下的底数时
+// 不会有空闲的通道
+// CPU 支持时各轮在 AVX2 通道中运行
+int MillerRabin64Batch(unsigned long long* n, int count, char* result)
+{
+    int i, k, t, active, next = 0, primeNum = 0;
+    int idx[MR64_LANES], base[MR64_LANES], baseNum[MR64_LANES];
+    unsigned long long* baseList[MR64_LANES];
+    MrLanes ln;
+
+    for (k = 0; k < MR64_LANES; k++)
+        idx[k] = -1;
+
+    while (1)
+    {
+        ln.maxBits = ln.maxS = 0;
+
+        for (active = 0, k = 0; k < MR64_LANES; k++)
+        {
+            // 填充空通道，很小的数在这里就测试完了
+            while (idx[k] < 0 && next < count)
+            {
+                if ((t = TrialDivision64(n[next])) >= 0)
+                {
+                    result[next] = (char)t;
+                    primeNum += t;
+                    next++;
+                    continue;
+                }
+
+                idx[k] = next;
+                ln.n[k] = n[next++];
+                base[k] = 0;
+                baseNum[k] = GetMrBase64(ln.n[k], &baseList[k]);
+                MontInit64(ln.n[k], &ln.nInv[k], &ln.one[k], &ln.r2[k]);
+                for (ln.d[k] = ln.n[k] - 1, ln.s[k] = 0; (ln.d[k] & 1) == 0; ln.d[k] >>= 1, ln.s[k]++);
+                ln.s64[k] = ln.s[k];
+            }
+
+            // 空通道以 2 为底测试 3，结果不使用
+            if (idx[k] < 0)
+            {
+                ln.n[k] = 3;
+                MontInit64(3, &ln.nInv[k], &ln.one[k], &ln.r2[k]);
+                ln.d[k] = 1;
+                ln.s[k] = 1;
+                ln.s64[k] = 1;
+                ln.a[k] = 2;
+                continue;
+            }
+
+            active++;
+            ln.a[k] = baseList[k][base[k]] % ln.n[k];
+
+            for (i = LIMB_BITS; i > 0 && (ln.d[k] >> (i - 1) & 1) == 0; i--);
+            ln.maxBits = i > ln.maxBits ? i : ln.maxBits;
+            ln.maxS = ln.s[k] > ln.maxS ? ln.s[k] : ln.maxS;
+        }
+
+        if (active == 0)
+            break;
+
+#ifdef USE_AVX2
+        if (useSimd && CpuHasAvx2())
+            MrLanesRound4(&ln);
+        else
+#endif
+            MrLanesRound(&ln);
+
+        // 是 n 的倍数的底数不能说明任何问题
+        for (k = 0; k < MR64_LANES; k++)
+        {
+            if (idx[k] < 0)
+                continue;
+
+            if (!ln.pass[k] && ln.a[k] != 0)
+            {
+                result[idx[k]] = 0;
+                idx[k] = -1;
+            }
+            else if (++base[k] == baseNum[k])
+            {
+                result[idx[k]] = 1;
+                primeNum++;
+                idx[k] = -1;
+            }
+        }
+    }
+
+    return primeNum;
+}
+
+// 分配 n 个字，没有内存时返回 NULL 并设置 ERROR_MEMORY
+Limb* LimbsAlloc(int n)
+{
+    Limb* p = (Limb*)malloc((n > 0 ? n : 1) * sizeof(Limb));
+
+    if (p == NULL)
+        SetError(ERROR_MEMORY);
+
+    return p;
+}
+
+// r = r + a, r有rLen个字 a有aLen个字，aLen <= rLen，返回进位
+Limb LimbsAddTo(Limb* r, int rLen, Limb* a, int aLen)
+{
+    int i;
+    Limb c = LimbsAdd(r, r, a, aLen);
+
+    for (i = aLen; c && i < rLen; i++)
+        c = ++r[i] == 0;
+
+    return c;
+}
+
+// r = r - a, r有rLen个字 a有aLen个字，aLen <= rLen，返回借位
+Limb LimbsSubFrom(Limb* r, int rLen, Limb* a, int aLen)
+{
+    int i;
+    Limb c = LimbsSub(r, r, a, aLen);
+
+    for (i = aLen; c && i < rLen; i++)
+        c = r[i]-- == 0;
+
+    return c;
+}
+
+// r = a % d, a has n words
+Limb LimbsModWord(Limb* a, int n, Limb d)
+{
+    int i;
+    Limb r = 0;
+
+    for (i = n - 1; i >= 0; i--)
+        DivLimb(r, a[i], d, &r);
+
+    return r;
+}
+
+// a = a >> k, a has n words, k < 64 * n
+void LimbsShiftRight(Limb* a, int n, int k)
+{
+    int i, w = k / LIMB_BITS, b = k % LIMB_BITS;
+
+    for (i = 0; i + w < n; i++)
+    {
+        a[i] = a[i + w] >> b;
+        if (b && i + w + 1 < n)
+            a[i] |= a[i + w + 1] << (LIMB_BITS - b);
+    }
+
+    for (; i < n; i++)
+        a[i] = 0;
+}
+
+// x的数论变换，N = 2^logN个模q->p的Montgomery形式的值
+// w: N次单位根的幂，w[j] = root^j, j < N / 2
+static void Ntt(Limb* x, int logN, Limb* w, NttPrime* q)
+{
+    int i, j, k, len, half, step, n = 1 << logN;
+    Limb t, u, v, p = q->p;
+
+    // 位反转置换
+    for (i = 1, j = 0; i < n; i++)
+    {
+        for (k = n >> 1; j & k; k >>= 1)
+            j ^= k;
+        j |= k;
+
+        if (i < j)
+        {
+            t = x[i];
+            x[i] = x[j];
+            x[j] = t;
+        }
+    }
+
+    for (len = 2; len <= n; len <<= 1)
+    {
+        half = len / 2;
+        step = n / len;
+
+        for (i = 0; i < n; i += len)
+        {
+            for (j = 0; j < half; j++)
+            {
+                u = x[i + j];
+                v = MontMul64(x[i + j + half], w[j * step], p, q->pInv);
+                t = u + v - p;                       // 无分支 u + v - p < 0是随机的
+                x[i + j] = t + (p & (0 - (t >> 63)));
+                t = u - v;
+                x[i + j + half] = t + (p & (0 - (t >> 63)));
+            }
+        }
+    }
+}
+
+// 用模3个素数的数论变换和CRT计算 r = a * b
+// 每个字是卷积的一个值 这些值小于 2^128 * N < p1 * p2 * p3
+// 变换没有内存时返回 0，此时不写 r
+static int LimbsMulNtt(Limb* r, Limb* a, int aLen, Limb* b, int bLen)
+{
+    int i, j, logN, n, square = a == b && aLen == bLen;
+    Limb e, root, one, nInv, v1, v2, v3, t, lo, hi, l0, h0, l1, h1, w0, w1, w2, cc, c0, c1, c2;
+    Limb *x, *y, *w;
+    NttPrime* q;
+
+    for (logN = 1; (1 << logN) < aLen + bLen; logN++);
+    n = 1 << logN;
+
+    x = (Limb*)malloc((NTT_PRIME_NUM * n + n + n / 2) * sizeof(Limb));
+    if (x == NULL)
+        return 0;
+
+    y = x + NTT_PRIME_NUM * n;
+    w = y + n;
+
+    for (j = 0; j < NTT_PRIME_NUM; j++)
+    {
+        q = &nttPrime[j];
+
+        // root = g^((p - 1) / N)，都是Montgomery形式
+        one = MontMul64(1, q->r2, q->p, q->pInv);
+        t = MontMul64(q->g, q->r2, q->p, q->pInv);
+        for (root = one, e = (q->p - 1) >> logN; e; e >>= 1)
+        {
+            if (e & 1)
+                root = MontMul64(root, t, q->p, q->pInv);
+            t = MontMul64(t, t, q->p, q->pInv);
+        }
+
+        for (w[0] = one, i = 1; i < n / 2; i++)
+            w[i] = MontMul64(w[i - 1], root, q->p, q->pInv);
+
+        // x = a * R mod p，一个字小于2^64 所以 a * r2 < p * 2^64
+        for (i = 0; i < n; i++)
+            x[j * n + i] = i < aLen ? MontMul64(a[i], q->r2, q->p, q->pInv) : 0;
+        Ntt(x + j * n, logN, w, q);
+
+        if (!square)
+        {
+            for (i = 0; i < n; i++)
+                y[i] = i < bLen ? MontMul64(b[i], q->r2, q->p, q->pInv) : 0;
+            Ntt(y, logN, w, q);
+        }
+
+        for (i = 0; i < n; i++)
+            x[j * n + i] = MontMul64(x[j * n + i], square ? x[j * n + i] : y[i], q->p, q->pInv);
+
+        // 逆变换就是变换后把x[1], ..., x[N-1]反转
+        Ntt(x + j * n, logN, w, q);
+        for (i = 1; i < n - i; i++)
+        {
+            t = x[j * n + i];
+            x[j * n + i] = x[j * n + n - i];
+            x[j * n + n - i] = t;
+        }
+
+        // 除以N并转出Montgomery形式，N^-1 = p - (p - 1) / N
+        nInv = q->p - ((q->p - 1) >> logN);
+        for (i = 0; i < n; i++)
+            x[j * n + i] = MontMul64(x[j * n + i], nInv, q->p, q->pInv);
+    }
+
+    // 用Garner算法做CRT 值为 v1 + p1 * v2 + p1 * p2 * v3
+    // c2:c1:c0是到下一个字的进位
+    for (c0 = c1 = c2 = 0, i = 0; i < aLen + bLen; i++)
+    {
+        v1 = x[i];
+
+        t = v1 >= nttPrime[1].p ? v1 - nttPrime[1].p : v1;              // v1 mod p2
+        t = x[n + i] >= t ? x[n + i] - t : x[n + i] + nttPrime[1].p - t;
+        v2 = MontMul64(t, NTT_INV12, nttPrime[1].p, nttPrime[1].pInv);  // (r2 - v1) / p1 mod p2
+
+        t = v1 % nttPrime[2].p;
+        t += MontMul64(v2, NTT_P1_MOD3, nttPrime[2].p, nttPrime[2].pInv);
+        t = t >= nttPrime[2].p ? t - nttPrime[2].p : t;                 // (v1 + p1 * v2) mod p3
+        t = x[2 * n + i] >= t ? x[2 * n + i] - t : x[2 * n + i] + nttPrime[2].p - t;
+        v3 = MontMul64(t, NTT_INV123, nttPrime[2].p, nttPrime[2].pInv); // (r3 - v1 - p1 * v2) / (p1 * p2) mod p3
+
+        lo = MulLimb(nttPrime[0].p, v2, &hi);  // hi:lo = v1 + p1 * v2
+        lo += v1;
+        hi += lo < v1;
+
+        l0 = MulLimb(NTT_P12_LO, v3, &h0);     // w2:w1:w0 = p1 * p2 * v3
+        l1 = MulLimb(NTT_P12_HI, v3, &h1);
+        w0 = l0;
+        w1 = h0 + l1;
+        w2 = h1 + (w1 < l1);
+
+        w0 += lo;
+        cc = w0 < lo;
+        w1 += cc;
+        w2 += w1 < cc;
+        w1 += hi;
+        w2 += w1 < hi;
+
+        c0 += w0;
+        cc = c0 < w0;
+        c1 += cc;
+        c2 += c1 < cc;
+        c1 += w1;
+        c2 += c1 < w1;
+        c2 += w2;
+
+        r[i] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+    }
+
+    free(x);
+
+    return 1;
+}
+
+static void LimbsMulRec(Limb* r, Limb* a, int aLen, Limb* b, int bLen, Limb* tmp);
+
+// 用Karatsuba算法计算 r = a * b, a和b是n个字 r有2n个字
+// a * b = z2 * x^2 + (z1 - z0 - z2) * x + z0, x = 2^(64h), z1 = (a0 + a1) * (b0 + b1)
+// tmp: LimbsMulRec的临时空间
+static void LimbsMulKaratsuba(Limb* r, Limb* a, Limb* b, int n, Limb* tmp)
+{
+    int h = n / 2, k = n - h, saLen, sbLen;
+    Limb *sa = tmp, *sb = tmp + k + 1, *z1 = tmp + 2 * k + 2;
+
+    LimbsMulRec(r, a, h, b, h, tmp);                  // z0 = a0 * b0
+    LimbsMulRec(r + 2 * h, a + h, k, b + h, k, tmp);  // z2 = a1 * b1
+
+    memcpy(sa, a + h, k * sizeof(Limb));              // sa = a0 + a1
+    sa[k] = LimbsAddTo(sa, k, a, h);
+    saLen = LimbsLen(sa, k + 1);
+
+    if (a == b)
+    {
+        sb = sa;
+        sbLen = saLen;
+    }
+    else
+    {
+        memcpy(sb, b + h, k * sizeof(Limb));          // sb = b0 + b1
+        sb[k] = LimbsAddTo(sb, k, b, h);
+        sbLen = LimbsLen(sb, k + 1);
+    }
+
+    LimbsMulRec(z1, sa, saLen, sb, sbLen, z1 + 2 * k + 2);
+    memset(z1 + saLen + sbLen, 0, (2 * k + 2 - saLen - sbLen) * sizeof(Limb));
+
+    LimbsSubFrom(z1, 2 * k + 2, r, 2 * h);            // z1 = z1 - z0 - z2
+    LimbsSubFrom(z1, 2 * k + 2, r + 2 * h, 2 * k);
+    LimbsAddTo(r + h, 2 * n - h, z1, LimbsLen(z1, 2 * k + 2));
+}
+
+// x = a, x有n个字 a有aLen个字
+static void LimbsExtend(Limb* x, int n, Limb* a, int aLen)
+{
+    memcpy(x, a, aLen * sizeof(Limb));
+    memset(x + aLen, 0, (n - aLen) * sizeof(Limb));
+}
+
+// x = -x, n个字的补码
+static void LimbsNeg(Limb* x, int n)
+{
+    int i;
+    Limb c = 1;
+
+    for (i = 0; i < n; i++)
+    {
+        x[i] = ~x[i] + c;
+        c = c && x[i] == 0;
+    }
+}
+
+// x = x / 2, n个字的补码
+static void LimbsHalve(Limb* x, int n)
+{
+    int i;
+
+    for (i = 0; i < n - 1; i++)
+        x[i] = x[i] >> 1 | x[i + 1] << (LIMB_BITS - 1);
+
+    x[n - 1] = (Limb)((long long)x[n - 1] >> 1);
+}
+
+// x = x / 3, n个字的补码 x必须是3的倍数
+// 每个字乘以 3^-1 mod 2^64, q * 3的高位字从下一个字借
+static void LimbsDivExact3(Limb* x, int n)
+{
+    int i;
+    Limb s, q, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        s = x[i] - c;
+        c = x[i] < c;
+        q = s * 0xaaaaaaaaaaaaaaabULL;
+        x[i] = q;
+        c += (q > 0x5555555555555555ULL) + (q > 0xaaaaaaaaaaaaaaaaULL);
+    }
+}
+
+// a = a0 + a1 * x + a2 * x^2 在1, -1和-2处的值 每个是L个字的补码
+// a0 and a1 have k words, a2 has k2 words
+static void Toom3Eval(Limb* e, Limb* a, int k, int k2, int L)
+{
+    Limb *e1 = e, *em1 = e + L, *em2 = e + 2 * L;
+
+    LimbsExtend(e1, L, a, k);                // a0 + a2
+    LimbsAddTo(e1, L, a + 2 * k, k2);
+    memcpy(em1, e1, L * sizeof(Limb));
+
+    LimbsAddTo(e1, L, a + k, k);             // e1 = a0 + a1 + a2
+    LimbsSubFrom(em1, L, a + k, k);          // em1 = a0 - a1 + a2
+
+    memcpy(em2, em1, L * sizeof(Limb));      // em2 = (em1 + a2) * 2 - a0
+    LimbsAddTo(em2, L, a + 2 * k, k2);
+    LimbsAdd(em2, em2, em2, L);
+    LimbsSubFrom(em2, L, a, k);
+}
+
+// r = x * y, x和y有L个字 r有 W = 2L 个字 都是补码
+// tmp: 2L个字 然后是LimbsMulRec的临时空间
+static void Toom3Mul(Limb* r, Limb* x, Limb* y, int L, Limb* tmp)
+{
+    int xs = x[L - 1] >> (LIMB_BITS - 1), ys = y[L - 1] >> (LIMB_BITS - 1), xLen, yLen;
+    Limb *mx = tmp, *my = tmp + L;
+
+    memcpy(mx, x, L * sizeof(Limb));         // |x|
+    if (xs)
+        LimbsNeg(mx, L);
+    xLen = LimbsLen(mx, L);
+
+    if (x == y)
+    {
+        my = mx;
+        yLen = xLen;
+    }
+    else
+    {
+        memcpy(my, y, L * sizeof(Limb));     // |y|
+        if (ys)
+            LimbsNeg(my, L);
+        yLen = LimbsLen(my, L);
+    }
+
+    LimbsMulRec(r, mx, xLen, my, yLen, tmp + 2 * L);
+    memset(r + xLen + yLen, 0, (2 * L - xLen - yLen) * sizeof(Limb));
+
+    if (xs != ys)
+        LimbsNeg(r, 2 * L);
+}
+
+// 用Toom-3算法计算 r = a * b, a和b是n个字 r有2n个字
+// a和b切成3段k个字 乘积是4次多项式
+// 按Bodrato序列由0, 1, -1, -2和无穷处的值求出
+// tmp: LimbsMulRec的临时空间
+static void LimbsMulToom3(Limb* r, Limb* a, Limb* b, int n, Limb* tmp)
+{
+    int i, len, k = (n + 2) / 3, k2 = n - 2 * k, L = k + 2, W = 2 * L;
+    Limb *ea = tmp, *eb = tmp + 3 * L, *next = tmp + 6 * L + 5 * W;
+    Limb *r0 = tmp + 6 * L, *r1 = r0 + W, *r2 = r1 + W, *r3 = r2 + W, *r4 = r3 + W;
+    Limb* c[5];
+
+    Toom3Eval(ea, a, k, k2, L);
+    if (a == b)
+        eb = ea;
+    else
+        Toom3Eval(eb, b, k, k2, L);
+
+    LimbsMulRec(r0, a, k, b, k, next);                      // r(0) = a0 * b0
+    LimbsExtend(r0, W, r0, 2 * k);
+    LimbsMulRec(r4, a + 2 * k, k2, b + 2 * k, k2, next);    // r(inf) = a2 * b2
+    LimbsExtend(r4, W, r4, 2 * k2);
+    Toom3Mul(r1, ea, eb, L, next);                          // r(1)
+    Toom3Mul(r2, ea + L, eb + L, L, next);                  // r(-1)
+    Toom3Mul(r3, ea + 2 * L, eb + 2 * L, L, next);          // r(-2)
+
+    LimbsSub(r3, r3, r1, W);          // r3 = (r(-2) - r(1)) / 3
+    LimbsDivExact3(r3, W);
+    LimbsSub(r1, r1, r2, W);          // r1 = (r(1) - r(-1)) / 2
+    LimbsHalve(r1, W);
+    LimbsSub(r2, r2, r0, W);          // r2 = r(-1) - r(0)
+    LimbsSub(r3, r2, r3, W);          // r3 = (r2 - r3) / 2 + 2 * r(inf)
+    LimbsHalve(r3, W);
+    LimbsAdd(r3, r3, r4, W);
+    LimbsAdd(r3, r3, r4, W);
+    LimbsAdd(r2, r2, r1, W);          // r2 = r2 + r1 - r(inf)
+    LimbsSub(r2, r2, r4, W);
+    LimbsSub(r1, r1, r3, W);          // r1 = r1 - r3
+
+    // 此时所有系数非负，r = c[i] * x^i 之和
+    c[0] = r0;
+    c[1] = r1;
+    c[2] = r2;
+    c[3] = r3;
+    c[4] = r4;
+    memset(r, 0, 2 * n * sizeof(Limb));
+
+    for (i = 0; i < 5; i++)
+    {
+        len = LimbsLen(c[i], W);
+        if (len > 2 * n - i * k)
+            len = 2 * n - i * k;
+        LimbsAddTo(r + i * k, 2 * n - i * k, c[i], len);
+    }
+}
+
+// r = a * b, r有aLen + bLen个字 按较短的字数选择算法
+// tmp: scratch, MUL_TMP_SIZE(max(aLen, bLen)) words
+static void LimbsMulRec(Limb* r, Limb* a, int aLen, Limb* b, int bLen, Limb* tmp)
+{
+    int off, len;
+    Limb* t;
+
+    if (aLen < bLen)
+    {
+        t = a;
+        a = b;
+        b = t;
+        len = aLen;
+        aLen = bLen;
+        bLen = len;
+    }
+
+    if (bLen < karatsubaThreshold || bLen < 2)
+    {
+        LimbsMul(r, a, aLen, b, bLen);
+        return;
+    }
+
+    // NTT 没有内存时，在 tmp 中用 Toom-3 得到同样的乘积
+    if (bLen >= nttThreshold && LimbsMulNtt(r, a, aLen, b, bLen))
+        return;
+
+    // 把a切成bLen个字的段
+    if (aLen > bLen)
+    {
+        memset(r, 0, (aLen + bLen) * sizeof(Limb));
+
+        for (off = 0; off < aLen; off += bLen)
+        {
+            len = aLen - off < bLen ? aLen - off : bLen;
+            LimbsMulRec(tmp, a + off, len, b, bLen, tmp + len + bLen);
+            LimbsAddTo(r + off, aLen + bLen - off, tmp, len + bLen);
+        }
+        return;
+    }
+
+    if (bLen >= toom3Threshold && bLen >= 8)
+        LimbsMulToom3(r, a, b, bLen, tmp);
+    else
+        LimbsMulKaratsuba(r, a, b, bLen, tmp);
+}
+
+// r = a * b mod 2^(64n)，即n字的a和b之积的低n个字
+// 只有a0 * b0是完整乘积，a1 * b0和a0 * b1仍是低半乘积，不需要a1 * b1
+// tmp: scratch, MUL_TMP_SIZE(n) words
+static void LimbsMulLow(Limb* r, Limb* a, Limb* b, int n, Limb* tmp)
+{
+    int i, h = (n + 1) / 2, k = n - h;
+    Limb *p = tmp, *q = tmp + 2 * h;
+
+    if (n < karatsubaThreshold || n < 2)
+    {
+        memset(r, 0, n * sizeof(Limb));
+        for (i = 0; i < n; i++)
+            LimbsAddMul1(r + i, b, n - i, a[i]);  // 超出n个字的进位被丢弃
+
+        return;
+    }
+
+    LimbsMulRec(p, a, h, b, h, q);         // p = a0 * b0, 2h >= n words
+    memcpy(r, p, n * sizeof(Limb));
+
+    LimbsMulLow(q, a + h, b, k, q + k);    // r = r + a1 * b0 * 2^(64h)
+    LimbsAddTo(r + h, k, q, k);
+    LimbsMulLow(q, a, b + h, k, q + k);    // r = r + a0 * b1 * 2^(64h)
+    LimbsAddTo(r + h, k, q, k);
+}
+
+// 任意字数的 r = a * b, r有aLen + bLen个字
+// r不能是a或b, a == b且aLen == bLen时是平方 更快
+// 按阈值选择竖式，Karatsuba, Toom-3 或 NTT，临时空间没有内存时用竖式
+void LimbsMulFast(Limb* r, Limb* a, int aLen, Limb* b, int bLen)
+{
+    int n = aLen > bLen ? aLen : bLen;
+    Limb* tmp;
+
+    if (aLen < karatsubaThreshold || bLen < karatsubaThreshold)
+    {
+        LimbsMul(r, a, aLen, b, bLen);
+        return;
+    }
+
+    tmp = (Limb*)malloc(MUL_TMP_SIZE(n) * sizeof(Limb));
+    if (tmp == NULL)
+    {
+        LimbsMul(r, a, aLen, b, bLen);
+        return;
+    }
+
+    LimbsMulRec(r, a, aLen, b, bLen, tmp);
+    free(tmp);
+}
+
+// 释放LargeMontInit的内存
+void LargeMontFree(LargeMont* mt)
+{
+    free(mt->n);
+}
+
+// 用Montgomery乘法和LimbsMulFast的各级算法计算 r = a * b / R mod n
+// m = a * b * nInv mod R，则 a * b + m * n 是R的倍数
+// a 和 b 必须小于 n，r 可以和 a 或 b 相同
+void LargeMontMul(LargeMont* mt, Limb* a, Limb* b, Limb* r)
+{
+    int len = mt->len;
+    Limb c;
+    Limb *t = mt->t, *m = t + 2 * len, *u = m + 2 * len;
+
+    LimbsMulRec(t, a, len, b, len, mt->tmp);         // t = a * b
+    LimbsMulLow(m, t, mt->nInv, len, mt->tmp);       // m = t * nInv mod R，低len个字
+    LimbsMulRec(u, m, len, mt->n, len, mt->tmp);     // u = m * n
+    c = LimbsAdd(u, u, t, 2 * len);            // u = (t + m * n) / R
+
+    // now u < 2n
+    if (c || LimbsCompare(u + len, mt->n, len) >= 0)
+        LimbsSub(r, u + len, mt->n, len);
+    else
+        memcpy(r, u + len, len * sizeof(Limb));
+}
+
+// 初始化len个字的奇模数n的Montgomery形式，n > 1, R = 2^(64 * len)
+// 内存从堆上分配 用LargeMontFree释放
+// 没有内存时返回 0 并设置 ERROR_MEMORY，此时无需释放
+int LargeMontInit(LargeMont* mt, Limb* n, int len)
+{
+    int i, w, w2;
+    Limb c, inv, two = 2;
+    Limb *x, *t, *u;
+
+    mt->len = len;
+    mt->n = LimbsAlloc(10 * len + 2 + MUL_TMP_SIZE(len));
+    if (mt->n == NULL)
+        return 0;
+
+    mt->nInv = mt->n + len;
+    mt->one = mt->nInv + len;
+    mt->rr = mt->one + len;
+    mt->t = mt->rr + len;
+    mt->tmp = mt->t + 6 * len + 2;
+    memcpy(mt->n, n, len * sizeof(Limb));
+
+    // 用牛顿迭代 x = x * (2 - n * x) 求 n^-1 mod R，每步字数翻倍
+    x = mt->nInv;
+    t = mt->t;
+    u = mt->t + 2 * len + 1;
+    memset(x, 0, len * sizeof(Limb));
+    for (inv = n[0], i = 0; i < 5; i++)
+        inv *= 2 - n[0] * inv;
+    x[0] = inv;
+
+    for (w = 1; w < len; w = w2)
+    {
+        w2 = 2 * w < len ? 2 * w : len;
+
+        LimbsMulFast(t, n, w2, x, w);      // t = 2 - n * x mod 2^(64 * w2)
+        LimbsNeg(t, w2);
+        LimbsAddTo(t, w2, &two, 1);
+
+        LimbsMulFast(u, x, w, t, w2);      // x = x * t mod 2^(64 * w2)
+        memcpy(x, u, w2 * sizeof(Limb));
+    }
+    LimbsNeg(x, len);                      // nInv = -n^-1
+
+    // R mod n, double 2^(bitLen - 1) until it is 2^(64 * len)
+    w = LimbsBitLen(n, len);
+    memset(mt->one, 0, len * sizeof(Limb));
+    mt->one[(w - 1) / LIMB_BITS] = (Limb)1 << ((w - 1) % LIMB_BITS);
+
+    for (i = w - 1; i < LIMB_BITS * len; i++)
+    {
+        c = LimbsAdd(mt->one, mt->one, mt->one, len);
+        if (c || LimbsCompare(mt->one, n, len) >= 0)
+            LimbsSub(mt->one, mt->one, n, len);
+    }
+
+    // R^2 mod n 是2^(64 * len)的Montgomery形式 由 2 * R mod n 的幂求出
+    x = LimbsAlloc(2 * len);
+    if (x == NULL)
+    {
+        LargeMontFree(mt);
+        return 0;
+    }
+
+    u = x + len;
+    c = LimbsAdd(x, mt->one, mt->one, len);
+    if (c || LimbsCompare(x, n, len) >= 0)
+        LimbsSub(x, x, n, len);
+
+    memcpy(u, mt->one, len * sizeof(Limb));
+    for (i = 31; i >= 0; i--)
+    {
+        LargeMontMul(mt, u, u, u);
+        if ((LIMB_BITS * len) >> i & 1)
+            LargeMontMul(mt, u, x, u);
+    }
+    memcpy(mt->rr, u, len * sizeof(Limb));
+    free(x);
+
+    return 1;
+}
+
+// r = a^e / R^(e-1) mod n，即Montgomery形式的幂 a和r是Montgomery形式
+// e有eLen个字 4位固定窗口
+// 没有内存时返回 0 并设置 ERROR_MEMORY，此时不写 r
+int LargeMontPow(LargeMont* mt, Limb* a, Limb* e, int eLen, Limb* r)
+{
+    int i, j, w, len = mt->len;
+    Limb *g, *t;
+
+    g = LimbsAlloc(17 * len);  // g[i] = a^i 的Montgomery形式 以及结果
+    if (g == NULL)
+        return 0;
+
+    t = g + 16 * len;
+
+    memcpy(g, mt->one, len * sizeof(Limb));
+    for (i = 1; i < 16; i++)
+        LargeMontMul(mt, g + (i - 1) * len, a, g + i * len);
+
+    memcpy(t, mt->one, len * sizeof(Limb));
+    for (i = eLen * LIMB_BITS / 4 - 1; i >= 0; i--)
+    {
+        for (j = 0; j < 4; j++)
+            LargeMontMul(mt, t, t, t);
+
+        w = e[i / 16] >> (i % 16 * 4) & 15;
+        if (w)
+            LargeMontMul(mt, t, g + w * len, t);
+    }
+
+    memcpy(r, t, len * sizeof(Limb));
+    free(g);
+
+    return 1;
+}
+
+// 用LargeMont对len个字的n做Miller-Rabin测试 用于比BigInt大的数
+// n 是合数返回 0，可能是素数返回 1，没有内存时返回 0 并设置 ERROR_MEMORY
+int LimbsMillerRabin(Limb* n, int len, int times)
+{
+    int i, j, s, bits, ret = 1;
+    LargeMont mt;
+    Limb two = 2;
+    Limb *d, *a, *nm1, *nm2, *x;
+    Rng* rng = GetThreadRng();
+
+    len = LimbsLen(n, len);
+    if (len == 0)
+        return 0;
+    if (len == 1)
+        return MillerRabin64(n[0]);
+    if ((n[0] & 1) == 0)
+        return 0;
+
+    if (LimbsTrialDivision(n, len, TrialBound(LIMB_BITS * len)) == 0)
+        return 0;
+
+    if (!LargeMontInit(&mt, n, len))
+        return 0;
+
+    d = LimbsAlloc(5 * len);
+    if (d == NULL)
+    {
+        LargeMontFree(&mt);
+        return 0;
+    }
+
+    a = d + len;
+    nm1 = a + len;
+    nm2 = nm1 + len;
+    x = nm2 + len;
+    bits = LimbsBitLen(n, len);
+
+    // n - 1 = 2^s * d
+    memcpy(d, n, len * sizeof(Limb));
+    d[0]--;
+    for (s = 0; (d[s / LIMB_BITS] >> (s % LIMB_BITS) & 1) == 0; s++);
+    LimbsShiftRight(d, len, s);
+
+    LimbsSub(nm1, n, mt.one, len);  // Montgomery 形式的 -1
+
+    // n - 2，n 的低位字为 1 时借位继续向上传
+    memcpy(nm2, n, len * sizeof(Limb));
+    LimbsSubFrom(nm2, len, &two, 1);
+
+    for (i = 0; i < times && ret; i++)
+    {
+        // a = random{2, 3, ..., n-2}
+        do
+        {
+            for (j = 0; j < len; j++)
+                a[j] = DoRandWord(rng);
+            if (bits % LIMB_BITS)
+                a[len - 1] &= ((Limb)1 << (bits % LIMB_BITS)) - 1;
+        }
+        while (LimbsCompare(a, nm2, len) > 0 || (LimbsLen(a, len) == 1 && a[0] < 2));
+
+        LargeMontMul(&mt, a, mt.rr, x);      // x = a 的Montgomery形式
+        if (!LargeMontPow(&mt, x, d, len, x))  // x = a^d
+        {
+            ret = 0;
+            break;
+        }
+
+        if (LimbsCompare(x, mt.one, len) == 0 || LimbsCompare(x, nm1, len) == 0)
+            continue;
+
+        for (j = 1; j < s; j++)
+        {
+            LargeMontMul(&mt, x, x, x);      // x = x^2
+            if (LimbsCompare(x, nm1, len) == 0)
+                break;
+        }
+
+        if (j >= s)
+            ret = 0;
+    }
+
+    free(d);
+    LargeMontFree(&mt);
+
+    return ret;
+}
+
+// 十进制字符串转换为字 返回字数，x必须有 strlen(s) / 19 + 1 个字
+int StrToLimbs(char* s, Limb* x)
+{
+    int i, j, k, n = strlen(s), len = 0;
+    Limb chunk, base;
+
+    // 每段19位数字 第一段取余下的
+    for (i = 0; i < n; i += k)
+    {
+        k = i == 0 && n % 19 ? n % 19 : 19;
+
+        for (chunk = 0, base = 1, j = 0; j < k; j++)
+        {
+            chunk = chunk * 10 + (s[i + j] - '0');
+            base *= 10;
+        }
+
+        x[len] = LimbsMul1(x, x, len, base);  // x = x * 10^k + chunk
+        len++;
+        LimbsAddTo(x, len, &chunk, 1);
+        len = LimbsLen(x, len);
+    }
+
+    return len;
+}
+
+// 任意位长十进制数的Miller-Rabin测试 不受BIG_INT_BIT_LEN限制
+// 没有内存时返回 0 并设置 ERROR_MEMORY
+int MillerRabinLarge(char* s, int times)
+{
+    int ret, len;
+    Limb* x;
+
+    ClearError();
+    x = LimbsAlloc(strlen(s) / 19 + 2);
+    if (x == NULL)
+        return 0;
+
+    len = StrToLimbs(s, x);
+    ret = LimbsMillerRabin(x, len, times);
+    free(x);
+
+    return ret;
+}
+
+// 用试除法判断一个小整数是否为素数
+int IsSmallPrime(unsigned long n)
+{
+    unsigned long i;
+
+    if (primeBitmap != NULL && n < 0x100000000ULL)
+        return PrimeBitmapLookup(n);
+
+    if (n < 2)
+        return 0;
+
+    for (i = 2; i * i <= n; i++)
+    {
+        if (n % i == 0)
+            return 0;
+    }
+
+    return 1;
+}
+
+// 用移位加法实现模 2^p - 1，a 必须非负
+// a = hi * 2^p + lo，而 2^p = 1 (mod 2^p - 1)，所以 a = hi + lo
+// result可以是a 不需要临时变量
+BigInt* DoModMersenne(BigInt* a, int p, BigInt* result)
+{
+    int i, j, t, carryFlag;
+
+    if (result != a)
+        CopyBigInt(a, result);
+
+    while (GetTrueValueLen(result) > p)
+    {
+        // 原地计算 a = lo + hi, hi = a >> p 在加的同时从a中清除
+        for (carryFlag = 0, i = 0, j = p; j < SIGN_BIT; i++, j++)
+        {
+            t = result->bit[i] + result->bit[j] + carryFlag;
+            result->bit[j] = 0;
+            result->bit[i] = t & 1;
+            carryFlag = t >> 1;
+        }
+
+        for (; carryFlag && i < SIGN_BIT; i++)
+        {
+            t = result->bit[i] + carryFlag;
+            result->bit[i] = t & 1;
+            carryFlag = t >> 1;
+        }
+    }
+
+    // 2^p - 1 本身就是 0
+    for (i = 0; i < p && result->bit[i] == 1; i++);
+    if (i == p)
+        memset(result->bit, 0, BIG_INT_BIT_LEN);
+
+    return result;
+}
+
+// r = x mod 2^p - 1, x有xLen个字 r有 len = p / 64 + 1 个字
+// x = hi * 2^p + lo，且 2^p = 1 (mod 2^p - 1)，所以 x = hi + lo, hi必须小于2^p
+void LimbsModMersenne(Limb* x, int xLen, int p, Limb* r, int len)
+{
+    int i, w = p / LIMB_BITS, b = p % LIMB_BITS;
+    Limb hi, t, c;
+
+    for (i = 0; i < len; i++)  // lo
+        r[i] = i < xLen ? x[i] : 0;
+    r[w] &= ((Limb)1 << b) - 1;
+
+    for (c = 0, i = 0; i < len; i++)  // r = lo + hi
+    {
+        hi = w + i < xLen ? x[w + i] >> b : 0;
+        if (b && w + i + 1 < xLen)
+            hi |= x[w + i + 1] << (LIMB_BITS - b);
+
+        t = r[i] + c;
+        c = t < c;
+        r[i] = t + hi;
+        c += r[i] < hi;
+    }
+
+    // 此时 r < 2^(p+1)，再折叠一次第p位
+    if (r[w] >> b & 1)
+    {
+        r[w] &= ((Limb)1 << b) - 1;
+        for (i = 0; i < len && ++r[i] == 0; i++);
+    }
+
+    // 2^p - 1 本身就是 0
+    for (i = 0; i < p && (r[i / LIMB_BITS] >> (i % LIMB_BITS) & 1); i++);
+    if (i == p)
+        memset(r, 0, len * sizeof(Limb));
+}
+
+// 用LimbsMulFast在字上做Lucas-Lehmer测试 用于超出BigInt的指数
+// 没有内存时返回 0 并设置 ERROR_MEMORY
+int LucasLehmerLarge(int p)
+{
+    int i, zero, len = p / LIMB_BITS + 1;
+    Limb *s, *sq, *tmp;
+    Limb one = 1, two = 2;
+
+    s = LimbsAlloc(3 * len + MUL_TMP_SIZE(len));
+    if (s == NULL)
+        return 0;
+
+    sq = s + len;
+    tmp = sq + 2 * len;
+
+    memset(s, 0, len * sizeof(Limb));
+    s[0] = 4;
+
+    for (i = 0; i < p - 2; i++)
+    {
+        LimbsMulRec(sq, s, len, s, len, tmp);   // s = s * s mod 2^p - 1
+        LimbsModMersenne(sq, 2 * len, p, s, len);
+
+        if (LimbsSubFrom(s, len, &two, 1))      // s = s - 2，为负则加 2^p - 1
+        {
+            s[p / LIMB_BITS] &= ((Limb)1 << (p % LIMB_BITS)) - 1;  // + 2^p
+            LimbsSubFrom(s, len, &one, 1);                          // - 1
+        }
+    }
+
+    zero = LimbsLen(s, len) == 0;
+    free(s);
+
+    return zero;
+}
+
+// 对梅森数 2^p - 1 做 Lucas-Lehmer 测试
+// s(0) = 4, s(k) = s(k-1)^2 - 2 (mod 2^p - 1)
+// 2^p - 1 是素数当且仅当 s(p-2) = 0
+// 注意: s^2有2p位 BIG_INT_BIT_LEN不够时使用LucasLehmerLarge
+int LucasLehmer(int p)
+{
+    int i;
+    BigInt s, m;
+
+    if (p == 2)  // 2^2 - 1 = 3
+        return 1;
+
+    // p 是合数时，2^p - 1 也是合数
+    if (!IsSmallPrime(p))
+        return 0;
+
+    if (2 * p + 2 > SIGN_BIT)
+        return LucasLehmerLarge(p);
+
+    memset(m.bit, 0, BIG_INT_BIT_LEN);  // m = 2^p - 1
+    for (i = 0; i < p; i++)
+        m.bit[i] = 1;
+
+    LongToBigInt(4, &s);     // s = 4
+
+    for (i = 0; i < p - 2; i++)
+    {
+        DoMul(&s, &s, &s);         // s = s * s
+        DoModMersenne(&s, p, &s);  // s = s % m
+        DoSub(&s, &bigTwo, &s);    // s = s - 2
+
+        if (s.bit[SIGN_BIT] == NEGATIVE)
+            DoAdd(&s, &m, &s);     // s = s + m
+    }
+
+    return IsZero(&s);
+}
+
+// 找出 [low, high] 中所有梅森素数的指数 p
+// result 存放指数，返回值为个数
+int ScanMersenne(int low, int high, int* result)
+{
+    int p, count = 0;
+    unsigned long a, b;
+
+    for (p = low; p <= high; p++)
+    {
+        // p 为合数时 2^p - 1 必为合数，不用打印
+        if (!IsSmallPrime(p))
+            continue;
+
+        PrintProgress("testing exponent[%d]...\n", p);
+        a = time(0);
+
+        if (LucasLehmer(p))
+            result[count++] = p;
+
+        b = time(0);
+        PrintProgress("finish test exponent %d (t=%lds)\n\n", p, b - a);
+    }
+
+    return count;
+}
+
+// 取得本线程中搜索的检查点文件
+// 没有检查点，或本线程的上下文设置了 noCheckpoint 时返回 NULL
+char* GetCheckpointPath()
+{
+    return GetContext()->noCheckpoint ? NULL : checkpointPath;
+}
+
+// 把搜索状态保存到检查点文件，cand: 下一个要测试的数
+// 距上次超过checkpointInterval秒才保存
+// 先写到临时文件再重命名 所以被杀掉也不会留下半个文件
+// 状态小于1KB 比测试一个候选便宜得多
+void SaveCheckpoint(Checkpoint* cp, BigInt* cand)
+{
+    static THREAD_LOCAL time_t last;
+    char tmp[BUFFER_SIZE];
+    char* path = GetCheckpointPath();
+    time_t now = time(0);
+    FILE* fp;
+
+    if (path == NULL || now - last < checkpointInterval)
+        return;
+
+    last = now;
+    cp->magic = CHECKPOINT_MAGIC;
+    cp->size = sizeof(Checkpoint);
+    cp->rng = *GetThreadRng();
+    memset(cp->cand, 0, sizeof(cp->cand));
+    BigIntToLimbs(cand, cp->cand);
+
+    sprintf(tmp, "%.*s.tmp", BUFFER_SIZE - 8, path);
+    fp = fopen(tmp, "wb");
+    if (fp == NULL || fwrite(cp, sizeof(Checkpoint), 1, fp) != 1)
+    {
+        printf("Can not write the checkpoint %s XD\n", tmp);
+        if (fp != NULL)
+            fclose(fp);
+        return;
+    }
+    fclose(fp);
+
+#ifdef _WIN32
+    remove(path);  // Windows的rename不会替换已有文件
+#endif
+    rename(tmp, path);
+}
+
+// 加载搜索的检查点 并恢复随机数生成器
+// 设置了checkpointResume且文件的kind, bitLen和times相同则返回1
+int LoadCheckpoint(int kind, int bitLen, int times, Checkpoint* cp)
+{
+    int ok;
+    char* path = GetCheckpointPath();
+    FILE* fp;
+
+    if (path == NULL || !checkpointResume)
+        return 0;
+
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+        return 0;
+
+    ok = fread(cp, sizeof(Checkpoint), 1, fp) == 1 && cp->magic == CHECKPOINT_MAGIC &&
+         cp->size == sizeof(Checkpoint) && cp->kind == kind && cp->bitLen == bitLen && cp->times == times;
+    fclose(fp);
+
+    if (ok)
+    {
+        *GetThreadRng() = cp->rng;
+        PrintProgress("resume from number[%lld]\n", cp->tested + 1);
+    }
+
+    return ok;
+}
+
+// 搜索结束 删除检查点文件
+void ClearCheckpoint()
+{
+    char* path = GetCheckpointPath();
+
+    if (path != NULL)
+        remove(path);
+}
+
+// 把GenPrime和GenRandomPrime的状态保存到文件，path: NULL表示没有检查点
+// resume: 1表示文件中是同一个搜索时从检查点继续
+// interval: 两次检查点之间的秒数
+void SetCheckpoint(char* path, int resume, int interval)
+{
+    checkpointPath = path;
+    checkpointResume = resume;
+    checkpointInterval = interval;
+}
+
+// 解除素数缓存文件的映射
+// 调用时不能有线程在GenPrime或GenSafePrime中
+void ClosePrimeCache()
+{
+    if (primeCache == NULL)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(primeCache);
+#else
+    munmap(primeCache, sizeof(PrimeCache));
+#endif
+    MutexFree(&primeCacheLock);
+    primeCache = NULL;
+}
+
+// 打开GenPrime和GenSafePrime的素数缓存文件，不存在则创建
+// 文件映射到内存，所以一次查找只读一个条目的页
+// 其他编译版本的文件会被清空，键不对的条目也一样
+// 调用时不能有线程在GenPrime或GenSafePrime中
+// 文件无法打开时返回0
+int OpenPrimeCache(char* path)
+{
+    int i, k;
+    PrimeCache* pc;
+    PrimeCacheEntry* e;
+#ifdef _WIN32
+    HANDLE file, map;
+
+    file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                       NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return 0;
+
+    // 文件被扩展到映射的大小
+    map = CreateFileMappingA(file, NULL, PAGE_READWRITE, 0, sizeof(PrimeCache), NULL);
+    CloseHandle(file);
+    if (map == NULL)
+        return 0;
+
+    pc = (PrimeCache*)MapViewOfFile(map, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(PrimeCache));
+    CloseHandle(map);
+    if (pc == NULL)
+        return 0;
+#else
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0)
+        return 0;
+
+    if (ftruncate(fd, sizeof(PrimeCache)) != 0)
+    {
+        close(fd);
+        return 0;
+    }
+
+    pc = (PrimeCache*)mmap(NULL, sizeof(PrimeCache), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (pc == MAP_FAILED)
+        return 0;
+#endif
+
+    if (pc->magic != PRIME_CACHE_MAGIC || pc->size != sizeof(PrimeCacheEntry) || pc->bitLen != BIG_INT_BIT_LEN)
+    {
+        memset(pc, 0, sizeof(PrimeCache));
+        pc->size = sizeof(PrimeCacheEntry);
+        pc->bitLen = BIG_INT_BIT_LEN;
+        pc->magic = PRIME_CACHE_MAGIC;
+    }
+
+    for (k = 0; k < PRIME_CACHE_MODES; k++)
+    {
+        for (i = 0; i < BIG_INT_BIT_LEN; i++)
+        {
+            e = &pc->entry[k][i];
+            if (e->ready && (e->bitLen != i || e->mode != k))
+                e->ready = 0;
+        }
+    }
+
+    ClosePrimeCache();
+    MutexInit(&primeCacheLock);
+    primeCache = pc;
+
+    return 1;
+}
+
+// times轮Miller-Rabin测试，64位数则用确定性测试
+int DoCheckPrime(BigInt* n, int bitLen, int times)
+{
+    Limb t[MAX_LIMBS];
+
+    if (bitLen > 63)
+        return DoMillerRabin(n, times);
+
+    BigIntToLimbs(n, t);
+
+    return MillerRabin64(t[0]);
+}
+
+// 取出bitLen和mode的缓存素数到result
+// 文件可能损坏或被改动，所以命中时总要运行一轮，如果它通过的轮数
+// 少于 times 就运行剩下的轮，然后条目保存新的 times
+// 未缓存或检查失败则返回NULL，此时条目被丢弃并重新搜索
+BigInt* GetCachedPrime(int bitLen, int mode, int times, BigInt* result)
+{
+    int ok, rounds = 0;
+    Limb p[MAX_LIMBS];
+    PrimeCacheEntry* e;
+    BigInt q;
+
+    if (primeCache == NULL || bitLen < 2 || bitLen >= BIG_INT_BIT_LEN - 1)
+        return NULL;
+
+    // 在锁内复制，这样没有其他线程在写它
+    e = &primeCache->entry[mode][bitLen];
+    MutexLock(&primeCacheLock);
+    if (LOAD_ACQUIRE(&e->ready))
+    {
+        memcpy(p, e->p, sizeof(p));
+        rounds = times - e->times > 1 ? times - e->times : 1;
+    }
+    ok = e->ready;
+    MutexUnlock(&primeCacheLock);
+
+    if (!ok)
+        return NULL;
+
+    LimbsToBigInt(p, MAX_LIMBS, result);
+    ok = GetTrueValueLen(result) == bitLen && DoCheckPrime(result, bitLen, rounds);
+
+    if (ok && mode == PRIME_CACHE_SAFE_PRIME)
+    {
+        ShiftArithmeticRight(result, 1, &q);  // q = (p - 1) / 2
+        ok = DoCheckPrime(&q, bitLen - 1, rounds);
+    }
+
+    // 条目可能已被其他线程重新填写，只修改这个素数的
+    MutexLock(&primeCacheLock);
+    if (e->ready && memcmp(e->p, p, sizeof(p)) == 0)
+    {
+        if (!ok)
+            e->ready = 0;  // 丢弃它，重新搜索
+        else if (times > e->times)
+            e->times = times;
+    }
+    MutexUnlock(&primeCacheLock);
+
+    return ok ? result : NULL;
+}
+
+// 把已通过times轮的bitLen和mode的素数p存入缓存
+// 各线程在锁内写，ready在其他字段之前清除，之后设置
+// 均用release写，所以被杀死时不会留下设置了ready的半个条目
+void PutCachedPrime(int bitLen, int mode, int times, BigInt* p)
+{
+    Limb x[MAX_LIMBS];
+    PrimeCacheEntry* e;
+
+    if (primeCache == NULL || bitLen < 2 || bitLen >= BIG_INT_BIT_LEN - 1)
+        return;
+
+    BigIntToLimbs(p, x);
+    e = &primeCache->entry[mode][bitLen];
+    MutexLock(&primeCacheLock);
+
+    if (e->ready && memcmp(e->p, x, sizeof(x)) == 0)
+    {
+        if (times > e->times)
+            e->times = times;
+
+        MutexUnlock(&primeCacheLock);
+        return;
+    }
+
+    e->ready = 0;
+    FENCE_RELEASE();
+    e->bitLen = bitLen;
+    e->mode = mode;
+    e->times = times;
+    memcpy(e->p, x, sizeof(x));
+    STORE_RELEASE(&e->ready, 1);
+
+    MutexUnlock(&primeCacheLock);
+}
+
+// 生成指定位数和MillerRabin测试次数的"素数"
+// 搜索状态由SetCheckpoint保存 重启后可以继续
+// 结果保存在OpenPrimeCache的素数缓存中，下次调用直接从那里取出
+// 在 GenPrimeTask 中被停止，或 bitLen 超出 BigInt 时返回 NULL，后者会设置 ERROR_OVERFLOW
+BigInt* DoGenPrime(int bitLen, int times, BigInt* result)
+{
+    int i;
+    unsigned long n = 1;
+    unsigned long a, b;
+    Checkpoint cp;
+
+    if (bitLen > SIGN_BIT)
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    if (GetCachedPrime(bitLen, PRIME_CACHE_GEN_PRIME, times, result))
+    {
+        PrintProgress("found in the prime cache\n\n");
+        return result;
+    }
+
+    memset(result->bit, 0, BIG_INT_BIT_LEN);
+    for (i = 0; i < bitLen; i++)
+        result->bit[i] = 1;
+
+    if (LoadCheckpoint(CHECKPOINT_GEN_PRIME, bitLen, times, &cp))
+    {
+        LimbsToBigInt(cp.cand, MAX_LIMBS, result);
+        n = (unsigned long)cp.tested + 1;
+    }
+
+    cp.kind = CHECKPOINT_GEN_PRIME;
+    cp.bitLen = bitLen;
+    cp.times = times;
+
+    while (1)
+    {
+        if (TaskStopped())
+            return NULL;
+
+        cp.tested = n - 1;
+        SaveCheckpoint(&cp, result);
+
+        PrintProgress("testing number[%ld]...\n", n);
+        a = time(0);
+
+        // Lucas-Lehmer 对 2^bitLen - 1 给出确定的结论
+        if (n == 1 && 2 * bitLen < SIGN_BIT ?
+            LucasLehmer(bitLen) : DoMillerRabin(result, times))
+        {
+            b = time(0);
+            break;
+        }
+
+        b = time(0);
+        PrintProgress("finish test number %ld (t=%lds)\n\n", n++, b - a);
+        TaskProgress(1);
+
+        DoSub(result, &bigTwo, result);  // result = result - 2
+    }
+
+    ClearCheckpoint();
+    PutCachedPrime(bitLen, PRIME_CACHE_GEN_PRIME, times, result);
+    PrintProgress("finish test number[%ld] (t=%lds)\n\n", n, b - a);
+
+    return result;
+}
+
+// 在上下文 ctx 中运行 DoGenPrime，它调用的函数也从 ctx 中取状态
+BigInt* DoGenPrimeCtx(int bitLen, int times, BigInt* result, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+    BigInt* r = DoGenPrime(bitLen, times, result);
+
+    UseContext(old);
+
+    return r;
+}
+
+char* GenPrime(int bitLen, int times, char* result)
+{
+    BigInt n;
+
+    ClearError();
+
+    return ResultToStr(DoGenPrime(bitLen, times, &n), result);
+}
+
+// 把表中的数写入fp，每行perLine个，hex为1时用十六进制
+void WriteTable(FILE* fp, char* decl, Limb* v, int n, int perLine, int hex)
+{
+    int i;
+
+    fprintf(fp, "%s = {\n", decl);
+
+    for (i = 0; i < n; i++)
+    {
+        if (i % perLine == 0)
+            fprintf(fp, "    ");
+
+        if (hex)
+            fprintf(fp, "0x%016llxULL", v[i]);
+        else
+            fprintf(fp, "%llu", v[i]);
+
+        if (i + 1 < n)
+            fprintf(fp, (i + 1) % perLine == 0 ? ",\n" : ", ");
+    }
+
+    fprintf(fp, "\n};\n\n");
+}
+
+// 把小素数的表写入头文件path，编译时包含它
+// 用埃拉托斯特尼筛得到小于SMALL_PRIME_BOUND的奇素数，它们模2^64的逆
+// 和试除用的(2^64 - 1) / p，以及积在一个字内的素数分组
+// 文件无法写入时返回0
+int GenPrimeTable(char* path)
+{
+    int i, k, g = 0, num = 0;
+    unsigned long j, m;
+    Limb p, inv, prod = 1;
+    static char composite[SMALL_PRIME_BOUND];
+    static Limb prime[SMALL_PRIME_NUM], primeInv[SMALL_PRIME_NUM], primeLim[SMALL_PRIME_NUM];
+    static Limb product[SMALL_PRIME_NUM], first[SMALL_PRIME_NUM + 1];
+    FILE* fp;
+
+    for (j = 3; j < SMALL_PRIME_BOUND; j += 2)
+    {
+        if (composite[j])
+            continue;
+
+        for (m = j * j; m < SMALL_PRIME_BOUND; m += 2 * j)
+            composite[m] = 1;
+
+        prime[num++] = j;
+    }
+
+    first[0] = 0;
+    for (k = 0; k < num; k++)
+    {
+        p = prime[k];
+
+        // 牛顿迭代，每步使p^-1 mod 2^64的正确位数加倍
+        for (inv = p, i = 0; i < 5; i++)
+            inv *= 2 - p * inv;
+
+        primeInv[k] = inv;
+        primeLim[k] = ~(Limb)0 / p;
+
+        if (prod > ~(Limb)0 / p)
+        {
+            product[g++] = prod;
+            first[g] = k;
+            prod = 1;
+        }
+
+        prod *= p;
+    }
+
+    product[g++] = prod;
+    first[g] = num;
+
+    fp = fopen(path, "w");
+    if (fp == NULL)
+        return 0;
+
+    fprintf(fp, "// generated by GenPrimeTable, run the program with -t file to write it again, do not edit\n");
+    fprintf(fp, "// odd primes less than SMALL_PRIME_BOUND, their inverses mod 2^64 and (2^64 - 1) / p,\n");
+    fprintf(fp, "// and the groups of the trial division with their product in a word\n\n");
+    fprintf(fp, "#if SMALL_PRIME_NUM != %d\n#error the table is of another SMALL_PRIME_BOUND\n#endif\n\n", num);
+    fprintf(fp, "#define TRIAL_GROUP_NUM %d  // count of the groups of the trial division\n\n", g);
+
+    WriteTable(fp, "const unsigned int smallPrime[SMALL_PRIME_NUM]", prime, num, 16, 0);
+    WriteTable(fp, "const Limb trialInv[SMALL_PRIME_NUM]", primeInv, num, 4, 1);
+    WriteTable(fp, "const Limb trialLim[SMALL_PRIME_NUM]", primeLim, num, 4, 1);
+    WriteTable(fp, "const Limb trialProduct[TRIAL_GROUP_NUM]", product, g, 4, 1);
+    WriteTable(fp, "const int trialFirst[TRIAL_GROUP_NUM + 1]", first, g + 1, 16, 0);
+
+    return fclose(fp) == 0;
+}
+
+// 把小于2^32的素数轮位图写入文件，供OpenPrimeBitmap使用
+// 如果30i + wheelResidue[k]是素数，第i字节的第k位为1, 2, 3和5不在其中
+// 小素数的倍数p * q, q = wheelResidue[k] (mod 30)，相隔30p,
+// 所以它们相隔p字节且是同一位，一段在L1缓存中筛
+// 文件无法写入时返回0
+int GenPrimeBitmap(char* path)
+{
+    int i, k;
+    unsigned int p, q, header[PRIME_BITMAP_HEADER / 4];
+    unsigned long long lo, m, byte, start, end;
+    unsigned char mask;
+    static unsigned char seg[PRIME_BITMAP_SEGMENT];
+    FILE* fp;
+
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+        return 0;
+
+    memset(header, 0, sizeof(header));
+    header[0] = PRIME_BITMAP_MAGIC;
+    header[1] = PRIME_BITMAP_BYTES;
+    fwrite(header, sizeof(header), 1, fp);
+
+    for (start = 0; start < PRIME_BITMAP_BYTES; start = end)
+    {
+        end = start + PRIME_BITMAP_SEGMENT;
+        if (end > PRIME_BITMAP_BYTES)
+            end = PRIME_BITMAP_BYTES;
+
+        memset(seg, 0xff, PRIME_BITMAP_SEGMENT);
+        if (start == 0)
+            seg[0] &= ~wheelBit[1];  // 1不是素数
+
+        lo = start * 30;
+
+        // 不超过2^16的素数覆盖2^32, 3和5已经不在轮中
+        for (i = 2; i < SMALL_PRIME_NUM; i++)
+        {
+            p = smallPrime[i];
+            if ((unsigned long long)p * p >= end * 30)
+                break;
+
+            for (k = 0; k < 8; k++)
+            {
+                // 第一个q = wheelResidue[k] (mod 30)，且q >= p, p * q >= lo
+                q = (unsigned int)((lo + p - 1) / p);
+                if (q < p)
+                    q = p;
+                q += (wheelResidue[k] + 30 - q % 30) % 30;
+
+                m = (unsigned long long)p * q;
+                mask = (unsigned char)~wheelBit[m % 30];
+
+                for (byte = m / 30; byte < end; byte += p)
+                    seg[byte - start] &= mask;
+            }
+        }
+
+        if (fwrite(seg, (size_t)(end - start), 1, fp) != 1)
+        {
+            fclose(fp);
+            return 0;
+        }
+    }
+
+    return fclose(fp) == 0;
+}
+
+// 模一个小整数的实现，a 必须非负
+// 从最高位开始每次取 32 位，因此只需要
+// BIG_INT_BIT_LEN / 32 次字除法
+unsigned int DoModSmall(BigInt* a, unsigned int m)
+{
+    int i, j, len;
+    unsigned long long r = 0, w;
+
+    len = GetTrueValueLen(a);
+
+    for (i = (len - 1) / 32 * 32; i >= 0; i -= 32)
+    {
+        for (w = 0, j = i + 31; j >= i; j--)
+            w = w << 1 | a->bit[j];
+
+        r = (r << 32 | w) % m;
+    }
+
+    return (unsigned int)r;
+}
+
+// 两个小整数的最大公约数
+unsigned long GcdSmall(unsigned long a, unsigned long b)
+{
+    unsigned long t;
+
+    while (b)
+    {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+// 标记窗口中有小素因子的候选数
+// x = base + 2i * dir, r = base % p
+// x = 0 (mod p)       =>  i = -r * dir / 2 (mod p)
+// 2x + 1 = 0 (mod p)  =>  i = -(2r + 1) * dir / 4 (mod p)
+// 如果设置了 e，gcd(x - 1, e) != 1 的候选数也被标记
+void DoSieveFill(Sieve* sv)
+{
+    int k;
+    unsigned long i, p, r, inv2, inv4, step;
+
+    memset(sv->composite, 0, SIEVE_WINDOW);
+
+    for (k = 0; k < sv->primeNum; k++)
+    {
+        p = smallPrime[k];
+        r = sv->residue[k];
+        inv2 = (p + 1) / 2;  // 2^-1 mod p
+
+        i = (sv->dir > 0 ? (p - r) % p : r) * inv2 % p;
+        for (; i < SIEVE_WINDOW; i += p)
+            sv->composite[i] = 1;
+
+        if (sv->safe)
+        {
+            inv4 = inv2 * inv2 % p;  // 4^-1 mod p
+            r = (2 * r + 1) % p;
+
+            i = (sv->dir > 0 ? (p - r) % p : r) * inv4 % p;
+            for (; i < SIEVE_WINDOW; i += p)
+                sv->composite[i] = 1;
+        }
+    }
+
+    if (sv->e)
+    {
+        r = (sv->eResidue + sv->e - 1) % sv->e;  // r = (x - 1) % e
+        step = sv->dir > 0 ? 2 % sv->e : sv->e - 2 % sv->e;
+
+        for (i = 0; i < SIEVE_WINDOW; i++, r = (r + step) % sv->e)
+        {
+            if (!sv->composite[i] && GcdSmall(r, sv->e) != 1)
+                sv->composite[i] = 1;
+        }
+    }
+}
+
+// 以奇数 base 初始化筛窗口
+// dir: 1 表示向上，-1 表示向下，safe: 为 1 时同时筛 2x+1
+// e: 0 或小于 2^31 的奇数 RSA 指数，此时也筛 gcd(x - 1, e) = 1
+// 只用小于 minPrime 的小素数，这样候选数
+// 不会被它自己筛掉
+void DoSieveInit(Sieve* sv, BigInt* base, int dir, int safe, unsigned int e, unsigned long minPrime)
+{
+    int k;
+
+    CopyBigInt(base, &sv->base);
+    sv->dir = dir;
+    sv->safe = safe;
+    sv->e = e;
+    sv->eResidue = e ? DoModSmall(base, e) : 0;
+
+    for (k = 0; k < SMALL_PRIME_NUM && smallPrime[k] < minPrime; k++)
+        sv->residue[k] = DoModSmall(base, smallPrime[k]);
+
+    sv->primeNum = k;
+
+    DoSieveFill(sv);
+}
+
+// 把筛子向前移动 count 个窗口，只为最后的窗口筛一次
+// 余数增量更新，不需要 BigInt 除法
+// 新窗口超出 BigInt 的范围时返回 0，筛子不移动
+int DoSieveSkip(Sieve* sv, int count)
+{
+    int k;
+    unsigned long p, step = 2UL * SIEVE_WINDOW * count;
+    BigInt t, w, limit;
+
+    LongToBigInt((long)step * sv->dir, &t);
+    LongToBigInt(2L * SIEVE_WINDOW * sv->dir, &w);
+
+    // 向上时 limit = 最大的 BigInt - t - w，向下时 limit = 最小的 BigInt - t - w
+    memset(limit.bit, sv->dir > 0, SIGN_BIT);
+    limit.bit[SIGN_BIT] = sv->dir > 0 ? POSITIVE : NEGATIVE;
+    DoSub(&limit, &t, &limit);
+    DoSub(&limit, &w, &limit);
+
+    if (DoCompare(&sv->base, &limit) * sv->dir > 0)
+        return 0;
+
+    DoAdd(&sv->base, &t, &sv->base);  // base = base + 2 * SIEVE_WINDOW * count * dir
+
+    for (k = 0; k < sv->primeNum; k++)
+    {
+        p = smallPrime[k];
+
+        if (sv->dir > 0)
+            sv->residue[k] = (sv->residue[k] + step % p) % p;
+        else
+            sv->residue[k] = (sv->residue[k] + p - step % p) % p;
+    }
+
+    if (sv->e)
+    {
+        p = sv->e;
+
+        if (sv->dir > 0)
+            sv->eResidue = (sv->eResidue + step % p) % p;
+        else
+            sv->eResidue = (sv->eResidue + p - step % p) % p;
+    }
+
+    DoSieveFill(sv);
+
+    return 1;
+}
+
+// 把筛移到下一个窗口
+// 下一个窗口超出 BigInt 的范围时返回 0，筛子不移动
+int DoSieveNext(Sieve* sv)
+{
+    return DoSieveSkip(sv, 1);
+}
+
+// 生成指定位数和MillerRabin测试次数的随机素数
+// 从最高两位为 1 的随机奇数开始
+// 向上搜索，只测试通过筛法的数
+// 并且通过以 2 为底的 Fermat 测试，该测试对一批候选数进行
+// 超过 bitLen 位时，从新的随机数重新开始
+// 搜索状态由SetCheckpoint保存 重启后可以继续
+// 在 GenPrimeTask 中被停止，或 bitLen 超出 BigInt 时返回 NULL，后者会设置 ERROR_OVERFLOW
+// 筛子窗口会越过 2^bitLen，所以 bitLen 必须小于 SIGN_BIT
+BigInt* DoGenRandomPrime(int bitLen, int times, BigInt* result)
+{
+    int i, k, num, over, resume;
+    unsigned long n = 1;
+    unsigned long a, b;
+    unsigned long minPrime;
+    char pass[FERMAT_BATCH];
+    BigInt t;
+    BigInt cand[FERMAT_BATCH];
+    Sieve sv;
+    Checkpoint cp;
+
+    if (bitLen >= SIGN_BIT)
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    // 所有候选数都不小于 2^(bitLen-1)
+    minPrime = bitLen > 32 ? 0xffffffffUL : 1UL << (bitLen - 1);
+
+    resume = LoadCheckpoint(CHECKPOINT_RANDOM_PRIME, bitLen, times, &cp);
+    cp.kind = CHECKPOINT_RANDOM_PRIME;
+    cp.bitLen = bitLen;
+    cp.times = times;
+
+    while (1)
+    {
+        if (resume)  // 筛从保存的批的第一个候选重新开始
+        {
+            LimbsToBigInt(cp.cand, MAX_LIMBS, &t);
+            n = (unsigned long)cp.tested + 1;
+            resume = 0;
+        }
+        else
+        {
+            DoGetOddRandBigInt(bitLen, &t);
+            if (bitLen > 1)
+                t.bit[bitLen - 2] = 1;  // 最高两位为 1
+        }
+        DoSieveInit(&sv, &t, 1, 0, 0, minPrime);
+        num = 0;
+
+        while (1)
+        {
+            for (i = 0; i < SIEVE_WINDOW; i++)
+            {
+                if (sv.composite[i])
+                    continue;
+
+                LongToBigInt(2 * i, &t);
+                DoAdd(&sv.base, &t, &cand[num]);  // cand = base + 2i
+
+                // 超出 bitLen 位，测试这一批中剩下的数
+                over = GetTrueValueLen(&cand[num]) > bitLen;
+                if (!over && ++num < FERMAT_BATCH)
+                    continue;
+
+                if (TaskStopped())
+                    return NULL;
+
+                if (num > 0)
+                {
+                    cp.tested = n - 1;
+                    SaveCheckpoint(&cp, &cand[0]);
+                }
+
+                // 一批数的 Fermat 测试在 AVX2 通道中运行
+                DoFermatTestBatch(cand, num, pass);
+
+                for (k = 0; k < num; k++)
+                {
+                    if (!pass[k])
+                        continue;
+
+                    PrintProgress("testing number[%ld]...\n", n);
+                    a = time(0);
+
+                    if (DoMillerRabin(&cand[k], times))
+                    {
+                        b = time(0);
+                        PrintProgress("finish test number[%ld] (t=%lds)\n\n", n, b - a);
+                        ClearCheckpoint();
+                        return CopyBigInt(&cand[k], result);
+                    }
+
+                    b = time(0);
+                    PrintProgress("finish test number %ld (t=%lds)\n\n", n++, b - a);
+                }
+
+                TaskProgress(num);
+                num = 0;
+
+                if (over)
+                    break;
+            }
+
+            if (i < SIEVE_WINDOW || !DoSieveNext(&sv))  // 超过 bitLen 位，重新开始
+                break;
+        }
+    }
+}
+
+// 在上下文 ctx 中运行 DoGenRandomPrime，随机数从它的生成器中取
+BigInt* DoGenRandomPrimeCtx(int bitLen, int times, BigInt* result, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+    BigInt* r = DoGenRandomPrime(bitLen, times, result);
+
+    UseContext(old);
+
+    return r;
+}
+
+char* GenRandomPrime(int bitLen, int times, char* result)
+{
+    BigInt n;
+
+    ClearError();
+
+    return ResultToStr(DoGenRandomPrime(bitLen, times, &n), result);
+}
+
+// 初始化start之后的素数迭代器，dir: 1向上，-1向下
+// 素数由DoPrimeIterNext逐个给出 筛窗口在调用之间保留
+// 所以遍历很多素数只需一遍筛
+void DoPrimeIterInit(PrimeIter* it, BigInt* start, int dir, int times)
+{
+    BigInt t, base, limit;
+
+    it->pos = 0;
+    it->times = times;
+    it->num = it->next = 0;
+    it->end = 0;
+
+    if (dir > 0)
+    {
+        LongToBigInt(2, &t);
+        it->two = DoCompare(start, &t) < 0;  // 2不在筛中
+
+        // 第一个窗口必须在 BigInt 的范围内，后面的窗口由 DoSieveNext 检查
+        memset(limit.bit, 1, SIGN_BIT);
+        limit.bit[SIGN_BIT] = POSITIVE;
+        DoSub(&limit, LongToBigInt(2 * SIEVE_WINDOW + 2, &t), &limit);
+        it->end = DoCompare(start, &limit) > 0;
+
+        if (it->two || it->end)
+            LongToBigInt(3, &base);
+        else
+            DoAdd(start, LongToBigInt(start->bit[0] ? 2 : 1, &t), &base);
+    }
+    else
+    {
+        LongToBigInt(2, &t);
+        it->two = DoCompare(start, &t) > 0;  // 2在奇素数之后
+
+        LongToBigInt(3, &t);
+        it->end = DoCompare(start, &t) <= 0;  // start以下没有奇数
+
+        if (it->end)
+            LongToBigInt(3, &base);
+        else
+            DoSub(start, LongToBigInt(start->bit[0] ? 2 : 1, &t), &base);
+    }
+
+    // 使用所有小素数 被自身标记的小素数会再检查
+    DoSieveInit(&it->sv, &base, dir, 0, 0, 0xffffffffUL);
+}
+
+// 用接下来通过筛的数填充迭代器的批
+// 小于2^64的数由MillerRabin64给出最终答案，pass = 2
+// 其他数成批做以2为底的Fermat测试 通过则 pass = 1
+void DoPrimeIterFill(PrimeIter* it)
+{
+    int i, k, big = 0;
+    Limb x[MAX_LIMBS];
+    BigInt t;
+
+    it->num = it->next = 0;
+
+    while (it->num < FERMAT_BATCH)
+    {
+        if (it->pos == SIEVE_WINDOW)
+        {
+            if (!DoSieveNext(&it->sv))  // 超出 BigInt 的范围
+            {
+                it->end = 1;
+                break;
+            }
+            it->pos = 0;
+        }
+
+        i = it->pos++;
+        LongToBigInt(2L * i * it->sv.dir, &t);
+        DoAdd(&it->sv.base, &t, &it->cand[it->num]);  // cand = base + 2i * dir
+
+        if (GetTrueValueLen(&it->cand[it->num]) > LIMB_BITS)
+        {
+            if (it->sv.composite[i])
+                continue;
+
+            it->pass[it->num++] = 1;
+            big++;
+            continue;
+        }
+
+        BigIntToLimbs(&it->cand[it->num], x);
+
+        if (it->sv.dir < 0 && x[0] < 3)
+        {
+            it->end = 1;
+            break;
+        }
+
+        if (it->sv.composite[i] && (x[0] >= SMALL_PRIME_BOUND || !IsSmallPrime((unsigned long)x[0])))
+            continue;
+
+        it->pass[it->num++] = MillerRabin64(x[0]) ? 2 : 0;
+    }
+
+    if (big == it->num)
+    {
+        DoFermatTestBatch(it->cand, it->num, it->pass);
+        return;
+    }
+
+    // 批跨过了2^64 逐个测试大的数
+    for (k = 0; k < it->num; k++)
+    {
+        if (it->pass[k] == 1)
+            DoFermatTestBatch(&it->cand[k], 1, &it->pass[k]);
+    }
+}
+
+// 取迭代器的下一个素数
+// 向下没有剩余的素数时返回 NULL，
+// 向上下一个素数超出 BigInt 的范围时也返回 NULL，并设置 ERROR_OVERFLOW
+BigInt* DoPrimeIterNext(PrimeIter* it, BigInt* result)
+{
+    int k;
+
+    if (it->two && it->sv.dir > 0)  // 向上时2是第一个素数
+    {
+        it->two = 0;
+        return LongToBigInt(2, result);
+    }
+
+    while (1)
+    {
+        while (it->next < it->num)
+        {
+            k = it->next++;
+
+            if (it->pass[k] == 2 || (it->pass[k] && DoMillerRabin(&it->cand[k], it->times)))
+                return CopyBigInt(&it->cand[k], result);
+        }
+
+        if (it->end)
+            break;
+
+        DoPrimeIterFill(it);
+    }
+
+    if (it->two)  // 向下时2是最后一个素数
+    {
+        it->two = 0;
+        return LongToBigInt(2, result);
+    }
+
+    if (it->sv.dir > 0)
+        SetError(ERROR_OVERFLOW);
+
+    return NULL;
+}
+
+// 大于x的最小素数
+BigInt* DoNextPrime(BigInt* x, int times, BigInt* result)
+{
+    PrimeIter it;
+
+    DoPrimeIterInit(&it, x, 1, times);
+
+    return DoPrimeIterNext(&it, result);
+}
+
+// 在上下文 ctx 中运行 DoNextPrime，它调用的函数也从 ctx 中取状态
+BigInt* DoNextPrimeCtx(BigInt* x, int times, BigInt* result, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+    BigInt* r = DoNextPrime(x, times, result);
+
+    UseContext(old);
+
+    return r;
+}
+
+// 小于x的最大素数 x <= 2时返回NULL
+BigInt* DoPrevPrime(BigInt* x, int times, BigInt* result)
+{
+    PrimeIter it;
+
+    DoPrimeIterInit(&it, x, -1, times);
+
+    return DoPrimeIterNext(&it, result);
+}
+
+// 素数超出 BigInt 的范围时返回 NULL
+char* NextPrime(char* x, int times, char* result)
+{
+    BigInt a, r;
+
+    ClearError();
+    StrToBigInt(x, &a);
+
+    return ResultToStr(DoNextPrime(&a, times, &r), result);
+}
+
+// x <= 2时返回NULL
+char* PrevPrime(char* x, int times, char* result)
+{
+    BigInt a, r;
+
+    ClearError();
+    StrToBigInt(x, &a);
+
+    return ResultToStr(DoPrevPrime(&a, times, &r), result);
+}
+
+// 生成指定位数和MillerRabin测试次数的安全素数 p = 2q + 1
+// random = 0: bitLen 位中最大的安全素数，和 DoGenPrime 一样
+// 从 2^bitLen - 1 开始向下搜索
+// random = 1: 和 DoGenRandomPrime 一样，从最高两位为 1 的随机数
+// 开始向上搜索
+// q 和 2q + 1 一起筛，然后在 Miller-Rabin 测试之前
+// 两者都必须通过便宜的以 2 为底的 Fermat 测试
+// 注意: bitLen 至少为 3
+// bitLen 超出 BigInt 时返回 NULL 并设置 ERROR_OVERFLOW，向上搜索时它必须小于 SIGN_BIT
+BigInt* DoGenSafePrime(int bitLen, int times, int random, BigInt* result)
+{
+    int i, k, num, over, dir = random ? 1 : -1;
+    unsigned long n = 1;
+    unsigned long a, b;
+    unsigned long minPrime;
+    char pass[FERMAT_BATCH];
+    BigInt q, t;
+    BigInt cand[FERMAT_BATCH];
+    Sieve sv;
+
+    if (bitLen > (random ? SIGN_BIT - 1 : SIGN_BIT))
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    if (!random && GetCachedPrime(bitLen, PRIME_CACHE_SAFE_PRIME, times, result))
+    {
+        PrintProgress("found in the prime cache\n\n");
+        return result;
+    }
+
+    // 所有 q 都不小于 2^(bitLen-2)
+    minPrime = bitLen > 33 ? 0xffffffffUL : 1UL << (bitLen - 2);
+
+    while (1)
+    {
+        if (random)
+        {
+            DoGetOddRandBigInt(bitLen - 1, &q);
+
+            // 2q + 1 的最高两位为 1
+            // 但小的安全素数太稀疏，4 位的就一个也没有
+            if (bitLen > 16)
+                q.bit[bitLen - 3] = 1;
+        }
+        else
+        {
+            memset(q.bit, 0, BIG_INT_BIT_LEN);
+            for (i = 0; i < bitLen - 1; i++)  // q = 2^(bitLen-1) - 1
+                q.bit[i] = 1;
+        }
+
+        DoSieveInit(&sv, &q, dir, 1, 0, minPrime);
+        num = 0;
+
+        while (1)
+        {
+            for (i = 0; i < SIEVE_WINDOW; i++)
+            {
+                if (sv.composite[i])
+                    continue;
+
+                LongToBigInt(2 * i * dir, &t);
+                DoAdd(&sv.base, &t, &cand[num]);  // cand = base + 2i * dir
+
+                // 超出 bitLen 位，测试这一批中剩下的数
+                over = GetTrueValueLen(&cand[num]) != bitLen - 1;
+                if (!over && ++num < FERMAT_BATCH)
+                    continue;
+
+                // 大部分候选数在这里就被排除
+                // 一批 q 的 Fermat 测试在 AVX2 通道中运行
+                DoFermatTestBatch(cand, num, pass);
+
+                for (k = 0; k < num; k++)
+                {
+                    if (!pass[k])
+                        continue;
+
+                    ShiftArithmeticLeft(&cand[k], 1, result);
+                    DoAdd(result, &bigOne, result);  // result = 2q + 1
+
+                    if (!DoFermatTest(result))
+                        continue;
+
+                    PrintProgress("testing number[%ld]...\n", n);
+                    a = time(0);
+
+                    if (DoMillerRabin(&cand[k], times) && DoMillerRabin(result, times))
+                    {
+                        b = time(0);
+                        PrintProgress("finish test number[%ld] (t=%lds)\n\n", n, b - a);
+
+                        if (!random)
+                            PutCachedPrime(bitLen, PRIME_CACHE_SAFE_PRIME, times, result);
+
+                        return result;
+                    }
+
+                    b = time(0);
+                    PrintProgress("finish test number %ld (t=%lds)\n\n", n++, b - a);
+                }
+
+                num = 0;
+
+                if (over)
+                    break;
+            }
+
+            if (i < SIEVE_WINDOW || !DoSieveNext(&sv))  // 超出 bitLen 位，重新开始
+                break;
+        }
+    }
+}
+
+char* GenSafePrime(int bitLen, int times, int random, char* result)
+{
+    BigInt n;
+
+    ClearError();
+
+    return ResultToStr(DoGenSafePrime(bitLen, times, random, &n), result);
+}
+
+#ifdef _WIN32
+typedef struct    // 新线程的函数和参数
+{
+    void* (*fn)(void*);
+    void* arg;
+}ThreadStartInfo;
+
+DWORD WINAPI ThreadEntry(LPVOID p)
+{
+    ThreadStartInfo info = *(ThreadStartInfo*)p;
+
+    free(p);
+    info.fn(info.arg);
+
+    return 0;
+}
+#endif
+
+// 在新线程中运行 fn(arg)，无法创建线程时返回 0
+int ThreadStart(Thread* t, void* (*fn)(void*), void* arg)
+{
+#ifdef _WIN32
+    ThreadStartInfo* info = (ThreadStartInfo*)malloc(sizeof(ThreadStartInfo));
+
+    if (info == NULL)
+        return 0;
+
+    info->fn = fn;
+    info->arg = arg;
+    *t = CreateThread(NULL, 0, ThreadEntry, info, 0, NULL);
+
+    if (*t == NULL)
+    {
+        free(info);
+        return 0;
+    }
+
+    return 1;
+#else
+    return pthread_create(t, NULL, fn, arg) == 0;
+#endif
+}
+
+// 等待线程结束
+void ThreadJoin(Thread t)
+{
+#ifdef _WIN32
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+#else
+    pthread_join(t, NULL);
+#endif
+}
+
+// 环形队列满或空时让其他线程运行
+void ThreadYield()
+{
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+// GenPrimeAsync 的线程函数
+void* GenPrimeThread(void* arg)
+{
+    GenPrimeTask* task = (GenPrimeTask*)arg;
+    BigInt* r;
+
+    // 各任务同时运行，一个检查点文件会被它们互相覆盖
+    GetContext()->noCheckpoint = 1;
+    threadTask = task;
+    if (task->random)
+        r = DoGenRandomPrime(task->bitLen, task->times, &task->result);
+    else
+        r = DoGenPrime(task->bitLen, task->times, &task->result);
+    threadTask = NULL;
+
+    MutexLock(&task->lock);
+    if (r != NULL)
+        task->state = GEN_TASK_FOUND;
+    else
+        task->state = task->cancel ? GEN_TASK_CANCELED : GEN_TASK_EXPIRED;
+    CondBroadcast(&task->finish);
+    MutexUnlock(&task->lock);
+
+    return NULL;
+}
+
+// 在新线程中启动 GenPrime (random = 0) 或 GenRandomPrime (random = 1)，并立即返回句柄
+// timeoutMs: 超过后搜索停止，0 表示没有截止时间
+// 每测试完一批候选数后在搜索线程中调用 progress(tested, arg)，可以为 NULL
+// GenPrimeCancel 或到期后搜索在一轮 Miller-Rabin 之内停止，它不保存检查点
+// bitLen 超出 BigInt 或无法创建线程时返回 NULL，句柄必须由 GenPrimeFree 释放
+GenPrimeTask* GenPrimeAsync(int bitLen, int times, int random, long long timeoutMs, GenPrimeProgress progress, void* arg)
+{
+    GenPrimeTask* task;
+
+    if (bitLen > (random ? SIGN_BIT - 1 : SIGN_BIT))
+        return NULL;
+
+    task = (GenPrimeTask*)calloc(1, sizeof(GenPrimeTask));
+    if (task == NULL)
+        return NULL;
+
+    task->bitLen = bitLen;
+    task->times = times;
+    task->random = random;
+    task->deadline = timeoutMs > 0 ? NowMs() + timeoutMs : 0;
+    task->state = GEN_TASK_RUNNING;
+    task->progress = progress;
+    task->arg = arg;
+    MutexInit(&task->lock);
+    CondInit(&task->finish);
+
+    if (!ThreadStart(&task->thread, GenPrimeThread, task))
+    {
+        CondFree(&task->finish);
+        MutexFree(&task->lock);
+        free(task);
+        return NULL;
+    }
+
+    return task;
+}
+
+// 请求停止搜索，GenPrimeWait 可知道何时已停止
+void GenPrimeCancel(GenPrimeTask* task)
+{
+    task->cancel = 1;
+}
+
+// 不等待，返回搜索的状态
+int GenPrimePoll(GenPrimeTask* task)
+{
+    int state;
+
+    MutexLock(&task->lock);
+    state = task->state;
+    MutexUnlock(&task->lock);
+
+    return state;
+}
+
+// 等待搜索结束，并返回其状态
+// 状态为 GEN_TASK_FOUND 时 result 得到素数，可以为 NULL
+int GenPrimeWait(GenPrimeTask* task, BigInt* result)
+{
+    int state;
+
+    MutexLock(&task->lock);
+    while (task->state == GEN_TASK_RUNNING)
+        CondWait(&task->finish, &task->lock);
+    state = task->state;
+    MutexUnlock(&task->lock);
+
+    if (state == GEN_TASK_FOUND && result != NULL)
+        CopyBigInt(&task->result, result);
+
+    return state;
+}
+
+// 若搜索仍在运行则取消，等待其线程并释放句柄
+void GenPrimeFree(GenPrimeTask* task)
+{
+    GenPrimeCancel(task);
+    GenPrimeWait(task, NULL);
+    ThreadJoin(task->thread);
+    CondFree(&task->finish);
+    MutexFree(&task->lock);
+    free(task);
+}
+
+// 生产者可用的空槽，满时返回 NULL
+INLINE PipeItem* PipeRingSlot(PipeRing* r)
+{
+    return r->tail - LOAD_ACQUIRE(&r->head) < PIPE_RING ? &r->item[r->tail % PIPE_RING] : NULL;
+}
+
+// 消费者的下一个元素，空时返回 NULL
+INLINE PipeItem* PipeRingPeek(PipeRing* r)
+{
+    return LOAD_ACQUIRE(&r->tail) != r->head ? &r->item[r->head % PIPE_RING] : NULL;
+}
+
+// 生产者 n 个环形队列中的一个空槽，从 *next 开始第一个不满的队列
+// 全部满时等待，这样慢的一级会拖住它前面的级
+// 由 PipePut 把元素交给消费者
+PipeItem* PipeSlot(PipeRing* ring, int n, int* next)
+{
+    int k;
+    PipeItem* x;
+
+    while (1)
+    {
+        for (k = 0; k < n; k++)
+        {
+            x = PipeRingSlot(&ring[(*next + k) % n]);
+            if (x != NULL)
+            {
+                *next = (*next + k) % n;
+                return x;
+            }
+        }
+
+        ThreadYield();
+    }
+}
+
+// 把 PipeSlot 的元素交给消费者，下一个元素放入下一个队列
+void PipePut(PipeRing* ring, int n, int* next)
+{
+    STORE_RELEASE(&ring[*next].tail, ring[*next].tail + 1);
+    *next = (*next + 1) % n;
+}
+
+// 消费者 n 个环形队列的下一个元素，队列 i 为 ring[i * stride]，从 *next 开始第一个有元素的队列
+// 全部空时等待，全部关闭且为空时返回 NULL
+// 由 PipeTake 把槽还给生产者
+PipeItem* PipePeek(PipeRing* ring, int n, int stride, int* next)
+{
+    int k, closed;
+    PipeRing* r;
+    PipeItem* x;
+
+    while (1)
+    {
+        for (closed = 0, k = 0; k < n; k++)
+        {
+            r = &ring[(*next + k) % n * stride];
+            x = PipeRingPeek(r);
+
+            // 在 closed 之前放入的元素会被第二次 peek 看到
+            if (x == NULL && LOAD_ACQUIRE(&r->closed))
+                x = PipeRingPeek(r);
+
+            if (x != NULL)
+            {
+                *next = (*next + k) % n;
+                return x;
+            }
+
+            closed += LOAD_ACQUIRE(&r->closed) != 0;
+        }
+
+        if (closed == n)
+            return NULL;
+
+        ThreadYield();
+    }
+}
+
+// 把 PipePeek 的槽还给生产者
+void PipeTake(PipeRing* ring, int stride, int* next)
+{
+    PipeRing* r = &ring[*next * stride];
+
+    STORE_RELEASE(&r->head, r->head + 1);
+}
+
+// 关闭生产者的 n 个环形队列
+void PipeClose(PipeRing* ring, int n)
+{
+    int k;
+
+    for (k = 0; k < n; k++)
+        STORE_RELEASE(&ring[k].closed, 1);
+}
+
+// 流水线的筛选级，线程 i 从 start 向下筛窗口 i, i + num[0], ...
+// 在已找到的最佳素数所在窗口之后停止
+void* PipeSieveThread(void* arg)
+{
+    PipeWorker* w = (PipeWorker*)arg;
+    Pipeline* pl = w->pl;
+    PipeRing* out = pl->ring[0] + w->index * pl->num[1];
+    PipeItem* x;
+    int i, next = 0;
+    long long win, seq;
+    BigInt t;
+    Sieve sv;
+
+    LongToBigInt(2L * SIEVE_WINDOW * w->index, &t);
+    DoSub(&pl->start, &t, &t);
+    DoSieveInit(&sv, &t, -1, 0, 0, pl->minPrime);
+
+    for (win = w->index; win * SIEVE_WINDOW < LOAD_ACQUIRE(&pl->best); win += pl->num[0])
+    {
+        for (i = 0; i < SIEVE_WINDOW; i++)
+        {
+            if (sv.composite[i])
+                continue;
+
+            seq = win * SIEVE_WINDOW + i;
+            if (seq > LOAD_ACQUIRE(&pl->best))
+                break;
+
+            x = PipeSlot(out, pl->num[1], &next);
+            x->seq = seq;
+            LongToBigInt(2 * i, &t);
+            DoSub(&sv.base, &t, &x->n);  // n = base - 2i
+            PipePut(out, pl->num[1], &next);
+        }
+
+        // 中间的窗口由其它线程筛
+        DoSieveSkip(&sv, pl->num[0]);
+    }
+
+    PipeClose(out, pl->num[1]);
+
+    return NULL;
+}
+
+// 流水线的过滤级，一批候选数一起做以 2 为底的 Fermat 测试，
+// 通过的进入确认级
+void* PipeFilterThread(void* arg)
+{
+    PipeWorker* w = (PipeWorker*)arg;
+    Pipeline* pl = w->pl;
+    PipeRing* in = pl->ring[0] + w->index;
+    PipeRing* out = pl->ring[1] + w->index * pl->num[2];
+    PipeItem* x;
+    int k, num, end = 0, nextIn = 0, nextOut = 0;
+    long long seq[FERMAT_BATCH];
+    char pass[FERMAT_BATCH];
+    BigInt cand[FERMAT_BATCH];
+
+    while (!end)
+    {
+        for (num = 0; num < FERMAT_BATCH; )
+        {
+            x = PipePeek(in, pl->num[0], pl->num[1], &nextIn);
+            if (x == NULL)
+            {
+                end = 1;
+                break;
+            }
+
+            // 最佳素数之后的候选数被丢弃
+            if (x->seq < LOAD_ACQUIRE(&pl->best))
+            {
+                seq[num] = x->seq;
+                CopyBigInt(&x->n, &cand[num++]);
+            }
+            PipeTake(in, pl->num[1], &nextIn);
+        }
+
+        if (num == 0)
+            continue;
+
+        DoFermatTestBatch(cand, num, pass);
+
+        for (k = 0; k < num; k++)
+        {
+            if (!pass[k])
+                continue;
+
+            x = PipeSlot(out, pl->num[2], &nextOut);
+            x->seq = seq[k];
+            CopyBigInt(&cand[k], &x->n);
+            PipePut(out, pl->num[2], &nextOut);
+        }
+    }
+
+    PipeClose(out, pl->num[2]);
+
+    return NULL;
+}
+
+// 流水线的确认级，完整的 Miller-Rabin 测试，保留 seq 最小的素数
+void* PipeConfirmThread(void* arg)
+{
+    PipeWorker* w = (PipeWorker*)arg;
+    Pipeline* pl = w->pl;
+    PipeRing* in = pl->ring[1] + w->index;
+    PipeItem* x;
+    int next = 0;
+
+    while ((x = PipePeek(in, pl->num[1], pl->num[2], &next)) != NULL)
+    {
+        if (x->seq < LOAD_ACQUIRE(&pl->best) && DoMillerRabin(&x->n, pl->times))
+        {
+            MutexLock(&pl->lock);
+            if (x->seq < pl->best)
+            {
+                CopyBigInt(&x->n, &pl->result);
+                STORE_RELEASE(&pl->best, x->seq);
+            }
+            MutexUnlock(&pl->lock);
+        }
+
+        PipeTake(in, pl->num[2], &next);
+    }
+
+    return NULL;
+}
+
+// 用 3 级流水线生成与 DoGenPrime 相同的素数，即 bitLen 位中最大的素数：
+// sieveNum 个线程向下筛奇数，filterNum 个线程成批做以 2 为底的 Fermat 测试，
+// confirmNum 个线程做 Miller-Rabin 测试
+// 各级由一个生产者一个消费者的有界环形队列连接，无锁，
+// 因此各级重叠运行，满的队列会拖住它前面的级
+// 一个素数之前的候选数都测试完时它就是答案，之后的候选数被丢弃
+// 没有检查点，素数缓存的用法与 DoGenPrime 相同
+// 流水线没有内存或线程时，在本线程改用 DoGenPrime
+// bitLen 超出 BigInt 时返回 NULL 并设置 ERROR_OVERFLOW
+BigInt* DoGenPrimePipeline(int bitLen, int times, int sieveNum, int filterNum, int confirmNum, BigInt* result)
+{
+    int i, k, n, found = 0, failed = 0;
+    int started[3] = {0, 0, 0};
+    Pipeline* pl;
+    PipeWorker w[3 * PIPE_MAX_THREADS];
+    Thread th[3 * PIPE_MAX_THREADS];
+    void* (*fn[3])(void*) = {PipeSieveThread, PipeFilterThread, PipeConfirmThread};
+
+    // 几个窗口就能覆盖 bitLen 位的所有数
+    if (bitLen < 24 || bitLen > SIGN_BIT)
+        return DoGenPrime(bitLen, times, result);
+
+    if (GetCachedPrime(bitLen, PRIME_CACHE_GEN_PRIME, times, result))
+        return result;
+
+    // 流水线没有内存时，DoGenPrime 给出同一个素数
+    pl = (Pipeline*)malloc(sizeof(Pipeline));
+    if (pl == NULL)
+        return DoGenPrime(bitLen, times, result);
+
+    pl->times = times;
+    pl->num[0] = sieveNum;
+    pl->num[1] = filterNum;
+    pl->num[2] = confirmNum;
+    for (k = 0; k < 3; k++)
+    {
+        if (pl->num[k] < 1)
+            pl->num[k] = 1;
+        if (pl->num[k] > PIPE_MAX_THREADS)
+            pl->num[k] = PIPE_MAX_THREADS;
+    }
+
+    pl->minPrime = bitLen > 32 ? 0xffffffffUL : 1UL << (bitLen - 1);
+    pl->best = PIPE_NONE;
+    pl->ring[0] = (PipeRing*)calloc(pl->num[0] * pl->num[1], sizeof(PipeRing));
+    pl->ring[1] = (PipeRing*)calloc(pl->num[1] * pl->num[2], sizeof(PipeRing));
+    if (pl->ring[0] == NULL || pl->ring[1] == NULL)
+    {
+        free(pl->ring[0]);
+        free(pl->ring[1]);
+        free(pl);
+        return DoGenPrime(bitLen, times, result);
+    }
+
+    memset(pl->start.bit, 0, BIG_INT_BIT_LEN);
+    for (i = 0; i < bitLen; i++)   // 全部置 1，最大的奇数
+        pl->start.bit[i] = 1;
+
+    // Lucas-Lehmer 对 2^bitLen - 1 给出确定的结论
+    if (2 * bitLen < SIGN_BIT)
+    {
+        if (LucasLehmer(bitLen))
+        {
+            CopyBigInt(&pl->start, &pl->result);
+            found = 1;
+        }
+        DoSub(&pl->start, &bigTwo, &pl->start);
+    }
+
+    MutexInit(&pl->lock);
+
+    // 消费者先于其生产者启动，这样已启动的线程不会等待未启动的阶段
+    for (n = 0, k = 2; !found && !failed && k >= 0; k--)
+    {
+        for (i = 0; i < pl->num[k]; i++)
+        {
+            w[n].pl = pl;
+            w[n].index = i;
+
+            if (!ThreadStart(&th[n], fn[k], &w[n]))
+            {
+                failed = 1;
+                break;
+            }
+            started[k]++;
+            n++;
+        }
+    }
+
+    // 有线程无法启动: 已启动的线程丢弃全部候选数，
+    // 未启动的生产者的环被关闭，这样它们都会结束
+    if (failed)
+    {
+        STORE_RELEASE(&pl->best, -1LL);
+        for (k = 0; k < 2; k++)
+        {
+            for (i = started[k]; i < pl->num[k]; i++)
+                PipeClose(pl->ring[k] + i * pl->num[k + 1], pl->num[k + 1]);
+        }
+    }
+
+    for (i = 0; i < n; i++)
+        ThreadJoin(th[i]);
+
+    if (!failed)
+    {
+        CopyBigInt(&pl->result, result);
+        PutCachedPrime(bitLen, PRIME_CACHE_GEN_PRIME, times, result);
+    }
+
+    MutexFree(&pl->lock);
+    free(pl->ring[0]);
+    free(pl->ring[1]);
+    free(pl);
+
+    // 在本线程由 DoGenPrime 给出同一个素数
+    if (failed)
+        return DoGenPrime(bitLen, times, result);
+
+    return result;
+}
+
+char* GenPrimePipeline(int bitLen, int times, int threadNum, char* result)
+{
+    BigInt n;
+
+    ClearError();
+
+    // 确认级是最慢的
+    return ResultToStr(DoGenPrimePipeline(bitLen, times, 1, 1, threadNum, &n), result);
+}
+
+// 测试一段中的大候选 cand[k]是素数则bits的第j位为1, j = idx[k]
+// 返回素数的个数
+int DoRangeTestBatch(BigInt* cand, int* idx, int num, int times, unsigned char* bits)
+{
+    int k, count = 0;
+    char pass[FERMAT_BATCH];
+
+    DoFermatTestBatch(cand, num, pass);
+
+    for (k = 0; k < num; k++)
+    {
+        if (pass[k] && DoMillerRabin(&cand[k], times))
+        {
+            bits[idx[k] / 8] |= 1 << (idx[k] % 8);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// 测试一段中小于2^64的候选 n[k]是素数则bits的第j位为1, j = idx[k]
+// 返回素数的个数
+int DoRangeTestBatch64(unsigned long long* n, int* idx, int num, unsigned char* bits)
+{
+    int k, count;
+    char prime[8 * MR64_LANES];
+
+    count = MillerRabin64Batch(n, num, prime);
+
+    for (k = 0; k < num; k++)
+    {
+        if (prime[k])
+            bits[idx[k] / 8] |= 1 << (idx[k] % 8);
+    }
+
+    return count;
+}
+
+// 筛并测试n个数 a + off, a + off + 1, ..., off是偶数
+// a + off + j 是素数则bits的第j位为1 返回素数的个数
+// 奇数的标记能放进L1缓存 a的余数是共享的
+// 所以一段不需要BigInt除法
+long long DoRangeSegment(RangeState* pr, unsigned long long off, int n, unsigned char* bits)
+{
+    int i, j, j0, k, m, num, small;
+    int idx[FERMAT_BATCH], idx64[8 * MR64_LANES];
+    unsigned long p, r;
+    unsigned long long x0, x, pp, n64[8 * MR64_LANES];
+    long long count = 0;
+    char composite[RANGE_SEGMENT / 2];
+    Limb t[MAX_LIMBS + 1];
+    BigInt cand[FERMAT_BATCH];
+
+    memset(bits, 0, (n + 7) / 8);
+
+    j0 = (pr->a[0] & 1) ? 0 : 1;  // x0 = a + off + j0 是第一个奇数
+    m = (n - j0 + 1) / 2;         // 奇数的个数，x = x0 + 2i
+    memset(composite, 0, m);
+
+    // 所有数都小于2^64则为1 此时x0是正确的
+    small = pr->len <= 1 && off + n <= ~pr->a[0];
+    x0 = pr->a[0] + off + j0;
+
+    if (small && pr->a[0] + off <= 2 && pr->a[0] + off + n > 2)  // 2不在筛中
+    {
+        j = (int)(2 - pr->a[0] - off);
+        bits[j / 8] |= 1 << (j % 8);
+        count++;
+    }
+
+    for (k = 0; k < SMALL_PRIME_NUM; k++)
+    {
+        p = smallPrime[k];
+        r = (pr->residue[k] + (off + j0) % p) % p;  // r = x0 % p
+        i = (int)((p - r) % p * ((p + 1) / 2) % p); // x0 + 2i = 0 (mod p)
+
+        // 小于p^2的倍数是p本身或有更小的因子
+        pp = (unsigned long long)p * p;
+        if (small && x0 < pp)
+        {
+            if ((pp - x0) / 2 >= (unsigned long long)m)
+                continue;
+            i = (int)((pp - x0) / 2);
+        }
+
+        for (; i < m; i += p)
+            composite[i] = 1;
+    }
+
+    for (num = 0, i = 0; i < m; i++)
+    {
+        if (composite[i])
+            continue;
+
+        j = j0 + 2 * i;
+
+        // 小于SMALL_PRIME_BOUND^2的幸存者都是素数 除了1
+        // 更大的小于2^64的数由MillerRabin64Batch在通道中测试
+        if (small)
+        {
+            x = x0 + 2 * i;
+            if (x >= (unsigned long long)SMALL_PRIME_BOUND * SMALL_PRIME_BOUND)
+            {
+                n64[num] = x;
+                idx64[num++] = j;
+            }
+            else if (x > 1)
+            {
+                bits[j / 8] |= 1 << (j % 8);
+                count++;
+            }
+
+            if (num == 8 * MR64_LANES)
+            {
+                count += DoRangeTestBatch64(n64, idx64, num, bits);
+                num = 0;
+            }
+            continue;
+        }
+
+        // cand = a + off + j
+        memcpy(t, pr->a, pr->len * sizeof(Limb));
+        t[pr->len] = 0;
+        x = off + j;
+        LimbsAddTo(t, pr->len + 1, &x, 1);
+        LimbsToBigInt(t, pr->len + 1, &cand[num]);
+        idx[num++] = j;
+
+        if (num == FERMAT_BATCH)
+        {
+            count += DoRangeTestBatch(cand, idx, num, pr->times, bits);
+            num = 0;
+        }
+    }
+
+    if (num > 0 && small)
+        count += DoRangeTestBatch64(n64, idx64, num, bits);
+    else if (num > 0)
+        count += DoRangeTestBatch(cand, idx, num, pr->times, bits);
+
+    return count;
+}
+
+// DoPrimeRange的线程函数 处理一轮中的第first, first + step, ...段
+void* PrimeRangeThread(void* arg)
+{
+    RangeTask* task = (RangeTask*)arg;
+    unsigned long long off;
+    int n;
+
+    task->count = 0;
+
+    for (off = task->origin + (unsigned long long)task->first * RANGE_SEGMENT; off < task->end;
+         off += (unsigned long long)task->step * RANGE_SEGMENT)
+    {
+        n = task->end - off < RANGE_SEGMENT ? (int)(task->end - off) : RANGE_SEGMENT;
+        task->count += DoRangeSegment(task->pr, off, n, task->bitmap + (off - task->origin) / 8);
+    }
+
+    return NULL;
+}
+
+// 用分段筛求[a, b]中的素数，0 <= a <= b, b - a < 2^62
+// 区间切成每轮threadNum * RANGE_ROUND段
+// 各线程轮流筛并测试一轮中的段
+// 然后按顺序对这一轮的每个素数调用cb(p, arg)
+// bitmap: NULL或(b - a) / 8 + 1个字节 a + i 是素数则第i位为1
+// cb 可以为 NULL，返回素数个数，b - a >= 2^62 时返回 -1 并设置 ERROR_RANGE,
+// 没有内存时设置 ERROR_MEMORY
+long long DoPrimeRange(BigInt* a, BigInt* b, int times, int threadNum, PrimeRangeCallback cb, void* arg,
+                       unsigned char* bitmap)
+{
+    int i, k, len, started[RANGE_MAX_THREADS];
+    unsigned long long origin, end, round;
+    long long count = 0;
+    Limb o, t[MAX_LIMBS + 1];
+    unsigned char* bits;
+    BigInt d, p;
+    RangeState* pr;
+    RangeTask task[RANGE_MAX_THREADS];
+    Thread th[RANGE_MAX_THREADS];
+
+    if (a->bit[SIGN_BIT] == NEGATIVE || DoCompare(a, b) > 0)
+        return 0;
+
+    if (threadNum < 1)
+        threadNum = 1;
+    if (threadNum > RANGE_MAX_THREADS)
+        threadNum = RANGE_MAX_THREADS;
+
+    DoSub(b, a, &d);  // d = b - a
+    if (GetTrueValueLen(&d) > 62)
+    {
+        SetError(ERROR_RANGE);
+        return -1;
+    }
+
+    pr = (RangeState*)malloc(sizeof(RangeState));
+    if (pr == NULL)
+    {
+        SetError(ERROR_MEMORY);
+        return -1;
+    }
+
+    memset(t, 0, sizeof(t));
+    BigIntToLimbs(&d, t);
+    pr->total = t[0] + 1;
+    pr->len = BigIntToLimbs(a, pr->a);
+    pr->times = times;
+
+    for (k = 0; k < SMALL_PRIME_NUM; k++)
+        pr->residue[k] = DoModSmall(a, smallPrime[k]);
+
+    round = (unsigned long long)threadNum * RANGE_ROUND * RANGE_SEGMENT;
+    bits = bitmap ? NULL : (unsigned char*)malloc(round / 8);
+    if (bitmap == NULL && bits == NULL)
+    {
+        free(pr);
+        SetError(ERROR_MEMORY);
+        return -1;
+    }
+
+    for (origin = 0; origin < pr->total; origin += round)
+    {
+        end = pr->total - origin < round ? pr->total : origin + round;
+
+        for (i = 0; i < threadNum; i++)
+        {
+            task[i].pr = pr;
+            task[i].origin = origin;
+            task[i].end = end;
+            task[i].first = i;
+            task[i].step = threadNum;
+            task[i].bitmap = bitmap ? bitmap + origin / 8 : bits;
+        }
+
+        // 0号线程是调用者线程
+        for (i = 1; i < threadNum; i++)
+            started[i] = ThreadStart(&th[i], PrimeRangeThread, &task[i]);
+
+        PrimeRangeThread(&task[0]);
+
+        for (i = 1; i < threadNum; i++)
+        {
+            if (started[i])
+                ThreadJoin(th[i]);
+            else
+                PrimeRangeThread(&task[i]);
+        }
+
+        for (i = 0; i < threadNum; i++)
+            count += task[i].count;
+
+        if (cb == NULL)
+            continue;
+
+        // 按顺序给出这一轮的素数
+        for (i = 0; i < (int)(end - origin); i++)
+        {
+            if ((task[0].bitmap[i / 8] >> (i % 8) & 1) == 0)
+                continue;
+
+            memcpy(t, pr->a, pr->len * sizeof(Limb));
+            t[pr->len] = 0;
+            len = pr->len + 1;
+            o = origin + i;
+            LimbsAddTo(t, len, &o, 1);              // p = a + origin + i
+            cb(LimbsToBigInt(t, len, &p), arg);
+        }
+    }
+
+    free(bits);
+    free(pr);
+
+    return count;
+}
+
+// 用 threadNum 个线程统计 [a, b] 中的素数，b - a >= 2^62 或没有内存时返回 -1
+long long PrimeRange(char* a, char* b, int times, int threadNum)
+{
+    BigInt x, y;
+
+    ClearError();
+    StrToBigInt(a, &x);
+    StrToBigInt(b, &y);
+
+    return DoPrimeRange(&x, &y, times, threadNum, NULL, NULL, NULL);
+}
+
+// 按指定位长和 Miller-Rabin 测试次数生成 RSA 用的随机素数
+// 最高两位为 1，因此满足 FIPS 186 要求的 p > sqrt(2) * 2^(bitLen-1)，
+// 并且两个这样的素数之积恰好有 2 * bitLen 位
+// 筛法去掉 p = 1 mod e 的数，对素数 e (如 65537) 这就是 gcd(p - 1, e) = 1,
+// 对其他 e, DoGenRsaKey 仍会检查 e 模 lambda 有逆元
+// 候选数在 Miller-Rabin 测试前须通过以 2 为底的 Fermat 测试
+// e 必须是奇数，不小于 3 且小于 2^31, bitLen 不小于 32
+// 不满足时返回 NULL 并设置 ERROR_ARGUMENT, bitLen 超出 BigInt 时设置 ERROR_OVERFLOW
+BigInt* DoGenRsaPrime(int bitLen, int times, unsigned int e, BigInt* result)
+{
+    int i, k, num, over;
+    unsigned long minPrime;
+    char pass[FERMAT_BATCH];
+    BigInt t;
+    BigInt cand[FERMAT_BATCH];
+    Sieve sv;
+
+    // e = 1 或 e 为偶数时，所有候选数都会被筛掉
+    if (bitLen < 32 || e < 3 || e % 2 == 0 || e > 0x7fffffffU)
+    {
+        SetError(ERROR_ARGUMENT);
+        return NULL;
+    }
+
+    if (bitLen > SIGN_BIT)
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    // 所有候选数都不小于 2^(bitLen-1)
+    minPrime = bitLen > 32 ? 0xffffffffUL : 1UL << (bitLen - 1);
+
+    while (1)
+    {
+        DoGetOddRandBigInt(bitLen, &t);
+        t.bit[bitLen - 2] = 1;  // 最高两位为 1
+        DoSieveInit(&sv, &t, 1, 0, e, minPrime);
+        num = 0;
+
+        while (1)
+        {
+            for (i = 0; i < SIEVE_WINDOW; i++)
+            {
+                if (sv.composite[i])
+                    continue;
+
+                LongToBigInt(2 * i, &t);
+                DoAdd(&sv.base, &t, &cand[num]);  // cand = base + 2i
+
+                // 超出 bitLen 位，测试这一批中剩下的数
+                over = GetTrueValueLen(&cand[num]) > bitLen;
+                if (!over && ++num < FERMAT_BATCH)
+                    continue;
+
+                // 一批数的 Fermat 测试在 AVX2 通道中运行
+                DoFermatTestBatch(cand, num, pass);
+
+                for (k = 0; k < num; k++)
+                {
+                    if (pass[k] && DoMillerRabin(&cand[k], times))
+                        return CopyBigInt(&cand[k], result);
+                }
+
+                num = 0;
+
+                if (over)
+                    break;
+            }
+
+            if (i < SIEVE_WINDOW || !DoSieveNext(&sv))  // 超过 bitLen 位，重新开始
+                break;
+        }
+    }
+}
+
+// DoGenRsaPrime 的线程函数
+void* RsaPrimeThread(void* arg)
+{
+    RsaPrimeTask* task = (RsaPrimeTask*)arg;
+
+    task->seeded = SeedSecureRand();
+    if (task->seeded)
+        DoGenRsaPrime(task->bitLen, task->times, task->e, &task->result);
+
+    return NULL;
+}
+
+// 按 n 的位长和 Miller-Rabin 测试次数生成 RSA 密钥对
+// e 必须是奇数，不小于 3 且小于 2^31, bitLen 必须是偶数且不小于 64
+// p 和 q 用 ChaCha20 安全随机数生成器并行生成，
+// 调用线程也切换到该生成器
+// as FIPS 186 requires, |p - q| > 2^(bitLen/2 - 100) and d > 2^(bitLen/2),
+// 否则重新生成
+// 在生成大密钥前，请确保宏定义 BIG_INT_BIT_LEN 足够大
+// bitLen 或 e 不被接受时返回 NULL 并设置 ERROR_ARGUMENT, n 超出 BigInt 时设置 ERROR_OVERFLOW,
+// 操作系统给不出 CSPRNG 所需的熵时设置 ERROR_ENTROPY
+RsaKey* DoGenRsaKey(int bitLen, int times, unsigned int e, RsaKey* key)
+{
+    int len, started;
+    Limb p[MAX_LIMBS], q[MAX_LIMBS], p1[MAX_LIMBS], q1[MAX_LIMBS];
+    Limb g[MAX_LIMBS], lambda[MAX_LIMBS], d[MAX_LIMBS], el[MAX_LIMBS] = {0};
+    Limb t[2 * MAX_LIMBS + 1], u[2 * MAX_LIMBS + 1];
+    RsaPrimeTask task;
+    Thread th;
+
+    // 奇数 bitLen 会得到 bitLen - 1 位的 n
+    if (bitLen < 64 || bitLen % 2 != 0 || e < 3 || e % 2 == 0 || e > 0x7fffffffU)
+    {
+        SetError(ERROR_ARGUMENT);
+        return NULL;
+    }
+
+    if (bitLen > SIGN_BIT)
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    len = (bitLen + LIMB_BITS - 1) / LIMB_BITS;  // n 的字数
+    el[0] = e;
+    if (!SeedSecureRand())
+        return NULL;
+
+    while (1)
+    {
+        // p 在新线程中生成，q 在当前线程中生成
+        task.bitLen = bitLen / 2;
+        task.times = times;
+        task.e = e;
+        started = ThreadStart(&th, RsaPrimeThread, &task);
+
+        DoGenRsaPrime(bitLen / 2, times, e, &key->q);
+
+        if (started)
+            ThreadJoin(th);
+        else
+            RsaPrimeThread(&task);
+
+        if (!task.seeded)
+        {
+            SetError(ERROR_ENTROPY);
+            return NULL;
+        }
+
+        BigIntToLimbs(&task.result, p);
+        BigIntToLimbs(&key->q, q);
+
+        // p > q
+        if (LimbsCompare(p, q, len) < 0)
+        {
+            memcpy(t, p, len * sizeof(Limb));
+            memcpy(p, q, len * sizeof(Limb));
+            memcpy(q, t, len * sizeof(Limb));
+        }
+
+        // |p - q| > 2^(bitLen/2 - 100)
+        LimbsSub(t, p, q, len);
+        if (bitLen / 2 > 100 && LimbsBitLen(t, len) <= bitLen / 2 - 99)
+            continue;
+
+        memcpy(p1, p, len * sizeof(Limb));
+        memcpy(q1, q, len * sizeof(Limb));
+        p1[0]--;  // p1 = p - 1，p 是奇数，所以没有借位
+        q1[0]--;  // q1 = q - 1
+
+        // lambda = lcm(p - 1, q - 1) = (p - 1) * (q - 1) / gcd(p - 1, q - 1)
+        LimbsGcd(p1, q1, len, g);
+        LimbsMul(t, p1, len, q1, len);
+        memset(u, 0, sizeof(u));
+        LimbsDivMod(t, LimbsLen(t, 2 * len), g, LimbsLen(g, len), u, g);
+        memcpy(lambda, u, len * sizeof(Limb));
+
+        // d = e^-1 mod lambda, d > 2^(bitLen/2)
+        if (!LimbsInverse(el, lambda, len, d) || LimbsBitLen(d, len) <= bitLen / 2)
+            continue;
+
+        break;
+    }
+
+    // n = p * q
+    LimbsMul(t, p, len, q, len);
+    LimbsToBigInt(t, len, &key->n);
+    LimbsToBigInt(el, len, &key->e);
+    LimbsToBigInt(d, len, &key->d);
+    LimbsToBigInt(p, len, &key->p);
+    LimbsToBigInt(q, len, &key->q);
+
+    // dp = d mod (p - 1), dq = d mod (q - 1)
+    LimbsDivMod(d, LimbsLen(d, len), p1, LimbsLen(p1, len), u, t);
+    LimbsToBigInt(t, LimbsLen(p1, len), &key->dp);
+    LimbsDivMod(d, LimbsLen(d, len), q1, LimbsLen(q1, len), u, t);
+    LimbsToBigInt(t, LimbsLen(q1, len), &key->dq);
+
+    // qInv = q^-1 mod p, q < p
+    LimbsInverse(q, p, len, t);
+    LimbsToBigInt(t, len, &key->qInv);
+
+    return key;
+}
+
+// 生成 e = RSA_E 的 RSA 密钥对，返回 n
+char* GenRsaKey(int bitLen, int times, char* n, char* d)
+{
+    RsaKey key;
+
+    ClearError();
+    if (DoGenRsaKey(bitLen, times, RSA_E, &key) == NULL)
+        return NULL;
+    BigIntToStr(&key.d, d);
+
+    return ResultToStr(&key.n, n);
+}
+
+#ifndef _WIN32
+// 运行从通道取出的一批任务，结果放在job->n
+// 快速: 64位is-prime一起用MillerRabin64Batch
+// 普通: 大数is-prime先试除再成批Fermat测试，next-prime逐个处理
+// slow: gen-prime
+void DaemonRunJobs(DaemonWorker* w, int lane, int num)
+{
+    int i, k, c = 0;
+    DaemonJob* job;
+    BigInt x, y;
+
+    if (lane == DAEMON_LANE_FAST)
+    {
+        for (i = 0; i < num; i++)
+            w->n64[i] = w->job[i]->len ? w->job[i]->n[0] : 0;
+
+        MillerRabin64Batch(w->n64, num, w->prime);
+
+        for (i = 0; i < num; i++)
+            w->job[i]->n[0] = w->prime[i];
+
+        return;
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        job = w->job[i];
+
+        if (job->msg.op == DAEMON_OP_GEN_PRIME)
+        {
+            if (job->msg.flags & 1)
+                DoGenRandomPrime(job->bitLen, job->msg.times, &y);
+            else
+                DoGenPrime(job->bitLen, job->msg.times, &y);
+
+            job->len = BigIntToLimbs(&y, job->n);
+        }
+        else if (job->msg.op == DAEMON_OP_NEXT_PRIME)
+        {
+            LimbsToBigInt(job->n, job->len, &x);
+            DoNextPrime(&x, job->msg.times, &y);
+            job->len = BigIntToLimbs(&y, job->n);
+        }
+        else if ((k = LimbsTrialDivision(job->n, job->len, TrialBound(LIMB_BITS * job->len))) >= 0)
+        {
+            job->n[0] = k;
+        }
+        else
+        {
+            w->candJob[c] = job;
+            LimbsToBigInt(job->n, job->len, &w->cand[c++]);
+        }
+    }
+
+    // 所有客户端的大数is-prime共享一个Fermat测试批
+    DoFermatTestBatch(w->cand, c, w->pass);
+
+    for (i = 0; i < c; i++)
+        w->candJob[i]->n[0] = w->pass[i] && DoMillerRabinCached(&w->cand[i], w->candJob[i]->msg.times);
+}
+
+// 守护进程的工作线程，从第一个有任务的通道取一批
+// 只有还有其他工作线程留给便宜通道时才取慢通道
+void* DaemonWorkerThread(void* arg)
+{
+    int i, lane, max, num;
+    DaemonWorker* w = (DaemonWorker*)arg;
+    Daemon* dm = w->dm;
+    DaemonJob* job;
+
+    // 各工作线程的生成同时运行，所以它们不共用检查点，
+    // 守护进程的标准输出也不用来打印它们的进度
+    GetContext()->quiet = 1;
+    GetContext()->noCheckpoint = 1;
+
+    while (1)
+    {
+        MutexLock(&dm->lock);
+
+        while (1)
+        {
+            if (dm->head[DAEMON_LANE_FAST] != NULL)
+                lane = DAEMON_LANE_FAST;
+            else if (dm->head[DAEMON_LANE_NORMAL] != NULL)
+                lane = DAEMON_LANE_NORMAL;
+            else if (dm->head[DAEMON_LANE_SLOW] != NULL && dm->slowBusy < dm->slowMax)
+                lane = DAEMON_LANE_SLOW;
+            else
+                lane = -1;
+
+            if (lane >= 0)
+                break;
+
+            CondWait(&dm->ready, &dm->lock);
+        }
+
+        max = lane == DAEMON_LANE_FAST ? 8 * MR64_LANES : lane == DAEMON_LANE_NORMAL ? FERMAT_BATCH : 1;
+        for (num = 0; num < max && dm->head[lane] != NULL; num++)
+        {
+            w->job[num] = dm->head[lane];
+            dm->head[lane] = dm->head[lane]->next;
+        }
+
+        if (lane == DAEMON_LANE_SLOW)
+            dm->slowBusy++;
+
+        MutexUnlock(&dm->lock);
+
+        DaemonRunJobs(w, lane, num);
+
+        MutexLock(&dm->lock);
+
+        if (lane == DAEMON_LANE_SLOW)
+        {
+            dm->slowBusy--;
+            CondBroadcast(&dm->ready);  // 等待的慢任务现在可以运行
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            job = w->job[i];
+            job->next = dm->done;
+            dm->done = job;
+        }
+
+        MutexUnlock(&dm->lock);
+
+        // 唤醒I/O线程，如果管道满了它已经醒着
+        if (write(dm->wake[1], "", 1) < 0 && errno != EAGAIN)
+            printf("Can not wake up the daemon XD\n");
+    }
+
+    return NULL;
+}
+
+// 关闭客户端的连接，它的任务的响应被丢弃
+void DaemonCloseClient(DaemonClient* c)
+{
+    close(c->fd);
+    free(c->out);
+    c->fd = -1;
+    c->serial++;
+    c->inLen = 0;
+    c->out = NULL;
+    c->outLen = c->outSize = 0;
+    c->pending = 0;
+}
+
+// 客户端未发送的响应或未应答的任务过多，在它们减少之前不读取其请求，
+// 这样只发送不读取的客户端不会让守护进程无限缓冲
+int DaemonBusy(DaemonClient* c)
+{
+    return c->outLen >= DAEMON_MAX_BACKLOG || c->pending >= DAEMON_MAX_PENDING;
+}
+
+// 尽量发送客户端的响应，直到套接字不再接收
+void DaemonFlush(DaemonClient* c)
+{
+    int n;
+
+    while (c->outLen > 0)
+    {
+        n = (int)send(c->fd, c->out, c->outLen, 0);
+        if (n < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                DaemonCloseClient(c);
+            return;
+        }
+
+        c->outLen -= n;
+        memmove(c->out, c->out + n, c->outLen);
+    }
+}
+
+// 把一个有len字节负载的响应加到客户端的响应中
+// 没有内存时关闭客户端并返回 0
+int DaemonReply(DaemonClient* c, DaemonMsg* msg, void* payload, int len)
+{
+    int size = c->outLen + (int)sizeof(DaemonMsg) + len;
+    unsigned char* out;
+
+    if (size > c->outSize)
+    {
+        out = (unsigned char*)realloc(c->out, size * 2);
+        if (out == NULL)
+        {
+            DaemonCloseClient(c);
+            return 0;
+        }
+        c->out = out;
+        c->outSize = size * 2;
+    }
+
+    msg->len = len;
+    memcpy(c->out + c->outLen, msg, sizeof(DaemonMsg));
+    if (len > 0)
+        memcpy(c->out + c->outLen + sizeof(DaemonMsg), payload, len);
+    c->outLen = size;
+
+    return 1;
+}
+
+// 把客户端的请求变成任务，错误的请求返回NULL
+// 负载: n为64位字，低字在前，gen-prime为32位的bitLen
+DaemonJob* DaemonParse(DaemonMsg* msg, unsigned char* payload, int* lane)
+{
+    int len;
+    unsigned int bitLen;
+    DaemonJob* job;
+
+    if (msg->op == DAEMON_OP_GEN_PRIME)
+    {
+        if (msg->len != sizeof(bitLen))
+            return NULL;
+
+        memcpy(&bitLen, payload, sizeof(bitLen));
+        if (bitLen < 8 || bitLen > DAEMON_MAX_BITS)
+            return NULL;
+
+        *lane = DAEMON_LANE_SLOW;
+    }
+    else if (msg->op == DAEMON_OP_IS_PRIME || msg->op == DAEMON_OP_NEXT_PRIME)
+    {
+        if (msg->len == 0 || msg->len % 8 != 0)
+            return NULL;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    job = (DaemonJob*)malloc(sizeof(DaemonJob));
+    if (job == NULL)
+    {
+        printf("Out of memory XD\n");
+        exit(1);
+    }
+
+    job->msg = *msg;
+    job->msg.flags &= 1;
+    if (job->msg.times == 0)
+        job->msg.times = 1;
+
+    if (msg->op == DAEMON_OP_GEN_PRIME)
+    {
+        job->bitLen = (int)bitLen;
+        job->len = 0;
+        return job;
+    }
+
+    job->len = len = (int)(msg->len / 8);
+    memcpy(job->n, payload, msg->len);
+    for (; len > 0 && job->n[len - 1] == 0; len--);
+    job->len = len;
+
+    // 给下一个素数留出空间
+    if (len > 0 && LIMB_BITS * (len - 1) + 64 > DAEMON_MAX_BITS)
+    {
+        free(job);
+        return NULL;
+    }
+
+    *lane = msg->op == DAEMON_OP_IS_PRIME && len <= 1 ? DAEMON_LANE_FAST : DAEMON_LANE_NORMAL;
+
+    return job;
+}
+
+// 读取客户端的请求，把任务放入通道
+// 返回入队的任务数
+int DaemonRead(Daemon* dm, DaemonClient* clients, int slot)
+{
+    int n, lane, num = 0, size;
+    DaemonClient* c = &clients[slot];
+    DaemonMsg msg;
+    DaemonJob* job;
+
+    n = (int)recv(c->fd, c->in + c->inLen, sizeof(c->in) - c->inLen, 0);
+    if (n <= 0)
+    {
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+            DaemonCloseClient(c);
+        return 0;
+    }
+
+    c->inLen += n;
+
+    while (c->inLen >= (int)sizeof(DaemonMsg))
+    {
+        memcpy(&msg, c->in, sizeof(DaemonMsg));
+
+        // 太大的请求无法安全跳过，所以关闭连接
+        if (msg.len > DAEMON_MAX_PAYLOAD)
+        {
+            DaemonCloseClient(c);
+            return num;
+        }
+
+        size = (int)(sizeof(DaemonMsg) + msg.len);
+        if (c->inLen < size)
+            break;
+
+        job = DaemonParse(&msg, c->in + sizeof(DaemonMsg), &lane);
+        if (job == NULL)
+        {
+            msg.flags = DAEMON_BAD_REQUEST;
+            if (!DaemonReply(c, &msg, NULL, 0))
+                return num;
+        }
+        else
+        {
+            job->client = slot;
+            job->serial = c->serial;
+            job->next = NULL;
+
+            MutexLock(&dm->lock);
+            if (dm->head[lane] == NULL)
+                dm->head[lane] = job;
+            else
+                dm->tail[lane]->next = job;
+            dm->tail[lane] = job;
+            MutexUnlock(&dm->lock);
+
+            c->pending++;
+            num++;
+        }
+
+        c->inLen -= size;
+        memmove(c->in, c->in + size, c->inLen);
+    }
+
+    return num;
+}
+
+// 把已完成任务的响应发给它们的客户端
+void DaemonDeliver(Daemon* dm, DaemonClient* clients)
+{
+    unsigned char verdict;
+    DaemonJob *job, *next;
+    DaemonClient* c;
+
+    MutexLock(&dm->lock);
+    job = dm->done;
+    dm->done = NULL;
+    MutexUnlock(&dm->lock);
+
+    for (; job != NULL; job = next)
+    {
+        next = job->next;
+        c = &clients[job->client];
+
+        if (c->fd >= 0 && c->serial == job->serial)
+        {
+            job->msg.flags = DAEMON_OK;
+            c->pending--;
+
+            if (job->msg.op == DAEMON_OP_IS_PRIME)
+            {
+                verdict = (unsigned char)job->n[0];
+                DaemonReply(c, &job->msg, &verdict, 1);
+            }
+            else
+            {
+                DaemonReply(c, &job->msg, job->n, job->len * 8);
+            }
+        }
+
+        free(job);
+    }
 }
 
-// 随机获取小于n的正整数
-BigInt* DoGetRand(BigInt* n, BigInt* result)
-{
-    int i;
-    static unsigned seed = 0;
-    BigInt t;
+// 在 Unix 域套接字 path 上用 threadNum 个工作线程(至少 2 个)运行守护进程，启动后不再返回
+// 请求是一个DaemonMsg和它的负载，响应可能乱序，用id匹配
+// 所有客户端的任务放入3个通道: 64位is-prime，大数is-prime和next-prime, gen-prime,
+// 工作线程从第一个有任务的通道取一批，所以便宜的检查不会排在生成素数后面，
+// 表和缓存在进程中保持热状态
+// 套接字无法打开时返回0
+int RunDaemon(char* path, int threadNum)
+{
+    int i, k, num, fd;
+    int slot[DAEMON_MAX_CLIENTS];
+    char buf[256];
+    struct sockaddr_un addr;
+    struct pollfd pfd[DAEMON_MAX_CLIENTS + 2];
+    static DaemonClient clients[DAEMON_MAX_CLIENTS];
+    static Daemon dm;
+    DaemonWorker* w;
+    Thread t;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+        return 0;
+
+    // 总要留一个工作线程给便宜的队列，所以至少有 2 个
+    if (threadNum < 2)
+        threadNum = 2;
+    if (threadNum > DAEMON_MAX_THREADS)
+        threadNum = DAEMON_MAX_THREADS;
+
+    signal(SIGPIPE, SIG_IGN);  // 关闭的客户端让send返回错误，而不是信号
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 64) != 0 ||
+        pipe(dm.wake) != 0)
+    {
+        if (fd >= 0)
+            close(fd);
+        return 0;
+    }
+
+    fcntl(dm.wake[0], F_SETFL, O_NONBLOCK);
+    fcntl(dm.wake[1], F_SETFL, O_NONBLOCK);
+
+    // 缓存没有内存时，守护进程不用缓存运行
+    if (verdictCacheSize == 0)
+        InitVerdictCache(DAEMON_VERDICT_CACHE);
+
+    MutexInit(&dm.lock);
+    CondInit(&dm.ready);
+    dm.slowMax = threadNum - 1;
+
+    for (i = 0; i < DAEMON_MAX_CLIENTS; i++)
+        clients[i].fd = -1;
+
+    for (i = 0; i < threadNum; i++)
+    {
+        w = (DaemonWorker*)malloc(sizeof(DaemonWorker));
+        if (w != NULL)
+            w->dm = &dm;
+
+        if (w == NULL || !ThreadStart(&t, DaemonWorkerThread, w))
+        {
+            printf("Can not start the workers of the daemon XD\n");
+            exit(1);
+        }
+    }
+
+    while (1)
+    {
+        pfd[0].fd = fd;
+        pfd[0].events = POLLIN;
+        pfd[1].fd = dm.wake[0];
+        pfd[1].events = POLLIN;
+
+        for (num = 2, i = 0; i < DAEMON_MAX_CLIENTS; i++)
+        {
+            if (clients[i].fd < 0)
+                continue;
+
+            pfd[num].fd = clients[i].fd;
+            pfd[num].events = (DaemonBusy(&clients[i]) ? 0 : POLLIN) | (clients[i].outLen > 0 ? POLLOUT : 0);
+            slot[num++] = i;
+        }
+
+        if (poll(pfd, num, -1) < 0)
+            continue;
+
+        if (pfd[0].revents & POLLIN)
+        {
+            k = accept(fd, NULL, NULL);
+            for (i = 0; k >= 0 && i < DAEMON_MAX_CLIENTS && clients[i].fd >= 0; i++);
+
+            if (k >= 0 && i < DAEMON_MAX_CLIENTS)
+            {
+                fcntl(k, F_SETFL, O_NONBLOCK);
+                clients[i].fd = k;
+            }
+            else if (k >= 0)
+            {
+                close(k);  // 客户端太多
+            }
+        }
+
+        for (k = 0, i = 2; i < num; i++)
+        {
+            // 忙的客户端不轮询 POLLIN，挂断仍会被读取以便关闭
+            if (pfd[i].revents & (POLLIN | POLLHUP | POLLERR))
+                k += DaemonRead(&dm, clients, slot[i]);
+        }
+
+        // 这一轮读到的任务由工作线程成批处理
+        if (k > 0)
+        {
+            MutexLock(&dm.lock);
+            CondBroadcast(&dm.ready);
+            MutexUnlock(&dm.lock);
+        }
+
+        if (pfd[1].revents & POLLIN)
+        {
+            while (read(dm.wake[0], buf, sizeof(buf)) > 0);
+            DaemonDeliver(&dm, clients);
+        }
 
-    srand(time(0) + seed++);
+        for (i = 0; i < DAEMON_MAX_CLIENTS; i++)
+        {
+            if (clients[i].fd >= 0 && clients[i].outLen > 0)
+                DaemonFlush(&clients[i]);
+        }
+    }
 
-    for (i = 0; i < SIGN_BIT; i++)
-        t.bit[i] = rand() % 2;
+    return 1;
+}
 
-    t.bit[SIGN_BIT] = 0;
+// 从套接字读 len 字节，若先被关闭或出错返回 0
+int SocketRead(int fd, void* buf, long long len)
+{
+    long long n;
 
-    DoMod(&t, n, &t);
-    if (IsZero(&t))
-        DoGetRand(n, &t);
+    for (; len > 0; len -= n, buf = (char*)buf + n)
+    {
+        n = read(fd, buf, len);
+        if (n <= 0 && !(n < 0 && errno == EINTR))
+            return 0;
+        if (n < 0)
+            n = 0;
+    }
 
-    return CopyBigInt(&t, result);
+    return 1;
 }
 
-char* GetRand(char* s, char* result)
+// 向套接字写 len 字节，若先被关闭或出错返回 0
+int SocketWrite(int fd, void* buf, long long len)
 {
-    BigInt a, b;
+    long long n;
 
-    StrToBigInt(s, &a);
-    DoGetRand(&a, &b);
+    for (; len > 0; len -= n, buf = (char*)buf + n)
+    {
+        n = write(fd, buf, len);
+        if (n <= 0 && !(n < 0 && errno == EINTR))
+            return 0;
+        if (n < 0)
+            n = 0;
+    }
 
-    return BigIntToStr(&b, result);
+    return 1;
 }
 
-int DoMillerRabin(BigInt* n, int times)
+// 在 Unix 域套接字 path 上运行 DoShardRange 协调者的工作进程
+// 逐个测试分配到的分片，协调者关闭套接字时返回
+// 无法连接时返回 0，没有内存时还设置 ERROR_MEMORY
+int RunShardWorker(char* path)
 {
-    int i, j, s;
-    BigInt a, t, x;
-    BigInt one, two, nMinusOne;
+    int fd;
+    unsigned char* bits;
+    struct sockaddr_un addr;
+    ShardMsg msg;
+    ShardResult res;
+    BigInt a, b, t;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+        return 0;
 
-    StrToBigInt("1", &one);      // one = 1
-    StrToBigInt("2", &two);
-    DoSub(n, &one, &nMinusOne);  // nMinusOne = n - 1
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
 
-    s = GetMaxRightShiftLen(&nMinusOne);      // 获取最大的右移长度
-    ShiftArithmeticRight(&nMinusOne, s, &t);  // 右移并保存到t中
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+    {
+        if (fd >= 0)
+            close(fd);
+        return 0;
+    }
 
-    for (i = 0; i < times; i++)    // 做times次测试
+    bits = (unsigned char*)malloc(SHARD_SIZE / 8);
+    if (bits == NULL)
     {
-        DoGetRand(n, &x);         // 获取小于n的随机数
-        DoPowMod(&x, &t, n, &a);  // a = x^t % n, 这里时间用得长
+        close(fd);
+        SetError(ERROR_MEMORY);
+        return 0;
+    }
 
-        if (DoCompare(&a, &one) == 0)
-            continue;
+    signal(SIGPIPE, SIG_IGN);  // 协调者关闭后 write 返回错误，而不是信号
 
-        for (j = 0; j < s; j++)
-        {
-            if (DoCompare(&a, &nMinusOne) == 0)
-                goto LOOP;
+    while (SocketRead(fd, &msg, sizeof(msg)) && msg.times > 0)
+    {
+        if (msg.size < 1 || msg.size > SHARD_SIZE)
+            break;
 
-            DoPowMod(&a, &two, n, &a);  // a = a^2 % n
-        }
+        LimbsToBigInt(msg.a, MAX_LIMBS, &a);
+        DoAdd(&a, LongToBigInt((long)msg.size - 1, &t), &b);  // b = a + size - 1
 
-        /* 第二种写法
-        if (DoCompare(&a, &one) == 0 || DoCompare(&a, &nMinusOne) == 0)
-            continue;
-        for (j = 0; j < s - 1; j++)
-        {
-            DoPowMod(&a, &two, n, &a);  // a = a^2 % n
-            if (DoCompare(&a, &nMinusOne) == 0)
-                goto LOOP;
-        }
-        */
+        res.id = msg.id;
+        res.count = DoPrimeRange(&a, &b, msg.times, 1, NULL, NULL, bits);
 
-        return 0;
+        // 没有内存时，关闭的套接字让分片交给另一个工作进程
+        if (res.count < 0)
+            break;
 
-        LOOP:;
+        if (!SocketWrite(fd, &res, sizeof(res)) || !SocketWrite(fd, bits, (msg.size + 7) / 8))
+            break;
     }
 
-    // 返回n可能是素数
+    close(fd);
+    free(bits);
+
     return 1;
 }
 
-int MillerRabin(char* s, int times)
+// 启动 DoShardRange 的本地工作进程，返回其 pid，无法启动返回 -1
+// 子进程关闭协调者的套接字，这样协调者关闭它们时工作进程能看到 EOF
+int ShardSpawn(char* path, int listenFd, ShardWorker* workers)
 {
-    BigInt n;
+    int i, pid;
 
-    StrToBigInt(s, &n);
-    
-    return DoMillerRabin(&n, times);
+    fflush(stdout);  // 子进程不能再次写出缓冲区
+    pid = fork();
+
+    if (pid == 0)
+    {
+        close(listenFd);
+        for (i = 0; i < SHARD_MAX_WORKERS; i++)
+        {
+            if (workers[i].fd >= 0)
+                close(workers[i].fd);
+        }
+
+        _exit(RunShardWorker(path) ? 0 : 1);
+    }
+
+    return pid;
 }
 
-// 生成指定位数和MillerRabin测试次数的"素数"
-BigInt* DoGenPrime(int bitLen, int times, BigInt* result)
+// 用工作进程求 [a, b] 中的素数，0 <= a <= b，b - a < 2^62
+// 区间被切成 SHARD_SIZE 个数的分片，由协调者交给工作进程
+// 工作进程连接到 Unix 域套接字 path：它 fork 的 procNum 个本地进程，以及由 RunShardWorker 启动的任意进程
+// 死掉的工作进程的分片交给另一个，丢失 SHARD_RETRIES 次后由协调者测试，
+// 没有工作进程连接或正在启动时，协调者自己测试分片
+// 按顺序对每个素数调用 cb(p, arg)，找到 limit 个素数后停止，0 表示不限
+// 返回素数个数，无法打开套接字时返回 -1，没有内存时也返回 -1 并设置 ERROR_MEMORY
+long long DoShardRange(BigInt* a, BigInt* b, int times, char* path, int procNum, long long limit,
+                       PrimeRangeCallback cb, void* arg)
 {
-    int i;
-    unsigned long n = 1;
-    unsigned long a, b;
-    BigInt minusTwo;
+    int i, k, num, fd, window, idle, live, spawned, failed = 0;
+    int pid[SHARD_MAX_WORKERS], slot[SHARD_MAX_WORKERS + 1];
+    long long id, done, next, shardNum, count = 0;
+    unsigned long long total;
+    long long n;
+    Limb o, base[MAX_LIMBS], t[MAX_LIMBS];
+    struct sockaddr_un addr;
+    struct pollfd pfd[SHARD_MAX_WORKERS + 1];
+    ShardWorker workers[SHARD_MAX_WORKERS];
+    ShardSlot* shards;
+    ShardResult* res;
+    ShardMsg msg;
+    BigInt d, p, x, y;
+
+    if (a->bit[SIGN_BIT] == NEGATIVE || DoCompare(a, b) > 0)
+        return 0;
 
-    StrToBigInt("-2", &minusTwo);
-    memset(result->bit, 0, BIG_INT_BIT_LEN);
-    for (i = 0; i < bitLen; i++)
-        result->bit[i] = 1;
+    if (procNum < 0)
+        procNum = 0;
+    if (procNum > SHARD_MAX_WORKERS)
+        procNum = SHARD_MAX_WORKERS;
 
-    while (1)
+    DoSub(b, a, &d);  // d = b - a
+    if (GetTrueValueLen(&d) > 62 || strlen(path) >= sizeof(addr.sun_path))
+        return -1;
+
+    memset(t, 0, sizeof(t));
+    BigIntToLimbs(&d, t);
+    total = t[0] + 1;
+    shardNum = (total + SHARD_SIZE - 1) / SHARD_SIZE;
+    memset(base, 0, sizeof(base));
+    BigIntToLimbs(a, base);
+
+    signal(SIGPIPE, SIG_IGN);  // 工作进程死掉后 write 返回错误，而不是信号
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 64) != 0)
     {
-        printf("testing number[%ld]...\n", n);
-        a = time(0);
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
 
-        if (DoMillerRabin(result, times))
+    // 第一个未完成分片之后的分片在窗口中等待，因此内存有上限
+    window = (procNum > 0 ? procNum : 1) * SHARD_WINDOW;
+    shards = (ShardSlot*)calloc(window, sizeof(ShardSlot));
+    for (i = 0; shards != NULL && i < window; i++)
+    {
+        shards[i].bits = (unsigned char*)malloc(SHARD_SIZE / 8);
+        if (shards[i].bits == NULL)
+            break;
+    }
+
+    for (k = 0; k < SHARD_MAX_WORKERS; k++)
+    {
+        workers[k].fd = -1;
+        workers[k].in = NULL;
+    }
+
+    for (k = 0; shards != NULL && i == window && k < SHARD_MAX_WORKERS; k++)
+    {
+        workers[k].in = (unsigned char*)malloc(sizeof(ShardResult) + SHARD_SIZE / 8);
+        if (workers[k].in == NULL)
+            break;
+    }
+
+    if (k < SHARD_MAX_WORKERS)
+    {
+        for (k = 0; k < SHARD_MAX_WORKERS; k++)
+            free(workers[k].in);
+        for (i = 0; shards != NULL && i < window; i++)
+            free(shards[i].bits);
+        free(shards);
+        close(fd);
+        unlink(path);
+
+        SetError(ERROR_MEMORY);
+        return -1;
+    }
+
+    for (k = 0; k < procNum; k++)
+        pid[k] = ShardSpawn(path, fd, workers);
+    spawned = procNum;
+
+    done = next = 0;
+
+    while (done < shardNum && (limit == 0 || count < limit))
+    {
+        // 死掉的本地工作进程被重新 fork，平均每个最多 SHARD_RETRIES 次
+        for (live = 0, k = 0; k < procNum; k++)
         {
-            b = time(0);
+            if (pid[k] > 0 && waitpid(pid[k], NULL, WNOHANG) == pid[k])
+            {
+                pid[k] = -1;
+                if (spawned < procNum * (SHARD_RETRIES + 1))
+                {
+                    pid[k] = ShardSpawn(path, fd, workers);
+                    spawned++;
+                }
+            }
+            live += pid[k] > 0;
+        }
+
+        // 把待处理的分片交给空闲的工作进程，丢失过的优先，
+        // 但丢失了 SHARD_RETRIES 次的不给，它们在下面由这里测试
+        for (k = 0; k < SHARD_MAX_WORKERS; k++)
+        {
+            if (workers[k].fd < 0 || workers[k].shard >= 0)
+                continue;
+
+            for (id = done; id < next && (shards[id % window].state != SHARD_PENDING ||
+                                          shards[id % window].tries >= SHARD_RETRIES); id++);
+
+            if (id == next && next < shardNum && next < done + window)
+            {
+                shards[next % window].state = SHARD_PENDING;
+                shards[next % window].tries = 0;
+                next++;
+            }
+            else if (id == next)
+            {
+                break;
+            }
+
+            memset(&msg, 0, sizeof(msg));
+            msg.times = times;
+            msg.id = id;
+            msg.size = total - id * SHARD_SIZE < SHARD_SIZE ? (long long)(total - id * SHARD_SIZE) : SHARD_SIZE;
+            memcpy(msg.a, base, sizeof(base));
+            o = (Limb)id * SHARD_SIZE;
+            LimbsAddTo(msg.a, MAX_LIMBS, &o, 1);  // a + id * SHARD_SIZE
+
+            shards[id % window].state = SHARD_RUNNING;
+            workers[k].shard = id;
+            workers[k].need = sizeof(ShardResult) + (int)((msg.size + 7) / 8);
+            workers[k].inLen = 0;
+
+            if (!SocketWrite(workers[k].fd, &msg, sizeof(msg)))
+            {
+                shards[id % window].state = SHARD_PENDING;
+                shards[id % window].tries++;
+                close(workers[k].fd);
+                workers[k].fd = -1;
+            }
+        }
+
+        // 丢失次数太多或没有工作进程接手的分片在这里测试
+        for (idle = 1, k = 0; k < SHARD_MAX_WORKERS; k++)
+            idle &= workers[k].fd < 0;
+
+        for (id = done; id < next || (idle && live == 0 && id < shardNum && id < done + window); id++)
+        {
+            if (id == next)
+            {
+                shards[next % window].state = SHARD_PENDING;
+                shards[next % window].tries = 0;
+                next++;
+            }
+
+            if (shards[id % window].state != SHARD_PENDING ||
+                (shards[id % window].tries < SHARD_RETRIES && !(idle && live == 0)))
+                continue;
+
+            n = total - id * SHARD_SIZE < SHARD_SIZE ? (long long)(total - id * SHARD_SIZE) : SHARD_SIZE;
+            memcpy(t, base, sizeof(base));
+            o = (Limb)id * SHARD_SIZE;
+            LimbsAddTo(t, MAX_LIMBS, &o, 1);
+            LimbsToBigInt(t, MAX_LIMBS, &x);
+            DoAdd(&x, LongToBigInt((long)n - 1, &y), &y);
+
+            shards[id % window].count = DoPrimeRange(&x, &y, times, 1, NULL, NULL, shards[id % window].bits);
+            if (shards[id % window].count < 0)
+            {
+                failed = 1;  // 已设置 ERROR_MEMORY
+                break;
+            }
+
+            shards[id % window].state = SHARD_FINISHED;
+            break;  // 先处理新的工作进程和结果，再测试下一个
+        }
+
+        if (failed)
             break;
+
+        // 按顺序处理完成的分片
+        while (done < next && shards[done % window].state == SHARD_FINISHED && (limit == 0 || count < limit))
+        {
+            n = total - done * SHARD_SIZE < SHARD_SIZE ? (long long)(total - done * SHARD_SIZE) : SHARD_SIZE;
+
+            if (cb == NULL && (limit == 0 || count + shards[done % window].count <= limit))
+            {
+                count += shards[done % window].count;
+            }
+            else
+            {
+                for (i = 0; i < n && (limit == 0 || count < limit); i++)
+                {
+                    if ((shards[done % window].bits[i / 8] >> (i % 8) & 1) == 0)
+                        continue;
+
+                    count++;
+                    if (cb == NULL)
+                        continue;
+
+                    memcpy(t, base, sizeof(base));
+                    o = (Limb)done * SHARD_SIZE + i;
+                    LimbsAddTo(t, MAX_LIMBS, &o, 1);  // p = a + done * SHARD_SIZE + i
+                    cb(LimbsToBigInt(t, MAX_LIMBS, &p), arg);
+                }
+            }
+
+            done++;
         }
 
-        b = time(0);
-        printf("finish test number %ld (t=%lds)\n\n", n++, b - a);
+        if (done == shardNum || (limit > 0 && count >= limit))
+            break;
+
+        pfd[0].fd = fd;
+        pfd[0].events = POLLIN;
+
+        for (num = 1, k = 0; k < SHARD_MAX_WORKERS; k++)
+        {
+            if (workers[k].fd < 0)
+                continue;
+
+            pfd[num].fd = workers[k].fd;
+            pfd[num].events = POLLIN;
+            slot[num++] = k;
+        }
+
+        // 超时用于发现连接前就死掉的本地工作进程
+        if (poll(pfd, num, idle && live == 0 ? 0 : 100) <= 0)
+            continue;
+
+        if (pfd[0].revents & POLLIN)
+        {
+            i = accept(fd, NULL, NULL);
+            for (k = 0; i >= 0 && k < SHARD_MAX_WORKERS && workers[k].fd >= 0; k++);
+
+            if (i >= 0 && k < SHARD_MAX_WORKERS)
+            {
+                workers[k].fd = i;
+                workers[k].shard = -1;
+            }
+            else if (i >= 0)
+            {
+                close(i);  // 工作进程太多
+            }
+        }
+
+        for (i = 1; i < num; i++)
+        {
+            if ((pfd[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+                continue;
+
+            k = slot[i];
+            n = workers[k].shard < 0 ? 0 : read(workers[k].fd, workers[k].in + workers[k].inLen,
+                                                  workers[k].need - workers[k].inLen);
 
-        DoAdd(result, &minusTwo, result);
+            if (n > 0)
+            {
+                workers[k].inLen += (int)n;
+                if (workers[k].inLen < workers[k].need)
+                    continue;
+
+                // id 不对说明工作进程出错，在下面丢弃
+                res = (ShardResult*)workers[k].in;
+                id = workers[k].shard;
+                if (res->id == id)
+                {
+                    shards[id % window].count = res->count;
+                    memcpy(shards[id % window].bits, workers[k].in + sizeof(ShardResult),
+                           workers[k].need - sizeof(ShardResult));
+                    shards[id % window].state = SHARD_FINISHED;
+                    workers[k].shard = -1;
+                    continue;
+                }
+            }
+            else if (n < 0 && (errno == EINTR || errno == EAGAIN))
+            {
+                continue;
+            }
+
+            // 工作进程已死，其分片交给另一个
+            if (workers[k].shard >= 0)
+            {
+                shards[workers[k].shard % window].state = SHARD_PENDING;
+                shards[workers[k].shard % window].tries++;
+            }
+
+            close(workers[k].fd);
+            workers[k].fd = -1;
+        }
     }
 
-    printf("finish test number[%ld] (t=%lds)\n\n", n, b - a);
+    // 工作进程看到 EOF，正在处理分片的本地进程被终止
+    for (k = 0; k < SHARD_MAX_WORKERS; k++)
+    {
+        if (workers[k].fd >= 0)
+            close(workers[k].fd);
+        free(workers[k].in);
+    }
 
-    return result;
+    for (k = 0; k < procNum; k++)
+    {
+        if (pid[k] > 0)
+        {
+            kill(pid[k], SIGTERM);
+            waitpid(pid[k], NULL, 0);
+        }
+    }
+
+    close(fd);
+    unlink(path);
+
+    for (i = 0; i < window; i++)
+        free(shards[i].bits);
+    free(shards);
+
+    return failed ? -1 : count;
 }
+#endif
 
-char* GenPrime(int bitLen, int times, char* result)
+// 输出 RSA 密钥对
+void PrintRsaKey(RsaKey* key)
 {
-    BigInt n;
+    char s[BUFFER_SIZE];
+
+    printf("n=%s\n", BigIntToStr(&key->n, s));
+    printf("e=%s\n", BigIntToStr(&key->e, s));
+    printf("d=%s\n", BigIntToStr(&key->d, s));
+    printf("p=%s\n", BigIntToStr(&key->p, s));
+    printf("q=%s\n", BigIntToStr(&key->q, s));
+    printf("dp=%s\n", BigIntToStr(&key->dp, s));
+    printf("dq=%s\n", BigIntToStr(&key->dq, s));
+    printf("qInv=%s\n", BigIntToStr(&key->qInv, s));
+}
 
-    DoGenPrime(bitLen, times, &n);
+// 打印 DoShardRange 的素数
+void PrintPrime(BigInt* p, void* arg)
+{
+    char s[BUFFER_SIZE];
 
-    return BigIntToStr(&n, result);
+    (void)arg;
+    puts(BigIntToStr(p, s));
 }
 
-int main()
+int main(int argc, char* argv[])
 {
     // printf("hello, world");
 
+    int i, threadNum = 4;
     unsigned long a, b;
+    long long n;
     char result[BUFFER_SIZE];
     char remainder[BUFFER_SIZE];
     char buf[BUFFER_SIZE] = "prime=";
+    char* daemonPath = NULL;
+    char* shardPath = NULL;
+    char* shardWorker = NULL;
+    BigInt x, y;
+
+    // -c file: 把GenPrime和GenRandomPrime的搜索状态保存到file
+    // -r: 重启后从文件中的检查点继续
+    // -p file: 把GenPrime和GenSafePrime的结果保存到file，下次运行直接从中取出
+    // -b file: 用file中的素数位图回答小于2^32的数
+    // -d path: 在Unix域套接字path上运行守护进程，-j n: 用n个工作线程
+    // -s path a b: 由 path 上的协调者和 -j n 个本地工作进程打印 [a, b] 中的素数
+    // -k path: 运行 path 上的协调者的工作进程
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            SetCheckpoint(argv[++i], checkpointResume, checkpointInterval);
+        else if (strcmp(argv[i], "-r") == 0)
+            checkpointResume = 1;
+        else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc && !OpenPrimeCache(argv[++i]))
+            printf("Can not open the prime cache %s XD\n", argv[i]);
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc && !OpenPrimeBitmap(argv[++i]))
+            printf("Can not open the prime bitmap %s XD\n", argv[i]);
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            daemonPath = argv[++i];
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            threadNum = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc)
+            shardWorker = argv[++i];
+        else if (strcmp(argv[i], "-s") == 0 && i + 3 < argc)
+        {
+            shardPath = argv[++i];
+            StrToBigInt(argv[++i], &x);
+            StrToBigInt(argv[++i], &y);
+        }
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+        {
+            // -t file: 把小素数的表写入file，然后退出
+            if (!GenPrimeTable(argv[++i]))
+                printf("Can not write the prime table %s XD\n", argv[i]);
+            return 0;
+        }
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+        {
+            // -w file: 把素数位图写入file，然后退出
+            if (!GenPrimeBitmap(argv[++i]))
+                printf("Can not write the prime bitmap %s XD\n", argv[i]);
+            return 0;
+        }
+    }
+
+    // 守护进程启动后不再返回
+    if (daemonPath != NULL)
+    {
+#ifndef _WIN32
+        RunDaemon(daemonPath, threadNum);
+        printf("Can not open the socket %s XD\n", daemonPath);
+#else
+        printf("The daemon needs Unix domain sockets XD\n");
+#endif
+        return 1;
+    }
+
+    if (shardPath != NULL || shardWorker != NULL)
+    {
+#ifndef _WIN32
+        if (shardWorker != NULL && !RunShardWorker(shardWorker))
+        {
+            printf("Can not connect to the coordinator %s XD\n", shardWorker);
+            return 1;
+        }
+
+        if (shardPath != NULL)
+        {
+            a = time(0);
+            n = DoShardRange(&x, &y, 5, shardPath, threadNum, 0, PrintPrime, NULL);
+            b = time(0);
+
+            if (n < 0)
+            {
+                printf("Can not open the socket %s XD\n", shardPath);
+                return 1;
+            }
+            printf("%lld primes, total t=%lds\n", n, b - a);
+        }
+
+        return 0;
+#else
+        printf("The sharded search needs Unix domain sockets XD\n");
+        return 1;
+#endif
+    }
 
     // 函数: GenPrime(bitLen, times, result)
     // 可生成一个指定位长和miller-rabin测试次数的素数
@@ -989,6 +8732,8 @@ int main()
     // 生成一个32bit的素数大约需要4秒
     // 在生成一个大素前，请确保宏定义 BIG_INT_BIT_LEN 足够大
 
+    // SeedRand(2014);  // 固定种子，便于重复基准测试
+
     a = time(0);
     puts(strcat(buf, GenPrime(100, 5, result)));
     b = time(0);
@@ -1001,6 +8746,47 @@ int main()
     b = time(0);
     printf("total t=%lds\n", b - a);
     */
+
+    /*
+    // 64 位整数的确定性 Miller-Rabin 测试
+    unsigned long long n64[3] = {4294967291ULL, 3825123056546413051ULL, 18446744073709551557ULL};
+    char isPrime[3];
+    printf("%d primes\n", MillerRabin64Batch(n64, 3, isPrime));
+    */
+
+    /*
+    // 生成一个随机素数，最高两位都是 1
+    a = time(0);
+    puts(GenRandomPrime(512, 5, result));
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
+
+    /*
+    // 生成一个随机的安全素数 p = 2q + 1
+    a = time(0);
+    puts(GenSafePrime(1024, 5, 1, result));
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
+
+    /*
+    // 生成一个 2048 位的 RSA 密钥对
+    RsaKey key;
+    a = time(0);
+    DoGenRsaKey(2048, 5, RSA_E, &key);
+    PrintRsaKey(&key);
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
+
+    /*
+    // 对梅森数 2^p - 1 做 Lucas-Lehmer 测试
+    a = time(0);
+    printf("\n%s\n", LucasLehmer(521) ? "is prime" : "not prime");
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
     
     // 一些素数的例子
     // 4567, 124567, 3214567, 23456789, 55566677
@@ -1,1037 +1,8823 @@
-/*
-    Miller-Rabin test
-    
-    Function: GenPrime(bitLen, times, result)
-    bitlen: bit length, times: times of Miller-Rabin test   
-    If you generate a big prime, make sure the BIG_INT_BIT_LEN is enough
-    
-    1024 bit: about 6 hours
-    512 bit: about 3 hours
-    100 bit: about 1 minute
-    32 bit: about 4 seconds
-
-    Notice:
-    The generation is not random.
-    It first test the biggest BigInt, namely all bit is 1.
-    Then it subtract 2 and test again unitl it find the prime.
-    So it aways generate the biggest prime.
-*/
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <math.h>
-#include <time.h>
-
-#define BIG_INT_BIT_LEN 2400           // bit int bit length
-#define SIGN_BIT BIG_INT_BIT_LEN - 1   // index of sign bit
-#define BUFFER_SIZE BIG_INT_BIT_LEN    // buffer size
-#define POSITIVE 0                     // 0 for positive number
-#define NEGATIVE 1                     // 1 for negative number
-
-typedef struct    // type:BigInt, use complement to store
-{
-    char bit[BIG_INT_BIT_LEN];
-}BigInt;
-
-typedef struct    // type:Number, use true value to store
-{
-    char value[BIG_INT_BIT_LEN];  // value array
-    int len;                      // array length
-    int sign;                     // POSITIVE(0) or NEGATIVE(1)
-}Number;
-
-// print BigInt
-void PrintBigInt(BigInt* a)
-{
-    int i;
-    for (i = SIGN_BIT; i >= 0; i--)
-        printf("%d", a->bit[i]);
-    printf("\n");
-}
-
-// print Number
-void PrintNumber(Number* n)
-{
-    int i;
-
-    if (n->sign == NEGATIVE)
-        printf("-");
-
-    for (i = n->len - 1; i >= 0; i--)
-    {
-        if (n->value[i] > 9)  // if radix > 10
-            printf("%c", n->value[i] - 10 + 'a');
-        else
-            printf("%d", n->value[i]);
-    }
-    printf("\n");
-}
-
-// change type: string to Number, return: Number*
-Number* StrToNumber(char* str, Number* n)
-{
-    int i, j;
-
-    if (str[0] == '-' || str[0] == '+')  // if str[0] is sign
-    {
-        n->len = strlen(str) - 1;
-        n->sign = str[0] == '+' ? POSITIVE : NEGATIVE;
-
-        for (i = 0, j = n->len; j > 0; j--, i++)
-        {
-            if (str[j] > '9')  // if radix > 10
-                n->value[i] = str[j] - 'a' + 10;
-            else
-                n->value[i] = str[j] - '0';
-        }
-    }
-    else  // default sign is POSITIVE
-    {
-        n->len = strlen(str);
-        n->sign = POSITIVE;
-
-        for (i = 0, j = n->len - 1; j >= 0; j--, i++)
-        {
-            if (str[j] > '9')  // if radix > 10
-                n->value[i] = str[j] - 'a' + 10;
-            else
-                n->value[i] = str[j] - '0';
-        }
-    }
-
-    return n;
-}
-
-// change type: Number to string, return char*
-char* NumberToStr(Number* n, char* str)
-{
-    int i = 0, j;
-
-    if (n->sign == NEGATIVE)
-        str[i++] = '-';
-
-    for (j = n->len - 1; j >= 0; j--)
-    {
-        if (n->value[j] > 9)  // if radix > 10
-            str[i++] = n->value[j] - 10 + 'a';
-        else
-            str[i++] = n->value[j] + '0';
-    }
-
-    str[i] = '\0';
-
-    return str;
-}
-
-// binary string to hexadecimal string
-char* BinStrToHexStr(char* binStr, char* hexStr)
-{
-    int i, j, t;
-    Number binNum;
-    Number hexNum;
-
-    StrToNumber(binStr, &binNum);
-
-    hexNum.sign = binNum.sign;
-    hexNum.len = (int)ceil(binNum.len / 4.0);
-
-    for (i = 0; i < hexNum.len; i++)
-    {
-        j = 4 * i;
-
-        t = binNum.value[j];
-
-        if (j + 1 < binNum.len)
-            t += 2 * binNum.value[j + 1];
-
-        if (j + 2 < binNum.len)
-            t += 4 * binNum.value[j + 2];
-
-        if (j + 3 < binNum.len)
-            t += 8 * binNum.value[j + 3];
-
-        hexNum.value[i] = t;
-    }
-
-    return NumberToStr(&hexNum, hexStr);
-}
-
-// change string radix from srcRadix to dstRadix
-char* ChangeStringRadix(char* str, int srcRadix, int dstRadix, char* resultStr)
-{
-    if (srcRadix < dstRadix)
-    {
-        char hexStr[BUFFER_SIZE];
-
-        ChangeStringRadix(str, srcRadix, 2, resultStr);  // srcRadix to radix 2
-        BinStrToHexStr(resultStr, hexStr);               // radix 2 to 16
-
-        // radix 16 to dstRadix
-        return ChangeStringRadix(hexStr, 16, dstRadix, resultStr);
-    }
-
-    if (srcRadix == dstRadix)
-    {
-        return strcpy(resultStr, str);
-    }
-
-    else  // srcRadix > dstRadix
-    {
-        int i, t;
-        Number dividend;
-        Number quotient;
-        Number resultNum;
-
-        // string to Number
-        StrToNumber(str, &dividend);
-
-        resultNum.len = 0;
-        resultNum.sign = dividend.sign;
-
-        while (dividend.len > 0)
-        {
-            quotient.len = dividend.len;
-
-            // simulate the way we do division
-            // when the cycle is end, t is the remainder
-            for (t = 0, i = dividend.len - 1; i >= 0; i--)
-            {
-                t = t * srcRadix + dividend.value[i];
-                quotient.value[i] = t / dstRadix;
-                t = t % dstRadix;
-            }
-
-            // save the remainder
-            resultNum.value[resultNum.len++] = t;
-
-            // filter the unnecessary 0 in quotient
-            for (i = quotient.len - 1; i >= 0 && quotient.value[i] == 0; i--);
-
-            // set the next dividend length
-            dividend.len = i + 1;
-
-            // let the quotient be the next divident
-            for (i = 0; i < dividend.len; i++)
-            {
-                dividend.value[i] = quotient.value[i];
-            }
-        }
-
-        return NumberToStr(&resultNum, resultStr);
-    }
-}
-
-// true form <=> complement
-BigInt* ToComplement(BigInt* src, BigInt* dst)
-{
-    int i;
-
-    if (src->bit[SIGN_BIT] == NEGATIVE)  // NEGATIVE
-    {
-        dst->bit[SIGN_BIT] = 1;
-
-        for (i = 0; i < SIGN_BIT && src->bit[i] == 0; i++)
-            dst->bit[i] = src->bit[i];
-
-        if (i == SIGN_BIT)  // notice: this is -0 complement
-            dst->bit[i] = 0;
-        else
-        {
-            dst->bit[i] = src->bit[i];
-            for (i++; i < SIGN_BIT; i++)
-                dst->bit[i] = !src->bit[i];
-        }
-    }
-    else  // POSITIVE
-    {
-        for (i = 0; i < BIG_INT_BIT_LEN; i++)
-            dst->bit[i] = src->bit[i];
-    }
-
-    return dst;
-}
-
-// complement to true form
-BigInt* ToTrueForm(BigInt* src, BigInt* dst)
-{
-    return ToComplement(src, dst);
-}
-
-
-// [x] complement to [-x] complement
-// notice: for example, if BigInt bit length is 8
-// it can not get the [-128] complement, overflow
-BigInt* ToOppositeNumberComplement(BigInt* src, BigInt* dst)
-{
-    int i;
-
-    for (i = 0; i < BIG_INT_BIT_LEN && src->bit[i] == 0; i++)
-        dst->bit[i] = src->bit[i];
-
-    // if src is not 0
-    if (i != BIG_INT_BIT_LEN)
-    {
-        dst->bit[i] = src->bit[i];
-
-        // the sign bit should reverse too
-        for (i++; i < BIG_INT_BIT_LEN; i++)
-            dst->bit[i] = !src->bit[i];
-    }
-
-    return dst;
-}
-
-/* basic implement
-// [x] complement to [-x] complement
-BigInt* ToOppositeNumberComplement(BigInt* src, BigInt* dst)
-{
-    BigInt t;
-
-    ToTrueForm(src, &t);
-    t.bit[SIGN_BIT] = !t.bit[SIGN_BIT];
-    ToComplement(&t, dst);
-
-    return dst;
-}
-*/
-
-// change type: binary Number to BigInt
-BigInt* BinNumToBigInt(Number* binNum, BigInt* a)
-{
-    int i;
-
-    memset(a->bit, 0, BIG_INT_BIT_LEN);  // init 0
-
-    for (i = 0; i < binNum->len; i++)
-    {
-        a->bit[i] = binNum->value[i];
-    }
-
-    // if BigInt is the smallest nagative number
-    // for example, if BigInt bit len is 4, BigInt is 1000
-    if (binNum->len == BIG_INT_BIT_LEN)
-    {
-        return a;
-    }
-    else
-    {
-        a->bit[SIGN_BIT] = binNum->sign;
-        return ToComplement(a, a);
-    }
-}
-
-// change type: BigInt to binary Number
-Number* BigIntToBinNum(BigInt* a, Number* binNum)
-{
-    int i;
-    BigInt t;
-
-    binNum->sign = a->bit[SIGN_BIT];
-
-    for (i = SIGN_BIT - 1; i >= 0 && a->bit[i] == 0; i--);
-
-    // if BigInt is the smallest nagative number
-    // for example, if BigInt bit len is 4, BigInt is 1000
-    if (binNum->sign == NEGATIVE && i == -1)
-    {
-        binNum->len = BIG_INT_BIT_LEN;
-        for (i = 0; i < binNum->len; i++)
-            binNum->value[i] = a->bit[i];
-    }
-    else
-    {
-        ToTrueForm(a, &t);
-        for (i = SIGN_BIT - 1; i >= 0 && t.bit[i] == 0; i--);
-        binNum->len = i == -1 ? 1 : i + 1;
-        for (i = 0; i < binNum->len; i++)
-            binNum->value[i] = t.bit[i];
-    }
-
-    return binNum;
-}
-
-// change type: string to BigInt, use complement to store
-BigInt* StrToBigInt(char* s, BigInt* a)
-{
-    char buf[BUFFER_SIZE];
-    Number binNum;
-
-    ChangeStringRadix(s, 10, 2, buf);    // string radix 10 to 2
-    StrToNumber(buf, &binNum);           // string to Number
-    return BinNumToBigInt(&binNum, a);   // Number to BigInt
-}
-
-// change type: BigInt to string(radix 10)
-char* BigIntToStr(BigInt* a, char* s)
-{
-    char buf[BUFFER_SIZE];
-    Number binNum;
-
-    BigIntToBinNum(a, &binNum);     // BigInt to Number
-    NumberToStr(&binNum, buf);      // Number to string
-
-    return ChangeStringRadix(buf, 2, 10, s);  // string radix 2 to 10
-}
-
-// copy BigInt
-BigInt* CopyBigInt(BigInt* src, BigInt* dst)
-{
-    int i;
-    for (i = 0; i < BIG_INT_BIT_LEN; i++)
-        dst->bit[i] = src->bit[i];
-    return dst;
-}
-
-// Shift Arithmetic Left
-BigInt* ShiftArithmeticLeft(BigInt* src, int indent, BigInt* dst)
-{
-    int i, j;
-
-    dst->bit[SIGN_BIT] = src->bit[SIGN_BIT];
-
-    for (i = SIGN_BIT - 1, j = i - indent; j >= 0; i--, j--)
-    {
-        dst->bit[i] = src->bit[j];
-    }
-
-    while (i >= 0)
-    {
-        dst->bit[i--] = 0;
-    }
-
-    return dst;
-}
-
-// Shift Arithmetic Right
-BigInt* ShiftArithmeticRight(BigInt* src, int indent, BigInt* dst)
-{
-    int i, j;
-
-    dst->bit[SIGN_BIT] = src->bit[SIGN_BIT];
-
-    for (i = 0, j = i + indent; j < SIGN_BIT; i++, j++)
-    {
-        dst->bit[i] = src->bit[j];
-    }
-
-    while (i < SIGN_BIT)
-    {
-        dst->bit[i++] = src->bit[SIGN_BIT];
-    }
-
-    return dst;
-}
-
-// implement of Addition
-// result = a + b
-BigInt* DoAdd(BigInt* a, BigInt* b, BigInt* result)
-{
-    int i, t, carryFlag;
-    int aSign = a->bit[SIGN_BIT];  // a sign
-    int bSign = b->bit[SIGN_BIT];  // b sign
-
-    for (carryFlag = i = 0; i < BIG_INT_BIT_LEN; i++)
-    {
-        t = a->bit[i] + b->bit[i] + carryFlag;
-        result->bit[i] = t % 2;
-        carryFlag = t > 1 ? 1 : 0;
-    }
-
-    if (aSign == bSign && aSign != result->bit[SIGN_BIT])
-    {
-        printf("Overflow XD\n");
-        exit(1);
-    }
-
-    return result;
-}
-
-// implement of Subtraction
-// result = a - b
-BigInt* DoSub(BigInt* a, BigInt* b, BigInt* result)
-{
-    BigInt t;
-
-    ToOppositeNumberComplement(b, &t);
-    DoAdd(a, &t, result);
-
-    return result;
-}
-
-// implement of Multiplication by using Booth algorithm
-// result = a * b
-BigInt* DoMul(BigInt* a, BigInt* b, BigInt* result)
-{
-    int i;
-    BigInt c, t;
-
-    ToOppositeNumberComplement(a, &c);  // c = [-a] complement
-
-    memset(t.bit, 0, BIG_INT_BIT_LEN);  // init 0
-
-    // filter
-    for (i = SIGN_BIT; i > 0 && b->bit[i] == b->bit[i - 1]; i--);
-
-    while (i > 0)
-    {
-        ShiftArithmeticLeft(&t, 1, &t);
-
-        if (b->bit[i] != b->bit[i - 1])
-        {
-            DoAdd(&t, b->bit[i - 1] > b->bit[i] ? a : &c, &t);
-        }
-
-        i--;
-    }
-
-    // the last shift
-    ShiftArithmeticLeft(&t, 1, &t);
-    if (b->bit[0] != 0)
-    {
-        DoAdd(&t, &c, &t);
-    }
-
-    return CopyBigInt(&t, result);
-}
-
-// get the max left shift length
-int GetMaxLeftShiftLen(BigInt* a)
-{
-    int i, k;
-    BigInt t;
-
-    ToTrueForm(a, &t);
-
-    for (i = SIGN_BIT - 1, k = 0; i >= 0 && t.bit[i] == 0; i--, k++);
-
-    return k;
-}
-
-// get the max right shift length
-int GetMaxRightShiftLen(BigInt* a)
-{
-    int i;
-
-    for (i = 0; i < SIGN_BIT && a->bit[i] == 0; i++);
-
-    return i;
-}
-
-// check if a bigint is 0
-int IsZero(BigInt* a)
-{
-    int i;
-    for (i = 0; i < BIG_INT_BIT_LEN; i++)
-    {
-        if (a->bit[i] != 0)
-            return 0;
-    }
-    return 1;
-}
-
-// implement of division by using binary search
-// result = a / b
-BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
-{
-    int low, high, mid;
-    BigInt c, d, e, t;
-
-    low = 0;                       // the min of left shift
-    high = GetMaxLeftShiftLen(b);  // the max of left shift
-
-    memset(t.bit, 0, BIG_INT_BIT_LEN);  // init 0
-    CopyBigInt(a, &c);                  // c = a
-
-    // if a sign == b sign, do subtraction
-    if (a->bit[SIGN_BIT] == b->bit[SIGN_BIT])
-    {
-        t.bit[SIGN_BIT] = POSITIVE;
-
-        while (1)
-        {
-            while (low <= high)
-            {
-                mid = (low + high) / 2;
-                ShiftArithmeticLeft(b, mid, &d);
-                DoSub(&c, &d, &e);  // e = c - d
-
-                // e >= 0
-                if (d.bit[SIGN_BIT] == e.bit[SIGN_BIT] || IsZero(&e))
-                    low = mid + 1;
-                else
-                    high = mid - 1;
-            }
-
-            // high == -1 means c - b < 0
-            if (high != -1)
-            {
-                t.bit[high] = 1;
-
-                // here unified the operation
-                // it can improve i think
-                ShiftArithmeticLeft(b, high, &d);
-
-                // c = c - d, let c be the next dividend
-                DoSub(&c, &d, &c);
-
-                low = 0;
-                high--;
-            }
-            else
-            {
-                // now the dividend c is the remainder
-                CopyBigInt(&c, remainder);
-                break;
-            }
-        }
-    }
-
-    // if a sign != b sign, do addition
-    else
-    {
-        t.bit[SIGN_BIT] = NEGATIVE;
-
-        while (1)
-        {
-            while (low <= high)
-            {
-                mid = (low + high) / 2;
-                ShiftArithmeticLeft(b, mid, &d);
-                DoAdd(&c, &d, &e);  // e = c + d
-
-                // e >= 0
-                if (d.bit[SIGN_BIT] != e.bit[SIGN_BIT] || IsZero(&e))
-                    low = mid + 1;
-                else
-                    high = mid - 1;
-            }
-
-            // high == -1 means c - b < 0
-            if (high != -1)
-            {
-                t.bit[high] = 1;
-
-                // here unified the operation
-                // it can improve i think
-                ShiftArithmeticLeft(b, high, &d);
-
-                // c = c + d, let c be the next dividend
-                DoAdd(&c, &d, &c);
-
-                low = 0;
-                high--;
-            }
-            else
-            {
-                // now the dividend c is the remainder
-                CopyBigInt(&c, remainder);
-                break;
-            }
-        }
-    }
-
-    return ToComplement(&t, result);
-}
-
-// Addition
-char* Add(char* s1, char* s2, char* result)
-{
-    BigInt a, b, c;
-    
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    DoAdd(&a, &b, &c);
-
-    return BigIntToStr(&c, result);
-}
-
-// Subtraction
-char* Sub(char* s1, char* s2, char* result)
-{
-    BigInt a, b, c;
-
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    DoSub(&a, &b, &c);
-    
-    return BigIntToStr(&c, result);
-}
-
-// Multiplication
-char* Mul(char* s1, char* s2, char* result)
-{
-    BigInt a, b, c;
-
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    DoMul(&a, &b, &c);
-
-    return BigIntToStr(&c, result);
-}
-
-// Division
-char* Div(char* s1, char* s2, char* result, char* remainder)
-{
-    BigInt a, b, c, d;
-
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    DoDiv(&a, &b, &c, &d);
-    BigIntToStr(&d, remainder);
-
-    return BigIntToStr(&c, result);
-}
-
-// compare two BigInt
-// a > b, return 1
-// a = b, return 0
-// a < b, resutn -1
-int DoCompare(BigInt* a, BigInt* b)
-{
-    BigInt c;
-
-    DoSub(a, b, &c);
-
-    if (IsZero(&c))
-        return 0;
-    if (c.bit[SIGN_BIT] == POSITIVE)
-        return 1;
-    else
-        return -1;
-}
-
-// compare two BigInt
-// a > b, return 1
-// a = b, return 0
-// a < b, resutn -1
-int Compare(char* s1, char* s2)
-{
-    BigInt a, b;
-
-    StrToBigInt(s1, &a);
-    StrToBigInt(s1, &b);
-
-    return DoCompare(&a, &b);
-}
-
-// implement of mod, by using division
-BigInt* DoMod(BigInt* a, BigInt* b, BigInt* remainder)
-{
-    BigInt c;
-
-    DoDiv(a, b, &c, remainder);
-
-    return remainder;
-}
-
-char* Mod(char* s1, char* s2, char* remainder)
-{
-    BigInt a, b, c;
-
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    DoMod(&a, &b, &c);
-
-    return BigIntToStr(&c, remainder);
-}
-
-// get the length of true value
-int GetTrueValueLen(BigInt* a)
-{
-    int i;
-    BigInt t;
-
-    ToTrueForm(a, &t);
-
-    for (i = SIGN_BIT - 1; i >= 0 && t.bit[i] == 0; i--);
-
-    return i + 1;
-}
-
-// implement of pow by using binary pow
-BigInt* DoPow(BigInt* a, BigInt* b, BigInt* result)
-{
-    int i, len;
-    BigInt t, buf;
-
-    CopyBigInt(a, &buf);
-    StrToBigInt("1", &t);
-    len = GetTrueValueLen(b);
-
-    for (i = 0; i < len; i++)
-    {
-        if (b->bit[i] == 1)
-            DoMul(&t, &buf, &t);  // t = t * buf
-
-        DoMul(&buf, &buf, &buf);  // buf = buf * buf
-    }
-    
-    return CopyBigInt(&t, result);
-}
-
-char* Pow(char* s1, char* s2, char* result)
-{
-    BigInt a, b, c;
-
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    DoPow(&a, &b, &c);
-
-    return BigIntToStr(&c, result);
-}
-
-// implement of pow mod by using binary pow mod
-BigInt* DoPowMod(BigInt* a, BigInt* b, BigInt* c, BigInt* result)
-{
-    int i, len;
-    unsigned long t1, t2;
-    BigInt t, buf;
-
-    printf("    doing PowMod...\n");
-    t1 = time(0);
-    CopyBigInt(a, &buf);
-    StrToBigInt("1", &t);
-    len = GetTrueValueLen(b);
-
-    for (i = 0; i < len; i++)
-    {
-        if (b->bit[i] == 1)
-        {
-            DoMul(&t, &buf, &t);  // t = t * buf
-            DoMod(&t, c, &t);     // t = t % c;
-        }
-
-        DoMul(&buf, &buf, &buf);  // buf = buf * buf
-        DoMod(&buf, c, &buf);     // buf = buf % c
-    }
-    t2 = time(0);
-    printf("    finish PowMod (t=%lds)\n", t2 - t1);
-
-    return CopyBigInt(&t, result);
-}
-
-char* PowMod(char* s1, char* s2, char* s3, char* result)
-{
-    BigInt a, b, c, d;
-
-    StrToBigInt(s1, &a);
-    StrToBigInt(s2, &b);
-    StrToBigInt(s3, &c);
-    DoPowMod(&a, &b, &c, &d);
-
-    return BigIntToStr(&d, result);
-}
-
-// get odd random BigInt by specify the bit length
-BigInt* DoGetOddRandBigInt(int bitLen, BigInt* result)
-{
-    int i;
-    static unsigned long seed = 0;
-
-    memset(result->bit, 0, BIG_INT_BIT_LEN);
-    result->bit[0] = 1;
-
-    srand(time(0) + seed++);
-    for (i = 1; i < bitLen - 1; i++)
-    {
-        result->bit[i] = rand() % 2;
-    }
-
-    result->bit[i] = 1;
-
-    return result;
-}
-
-char* GetOddRandBigInt(int bitLen, char* result)
-{
-    BigInt a;
-
-    DoGetOddRandBigInt(bitLen, &a);
-
-    return BigIntToStr(&a, result);
-}
-
-// get random BigInt from {1, 2, ..., n-1}
-BigInt* DoGetRand(BigInt* n, BigInt* result)
-{
-    int i;
-    static unsigned seed = 0;
-    BigInt t;
-
-    srand(time(0) + seed++);
-
-    for (i = 0; i < SIGN_BIT; i++)
-        t.bit[i] = rand() % 2;
-
-    t.bit[SIGN_BIT] = 0;
-
-    DoMod(&t, n, &t);
-    if (IsZero(&t))
-        DoGetRand(n, &t);
-
-    return CopyBigInt(&t, result);
-}
-
-char* GetRand(char* s, char* result)
-{
-    BigInt a, b;
-
-    StrToBigInt(s, &a);
-    DoGetRand(&a, &b);
-
-    return BigIntToStr(&b, result);
-}
-
-// miller rabin test
-int DoMillerRabin(BigInt* n, int times)
-{
-    int i, j, s;
-    BigInt a, t, x;
-    BigInt one, two, nMinusOne;
-
-    StrToBigInt("1", &one);      // one = 1
-    StrToBigInt("2", &two);      // two = 2
-    DoSub(n, &one, &nMinusOne);  // nMinusOne = n - 1
-
-    // n-1 = 2^s * t
-    s = GetMaxRightShiftLen(&nMinusOne);
-    ShiftArithmeticRight(&nMinusOne, s, &t);
-
-    for (i = 0; i < times; i++)
-    {
-        DoGetRand(n, &x);         // x = random{1, 2, ..., n-1}
-        DoPowMod(&x, &t, n, &a);  // a = x^t % n, here is very slow><
-
-        if (DoCompare(&a, &one) == 0)
-            continue;
-
-        for (j = 0; j < s; j++)
-        {
-            if (DoCompare(&a, &nMinusOne) == 0)
-                goto LOOP;
-
-            DoPowMod(&a, &two, n, &a);  // a = a^2 % n
-        }
-
-        return 0;
-
-        LOOP:;
-    }
-
-    // return n is probably a prime
-    return 1;
-}
-
-int MillerRabin(char* s, int times)
-{
-    BigInt n;
-
-    StrToBigInt(s, &n);
-    
-    return DoMillerRabin(&n, times);
-}
-
-// generate prime by specify bit length and miller-rabin test times
-// notice: the generate is not random
-// it first test the biggest BigInt, it means all bit is 1
-// then it subtract 2, and test again, unitl it find the prime
-// so it aways generate the biggest prime in the specify bit length
-// of course you can generate it randomly, good luck ><
-BigInt* DoGenPrime(int bitLen, int times, BigInt* result)
-{
-    int i;
-    unsigned long n = 1;
-    unsigned long a, b;
-    BigInt minusTwo;
-
-    StrToBigInt("-2", &minusTwo);  // minusTwo = -2
-    memset(result->bit, 0, BIG_INT_BIT_LEN);
-    for (i = 0; i < bitLen; i++)   // set all 1, the biggest odd
-        result->bit[i] = 1;
-
-    while (1)
-    {
-        printf("testing number[%ld]...\n", n);
-        a = time(0);
-
-        if (DoMillerRabin(result, times))
-        {
-            b = time(0);
-            break;
-        }
-
-        b = time(0);
-        printf("finish test number %ld (t=%lds)\n\n", n++, b - a);
-
-        DoAdd(result, &minusTwo, result);  // result = result - 2
-    }
-
-    printf("finish test number[%ld] (t=%lds)\n\n", n, b - a);
-
-    return result;
-}
-
-char* GenPrime(int bitLen, int times, char* result)
-{
-    BigInt n;
-
-    DoGenPrime(bitLen, times, &n);
-
-    return BigIntToStr(&n, result);
-}
-
-int main()
-{
-    // printf("hello, world");
-
-    unsigned long a, b;
-    char result[BUFFER_SIZE];
-    char remainder[BUFFER_SIZE];
-    char buf[BUFFER_SIZE] = "prime=";
-
-    // function: GenPrime(bitLen, times, result)
-    // generate prime by specify bit length and miller-rabin test times
-    // generate a 500bit prime may need about 3 hours
-    // generate a 100bit prime may need about 1 minute
-    // generate a 32bit prime may need about 4 seconds
-    // if you generate a big prime, make sure the BIG_INT_BIT_LEN is enough
-
-    a = time(0);
-    puts(strcat(buf, GenPrime(100, 5, result)));
-    b = time(0);
-    printf("total t=%lds\n", b - a);
-    
-    /*
-    // miller-rabin test
-    a = time(0);
-    printf("\n%s\n", MillerRabin("261", 5) ? "is prime" : "not prime");
-    b = time(0);
-    printf("total t=%lds\n", b - a);
-    */
-    
-    // some primes
-    // 4567, 124567, 3214567, 23456789, 55566677
-    // 1234567894987654321, 11111111111111111111111(23)
-    // 779711611410512054554699111109
-
-    // the biggest prime in 100bit
-    // 1267650600228229401496703205361
-
-    // the biggest prime in 512bit t=13284s
-    // 13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006083527
-
-    // the biggest prime in 1024bit t=20983s
-    // 179769313486231590772930519078902473361797697894230657273430081157732675805500963132708477322407536021120113879871393357658789768814416622492847430639474124377767893424865485276302219601246094119453082952085005768838150682342462881473913110540827237163350510684586298239947245938479716304835356329624224137111
-
-    // example: how to use BigInt
-    //puts(Add("2010", "4", result));
-    //puts(Sub("0", "2014", result));
-    //puts(Mul("2", "43", result));
-    //puts(Div("86", "10", result, remainder));
-    //puts(remainder);
-    //puts(Mod("-86", "10", result));
-    //puts(PowMod("7", "80", "86", result));
-
-    return 0;
-}
+/*
+    Miller-Rabin test
+    
+    Function: GenPrime(bitLen, times, result)
+    bitlen: bit length, times: times of Miller-Rabin test   
+    If you generate a big prime, make sure the BIG_INT_BIT_LEN is enough
+
+    Function: GenRandomPrime(bitLen, times, result)
+    Generate a random prime, the highest two bits are 1
+
+    Function: SetCheckpoint(path, resume, interval)
+    Save the search state of GenPrime and GenRandomPrime to a file every interval seconds
+    resume = 1: continue from the file after a restart, or run with -c file -r
+
+    Function: GenPrimePipeline(bitLen, times, threadNum, result)
+    The same prime as GenPrime by a sieve, Fermat filter and Miller-Rabin pipeline joined by lock-free rings
+    DoGenPrimePipeline sets the count of threads of each stage
+
+    Function: GenPrimeAsync(bitLen, times, random, timeoutMs, progress, arg)
+    Run GenPrime or GenRandomPrime in a new thread, the handle is waited by GenPrimeWait or GenPrimePoll
+    It stops by GenPrimeCancel or the deadline within one Miller-Rabin round, and GenPrimeFree frees it
+
+    Function: OpenPrimeCache(path), ClosePrimeCache()
+    Keep the primes of GenPrime and GenSafePrime with random = 0 in a file, or run with -p file
+    The next call of the same bitLen takes it from the file, and runs one Miller-Rabin round, or the rounds it has not passed
+
+    Function: GenSafePrime(bitLen, times, random, result)
+    Generate a safe prime p = 2q + 1, q is a prime too
+    random = 0: the biggest one, random = 1: random one
+
+    Function: GenRsaKey(bitLen, times, n, d)
+    Generate RSA key pair with e = 65537, p and q are generated in parallel
+
+    Function: NextPrime(x, times, result), PrevPrime(x, times, result)
+    The smallest prime greater than x, the biggest prime less than x
+    DoPrimeIterInit and DoPrimeIterNext give the primes one by one in either direction
+
+    Function: DoPrimeRange(a, b, times, threadNum, cb, arg, bitmap), PrimeRange(a, b, times, threadNum)
+    All the primes in [a, b] by a segmented sieve in threads, in order by a callback or a bitmap
+
+    Function: MillerRabin64(n), MillerRabin64Batch(n, count, result)
+    Deterministic Miller-Rabin test for 64 bit numbers, the answer is always right
+    The batch one tests 8 numbers together, in AVX2 lanes if the CPU supports it
+
+    Function: LucasLehmer(p), ScanMersenne(low, high, result)
+    Lucas-Lehmer test for the Mersenne number 2^p - 1
+
+    Function: MillerRabinLarge(s, times), LimbsMulFast(r, a, aLen, b, bLen)
+    Miller-Rabin test for a decimal string of any bit length, not limited by BIG_INT_BIT_LEN
+    The multiplication is schoolbook, Karatsuba, Toom-3 or NTT by the size of the words
+
+    Function: GenPrimeBitmap(path), OpenPrimeBitmap(path)
+    Write the mod 30 wheel bitmap of the primes less than 2^32 to a file, or run with -w file
+    Map it read only, or run with -b file, then the numbers less than 2^32 are one lookup
+
+    Function: InitVerdictCache(size), MillerRabin(s, times)
+    Keep the verdicts of MillerRabin for at most size numbers in shards with their own locks
+    A number asked again with more times only runs the rounds left
+
+    Function: RunDaemon(path, threadNum)
+    Answer is-prime, gen-prime and next-prime on a Unix domain socket, or run with -d path -j threadNum
+    The requests of all the clients are batched, and the 64 bit checks never wait behind a generation
+
+    Function: DoShardRange(a, b, times, path, procNum, limit, cb, arg), RunShardWorker(path)
+    Cut [a, b] into shards for worker processes on a Unix domain socket, the shards of dead workers are given again
+    Run with -s path a b -j procNum, and start more workers with -k path
+
+    Function: GenPrimeTable(path)
+    Write the small primes and the tables of the trial division to miller-rabin_table.h, or run with -t file
+    They are compiled in, so no sieve runs at startup
+
+    Function: InitCombCache(size), PowModFixed(g, e, p, result)
+    g^e mod p for a fixed base g, the Lim-Lee comb table of (g, p) is built once and kept in a bounded cache
+    Then a call takes about bits / 6 multiplications and a few squarings
+
+    Function: DoMulWs(a, b, result, ws), DoDivWs, DoModWs, DoMulModWs, DoPowWs, DoPowModWs
+    BigInt kernels with the temporaries taken from the Workspace ws
+    result can be one of the operands, the ones without Ws use the workspace of the thread
+
+    Function: InitContext(ctx), UseContext(ctx), GetError()
+    The random number generator, workspace, counters and error of the Do* functions are in a Context
+    Each thread has its own, so the threads need no lock, and UseContext sets another one for the thread
+
+    Function: DoMillerRabinCtx(n, times, ctx), DoPowModCtx, DoGenPrimeCtx, DoGenRandomPrimeCtx, DoNextPrimeCtx
+    The hot Do* functions in the context ctx, the ones without Ctx and the string functions use the one of the thread
+    
+    1024 bit: about 6 hours
+    512 bit: about 3 hours
+    100 bit: about 1 minute
+    32 bit: about 4 seconds
+
+    Notice:
+    The generation is not random.
+    It first test the biggest BigInt, namely all bit is 1.
+    It is a Mersenne number, so it is tested by Lucas-Lehmer.
+    Then it subtract 2 and test again unitl it find the prime.
+    So it aways generate the biggest prime.
+    Use GenRandomPrime if you need a random one.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <bcrypt.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "bcrypt.lib")
+#endif
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#endif
+
+#ifdef __linux__
+#include <sys/random.h>
+#endif
+
+// AVX2 code is compiled for x86-64 only, and used if the CPU supports it
+// the MULX/ADCX/ADOX code is inline assembly of GCC and Clang, MSVC uses the C code
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#include <cpuid.h>
+#define USE_AVX2
+#define USE_ADX
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define USE_AVX2
+#define TARGET_AVX2
+#endif
+
+#define BIG_INT_BIT_LEN 2400           // bit int bit length
+#define SIGN_BIT BIG_INT_BIT_LEN - 1   // index of sign bit
+#define BUFFER_SIZE BIG_INT_BIT_LEN    // buffer size
+#define POSITIVE 0                     // 0 for positive number
+#define NEGATIVE 1                     // 1 for negative number
+#define SMALL_PRIME_BOUND 65536        // bound of small primes for sieve
+#define SMALL_PRIME_NUM 6541           // count of odd primes less than bound
+#define SIEVE_WINDOW 8192              // count of candidates in a sieve window
+#define RSA_E 65537                    // default RSA public exponent
+#define MR_BASE64_NUM 7                // count of deterministic Miller-Rabin bases for 64 bit numbers
+#define MR_BASE32_NUM 3                // count of deterministic Miller-Rabin bases for 32 bit numbers
+#define MR64_LANES 8                   // count of numbers tested together by MillerRabin64Batch
+#define TINY_PRIME_NUM 15              // count of odd primes for trial division of 64 bit numbers
+#define FERMAT_BATCH 4                 // count of candidates in a Fermat test batch, one for each AVX2 lane
+#define WORKSPACE_SIZE 16              // count of scratch BigInts in a Workspace
+#define ERROR_NONE 0                   // error of a Context: none
+#define ERROR_OVERFLOW 1               // error of a Context: DoAdd, DoSub or DoMul overflowed, the result is wrapped
+#define ERROR_ENTROPY 2                // error of a Context: the operating system gave no entropy for the CSPRNG
+#define ERROR_RANGE 3                  // error of a Context: the range of DoPrimeRange is too big
+#define ERROR_ARGUMENT 4               // error of a Context: an argument is not one the function takes
+#define ERROR_MEMORY 5                 // error of a Context: no memory, or no scratch BigInt left in the Workspace
+#define ADX_LANES_MAX_LIMBS 8          // with MULX/ADX, the AVX2 lanes are faster only up to this word count
+#define MR_MAX_WINDOW 6                // max bits of a sliding window of the Miller-Rabin exponent
+#define COMB_TEETH 6                   // teeth of the Lim-Lee comb of DoPowModFixed, a table of 2^6 products for each block
+#define COMB_MAX_BLOCKS 32             // max blocks of the comb, more blocks take fewer squarings and a bigger table
+#define NTT_PRIME_NUM 3                // count of primes of the number theoretic transform
+#define MUL_TMP_SIZE(n) (16 * (n) + 4096)  // scratch words of LimbsMulFast for n words
+#define RANGE_SEGMENT 32768            // count of numbers in a segment of DoPrimeRange, the odd flags fit L1 cache
+#define RANGE_ROUND 4                  // count of segments of each thread in a round of DoPrimeRange
+#define RANGE_MAX_THREADS 64           // max count of threads of DoPrimeRange
+#define CHECKPOINT_MAGIC 0x4b43524dU   // "MRCK", first word of a checkpoint file
+#define CHECKPOINT_GEN_PRIME 0         // checkpoint of DoGenPrime
+#define CHECKPOINT_RANDOM_PRIME 1      // checkpoint of DoGenRandomPrime
+#define PRIME_CACHE_MAGIC 0x434d524dU  // "MRMC", first word of a prime cache file
+#define PRIME_CACHE_GEN_PRIME 0        // cached prime of DoGenPrime
+#define PRIME_CACHE_SAFE_PRIME 1       // cached prime of DoGenSafePrime with random = 0
+#define PRIME_CACHE_MODES 2            // count of the modes of the prime cache
+#define VERDICT_SHARDS 16              // count of the shards of the verdict cache, each has its own lock
+#define PRIME_BITMAP_MAGIC 0x4d42524dU // "MRBM", first word of a prime bitmap file
+#define PRIME_BITMAP_BYTES 143165577U  // bytes of the wheel bitmap of the numbers less than 2^32, 30 numbers a byte
+#define PRIME_BITMAP_HEADER 64         // bytes of the header of a prime bitmap file, the bitmap starts at a cache line
+#define PRIME_BITMAP_SEGMENT 32768     // bytes of a segment of GenPrimeBitmap, it fits L1 cache
+#define DAEMON_OP_IS_PRIME 1           // daemon request: is n a prime
+#define DAEMON_OP_GEN_PRIME 2          // daemon request: a prime of bitLen bit
+#define DAEMON_OP_NEXT_PRIME 3         // daemon request: the smallest prime greater than n
+#define DAEMON_OK 0                    // status of a daemon response
+#define DAEMON_BAD_REQUEST 1           // status of a daemon response to a request it does not know
+#define DAEMON_LANE_FAST 0             // lane of the daemon for 64 bit is-prime, tested in batches of MillerRabin64Batch
+#define DAEMON_LANE_NORMAL 1           // lane of the daemon for big is-prime and next-prime
+#define DAEMON_LANE_SLOW 2             // lane of the daemon for gen-prime
+#define DAEMON_LANES 3                 // count of the lanes of the daemon
+#define DAEMON_MAX_CLIENTS 256         // max count of the connections of the daemon
+#define DAEMON_MAX_THREADS 64          // max count of the workers of the daemon
+#define DAEMON_MAX_BITS (BIG_INT_BIT_LEN - 64)  // max bit length of the numbers of the daemon
+#define DAEMON_MAX_PAYLOAD (MAX_LIMBS * 8)      // max bytes of the payload of a daemon request
+#define DAEMON_VERDICT_CACHE 65536     // size of the verdict cache of the daemon
+#define DAEMON_MAX_BACKLOG (1 << 20)   // max bytes of the responses of a client not sent yet, before its requests are read again
+#define DAEMON_MAX_PENDING 4096        // max count of the jobs of a client not answered yet, before its requests are read again
+#define SHARD_SIZE 1048576             // count of numbers in a shard of DoShardRange, its bitmap is 128KB
+#define SHARD_MAX_WORKERS 64           // max count of the workers of DoShardRange
+#define SHARD_WINDOW 4                 // shards of each worker that are running or waiting for the ones before them
+#define SHARD_RETRIES 3                // a shard lost by this many workers is tested by the coordinator itself
+#define SHARD_PENDING 0                // state of a shard of DoShardRange: not given to a worker
+#define SHARD_RUNNING 1                // state of a shard of DoShardRange: given to a worker
+#define SHARD_FINISHED 2               // state of a shard of DoShardRange: its bitmap is ready
+#define PIPE_RING 32                   // slots of a ring between two stages of the pipeline, a power of 2
+#define PIPE_MAX_THREADS 16            // max count of the threads of a stage of the pipeline
+#define PIPE_NONE 0x7fffffffffffffffLL // seq of the best prime of the pipeline before it is found
+#define GEN_TASK_RUNNING 0             // state of a GenPrimeTask: the search is running
+#define GEN_TASK_FOUND 1               // state of a GenPrimeTask: the prime is found
+#define GEN_TASK_CANCELED 2            // state of a GenPrimeTask: stopped by GenPrimeCancel
+#define GEN_TASK_EXPIRED 3             // state of a GenPrimeTask: stopped by the deadline
+
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)  // one variable for each thread
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+#ifdef _MSC_VER
+#define INLINE __inline
+#else
+#define INLINE inline
+#endif
+
+// the index of a ring is read after and written before the slots it covers, p points to a volatile
+#ifdef _MSC_VER
+#define LOAD_ACQUIRE(p) (*(p))  // volatile of MSVC has acquire and release on x86
+#define STORE_RELEASE(p, v) (*(p) = (v))
+#define FENCE_RELEASE() MemoryBarrier()  // the stores before it are not moved after the stores after it
+#else
+#define LOAD_ACQUIRE(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif
+
+typedef unsigned long long Limb;       // machine word of the Montgomery multiplication
+#define LIMB_BITS 64                   // bit length of Limb
+#define MAX_LIMBS (BIG_INT_BIT_LEN / LIMB_BITS + 1)  // words of a BigInt
+
+// CRT constants of the NTT primes p1, p2, p3, the inverses are in Montgomery form
+#define NTT_INV12 0x16c15c9882b93111ULL    // p1^-1 * 2^64 mod p2
+#define NTT_INV123 0x010b8fb0b8fb0b72ULL   // (p1 * p2)^-1 * 2^64 mod p3
+#define NTT_P1_MOD3 0x1612f684bda12f74ULL  // p1 * 2^64 mod p3
+#define NTT_P12_LO 0x5c80000000000001ULL   // p1 * p2, low word
+#define NTT_P12_HI 0x07d1000000000000ULL   // p1 * p2, high word
+
+#ifdef _WIN32
+typedef HANDLE Thread;                 // handle of a worker thread
+typedef CRITICAL_SECTION Mutex;        // lock of the data shared by the threads
+typedef CONDITION_VARIABLE Cond;       // condition variable, waited with a Mutex
+#else
+typedef pthread_t Thread;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t Cond;
+#endif
+
+#define ROTL64(x, n) ((x) << (n) | (x) >> (64 - (n)))
+#define ROTL32(x, n) ((x) << (n) | (x) >> (32 - (n)))
+
+// ChaCha20 quarter round
+#define CHACHA_QUARTER_ROUND(a, b, c, d) \
+    a += b; d ^= a; d = ROTL32(d, 16);   \
+    c += d; b ^= c; b = ROTL32(b, 12);   \
+    a += b; d ^= a; d = ROTL32(d, 8);    \
+    c += d; b ^= c; b = ROTL32(b, 7)
+
+typedef struct    // type:BigInt, use complement to store
+{
+    char bit[BIG_INT_BIT_LEN];
+}BigInt;
+
+typedef struct    // type:Number, use true value to store
+{
+    char value[BIG_INT_BIT_LEN];  // value array
+    int len;                      // array length
+    int sign;                     // POSITIVE(0) or NEGATIVE(1)
+}Number;
+
+typedef struct    // type:Workspace, scratch BigInts of the Do* kernels, used like a stack
+{
+    BigInt t[WORKSPACE_SIZE];     // scratch BigInts
+    BigInt spare;                 // given by WsAlloc when t is used up, the result is wrong then
+    int top;                      // count of the BigInts in use
+}Workspace;
+
+typedef struct    // type:Rng, random number generator state
+{
+    int secure;                   // 0: xoshiro256**, 1: ChaCha20 CSPRNG
+    unsigned long long s[4];      // xoshiro256** state
+    unsigned int key[16];         // ChaCha20 input block
+    unsigned int block[16];       // ChaCha20 output block
+    int pos;                      // next unused word of block
+}Rng;
+
+typedef struct    // type:Context, state of the Do* functions in a thread, so threads share nothing
+{
+    Rng rng;                      // random number generator
+    int rngReady;                 // 1 if rng is seeded
+    Workspace ws;                 // scratch BigInts of the functions without Ws
+    int error;                    // first error since GetError, ERROR_NONE for none
+    int quiet;                    // 1 to print no progress of the generations
+    int noCheckpoint;             // 1 to save and load no checkpoint, for the searches that run at the same time
+    long long powMod;             // count of DoPowMod
+    long long mrRound;            // count of Miller-Rabin rounds
+}Context;
+
+typedef struct    // type:Mont, Montgomery form of an odd modulus n
+{
+    Limb n[MAX_LIMBS];    // modulus
+    Limb rr[MAX_LIMBS];   // R^2 mod n
+    Limb one[MAX_LIMBS];  // R mod n, namely 1 in Montgomery form
+    Limb nInv;            // -n^-1 mod 2^64
+    int len;              // count of words of n
+}Mont;
+
+typedef struct    // type:MrModulus, precomputation of a modulus n shared by all its Miller-Rabin rounds
+{
+    Mont mt;                                        // Montgomery form of n
+    Limb minusOne[MAX_LIMBS];                       // n - 1 in Montgomery form
+    Limb t[MAX_LIMBS];                              // n - 1 = 2^s * t, t is odd
+    int tLen;                                       // count of words of t
+    int s;
+    int window;                                     // bits of the sliding windows of t
+    int stepNum;                                    // count of the windows of t
+    int tail;                                       // squarings after the last window
+    unsigned short square[MAX_LIMBS * LIMB_BITS];   // squarings before the window, the ones of the first are skipped
+    unsigned char digit[MAX_LIMBS * LIMB_BITS];     // the odd value of the window, from the highest one
+}MrModulus;
+
+typedef struct    // type:MrLanes, numbers in the lanes of the batch Miller-Rabin test for 64 bit numbers
+{
+    Limb n[MR64_LANES];           // the numbers
+    Limb nInv[MR64_LANES];        // -n^-1 mod 2^64
+    Limb one[MR64_LANES];         // R mod n, R = 2^64
+    Limb r2[MR64_LANES];          // R^2 mod n
+    Limb d[MR64_LANES];           // n - 1 = 2^s * d
+    int s[MR64_LANES];
+    long long s64[MR64_LANES];    // s in 64 bit, for the AVX2 lanes
+    Limb a[MR64_LANES];           // base of this round
+    Limb pass[MR64_LANES];        // not 0 if n passes this round
+    int maxBits;                  // the max bit length of d
+    int maxS;                     // the max s
+}MrLanes;
+
+typedef struct    // type:LargeMont, Montgomery form of an odd modulus of any word count, R = 2^(64 * len)
+{
+    Limb* n;      // modulus
+    Limb* nInv;   // -n^-1 mod R
+    Limb* one;    // R mod n
+    Limb* rr;     // R^2 mod n
+    Limb* t;      // scratch of LargeMontMul, 6 * len words
+    Limb* tmp;    // scratch of the multiplication, MUL_TMP_SIZE(len) words
+    int len;      // count of words of n
+}LargeMont;
+
+typedef struct    // type:NttPrime, prime p = c * 2^k + 1 of the number theoretic transform
+{
+    Limb p;       // the prime, less than 2^62
+    Limb pInv;    // -p^-1 mod 2^64
+    Limb r2;      // 2^128 mod p
+    Limb g;       // primitive root
+}NttPrime;
+
+#ifdef USE_AVX2
+typedef struct    // type:Mont4, Montgomery form of 4 odd moduli with the same word count
+{
+    __m256i n[2 * MAX_LIMBS];    // 32 bit words of the moduli, one lane for each
+    __m256i rr[2 * MAX_LIMBS];   // R^2 mod n
+    __m256i one[2 * MAX_LIMBS];  // R mod n
+    __m256i nInv;                // -n^-1 mod 2^32
+    int len;                     // count of 32 bit words
+}Mont4;
+#endif
+
+typedef struct    // type:Sieve, window of odd candidates base, base+2*dir, base+4*dir, ...
+{
+    BigInt base;                            // the first candidate of the window
+    int dir;                                // 1 for upward, -1 for downward
+    int safe;                               // 1 if 2x+1 is sieved too, for safe prime
+    unsigned int e;                         // 0 or RSA exponent, gcd(x-1, e) must be 1
+    unsigned int eResidue;                  // base % e
+    int primeNum;                           // count of small primes used
+    unsigned int residue[SMALL_PRIME_NUM];  // base % smallPrime[k]
+    char composite[SIEVE_WINDOW];           // 1 if base + 2i has a small factor
+}Sieve;
+
+typedef struct    // type:PrimeIter, lazy iterator of the primes from a start, upward or downward
+{
+    Sieve sv;                    // sieve window of the odd candidates
+    int pos;                     // next index of the sieve window
+    int times;                   // times of Miller-Rabin test
+    int two;                     // 1 if 2 is not given yet, it is out of the sieve
+    int end;                     // 1 if there is no odd candidate left, downward only
+    int num;                     // count of the candidates in the batch
+    int next;                    // next candidate of the batch
+    char pass[FERMAT_BATCH];     // 2: prime, 1: passes the Fermat test, 0: composite
+    BigInt cand[FERMAT_BATCH];   // the sieve survivors of the batch
+}PrimeIter;
+
+typedef struct    // type:RsaKey, RSA key pair with the CRT parameters
+{
+    BigInt n;     // modulus, n = p * q
+    BigInt e;     // public exponent
+    BigInt d;     // private exponent, d = e^-1 mod lcm(p-1, q-1)
+    BigInt p;     // the bigger prime factor
+    BigInt q;     // the smaller prime factor
+    BigInt dp;    // d mod (p - 1)
+    BigInt dq;    // d mod (q - 1)
+    BigInt qInv;  // q^-1 mod p
+}RsaKey;
+
+typedef struct    // type:RsaPrimeTask, argument of the thread which generates a prime of RSA
+{
+    int bitLen;       // bit length of the prime
+    int times;        // times of Miller-Rabin test
+    unsigned int e;   // public exponent
+    int seeded;       // 0 if the thread could not seed its CSPRNG, there is no prime then
+    BigInt result;    // the prime
+}RsaPrimeTask;
+
+typedef struct    // type:RangeState, shared state of a segmented prime enumeration of [a, b]
+{
+    Limb a[MAX_LIMBS];                      // start of the range
+    int len;                                // count of words of a
+    unsigned long long total;               // count of numbers, b - a + 1
+    int times;                              // times of Miller-Rabin test
+    unsigned int residue[SMALL_PRIME_NUM];  // a % smallPrime[k]
+}RangeState;
+
+typedef struct    // type:RangeTask, argument of the thread which takes the segments of a round
+{
+    RangeState* pr;             // the shared state
+    unsigned long long origin;  // offset of the round from a
+    unsigned long long end;     // offset after the round
+    int first;                  // index of the first segment of the thread in the round
+    int step;                   // count of threads, the segments are taken in turn
+    unsigned char* bitmap;      // bit i is set if a + origin + i is a prime
+    long long count;            // count of the primes found by the thread
+}RangeTask;
+
+typedef void (*PrimeRangeCallback)(BigInt* p, void* arg);  // called for each prime of DoPrimeRange
+
+typedef struct    // type:Checkpoint, search state of GenPrime and GenRandomPrime saved in a file
+{
+    unsigned int magic;      // CHECKPOINT_MAGIC
+    int size;                // sizeof(Checkpoint), the file of another build is not loaded
+    int kind;                // CHECKPOINT_GEN_PRIME or CHECKPOINT_RANDOM_PRIME
+    int bitLen;              // bit length of the prime
+    int times;               // times of Miller-Rabin test
+    long long tested;        // count of numbers tested
+    Limb cand[MAX_LIMBS];    // the next number to test, the sieve starts again at it
+    Rng rng;                 // random number generator of the thread
+}Checkpoint;
+
+typedef struct    // type:PrimeCacheEntry, a prime found by GenPrime or GenSafePrime
+{
+    volatile int ready;      // 1 if the prime is filled, it is cleared first and set last
+    int bitLen;              // bit length of the prime
+    int mode;                // PRIME_CACHE_GEN_PRIME or PRIME_CACHE_SAFE_PRIME
+    int times;               // times of Miller-Rabin test the prime has passed
+    Limb p[MAX_LIMBS];       // the prime
+}PrimeCacheEntry;
+
+typedef struct    // type:PrimeCache, file of the deterministic primes, mapped to memory
+{
+    unsigned int magic;      // PRIME_CACHE_MAGIC
+    int size;                // sizeof(PrimeCacheEntry), the file of another build is cleared
+    int bitLen;              // BIG_INT_BIT_LEN
+    int pad;
+    PrimeCacheEntry entry[PRIME_CACHE_MODES][BIG_INT_BIT_LEN];  // entry[mode][bitLen]
+}PrimeCache;
+
+typedef struct    // type:VerdictEntry, a number and its Miller-Rabin verdict in the verdict cache
+{
+    Limb n[MAX_LIMBS];       // the number
+    Limb hash;               // hash of the words of n
+    int rounds;              // count of the rounds passed, -1 if n is composite
+    int chain;               // next entry of the same bucket, -1 for none
+    int prev, next;          // list in the order of use, the head is the newest, -1 for none
+}VerdictEntry;
+
+typedef struct    // type:VerdictShard, a part of the verdict cache with its own lock
+{
+    Mutex lock;              // lock of the shard
+    VerdictEntry* entry;     // verdictCacheSize entries
+    int* bucket;             // first entry of each bucket, -1 for none, verdictCacheSize buckets
+    int count;               // count of the entries in use
+    int head, tail;          // the newest and the oldest entry, -1 for none
+}VerdictShard;
+
+typedef struct    // type:CombTable, Lim-Lee comb of a fixed base g and an odd modulus p, used by DoPowModFixed
+{
+    Mont mt;                 // Montgomery form of p
+    Limb g[MAX_LIMBS];       // the base, less than p
+    int bits;                // the exponent has at most bits bits, the bit length of p
+    int a;                   // bits of a tooth, a * COMB_TEETH >= bits
+    int v;                   // count of the blocks of a tooth
+    int b;                   // bits of a block, b * v >= a
+    Limb* table;             // v * 2^COMB_TEETH numbers of mt.len words in Montgomery form
+    int refs;                // the cache and each DoPowModFixed using it hold one, it is freed at 0
+    long long used;          // tick of the last use, the oldest one is dropped for a new one
+}CombTable;
+
+typedef struct    // type:DaemonMsg, header of a request or a response of the daemon, in host byte order
+{
+    unsigned char op;        // DAEMON_OP_IS_PRIME, DAEMON_OP_GEN_PRIME or DAEMON_OP_NEXT_PRIME
+    unsigned char flags;     // request: 1 for a random prime of gen-prime, response: DAEMON_OK or DAEMON_BAD_REQUEST
+    unsigned short times;    // times of Miller-Rabin test
+    unsigned int id;         // chosen by the client, the response has the same id
+    unsigned int len;        // bytes of the payload after the header
+}DaemonMsg;
+
+typedef struct DaemonJob    // type:DaemonJob, a request of a client of the daemon, then its response
+{
+    DaemonMsg msg;              // header of the request, then of the response
+    int client;                 // slot of the client
+    unsigned int serial;        // serial of the client in the slot, the response to a closed client is dropped
+    int bitLen;                 // bit length of gen-prime
+    int len;                    // words of n
+    Limb n[MAX_LIMBS];          // the number of is-prime and next-prime, then the result
+    struct DaemonJob* next;     // next job in the lane or in the done list
+}DaemonJob;
+
+typedef struct    // type:DaemonClient, a connection of the daemon, only used by the I/O thread
+{
+    int fd;                     // socket, -1 for a free slot
+    unsigned int serial;        // count of the connections in the slot
+    int inLen;                  // bytes in in
+    unsigned char in[sizeof(DaemonMsg) + DAEMON_MAX_PAYLOAD];  // the request being read
+    unsigned char* out;         // the responses not sent yet
+    int outLen;                 // bytes in out
+    int outSize;                // size of out
+    int pending;                // count of the jobs queued and not answered yet
+}DaemonClient;
+
+typedef struct    // type:Daemon, queues shared by the I/O thread and the workers of the daemon
+{
+    Mutex lock;                     // lock of the queues
+    Cond ready;                     // a job is queued, or a slow job is finished
+    DaemonJob* head[DAEMON_LANES];  // the queue of each lane
+    DaemonJob* tail[DAEMON_LANES];
+    DaemonJob* done;                // the finished jobs for the I/O thread
+    int slowBusy;                   // count of the workers on the slow lane
+    int slowMax;                    // max of slowBusy, so a worker is always left for the cheap lanes
+    int wake[2];                    // pipe, a worker writes a byte to it when its jobs are done
+}Daemon;
+
+typedef struct    // type:DaemonWorker, a worker of the daemon and its scratch
+{
+    Daemon* dm;                                 // the daemon
+    DaemonJob* job[8 * MR64_LANES];             // the batch of jobs taken from a lane
+    unsigned long long n64[8 * MR64_LANES];     // the numbers of a fast batch
+    char prime[8 * MR64_LANES];                 // the verdicts of a fast batch
+    BigInt cand[FERMAT_BATCH];                  // the big is-prime numbers of a normal batch
+    DaemonJob* candJob[FERMAT_BATCH];           // the jobs of cand
+    char pass[FERMAT_BATCH];                    // Fermat test of cand
+}DaemonWorker;
+
+typedef struct    // type:ShardMsg, a shard sent by the coordinator to a worker, in host byte order
+{
+    int times;            // times of Miller-Rabin test, 0 to stop the worker
+    int pad;
+    long long id;         // index of the shard
+    long long size;       // count of numbers, a, a + 1, ..., a + size - 1
+    Limb a[MAX_LIMBS];    // the first number of the shard
+}ShardMsg;
+
+typedef struct    // type:ShardResult, result of a shard sent by a worker, then (size + 7) / 8 bytes of bitmap
+{
+    long long id;         // index of the shard
+    long long count;      // count of the primes in the shard
+}ShardResult;
+
+typedef struct    // type:ShardWorker, a connection of a worker of DoShardRange
+{
+    int fd;               // socket, -1 for a free slot
+    long long shard;      // index of the shard given to the worker, -1 for none
+    int need;             // bytes of the result of the shard
+    int inLen;            // bytes in in
+    unsigned char* in;    // the result being read, a ShardResult and the bitmap
+}ShardWorker;
+
+typedef struct    // type:ShardSlot, a shard in the window of DoShardRange, shard id is in slot id % window
+{
+    int state;            // SHARD_PENDING, SHARD_RUNNING or SHARD_FINISHED
+    int tries;            // count of the workers that lost it
+    long long count;      // count of the primes
+    unsigned char* bits;  // bit i is set if the number i of the shard is a prime
+}ShardSlot;
+
+typedef struct    // type:PipeItem, a candidate passed between the stages of the pipeline
+{
+    long long seq;              // order of the candidate in the search, the prime with the smallest seq is the answer
+    BigInt n;                   // the candidate
+}PipeItem;
+
+typedef struct    // type:PipeRing, bounded ring of one producer thread and one consumer thread, with no lock
+{
+    volatile unsigned int head;    // count of the items taken, written by the consumer only
+    char pad0[60];                 // head and tail in their own cache lines
+    volatile unsigned int tail;    // count of the items put, written by the producer only
+    volatile unsigned int closed;  // set by the producer after its last item
+    char pad1[56];
+    PipeItem item[PIPE_RING];      // the slots
+}PipeRing;
+
+typedef struct    // type:Pipeline, shared state of the stages of DoGenPrimePipeline
+{
+    int times;                  // times of Miller-Rabin test
+    int num[3];                 // count of the threads of the sieve, filter and confirm stages
+    unsigned long minPrime;     // the sieve only uses the small primes less than it
+    BigInt start;               // the candidate of seq 0, seq i is start - 2i
+    PipeRing* ring[2];          // sieve i to filter j: ring[0][i * num[1] + j], filter i to confirm j: ring[1][i * num[2] + j]
+    volatile long long best;    // seq of the best prime found, PIPE_NONE for none
+    BigInt result;              // the prime of seq best
+    Mutex lock;                 // lock of best and result
+}Pipeline;
+
+typedef struct    // type:PipeWorker, a thread of a stage of the pipeline
+{
+    Pipeline* pl;               // the pipeline
+    int index;                  // index of the thread in its stage
+}PipeWorker;
+
+typedef void (*GenPrimeProgress)(long long tested, void* arg);  // called after each batch of candidates of a GenPrimeTask
+
+typedef struct    // type:GenPrimeTask, handle of a prime search running in its own thread
+{
+    int bitLen;                 // bit length of the prime
+    int times;                  // times of Miller-Rabin test
+    int random;                 // 0 for GenPrime, 1 for GenRandomPrime
+    long long deadline;         // NowMs() when the search stops, 0 for no deadline
+    volatile int cancel;        // set by GenPrimeCancel
+    int state;                  // GEN_TASK_RUNNING, GEN_TASK_FOUND, GEN_TASK_CANCELED or GEN_TASK_EXPIRED
+    long long tested;           // count of the candidates tested, by Fermat or Miller-Rabin
+    GenPrimeProgress progress;  // called in the thread of the search, NULL for none
+    void* arg;                  // argument of progress
+    BigInt result;              // the prime, if state is GEN_TASK_FOUND
+    Mutex lock;                 // lock of state
+    Cond finish;                // state is not GEN_TASK_RUNNING any more
+    Thread thread;              // thread of the search
+}GenPrimeTask;
+
+char* checkpointPath = NULL;   // checkpoint file of the prime search, NULL for no checkpoint
+int checkpointResume = 0;      // 1 to continue from the checkpoint file
+int checkpointInterval = 60;   // seconds between two checkpoints
+
+PrimeCache* primeCache = NULL;  // mapped prime cache file, NULL for no cache
+Mutex primeCacheLock;           // lock of the entries of the prime cache, the threads of a process fill them at the same time
+
+THREAD_LOCAL GenPrimeTask* threadTask = NULL;  // the search task of this thread, NULL for none
+
+VerdictShard verdictShard[VERDICT_SHARDS];  // shards of the verdict cache of MillerRabin
+int verdictCacheSize = 0;                   // max count of numbers in a shard, 0 for no cache
+
+CombTable** combCache = NULL;  // comb tables of DoPowModFixed, NULL for no cache
+int combCacheSize = 0;         // max count of comb tables, 0 for no cache
+long long combTick = 0;        // tick of the comb cache, increased by each use
+Mutex combLock;                // lock of the comb cache and the refs of its tables
+
+// smallPrime: odd primes less than SMALL_PRIME_BOUND, and the tables of the trial division
+// they are generated by GenPrimeTable and compiled in, so no sieve runs at startup
+#include "miller-rabin_table.h"
+
+// constants of the kernels, they are set at compile time and never written
+BigInt bigZero = {{0}};
+BigInt bigOne = {{1}};
+BigInt bigTwo = {{0, 1}};
+BigInt bigThree = {{1, 1}};
+
+// deterministic Miller-Rabin bases, all the 64 bit numbers are tested right
+unsigned long long mrBase64[MR_BASE64_NUM] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+unsigned long long mrBase32[MR_BASE32_NUM] = {2, 7, 61};
+unsigned int tinyPrime[TINY_PRIME_NUM] = {3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+// the 8 residues mod 30 prime to 30, and the bit of each residue in a byte of the wheel bitmap
+const unsigned char wheelResidue[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+const unsigned char wheelBit[30] = {0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 4, 0, 8, 0, 0, 0, 16, 0, 32, 0, 0, 0, 64, 0, 0, 0, 0, 0, 128};
+
+unsigned char* primeBitmap = NULL;  // mapped wheel bitmap of the primes less than 2^32, NULL for none
+
+// 29 * 2^57 + 1, 69 * 2^55 + 1, 27 * 2^56 + 1
+NttPrime nttPrime[NTT_PRIME_NUM] = {
+    {0x3a00000000000001ULL, 0x39ffffffffffffffULL, 0x1a11a7b9611a7baaULL, 3},
+    {0x2280000000000001ULL, 0x227fffffffffffffULL, 0x1b67e2519f8946b6ULL, 5},
+    {0x1b00000000000001ULL, 0x1affffffffffffffULL, 0x03bda12f684bda6dULL, 5}
+};
+
+// thresholds of LimbsMulFast in words, by the shorter operand, they can be tuned
+int karatsubaThreshold = 32;      // Karatsuba from it, schoolbook below it
+int toom3Threshold = 800;         // Toom-3 from it
+int nttThreshold = 8000;          // number theoretic transform from it
+
+int useSimd = 1;                  // 0 to force the scalar code, for benchmark
+int useAsm = 1;                   // 0 to force the C code of the word kernels, for benchmark
+
+THREAD_LOCAL Context threadContext;          // default context of each thread
+THREAD_LOCAL Context* threadCtx = NULL;      // context set by UseContext, NULL for threadContext
+
+// print BigInt
+void PrintBigInt(BigInt* a)
+{
+    int i;
+    for (i = SIGN_BIT; i >= 0; i--)
+        printf("%d", a->bit[i]);
+    printf("\n");
+}
+
+// print Number
+void PrintNumber(Number* n)
+{
+    int i;
+
+    if (n->sign == NEGATIVE)
+        printf("-");
+
+    for (i = n->len - 1; i >= 0; i--)
+    {
+        if (n->value[i] > 9)  // if radix > 10
+            printf("%c", n->value[i] - 10 + 'a');
+        else
+            printf("%d", n->value[i]);
+    }
+    printf("\n");
+}
+
+// change type: string to Number, return: Number*
+Number* StrToNumber(char* str, Number* n)
+{
+    int i, j;
+
+    if (str[0] == '-' || str[0] == '+')  // if str[0] is sign
+    {
+        n->len = strlen(str) - 1;
+        n->sign = str[0] == '+' ? POSITIVE : NEGATIVE;
+
+        for (i = 0, j = n->len; j > 0; j--, i++)
+        {
+            if (str[j] > '9')  // if radix > 10
+                n->value[i] = str[j] - 'a' + 10;
+            else
+                n->value[i] = str[j] - '0';
+        }
+    }
+    else  // default sign is POSITIVE
+    {
+        n->len = strlen(str);
+        n->sign = POSITIVE;
+
+        for (i = 0, j = n->len - 1; j >= 0; j--, i++)
+        {
+            if (str[j] > '9')  // if radix > 10
+                n->value[i] = str[j] - 'a' + 10;
+            else
+                n->value[i] = str[j] - '0';
+        }
+    }
+
+    return n;
+}
+
+// change type: Number to string, return char*
+char* NumberToStr(Number* n, char* str)
+{
+    int i = 0, j;
+
+    if (n->sign == NEGATIVE)
+        str[i++] = '-';
+
+    for (j = n->len - 1; j >= 0; j--)
+    {
+        if (n->value[j] > 9)  // if radix > 10
+            str[i++] = n->value[j] - 10 + 'a';
+        else
+            str[i++] = n->value[j] + '0';
+    }
+
+    str[i] = '\0';
+
+    return str;
+}
+
+// binary string to hexadecimal string
+char* BinStrToHexStr(char* binStr, char* hexStr)
+{
+    int i, j, t;
+    Number binNum;
+    Number hexNum;
+
+    StrToNumber(binStr, &binNum);
+
+    hexNum.sign = binNum.sign;
+    hexNum.len = (int)ceil(binNum.len / 4.0);
+
+    for (i = 0; i < hexNum.len; i++)
+    {
+        j = 4 * i;
+
+        t = binNum.value[j];
+
+        if (j + 1 < binNum.len)
+            t += 2 * binNum.value[j + 1];
+
+        if (j + 2 < binNum.len)
+            t += 4 * binNum.value[j + 2];
+
+        if (j + 3 < binNum.len)
+            t += 8 * binNum.value[j + 3];
+
+        hexNum.value[i] = t;
+    }
+
+    return NumberToStr(&hexNum, hexStr);
+}
+
+// change string radix from srcRadix to dstRadix
+char* ChangeStringRadix(char* str, int srcRadix, int dstRadix, char* resultStr)
+{
+    if (srcRadix < dstRadix)
+    {
+        char hexStr[BUFFER_SIZE];
+
+        ChangeStringRadix(str, srcRadix, 2, resultStr);  // srcRadix to radix 2
+        BinStrToHexStr(resultStr, hexStr);               // radix 2 to 16
+
+        // radix 16 to dstRadix
+        return ChangeStringRadix(hexStr, 16, dstRadix, resultStr);
+    }
+
+    if (srcRadix == dstRadix)
+    {
+        return strcpy(resultStr, str);
+    }
+
+    else  // srcRadix > dstRadix
+    {
+        int i, t;
+        Number dividend;
+        Number quotient;
+        Number resultNum;
+
+        // string to Number
+        StrToNumber(str, &dividend);
+
+        resultNum.len = 0;
+        resultNum.sign = dividend.sign;
+
+        while (dividend.len > 0)
+        {
+            quotient.len = dividend.len;
+
+            // simulate the way we do division
+            // when the cycle is end, t is the remainder
+            for (t = 0, i = dividend.len - 1; i >= 0; i--)
+            {
+                t = t * srcRadix + dividend.value[i];
+                quotient.value[i] = t / dstRadix;
+                t = t % dstRadix;
+            }
+
+            // save the remainder
+            resultNum.value[resultNum.len++] = t;
+
+            // filter the unnecessary 0 in quotient
+            for (i = quotient.len - 1; i >= 0 && quotient.value[i] == 0; i--);
+
+            // set the next dividend length
+            dividend.len = i + 1;
+
+            // let the quotient be the next divident
+            for (i = 0; i < dividend.len; i++)
+            {
+                dividend.value[i] = quotient.value[i];
+            }
+        }
+
+        return NumberToStr(&resultNum, resultStr);
+    }
+}
+
+// true form <=> complement
+BigInt* ToComplement(BigInt* src, BigInt* dst)
+{
+    int i;
+
+    if (src->bit[SIGN_BIT] == NEGATIVE)  // NEGATIVE
+    {
+        dst->bit[SIGN_BIT] = 1;
+
+        for (i = 0; i < SIGN_BIT && src->bit[i] == 0; i++)
+            dst->bit[i] = src->bit[i];
+
+        if (i == SIGN_BIT)  // notice: this is -0 complement
+            dst->bit[i] = 0;
+        else
+        {
+            dst->bit[i] = src->bit[i];
+            for (i++; i < SIGN_BIT; i++)
+                dst->bit[i] = !src->bit[i];
+        }
+    }
+    else  // POSITIVE
+    {
+        for (i = 0; i < BIG_INT_BIT_LEN; i++)
+            dst->bit[i] = src->bit[i];
+    }
+
+    return dst;
+}
+
+// complement to true form
+BigInt* ToTrueForm(BigInt* src, BigInt* dst)
+{
+    return ToComplement(src, dst);
+}
+
+
+// [x] complement to [-x] complement
+// notice: for example, if BigInt bit length is 8
+// it can not get the [-128] complement, overflow
+BigInt* ToOppositeNumberComplement(BigInt* src, BigInt* dst)
+{
+    int i;
+
+    for (i = 0; i < BIG_INT_BIT_LEN && src->bit[i] == 0; i++)
+        dst->bit[i] = src->bit[i];
+
+    // if src is not 0
+    if (i != BIG_INT_BIT_LEN)
+    {
+        dst->bit[i] = src->bit[i];
+
+        // the sign bit should reverse too
+        for (i++; i < BIG_INT_BIT_LEN; i++)
+            dst->bit[i] = !src->bit[i];
+    }
+
+    return dst;
+}
+
+/* basic implement
+// [x] complement to [-x] complement
+BigInt* ToOppositeNumberComplement(BigInt* src, BigInt* dst)
+{
+    BigInt t;
+
+    ToTrueForm(src, &t);
+    t.bit[SIGN_BIT] = !t.bit[SIGN_BIT];
+    ToComplement(&t, dst);
+
+    return dst;
+}
+*/
+
+// change type: binary Number to BigInt
+BigInt* BinNumToBigInt(Number* binNum, BigInt* a)
+{
+    int i;
+
+    memset(a->bit, 0, BIG_INT_BIT_LEN);  // init 0
+
+    for (i = 0; i < binNum->len; i++)
+    {
+        a->bit[i] = binNum->value[i];
+    }
+
+    // if BigInt is the smallest nagative number
+    // for example, if BigInt bit len is 4, BigInt is 1000
+    if (binNum->len == BIG_INT_BIT_LEN)
+    {
+        return a;
+    }
+    else
+    {
+        a->bit[SIGN_BIT] = binNum->sign;
+        return ToComplement(a, a);
+    }
+}
+
+// change type: BigInt to binary Number
+Number* BigIntToBinNum(BigInt* a, Number* binNum)
+{
+    int i;
+    BigInt t;
+
+    binNum->sign = a->bit[SIGN_BIT];
+
+    for (i = SIGN_BIT - 1; i >= 0 && a->bit[i] == 0; i--);
+
+    // if BigInt is the smallest nagative number
+    // for example, if BigInt bit len is 4, BigInt is 1000
+    if (binNum->sign == NEGATIVE && i == -1)
+    {
+        binNum->len = BIG_INT_BIT_LEN;
+        for (i = 0; i < binNum->len; i++)
+            binNum->value[i] = a->bit[i];
+    }
+    else
+    {
+        ToTrueForm(a, &t);
+        for (i = SIGN_BIT - 1; i >= 0 && t.bit[i] == 0; i--);
+        binNum->len = i == -1 ? 1 : i + 1;
+        for (i = 0; i < binNum->len; i++)
+            binNum->value[i] = t.bit[i];
+    }
+
+    return binNum;
+}
+
+// change type: string to BigInt, use complement to store
+BigInt* StrToBigInt(char* s, BigInt* a)
+{
+    char buf[BUFFER_SIZE];
+    Number binNum;
+
+    ChangeStringRadix(s, 10, 2, buf);    // string radix 10 to 2
+    StrToNumber(buf, &binNum);           // string to Number
+    return BinNumToBigInt(&binNum, a);   // Number to BigInt
+}
+
+// change type: BigInt to string(radix 10)
+char* BigIntToStr(BigInt* a, char* s)
+{
+    char buf[BUFFER_SIZE];
+    Number binNum;
+
+    BigIntToBinNum(a, &binNum);     // BigInt to Number
+    NumberToStr(&binNum, buf);      // Number to string
+
+    return ChangeStringRadix(buf, 2, 10, s);  // string radix 2 to 10
+}
+
+// change type: long to BigInt, use complement to store
+BigInt* LongToBigInt(long v, BigInt* a)
+{
+    int i;
+    unsigned long t = v < 0 ? -(unsigned long)v : (unsigned long)v;
+
+    memset(a->bit, 0, BIG_INT_BIT_LEN);
+
+    for (i = 0; t != 0; i++, t >>= 1)
+        a->bit[i] = (char)(t & 1);
+
+    a->bit[SIGN_BIT] = v < 0 ? NEGATIVE : POSITIVE;
+
+    return ToComplement(a, a);
+}
+
+// copy BigInt
+BigInt* CopyBigInt(BigInt* src, BigInt* dst)
+{
+    int i;
+    for (i = 0; i < BIG_INT_BIT_LEN; i++)
+        dst->bit[i] = src->bit[i];
+    return dst;
+}
+
+// Shift Arithmetic Left
+BigInt* ShiftArithmeticLeft(BigInt* src, int indent, BigInt* dst)
+{
+    int i, j;
+
+    dst->bit[SIGN_BIT] = src->bit[SIGN_BIT];
+
+    for (i = SIGN_BIT - 1, j = i - indent; j >= 0; i--, j--)
+    {
+        dst->bit[i] = src->bit[j];
+    }
+
+    while (i >= 0)
+    {
+        dst->bit[i--] = 0;
+    }
+
+    return dst;
+}
+
+// Shift Arithmetic Right
+BigInt* ShiftArithmeticRight(BigInt* src, int indent, BigInt* dst)
+{
+    int i, j;
+
+    dst->bit[SIGN_BIT] = src->bit[SIGN_BIT];
+
+    for (i = 0, j = i + indent; j < SIGN_BIT; i++, j++)
+    {
+        dst->bit[i] = src->bit[j];
+    }
+
+    while (i < SIGN_BIT)
+    {
+        dst->bit[i++] = src->bit[SIGN_BIT];
+    }
+
+    return dst;
+}
+
+// get the context of this thread, the one of UseContext or the default one of the thread
+// the string functions use it too
+Context* GetContext()
+{
+    Context* ctx = threadCtx;
+
+    return ctx != NULL ? ctx : &threadContext;
+}
+
+// make ctx the context of the Do* functions in this thread, NULL for the default one
+// return the context used before, a context must be used by one thread at a time
+Context* UseContext(Context* ctx)
+{
+    Context* old = GetContext();
+
+    threadCtx = ctx;
+
+    return old;
+}
+
+// init a context, its random number generator is seeded from the operating system at the first use
+Context* InitContext(Context* ctx)
+{
+    memset(ctx, 0, sizeof(Context));
+
+    return ctx;
+}
+
+// return the first error of the context of this thread since the last call, and clear it
+int GetError()
+{
+    Context* ctx = GetContext();
+    int error = ctx->error;
+
+    ctx->error = ERROR_NONE;
+
+    return error;
+}
+
+// keep the first error in the context of this thread
+void SetError(int error)
+{
+    Context* ctx = GetContext();
+
+    if (ctx->error == ERROR_NONE)
+        ctx->error = error;
+}
+
+// clear the error of the context of this thread, the string functions call it first
+void ClearError()
+{
+    GetContext()->error = ERROR_NONE;
+}
+
+// change type: BigInt to string(radix 10) for the result of a string function
+// return NULL if a is NULL or an error is set since ClearError
+char* ResultToStr(BigInt* a, char* s)
+{
+    if (GetError() != ERROR_NONE || a == NULL)
+        return NULL;
+
+    return BigIntToStr(a, s);
+}
+
+// print the progress of a generation like printf, nothing if the context of this thread is quiet
+void PrintProgress(char* format, ...)
+{
+    va_list ap;
+
+    if (GetContext()->quiet)
+        return;
+
+    va_start(ap, format);
+    vprintf(format, ap);
+    va_end(ap);
+}
+
+// get the workspace of this thread, the Do* functions without Ws use it
+Workspace* GetThreadWorkspace()
+{
+    return &GetContext()->ws;
+}
+
+// take a scratch BigInt from the workspace, it is not initialized
+// if the workspace is used up, set ERROR_MEMORY and give the spare one, so WsFree still matches,
+// and the string functions return NULL
+BigInt* WsAlloc(Workspace* ws)
+{
+    if (ws->top >= WORKSPACE_SIZE)
+    {
+        SetError(ERROR_MEMORY);
+        ws->top++;
+        return &ws->spare;
+    }
+
+    return &ws->t[ws->top++];
+}
+
+// give back the last n scratch BigInts
+void WsFree(Workspace* ws, int n)
+{
+    ws->top -= n;
+}
+
+// implement of Addition
+// result = a + b, an overflow sets ERROR_OVERFLOW in the context of this thread
+BigInt* DoAdd(BigInt* a, BigInt* b, BigInt* result)
+{
+    int i, t, carryFlag;
+    int aSign = a->bit[SIGN_BIT];  // a sign
+    int bSign = b->bit[SIGN_BIT];  // b sign
+
+    for (carryFlag = i = 0; i < BIG_INT_BIT_LEN; i++)
+    {
+        t = a->bit[i] + b->bit[i] + carryFlag;
+        result->bit[i] = t % 2;
+        carryFlag = t > 1 ? 1 : 0;
+    }
+
+    if (aSign == bSign && aSign != result->bit[SIGN_BIT])
+        SetError(ERROR_OVERFLOW);
+
+    return result;
+}
+
+// implement of Subtraction
+// result = a - b = a + ~b + 1, no copy of -b, result can be a or b
+// an overflow sets ERROR_OVERFLOW in the context of this thread
+BigInt* DoSub(BigInt* a, BigInt* b, BigInt* result)
+{
+    int i, t, carryFlag;
+    int aSign = a->bit[SIGN_BIT];   // a sign
+    int bSign = !b->bit[SIGN_BIT];  // ~b sign
+
+    for (carryFlag = 1, i = 0; i < BIG_INT_BIT_LEN; i++)
+    {
+        t = a->bit[i] + !b->bit[i] + carryFlag;
+        result->bit[i] = t & 1;
+        carryFlag = t >> 1;
+    }
+
+    if (aSign == bSign && aSign != result->bit[SIGN_BIT])
+        SetError(ERROR_OVERFLOW);
+
+    return result;
+}
+
+// the highest bit which is not the sign bit, -1 if there is none
+int GetTopBit(BigInt* a)
+{
+    int i;
+    char s = a->bit[SIGN_BIT];
+
+    for (i = SIGN_BIT - 1; i >= 0 && a->bit[i] == s; i--);
+
+    return i;
+}
+
+// t = t + (a << k), top: GetTopBit(a)
+// the bits of a above top are all the sign bit, so the sum stops changing
+// once the carry is the same as the sign bit
+void DoAddShifted(BigInt* t, BigInt* a, int k, int top)
+{
+    int i, j, s, carryFlag;
+    char sign = a->bit[SIGN_BIT];
+
+    for (carryFlag = 0, i = k, j = 0; i < BIG_INT_BIT_LEN; i++, j++)
+    {
+        if (j > top && carryFlag == sign)
+            break;
+
+        s = t->bit[i] + a->bit[j] + carryFlag;
+        t->bit[i] = s & 1;
+        carryFlag = s >> 1;
+    }
+}
+
+// implement of Multiplication by using Booth algorithm
+// b = sum of (b[k-1] - b[k]) * 2^k, b[-1] = 0
+// so add a << k or -a << k at each change of the bits of b, no shift of the sum
+// result = a * b, result can be a or b, an overflow sets ERROR_OVERFLOW in the context of this thread
+BigInt* DoMulWs(BigInt* a, BigInt* b, BigInt* result, Workspace* ws)
+{
+    int i, aTop, bTop, cTop, used = 1;
+    char sign = a->bit[SIGN_BIT] ^ b->bit[SIGN_BIT];  // sign of the product
+    BigInt *c, *t;
+
+    c = WsAlloc(ws);
+    ToOppositeNumberComplement(a, c);  // c = [-a] complement
+    aTop = GetTopBit(a);
+    bTop = GetTopBit(b);
+    cTop = GetTopBit(c);
+
+    // write the sum to result directly if it is not an operand
+    if (result == a || result == b)
+    {
+        t = WsAlloc(ws);
+        used++;
+    }
+    else
+        t = result;
+
+    memset(t->bit, 0, BIG_INT_BIT_LEN);  // init 0
+
+    if (b->bit[0] != 0)
+        DoAddShifted(t, c, 0, cTop);
+
+    for (i = 1; i < BIG_INT_BIT_LEN; i++)
+    {
+        if (b->bit[i] != b->bit[i - 1])
+        {
+            if (b->bit[i - 1] > b->bit[i])
+                DoAddShifted(t, a, i, aTop);
+            else
+                DoAddShifted(t, c, i, cTop);
+        }
+    }
+
+    // |a| is in [2^aTop, 2^(aTop+1)], so |a * b| is in [2^(aTop+bTop), 2^(aTop+bTop+2)]
+    // the sum is the product mod 2^BIG_INT_BIT_LEN, near the limit it overflowed if its sign is wrong or it is 0
+    if (aTop + bTop >= SIGN_BIT ||
+        (aTop + bTop >= SIGN_BIT - 2 && (t->bit[SIGN_BIT] != sign || GetTopBit(t) < 0)))
+        SetError(ERROR_OVERFLOW);
+
+    if (t != result)
+        CopyBigInt(t, result);
+
+    WsFree(ws, used);
+
+    return result;
+}
+
+// result = a * b
+BigInt* DoMul(BigInt* a, BigInt* b, BigInt* result)
+{
+    return DoMulWs(a, b, result, GetThreadWorkspace());
+}
+
+// get the max left shift length, it is read from the complement directly
+// |a| = ~a + 1 for a negative a, which is one bit longer if the lower bits are all 0
+int GetMaxLeftShiftLen(BigInt* a)
+{
+    int i, j;
+
+    i = GetTopBit(a);
+
+    if (a->bit[SIGN_BIT] == NEGATIVE)
+    {
+        for (j = 0; j < i && a->bit[j] == 0; j++);
+
+        if (j >= i)
+            i++;
+
+        if (i == SIGN_BIT)  // -0
+            return SIGN_BIT;
+    }
+
+    return SIGN_BIT - 1 - i;
+}
+
+// get the max right shift length
+int GetMaxRightShiftLen(BigInt* a)
+{
+    int i;
+
+    for (i = 0; i < SIGN_BIT && a->bit[i] == 0; i++);
+
+    return i;
+}
+
+// check if a bigint is 0
+int IsZero(BigInt* a)
+{
+    int i;
+    for (i = 0; i < BIG_INT_BIT_LEN; i++)
+    {
+        if (a->bit[i] != 0)
+            return 0;
+    }
+    return 1;
+}
+
+// implement of division by using binary search
+// result = a / b
+// the temporaries are taken from ws, result and remainder can be a or b
+BigInt* DoDivWs(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder, Workspace* ws)
+{
+    int low, high, mid;
+    BigInt *c, *d, *e, *t;
+
+    c = WsAlloc(ws);  // dividend
+    d = WsAlloc(ws);  // shifted divisor
+    e = WsAlloc(ws);  // trial difference
+    t = WsAlloc(ws);  // quotient
+
+    low = 0;                       // the min of left shift
+    high = GetMaxLeftShiftLen(b);  // the max of left shift
+
+    memset(t->bit, 0, BIG_INT_BIT_LEN);  // init 0
+    CopyBigInt(a, c);                   // c = a
+
+    // if a sign == b sign, do subtraction
+    if (a->bit[SIGN_BIT] == b->bit[SIGN_BIT])
+    {
+        t->bit[SIGN_BIT] = POSITIVE;
+
+        while (1)
+        {
+            while (low <= high)
+            {
+                mid = (low + high) / 2;
+                ShiftArithmeticLeft(b, mid, d);
+                DoSub(c, d, e);  // e = c - d
+
+                // e >= 0
+                if (d->bit[SIGN_BIT] == e->bit[SIGN_BIT] || IsZero(e))
+                    low = mid + 1;
+                else
+                    high = mid - 1;
+            }
+
+            // high == -1 means c - b < 0
+            if (high != -1)
+            {
+                t->bit[high] = 1;
+
+                // here unified the operation
+                // it can improve i think
+                ShiftArithmeticLeft(b, high, d);
+
+                // c = c - d, let c be the next dividend
+                DoSub(c, d, c);
+
+                low = 0;
+                high--;
+            }
+            else
+            {
+                // now the dividend c is the remainder
+                CopyBigInt(c, remainder);
+                break;
+            }
+        }
+    }
+
+    // if a sign != b sign, do addition
+    else
+    {
+        t->bit[SIGN_BIT] = NEGATIVE;
+
+        while (1)
+        {
+            while (low <= high)
+            {
+                mid = (low + high) / 2;
+                ShiftArithmeticLeft(b, mid, d);
+                DoAdd(c, d, e);  // e = c + d
+
+                // e >= 0
+                if (d->bit[SIGN_BIT] != e->bit[SIGN_BIT] || IsZero(e))
+                    low = mid + 1;
+                else
+                    high = mid - 1;
+            }
+
+            // high == -1 means c - b < 0
+            if (high != -1)
+            {
+                t->bit[high] = 1;
+
+                // here unified the operation
+                // it can improve i think
+                ShiftArithmeticLeft(b, high, d);
+
+                // c = c + d, let c be the next dividend
+                DoAdd(c, d, c);
+
+                low = 0;
+                high--;
+            }
+            else
+            {
+                // now the dividend c is the remainder
+                CopyBigInt(c, remainder);
+                break;
+            }
+        }
+    }
+
+    ToComplement(t, result);
+    WsFree(ws, 4);
+
+    return result;
+}
+
+// result = a / b
+BigInt* DoDiv(BigInt* a, BigInt* b, BigInt* result, BigInt* remainder)
+{
+    return DoDivWs(a, b, result, remainder, GetThreadWorkspace());
+}
+
+// Addition
+char* Add(char* s1, char* s2, char* result)
+{
+    BigInt a, b, c;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    DoAdd(&a, &b, &c);
+
+    return ResultToStr(&c, result);
+}
+
+// Subtraction
+char* Sub(char* s1, char* s2, char* result)
+{
+    BigInt a, b, c;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    DoSub(&a, &b, &c);
+
+    return ResultToStr(&c, result);
+}
+
+// Multiplication
+char* Mul(char* s1, char* s2, char* result)
+{
+    BigInt a, b, c;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    DoMul(&a, &b, &c);
+
+    return ResultToStr(&c, result);
+}
+
+// Division
+char* Div(char* s1, char* s2, char* result, char* remainder)
+{
+    BigInt a, b, c, d;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    DoDiv(&a, &b, &c, &d);
+    if (ResultToStr(&d, remainder) == NULL)
+        return NULL;
+
+    return BigIntToStr(&c, result);
+}
+
+// compare two BigInt
+// a > b, return 1
+// a = b, return 0
+// a < b, resutn -1
+// with the same sign, the complements compare like unsigned numbers
+int DoCompare(BigInt* a, BigInt* b)
+{
+    int i;
+
+    if (a->bit[SIGN_BIT] != b->bit[SIGN_BIT])
+        return a->bit[SIGN_BIT] == POSITIVE ? 1 : -1;
+
+    for (i = SIGN_BIT - 1; i >= 0 && a->bit[i] == b->bit[i]; i--);
+
+    if (i < 0)
+        return 0;
+
+    return a->bit[i] > b->bit[i] ? 1 : -1;
+}
+
+// compare two BigInt
+// a > b, return 1
+// a = b, return 0
+// a < b, resutn -1
+int Compare(char* s1, char* s2)
+{
+    BigInt a, b;
+
+    StrToBigInt(s1, &a);
+    StrToBigInt(s1, &b);
+
+    return DoCompare(&a, &b);
+}
+
+// implement of mod, by using division
+BigInt* DoModWs(BigInt* a, BigInt* b, BigInt* remainder, Workspace* ws)
+{
+    DoDivWs(a, b, WsAlloc(ws), remainder, ws);
+    WsFree(ws, 1);
+
+    return remainder;
+}
+
+BigInt* DoMod(BigInt* a, BigInt* b, BigInt* remainder)
+{
+    return DoModWs(a, b, remainder, GetThreadWorkspace());
+}
+
+// result = a * b % n, result can be a, b or n
+BigInt* DoMulModWs(BigInt* a, BigInt* b, BigInt* n, BigInt* result, Workspace* ws)
+{
+    BigInt* t = WsAlloc(ws);
+
+    DoMulWs(a, b, t, ws);
+    DoModWs(t, n, result, ws);
+    WsFree(ws, 1);
+
+    return result;
+}
+
+BigInt* DoMulMod(BigInt* a, BigInt* b, BigInt* n, BigInt* result)
+{
+    return DoMulModWs(a, b, n, result, GetThreadWorkspace());
+}
+
+char* Mod(char* s1, char* s2, char* remainder)
+{
+    BigInt a, b, c;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    DoMod(&a, &b, &c);
+
+    return ResultToStr(&c, remainder);
+}
+
+// get the length of true value
+int GetTrueValueLen(BigInt* a)
+{
+    return SIGN_BIT - GetMaxLeftShiftLen(a);
+}
+
+// (hi, lo) = a * b, the 128 bit product of two words, return lo
+static INLINE Limb MulLimb(Limb a, Limb b, Limb* hi)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 t = (unsigned __int128)a * b;
+
+    *hi = (Limb)(t >> 64);
+    return (Limb)t;
+#else
+    Limb a0 = a & 0xffffffff, a1 = a >> 32;
+    Limb b0 = b & 0xffffffff, b1 = b >> 32;
+    Limb p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    Limb mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return mid << 32 | (p00 & 0xffffffff);
+#endif
+}
+
+// q = (hi, lo) / d, r = (hi, lo) % d, hi must be less than d
+static INLINE Limb DivLimb(Limb hi, Limb lo, Limb d, Limb* r)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 t = (unsigned __int128)hi << 64 | lo;
+
+    *r = (Limb)(t % d);
+    return (Limb)(t / d);
+#else
+    int i;
+    Limb c, q = 0;
+
+    for (i = 0; i < LIMB_BITS; i++)
+    {
+        c = hi >> 63;
+        hi = hi << 1 | lo >> 63;
+        lo <<= 1;
+        q <<= 1;
+
+        if (c || hi >= d)
+        {
+            hi -= d;
+            q |= 1;
+        }
+    }
+
+    *r = hi;
+    return q;
+#endif
+}
+
+// change type: BigInt to words, a must be non-negative
+// x has MAX_LIMBS words, return: the count of words without leading 0
+int BigIntToLimbs(BigInt* a, Limb* x)
+{
+    int i, j, len;
+
+    for (i = 0; i < MAX_LIMBS; i++)
+    {
+        x[i] = 0;
+        for (j = LIMB_BITS - 1; j >= 0; j--)
+        {
+            if (i * LIMB_BITS + j < SIGN_BIT)
+                x[i] = x[i] << 1 | a->bit[i * LIMB_BITS + j];
+            else
+                x[i] <<= 1;
+        }
+    }
+
+    for (len = MAX_LIMBS; len > 0 && x[len - 1] == 0; len--);
+
+    return len;
+}
+
+// change type: n words to BigInt
+BigInt* LimbsToBigInt(Limb* x, int n, BigInt* a)
+{
+    int i;
+
+    memset(a->bit, 0, BIG_INT_BIT_LEN);
+
+    for (i = 0; i < n * LIMB_BITS && i < SIGN_BIT; i++)
+        a->bit[i] = (char)(x[i / LIMB_BITS] >> (i % LIMB_BITS) & 1);
+
+    return a;
+}
+
+// compare two n words numbers
+// a > b, return 1
+// a = b, return 0
+// a < b, resutn -1
+int LimbsCompare(Limb* a, Limb* b, int n)
+{
+    int i;
+
+    for (i = n - 1; i >= 0; i--)
+    {
+        if (a[i] != b[i])
+            return a[i] > b[i] ? 1 : -1;
+    }
+
+    return 0;
+}
+
+// check if the CPU supports BMI2 (MULX) and ADX (ADCX, ADOX)
+int CpuHasAdx()
+{
+#ifdef USE_ADX
+    static THREAD_LOCAL int has = -1;  // checked once in each thread, so the threads share no state
+    unsigned int a, b, c, d;
+
+    if (has < 0)
+        has = __get_cpuid_count(7, 0, &a, &b, &c, &d) && (b >> 8 & 1) && (b >> 19 & 1);
+
+    return has;
+#else
+    return 0;
+#endif
+}
+
+#ifdef USE_ADX
+// r = a * b, r and a are n words (n > 0), return the carry word
+// one carry chain: CF for lo + the previous hi
+static Limb LimbsMul1Adx(Limb* r, Limb* a, long n, Limb b)
+{
+    Limb lo, hi, c = 0;
+
+    __asm__ volatile(
+        "xorl %k[lo], %k[lo]\n\t"           // clear CF and OF
+        "1:\n\t"
+        "mulxq (%[a]), %[lo], %[hi]\n\t"    // hi:lo = a[i] * b
+        "adcxq %[c], %[lo]\n\t"             // lo = lo + c + CF
+        "movq %[lo], (%[r])\n\t"
+        "movq %[hi], %[c]\n\t"
+        "leaq 8(%[a]), %[a]\n\t"            // lea and jrcxz do not change the flags
+        "leaq 8(%[r]), %[r]\n\t"
+        "leaq -1(%%rcx), %%rcx\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %k[lo]\n\t"
+        "adcxq %[lo], %[c]\n\t"             // c = c + CF
+        : [c] "+&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [a] "+&r"(a), [r] "+&r"(r), "+c"(n)
+        : "d"(b)
+        : "cc", "memory");
+
+    return c;
+}
+
+// r = r + a * b, r and a are n words (n > 0), return the carry word
+// two carry chains: CF for lo + the previous hi, OF for adding it to r[i]
+// the loop does 2 words each time, an odd word is done first in C
+static Limb LimbsAddMul1Adx(Limb* r, Limb* a, long n, Limb b)
+{
+    Limb lo, hi, lo2, hi2, c = 0;
+
+    if (n & 1)
+    {
+        lo = MulLimb(a[0], b, &hi);
+        r[0] += lo;
+        c = hi + (r[0] < lo);
+
+        if (--n == 0)
+            return c;
+        r++;
+        a++;
+    }
+    n /= 2;
+
+    __asm__ volatile(
+        "xorl %k[lo], %k[lo]\n\t"           // clear CF and OF
+        "1:\n\t"
+        "mulxq (%[a]), %[lo], %[hi]\n\t"    // hi:lo = a[i] * b
+        "mulxq 8(%[a]), %[lo2], %[hi2]\n\t" // hi2:lo2 = a[i+1] * b
+        "adcxq %[c], %[lo]\n\t"             // lo = lo + c + CF
+        "adoxq (%[r]), %[lo]\n\t"           // lo = lo + r[i] + OF
+        "movq %[lo], (%[r])\n\t"
+        "adcxq %[hi], %[lo2]\n\t"           // lo2 = lo2 + hi + CF
+        "adoxq 8(%[r]), %[lo2]\n\t"         // lo2 = lo2 + r[i+1] + OF
+        "movq %[lo2], 8(%[r])\n\t"
+        "movq %[hi2], %[c]\n\t"
+        "leaq 16(%[a]), %[a]\n\t"
+        "leaq 16(%[r]), %[r]\n\t"
+        "leaq -1(%%rcx), %%rcx\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %k[lo]\n\t"
+        "adcxq %[lo], %[c]\n\t"             // c = c + CF + OF, it does not overflow
+        "adoxq %[lo], %[c]\n\t"
+        : [c] "+&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [lo2] "=&r"(lo2), [hi2] "=&r"(hi2),
+          [a] "+&r"(a), [r] "+&r"(r), "+c"(n)
+        : "d"(b)
+        : "cc", "memory");
+
+    return c;
+}
+
+// r = r - a * b, r and a are n words (n > 0), return the borrow word
+// r - t = r + ~t + 1, so the subtraction is an addition on the OF chain, which starts at 1
+static Limb LimbsSubMul1Adx(Limb* r, Limb* a, long n, Limb b)
+{
+    Limb lo, hi, t, c = 0;
+
+    __asm__ volatile(
+        "xorl %k[lo], %k[lo]\n\t"           // clear CF and OF
+        "movq $-1, %[t]\n\t"
+        "adoxq %[t], %[t]\n\t"              // set OF
+        "1:\n\t"
+        "mulxq (%[a]), %[lo], %[hi]\n\t"    // hi:lo = a[i] * b
+        "adcxq %[c], %[lo]\n\t"             // lo = lo + c + CF
+        "notq %[lo]\n\t"
+        "movq (%[r]), %[t]\n\t"
+        "adoxq %[lo], %[t]\n\t"             // r[i] = r[i] + ~lo + OF
+        "movq %[t], (%[r])\n\t"
+        "movq %[hi], %[c]\n\t"
+        "leaq 8(%[a]), %[a]\n\t"
+        "leaq 8(%[r]), %[r]\n\t"
+        "leaq -1(%%rcx), %%rcx\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %k[lo]\n\t"
+        "movl $0, %k[t]\n\t"
+        "adcxq %[lo], %[c]\n\t"             // c = c + CF
+        "adoxq %[lo], %[t]\n\t"             // t = OF, 0 means a borrow
+        "xorq $1, %[t]\n\t"
+        "addq %[t], %[c]\n\t"
+        : [c] "+&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi), [t] "=&r"(t), [a] "+&r"(a), [r] "+&r"(r), "+c"(n)
+        : "d"(b)
+        : "cc", "memory");
+
+    return c;
+}
+#endif
+
+// r = a + b, all n words, return the carry
+Limb LimbsAdd(Limb* r, Limb* a, Limb* b, int n)
+{
+    int i;
+    Limb t, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        t = a[i] + c;
+        c = t < c;
+        r[i] = t + b[i];
+        c += r[i] < t;
+    }
+
+    return c;
+}
+
+// r = a - b, all n words, return the borrow
+Limb LimbsSub(Limb* r, Limb* a, Limb* b, int n)
+{
+    int i;
+    Limb t, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        t = a[i] - c;
+        c = t > a[i];
+        r[i] = t - b[i];
+        c += r[i] > t;
+    }
+
+    return c;
+}
+
+// r = a * b, r and a are n words, return the carry word
+static INLINE Limb Mul1C(Limb* r, Limb* a, int n, Limb b)
+{
+    int i;
+    Limb hi, lo, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        lo = MulLimb(a[i], b, &hi);
+        r[i] = lo + c;
+        c = hi + (r[i] < lo);
+    }
+
+    return c;
+}
+
+// r = r + a * b, r and a are n words, return the carry word
+static INLINE Limb AddMul1C(Limb* r, Limb* a, int n, Limb b)
+{
+    int i;
+    Limb hi, lo, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        lo = MulLimb(a[i], b, &hi);
+        lo += c;
+        hi += lo < c;
+        r[i] += lo;
+        c = hi + (r[i] < lo);
+    }
+
+    return c;
+}
+
+// r = r - a * b, r and a are n words, return the borrow word
+static INLINE Limb SubMul1C(Limb* r, Limb* a, int n, Limb b)
+{
+    int i;
+    Limb hi, lo, t, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        lo = MulLimb(a[i], b, &hi);
+        lo += c;
+        hi += lo < c;
+        t = r[i];
+        r[i] = t - lo;
+        c = hi + (r[i] > t);
+    }
+
+    return c;
+}
+
+// r = r + a * b, adx: 1 to use the assembly code, n must be greater than 0 then
+static INLINE Limb AddMul1(Limb* r, Limb* a, int n, Limb b, int adx)
+{
+#ifdef USE_ADX
+    if (adx)
+        return LimbsAddMul1Adx(r, a, n, b);
+#else
+    (void)adx;
+#endif
+    return AddMul1C(r, a, n, b);
+}
+
+// r = a * b, adx: 1 to use the assembly code, n must be greater than 0 then
+static INLINE Limb Mul1(Limb* r, Limb* a, int n, Limb b, int adx)
+{
+#ifdef USE_ADX
+    if (adx)
+        return LimbsMul1Adx(r, a, n, b);
+#else
+    (void)adx;
+#endif
+    return Mul1C(r, a, n, b);
+}
+
+// r = a * b, r and a are n words, return the carry word
+Limb LimbsMul1(Limb* r, Limb* a, int n, Limb b)
+{
+    return Mul1(r, a, n, b, n > 0 && useAsm && CpuHasAdx());
+}
+
+// r = r + a * b, r and a are n words, return the carry word
+Limb LimbsAddMul1(Limb* r, Limb* a, int n, Limb b)
+{
+    return AddMul1(r, a, n, b, n > 0 && useAsm && CpuHasAdx());
+}
+
+// r = r - a * b, r and a are n words, return the borrow word
+Limb LimbsSubMul1(Limb* r, Limb* a, int n, Limb b)
+{
+#ifdef USE_ADX
+    if (n > 0 && useAsm && CpuHasAdx())
+        return LimbsSubMul1Adx(r, a, n, b);
+#endif
+    return SubMul1C(r, a, n, b);
+}
+
+// get the count of words without leading 0
+int LimbsLen(Limb* a, int n)
+{
+    for (; n > 0 && a[n - 1] == 0; n--);
+
+    return n;
+}
+
+// get the bit length of n words number
+int LimbsBitLen(Limb* a, int n)
+{
+    int i;
+
+    n = LimbsLen(a, n);
+    if (n == 0)
+        return 0;
+
+    for (i = LIMB_BITS - 1; (a[n - 1] >> i & 1) == 0; i--);
+
+    return (n - 1) * LIMB_BITS + i + 1;
+}
+
+// r = a * b, r has aLen + bLen words, it can not be the same as a or b
+void LimbsMul(Limb* r, Limb* a, int aLen, Limb* b, int bLen)
+{
+    int i;
+
+    if (bLen == 0)
+    {
+        memset(r, 0, aLen * sizeof(Limb));
+        return;
+    }
+
+    r[aLen] = LimbsMul1(r, a, aLen, b[0]);
+
+    for (i = 1; i < bLen; i++)
+        r[i + aLen] = LimbsAddMul1(r + i, a, aLen, b[i]);
+}
+
+// q = a / b, r = a % b by using Knuth algorithm D
+// a has aLen words, b has bLen words and b[bLen-1] must not be 0
+// q has aLen - bLen + 1 words if aLen >= bLen, r has bLen words
+void LimbsDivMod(Limb* a, int aLen, Limb* b, int bLen, Limb* q, Limb* r)
+{
+    int i, j, s;
+    Limb qh, rh, hi, lo, t;
+    Limb u[2 * MAX_LIMBS + 1], v[2 * MAX_LIMBS];
+
+    if (aLen < bLen)
+    {
+        memset(r, 0, bLen * sizeof(Limb));
+        memcpy(r, a, aLen * sizeof(Limb));
+        return;
+    }
+
+    if (bLen == 1)
+    {
+        for (rh = 0, i = aLen - 1; i >= 0; i--)
+            q[i] = DivLimb(rh, a[i], b[0], &rh);
+
+        r[0] = rh;
+        return;
+    }
+
+    // normalize, the highest bit of v is 1
+    for (s = 0; (b[bLen - 1] << s >> (LIMB_BITS - 1)) == 0; s++);
+
+    for (i = bLen - 1; i > 0; i--)
+        v[i] = s ? b[i] << s | b[i - 1] >> (LIMB_BITS - s) : b[i];
+    v[0] = b[0] << s;
+
+    u[aLen] = s ? a[aLen - 1] >> (LIMB_BITS - s) : 0;
+    for (i = aLen - 1; i > 0; i--)
+        u[i] = s ? a[i] << s | a[i - 1] >> (LIMB_BITS - s) : a[i];
+    u[0] = a[0] << s;
+
+    for (j = aLen - bLen; j >= 0; j--)
+    {
+        // estimate the quotient word by the highest two words
+        // it is at most 2 more than the right one
+        if (u[j + bLen] >= v[bLen - 1])
+        {
+            qh = ~(Limb)0;
+            rh = u[j + bLen - 1] + v[bLen - 1];
+            t = rh < v[bLen - 1];  // rh overflow
+        }
+        else
+        {
+            qh = DivLimb(u[j + bLen], u[j + bLen - 1], v[bLen - 1], &rh);
+            t = 0;
+        }
+
+        while (!t)
+        {
+            lo = MulLimb(qh, v[bLen - 2], &hi);
+            if (hi < rh || (hi == rh && lo <= u[j + bLen - 2]))
+                break;
+
+            qh--;
+            rh += v[bLen - 1];
+            t = rh < v[bLen - 1];
+        }
+
+        // u = u - qh * v, add back if it is negative
+        t = LimbsSubMul1(u + j, v, bLen, qh);
+        if (u[j + bLen] < t)
+        {
+            qh--;
+            u[j + bLen] += LimbsAdd(u + j, u + j, v, bLen);
+        }
+        u[j + bLen] -= t;
+
+        q[j] = qh;
+    }
+
+    for (i = 0; i < bLen - 1; i++)
+        r[i] = s ? u[i] >> s | u[i + 1] << (LIMB_BITS - s) : u[i];
+    r[bLen - 1] = u[bLen - 1] >> s;
+}
+
+// r = gcd(a, b), all n words, by using Euclid algorithm
+void LimbsGcd(Limb* a, Limb* b, int n, Limb* r)
+{
+    int len0, len1;
+    Limb r0[MAX_LIMBS], r1[MAX_LIMBS], q[MAX_LIMBS + 1], rem[MAX_LIMBS];
+
+    memcpy(r0, a, n * sizeof(Limb));
+    memcpy(r1, b, n * sizeof(Limb));
+
+    while ((len1 = LimbsLen(r1, n)) > 0)
+    {
+        len0 = LimbsLen(r0, n);
+        memset(rem, 0, n * sizeof(Limb));
+        LimbsDivMod(r0, len0, r1, len1, q, rem);  // rem = r0 % r1
+
+        memcpy(r0, r1, n * sizeof(Limb));
+        memcpy(r1, rem, n * sizeof(Limb));
+    }
+
+    memcpy(r, r0, n * sizeof(Limb));
+}
+
+// r = a^-1 mod m by using extended Euclid algorithm, a < m, m > 1, all n words
+// the coefficients of a alternate in sign, so only the absolute value
+// is kept: t(k+1) = t(k-1) + q(k) * t(k), and all of them are less than m
+// return 0 if gcd(a, m) != 1
+int LimbsInverse(Limb* a, Limb* m, int n, Limb* r)
+{
+    int len0, len1, sign = 0;
+    Limb r0[MAX_LIMBS], r1[MAX_LIMBS], t0[MAX_LIMBS], t1[MAX_LIMBS];
+    Limb q[MAX_LIMBS + 1], rem[MAX_LIMBS], t[2 * MAX_LIMBS + 1];
+
+    memcpy(r0, m, n * sizeof(Limb));
+    memcpy(r1, a, n * sizeof(Limb));
+    memset(t0, 0, n * sizeof(Limb));
+    memset(t1, 0, n * sizeof(Limb));
+    t1[0] = 1;
+
+    while ((len1 = LimbsLen(r1, n)) > 0)
+    {
+        len0 = LimbsLen(r0, n);
+        memset(rem, 0, n * sizeof(Limb));
+        LimbsDivMod(r0, len0, r1, len1, q, rem);  // r0 = q * r1 + rem
+
+        LimbsMul(t, q, len0 - len1 + 1, t1, n);
+        LimbsAdd(t, t, t0, n);                    // t = t0 + q * t1
+
+        memcpy(t0, t1, n * sizeof(Limb));
+        memcpy(t1, t, n * sizeof(Limb));
+        memcpy(r0, r1, n * sizeof(Limb));
+        memcpy(r1, rem, n * sizeof(Limb));
+        sign ^= 1;
+    }
+
+    // r0 = gcd(a, m) must be 1
+    if (LimbsLen(r0, n) != 1 || r0[0] != 1)
+        return 0;
+
+    // the coefficient is t0 after odd steps, -t0 after even steps
+    if (sign)
+        memcpy(r, t0, n * sizeof(Limb));
+    else
+        LimbsSub(r, m, t0, n);
+
+    return 1;
+}
+
+// init the Montgomery form of odd modulus n, R = 2^(64 * len)
+// return 0 if n is not odd or not greater than 1
+int MontInit(Mont* mt, BigInt* n)
+{
+    int i, len;
+    Limb c, inv;
+
+    if (n->bit[SIGN_BIT] == NEGATIVE || n->bit[0] == 0 || GetTrueValueLen(n) == 1)
+        return 0;
+
+    len = mt->len = BigIntToLimbs(n, mt->n);
+
+    // Newton iteration, each step doubles the correct bits of n^-1 mod 2^64
+    for (inv = mt->n[0], i = 0; i < 5; i++)
+        inv *= 2 - mt->n[0] * inv;
+    mt->nInv = -inv;
+
+    // R^2 mod n, start at 1 and double it 2 * 64 * len times
+    // one = R mod n is taken on the way
+    memset(mt->rr, 0, sizeof(mt->rr));
+    mt->rr[0] = 1;
+
+    for (i = 0; i < 2 * LIMB_BITS * len; i++)
+    {
+        c = LimbsAdd(mt->rr, mt->rr, mt->rr, len);  // rr = rr * 2
+
+        if (c || LimbsCompare(mt->rr, mt->n, len) >= 0)
+            LimbsSub(mt->rr, mt->rr, mt->n, len);   // rr = rr - n
+
+        if (i == LIMB_BITS * len - 1)
+            memcpy(mt->one, mt->rr, sizeof(mt->one));
+    }
+
+    return 1;
+}
+
+// r = a * b / R mod n by using Montgomery multiplication (CIOS), n words
+// instead of t = t / 2^64 in each step, the window t + i moves up one word
+// adx: 1 to use the assembly code
+static INLINE void MontMulN(Mont* mt, Limb* a, Limb* b, Limb* r, int n, int adx)
+{
+    int i;
+    Limb m, c, s;
+    Limb t[2 * MAX_LIMBS + 1];
+
+    t[n] = Mul1(t, b, n, a[0], adx);  // t = a[0] * b
+    memset(t + n + 1, 0, n * sizeof(Limb));
+
+    for (i = 0; i < n; i++)
+    {
+        if (i > 0)
+        {
+            c = AddMul1(t + i, b, n, a[i], adx);  // t = t + a[i] * b
+            s = t[i + n] + c;
+            t[i + n + 1] += s < c;
+            t[i + n] = s;
+        }
+
+        m = t[i] * mt->nInv;                      // t + m * n = 0 (mod 2^64)
+        c = AddMul1(t + i, mt->n, n, m, adx);     // t = t + m * n
+        s = t[i + n] + c;
+        t[i + n + 1] += s < c;
+        t[i + n] = s;
+    }
+
+    // now t / R = t + n < 2n
+    if (t[2 * n] || LimbsCompare(t + n, mt->n, n) >= 0)
+        LimbsSub(r, t + n, mt->n, n);
+    else
+        memcpy(r, t + n, n * sizeof(Limb));
+}
+
+// r = a * b / R mod n by using Montgomery multiplication
+// a and b must be less than n, r can be the same as a or b
+// 512, 1024 and 2048 bit moduli have their own copies with a fixed word count
+void MontMul(Mont* mt, Limb* a, Limb* b, Limb* r)
+{
+    if (!useAsm || !CpuHasAdx())
+    {
+        MontMulN(mt, a, b, r, mt->len, 0);
+        return;
+    }
+
+    switch (mt->len)
+    {
+    case 8:
+        MontMulN(mt, a, b, r, 8, 1);
+        break;
+    case 16:
+        MontMulN(mt, a, b, r, 16, 1);
+        break;
+    case 32:
+        MontMulN(mt, a, b, r, 32, 1);
+        break;
+    default:
+        MontMulN(mt, a, b, r, mt->len, 1);
+    }
+}
+
+// r = a^e mod n by using Montgomery multiplication, a must be less than n
+// e has eLen words, binary pow from the highest bit
+void MontPow(Mont* mt, Limb* a, Limb* e, int eLen, Limb* r)
+{
+    int i;
+    Limb x[MAX_LIMBS], t[MAX_LIMBS];
+    Limb one[MAX_LIMBS] = {1};
+
+    MontMul(mt, a, mt->rr, x);                     // x = a * R mod n
+    memcpy(t, mt->one, mt->len * sizeof(Limb));    // t = R mod n
+
+    for (i = eLen * LIMB_BITS - 1; i >= 0; i--)
+    {
+        MontMul(mt, t, t, t);  // t = t * t
+
+        if (e[i / LIMB_BITS] >> (i % LIMB_BITS) & 1)
+            MontMul(mt, t, x, t);  // t = t * x
+    }
+
+    MontMul(mt, t, one, r);  // r = t / R mod n
+}
+
+// precompute the Miller-Rabin rounds of the odd modulus n > 1: its Montgomery form, n - 1 = 2^s * t,
+// -1 in Montgomery form, and t recoded in sliding windows from the highest bit
+// so a round only takes the table of its witness, and scans no bit of t
+// return 0 if n is not odd or not greater than 1
+int MrModulusInit(MrModulus* mm, BigInt* n)
+{
+    int i, j, len, bits, sq;
+    Limb* t = mm->t;
+
+    if (!MontInit(&mm->mt, n))
+        return 0;
+
+    len = mm->mt.len;
+    memcpy(t, mm->mt.n, sizeof(mm->t));
+    t[0]--;  // t = n - 1, n is odd, so there is no borrow
+
+    // n - 1 = 2^s * t
+    for (mm->s = 0; (t[mm->s / LIMB_BITS] >> (mm->s % LIMB_BITS) & 1) == 0; mm->s++);
+
+    for (i = 0; i < len; i++)
+    {
+        j = i + mm->s / LIMB_BITS;
+        t[i] = j < len ? t[j] >> (mm->s % LIMB_BITS) : 0;
+        if (mm->s % LIMB_BITS && j + 1 < len)
+            t[i] |= t[j + 1] << (LIMB_BITS - mm->s % LIMB_BITS);
+    }
+
+    LimbsSub(mm->minusOne, mm->mt.n, mm->mt.one, len);  // -R mod n = n - R mod n
+
+    for (bits = len * LIMB_BITS; (t[(bits - 1) / LIMB_BITS] >> ((bits - 1) % LIMB_BITS) & 1) == 0; bits--);
+    mm->tLen = (bits + LIMB_BITS - 1) / LIMB_BITS;
+
+    // a bigger window saves more multiplications, but costs a bigger table
+    mm->window = bits <= 128 ? 3 : bits <= 512 ? 4 : bits <= 1536 ? 5 : MR_MAX_WINDOW;
+    mm->stepNum = 0;
+
+    for (sq = 0, i = bits - 1; i >= 0; )
+    {
+        if ((t[i / LIMB_BITS] >> (i % LIMB_BITS) & 1) == 0)
+        {
+            sq++;
+            i--;
+            continue;
+        }
+
+        // the window i..j ends at a 1 bit, so its value is odd
+        for (j = i - mm->window + 1 < 0 ? 0 : i - mm->window + 1; (t[j / LIMB_BITS] >> (j % LIMB_BITS) & 1) == 0; j++);
+
+        mm->square[mm->stepNum] = (unsigned short)(sq + i - j + 1);
+        mm->digit[mm->stepNum] = 0;
+        for (; i >= j; i--)
+            mm->digit[mm->stepNum] = (unsigned char)(mm->digit[mm->stepNum] << 1 | (t[i / LIMB_BITS] >> (i % LIMB_BITS) & 1));
+
+        mm->stepNum++;
+        sq = 0;
+    }
+
+    mm->tail = sq;
+
+    return 1;
+}
+
+// r = x^t in Montgomery form by the windows of MrModulusInit, x is in Montgomery form
+// x, x^3, x^5, ... are taken first, then each window is some squarings and one multiplication
+void MontPowWindow(MrModulus* mm, Limb* x, Limb* r)
+{
+    int i, k, len = mm->mt.len;
+    Limb x2[MAX_LIMBS];
+    Limb table[1 << (MR_MAX_WINDOW - 1)][MAX_LIMBS];
+
+    memcpy(table[0], x, len * sizeof(Limb));
+    MontMul(&mm->mt, x, x, x2);  // x2 = x * x
+
+    for (k = 1; k < 1 << (mm->window - 1); k++)
+        MontMul(&mm->mt, table[k - 1], x2, table[k]);  // table[k] = x^(2k+1)
+
+    memcpy(r, table[mm->digit[0] >> 1], len * sizeof(Limb));
+
+    for (i = 1; i < mm->stepNum; i++)
+    {
+        for (k = 0; k < mm->square[i]; k++)
+            MontMul(&mm->mt, r, r, r);  // r = r * r
+
+        MontMul(&mm->mt, r, table[mm->digit[i] >> 1], r);  // r = r * x^digit
+    }
+
+    for (k = 0; k < mm->tail; k++)
+        MontMul(&mm->mt, r, r, r);
+}
+
+// implement of pow mod by using Montgomery multiplication
+// c must be odd and positive, a and b must be non-negative, a < c
+BigInt* DoMontPowMod(BigInt* a, BigInt* b, Mont* mt, BigInt* result)
+{
+    int eLen;
+    Limb x[MAX_LIMBS], e[MAX_LIMBS], r[MAX_LIMBS];
+
+    BigIntToLimbs(a, x);
+    eLen = BigIntToLimbs(b, e);
+    MontPow(mt, x, e, eLen, r);
+
+    return LimbsToBigInt(r, mt->len, result);
+}
+
+// Fermat test to base 2, n must be odd and greater than 2
+// return 0 if n is composite, 1 if n is probably a prime
+// it is much cheaper than a Miller-Rabin round, so use it as a filter
+int DoFermatTest(BigInt* n)
+{
+    int i, eLen;
+    Mont mt;
+    Limb x[MAX_LIMBS] = {2}, e[MAX_LIMBS], r[MAX_LIMBS];
+
+    MontInit(&mt, n);
+    eLen = BigIntToLimbs(n, e);
+    e[0]--;  // e = n - 1, n is odd, so there is no borrow
+
+    MontPow(&mt, x, e, eLen, r);
+
+    for (i = 1; i < mt.len && r[i] == 0; i++);
+
+    return r[0] == 1 && i == mt.len;  // r = 1
+}
+
+// check if the CPU and the operating system support AVX2
+int CpuHasAvx2()
+{
+#if defined(USE_AVX2) && defined(__GNUC__)
+    static THREAD_LOCAL int has = -1;
+
+    if (has < 0)
+    {
+        __builtin_cpu_init();
+        has = __builtin_cpu_supports("avx2") != 0;
+    }
+
+    return has;
+#elif defined(USE_AVX2)
+    static THREAD_LOCAL int has = -1;
+    int info[4];
+
+    if (has < 0)
+    {
+        __cpuid(info, 1);
+        has = (info[2] >> 27 & 1) && (_xgetbv(0) & 6) == 6;  // OSXSAVE, XMM and YMM state
+
+        __cpuidex(info, 7, 0);
+        has = has && (info[1] >> 5 & 1);
+    }
+
+    return has;
+#else
+    return 0;
+#endif
+}
+
+#ifdef USE_AVX2
+// change type: 64 bit words of 4 numbers to 32 bit words in 4 lanes
+TARGET_AVX2 static void LimbsToLanes(Limb** x, int len, __m256i* v)
+{
+    int j, k;
+    long long w[4];
+
+    for (j = 0; j < 2 * len; j++)
+    {
+        for (k = 0; k < 4; k++)
+            w[k] = (long long)(x[k][j / 2] >> (j % 2 * 32) & 0xffffffff);
+
+        v[j] = _mm256_set_epi64x(w[3], w[2], w[1], w[0]);
+    }
+}
+
+// change type: 32 bit words in 4 lanes to 64 bit words of 4 numbers
+TARGET_AVX2 static void LanesToLimbs(__m256i* v, int len, Limb** x)
+{
+    int j, k;
+    Limb w[4];
+
+    for (j = 0; j < len; j++)
+    {
+        for (k = 0; k < 4; k++)
+            x[k][j] = 0;
+    }
+
+    for (j = 0; j < 2 * len; j++)
+    {
+        _mm256_storeu_si256((__m256i*)w, v[j]);
+
+        for (k = 0; k < 4; k++)
+            x[k][j / 2] |= w[k] << (j % 2 * 32);
+    }
+}
+
+// r = a * b / R mod n of each lane by using Montgomery multiplication (FIOS)
+// the words are 32 bit, so a 32 x 32 bit product plus two words fits a lane
+// r can be the same as a or b
+TARGET_AVX2 static void MontMul4(Mont4* mt, __m256i* a, __m256i* b, __m256i* r)
+{
+    int i, j, n = mt->len;
+    __m256i s, c, h, m, sel;
+    __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    __m256i t[2 * MAX_LIMBS + 1], d[2 * MAX_LIMBS];
+
+    for (j = 0; j < n + 1; j++)
+        t[j] = _mm256_setzero_si256();
+
+    for (i = 0; i < n; i++)
+    {
+        // t = (t + a[i] * b + m * n) / 2^32 in one pass, t + a[i] * b + m * n = 0 (mod 2^32)
+        // c is the carry of t + a[i] * b, h is the carry of + m * n
+        s = _mm256_add_epi64(t[0], _mm256_mul_epu32(a[i], b[0]));
+        c = _mm256_srli_epi64(s, 32);
+        s = _mm256_and_si256(s, mask);
+        m = _mm256_and_si256(_mm256_mul_epu32(s, mt->nInv), mask);
+        h = _mm256_srli_epi64(_mm256_add_epi64(s, _mm256_mul_epu32(m, mt->n[0])), 32);
+
+        for (j = 1; j < n; j++)
+        {
+            s = _mm256_add_epi64(_mm256_add_epi64(t[j], c), _mm256_mul_epu32(a[i], b[j]));
+            c = _mm256_srli_epi64(s, 32);
+            s = _mm256_add_epi64(_mm256_add_epi64(_mm256_and_si256(s, mask), h), _mm256_mul_epu32(m, mt->n[j]));
+            t[j - 1] = _mm256_and_si256(s, mask);
+            h = _mm256_srli_epi64(s, 32);
+        }
+
+        s = _mm256_add_epi64(_mm256_add_epi64(t[n], c), h);
+        t[n - 1] = _mm256_and_si256(s, mask);
+        t[n] = _mm256_srli_epi64(s, 32);
+    }
+
+    // now t < 2n, d = t - n, c is the borrow
+    c = _mm256_setzero_si256();
+    for (j = 0; j < n; j++)
+    {
+        s = _mm256_sub_epi64(_mm256_sub_epi64(t[j], mt->n[j]), c);
+        d[j] = _mm256_and_si256(s, mask);
+        c = _mm256_srli_epi64(s, 63);
+    }
+
+    // t >= n if t[n] >= c
+    sel = _mm256_cmpgt_epi64(_mm256_add_epi64(t[n], _mm256_set1_epi64x(1)), c);
+    for (j = 0; j < n; j++)
+        r[j] = _mm256_blendv_epi8(t[j], d[j], sel);
+}
+
+// r[k] = a[k]^e[k] mod n[k] of 4 moduli with the same word count in AVX2 lanes
+// 4 bit fixed window, all the lanes square together, then each lane
+// multiplies by its own table entry
+TARGET_AVX2 static void MontPow4(Mont** mt, Limb** a, Limb** e, int* eLen, Limb** r)
+{
+    int i, j, k, w, len, maxLen = 0, idx[4];
+    Limb nInv[4];
+    Limb* tmp[4];
+    Mont4 mt4;
+    __m256i x[2 * MAX_LIMBS], t[2 * MAX_LIMBS];
+    __m256i tbl[16][2 * MAX_LIMBS];
+
+    len = mt[0]->len;
+    mt4.len = 2 * len;
+
+    for (k = 0; k < 4; k++)
+    {
+        nInv[k] = mt[k]->nInv & 0xffffffff;  // -n^-1 mod 2^32
+        maxLen = eLen[k] > maxLen ? eLen[k] : maxLen;
+    }
+    mt4.nInv = _mm256_set_epi64x((long long)nInv[3], (long long)nInv[2], (long long)nInv[1], (long long)nInv[0]);
+
+    for (k = 0; k < 4; k++)
+        tmp[k] = mt[k]->n;
+    LimbsToLanes(tmp, len, mt4.n);
+    for (k = 0; k < 4; k++)
+        tmp[k] = mt[k]->rr;
+    LimbsToLanes(tmp, len, mt4.rr);
+    for (k = 0; k < 4; k++)
+        tmp[k] = mt[k]->one;
+    LimbsToLanes(tmp, len, mt4.one);
+    LimbsToLanes(a, len, x);
+
+    // tbl[i] = a^i * R mod n
+    memcpy(tbl[0], mt4.one, mt4.len * sizeof(__m256i));
+    MontMul4(&mt4, x, mt4.rr, tbl[1]);
+    for (i = 2; i < 16; i++)
+        MontMul4(&mt4, tbl[i - 1], tbl[1], tbl[i]);
+
+    memcpy(t, mt4.one, mt4.len * sizeof(__m256i));
+
+    for (w = maxLen * LIMB_BITS / 4 - 1; w >= 0; w--)
+    {
+        for (i = 0; i < 4; i++)
+            MontMul4(&mt4, t, t, t);  // t = t^16
+
+        for (k = 0; k < 4; k++)
+            idx[k] = w / 16 < eLen[k] ? (int)(e[k][w / 16] >> (w % 16 * 4) & 15) : 0;
+
+        // x = tbl[idx[k]] in lane k
+        for (j = 0; j < mt4.len; j++)
+        {
+            x[j] = _mm256_blend_epi32(tbl[idx[0]][j], tbl[idx[1]][j], 0x0c);
+            x[j] = _mm256_blend_epi32(x[j], tbl[idx[2]][j], 0x30);
+            x[j] = _mm256_blend_epi32(x[j], tbl[idx[3]][j], 0xc0);
+        }
+
+        MontMul4(&mt4, t, x, t);  // t = t * x
+    }
+
+    // r = t / R mod n
+    memset(x, 0, mt4.len * sizeof(__m256i));
+    x[0] = _mm256_set1_epi64x(1);
+    MontMul4(&mt4, t, x, t);
+    LanesToLimbs(t, len, r);
+}
+#endif
+
+// 1 if MontPowBatch runs 4 exponentiations of len words in AVX2 lanes, it is faster than one by one then
+// with MULX/ADX, the scalar code is as fast above ADX_LANES_MAX_LIMBS words
+int MontLanes(int len)
+{
+#ifdef USE_AVX2
+    return useSimd && CpuHasAvx2() && len <= (useAsm && CpuHasAdx() ? ADX_LANES_MAX_LIMBS : MAX_LIMBS);
+#else
+    return 0;
+#endif
+}
+
+// r[k] = a[k]^e[k] mod n[k], k = 0, 1, ..., count - 1, like MontPow
+// each 4 moduli with the same word count run in AVX2 lanes if the CPU supports it,
+// the others run one by one
+// the scalar MULX/ADX code is faster than the lanes for big moduli
+void MontPowBatch(Mont** mt, Limb** a, Limb** e, int* eLen, int count, Limb** r)
+{
+    int k = 0;
+
+#ifdef USE_AVX2
+    if (useSimd && CpuHasAvx2())
+    {
+        for (; k + 4 <= count; k += 4)
+        {
+            if (mt[k]->len == mt[k + 1]->len && mt[k]->len == mt[k + 2]->len &&
+                mt[k]->len == mt[k + 3]->len && MontLanes(mt[k]->len))
+            {
+                MontPow4(mt + k, a + k, e + k, eLen + k, r + k);
+            }
+            else
+            {
+                MontPow(mt[k], a[k], e[k], eLen[k], r[k]);
+                MontPow(mt[k + 1], a[k + 1], e[k + 1], eLen[k + 1], r[k + 1]);
+                MontPow(mt[k + 2], a[k + 2], e[k + 2], eLen[k + 2], r[k + 2]);
+                MontPow(mt[k + 3], a[k + 3], e[k + 3], eLen[k + 3], r[k + 3]);
+            }
+        }
+    }
+#endif
+
+    for (; k < count; k++)
+        MontPow(mt[k], a[k], e[k], eLen[k], r[k]);
+}
+
+// implement of pow mod for count numbers, result[k] = a[k]^b[k] % c[k]
+// c[k] must be odd and positive, a[k] and b[k] must be non-negative
+// it has the throughput of the AVX2 lanes, use it for the batch jobs
+BigInt* DoPowModBatch(BigInt* a, BigInt* b, BigInt* c, int count, BigInt* result)
+{
+    int i, k, num;
+    int eLen[FERMAT_BATCH];
+    Mont mt[FERMAT_BATCH];
+    Limb x[FERMAT_BATCH][MAX_LIMBS], e[FERMAT_BATCH][MAX_LIMBS], r[FERMAT_BATCH][MAX_LIMBS];
+    Mont* pm[FERMAT_BATCH];
+    Limb *px[FERMAT_BATCH], *pe[FERMAT_BATCH], *pr[FERMAT_BATCH];
+    BigInt t;
+
+    for (i = 0; i < count; i += FERMAT_BATCH)
+    {
+        num = count - i < FERMAT_BATCH ? count - i : FERMAT_BATCH;
+
+        for (k = 0; k < num; k++)
+        {
+            MontInit(&mt[k], &c[i + k]);
+
+            if (DoCompare(&a[i + k], &c[i + k]) >= 0)
+                BigIntToLimbs(DoMod(&a[i + k], &c[i + k], &t), x[k]);  // t = a % c
+            else
+                BigIntToLimbs(&a[i + k], x[k]);
+
+            eLen[k] = BigIntToLimbs(&b[i + k], e[k]);
+            pm[k] = &mt[k];
+            px[k] = x[k];
+            pe[k] = e[k];
+            pr[k] = r[k];
+        }
+
+        MontPowBatch(pm, px, pe, eLen, num, pr);
+
+        for (k = 0; k < num; k++)
+            LimbsToBigInt(r[k], mt[k].len, &result[i + k]);
+    }
+
+    return result;
+}
+
+// Fermat test to base 2 for count numbers, all of them must be odd and greater than 2
+// pass[k] = 1 if n[k] is probably a prime, return the count of them
+int DoFermatTestBatch(BigInt* n, int count, char* pass)
+{
+    int i, j, k, num, passNum = 0;
+    int eLen[FERMAT_BATCH];
+    Mont mt[FERMAT_BATCH];
+    Limb x[FERMAT_BATCH][MAX_LIMBS], e[FERMAT_BATCH][MAX_LIMBS], r[FERMAT_BATCH][MAX_LIMBS];
+    Mont* pm[FERMAT_BATCH];
+    Limb *px[FERMAT_BATCH], *pe[FERMAT_BATCH], *pr[FERMAT_BATCH];
+
+    for (i = 0; i < count; i += FERMAT_BATCH)
+    {
+        num = count - i < FERMAT_BATCH ? count - i : FERMAT_BATCH;
+
+        for (k = 0; k < num; k++)
+        {
+            MontInit(&mt[k], &n[i + k]);
+            eLen[k] = BigIntToLimbs(&n[i + k], e[k]);
+            e[k][0]--;  // e = n - 1, n is odd, so there is no borrow
+
+            memset(x[k], 0, sizeof(x[k]));
+            x[k][0] = 2;
+
+            pm[k] = &mt[k];
+            px[k] = x[k];
+            pe[k] = e[k];
+            pr[k] = r[k];
+        }
+
+        MontPowBatch(pm, px, pe, eLen, num, pr);
+
+        for (k = 0; k < num; k++)
+        {
+            for (j = 1; j < mt[k].len && r[k][j] == 0; j++);
+
+            pass[i + k] = r[k][0] == 1 && j == mt[k].len;  // r = 1
+            passNum += pass[i + k];
+        }
+    }
+
+    return passNum;
+}
+
+// implement of pow by using binary pow
+BigInt* DoPowWs(BigInt* a, BigInt* b, BigInt* result, Workspace* ws)
+{
+    int i, len;
+    BigInt *t, *buf;
+
+    t = WsAlloc(ws);
+    buf = WsAlloc(ws);
+
+    CopyBigInt(a, buf);
+    CopyBigInt(&bigOne, t);
+    len = GetTrueValueLen(b);
+
+    for (i = 0; i < len; i++)
+    {
+        if (b->bit[i] == 1)
+            DoMulWs(t, buf, t, ws);  // t = t * buf
+
+        if (i + 1 < len)
+            DoMulWs(buf, buf, buf, ws);  // buf = buf * buf
+    }
+
+    CopyBigInt(t, result);
+    WsFree(ws, 2);
+
+    return result;
+}
+
+BigInt* DoPow(BigInt* a, BigInt* b, BigInt* result)
+{
+    return DoPowWs(a, b, result, GetThreadWorkspace());
+}
+
+char* Pow(char* s1, char* s2, char* result)
+{
+    BigInt a, b, c;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    DoPow(&a, &b, &c);
+
+    return ResultToStr(&c, result);
+}
+
+// implement of pow mod by using binary pow mod
+// the temporaries are taken from ws, result can be a, b or c
+BigInt* DoPowModWs(BigInt* a, BigInt* b, BigInt* c, BigInt* result, Workspace* ws)
+{
+    int i, len;
+    BigInt *t, *buf;
+    Mont mt;
+
+    GetContext()->powMod++;
+    t = WsAlloc(ws);
+    buf = WsAlloc(ws);
+    CopyBigInt(a, buf);
+
+    // odd modulus, use Montgomery multiplication on words
+    if (a->bit[SIGN_BIT] == POSITIVE && b->bit[SIGN_BIT] == POSITIVE && MontInit(&mt, c))
+    {
+        if (DoCompare(a, c) >= 0)
+            DoModWs(a, c, buf, ws);  // buf = a % c
+
+        DoMontPowMod(buf, b, &mt, t);
+    }
+    else
+    {
+        CopyBigInt(&bigOne, t);
+        len = GetTrueValueLen(b);
+
+        for (i = 0; i < len; i++)
+        {
+            if (b->bit[i] == 1)
+                DoMulModWs(t, buf, c, t, ws);  // t = t * buf % c
+
+            if (i + 1 < len)
+                DoMulModWs(buf, buf, c, buf, ws);  // buf = buf * buf % c
+        }
+    }
+
+    CopyBigInt(t, result);
+    WsFree(ws, 2);
+
+    return result;
+}
+
+BigInt* DoPowMod(BigInt* a, BigInt* b, BigInt* c, BigInt* result)
+{
+    return DoPowModWs(a, b, c, result, GetThreadWorkspace());
+}
+
+// DoPowMod in the context ctx, the temporaries are taken from its workspace
+BigInt* DoPowModCtx(BigInt* a, BigInt* b, BigInt* c, BigInt* result, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+
+    DoPowModWs(a, b, c, result, &ctx->ws);
+    UseContext(old);
+
+    return result;
+}
+
+char* PowMod(char* s1, char* s2, char* s3, char* result)
+{
+    BigInt a, b, c, d;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    StrToBigInt(s3, &c);
+    DoPowMod(&a, &b, &c, &d);
+
+    return ResultToStr(&d, result);
+}
+
+// splitmix64, used to expand a seed into the generator state
+unsigned long long SplitMix64(unsigned long long* x)
+{
+    unsigned long long z = (*x += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+    return z ^ (z >> 31);
+}
+
+// read len bytes of entropy from the operating system
+// by BCryptGenRandom on Windows, getrandom on Linux, and /dev/urandom if getrandom is not there
+// return 0 if it is not available, the keys must not be made then
+int GetSecureEntropy(unsigned char* buf, int len)
+{
+#ifdef _WIN32
+    return BCryptGenRandom(NULL, buf, (ULONG)len, BCRYPT_USE_SYSTEM_PREFERRED_RNG) >= 0;
+#else
+    int i = 0;
+    FILE* fp;
+#ifdef __linux__
+    long n;
+
+    while (i < len)
+    {
+        n = getrandom(buf + i, len - i, 0);
+        if (n > 0)
+            i += (int)n;
+        else if (n == 0 || errno != EINTR)
+            break;
+    }
+
+    if (i == len)
+        return 1;
+#endif
+
+    fp = fopen("/dev/urandom", "rb");
+    if (fp == NULL)
+        return 0;
+
+    i = (int)fread(buf, 1, len, fp);
+    fclose(fp);
+
+    return i == len;
+#endif
+}
+
+// read len bytes of entropy for the seed of xoshiro256**, never for a key
+// if the operating system gives none, mix time, clock and address as a weak fallback
+void GetEntropy(unsigned char* buf, int len)
+{
+    int i;
+    unsigned long long x;
+
+    if (GetSecureEntropy(buf, len))
+        return;
+
+    x = (unsigned long long)time(0) ^ ((unsigned long long)clock() << 32);
+    x ^= (unsigned long long)(size_t)buf;
+
+    for (i = 0; i < len; i++)
+        buf[i] = (unsigned char)SplitMix64(&x);
+}
+
+// seed the xoshiro256** generator, the same seed gives the same sequence
+Rng* DoSeedRand(Rng* rng, unsigned long long seed)
+{
+    int i;
+
+    rng->secure = 0;
+    for (i = 0; i < 4; i++)
+        rng->s[i] = SplitMix64(&seed);
+
+    return rng;
+}
+
+// ChaCha20 block function, out = ChaCha20(in)
+void ChaChaBlock(unsigned int* in, unsigned int* out)
+{
+    int i;
+    unsigned int x[16];
+
+    for (i = 0; i < 16; i++)
+        x[i] = in[i];
+
+    for (i = 0; i < 10; i++)  // 20 rounds, a column round and a diagonal round
+    {
+        CHACHA_QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        CHACHA_QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        CHACHA_QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        CHACHA_QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        CHACHA_QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        CHACHA_QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        CHACHA_QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        CHACHA_QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    for (i = 0; i < 16; i++)
+        out[i] = x[i] + in[i];
+}
+
+// seed the ChaCha20 generator with a key from the operating system
+// use it for key generation, it is a CSPRNG
+// return NULL and set ERROR_ENTROPY if the operating system gives no entropy, rng is not changed then
+Rng* DoSeedSecureRand(Rng* rng)
+{
+    unsigned char key[32];
+    int i;
+
+    if (!GetSecureEntropy(key, 32))
+    {
+        SetError(ERROR_ENTROPY);
+        return NULL;
+    }
+
+    rng->secure = 1;
+    rng->key[0] = 0x61707865;  // "expand 32-byte k"
+    rng->key[1] = 0x3320646e;
+    rng->key[2] = 0x79622d32;
+    rng->key[3] = 0x6b206574;
+
+    for (i = 0; i < 8; i++)
+    {
+        rng->key[4 + i] = key[4 * i] | key[4 * i + 1] << 8 |
+            key[4 * i + 2] << 16 | (unsigned int)key[4 * i + 3] << 24;
+    }
+
+    for (i = 12; i < 16; i++)  // block counter and nonce
+        rng->key[i] = 0;
+
+    rng->pos = 16;  // no block is generated yet
+
+    return rng;
+}
+
+// get a 64 bit random word
+unsigned long long DoRandWord(Rng* rng)
+{
+    unsigned long long r, t;
+    unsigned long long* s = rng->s;
+
+    if (rng->secure)
+    {
+        if (rng->pos >= 16)
+        {
+            ChaChaBlock(rng->key, rng->block);
+            if (++rng->key[12] == 0)  // 64 bit block counter
+                rng->key[13]++;
+            rng->pos = 0;
+        }
+
+        r = rng->block[rng->pos++];
+        return r | (unsigned long long)rng->block[rng->pos++] << 32;
+    }
+
+    // xoshiro256**
+    r = ROTL64(s[1] * 5, 7) * 9;
+    t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = ROTL64(s[3], 45);
+
+    return r;
+}
+
+// get the random number generator of this thread
+// it is seeded from the operating system at the first call
+Rng* GetThreadRng()
+{
+    unsigned long long seed;
+    Context* ctx = GetContext();
+
+    if (!ctx->rngReady)
+    {
+        GetEntropy((unsigned char*)&seed, sizeof(seed));
+        DoSeedRand(&ctx->rng, seed);
+        ctx->rngReady = 1;
+    }
+
+    return &ctx->rng;
+}
+
+// use an explicit seed in this thread, for reproducible benchmark runs
+void SeedRand(unsigned long long seed)
+{
+    Context* ctx = GetContext();
+
+    DoSeedRand(&ctx->rng, seed);
+    ctx->rngReady = 1;
+}
+
+// use the ChaCha20 CSPRNG in this thread, for key generation
+// return 0 and set ERROR_ENTROPY if the operating system gives no entropy, the generator is not changed then
+int SeedSecureRand()
+{
+    Context* ctx = GetContext();
+
+    if (DoSeedSecureRand(&ctx->rng) == NULL)
+        return 0;
+    ctx->rngReady = 1;
+
+    return 1;
+}
+
+// get random BigInt from {0, 1, ..., 2^bitLen - 1}
+// fill a whole 64 bit word at a time
+BigInt* DoGetRandBits(int bitLen, BigInt* result)
+{
+    int i, j;
+    unsigned long long w;
+    Rng* rng = GetThreadRng();
+
+    memset(result->bit, 0, BIG_INT_BIT_LEN);
+
+    for (i = 0; i < bitLen; i += 64)
+    {
+        w = DoRandWord(rng);
+        for (j = i; j < bitLen && j < i + 64; j++, w >>= 1)
+            result->bit[j] = (char)(w & 1);
+    }
+
+    return result;
+}
+
+// get odd random BigInt by specify the bit length
+BigInt* DoGetOddRandBigInt(int bitLen, BigInt* result)
+{
+    DoGetRandBits(bitLen, result);
+
+    result->bit[0] = 1;           // odd
+    result->bit[bitLen - 1] = 1;  // exactly bitLen bit
+
+    return result;
+}
+
+char* GetOddRandBigInt(int bitLen, char* result)
+{
+    BigInt a;
+
+    DoGetOddRandBigInt(bitLen, &a);
+
+    return BigIntToStr(&a, result);
+}
+
+// get random BigInt from {0, 1, ..., m-1} by using rejection sampling
+// draw as many bits as m has, and try again if it is not less than m
+// it needs less than 2 draws on average, and no division
+BigInt* DoGetRandBelow(BigInt* m, BigInt* result)
+{
+    int len;
+
+    if (m->bit[SIGN_BIT] == NEGATIVE || IsZero(m))
+    {
+        memset(result->bit, 0, BIG_INT_BIT_LEN);
+        return result;
+    }
+
+    len = GetTrueValueLen(m);
+
+    do
+    {
+        DoGetRandBits(len, result);
+    } while (DoCompare(result, m) >= 0);
+
+    return result;
+}
+
+// get random BigInt from {1, 2, ..., n-1}
+BigInt* DoGetRand(BigInt* n, BigInt* result)
+{
+    BigInt t;
+
+    DoSub(n, &bigOne, &t);      // t = n - 1
+    DoGetRandBelow(&t, result); // result = random{0, 1, ..., n-2}
+
+    return DoAdd(result, &bigOne, result);
+}
+
+char* GetRand(char* s, char* result)
+{
+    BigInt a, b;
+
+    StrToBigInt(s, &a);
+    DoGetRand(&a, &b);
+
+    return BigIntToStr(&b, result);
+}
+
+// return 1 if n is a prime, by the wheel bitmap of OpenPrimeBitmap, n must be less than 2^32
+// byte n / 30 has a bit for each residue mod 30 prime to 30, so it is one cache line read
+INLINE int PrimeBitmapLookup(unsigned long long n)
+{
+    if (n < 6)
+        return n == 2 || n == 3 || n == 5;
+
+    return (primeBitmap[n / 30] & wheelBit[n % 30]) != 0;
+}
+
+// unmap the prime bitmap file
+void ClosePrimeBitmap()
+{
+    if (primeBitmap == NULL)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(primeBitmap - PRIME_BITMAP_HEADER);
+#else
+    munmap(primeBitmap - PRIME_BITMAP_HEADER, PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES);
+#endif
+    primeBitmap = NULL;
+}
+
+// map the prime bitmap file of GenPrimeBitmap read only, the pages are shared by all the processes
+// then the numbers less than 2^32 are answered by the bitmap, without a test
+// return 0 if the file can not be opened or it is not a prime bitmap
+int OpenPrimeBitmap(char* path)
+{
+    unsigned char* p;
+#ifdef _WIN32
+    HANDLE file, map;
+
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return 0;
+
+    if (GetFileSize(file, NULL) != PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES)
+    {
+        CloseHandle(file);
+        return 0;
+    }
+
+    map = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (map == NULL)
+        return 0;
+
+    p = (unsigned char*)MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(map);
+    if (p == NULL)
+        return 0;
+
+    if (*(unsigned int*)p != PRIME_BITMAP_MAGIC || *(unsigned int*)(p + 4) != PRIME_BITMAP_BYTES)
+    {
+        UnmapViewOfFile(p);
+        return 0;
+    }
+#else
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+        return 0;
+
+    if (lseek(fd, 0, SEEK_END) != PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES)
+    {
+        close(fd);
+        return 0;
+    }
+
+    p = (unsigned char*)mmap(NULL, PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+        return 0;
+
+    if (*(unsigned int*)p != PRIME_BITMAP_MAGIC || *(unsigned int*)(p + 4) != PRIME_BITMAP_BYTES)
+    {
+        munmap(p, PRIME_BITMAP_HEADER + PRIME_BITMAP_BYTES);
+        return 0;
+    }
+#endif
+
+    ClosePrimeBitmap();
+    primeBitmap = p + PRIME_BITMAP_HEADER;
+
+    return 1;
+}
+
+// bound of the trial division for a bitLen bit number
+// a composite costs one Miller-Rabin round, about bitLen^2.6, and a prime p rejects 1/p of them,
+// while its share of a word division of bitLen / 64 words is about bitLen, so the bound grows like bitLen^2
+unsigned long TrialBound(int bitLen)
+{
+    unsigned long bound = (unsigned long)bitLen * bitLen / 16;
+
+    if (bound < 64)
+        return 64;
+
+    return bound < SMALL_PRIME_BOUND ? bound : SMALL_PRIME_BOUND;
+}
+
+// trial division of n of len words by the odd primes less than bound
+// n is taken mod the product of a group once, then the remainder r is tested for each prime p of it,
+// p | r if and only if r * p^-1 mod 2^64 <= (2^64 - 1) / p, by Granlund-Montgomery, no division
+// return 0 if n has a small factor, 1 if n is a prime by it, -1 for unknown
+int LimbsTrialDivision(Limb* n, int len, unsigned long bound)
+{
+    int g, k;
+    Limb r, p = 3;
+
+    for (; len > 0 && n[len - 1] == 0; len--);
+
+    if (len == 0 || (len == 1 && n[0] < 2))
+        return 0;
+
+    if ((n[0] & 1) == 0)
+        return len == 1 && n[0] == 2;
+
+    for (g = 0; g < TRIAL_GROUP_NUM && smallPrime[trialFirst[g]] < bound; g++)
+    {
+        for (r = 0, k = len - 1; k >= 0; k--)
+            DivLimb(r, n[k], trialProduct[g], &r);  // r = n % product
+
+        for (k = trialFirst[g]; k < trialFirst[g + 1]; k++)
+        {
+            p = smallPrime[k];
+            if (r * trialInv[k] <= trialLim[k])
+                return len == 1 && n[0] == p;
+        }
+
+        p = k < SMALL_PRIME_NUM ? smallPrime[k] : SMALL_PRIME_BOUND;
+    }
+
+    // no factor less than p
+    return len == 1 && n[0] / p < p ? 1 : -1;
+}
+
+// trial division of n before the Miller-Rabin test, the bound is chosen by the bit length
+// return 0 if n has a small factor, 1 if n is a prime by it, -1 for unknown
+int DoTrialDivision(BigInt* n)
+{
+    int len;
+    Limb x[MAX_LIMBS];
+
+    if (n->bit[SIGN_BIT] == NEGATIVE)
+        return -1;
+
+    len = BigIntToLimbs(n, x);
+
+    return LimbsTrialDivision(x, len, TrialBound(GetTrueValueLen(n)));
+}
+
+// milliseconds of a monotonic clock, for the deadlines
+long long NowMs()
+{
+#ifdef _WIN32
+    return (long long)GetTickCount64();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+}
+
+// return 1 if the search task of this thread is canceled or out of time, 0 if the thread has no task
+// it is checked between the candidates and between the Miller-Rabin rounds
+int TaskStopped()
+{
+    GenPrimeTask* task = threadTask;
+
+    if (task == NULL)
+        return 0;
+
+    return task->cancel || (task->deadline && NowMs() >= task->deadline);
+}
+
+// report to the search task of this thread that count more candidates are tested
+void TaskProgress(int count)
+{
+    GenPrimeTask* task = threadTask;
+
+    if (task == NULL)
+        return;
+
+    task->tested += count;
+    if (task->progress != NULL)
+        task->progress(task->tested, task->arg);
+}
+
+// get random witness of Miller-Rabin test from {2, 3, ..., n-2}
+// 1 and n-1 always pass the test, so they are useless
+BigInt* DoGetWitness(BigInt* n, BigInt* result)
+{
+    BigInt t;
+
+    DoSub(n, &bigThree, &t);  // t = n - 3
+
+    // n <= 3, {2, ..., n-2} is empty
+    if (t.bit[SIGN_BIT] == NEGATIVE || IsZero(&t))
+        return DoGetRand(n, result);
+
+    DoGetRandBelow(&t, result);  // result = random{0, 1, ..., n-4}
+
+    return DoAdd(result, &bigTwo, result);
+}
+
+// miller rabin test
+int DoMillerRabin(BigInt* n, int times)
+{
+    int i, j, k, s, num;
+    unsigned long long v;
+    int tLen[FERMAT_BATCH];
+    Limb w[FERMAT_BATCH][MAX_LIMBS], r[FERMAT_BATCH][MAX_LIMBS];
+    Mont* pm[FERMAT_BATCH];
+    Limb *pw[FERMAT_BATCH], *pt[FERMAT_BATCH], *pr[FERMAT_BATCH];
+    BigInt a, t, x;
+    BigInt nMinusOne;
+    MrModulus mm;
+
+    // the numbers less than 2^32 are in the prime bitmap
+    if (primeBitmap != NULL && n->bit[SIGN_BIT] == POSITIVE && GetTrueValueLen(n) <= 32)
+    {
+        for (v = 0, i = 31; i >= 0; i--)
+            v = v << 1 | n->bit[i];
+
+        return PrimeBitmapLookup(v);
+    }
+
+    // an odd n > 7: the Montgomery form, t and its windows are taken once for all the rounds,
+    // and a round stays in Montgomery form on words
+    if (GetTrueValueLen(n) > 3 && MrModulusInit(&mm, n))
+    {
+        for (k = 0; k < FERMAT_BATCH; k++)
+        {
+            pm[k] = &mm.mt;
+            pw[k] = w[k];
+            pt[k] = mm.t;
+            pr[k] = r[k];
+            tLen[k] = mm.tLen;
+        }
+
+        for (i = 0; i < times; i += num)
+        {
+            if (TaskStopped())
+                return 0;
+
+            // the first round runs alone, as most composites fail it,
+            // then the rounds run 4 together in AVX2 lanes if they are faster there
+            num = i > 0 && times - i >= FERMAT_BATCH && MontLanes(mm.mt.len) ? FERMAT_BATCH : 1;
+            GetContext()->mrRound += num;
+
+            for (k = 0; k < num; k++)
+            {
+                DoGetWitness(n, &x);  // x = random{2, 3, ..., n-2}
+                BigIntToLimbs(&x, w[k]);
+            }
+
+            if (num > 1)
+            {
+                MontPowBatch(pm, pw, pt, tLen, num, pr);  // r = x^t mod n
+                for (k = 0; k < num; k++)
+                    MontMul(&mm.mt, r[k], mm.mt.rr, r[k]);  // to Montgomery form
+            }
+            else
+            {
+                MontMul(&mm.mt, w[0], mm.mt.rr, w[0]);  // w = x * R mod n
+                MontPowWindow(&mm, w[0], r[0]);         // r = x^t
+            }
+
+            for (k = 0; k < num; k++)
+            {
+                if (LimbsCompare(r[k], mm.mt.one, mm.mt.len) == 0)
+                    continue;
+
+                for (j = 0; j < mm.s && LimbsCompare(r[k], mm.minusOne, mm.mt.len) != 0; j++)
+                    MontMul(&mm.mt, r[k], r[k], r[k]);  // r = r^2
+
+                if (j == mm.s)
+                    return 0;
+            }
+        }
+
+        return 1;
+    }
+
+    DoSub(n, &bigOne, &nMinusOne);  // nMinusOne = n - 1
+
+    // n-1 = 2^s * t
+    s = GetMaxRightShiftLen(&nMinusOne);
+    ShiftArithmeticRight(&nMinusOne, s, &t);
+
+    for (i = 0; i < times; i++)
+    {
+        // a stopped search takes n as composite, and it checks the stop itself
+        if (TaskStopped())
+            return 0;
+
+        GetContext()->mrRound++;
+        DoGetWitness(n, &x);      // x = random{2, 3, ..., n-2}
+        DoPowMod(&x, &t, n, &a);  // a = x^t % n, here is very slow><
+
+        if (DoCompare(&a, &bigOne) == 0)
+            continue;
+
+        for (j = 0; j < s; j++)
+        {
+            if (DoCompare(&a, &nMinusOne) == 0)
+                goto LOOP;
+
+            DoPowMod(&a, &bigTwo, n, &a);  // a = a^2 % n
+        }
+
+        return 0;
+
+        LOOP:;
+    }
+
+    // return n is probably a prime
+    return 1;
+}
+
+// DoMillerRabin in the context ctx, the functions it calls take their state from ctx too
+int DoMillerRabinCtx(BigInt* n, int times, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+    int r = DoMillerRabin(n, times);
+
+    UseContext(old);
+
+    return r;
+}
+
+void MutexInit(Mutex* m)
+{
+#ifdef _WIN32
+    InitializeCriticalSection(m);
+#else
+    pthread_mutex_init(m, NULL);
+#endif
+}
+
+void MutexFree(Mutex* m)
+{
+#ifdef _WIN32
+    DeleteCriticalSection(m);
+#else
+    pthread_mutex_destroy(m);
+#endif
+}
+
+void MutexLock(Mutex* m)
+{
+#ifdef _WIN32
+    EnterCriticalSection(m);
+#else
+    pthread_mutex_lock(m);
+#endif
+}
+
+void MutexUnlock(Mutex* m)
+{
+#ifdef _WIN32
+    LeaveCriticalSection(m);
+#else
+    pthread_mutex_unlock(m);
+#endif
+}
+
+void CondInit(Cond* c)
+{
+#ifdef _WIN32
+    InitializeConditionVariable(c);
+#else
+    pthread_cond_init(c, NULL);
+#endif
+}
+
+void CondFree(Cond* c)
+{
+#ifdef _WIN32
+    (void)c;  // a Windows condition variable needs no free
+#else
+    pthread_cond_destroy(c);
+#endif
+}
+
+// unlock m and wait for c, m is locked again when it returns
+void CondWait(Cond* c, Mutex* m)
+{
+#ifdef _WIN32
+    SleepConditionVariableCS(c, m, INFINITE);
+#else
+    pthread_cond_wait(c, m);
+#endif
+}
+
+// wake up all the threads waiting for c
+void CondBroadcast(Cond* c)
+{
+#ifdef _WIN32
+    WakeAllConditionVariable(c);
+#else
+    pthread_cond_broadcast(c);
+#endif
+}
+
+// free the memory of the verdict cache, MillerRabin runs without cache then
+// no thread may be in MillerRabin when it is called
+void FreeVerdictCache()
+{
+    int k;
+
+    if (verdictCacheSize == 0)
+        return;
+
+    for (k = 0; k < VERDICT_SHARDS; k++)
+    {
+        MutexFree(&verdictShard[k].lock);
+        free(verdictShard[k].entry);
+        free(verdictShard[k].bucket);
+    }
+
+    verdictCacheSize = 0;
+}
+
+// keep the verdicts of MillerRabin for at most size numbers, the oldest one is dropped for a new one
+// the cache is cut into VERDICT_SHARDS shards by the hash, each with its own lock,
+// so the threads seldom wait for each other, size: 0 for no cache
+// no thread may be in MillerRabin when it is called
+// return 0 and set ERROR_MEMORY if there is no memory, MillerRabin runs without cache then
+int InitVerdictCache(int size)
+{
+    int i, k;
+    VerdictShard* vs;
+
+    FreeVerdictCache();
+
+    if (size <= 0)
+        return 1;
+
+    size = (size + VERDICT_SHARDS - 1) / VERDICT_SHARDS;
+
+    for (k = 0; k < VERDICT_SHARDS; k++)
+    {
+        vs = &verdictShard[k];
+        vs->entry = (VerdictEntry*)malloc(size * sizeof(VerdictEntry));
+        vs->bucket = (int*)malloc(size * sizeof(int));
+        if (vs->entry == NULL || vs->bucket == NULL)
+        {
+            free(vs->entry);
+            free(vs->bucket);
+            for (k--; k >= 0; k--)
+            {
+                MutexFree(&verdictShard[k].lock);
+                free(verdictShard[k].entry);
+                free(verdictShard[k].bucket);
+            }
+
+            SetError(ERROR_MEMORY);
+            return 0;
+        }
+
+        for (i = 0; i < size; i++)
+            vs->bucket[i] = -1;
+
+        vs->count = 0;
+        vs->head = vs->tail = -1;
+        MutexInit(&vs->lock);
+    }
+
+    // the cache is on when all the shards are ready
+    verdictCacheSize = size;
+
+    return 1;
+}
+
+// hash of the len words of x
+Limb HashLimbs(Limb* x, int len)
+{
+    int i;
+    Limb h = len;
+
+    for (i = 0; i < len; i++)
+    {
+        h = (h ^ x[i]) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 29;
+    }
+
+    return h;
+}
+
+// take the entry i out of the list in the order of use
+void VerdictUnlink(VerdictShard* vs, int i)
+{
+    VerdictEntry* e = &vs->entry[i];
+
+    if (e->prev >= 0)
+        vs->entry[e->prev].next = e->next;
+    else
+        vs->head = e->next;
+
+    if (e->next >= 0)
+        vs->entry[e->next].prev = e->prev;
+    else
+        vs->tail = e->prev;
+}
+
+// put the entry i at the head of the list, as the newest one
+void VerdictPushHead(VerdictShard* vs, int i)
+{
+    VerdictEntry* e = &vs->entry[i];
+
+    e->prev = -1;
+    e->next = vs->head;
+
+    if (vs->head >= 0)
+        vs->entry[vs->head].prev = i;
+    else
+        vs->tail = i;
+
+    vs->head = i;
+}
+
+// find the entry of the number x of MAX_LIMBS words, return -1 if it is not in the shard
+int VerdictFind(VerdictShard* vs, Limb* x, Limb hash)
+{
+    int i;
+
+    for (i = vs->bucket[hash % verdictCacheSize]; i >= 0; i = vs->entry[i].chain)
+    {
+        if (vs->entry[i].hash == hash && memcmp(vs->entry[i].n, x, sizeof(vs->entry[i].n)) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+// save the verdict of x, rounds: count of the rounds passed, -1 if x is composite
+// the oldest entry is dropped if the shard is full
+void VerdictPut(VerdictShard* vs, Limb* x, Limb hash, int rounds)
+{
+    int i, *p;
+    VerdictEntry* e;
+
+    i = VerdictFind(vs, x, hash);
+
+    if (i >= 0)
+    {
+        e = &vs->entry[i];
+        if (rounds < 0 || (e->rounds >= 0 && rounds > e->rounds))
+            e->rounds = rounds;
+
+        VerdictUnlink(vs, i);
+        VerdictPushHead(vs, i);
+        return;
+    }
+
+    if (vs->count < verdictCacheSize)
+    {
+        i = vs->count++;
+    }
+    else
+    {
+        i = vs->tail;
+        VerdictUnlink(vs, i);
+
+        // take it out of its bucket
+        for (p = &vs->bucket[vs->entry[i].hash % verdictCacheSize]; *p != i; p = &vs->entry[*p].chain);
+        *p = vs->entry[i].chain;
+    }
+
+    e = &vs->entry[i];
+    memcpy(e->n, x, sizeof(e->n));
+    e->hash = hash;
+    e->rounds = rounds;
+    e->chain = vs->bucket[hash % verdictCacheSize];
+    vs->bucket[hash % verdictCacheSize] = i;
+    VerdictPushHead(vs, i);
+}
+
+// Miller-Rabin test with the verdict cache of InitVerdictCache
+// a cached composite is returned at once, and a number which passed r rounds
+// only runs the times - r rounds left, the lock is not held during the test
+int DoMillerRabinCached(BigInt* n, int times)
+{
+    int i, len, rounds = 0, prime;
+    Limb x[MAX_LIMBS], hash;
+    VerdictShard* vs;
+
+    if (verdictCacheSize == 0 || n->bit[SIGN_BIT] == NEGATIVE)
+        return DoMillerRabin(n, times);
+
+    len = BigIntToLimbs(n, x);
+    hash = HashLimbs(x, len);
+    vs = &verdictShard[(hash >> 32) % VERDICT_SHARDS];
+
+    MutexLock(&vs->lock);
+    i = VerdictFind(vs, x, hash);
+    if (i >= 0)
+    {
+        rounds = vs->entry[i].rounds;
+        VerdictUnlink(vs, i);
+        VerdictPushHead(vs, i);
+    }
+    MutexUnlock(&vs->lock);
+
+    if (rounds < 0)
+        return 0;
+
+    if (rounds >= times)
+        return 1;
+
+    // the witnesses are random, so the rounds of two calls add up
+    prime = DoMillerRabin(n, times - rounds);
+
+    MutexLock(&vs->lock);
+    VerdictPut(vs, x, hash, prime ? times : -1);
+    MutexUnlock(&vs->lock);
+
+    return prime;
+}
+
+// Miller-Rabin test for a decimal string, the verdict is cached if InitVerdictCache is called
+// most of the composites are rejected by the trial division, before any PowMod
+int MillerRabin(char* s, int times)
+{
+    int k;
+    BigInt n;
+    char* end;
+    unsigned long long v;
+
+    // a number less than 2^32 is one lookup of the prime bitmap, no BigInt is needed
+    if (primeBitmap != NULL && s[0] >= '0' && s[0] <= '9' && strlen(s) <= 10)
+    {
+        v = strtoull(s, &end, 10);
+        if (*end == '\0' && v < 0x100000000ULL)
+            return PrimeBitmapLookup(v);
+    }
+
+    StrToBigInt(s, &n);
+
+    if ((k = DoTrialDivision(&n)) >= 0)
+        return k;
+    
+    return DoMillerRabinCached(&n, times);
+}
+
+// free the comb tables of DoPowModFixed, it runs DoPowMod then
+// no thread may be in DoPowModFixed when it is called
+void FreeCombCache()
+{
+    int i;
+
+    if (combCacheSize == 0)
+        return;
+
+    for (i = 0; i < combCacheSize; i++)
+    {
+        if (combCache[i] != NULL)
+        {
+            free(combCache[i]->table);
+            free(combCache[i]);
+        }
+    }
+
+    MutexFree(&combLock);
+    free(combCache);
+    combCache = NULL;
+    combCacheSize = 0;
+}
+
+// keep the comb tables of at most size pairs (g, p) of DoPowModFixed, the oldest one is dropped for a new one
+// a table of 2048 bit takes about 512KB, size: 0 for no cache
+// no thread may be in DoPowModFixed when it is called
+// return 0 and set ERROR_MEMORY if there is no memory, DoPowModFixed runs DoPowMod then
+int InitCombCache(int size)
+{
+    FreeCombCache();
+
+    if (size <= 0)
+        return 1;
+
+    combCache = (CombTable**)calloc(size, sizeof(CombTable*));
+    if (combCache == NULL)
+    {
+        SetError(ERROR_MEMORY);
+        return 0;
+    }
+
+    combTick = 0;
+    MutexInit(&combLock);
+    combCacheSize = size;
+
+    return 1;
+}
+
+// build the Lim-Lee comb of the base g < p in Montgomery form mt, for the exponents of the bit length of p
+// the exponent is cut into COMB_TEETH teeth of a bits, and each tooth into v blocks of b bits,
+// table[k][j] is the product of g^(2^(i * a + k * b)) for the bits i of j, so the bits at the same place
+// of all the teeth are one multiplication, and the blocks share the squarings
+// return NULL and set ERROR_MEMORY if there is no memory
+CombTable* CombBuild(Mont* mt, Limb* g)
+{
+    int i, j, k, len = mt->len;
+    Limb x[MAX_LIMBS];
+    Limb* row;
+    CombTable* ct;
+
+    ct = (CombTable*)malloc(sizeof(CombTable));
+    if (ct == NULL)
+    {
+        SetError(ERROR_MEMORY);
+        return NULL;
+    }
+
+    ct->mt = *mt;
+    memcpy(ct->g, g, sizeof(ct->g));
+    for (ct->bits = len * LIMB_BITS; (mt->n[(ct->bits - 1) / LIMB_BITS] >> ((ct->bits - 1) % LIMB_BITS) & 1) == 0; ct->bits--);
+
+    // a tooth is v whole blocks, so a may be a little more than bits / COMB_TEETH
+    ct->a = (ct->bits + COMB_TEETH - 1) / COMB_TEETH;
+    ct->v = ct->a < COMB_MAX_BLOCKS ? ct->a : COMB_MAX_BLOCKS;
+    ct->b = (ct->a + ct->v - 1) / ct->v;
+    ct->a = ct->v * ct->b;
+    ct->refs = 1;
+    ct->used = 0;
+
+    ct->table = (Limb*)malloc(((size_t)ct->v << COMB_TEETH) * len * sizeof(Limb));
+    if (ct->table == NULL)
+    {
+        free(ct);
+        SetError(ERROR_MEMORY);
+        return NULL;
+    }
+
+    // x runs through g^(2^(i * a + k * b)), the entry of the single bit i of block k
+    MontMul(mt, g, mt->rr, x);  // x = g * R mod n
+
+    for (i = 0; i < COMB_TEETH; i++)
+    {
+        for (k = 0; k < ct->v; k++)
+        {
+            memcpy(&ct->table[((k << COMB_TEETH) + (1 << i)) * len], x, len * sizeof(Limb));
+
+            for (j = 0; j < ct->b; j++)
+                MontMul(mt, x, x, x);  // x = x * x
+        }
+    }
+
+    for (k = 0; k < ct->v; k++)
+    {
+        row = &ct->table[(k << COMB_TEETH) * len];
+        memcpy(row, mt->one, len * sizeof(Limb));
+
+        // table[k][j] = table[k][j without its lowest bit] * table[k][its lowest bit]
+        for (j = 3; j < 1 << COMB_TEETH; j++)
+        {
+            if (j & (j - 1))
+                MontMul(mt, &row[(j & (j - 1)) * len], &row[(j & -j) * len], &row[j * len]);
+        }
+    }
+
+    return ct;
+}
+
+// drop a reference of ct, it is freed by the last one, combLock must be held
+void CombUnref(CombTable* ct)
+{
+    if (--ct->refs == 0)
+    {
+        free(ct->table);
+        free(ct);
+    }
+}
+
+// find the comb table of the base g and modulus p of MAX_LIMBS words, combLock must be held
+// return NULL if it is not in the cache
+CombTable* CombFind(Limb* g, Limb* p)
+{
+    int i;
+
+    for (i = 0; i < combCacheSize; i++)
+    {
+        if (combCache[i] != NULL && memcmp(combCache[i]->mt.n, p, sizeof(combCache[i]->mt.n)) == 0 &&
+            memcmp(combCache[i]->g, g, sizeof(combCache[i]->g)) == 0)
+            return combCache[i];
+    }
+
+    return NULL;
+}
+
+// put the new comb table ct in the cache in place of the empty or the oldest one, combLock must be held
+void CombPut(CombTable* ct)
+{
+    int i, k = 0;
+
+    for (i = 0; i < combCacheSize; i++)
+    {
+        if (combCache[i] == NULL)
+        {
+            k = i;
+            break;
+        }
+
+        if (combCache[i]->used < combCache[k]->used)
+            k = i;
+    }
+
+    // a dropped table is freed when the last DoPowModFixed using it is finished
+    if (combCache[k] != NULL)
+        CombUnref(combCache[k]);
+
+    combCache[k] = ct;
+    ct->refs++;
+}
+
+// r = g^e by the comb ct, r is not in Montgomery form, e has eLen words and at most COMB_TEETH * a bits
+// b - 1 squarings, and at most one multiplication for each place of each block
+void CombPow(CombTable* ct, Limb* e, int eLen, Limb* r)
+{
+    int i, j, k, t, bit, len = ct->mt.len;
+    Limb x[MAX_LIMBS];
+    Limb one[MAX_LIMBS] = {1};
+
+    memcpy(x, ct->mt.one, len * sizeof(Limb));  // x = R mod n
+
+    for (t = ct->b - 1; t >= 0; t--)
+    {
+        if (t < ct->b - 1)
+            MontMul(&ct->mt, x, x, x);  // x = x * x
+
+        for (k = 0; k < ct->v; k++)
+        {
+            // j: the bits at place t of block k of all the teeth
+            for (j = 0, i = COMB_TEETH - 1; i >= 0; i--)
+            {
+                bit = i * ct->a + k * ct->b + t;
+                j = j << 1 | (bit < eLen * LIMB_BITS && (e[bit / LIMB_BITS] >> (bit % LIMB_BITS) & 1));
+            }
+
+            if (j)
+                MontMul(&ct->mt, x, &ct->table[((k << COMB_TEETH) + j) * len], x);  // x = x * table[k][j]
+        }
+    }
+
+    MontMul(&ct->mt, x, one, r);  // r = x / R mod n
+}
+
+// result = g^e mod p for a fixed base g and odd modulus p, such as g^x mod p of Diffie-Hellman
+// the comb of (g, p) is built by the first call and kept in the cache of InitCombCache, then a call
+// takes about bits / COMB_TEETH multiplications and bits / COMB_TEETH / COMB_MAX_BLOCKS squarings
+// an exponent longer than p, an even p, a negative number or no cache runs DoPowMod, result can be g, e or p
+// return NULL and set ERROR_MEMORY if there is no memory for the comb
+BigInt* DoPowModFixed(BigInt* g, BigInt* e, BigInt* p, BigInt* result)
+{
+    int eLen;
+    Limb x[MAX_LIMBS], y[MAX_LIMBS], r[MAX_LIMBS];
+    BigInt t;
+    Mont mt;
+    CombTable *ct, *built;
+
+    if (combCacheSize == 0 || g->bit[SIGN_BIT] == NEGATIVE || e->bit[SIGN_BIT] == NEGATIVE ||
+        p->bit[SIGN_BIT] == NEGATIVE || p->bit[0] == 0 || GetTrueValueLen(p) == 1 ||
+        GetTrueValueLen(e) > GetTrueValueLen(p))
+        return DoPowMod(g, e, p, result);
+
+    if (DoCompare(g, p) >= 0)
+        g = DoMod(g, p, &t);  // t = g % p
+
+    BigIntToLimbs(g, x);
+    BigIntToLimbs(p, y);
+
+    MutexLock(&combLock);
+    ct = CombFind(x, y);
+    if (ct != NULL)
+    {
+        ct->refs++;
+        ct->used = ++combTick;
+    }
+    MutexUnlock(&combLock);
+
+    if (ct == NULL)
+    {
+        // build it without the lock, so the calls of the other bases do not wait
+        MontInit(&mt, p);
+        built = CombBuild(&mt, x);
+        if (built == NULL)
+            return NULL;
+
+        MutexLock(&combLock);
+        ct = CombFind(x, y);  // another thread may have built it at the same time
+        if (ct != NULL)
+        {
+            ct->refs++;
+            CombUnref(built);
+        }
+        else
+        {
+            ct = built;
+            CombPut(ct);
+        }
+        ct->used = ++combTick;
+        MutexUnlock(&combLock);
+    }
+
+    eLen = BigIntToLimbs(e, y);
+    CombPow(ct, y, eLen, r);
+    LimbsToBigInt(r, ct->mt.len, result);
+
+    MutexLock(&combLock);
+    CombUnref(ct);
+    MutexUnlock(&combLock);
+
+    return result;
+}
+
+char* PowModFixed(char* s1, char* s2, char* s3, char* result)
+{
+    BigInt a, b, c, d;
+
+    ClearError();
+    StrToBigInt(s1, &a);
+    StrToBigInt(s2, &b);
+    StrToBigInt(s3, &c);
+    DoPowModFixed(&a, &b, &c, &d);
+
+    return ResultToStr(&d, result);
+}
+
+// r = a * b / 2^64 mod n by using Montgomery multiplication for one word
+// n is odd, nInv = -n^-1 mod 2^64, a and b must be less than n
+static INLINE Limb MontMul64(Limb a, Limb b, Limb n, Limb nInv)
+{
+    Limb lo, hi, mHi, r;
+
+    lo = MulLimb(a, b, &hi);
+    MulLimb(lo * nInv, n, &mHi);  // lo + m * n = 0 (mod 2^64)
+    r = hi + mHi + (lo != 0);
+
+    // a * b + m * n < 2n * 2^64, r may overflow if n >= 2^63
+    // no branch, it is taken at random
+    return r - (n & (0 - (Limb)(r < hi || r >= n)));
+}
+
+// trial division of 64 bit number by the tiny primes
+// return 0 if n is composite, 1 if n is a prime, -1 if it is unknown
+int TrialDivision64(unsigned long long n)
+{
+    int i;
+
+    if (n < 2)
+        return 0;
+
+    if (n % 2 == 0)
+        return n == 2;
+
+    for (i = 0; i < TINY_PRIME_NUM; i++)
+    {
+        if (n % tinyPrime[i] == 0)
+            return n == tinyPrime[i];
+    }
+
+    // no factor less than 59
+    return n < 59 * 59 ? 1 : -1;
+}
+
+// Montgomery parameters of odd 64 bit n, R = 2^64
+// nInv = -n^-1 mod 2^64, one = R mod n, r2 = R^2 mod n
+void MontInit64(Limb n, Limb* nInv, Limb* one, Limb* r2)
+{
+    int i;
+    Limb inv, hi, lo;
+
+    for (inv = n, i = 0; i < 5; i++)
+        inv *= 2 - n * inv;
+    *nInv = -inv;
+
+    *one = (0 - n) % n;
+    lo = MulLimb(*one, *one, &hi);
+    DivLimb(hi, lo, n, r2);
+}
+
+// get the deterministic Miller-Rabin bases for 64 bit number
+// 3 bases are enough for n < 2^32, return the count of bases
+int GetMrBase64(unsigned long long n, unsigned long long** base)
+{
+    if (n >> 32 == 0)
+    {
+        *base = mrBase32;
+        return MR_BASE32_NUM;
+    }
+
+    *base = mrBase64;
+    return MR_BASE64_NUM;
+}
+
+// deterministic Miller-Rabin test for 64 bit number
+// return 1 if n is a prime, 0 if n is composite, the answer is always right
+int MillerRabin64(unsigned long long n)
+{
+    int i, j, k, s, baseNum;
+    unsigned long long* base;
+    Limb nInv, one, r2, nm1, d, a, x;
+
+    if (primeBitmap != NULL && n < 0x100000000ULL)
+        return PrimeBitmapLookup(n);
+
+    if ((k = TrialDivision64(n)) >= 0)
+        return k;
+
+    MontInit64(n, &nInv, &one, &r2);
+    nm1 = n - one;  // -1 in Montgomery form
+    baseNum = GetMrBase64(n, &base);
+
+    // n - 1 = 2^s * d
+    for (d = n - 1, s = 0; (d & 1) == 0; d >>= 1, s++);
+
+    for (k = 0; k < baseNum; k++)
+    {
+        a = base[k] % n;
+        if (a == 0)
+            continue;
+
+        a = MontMul64(a, r2, n, nInv);  // a * R mod n
+
+        // x = a^d, binary pow from the highest bit
+        for (i = LIMB_BITS - 1; (d >> i & 1) == 0; i--);
+        for (x = a, i--; i >= 0; i--)
+        {
+            x = MontMul64(x, x, n, nInv);
+            if (d >> i & 1)
+                x = MontMul64(x, a, n, nInv);
+        }
+
+        if (x == one || x == nm1)
+            continue;
+
+        for (j = 1; j < s; j++)
+        {
+            x = MontMul64(x, x, n, nInv);
+            if (x == nm1)
+                break;
+        }
+
+        if (j >= s)
+            return 0;
+    }
+
+    return 1;
+}
+
+// one round of the batch Miller-Rabin test, each lane tests its base a
+// the lanes run in lockstep, so the products of different lanes are
+// independent and the CPU overlaps them
+void MrLanesRound(MrLanes* ln)
+{
+    int i, j, k;
+    Limb x[MR64_LANES], a[MR64_LANES], t, bit;
+
+    for (k = 0; k < MR64_LANES; k++)
+    {
+        a[k] = MontMul64(ln->a[k], ln->r2[k], ln->n[k], ln->nInv[k]);  // a * R mod n
+        x[k] = ln->one[k];
+    }
+
+    // x = a^d, binary pow from the lowest bit
+    for (i = 0; i < ln->maxBits; i++)
+    {
+        for (k = 0; k < MR64_LANES; k++)
+        {
+            t = MontMul64(x[k], a[k], ln->n[k], ln->nInv[k]);
+            bit = 0 - (ln->d[k] >> i & 1);
+            x[k] = (t & bit) | (x[k] & ~bit);  // no branch, the bits are random
+            a[k] = MontMul64(a[k], a[k], ln->n[k], ln->nInv[k]);
+        }
+    }
+
+    for (k = 0; k < MR64_LANES; k++)
+        ln->pass[k] = x[k] == ln->one[k] || x[k] == ln->n[k] - ln->one[k];
+
+    // x = -1 in the first s squares, stop if all the lanes pass
+    for (j = 1; j < ln->maxS; j++)
+    {
+        for (k = 0; k < MR64_LANES && ln->pass[k]; k++);
+        if (k == MR64_LANES)
+            break;
+
+        for (k = 0; k < MR64_LANES; k++)
+        {
+            x[k] = MontMul64(x[k], x[k], ln->n[k], ln->nInv[k]);
+            ln->pass[k] |= j < ln->s[k] && x[k] == ln->n[k] - ln->one[k];
+        }
+    }
+}
+
+#ifdef USE_AVX2
+// x < y of each lane as unsigned numbers
+TARGET_AVX2 static INLINE __m256i LessThan4(__m256i x, __m256i y)
+{
+    __m256i sign = _mm256_set1_epi64x((long long)1 << 63);
+
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(y, sign), _mm256_xor_si256(x, sign));
+}
+
+// the 128 bit product of each lane by 32 x 32 bit products, return lo
+TARGET_AVX2 static INLINE __m256i MulLimb4(__m256i a, __m256i b, __m256i* hi)
+{
+    __m256i mask = _mm256_set1_epi64x(0xffffffff);
+    __m256i a1 = _mm256_srli_epi64(a, 32), b1 = _mm256_srli_epi64(b, 32);
+    __m256i p00 = _mm256_mul_epu32(a, b), p01 = _mm256_mul_epu32(a, b1);
+    __m256i p10 = _mm256_mul_epu32(a1, b), p11 = _mm256_mul_epu32(a1, b1);
+    __m256i mid;
+
+    mid = _mm256_add_epi64(_mm256_srli_epi64(p00, 32), _mm256_and_si256(p01, mask));
+    mid = _mm256_add_epi64(mid, _mm256_and_si256(p10, mask));
+
+    *hi = _mm256_add_epi64(p11, _mm256_srli_epi64(mid, 32));
+    *hi = _mm256_add_epi64(*hi, _mm256_add_epi64(_mm256_srli_epi64(p01, 32), _mm256_srli_epi64(p10, 32)));
+
+    return _mm256_or_si256(_mm256_slli_epi64(mid, 32), _mm256_and_si256(p00, mask));
+}
+
+// r = a * b / 2^64 mod n of each lane, like MontMul64
+TARGET_AVX2 static INLINE __m256i MontMul64x4(__m256i a, __m256i b, __m256i n, __m256i nInv)
+{
+    __m256i lo, hi, m, mHi, r, c, t;
+
+    lo = MulLimb4(a, b, &hi);
+
+    // m = lo * nInv mod 2^64, only 3 products are needed
+    t = _mm256_add_epi64(_mm256_mul_epu32(lo, _mm256_srli_epi64(nInv, 32)),
+                         _mm256_mul_epu32(_mm256_srli_epi64(lo, 32), nInv));
+    m = _mm256_add_epi64(_mm256_mul_epu32(lo, nInv), _mm256_slli_epi64(t, 32));
+
+    MulLimb4(m, n, &mHi);
+
+    // r = hi + mHi + (lo != 0)
+    c = _mm256_andnot_si256(_mm256_cmpeq_epi64(lo, _mm256_setzero_si256()), _mm256_set1_epi64x(1));
+    r = _mm256_add_epi64(_mm256_add_epi64(hi, mHi), c);
+
+    // subtract n if r overflows or r >= n
+    t = _mm256_or_si256(LessThan4(r, hi), _mm256_xor_si256(LessThan4(r, n), _mm256_set1_epi64x(-1)));
+
+    return _mm256_sub_epi64(r, _mm256_and_si256(n, t));
+}
+
+// one round of the batch Miller-Rabin test in AVX2 lanes, like MrLanesRound
+// the lanes are 2 vectors of 4, they are interleaved to hide the latency
+TARGET_AVX2 static void MrLanesRound4(MrLanes* ln)
+{
+    int i, j, h;
+    __m256i n[2], nInv[2], one[2], nm1[2], d[2], s[2], a[2], x[2], pass[2], t, bit;
+    __m256i vOne = _mm256_set1_epi64x(1);
+
+    for (h = 0; h < 2; h++)
+    {
+        n[h] = _mm256_loadu_si256((__m256i*)(ln->n + 4 * h));
+        nInv[h] = _mm256_loadu_si256((__m256i*)(ln->nInv + 4 * h));
+        one[h] = _mm256_loadu_si256((__m256i*)(ln->one + 4 * h));
+        nm1[h] = _mm256_sub_epi64(n[h], one[h]);
+        d[h] = _mm256_loadu_si256((__m256i*)(ln->d + 4 * h));
+        s[h] = _mm256_loadu_si256((__m256i*)(ln->s64 + 4 * h));
+        a[h] = _mm256_loadu_si256((__m256i*)(ln->a + 4 * h));
+        t = _mm256_loadu_si256((__m256i*)(ln->r2 + 4 * h));
+        a[h] = MontMul64x4(a[h], t, n[h], nInv[h]);  // a * R mod n
+        x[h] = one[h];
+    }
+
+    // x = a^d, binary pow from the lowest bit
+    for (i = 0; i < ln->maxBits; i++)
+    {
+        for (h = 0; h < 2; h++)
+        {
+            bit = _mm256_cmpeq_epi64(_mm256_and_si256(d[h], vOne), vOne);
+            x[h] = _mm256_blendv_epi8(x[h], MontMul64x4(x[h], a[h], n[h], nInv[h]), bit);
+            a[h] = MontMul64x4(a[h], a[h], n[h], nInv[h]);
+            d[h] = _mm256_srli_epi64(d[h], 1);
+        }
+    }
+
+    for (h = 0; h < 2; h++)
+        pass[h] = _mm256_or_si256(_mm256_cmpeq_epi64(x[h], one[h]), _mm256_cmpeq_epi64(x[h], nm1[h]));
+
+    // x = -1 in the first s squares, stop if all the lanes pass
+    for (j = 1; j < ln->maxS; j++)
+    {
+        if (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_and_si256(pass[0], pass[1]))) == 15)
+            break;
+
+        for (h = 0; h < 2; h++)
+        {
+            x[h] = MontMul64x4(x[h], x[h], n[h], nInv[h]);
+            t = _mm256_and_si256(_mm256_cmpeq_epi64(x[h], nm1[h]), _mm256_cmpgt_epi64(s[h], _mm256_set1_epi64x(j)));
+            pass[h] = _mm256_or_si256(pass[h], t);
+        }
+    }
+
+    for (h = 0; h < 2; h++)
+        _mm256_storeu_si256((__m256i*)(ln->pass + 4 * h), pass[h]);
+}
+#endif
+
+// deterministic Miller-Rabin test for count 64 bit numbers
+// result[k] = 1 if n[k] is a prime, return the count of primes
+// MR64_LANES numbers are tested together, each lane tests one base of its own
+// number in a round, and a lane is refilled with the next number as soon as
+// its number is finished, so no lane idles while the others are still testing
+// the rest of the bases
+// the rounds run in AVX2 lanes if the CPU supports it
+int MillerRabin64Batch(unsigned long long* n, int count, char* result)
+{
+    int i, k, t, active, next = 0, primeNum = 0;
+    int idx[MR64_LANES], base[MR64_LANES], baseNum[MR64_LANES];
+    unsigned long long* baseList[MR64_LANES];
+    MrLanes ln;
+
+    for (k = 0; k < MR64_LANES; k++)
+        idx[k] = -1;
+
+    while (1)
+    {
+        ln.maxBits = ln.maxS = 0;
+
+        for (active = 0, k = 0; k < MR64_LANES; k++)
+        {
+            // refill the empty lane, the tiny numbers are finished here
+            while (idx[k] < 0 && next < count)
+            {
+                if ((t = TrialDivision64(n[next])) >= 0)
+                {
+                    result[next] = (char)t;
+                    primeNum += t;
+                    next++;
+                    continue;
+                }
+
+                idx[k] = next;
+                ln.n[k] = n[next++];
+                base[k] = 0;
+                baseNum[k] = GetMrBase64(ln.n[k], &baseList[k]);
+                MontInit64(ln.n[k], &ln.nInv[k], &ln.one[k], &ln.r2[k]);
+                for (ln.d[k] = ln.n[k] - 1, ln.s[k] = 0; (ln.d[k] & 1) == 0; ln.d[k] >>= 1, ln.s[k]++);
+                ln.s64[k] = ln.s[k];
+            }
+
+            // the empty lane tests 3 to base 2, the answer is not used
+            if (idx[k] < 0)
+            {
+                ln.n[k] = 3;
+                MontInit64(3, &ln.nInv[k], &ln.one[k], &ln.r2[k]);
+                ln.d[k] = 1;
+                ln.s[k] = 1;
+                ln.s64[k] = 1;
+                ln.a[k] = 2;
+                continue;
+            }
+
+            active++;
+            ln.a[k] = baseList[k][base[k]] % ln.n[k];
+
+            for (i = LIMB_BITS; i > 0 && (ln.d[k] >> (i - 1) & 1) == 0; i--);
+            ln.maxBits = i > ln.maxBits ? i : ln.maxBits;
+            ln.maxS = ln.s[k] > ln.maxS ? ln.s[k] : ln.maxS;
+        }
+
+        if (active == 0)
+            break;
+
+#ifdef USE_AVX2
+        if (useSimd && CpuHasAvx2())
+            MrLanesRound4(&ln);
+        else
+#endif
+            MrLanesRound(&ln);
+
+        // the base which is a multiple of n says nothing
+        for (k = 0; k < MR64_LANES; k++)
+        {
+            if (idx[k] < 0)
+                continue;
+
+            if (!ln.pass[k] && ln.a[k] != 0)
+            {
+                result[idx[k]] = 0;
+                idx[k] = -1;
+            }
+            else if (++base[k] == baseNum[k])
+            {
+                result[idx[k]] = 1;
+                primeNum++;
+                idx[k] = -1;
+            }
+        }
+    }
+
+    return primeNum;
+}
+
+// allocate n words, return NULL and set ERROR_MEMORY if there is no memory
+Limb* LimbsAlloc(int n)
+{
+    Limb* p = (Limb*)malloc((n > 0 ? n : 1) * sizeof(Limb));
+
+    if (p == NULL)
+        SetError(ERROR_MEMORY);
+
+    return p;
+}
+
+// r = r + a, r has rLen words, a has aLen words, aLen <= rLen, return the carry
+Limb LimbsAddTo(Limb* r, int rLen, Limb* a, int aLen)
+{
+    int i;
+    Limb c = LimbsAdd(r, r, a, aLen);
+
+    for (i = aLen; c && i < rLen; i++)
+        c = ++r[i] == 0;
+
+    return c;
+}
+
+// r = r - a, r has rLen words, a has aLen words, aLen <= rLen, return the borrow
+Limb LimbsSubFrom(Limb* r, int rLen, Limb* a, int aLen)
+{
+    int i;
+    Limb c = LimbsSub(r, r, a, aLen);
+
+    for (i = aLen; c && i < rLen; i++)
+        c = r[i]-- == 0;
+
+    return c;
+}
+
+// r = a % d, a has n words
+Limb LimbsModWord(Limb* a, int n, Limb d)
+{
+    int i;
+    Limb r = 0;
+
+    for (i = n - 1; i >= 0; i--)
+        DivLimb(r, a[i], d, &r);
+
+    return r;
+}
+
+// a = a >> k, a has n words, k < 64 * n
+void LimbsShiftRight(Limb* a, int n, int k)
+{
+    int i, w = k / LIMB_BITS, b = k % LIMB_BITS;
+
+    for (i = 0; i + w < n; i++)
+    {
+        a[i] = a[i + w] >> b;
+        if (b && i + w + 1 < n)
+            a[i] |= a[i + w + 1] << (LIMB_BITS - b);
+    }
+
+    for (; i < n; i++)
+        a[i] = 0;
+}
+
+// the number theoretic transform of x, N = 2^logN values in Montgomery form mod q->p
+// w: the powers of the N-th root of unity, w[j] = root^j, j < N / 2
+static void Ntt(Limb* x, int logN, Limb* w, NttPrime* q)
+{
+    int i, j, k, len, half, step, n = 1 << logN;
+    Limb t, u, v, p = q->p;
+
+    // bit reverse permutation
+    for (i = 1, j = 0; i < n; i++)
+    {
+        for (k = n >> 1; j & k; k >>= 1)
+            j ^= k;
+        j |= k;
+
+        if (i < j)
+        {
+            t = x[i];
+            x[i] = x[j];
+            x[j] = t;
+        }
+    }
+
+    for (len = 2; len <= n; len <<= 1)
+    {
+        half = len / 2;
+        step = n / len;
+
+        for (i = 0; i < n; i += len)
+        {
+            for (j = 0; j < half; j++)
+            {
+                u = x[i + j];
+                v = MontMul64(x[i + j + half], w[j * step], p, q->pInv);
+                t = u + v - p;                       // no branch, u + v - p < 0 at random
+                x[i + j] = t + (p & (0 - (t >> 63)));
+                t = u - v;
+                x[i + j + half] = t + (p & (0 - (t >> 63)));
+            }
+        }
+    }
+}
+
+// r = a * b by using the number theoretic transform mod 3 primes and CRT
+// each word is a value of the convolution, the values are less than 2^128 * N < p1 * p2 * p3
+// return 0 if there is no memory for the transforms, r is not written then
+static int LimbsMulNtt(Limb* r, Limb* a, int aLen, Limb* b, int bLen)
+{
+    int i, j, logN, n, square = a == b && aLen == bLen;
+    Limb e, root, one, nInv, v1, v2, v3, t, lo, hi, l0, h0, l1, h1, w0, w1, w2, cc, c0, c1, c2;
+    Limb *x, *y, *w;
+    NttPrime* q;
+
+    for (logN = 1; (1 << logN) < aLen + bLen; logN++);
+    n = 1 << logN;
+
+    x = (Limb*)malloc((NTT_PRIME_NUM * n + n + n / 2) * sizeof(Limb));
+    if (x == NULL)
+        return 0;
+
+    y = x + NTT_PRIME_NUM * n;
+    w = y + n;
+
+    for (j = 0; j < NTT_PRIME_NUM; j++)
+    {
+        q = &nttPrime[j];
+
+        // root = g^((p - 1) / N), all in Montgomery form
+        one = MontMul64(1, q->r2, q->p, q->pInv);
+        t = MontMul64(q->g, q->r2, q->p, q->pInv);
+        for (root = one, e = (q->p - 1) >> logN; e; e >>= 1)
+        {
+            if (e & 1)
+                root = MontMul64(root, t, q->p, q->pInv);
+            t = MontMul64(t, t, q->p, q->pInv);
+        }
+
+        for (w[0] = one, i = 1; i < n / 2; i++)
+            w[i] = MontMul64(w[i - 1], root, q->p, q->pInv);
+
+        // x = a * R mod p, a word is less than 2^64, so a * r2 < p * 2^64
+        for (i = 0; i < n; i++)
+            x[j * n + i] = i < aLen ? MontMul64(a[i], q->r2, q->p, q->pInv) : 0;
+        Ntt(x + j * n, logN, w, q);
+
+        if (!square)
+        {
+            for (i = 0; i < n; i++)
+                y[i] = i < bLen ? MontMul64(b[i], q->r2, q->p, q->pInv) : 0;
+            Ntt(y, logN, w, q);
+        }
+
+        for (i = 0; i < n; i++)
+            x[j * n + i] = MontMul64(x[j * n + i], square ? x[j * n + i] : y[i], q->p, q->pInv);
+
+        // the inverse transform is the transform with x[1], ..., x[N-1] reversed
+        Ntt(x + j * n, logN, w, q);
+        for (i = 1; i < n - i; i++)
+        {
+            t = x[j * n + i];
+            x[j * n + i] = x[j * n + n - i];
+            x[j * n + n - i] = t;
+        }
+
+        // divide by N and take it out of Montgomery form, N^-1 = p - (p - 1) / N
+        nInv = q->p - ((q->p - 1) >> logN);
+        for (i = 0; i < n; i++)
+            x[j * n + i] = MontMul64(x[j * n + i], nInv, q->p, q->pInv);
+    }
+
+    // CRT by Garner algorithm, the value is v1 + p1 * v2 + p1 * p2 * v3
+    // c2:c1:c0 is the carry to the next word
+    for (c0 = c1 = c2 = 0, i = 0; i < aLen + bLen; i++)
+    {
+        v1 = x[i];
+
+        t = v1 >= nttPrime[1].p ? v1 - nttPrime[1].p : v1;              // v1 mod p2
+        t = x[n + i] >= t ? x[n + i] - t : x[n + i] + nttPrime[1].p - t;
+        v2 = MontMul64(t, NTT_INV12, nttPrime[1].p, nttPrime[1].pInv);  // (r2 - v1) / p1 mod p2
+
+        t = v1 % nttPrime[2].p;
+        t += MontMul64(v2, NTT_P1_MOD3, nttPrime[2].p, nttPrime[2].pInv);
+        t = t >= nttPrime[2].p ? t - nttPrime[2].p : t;                 // (v1 + p1 * v2) mod p3
+        t = x[2 * n + i] >= t ? x[2 * n + i] - t : x[2 * n + i] + nttPrime[2].p - t;
+        v3 = MontMul64(t, NTT_INV123, nttPrime[2].p, nttPrime[2].pInv); // (r3 - v1 - p1 * v2) / (p1 * p2) mod p3
+
+        lo = MulLimb(nttPrime[0].p, v2, &hi);  // hi:lo = v1 + p1 * v2
+        lo += v1;
+        hi += lo < v1;
+
+        l0 = MulLimb(NTT_P12_LO, v3, &h0);     // w2:w1:w0 = p1 * p2 * v3
+        l1 = MulLimb(NTT_P12_HI, v3, &h1);
+        w0 = l0;
+        w1 = h0 + l1;
+        w2 = h1 + (w1 < l1);
+
+        w0 += lo;
+        cc = w0 < lo;
+        w1 += cc;
+        w2 += w1 < cc;
+        w1 += hi;
+        w2 += w1 < hi;
+
+        c0 += w0;
+        cc = c0 < w0;
+        c1 += cc;
+        c2 += c1 < cc;
+        c1 += w1;
+        c2 += c1 < w1;
+        c2 += w2;
+
+        r[i] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+    }
+
+    free(x);
+
+    return 1;
+}
+
+static void LimbsMulRec(Limb* r, Limb* a, int aLen, Limb* b, int bLen, Limb* tmp);
+
+// r = a * b by using Karatsuba algorithm, a and b are n words, r has 2n words
+// a * b = z2 * x^2 + (z1 - z0 - z2) * x + z0, x = 2^(64h), z1 = (a0 + a1) * (b0 + b1)
+// tmp: scratch of LimbsMulRec
+static void LimbsMulKaratsuba(Limb* r, Limb* a, Limb* b, int n, Limb* tmp)
+{
+    int h = n / 2, k = n - h, saLen, sbLen;
+    Limb *sa = tmp, *sb = tmp + k + 1, *z1 = tmp + 2 * k + 2;
+
+    LimbsMulRec(r, a, h, b, h, tmp);                  // z0 = a0 * b0
+    LimbsMulRec(r + 2 * h, a + h, k, b + h, k, tmp);  // z2 = a1 * b1
+
+    memcpy(sa, a + h, k * sizeof(Limb));              // sa = a0 + a1
+    sa[k] = LimbsAddTo(sa, k, a, h);
+    saLen = LimbsLen(sa, k + 1);
+
+    if (a == b)
+    {
+        sb = sa;
+        sbLen = saLen;
+    }
+    else
+    {
+        memcpy(sb, b + h, k * sizeof(Limb));          // sb = b0 + b1
+        sb[k] = LimbsAddTo(sb, k, b, h);
+        sbLen = LimbsLen(sb, k + 1);
+    }
+
+    LimbsMulRec(z1, sa, saLen, sb, sbLen, z1 + 2 * k + 2);
+    memset(z1 + saLen + sbLen, 0, (2 * k + 2 - saLen - sbLen) * sizeof(Limb));
+
+    LimbsSubFrom(z1, 2 * k + 2, r, 2 * h);            // z1 = z1 - z0 - z2
+    LimbsSubFrom(z1, 2 * k + 2, r + 2 * h, 2 * k);
+    LimbsAddTo(r + h, 2 * n - h, z1, LimbsLen(z1, 2 * k + 2));
+}
+
+// x = a, x has n words, a has aLen words
+static void LimbsExtend(Limb* x, int n, Limb* a, int aLen)
+{
+    memcpy(x, a, aLen * sizeof(Limb));
+    memset(x + aLen, 0, (n - aLen) * sizeof(Limb));
+}
+
+// x = -x, n words in two's complement
+static void LimbsNeg(Limb* x, int n)
+{
+    int i;
+    Limb c = 1;
+
+    for (i = 0; i < n; i++)
+    {
+        x[i] = ~x[i] + c;
+        c = c && x[i] == 0;
+    }
+}
+
+// x = x / 2, n words in two's complement
+static void LimbsHalve(Limb* x, int n)
+{
+    int i;
+
+    for (i = 0; i < n - 1; i++)
+        x[i] = x[i] >> 1 | x[i + 1] << (LIMB_BITS - 1);
+
+    x[n - 1] = (Limb)((long long)x[n - 1] >> 1);
+}
+
+// x = x / 3, n words in two's complement, x must be a multiple of 3
+// each word is multiplied by 3^-1 mod 2^64, and the high word of q * 3 is borrowed from the next
+static void LimbsDivExact3(Limb* x, int n)
+{
+    int i;
+    Limb s, q, c = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        s = x[i] - c;
+        c = x[i] < c;
+        q = s * 0xaaaaaaaaaaaaaaabULL;
+        x[i] = q;
+        c += (q > 0x5555555555555555ULL) + (q > 0xaaaaaaaaaaaaaaaaULL);
+    }
+}
+
+// values of a = a0 + a1 * x + a2 * x^2 at 1, -1 and -2, L words in two's complement each
+// a0 and a1 have k words, a2 has k2 words
+static void Toom3Eval(Limb* e, Limb* a, int k, int k2, int L)
+{
+    Limb *e1 = e, *em1 = e + L, *em2 = e + 2 * L;
+
+    LimbsExtend(e1, L, a, k);                // a0 + a2
+    LimbsAddTo(e1, L, a + 2 * k, k2);
+    memcpy(em1, e1, L * sizeof(Limb));
+
+    LimbsAddTo(e1, L, a + k, k);             // e1 = a0 + a1 + a2
+    LimbsSubFrom(em1, L, a + k, k);          // em1 = a0 - a1 + a2
+
+    memcpy(em2, em1, L * sizeof(Limb));      // em2 = (em1 + a2) * 2 - a0
+    LimbsAddTo(em2, L, a + 2 * k, k2);
+    LimbsAdd(em2, em2, em2, L);
+    LimbsSubFrom(em2, L, a, k);
+}
+
+// r = x * y, x and y have L words, r has W = 2L words, all in two's complement
+// tmp: 2L words, then the scratch of LimbsMulRec
+static void Toom3Mul(Limb* r, Limb* x, Limb* y, int L, Limb* tmp)
+{
+    int xs = x[L - 1] >> (LIMB_BITS - 1), ys = y[L - 1] >> (LIMB_BITS - 1), xLen, yLen;
+    Limb *mx = tmp, *my = tmp + L;
+
+    memcpy(mx, x, L * sizeof(Limb));         // |x|
+    if (xs)
+        LimbsNeg(mx, L);
+    xLen = LimbsLen(mx, L);
+
+    if (x == y)
+    {
+        my = mx;
+        yLen = xLen;
+    }
+    else
+    {
+        memcpy(my, y, L * sizeof(Limb));     // |y|
+        if (ys)
+            LimbsNeg(my, L);
+        yLen = LimbsLen(my, L);
+    }
+
+    LimbsMulRec(r, mx, xLen, my, yLen, tmp + 2 * L);
+    memset(r + xLen + yLen, 0, (2 * L - xLen - yLen) * sizeof(Limb));
+
+    if (xs != ys)
+        LimbsNeg(r, 2 * L);
+}
+
+// r = a * b by using Toom-3 algorithm, a and b are n words, r has 2n words
+// a and b are cut into 3 pieces of k words, the product is a polynomial of degree 4
+// it is taken from the values at 0, 1, -1, -2 and infinity, by Bodrato sequence
+// tmp: scratch of LimbsMulRec
+static void LimbsMulToom3(Limb* r, Limb* a, Limb* b, int n, Limb* tmp)
+{
+    int i, len, k = (n + 2) / 3, k2 = n - 2 * k, L = k + 2, W = 2 * L;
+    Limb *ea = tmp, *eb = tmp + 3 * L, *next = tmp + 6 * L + 5 * W;
+    Limb *r0 = tmp + 6 * L, *r1 = r0 + W, *r2 = r1 + W, *r3 = r2 + W, *r4 = r3 + W;
+    Limb* c[5];
+
+    Toom3Eval(ea, a, k, k2, L);
+    if (a == b)
+        eb = ea;
+    else
+        Toom3Eval(eb, b, k, k2, L);
+
+    LimbsMulRec(r0, a, k, b, k, next);                      // r(0) = a0 * b0
+    LimbsExtend(r0, W, r0, 2 * k);
+    LimbsMulRec(r4, a + 2 * k, k2, b + 2 * k, k2, next);    // r(inf) = a2 * b2
+    LimbsExtend(r4, W, r4, 2 * k2);
+    Toom3Mul(r1, ea, eb, L, next);                          // r(1)
+    Toom3Mul(r2, ea + L, eb + L, L, next);                  // r(-1)
+    Toom3Mul(r3, ea + 2 * L, eb + 2 * L, L, next);          // r(-2)
+
+    LimbsSub(r3, r3, r1, W);          // r3 = (r(-2) - r(1)) / 3
+    LimbsDivExact3(r3, W);
+    LimbsSub(r1, r1, r2, W);          // r1 = (r(1) - r(-1)) / 2
+    LimbsHalve(r1, W);
+    LimbsSub(r2, r2, r0, W);          // r2 = r(-1) - r(0)
+    LimbsSub(r3, r2, r3, W);          // r3 = (r2 - r3) / 2 + 2 * r(inf)
+    LimbsHalve(r3, W);
+    LimbsAdd(r3, r3, r4, W);
+    LimbsAdd(r3, r3, r4, W);
+    LimbsAdd(r2, r2, r1, W);          // r2 = r2 + r1 - r(inf)
+    LimbsSub(r2, r2, r4, W);
+    LimbsSub(r1, r1, r3, W);          // r1 = r1 - r3
+
+    // all the coefficients are non-negative now, r = sum of c[i] * x^i
+    c[0] = r0;
+    c[1] = r1;
+    c[2] = r2;
+    c[3] = r3;
+    c[4] = r4;
+    memset(r, 0, 2 * n * sizeof(Limb));
+
+    for (i = 0; i < 5; i++)
+    {
+        len = LimbsLen(c[i], W);
+        if (len > 2 * n - i * k)
+            len = 2 * n - i * k;
+        LimbsAddTo(r + i * k, 2 * n - i * k, c[i], len);
+    }
+}
+
+// r = a * b, r has aLen + bLen words, the tier is chosen by the shorter word count
+// tmp: scratch, MUL_TMP_SIZE(max(aLen, bLen)) words
+static void LimbsMulRec(Limb* r, Limb* a, int aLen, Limb* b, int bLen, Limb* tmp)
+{
+    int off, len;
+    Limb* t;
+
+    if (aLen < bLen)
+    {
+        t = a;
+        a = b;
+        b = t;
+        len = aLen;
+        aLen = bLen;
+        bLen = len;
+    }
+
+    if (bLen < karatsubaThreshold || bLen < 2)
+    {
+        LimbsMul(r, a, aLen, b, bLen);
+        return;
+    }
+
+    // with no memory for the NTT, Toom-3 in tmp gives the same product
+    if (bLen >= nttThreshold && LimbsMulNtt(r, a, aLen, b, bLen))
+        return;
+
+    // cut a into pieces of bLen words
+    if (aLen > bLen)
+    {
+        memset(r, 0, (aLen + bLen) * sizeof(Limb));
+
+        for (off = 0; off < aLen; off += bLen)
+        {
+            len = aLen - off < bLen ? aLen - off : bLen;
+            LimbsMulRec(tmp, a + off, len, b, bLen, tmp + len + bLen);
+            LimbsAddTo(r + off, aLen + bLen - off, tmp, len + bLen);
+        }
+        return;
+    }
+
+    if (bLen >= toom3Threshold && bLen >= 8)
+        LimbsMulToom3(r, a, b, bLen, tmp);
+    else
+        LimbsMulKaratsuba(r, a, b, bLen, tmp);
+}
+
+// r = a * b mod 2^(64n), the low n words of the product of a and b of n words
+// a0 * b0 is the only full product, a1 * b0 and a0 * b1 are low products again, and a1 * b1 is not needed
+// tmp: scratch, MUL_TMP_SIZE(n) words
+static void LimbsMulLow(Limb* r, Limb* a, Limb* b, int n, Limb* tmp)
+{
+    int i, h = (n + 1) / 2, k = n - h;
+    Limb *p = tmp, *q = tmp + 2 * h;
+
+    if (n < karatsubaThreshold || n < 2)
+    {
+        memset(r, 0, n * sizeof(Limb));
+        for (i = 0; i < n; i++)
+            LimbsAddMul1(r + i, b, n - i, a[i]);  // the carry out of n words is dropped
+
+        return;
+    }
+
+    LimbsMulRec(p, a, h, b, h, q);         // p = a0 * b0, 2h >= n words
+    memcpy(r, p, n * sizeof(Limb));
+
+    LimbsMulLow(q, a + h, b, k, q + k);    // r = r + a1 * b0 * 2^(64h)
+    LimbsAddTo(r + h, k, q, k);
+    LimbsMulLow(q, a, b + h, k, q + k);    // r = r + a0 * b1 * 2^(64h)
+    LimbsAddTo(r + h, k, q, k);
+}
+
+// r = a * b for numbers of any word count, r has aLen + bLen words
+// r can not be the same as a or b, a == b with aLen == bLen is a square, which is cheaper
+// schoolbook, Karatsuba, Toom-3 or NTT is chosen by the thresholds, schoolbook if there is no memory for the scratch
+void LimbsMulFast(Limb* r, Limb* a, int aLen, Limb* b, int bLen)
+{
+    int n = aLen > bLen ? aLen : bLen;
+    Limb* tmp;
+
+    if (aLen < karatsubaThreshold || bLen < karatsubaThreshold)
+    {
+        LimbsMul(r, a, aLen, b, bLen);
+        return;
+    }
+
+    tmp = (Limb*)malloc(MUL_TMP_SIZE(n) * sizeof(Limb));
+    if (tmp == NULL)
+    {
+        LimbsMul(r, a, aLen, b, bLen);
+        return;
+    }
+
+    LimbsMulRec(r, a, aLen, b, bLen, tmp);
+    free(tmp);
+}
+
+// free the memory of LargeMontInit
+void LargeMontFree(LargeMont* mt)
+{
+    free(mt->n);
+}
+
+// r = a * b / R mod n by using Montgomery multiplication with the tiers of LimbsMulFast
+// m = a * b * nInv mod R, then a * b + m * n is a multiple of R
+// a and b must be less than n, r can be the same as a or b
+void LargeMontMul(LargeMont* mt, Limb* a, Limb* b, Limb* r)
+{
+    int len = mt->len;
+    Limb c;
+    Limb *t = mt->t, *m = t + 2 * len, *u = m + 2 * len;
+
+    LimbsMulRec(t, a, len, b, len, mt->tmp);         // t = a * b
+    LimbsMulLow(m, t, mt->nInv, len, mt->tmp);       // m = t * nInv mod R, the low len words
+    LimbsMulRec(u, m, len, mt->n, len, mt->tmp);     // u = m * n
+    c = LimbsAdd(u, u, t, 2 * len);            // u = (t + m * n) / R
+
+    // now u < 2n
+    if (c || LimbsCompare(u + len, mt->n, len) >= 0)
+        LimbsSub(r, u + len, mt->n, len);
+    else
+        memcpy(r, u + len, len * sizeof(Limb));
+}
+
+// init the Montgomery form of odd modulus n of len words, n > 1, R = 2^(64 * len)
+// the memory is taken from the heap, free it by LargeMontFree
+// return 0 and set ERROR_MEMORY if there is no memory, there is nothing to free then
+int LargeMontInit(LargeMont* mt, Limb* n, int len)
+{
+    int i, w, w2;
+    Limb c, inv, two = 2;
+    Limb *x, *t, *u;
+
+    mt->len = len;
+    mt->n = LimbsAlloc(10 * len + 2 + MUL_TMP_SIZE(len));
+    if (mt->n == NULL)
+        return 0;
+
+    mt->nInv = mt->n + len;
+    mt->one = mt->nInv + len;
+    mt->rr = mt->one + len;
+    mt->t = mt->rr + len;
+    mt->tmp = mt->t + 6 * len + 2;
+    memcpy(mt->n, n, len * sizeof(Limb));
+
+    // n^-1 mod R by Newton iteration x = x * (2 - n * x), each step doubles the words
+    x = mt->nInv;
+    t = mt->t;
+    u = mt->t + 2 * len + 1;
+    memset(x, 0, len * sizeof(Limb));
+    for (inv = n[0], i = 0; i < 5; i++)
+        inv *= 2 - n[0] * inv;
+    x[0] = inv;
+
+    for (w = 1; w < len; w = w2)
+    {
+        w2 = 2 * w < len ? 2 * w : len;
+
+        LimbsMulFast(t, n, w2, x, w);      // t = 2 - n * x mod 2^(64 * w2)
+        LimbsNeg(t, w2);
+        LimbsAddTo(t, w2, &two, 1);
+
+        LimbsMulFast(u, x, w, t, w2);      // x = x * t mod 2^(64 * w2)
+        memcpy(x, u, w2 * sizeof(Limb));
+    }
+    LimbsNeg(x, len);                      // nInv = -n^-1
+
+    // R mod n, double 2^(bitLen - 1) until it is 2^(64 * len)
+    w = LimbsBitLen(n, len);
+    memset(mt->one, 0, len * sizeof(Limb));
+    mt->one[(w - 1) / LIMB_BITS] = (Limb)1 << ((w - 1) % LIMB_BITS);
+
+    for (i = w - 1; i < LIMB_BITS * len; i++)
+    {
+        c = LimbsAdd(mt->one, mt->one, mt->one, len);
+        if (c || LimbsCompare(mt->one, n, len) >= 0)
+            LimbsSub(mt->one, mt->one, n, len);
+    }
+
+    // R^2 mod n is 2^(64 * len) in Montgomery form, by pow of 2 * R mod n
+    x = LimbsAlloc(2 * len);
+    if (x == NULL)
+    {
+        LargeMontFree(mt);
+        return 0;
+    }
+
+    u = x + len;
+    c = LimbsAdd(x, mt->one, mt->one, len);
+    if (c || LimbsCompare(x, n, len) >= 0)
+        LimbsSub(x, x, n, len);
+
+    memcpy(u, mt->one, len * sizeof(Limb));
+    for (i = 31; i >= 0; i--)
+    {
+        LargeMontMul(mt, u, u, u);
+        if ((LIMB_BITS * len) >> i & 1)
+            LargeMontMul(mt, u, x, u);
+    }
+    memcpy(mt->rr, u, len * sizeof(Limb));
+    free(x);
+
+    return 1;
+}
+
+// r = a^e / R^(e-1) mod n, namely the pow in Montgomery form, a and r are in Montgomery form
+// e has eLen words, fixed window of 4 bit
+// return 0 and set ERROR_MEMORY if there is no memory, r is not written then
+int LargeMontPow(LargeMont* mt, Limb* a, Limb* e, int eLen, Limb* r)
+{
+    int i, j, w, len = mt->len;
+    Limb *g, *t;
+
+    g = LimbsAlloc(17 * len);  // g[i] = a^i in Montgomery form, and the result
+    if (g == NULL)
+        return 0;
+
+    t = g + 16 * len;
+
+    memcpy(g, mt->one, len * sizeof(Limb));
+    for (i = 1; i < 16; i++)
+        LargeMontMul(mt, g + (i - 1) * len, a, g + i * len);
+
+    memcpy(t, mt->one, len * sizeof(Limb));
+    for (i = eLen * LIMB_BITS / 4 - 1; i >= 0; i--)
+    {
+        for (j = 0; j < 4; j++)
+            LargeMontMul(mt, t, t, t);
+
+        w = e[i / 16] >> (i % 16 * 4) & 15;
+        if (w)
+            LargeMontMul(mt, t, g + w * len, t);
+    }
+
+    memcpy(r, t, len * sizeof(Limb));
+    free(g);
+
+    return 1;
+}
+
+// Miller-Rabin test for n of len words, by LargeMont, for the numbers bigger than BigInt
+// return 0 if n is composite, 1 if n is probably a prime, or 0 and set ERROR_MEMORY if there is no memory
+int LimbsMillerRabin(Limb* n, int len, int times)
+{
+    int i, j, s, bits, ret = 1;
+    LargeMont mt;
+    Limb two = 2;
+    Limb *d, *a, *nm1, *nm2, *x;
+    Rng* rng = GetThreadRng();
+
+    len = LimbsLen(n, len);
+    if (len == 0)
+        return 0;
+    if (len == 1)
+        return MillerRabin64(n[0]);
+    if ((n[0] & 1) == 0)
+        return 0;
+
+    if (LimbsTrialDivision(n, len, TrialBound(LIMB_BITS * len)) == 0)
+        return 0;
+
+    if (!LargeMontInit(&mt, n, len))
+        return 0;
+
+    d = LimbsAlloc(5 * len);
+    if (d == NULL)
+    {
+        LargeMontFree(&mt);
+        return 0;
+    }
+
+    a = d + len;
+    nm1 = a + len;
+    nm2 = nm1 + len;
+    x = nm2 + len;
+    bits = LimbsBitLen(n, len);
+
+    // n - 1 = 2^s * d
+    memcpy(d, n, len * sizeof(Limb));
+    d[0]--;
+    for (s = 0; (d[s / LIMB_BITS] >> (s % LIMB_BITS) & 1) == 0; s++);
+    LimbsShiftRight(d, len, s);
+
+    LimbsSub(nm1, n, mt.one, len);  // -1 in Montgomery form
+
+    // n - 2, the borrow goes on if the low word of n is 1
+    memcpy(nm2, n, len * sizeof(Limb));
+    LimbsSubFrom(nm2, len, &two, 1);
+
+    for (i = 0; i < times && ret; i++)
+    {
+        // a = random{2, 3, ..., n-2}
+        do
+        {
+            for (j = 0; j < len; j++)
+                a[j] = DoRandWord(rng);
+            if (bits % LIMB_BITS)
+                a[len - 1] &= ((Limb)1 << (bits % LIMB_BITS)) - 1;
+        }
+        while (LimbsCompare(a, nm2, len) > 0 || (LimbsLen(a, len) == 1 && a[0] < 2));
+
+        LargeMontMul(&mt, a, mt.rr, x);      // x = a in Montgomery form
+        if (!LargeMontPow(&mt, x, d, len, x))  // x = a^d
+        {
+            ret = 0;
+            break;
+        }
+
+        if (LimbsCompare(x, mt.one, len) == 0 || LimbsCompare(x, nm1, len) == 0)
+            continue;
+
+        for (j = 1; j < s; j++)
+        {
+            LargeMontMul(&mt, x, x, x);      // x = x^2
+            if (LimbsCompare(x, nm1, len) == 0)
+                break;
+        }
+
+        if (j >= s)
+            ret = 0;
+    }
+
+    free(d);
+    LargeMontFree(&mt);
+
+    return ret;
+}
+
+// change a decimal string to words, return the word count, x must have strlen(s) / 19 + 1 words
+int StrToLimbs(char* s, Limb* x)
+{
+    int i, j, k, n = strlen(s), len = 0;
+    Limb chunk, base;
+
+    // chunks of 19 digits, the first one takes the rest
+    for (i = 0; i < n; i += k)
+    {
+        k = i == 0 && n % 19 ? n % 19 : 19;
+
+        for (chunk = 0, base = 1, j = 0; j < k; j++)
+        {
+            chunk = chunk * 10 + (s[i + j] - '0');
+            base *= 10;
+        }
+
+        x[len] = LimbsMul1(x, x, len, base);  // x = x * 10^k + chunk
+        len++;
+        LimbsAddTo(x, len, &chunk, 1);
+        len = LimbsLen(x, len);
+    }
+
+    return len;
+}
+
+// Miller-Rabin test for a decimal number of any bit length, it is not limited by BIG_INT_BIT_LEN
+// return 0 and set ERROR_MEMORY if there is no memory
+int MillerRabinLarge(char* s, int times)
+{
+    int ret, len;
+    Limb* x;
+
+    ClearError();
+    x = LimbsAlloc(strlen(s) / 19 + 2);
+    if (x == NULL)
+        return 0;
+
+    len = StrToLimbs(s, x);
+    ret = LimbsMillerRabin(x, len, times);
+    free(x);
+
+    return ret;
+}
+
+// check if a small number is prime by trial division
+int IsSmallPrime(unsigned long n)
+{
+    unsigned long i;
+
+    if (primeBitmap != NULL && n < 0x100000000ULL)
+        return PrimeBitmapLookup(n);
+
+    if (n < 2)
+        return 0;
+
+    for (i = 2; i * i <= n; i++)
+    {
+        if (n % i == 0)
+            return 0;
+    }
+
+    return 1;
+}
+
+// implement of mod 2^p - 1 by using shift and add, a must be non-negative
+// a = hi * 2^p + lo, and 2^p = 1 (mod 2^p - 1), so a = hi + lo
+// result can be a, no temporary is needed
+BigInt* DoModMersenne(BigInt* a, int p, BigInt* result)
+{
+    int i, j, t, carryFlag;
+
+    if (result != a)
+        CopyBigInt(a, result);
+
+    while (GetTrueValueLen(result) > p)
+    {
+        // a = lo + hi in place, hi = a >> p is cleared from a while it is added
+        for (carryFlag = 0, i = 0, j = p; j < SIGN_BIT; i++, j++)
+        {
+            t = result->bit[i] + result->bit[j] + carryFlag;
+            result->bit[j] = 0;
+            result->bit[i] = t & 1;
+            carryFlag = t >> 1;
+        }
+
+        for (; carryFlag && i < SIGN_BIT; i++)
+        {
+            t = result->bit[i] + carryFlag;
+            result->bit[i] = t & 1;
+            carryFlag = t >> 1;
+        }
+    }
+
+    // 2^p - 1 itself is 0
+    for (i = 0; i < p && result->bit[i] == 1; i++);
+    if (i == p)
+        memset(result->bit, 0, BIG_INT_BIT_LEN);
+
+    return result;
+}
+
+// r = x mod 2^p - 1, x has xLen words, r has len = p / 64 + 1 words
+// x = hi * 2^p + lo, and 2^p = 1 (mod 2^p - 1), so x = hi + lo, hi must be less than 2^p
+void LimbsModMersenne(Limb* x, int xLen, int p, Limb* r, int len)
+{
+    int i, w = p / LIMB_BITS, b = p % LIMB_BITS;
+    Limb hi, t, c;
+
+    for (i = 0; i < len; i++)  // lo
+        r[i] = i < xLen ? x[i] : 0;
+    r[w] &= ((Limb)1 << b) - 1;
+
+    for (c = 0, i = 0; i < len; i++)  // r = lo + hi
+    {
+        hi = w + i < xLen ? x[w + i] >> b : 0;
+        if (b && w + i + 1 < xLen)
+            hi |= x[w + i + 1] << (LIMB_BITS - b);
+
+        t = r[i] + c;
+        c = t < c;
+        r[i] = t + hi;
+        c += r[i] < hi;
+    }
+
+    // now r < 2^(p+1), fold the bit p once more
+    if (r[w] >> b & 1)
+    {
+        r[w] &= ((Limb)1 << b) - 1;
+        for (i = 0; i < len && ++r[i] == 0; i++);
+    }
+
+    // 2^p - 1 itself is 0
+    for (i = 0; i < p && (r[i / LIMB_BITS] >> (i % LIMB_BITS) & 1); i++);
+    if (i == p)
+        memset(r, 0, len * sizeof(Limb));
+}
+
+// Lucas-Lehmer test on words with LimbsMulFast, for the exponents bigger than BigInt
+// return 0 and set ERROR_MEMORY if there is no memory
+int LucasLehmerLarge(int p)
+{
+    int i, zero, len = p / LIMB_BITS + 1;
+    Limb *s, *sq, *tmp;
+    Limb one = 1, two = 2;
+
+    s = LimbsAlloc(3 * len + MUL_TMP_SIZE(len));
+    if (s == NULL)
+        return 0;
+
+    sq = s + len;
+    tmp = sq + 2 * len;
+
+    memset(s, 0, len * sizeof(Limb));
+    s[0] = 4;
+
+    for (i = 0; i < p - 2; i++)
+    {
+        LimbsMulRec(sq, s, len, s, len, tmp);   // s = s * s mod 2^p - 1
+        LimbsModMersenne(sq, 2 * len, p, s, len);
+
+        if (LimbsSubFrom(s, len, &two, 1))      // s = s - 2, add 2^p - 1 if it is negative
+        {
+            s[p / LIMB_BITS] &= ((Limb)1 << (p % LIMB_BITS)) - 1;  // + 2^p
+            LimbsSubFrom(s, len, &one, 1);                          // - 1
+        }
+    }
+
+    zero = LimbsLen(s, len) == 0;
+    free(s);
+
+    return zero;
+}
+
+// Lucas-Lehmer test for the Mersenne number 2^p - 1
+// s(0) = 4, s(k) = s(k-1)^2 - 2 (mod 2^p - 1)
+// 2^p - 1 is a prime if and only if s(p-2) = 0
+// notice: s^2 has 2p bit, LucasLehmerLarge is used if the BIG_INT_BIT_LEN is not enough
+int LucasLehmer(int p)
+{
+    int i;
+    BigInt s, m;
+
+    if (p == 2)  // 2^2 - 1 = 3
+        return 1;
+
+    // if p is composite, 2^p - 1 is composite too
+    if (!IsSmallPrime(p))
+        return 0;
+
+    if (2 * p + 2 > SIGN_BIT)
+        return LucasLehmerLarge(p);
+
+    memset(m.bit, 0, BIG_INT_BIT_LEN);  // m = 2^p - 1
+    for (i = 0; i < p; i++)
+        m.bit[i] = 1;
+
+    LongToBigInt(4, &s);     // s = 4
+
+    for (i = 0; i < p - 2; i++)
+    {
+        DoMul(&s, &s, &s);         // s = s * s
+        DoModMersenne(&s, p, &s);  // s = s % m
+        DoSub(&s, &bigTwo, &s);    // s = s - 2
+
+        if (s.bit[SIGN_BIT] == NEGATIVE)
+            DoAdd(&s, &m, &s);     // s = s + m
+    }
+
+    return IsZero(&s);
+}
+
+// find all the Mersenne prime exponents p in [low, high]
+// result: the exponents, return: the count of them
+int ScanMersenne(int low, int high, int* result)
+{
+    int p, count = 0;
+    unsigned long a, b;
+
+    for (p = low; p <= high; p++)
+    {
+        // 2^p - 1 with composite p is composite, no need to print
+        if (!IsSmallPrime(p))
+            continue;
+
+        PrintProgress("testing exponent[%d]...\n", p);
+        a = time(0);
+
+        if (LucasLehmer(p))
+            result[count++] = p;
+
+        b = time(0);
+        PrintProgress("finish test exponent %d (t=%lds)\n\n", p, b - a);
+    }
+
+    return count;
+}
+
+// get the checkpoint file of the search in this thread
+// return NULL if there is no checkpoint, or the context of this thread has noCheckpoint set
+char* GetCheckpointPath()
+{
+    return GetContext()->noCheckpoint ? NULL : checkpointPath;
+}
+
+// save the search state to the checkpoint file, cand: the next number to test
+// it is saved if checkpointInterval seconds have passed since the last one
+// it is written to a temporary file first, then renamed, so a kill never leaves half a file
+// the state is less than 1KB, much cheaper than a candidate test
+void SaveCheckpoint(Checkpoint* cp, BigInt* cand)
+{
+    static THREAD_LOCAL time_t last;
+    char tmp[BUFFER_SIZE];
+    char* path = GetCheckpointPath();
+    time_t now = time(0);
+    FILE* fp;
+
+    if (path == NULL || now - last < checkpointInterval)
+        return;
+
+    last = now;
+    cp->magic = CHECKPOINT_MAGIC;
+    cp->size = sizeof(Checkpoint);
+    cp->rng = *GetThreadRng();
+    memset(cp->cand, 0, sizeof(cp->cand));
+    BigIntToLimbs(cand, cp->cand);
+
+    sprintf(tmp, "%.*s.tmp", BUFFER_SIZE - 8, path);
+    fp = fopen(tmp, "wb");
+    if (fp == NULL || fwrite(cp, sizeof(Checkpoint), 1, fp) != 1)
+    {
+        printf("Can not write the checkpoint %s XD\n", tmp);
+        if (fp != NULL)
+            fclose(fp);
+        return;
+    }
+    fclose(fp);
+
+#ifdef _WIN32
+    remove(path);  // rename of Windows does not replace a file
+#endif
+    rename(tmp, path);
+}
+
+// load the checkpoint of a search, and restore the random number generator
+// return 1 if checkpointResume is set and the file has the same kind, bitLen and times
+int LoadCheckpoint(int kind, int bitLen, int times, Checkpoint* cp)
+{
+    int ok;
+    char* path = GetCheckpointPath();
+    FILE* fp;
+
+    if (path == NULL || !checkpointResume)
+        return 0;
+
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+        return 0;
+
+    ok = fread(cp, sizeof(Checkpoint), 1, fp) == 1 && cp->magic == CHECKPOINT_MAGIC &&
+         cp->size == sizeof(Checkpoint) && cp->kind == kind && cp->bitLen == bitLen && cp->times == times;
+    fclose(fp);
+
+    if (ok)
+    {
+        *GetThreadRng() = cp->rng;
+        PrintProgress("resume from number[%lld]\n", cp->tested + 1);
+    }
+
+    return ok;
+}
+
+// the search is finished, remove the checkpoint file
+void ClearCheckpoint()
+{
+    char* path = GetCheckpointPath();
+
+    if (path != NULL)
+        remove(path);
+}
+
+// save the state of GenPrime and GenRandomPrime to file, path: NULL for no checkpoint
+// resume: 1 to continue from the checkpoint in the file if it is of the same search
+// interval: seconds between two checkpoints
+void SetCheckpoint(char* path, int resume, int interval)
+{
+    checkpointPath = path;
+    checkpointResume = resume;
+    checkpointInterval = interval;
+}
+
+// unmap the prime cache file
+// no thread may be in GenPrime or GenSafePrime when it is called
+void ClosePrimeCache()
+{
+    if (primeCache == NULL)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(primeCache);
+#else
+    munmap(primeCache, sizeof(PrimeCache));
+#endif
+    MutexFree(&primeCacheLock);
+    primeCache = NULL;
+}
+
+// open the prime cache file of GenPrime and GenSafePrime, it is created if it does not exist
+// the file is mapped to memory, so a lookup reads only the pages of one entry
+// a file of another build is cleared, and so are the entries with a wrong key
+// no thread may be in GenPrime or GenSafePrime when it is called
+// return 0 if the file can not be opened
+int OpenPrimeCache(char* path)
+{
+    int i, k;
+    PrimeCache* pc;
+    PrimeCacheEntry* e;
+#ifdef _WIN32
+    HANDLE file, map;
+
+    file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                       NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return 0;
+
+    // the file is extended to the size of the mapping
+    map = CreateFileMappingA(file, NULL, PAGE_READWRITE, 0, sizeof(PrimeCache), NULL);
+    CloseHandle(file);
+    if (map == NULL)
+        return 0;
+
+    pc = (PrimeCache*)MapViewOfFile(map, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(PrimeCache));
+    CloseHandle(map);
+    if (pc == NULL)
+        return 0;
+#else
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0)
+        return 0;
+
+    if (ftruncate(fd, sizeof(PrimeCache)) != 0)
+    {
+        close(fd);
+        return 0;
+    }
+
+    pc = (PrimeCache*)mmap(NULL, sizeof(PrimeCache), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (pc == MAP_FAILED)
+        return 0;
+#endif
+
+    if (pc->magic != PRIME_CACHE_MAGIC || pc->size != sizeof(PrimeCacheEntry) || pc->bitLen != BIG_INT_BIT_LEN)
+    {
+        memset(pc, 0, sizeof(PrimeCache));
+        pc->size = sizeof(PrimeCacheEntry);
+        pc->bitLen = BIG_INT_BIT_LEN;
+        pc->magic = PRIME_CACHE_MAGIC;
+    }
+
+    for (k = 0; k < PRIME_CACHE_MODES; k++)
+    {
+        for (i = 0; i < BIG_INT_BIT_LEN; i++)
+        {
+            e = &pc->entry[k][i];
+            if (e->ready && (e->bitLen != i || e->mode != k))
+                e->ready = 0;
+        }
+    }
+
+    ClosePrimeCache();
+    MutexInit(&primeCacheLock);
+    primeCache = pc;
+
+    return 1;
+}
+
+// times rounds of Miller-Rabin test, or the deterministic one for 64 bit numbers
+int DoCheckPrime(BigInt* n, int bitLen, int times)
+{
+    Limb t[MAX_LIMBS];
+
+    if (bitLen > 63)
+        return DoMillerRabin(n, times);
+
+    BigIntToLimbs(n, t);
+
+    return MillerRabin64(t[0]);
+}
+
+// get the cached prime of bitLen and mode to result
+// the file may be broken or changed, so a hit always runs one round, and the rounds left if it has
+// passed less than times, then the entry keeps the new times
+// return NULL if it is not cached or the check fails, the entry is dropped then and searched again
+BigInt* GetCachedPrime(int bitLen, int mode, int times, BigInt* result)
+{
+    int ok, rounds = 0;
+    Limb p[MAX_LIMBS];
+    PrimeCacheEntry* e;
+    BigInt q;
+
+    if (primeCache == NULL || bitLen < 2 || bitLen >= BIG_INT_BIT_LEN - 1)
+        return NULL;
+
+    // copy it under the lock, so no other thread is writing it
+    e = &primeCache->entry[mode][bitLen];
+    MutexLock(&primeCacheLock);
+    if (LOAD_ACQUIRE(&e->ready))
+    {
+        memcpy(p, e->p, sizeof(p));
+        rounds = times - e->times > 1 ? times - e->times : 1;
+    }
+    ok = e->ready;
+    MutexUnlock(&primeCacheLock);
+
+    if (!ok)
+        return NULL;
+
+    LimbsToBigInt(p, MAX_LIMBS, result);
+    ok = GetTrueValueLen(result) == bitLen && DoCheckPrime(result, bitLen, rounds);
+
+    if (ok && mode == PRIME_CACHE_SAFE_PRIME)
+    {
+        ShiftArithmeticRight(result, 1, &q);  // q = (p - 1) / 2
+        ok = DoCheckPrime(&q, bitLen - 1, rounds);
+    }
+
+    // the entry may be filled again by another thread, only this prime is changed
+    MutexLock(&primeCacheLock);
+    if (e->ready && memcmp(e->p, p, sizeof(p)) == 0)
+    {
+        if (!ok)
+            e->ready = 0;  // drop it, it is searched again
+        else if (times > e->times)
+            e->times = times;
+    }
+    MutexUnlock(&primeCacheLock);
+
+    return ok ? result : NULL;
+}
+
+// save the prime p of bitLen and mode which has passed times rounds to the cache
+// the threads write under the lock, and ready is cleared before and set after the other fields
+// by release stores, so a kill never leaves half an entry with ready set
+void PutCachedPrime(int bitLen, int mode, int times, BigInt* p)
+{
+    Limb x[MAX_LIMBS];
+    PrimeCacheEntry* e;
+
+    if (primeCache == NULL || bitLen < 2 || bitLen >= BIG_INT_BIT_LEN - 1)
+        return;
+
+    BigIntToLimbs(p, x);
+    e = &primeCache->entry[mode][bitLen];
+    MutexLock(&primeCacheLock);
+
+    if (e->ready && memcmp(e->p, x, sizeof(x)) == 0)
+    {
+        if (times > e->times)
+            e->times = times;
+
+        MutexUnlock(&primeCacheLock);
+        return;
+    }
+
+    e->ready = 0;
+    FENCE_RELEASE();
+    e->bitLen = bitLen;
+    e->mode = mode;
+    e->times = times;
+    memcpy(e->p, x, sizeof(x));
+    STORE_RELEASE(&e->ready, 1);
+
+    MutexUnlock(&primeCacheLock);
+}
+
+// generate prime by specify bit length and miller-rabin test times
+// notice: the generate is not random
+// it first test the biggest BigInt, it means all bit is 1
+// this one is the Mersenne number 2^bitLen - 1, so use Lucas-Lehmer for it
+// then it subtract 2, and test again, unitl it find the prime
+// so it aways generate the biggest prime in the specify bit length
+// of course you can generate it randomly, good luck ><
+// the search state is saved by SetCheckpoint, and it can continue after a restart
+// the result is kept in the prime cache of OpenPrimeCache, the next call takes it from there
+// return NULL if it is stopped in a GenPrimeTask, or bitLen is beyond BigInt, then ERROR_OVERFLOW is set
+BigInt* DoGenPrime(int bitLen, int times, BigInt* result)
+{
+    int i;
+    unsigned long n = 1;
+    unsigned long a, b;
+    Checkpoint cp;
+
+    if (bitLen > SIGN_BIT)
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    if (GetCachedPrime(bitLen, PRIME_CACHE_GEN_PRIME, times, result))
+    {
+        PrintProgress("found in the prime cache\n\n");
+        return result;
+    }
+
+    memset(result->bit, 0, BIG_INT_BIT_LEN);
+    for (i = 0; i < bitLen; i++)   // set all 1, the biggest odd
+        result->bit[i] = 1;
+
+    if (LoadCheckpoint(CHECKPOINT_GEN_PRIME, bitLen, times, &cp))
+    {
+        LimbsToBigInt(cp.cand, MAX_LIMBS, result);
+        n = (unsigned long)cp.tested + 1;
+    }
+
+    cp.kind = CHECKPOINT_GEN_PRIME;
+    cp.bitLen = bitLen;
+    cp.times = times;
+
+    while (1)
+    {
+        if (TaskStopped())
+            return NULL;
+
+        cp.tested = n - 1;
+        SaveCheckpoint(&cp, result);
+
+        PrintProgress("testing number[%ld]...\n", n);
+        a = time(0);
+
+        // Lucas-Lehmer gives a proven answer for 2^bitLen - 1
+        if (n == 1 && 2 * bitLen < SIGN_BIT ?
+            LucasLehmer(bitLen) : DoMillerRabin(result, times))
+        {
+            b = time(0);
+            break;
+        }
+
+        b = time(0);
+        PrintProgress("finish test number %ld (t=%lds)\n\n", n++, b - a);
+        TaskProgress(1);
+
+        DoSub(result, &bigTwo, result);  // result = result - 2
+    }
+
+    ClearCheckpoint();
+    PutCachedPrime(bitLen, PRIME_CACHE_GEN_PRIME, times, result);
+    PrintProgress("finish test number[%ld] (t=%lds)\n\n", n, b - a);
+
+    return result;
+}
+
+// DoGenPrime in the context ctx, the functions it calls take their state from ctx too
+BigInt* DoGenPrimeCtx(int bitLen, int times, BigInt* result, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+    BigInt* r = DoGenPrime(bitLen, times, result);
+
+    UseContext(old);
+
+    return r;
+}
+
+char* GenPrime(int bitLen, int times, char* result)
+{
+    BigInt n;
+
+    ClearError();
+
+    return ResultToStr(DoGenPrime(bitLen, times, &n), result);
+}
+
+// write the numbers of a table to fp, perLine on each line, as hex if hex is set
+void WriteTable(FILE* fp, char* decl, Limb* v, int n, int perLine, int hex)
+{
+    int i;
+
+    fprintf(fp, "%s = {\n", decl);
+
+    for (i = 0; i < n; i++)
+    {
+        if (i % perLine == 0)
+            fprintf(fp, "    ");
+
+        if (hex)
+            fprintf(fp, "0x%016llxULL", v[i]);
+        else
+            fprintf(fp, "%llu", v[i]);
+
+        if (i + 1 < n)
+            fprintf(fp, (i + 1) % perLine == 0 ? ",\n" : ", ");
+    }
+
+    fprintf(fp, "\n};\n\n");
+}
+
+// write the tables of the small primes to the header file path, it is included at compile time
+// the odd primes less than SMALL_PRIME_BOUND by Eratosthenes sieve, their inverses mod 2^64
+// and (2^64 - 1) / p for the trial division, and the groups of the primes with their product in a word
+// return 0 if the file can not be written
+int GenPrimeTable(char* path)
+{
+    int i, k, g = 0, num = 0;
+    unsigned long j, m;
+    Limb p, inv, prod = 1;
+    static char composite[SMALL_PRIME_BOUND];
+    static Limb prime[SMALL_PRIME_NUM], primeInv[SMALL_PRIME_NUM], primeLim[SMALL_PRIME_NUM];
+    static Limb product[SMALL_PRIME_NUM], first[SMALL_PRIME_NUM + 1];
+    FILE* fp;
+
+    for (j = 3; j < SMALL_PRIME_BOUND; j += 2)
+    {
+        if (composite[j])
+            continue;
+
+        for (m = j * j; m < SMALL_PRIME_BOUND; m += 2 * j)
+            composite[m] = 1;
+
+        prime[num++] = j;
+    }
+
+    first[0] = 0;
+    for (k = 0; k < num; k++)
+    {
+        p = prime[k];
+
+        // Newton iteration, each step doubles the correct bits of p^-1 mod 2^64
+        for (inv = p, i = 0; i < 5; i++)
+            inv *= 2 - p * inv;
+
+        primeInv[k] = inv;
+        primeLim[k] = ~(Limb)0 / p;
+
+        if (prod > ~(Limb)0 / p)
+        {
+            product[g++] = prod;
+            first[g] = k;
+            prod = 1;
+        }
+
+        prod *= p;
+    }
+
+    product[g++] = prod;
+    first[g] = num;
+
+    fp = fopen(path, "w");
+    if (fp == NULL)
+        return 0;
+
+    fprintf(fp, "// generated by GenPrimeTable, run the program with -t file to write it again, do not edit\n");
+    fprintf(fp, "// odd primes less than SMALL_PRIME_BOUND, their inverses mod 2^64 and (2^64 - 1) / p,\n");
+    fprintf(fp, "// and the groups of the trial division with their product in a word\n\n");
+    fprintf(fp, "#if SMALL_PRIME_NUM != %d\n#error the table is of another SMALL_PRIME_BOUND\n#endif\n\n", num);
+    fprintf(fp, "#define TRIAL_GROUP_NUM %d  // count of the groups of the trial division\n\n", g);
+
+    WriteTable(fp, "const unsigned int smallPrime[SMALL_PRIME_NUM]", prime, num, 16, 0);
+    WriteTable(fp, "const Limb trialInv[SMALL_PRIME_NUM]", primeInv, num, 4, 1);
+    WriteTable(fp, "const Limb trialLim[SMALL_PRIME_NUM]", primeLim, num, 4, 1);
+    WriteTable(fp, "const Limb trialProduct[TRIAL_GROUP_NUM]", product, g, 4, 1);
+    WriteTable(fp, "const int trialFirst[TRIAL_GROUP_NUM + 1]", first, g + 1, 16, 0);
+
+    return fclose(fp) == 0;
+}
+
+// write the wheel bitmap of the primes less than 2^32 to file, for OpenPrimeBitmap
+// byte i has bit k set if 30i + wheelResidue[k] is a prime, 2, 3 and 5 are not in it
+// the multiples p * q of a small prime with q = wheelResidue[k] (mod 30) are 30p apart,
+// so they are p bytes apart with the same bit, and a segment is sieved in L1 cache
+// return 0 if the file can not be written
+int GenPrimeBitmap(char* path)
+{
+    int i, k;
+    unsigned int p, q, header[PRIME_BITMAP_HEADER / 4];
+    unsigned long long lo, m, byte, start, end;
+    unsigned char mask;
+    static unsigned char seg[PRIME_BITMAP_SEGMENT];
+    FILE* fp;
+
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+        return 0;
+
+    memset(header, 0, sizeof(header));
+    header[0] = PRIME_BITMAP_MAGIC;
+    header[1] = PRIME_BITMAP_BYTES;
+    fwrite(header, sizeof(header), 1, fp);
+
+    for (start = 0; start < PRIME_BITMAP_BYTES; start = end)
+    {
+        end = start + PRIME_BITMAP_SEGMENT;
+        if (end > PRIME_BITMAP_BYTES)
+            end = PRIME_BITMAP_BYTES;
+
+        memset(seg, 0xff, PRIME_BITMAP_SEGMENT);
+        if (start == 0)
+            seg[0] &= ~wheelBit[1];  // 1 is not a prime
+
+        lo = start * 30;
+
+        // the primes up to 2^16 cover 2^32, 3 and 5 are out of the wheel already
+        for (i = 2; i < SMALL_PRIME_NUM; i++)
+        {
+            p = smallPrime[i];
+            if ((unsigned long long)p * p >= end * 30)
+                break;
+
+            for (k = 0; k < 8; k++)
+            {
+                // the first q = wheelResidue[k] (mod 30) with q >= p and p * q >= lo
+                q = (unsigned int)((lo + p - 1) / p);
+                if (q < p)
+                    q = p;
+                q += (wheelResidue[k] + 30 - q % 30) % 30;
+
+                m = (unsigned long long)p * q;
+                mask = (unsigned char)~wheelBit[m % 30];
+
+                for (byte = m / 30; byte < end; byte += p)
+                    seg[byte - start] &= mask;
+            }
+        }
+
+        if (fwrite(seg, (size_t)(end - start), 1, fp) != 1)
+        {
+            fclose(fp);
+            return 0;
+        }
+    }
+
+    return fclose(fp) == 0;
+}
+
+// implement of mod by a small number, a must be non-negative
+// take 32 bit at a time from the highest bit, so it only needs
+// BIG_INT_BIT_LEN / 32 word divisions
+unsigned int DoModSmall(BigInt* a, unsigned int m)
+{
+    int i, j, len;
+    unsigned long long r = 0, w;
+
+    len = GetTrueValueLen(a);
+
+    for (i = (len - 1) / 32 * 32; i >= 0; i -= 32)
+    {
+        for (w = 0, j = i + 31; j >= i; j--)
+            w = w << 1 | a->bit[j];
+
+        r = (r << 32 | w) % m;
+    }
+
+    return (unsigned int)r;
+}
+
+// greatest common divisor of two small numbers
+unsigned long GcdSmall(unsigned long a, unsigned long b)
+{
+    unsigned long t;
+
+    while (b)
+    {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+// mark the candidates in the window which have a small prime factor
+// x = base + 2i * dir, r = base % p
+// x = 0 (mod p)       =>  i = -r * dir / 2 (mod p)
+// 2x + 1 = 0 (mod p)  =>  i = -(2r + 1) * dir / 4 (mod p)
+// if e is set, the candidates with gcd(x - 1, e) != 1 are marked too
+void DoSieveFill(Sieve* sv)
+{
+    int k;
+    unsigned long i, p, r, inv2, inv4, step;
+
+    memset(sv->composite, 0, SIEVE_WINDOW);
+
+    for (k = 0; k < sv->primeNum; k++)
+    {
+        p = smallPrime[k];
+        r = sv->residue[k];
+        inv2 = (p + 1) / 2;  // 2^-1 mod p
+
+        i = (sv->dir > 0 ? (p - r) % p : r) * inv2 % p;
+        for (; i < SIEVE_WINDOW; i += p)
+            sv->composite[i] = 1;
+
+        if (sv->safe)
+        {
+            inv4 = inv2 * inv2 % p;  // 4^-1 mod p
+            r = (2 * r + 1) % p;
+
+            i = (sv->dir > 0 ? (p - r) % p : r) * inv4 % p;
+            for (; i < SIEVE_WINDOW; i += p)
+                sv->composite[i] = 1;
+        }
+    }
+
+    if (sv->e)
+    {
+        r = (sv->eResidue + sv->e - 1) % sv->e;  // r = (x - 1) % e
+        step = sv->dir > 0 ? 2 % sv->e : sv->e - 2 % sv->e;
+
+        for (i = 0; i < SIEVE_WINDOW; i++, r = (r + step) % sv->e)
+        {
+            if (!sv->composite[i] && GcdSmall(r, sv->e) != 1)
+                sv->composite[i] = 1;
+        }
+    }
+}
+
+// init the sieve window at an odd base
+// dir: 1 for upward, -1 for downward, safe: 1 if 2x+1 is sieved too
+// e: 0 or the odd RSA exponent less than 2^31, then gcd(x - 1, e) = 1 is sieved too
+// only use the small primes less than minPrime, so no candidate
+// is sieved out by itself
+void DoSieveInit(Sieve* sv, BigInt* base, int dir, int safe, unsigned int e, unsigned long minPrime)
+{
+    int k;
+
+    CopyBigInt(base, &sv->base);
+    sv->dir = dir;
+    sv->safe = safe;
+    sv->e = e;
+    sv->eResidue = e ? DoModSmall(base, e) : 0;
+
+    for (k = 0; k < SMALL_PRIME_NUM && smallPrime[k] < minPrime; k++)
+        sv->residue[k] = DoModSmall(base, smallPrime[k]);
+
+    sv->primeNum = k;
+
+    DoSieveFill(sv);
+}
+
+// move the sieve count windows on, the window is filled once for all of them
+// the residues are updated incrementally, no BigInt division
+// return 0 if the new window is beyond the range of BigInt, the sieve is not moved
+int DoSieveSkip(Sieve* sv, int count)
+{
+    int k;
+    unsigned long p, step = 2UL * SIEVE_WINDOW * count;
+    BigInt t, w, limit;
+
+    LongToBigInt((long)step * sv->dir, &t);
+    LongToBigInt(2L * SIEVE_WINDOW * sv->dir, &w);
+
+    // limit = the max BigInt - t - w upward, the min BigInt - t - w downward
+    memset(limit.bit, sv->dir > 0, SIGN_BIT);
+    limit.bit[SIGN_BIT] = sv->dir > 0 ? POSITIVE : NEGATIVE;
+    DoSub(&limit, &t, &limit);
+    DoSub(&limit, &w, &limit);
+
+    if (DoCompare(&sv->base, &limit) * sv->dir > 0)
+        return 0;
+
+    DoAdd(&sv->base, &t, &sv->base);  // base = base + 2 * SIEVE_WINDOW * count * dir
+
+    for (k = 0; k < sv->primeNum; k++)
+    {
+        p = smallPrime[k];
+
+        if (sv->dir > 0)
+            sv->residue[k] = (sv->residue[k] + step % p) % p;
+        else
+            sv->residue[k] = (sv->residue[k] + p - step % p) % p;
+    }
+
+    if (sv->e)
+    {
+        p = sv->e;
+
+        if (sv->dir > 0)
+            sv->eResidue = (sv->eResidue + step % p) % p;
+        else
+            sv->eResidue = (sv->eResidue + p - step % p) % p;
+    }
+
+    DoSieveFill(sv);
+
+    return 1;
+}
+
+// move the sieve to the next window
+// return 0 if the next window is beyond the range of BigInt, the sieve is not moved
+int DoSieveNext(Sieve* sv)
+{
+    return DoSieveSkip(sv, 1);
+}
+
+// generate random prime by specify bit length and miller-rabin test times
+// it starts at a random odd number with the highest two bits set
+// then it searches upward, and only tests the numbers that pass the sieve
+// and the Fermat test to base 2, which runs on a batch of candidates
+// if it goes beyond bitLen bit, it starts again at a new random number
+// the search state is saved by SetCheckpoint, and it can continue after a restart
+// return NULL if it is stopped in a GenPrimeTask, or bitLen is beyond BigInt, then ERROR_OVERFLOW is set
+// the sieve windows run over 2^bitLen, so bitLen must be less than SIGN_BIT
+BigInt* DoGenRandomPrime(int bitLen, int times, BigInt* result)
+{
+    int i, k, num, over, resume;
+    unsigned long n = 1;
+    unsigned long a, b;
+    unsigned long minPrime;
+    char pass[FERMAT_BATCH];
+    BigInt t;
+    BigInt cand[FERMAT_BATCH];
+    Sieve sv;
+    Checkpoint cp;
+
+    if (bitLen >= SIGN_BIT)
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    // all the candidates are not less than 2^(bitLen-1)
+    minPrime = bitLen > 32 ? 0xffffffffUL : 1UL << (bitLen - 1);
+
+    resume = LoadCheckpoint(CHECKPOINT_RANDOM_PRIME, bitLen, times, &cp);
+    cp.kind = CHECKPOINT_RANDOM_PRIME;
+    cp.bitLen = bitLen;
+    cp.times = times;
+
+    while (1)
+    {
+        if (resume)  // the sieve starts again at the first candidate of the saved batch
+        {
+            LimbsToBigInt(cp.cand, MAX_LIMBS, &t);
+            n = (unsigned long)cp.tested + 1;
+            resume = 0;
+        }
+        else
+        {
+            DoGetOddRandBigInt(bitLen, &t);
+            if (bitLen > 1)
+                t.bit[bitLen - 2] = 1;  // the highest two bits are 1
+        }
+        DoSieveInit(&sv, &t, 1, 0, 0, minPrime);
+        num = 0;
+
+        while (1)
+        {
+            for (i = 0; i < SIEVE_WINDOW; i++)
+            {
+                if (sv.composite[i])
+                    continue;
+
+                LongToBigInt(2 * i, &t);
+                DoAdd(&sv.base, &t, &cand[num]);  // cand = base + 2i
+
+                // beyond bitLen bit, test the rest of the batch
+                over = GetTrueValueLen(&cand[num]) > bitLen;
+                if (!over && ++num < FERMAT_BATCH)
+                    continue;
+
+                if (TaskStopped())
+                    return NULL;
+
+                if (num > 0)
+                {
+                    cp.tested = n - 1;
+                    SaveCheckpoint(&cp, &cand[0]);
+                }
+
+                // the Fermat test of a batch runs in AVX2 lanes
+                DoFermatTestBatch(cand, num, pass);
+
+                for (k = 0; k < num; k++)
+                {
+                    if (!pass[k])
+                        continue;
+
+                    PrintProgress("testing number[%ld]...\n", n);
+                    a = time(0);
+
+                    if (DoMillerRabin(&cand[k], times))
+                    {
+                        b = time(0);
+                        PrintProgress("finish test number[%ld] (t=%lds)\n\n", n, b - a);
+                        ClearCheckpoint();
+                        return CopyBigInt(&cand[k], result);
+                    }
+
+                    b = time(0);
+                    PrintProgress("finish test number %ld (t=%lds)\n\n", n++, b - a);
+                }
+
+                TaskProgress(num);
+                num = 0;
+
+                if (over)
+                    break;
+            }
+
+            if (i < SIEVE_WINDOW || !DoSieveNext(&sv))  // beyond bitLen bit, start again
+                break;
+        }
+    }
+}
+
+// DoGenRandomPrime in the context ctx, the random numbers are taken from its generator
+BigInt* DoGenRandomPrimeCtx(int bitLen, int times, BigInt* result, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+    BigInt* r = DoGenRandomPrime(bitLen, times, result);
+
+    UseContext(old);
+
+    return r;
+}
+
+char* GenRandomPrime(int bitLen, int times, char* result)
+{
+    BigInt n;
+
+    ClearError();
+
+    return ResultToStr(DoGenRandomPrime(bitLen, times, &n), result);
+}
+
+// init the iterator of the primes after start, dir: 1 for upward, -1 for downward
+// the primes are given one by one by DoPrimeIterNext, the sieve window is kept
+// between the calls, so a walk over many primes costs one sieve pass
+void DoPrimeIterInit(PrimeIter* it, BigInt* start, int dir, int times)
+{
+    BigInt t, base, limit;
+
+    it->pos = 0;
+    it->times = times;
+    it->num = it->next = 0;
+    it->end = 0;
+
+    if (dir > 0)
+    {
+        LongToBigInt(2, &t);
+        it->two = DoCompare(start, &t) < 0;  // 2 is out of the sieve
+
+        // the first window must be in the range of BigInt, DoSieveNext checks the next ones
+        memset(limit.bit, 1, SIGN_BIT);
+        limit.bit[SIGN_BIT] = POSITIVE;
+        DoSub(&limit, LongToBigInt(2 * SIEVE_WINDOW + 2, &t), &limit);
+        it->end = DoCompare(start, &limit) > 0;
+
+        if (it->two || it->end)
+            LongToBigInt(3, &base);
+        else
+            DoAdd(start, LongToBigInt(start->bit[0] ? 2 : 1, &t), &base);
+    }
+    else
+    {
+        LongToBigInt(2, &t);
+        it->two = DoCompare(start, &t) > 0;  // 2 comes after the odd primes
+
+        LongToBigInt(3, &t);
+        it->end = DoCompare(start, &t) <= 0;  // no odd number below start
+
+        if (it->end)
+            LongToBigInt(3, &base);
+        else
+            DoSub(start, LongToBigInt(start->bit[0] ? 2 : 1, &t), &base);
+    }
+
+    // all the small primes are used, a small prime marked by itself is checked again
+    DoSieveInit(&it->sv, &base, dir, 0, 0, 0xffffffffUL);
+}
+
+// fill the batch of the iterator with the next sieve survivors
+// the numbers less than 2^64 get the final answer of MillerRabin64, pass = 2
+// the others get the Fermat test to base 2 in a batch, pass = 1 if they pass
+void DoPrimeIterFill(PrimeIter* it)
+{
+    int i, k, big = 0;
+    Limb x[MAX_LIMBS];
+    BigInt t;
+
+    it->num = it->next = 0;
+
+    while (it->num < FERMAT_BATCH)
+    {
+        if (it->pos == SIEVE_WINDOW)
+        {
+            if (!DoSieveNext(&it->sv))  // beyond the range of BigInt
+            {
+                it->end = 1;
+                break;
+            }
+            it->pos = 0;
+        }
+
+        i = it->pos++;
+        LongToBigInt(2L * i * it->sv.dir, &t);
+        DoAdd(&it->sv.base, &t, &it->cand[it->num]);  // cand = base + 2i * dir
+
+        if (GetTrueValueLen(&it->cand[it->num]) > LIMB_BITS)
+        {
+            if (it->sv.composite[i])
+                continue;
+
+            it->pass[it->num++] = 1;
+            big++;
+            continue;
+        }
+
+        BigIntToLimbs(&it->cand[it->num], x);
+
+        if (it->sv.dir < 0 && x[0] < 3)
+        {
+            it->end = 1;
+            break;
+        }
+
+        if (it->sv.composite[i] && (x[0] >= SMALL_PRIME_BOUND || !IsSmallPrime((unsigned long)x[0])))
+            continue;
+
+        it->pass[it->num++] = MillerRabin64(x[0]) ? 2 : 0;
+    }
+
+    if (big == it->num)
+    {
+        DoFermatTestBatch(it->cand, it->num, it->pass);
+        return;
+    }
+
+    // the batch is across 2^64, test the big ones one by one
+    for (k = 0; k < it->num; k++)
+    {
+        if (it->pass[k] == 1)
+            DoFermatTestBatch(&it->cand[k], 1, &it->pass[k]);
+    }
+}
+
+// get the next prime of the iterator
+// return NULL if there is no prime left downward,
+// or the next one is beyond the range of BigInt upward, then ERROR_OVERFLOW is set
+BigInt* DoPrimeIterNext(PrimeIter* it, BigInt* result)
+{
+    int k;
+
+    if (it->two && it->sv.dir > 0)  // 2 is the first prime upward
+    {
+        it->two = 0;
+        return LongToBigInt(2, result);
+    }
+
+    while (1)
+    {
+        while (it->next < it->num)
+        {
+            k = it->next++;
+
+            if (it->pass[k] == 2 || (it->pass[k] && DoMillerRabin(&it->cand[k], it->times)))
+                return CopyBigInt(&it->cand[k], result);
+        }
+
+        if (it->end)
+            break;
+
+        DoPrimeIterFill(it);
+    }
+
+    if (it->two)  // 2 is the last prime downward
+    {
+        it->two = 0;
+        return LongToBigInt(2, result);
+    }
+
+    if (it->sv.dir > 0)
+        SetError(ERROR_OVERFLOW);
+
+    return NULL;
+}
+
+// the smallest prime greater than x
+BigInt* DoNextPrime(BigInt* x, int times, BigInt* result)
+{
+    PrimeIter it;
+
+    DoPrimeIterInit(&it, x, 1, times);
+
+    return DoPrimeIterNext(&it, result);
+}
+
+// DoNextPrime in the context ctx, the functions it calls take their state from ctx too
+BigInt* DoNextPrimeCtx(BigInt* x, int times, BigInt* result, Context* ctx)
+{
+    Context* old = UseContext(ctx);
+    BigInt* r = DoNextPrime(x, times, result);
+
+    UseContext(old);
+
+    return r;
+}
+
+// the biggest prime less than x, return NULL if x <= 2
+BigInt* DoPrevPrime(BigInt* x, int times, BigInt* result)
+{
+    PrimeIter it;
+
+    DoPrimeIterInit(&it, x, -1, times);
+
+    return DoPrimeIterNext(&it, result);
+}
+
+// return NULL if the prime is beyond the range of BigInt
+char* NextPrime(char* x, int times, char* result)
+{
+    BigInt a, r;
+
+    ClearError();
+    StrToBigInt(x, &a);
+
+    return ResultToStr(DoNextPrime(&a, times, &r), result);
+}
+
+// return NULL if x <= 2
+char* PrevPrime(char* x, int times, char* result)
+{
+    BigInt a, r;
+
+    ClearError();
+    StrToBigInt(x, &a);
+
+    return ResultToStr(DoPrevPrime(&a, times, &r), result);
+}
+
+// generate safe prime p = 2q + 1 by specify bit length and miller-rabin test times
+// random = 0: the biggest safe prime in bitLen bit, it searches downward
+//             from 2^bitLen - 1 like DoGenPrime
+// random = 1: it starts at a random number with the highest two bits set,
+//             and searches upward like DoGenRandomPrime
+// q and 2q + 1 are sieved together, then both of them must pass the cheap
+// Fermat test to base 2 before the Miller-Rabin test
+// notice: bitLen must be at least 3
+// return NULL and set ERROR_OVERFLOW if bitLen is beyond BigInt, upward it must be less than SIGN_BIT
+BigInt* DoGenSafePrime(int bitLen, int times, int random, BigInt* result)
+{
+    int i, k, num, over, dir = random ? 1 : -1;
+    unsigned long n = 1;
+    unsigned long a, b;
+    unsigned long minPrime;
+    char pass[FERMAT_BATCH];
+    BigInt q, t;
+    BigInt cand[FERMAT_BATCH];
+    Sieve sv;
+
+    if (bitLen > (random ? SIGN_BIT - 1 : SIGN_BIT))
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    if (!random && GetCachedPrime(bitLen, PRIME_CACHE_SAFE_PRIME, times, result))
+    {
+        PrintProgress("found in the prime cache\n\n");
+        return result;
+    }
+
+    // all the q are not less than 2^(bitLen-2)
+    minPrime = bitLen > 33 ? 0xffffffffUL : 1UL << (bitLen - 2);
+
+    while (1)
+    {
+        if (random)
+        {
+            DoGetOddRandBigInt(bitLen - 1, &q);
+
+            // the highest two bits of 2q + 1 are 1
+            // but small safe primes are too sparse for that, 4 bit has none
+            if (bitLen > 16)
+                q.bit[bitLen - 3] = 1;
+        }
+        else
+        {
+            memset(q.bit, 0, BIG_INT_BIT_LEN);
+            for (i = 0; i < bitLen - 1; i++)  // q = 2^(bitLen-1) - 1
+                q.bit[i] = 1;
+        }
+
+        DoSieveInit(&sv, &q, dir, 1, 0, minPrime);
+        num = 0;
+
+        while (1)
+        {
+            for (i = 0; i < SIEVE_WINDOW; i++)
+            {
+                if (sv.composite[i])
+                    continue;
+
+                LongToBigInt(2 * i * dir, &t);
+                DoAdd(&sv.base, &t, &cand[num]);  // cand = base + 2i * dir
+
+                // out of bitLen bit, test the rest of the batch
+                over = GetTrueValueLen(&cand[num]) != bitLen - 1;
+                if (!over && ++num < FERMAT_BATCH)
+                    continue;
+
+                // most of the candidates stop here
+                // the Fermat test of a batch of q runs in AVX2 lanes
+                DoFermatTestBatch(cand, num, pass);
+
+                for (k = 0; k < num; k++)
+                {
+                    if (!pass[k])
+                        continue;
+
+                    ShiftArithmeticLeft(&cand[k], 1, result);
+                    DoAdd(result, &bigOne, result);  // result = 2q + 1
+
+                    if (!DoFermatTest(result))
+                        continue;
+
+                    PrintProgress("testing number[%ld]...\n", n);
+                    a = time(0);
+
+                    if (DoMillerRabin(&cand[k], times) && DoMillerRabin(result, times))
+                    {
+                        b = time(0);
+                        PrintProgress("finish test number[%ld] (t=%lds)\n\n", n, b - a);
+
+                        if (!random)
+                            PutCachedPrime(bitLen, PRIME_CACHE_SAFE_PRIME, times, result);
+
+                        return result;
+                    }
+
+                    b = time(0);
+                    PrintProgress("finish test number %ld (t=%lds)\n\n", n++, b - a);
+                }
+
+                num = 0;
+
+                if (over)
+                    break;
+            }
+
+            if (i < SIEVE_WINDOW || !DoSieveNext(&sv))  // out of bitLen bit, start again
+                break;
+        }
+    }
+}
+
+char* GenSafePrime(int bitLen, int times, int random, char* result)
+{
+    BigInt n;
+
+    ClearError();
+
+    return ResultToStr(DoGenSafePrime(bitLen, times, random, &n), result);
+}
+
+#ifdef _WIN32
+typedef struct    // type:ThreadStartInfo, function and argument of a new thread
+{
+    void* (*fn)(void*);
+    void* arg;
+}ThreadStartInfo;
+
+DWORD WINAPI ThreadEntry(LPVOID p)
+{
+    ThreadStartInfo info = *(ThreadStartInfo*)p;
+
+    free(p);
+    info.fn(info.arg);
+
+    return 0;
+}
+#endif
+
+// run fn(arg) in a new thread, return 0 if the thread can not be created
+int ThreadStart(Thread* t, void* (*fn)(void*), void* arg)
+{
+#ifdef _WIN32
+    ThreadStartInfo* info = (ThreadStartInfo*)malloc(sizeof(ThreadStartInfo));
+
+    if (info == NULL)
+        return 0;
+
+    info->fn = fn;
+    info->arg = arg;
+    *t = CreateThread(NULL, 0, ThreadEntry, info, 0, NULL);
+
+    if (*t == NULL)
+    {
+        free(info);
+        return 0;
+    }
+
+    return 1;
+#else
+    return pthread_create(t, NULL, fn, arg) == 0;
+#endif
+}
+
+// wait for the thread to finish
+void ThreadJoin(Thread t)
+{
+#ifdef _WIN32
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+#else
+    pthread_join(t, NULL);
+#endif
+}
+
+// let the other threads run, while a ring is full or empty
+void ThreadYield()
+{
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+// thread function of GenPrimeAsync
+void* GenPrimeThread(void* arg)
+{
+    GenPrimeTask* task = (GenPrimeTask*)arg;
+    BigInt* r;
+
+    // the tasks run at the same time, one checkpoint file would be overwritten by all of them
+    GetContext()->noCheckpoint = 1;
+    threadTask = task;
+    if (task->random)
+        r = DoGenRandomPrime(task->bitLen, task->times, &task->result);
+    else
+        r = DoGenPrime(task->bitLen, task->times, &task->result);
+    threadTask = NULL;
+
+    MutexLock(&task->lock);
+    if (r != NULL)
+        task->state = GEN_TASK_FOUND;
+    else
+        task->state = task->cancel ? GEN_TASK_CANCELED : GEN_TASK_EXPIRED;
+    CondBroadcast(&task->finish);
+    MutexUnlock(&task->lock);
+
+    return NULL;
+}
+
+// start GenPrime (random = 0) or GenRandomPrime (random = 1) in a new thread, and return its handle at once
+// timeoutMs: the search stops after it, 0 for no deadline
+// progress(tested, arg) is called in the thread of the search after each batch of candidates, it can be NULL
+// the search stops within one Miller-Rabin round after GenPrimeCancel or the deadline, it saves no checkpoint
+// return NULL if bitLen is beyond BigInt or the thread can not be created, the handle must be freed by GenPrimeFree
+GenPrimeTask* GenPrimeAsync(int bitLen, int times, int random, long long timeoutMs, GenPrimeProgress progress, void* arg)
+{
+    GenPrimeTask* task;
+
+    if (bitLen > (random ? SIGN_BIT - 1 : SIGN_BIT))
+        return NULL;
+
+    task = (GenPrimeTask*)calloc(1, sizeof(GenPrimeTask));
+    if (task == NULL)
+        return NULL;
+
+    task->bitLen = bitLen;
+    task->times = times;
+    task->random = random;
+    task->deadline = timeoutMs > 0 ? NowMs() + timeoutMs : 0;
+    task->state = GEN_TASK_RUNNING;
+    task->progress = progress;
+    task->arg = arg;
+    MutexInit(&task->lock);
+    CondInit(&task->finish);
+
+    if (!ThreadStart(&task->thread, GenPrimeThread, task))
+    {
+        CondFree(&task->finish);
+        MutexFree(&task->lock);
+        free(task);
+        return NULL;
+    }
+
+    return task;
+}
+
+// ask the search to stop, GenPrimeWait tells when it has stopped
+void GenPrimeCancel(GenPrimeTask* task)
+{
+    task->cancel = 1;
+}
+
+// return the state of the search without waiting
+int GenPrimePoll(GenPrimeTask* task)
+{
+    int state;
+
+    MutexLock(&task->lock);
+    state = task->state;
+    MutexUnlock(&task->lock);
+
+    return state;
+}
+
+// wait for the search to finish, and return its state
+// result gets the prime if the state is GEN_TASK_FOUND, it can be NULL
+int GenPrimeWait(GenPrimeTask* task, BigInt* result)
+{
+    int state;
+
+    MutexLock(&task->lock);
+    while (task->state == GEN_TASK_RUNNING)
+        CondWait(&task->finish, &task->lock);
+    state = task->state;
+    MutexUnlock(&task->lock);
+
+    if (state == GEN_TASK_FOUND && result != NULL)
+        CopyBigInt(&task->result, result);
+
+    return state;
+}
+
+// cancel the search if it still runs, wait for its thread and free the handle
+void GenPrimeFree(GenPrimeTask* task)
+{
+    GenPrimeCancel(task);
+    GenPrimeWait(task, NULL);
+    ThreadJoin(task->thread);
+    CondFree(&task->finish);
+    MutexFree(&task->lock);
+    free(task);
+}
+
+// the free slot of the ring for the producer, NULL if it is full
+INLINE PipeItem* PipeRingSlot(PipeRing* r)
+{
+    return r->tail - LOAD_ACQUIRE(&r->head) < PIPE_RING ? &r->item[r->tail % PIPE_RING] : NULL;
+}
+
+// the next item of the ring for the consumer, NULL if it is empty
+INLINE PipeItem* PipeRingPeek(PipeRing* r)
+{
+    return LOAD_ACQUIRE(&r->tail) != r->head ? &r->item[r->head % PIPE_RING] : NULL;
+}
+
+// a free slot in one of the n rings of a producer, the first one from *next that is not full
+// it waits while all of them are full, so a slow stage holds back the ones before it
+// the item is given to the consumer by PipePut
+PipeItem* PipeSlot(PipeRing* ring, int n, int* next)
+{
+    int k;
+    PipeItem* x;
+
+    while (1)
+    {
+        for (k = 0; k < n; k++)
+        {
+            x = PipeRingSlot(&ring[(*next + k) % n]);
+            if (x != NULL)
+            {
+                *next = (*next + k) % n;
+                return x;
+            }
+        }
+
+        ThreadYield();
+    }
+}
+
+// give the item of PipeSlot to the consumer, the next item goes to the next ring
+void PipePut(PipeRing* ring, int n, int* next)
+{
+    STORE_RELEASE(&ring[*next].tail, ring[*next].tail + 1);
+    *next = (*next + 1) % n;
+}
+
+// the next item of the n rings of a consumer, ring i is ring[i * stride], the first one from *next with an item
+// it waits while all of them are empty, return NULL when all of them are closed and empty
+// the slot is given back to the producer by PipeTake
+PipeItem* PipePeek(PipeRing* ring, int n, int stride, int* next)
+{
+    int k, closed;
+    PipeRing* r;
+    PipeItem* x;
+
+    while (1)
+    {
+        for (closed = 0, k = 0; k < n; k++)
+        {
+            r = &ring[(*next + k) % n * stride];
+            x = PipeRingPeek(r);
+
+            // an item put before closed is seen by the second peek
+            if (x == NULL && LOAD_ACQUIRE(&r->closed))
+                x = PipeRingPeek(r);
+
+            if (x != NULL)
+            {
+                *next = (*next + k) % n;
+                return x;
+            }
+
+            closed += LOAD_ACQUIRE(&r->closed) != 0;
+        }
+
+        if (closed == n)
+            return NULL;
+
+        ThreadYield();
+    }
+}
+
+// give the slot of PipePeek back to the producer
+void PipeTake(PipeRing* ring, int stride, int* next)
+{
+    PipeRing* r = &ring[*next * stride];
+
+    STORE_RELEASE(&r->head, r->head + 1);
+}
+
+// close the n rings of a producer
+void PipeClose(PipeRing* ring, int n)
+{
+    int k;
+
+    for (k = 0; k < n; k++)
+        STORE_RELEASE(&ring[k].closed, 1);
+}
+
+// sieve stage of the pipeline, thread i sieves the windows i, i + num[0], ... downward from start
+// it stops after the window of the best prime found
+void* PipeSieveThread(void* arg)
+{
+    PipeWorker* w = (PipeWorker*)arg;
+    Pipeline* pl = w->pl;
+    PipeRing* out = pl->ring[0] + w->index * pl->num[1];
+    PipeItem* x;
+    int i, next = 0;
+    long long win, seq;
+    BigInt t;
+    Sieve sv;
+
+    LongToBigInt(2L * SIEVE_WINDOW * w->index, &t);
+    DoSub(&pl->start, &t, &t);
+    DoSieveInit(&sv, &t, -1, 0, 0, pl->minPrime);
+
+    for (win = w->index; win * SIEVE_WINDOW < LOAD_ACQUIRE(&pl->best); win += pl->num[0])
+    {
+        for (i = 0; i < SIEVE_WINDOW; i++)
+        {
+            if (sv.composite[i])
+                continue;
+
+            seq = win * SIEVE_WINDOW + i;
+            if (seq > LOAD_ACQUIRE(&pl->best))
+                break;
+
+            x = PipeSlot(out, pl->num[1], &next);
+            x->seq = seq;
+            LongToBigInt(2 * i, &t);
+            DoSub(&sv.base, &t, &x->n);  // n = base - 2i
+            PipePut(out, pl->num[1], &next);
+        }
+
+        // the windows between are sieved by the other threads
+        DoSieveSkip(&sv, pl->num[0]);
+    }
+
+    PipeClose(out, pl->num[1]);
+
+    return NULL;
+}
+
+// filter stage of the pipeline, a batch of candidates gets the Fermat test to base 2 together,
+// and the ones that pass go to the confirm stage
+void* PipeFilterThread(void* arg)
+{
+    PipeWorker* w = (PipeWorker*)arg;
+    Pipeline* pl = w->pl;
+    PipeRing* in = pl->ring[0] + w->index;
+    PipeRing* out = pl->ring[1] + w->index * pl->num[2];
+    PipeItem* x;
+    int k, num, end = 0, nextIn = 0, nextOut = 0;
+    long long seq[FERMAT_BATCH];
+    char pass[FERMAT_BATCH];
+    BigInt cand[FERMAT_BATCH];
+
+    while (!end)
+    {
+        for (num = 0; num < FERMAT_BATCH; )
+        {
+            x = PipePeek(in, pl->num[0], pl->num[1], &nextIn);
+            if (x == NULL)
+            {
+                end = 1;
+                break;
+            }
+
+            // a candidate after the best prime is dropped
+            if (x->seq < LOAD_ACQUIRE(&pl->best))
+            {
+                seq[num] = x->seq;
+                CopyBigInt(&x->n, &cand[num++]);
+            }
+            PipeTake(in, pl->num[1], &nextIn);
+        }
+
+        if (num == 0)
+            continue;
+
+        DoFermatTestBatch(cand, num, pass);
+
+        for (k = 0; k < num; k++)
+        {
+            if (!pass[k])
+                continue;
+
+            x = PipeSlot(out, pl->num[2], &nextOut);
+            x->seq = seq[k];
+            CopyBigInt(&cand[k], &x->n);
+            PipePut(out, pl->num[2], &nextOut);
+        }
+    }
+
+    PipeClose(out, pl->num[2]);
+
+    return NULL;
+}
+
+// confirm stage of the pipeline, the full Miller-Rabin test, the prime with the smallest seq is kept
+void* PipeConfirmThread(void* arg)
+{
+    PipeWorker* w = (PipeWorker*)arg;
+    Pipeline* pl = w->pl;
+    PipeRing* in = pl->ring[1] + w->index;
+    PipeItem* x;
+    int next = 0;
+
+    while ((x = PipePeek(in, pl->num[1], pl->num[2], &next)) != NULL)
+    {
+        if (x->seq < LOAD_ACQUIRE(&pl->best) && DoMillerRabin(&x->n, pl->times))
+        {
+            MutexLock(&pl->lock);
+            if (x->seq < pl->best)
+            {
+                CopyBigInt(&x->n, &pl->result);
+                STORE_RELEASE(&pl->best, x->seq);
+            }
+            MutexUnlock(&pl->lock);
+        }
+
+        PipeTake(in, pl->num[2], &next);
+    }
+
+    return NULL;
+}
+
+// generate the same prime as DoGenPrime, the biggest one of bitLen bit, by a pipeline of 3 stages:
+// sieveNum threads sieve the odd numbers downward, filterNum threads run the Fermat test to base 2 on batches,
+// and confirmNum threads run the Miller-Rabin test
+// the stages are joined by bounded rings of one producer and one consumer each, with no lock,
+// so the stages overlap, and a full ring holds back the stage before it
+// a prime is the answer when all the candidates before it are tested, the ones after it are dropped
+// it has no checkpoint, the prime cache is used as in DoGenPrime
+// with no memory or no thread for the pipeline, it falls back to DoGenPrime in this thread
+// return NULL and set ERROR_OVERFLOW if bitLen is beyond BigInt
+BigInt* DoGenPrimePipeline(int bitLen, int times, int sieveNum, int filterNum, int confirmNum, BigInt* result)
+{
+    int i, k, n, found = 0, failed = 0;
+    int started[3] = {0, 0, 0};
+    Pipeline* pl;
+    PipeWorker w[3 * PIPE_MAX_THREADS];
+    Thread th[3 * PIPE_MAX_THREADS];
+    void* (*fn[3])(void*) = {PipeSieveThread, PipeFilterThread, PipeConfirmThread};
+
+    // a few windows cover all the numbers of bitLen bit
+    if (bitLen < 24 || bitLen > SIGN_BIT)
+        return DoGenPrime(bitLen, times, result);
+
+    if (GetCachedPrime(bitLen, PRIME_CACHE_GEN_PRIME, times, result))
+        return result;
+
+    // with no memory for the pipeline, DoGenPrime gives the same prime
+    pl = (Pipeline*)malloc(sizeof(Pipeline));
+    if (pl == NULL)
+        return DoGenPrime(bitLen, times, result);
+
+    pl->times = times;
+    pl->num[0] = sieveNum;
+    pl->num[1] = filterNum;
+    pl->num[2] = confirmNum;
+    for (k = 0; k < 3; k++)
+    {
+        if (pl->num[k] < 1)
+            pl->num[k] = 1;
+        if (pl->num[k] > PIPE_MAX_THREADS)
+            pl->num[k] = PIPE_MAX_THREADS;
+    }
+
+    pl->minPrime = bitLen > 32 ? 0xffffffffUL : 1UL << (bitLen - 1);
+    pl->best = PIPE_NONE;
+    pl->ring[0] = (PipeRing*)calloc(pl->num[0] * pl->num[1], sizeof(PipeRing));
+    pl->ring[1] = (PipeRing*)calloc(pl->num[1] * pl->num[2], sizeof(PipeRing));
+    if (pl->ring[0] == NULL || pl->ring[1] == NULL)
+    {
+        free(pl->ring[0]);
+        free(pl->ring[1]);
+        free(pl);
+        return DoGenPrime(bitLen, times, result);
+    }
+
+    memset(pl->start.bit, 0, BIG_INT_BIT_LEN);
+    for (i = 0; i < bitLen; i++)   // set all 1, the biggest odd
+        pl->start.bit[i] = 1;
+
+    // Lucas-Lehmer gives a proven answer for 2^bitLen - 1
+    if (2 * bitLen < SIGN_BIT)
+    {
+        if (LucasLehmer(bitLen))
+        {
+            CopyBigInt(&pl->start, &pl->result);
+            found = 1;
+        }
+        DoSub(&pl->start, &bigTwo, &pl->start);
+    }
+
+    MutexInit(&pl->lock);
+
+    // the consumers start before their producers, so a started thread never waits on a stage that is not started
+    for (n = 0, k = 2; !found && !failed && k >= 0; k--)
+    {
+        for (i = 0; i < pl->num[k]; i++)
+        {
+            w[n].pl = pl;
+            w[n].index = i;
+
+            if (!ThreadStart(&th[n], fn[k], &w[n]))
+            {
+                failed = 1;
+                break;
+            }
+            started[k]++;
+            n++;
+        }
+    }
+
+    // a thread can not be started: the started ones drop all their candidates,
+    // and the rings of the producers not started are closed, so all of them end
+    if (failed)
+    {
+        STORE_RELEASE(&pl->best, -1LL);
+        for (k = 0; k < 2; k++)
+        {
+            for (i = started[k]; i < pl->num[k]; i++)
+                PipeClose(pl->ring[k] + i * pl->num[k + 1], pl->num[k + 1]);
+        }
+    }
+
+    for (i = 0; i < n; i++)
+        ThreadJoin(th[i]);
+
+    if (!failed)
+    {
+        CopyBigInt(&pl->result, result);
+        PutCachedPrime(bitLen, PRIME_CACHE_GEN_PRIME, times, result);
+    }
+
+    MutexFree(&pl->lock);
+    free(pl->ring[0]);
+    free(pl->ring[1]);
+    free(pl);
+
+    // DoGenPrime gives the same prime in this thread
+    if (failed)
+        return DoGenPrime(bitLen, times, result);
+
+    return result;
+}
+
+char* GenPrimePipeline(int bitLen, int times, int threadNum, char* result)
+{
+    BigInt n;
+
+    ClearError();
+
+    // the confirm stage is the slow one
+    return ResultToStr(DoGenPrimePipeline(bitLen, times, 1, 1, threadNum, &n), result);
+}
+
+// test the big candidates of a segment, bit j of bits is set if cand[k] is a prime, j = idx[k]
+// return the count of the primes
+int DoRangeTestBatch(BigInt* cand, int* idx, int num, int times, unsigned char* bits)
+{
+    int k, count = 0;
+    char pass[FERMAT_BATCH];
+
+    DoFermatTestBatch(cand, num, pass);
+
+    for (k = 0; k < num; k++)
+    {
+        if (pass[k] && DoMillerRabin(&cand[k], times))
+        {
+            bits[idx[k] / 8] |= 1 << (idx[k] % 8);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// test the candidates of a segment less than 2^64, bit j of bits is set if n[k] is a prime, j = idx[k]
+// return the count of the primes
+int DoRangeTestBatch64(unsigned long long* n, int* idx, int num, unsigned char* bits)
+{
+    int k, count;
+    char prime[8 * MR64_LANES];
+
+    count = MillerRabin64Batch(n, num, prime);
+
+    for (k = 0; k < num; k++)
+    {
+        if (prime[k])
+            bits[idx[k] / 8] |= 1 << (idx[k] % 8);
+    }
+
+    return count;
+}
+
+// sieve and test the n numbers a + off, a + off + 1, ..., off is even
+// bit j of bits is set if a + off + j is a prime, return the count of the primes
+// the flags of the odd numbers fit L1 cache, and the residues of a are shared,
+// so a segment needs no BigInt division
+long long DoRangeSegment(RangeState* pr, unsigned long long off, int n, unsigned char* bits)
+{
+    int i, j, j0, k, m, num, small;
+    int idx[FERMAT_BATCH], idx64[8 * MR64_LANES];
+    unsigned long p, r;
+    unsigned long long x0, x, pp, n64[8 * MR64_LANES];
+    long long count = 0;
+    char composite[RANGE_SEGMENT / 2];
+    Limb t[MAX_LIMBS + 1];
+    BigInt cand[FERMAT_BATCH];
+
+    memset(bits, 0, (n + 7) / 8);
+
+    j0 = (pr->a[0] & 1) ? 0 : 1;  // x0 = a + off + j0 is the first odd number
+    m = (n - j0 + 1) / 2;         // count of the odd numbers, x = x0 + 2i
+    memset(composite, 0, m);
+
+    // 1 if all the numbers are less than 2^64, then x0 is right
+    small = pr->len <= 1 && off + n <= ~pr->a[0];
+    x0 = pr->a[0] + off + j0;
+
+    if (small && pr->a[0] + off <= 2 && pr->a[0] + off + n > 2)  // 2 is out of the sieve
+    {
+        j = (int)(2 - pr->a[0] - off);
+        bits[j / 8] |= 1 << (j % 8);
+        count++;
+    }
+
+    for (k = 0; k < SMALL_PRIME_NUM; k++)
+    {
+        p = smallPrime[k];
+        r = (pr->residue[k] + (off + j0) % p) % p;  // r = x0 % p
+        i = (int)((p - r) % p * ((p + 1) / 2) % p); // x0 + 2i = 0 (mod p)
+
+        // a multiple less than p^2 is p itself or has a smaller factor
+        pp = (unsigned long long)p * p;
+        if (small && x0 < pp)
+        {
+            if ((pp - x0) / 2 >= (unsigned long long)m)
+                continue;
+            i = (int)((pp - x0) / 2);
+        }
+
+        for (; i < m; i += p)
+            composite[i] = 1;
+    }
+
+    for (num = 0, i = 0; i < m; i++)
+    {
+        if (composite[i])
+            continue;
+
+        j = j0 + 2 * i;
+
+        // the survivors less than SMALL_PRIME_BOUND^2 are primes, except 1
+        // the bigger ones less than 2^64 are tested in lanes by MillerRabin64Batch
+        if (small)
+        {
+            x = x0 + 2 * i;
+            if (x >= (unsigned long long)SMALL_PRIME_BOUND * SMALL_PRIME_BOUND)
+            {
+                n64[num] = x;
+                idx64[num++] = j;
+            }
+            else if (x > 1)
+            {
+                bits[j / 8] |= 1 << (j % 8);
+                count++;
+            }
+
+            if (num == 8 * MR64_LANES)
+            {
+                count += DoRangeTestBatch64(n64, idx64, num, bits);
+                num = 0;
+            }
+            continue;
+        }
+
+        // cand = a + off + j
+        memcpy(t, pr->a, pr->len * sizeof(Limb));
+        t[pr->len] = 0;
+        x = off + j;
+        LimbsAddTo(t, pr->len + 1, &x, 1);
+        LimbsToBigInt(t, pr->len + 1, &cand[num]);
+        idx[num++] = j;
+
+        if (num == FERMAT_BATCH)
+        {
+            count += DoRangeTestBatch(cand, idx, num, pr->times, bits);
+            num = 0;
+        }
+    }
+
+    if (num > 0 && small)
+        count += DoRangeTestBatch64(n64, idx64, num, bits);
+    else if (num > 0)
+        count += DoRangeTestBatch(cand, idx, num, pr->times, bits);
+
+    return count;
+}
+
+// thread function of DoPrimeRange, it takes the segments first, first + step, ... of a round
+void* PrimeRangeThread(void* arg)
+{
+    RangeTask* task = (RangeTask*)arg;
+    unsigned long long off;
+    int n;
+
+    task->count = 0;
+
+    for (off = task->origin + (unsigned long long)task->first * RANGE_SEGMENT; off < task->end;
+         off += (unsigned long long)task->step * RANGE_SEGMENT)
+    {
+        n = task->end - off < RANGE_SEGMENT ? (int)(task->end - off) : RANGE_SEGMENT;
+        task->count += DoRangeSegment(task->pr, off, n, task->bitmap + (off - task->origin) / 8);
+    }
+
+    return NULL;
+}
+
+// the primes in [a, b] by a segmented sieve, 0 <= a <= b, b - a < 2^62
+// the range is cut into rounds of threadNum * RANGE_ROUND segments,
+// the threads sieve and test the segments of a round in turn,
+// then cb(p, arg) is called for each prime of the round in order
+// bitmap: NULL, or (b - a) / 8 + 1 bytes, bit i is set if a + i is a prime
+// cb can be NULL, return the count of the primes, or -1 and set ERROR_RANGE if b - a >= 2^62,
+// or ERROR_MEMORY if there is no memory
+long long DoPrimeRange(BigInt* a, BigInt* b, int times, int threadNum, PrimeRangeCallback cb, void* arg,
+                       unsigned char* bitmap)
+{
+    int i, k, len, started[RANGE_MAX_THREADS];
+    unsigned long long origin, end, round;
+    long long count = 0;
+    Limb o, t[MAX_LIMBS + 1];
+    unsigned char* bits;
+    BigInt d, p;
+    RangeState* pr;
+    RangeTask task[RANGE_MAX_THREADS];
+    Thread th[RANGE_MAX_THREADS];
+
+    if (a->bit[SIGN_BIT] == NEGATIVE || DoCompare(a, b) > 0)
+        return 0;
+
+    if (threadNum < 1)
+        threadNum = 1;
+    if (threadNum > RANGE_MAX_THREADS)
+        threadNum = RANGE_MAX_THREADS;
+
+    DoSub(b, a, &d);  // d = b - a
+    if (GetTrueValueLen(&d) > 62)
+    {
+        SetError(ERROR_RANGE);
+        return -1;
+    }
+
+    pr = (RangeState*)malloc(sizeof(RangeState));
+    if (pr == NULL)
+    {
+        SetError(ERROR_MEMORY);
+        return -1;
+    }
+
+    memset(t, 0, sizeof(t));
+    BigIntToLimbs(&d, t);
+    pr->total = t[0] + 1;
+    pr->len = BigIntToLimbs(a, pr->a);
+    pr->times = times;
+
+    for (k = 0; k < SMALL_PRIME_NUM; k++)
+        pr->residue[k] = DoModSmall(a, smallPrime[k]);
+
+    round = (unsigned long long)threadNum * RANGE_ROUND * RANGE_SEGMENT;
+    bits = bitmap ? NULL : (unsigned char*)malloc(round / 8);
+    if (bitmap == NULL && bits == NULL)
+    {
+        free(pr);
+        SetError(ERROR_MEMORY);
+        return -1;
+    }
+
+    for (origin = 0; origin < pr->total; origin += round)
+    {
+        end = pr->total - origin < round ? pr->total : origin + round;
+
+        for (i = 0; i < threadNum; i++)
+        {
+            task[i].pr = pr;
+            task[i].origin = origin;
+            task[i].end = end;
+            task[i].first = i;
+            task[i].step = threadNum;
+            task[i].bitmap = bitmap ? bitmap + origin / 8 : bits;
+        }
+
+        // thread 0 is the calling thread
+        for (i = 1; i < threadNum; i++)
+            started[i] = ThreadStart(&th[i], PrimeRangeThread, &task[i]);
+
+        PrimeRangeThread(&task[0]);
+
+        for (i = 1; i < threadNum; i++)
+        {
+            if (started[i])
+                ThreadJoin(th[i]);
+            else
+                PrimeRangeThread(&task[i]);
+        }
+
+        for (i = 0; i < threadNum; i++)
+            count += task[i].count;
+
+        if (cb == NULL)
+            continue;
+
+        // the primes of the round in order
+        for (i = 0; i < (int)(end - origin); i++)
+        {
+            if ((task[0].bitmap[i / 8] >> (i % 8) & 1) == 0)
+                continue;
+
+            memcpy(t, pr->a, pr->len * sizeof(Limb));
+            t[pr->len] = 0;
+            len = pr->len + 1;
+            o = origin + i;
+            LimbsAddTo(t, len, &o, 1);              // p = a + origin + i
+            cb(LimbsToBigInt(t, len, &p), arg);
+        }
+    }
+
+    free(bits);
+    free(pr);
+
+    return count;
+}
+
+// count the primes in [a, b] by threadNum threads, return -1 if b - a >= 2^62 or there is no memory
+long long PrimeRange(char* a, char* b, int times, int threadNum)
+{
+    BigInt x, y;
+
+    ClearError();
+    StrToBigInt(a, &x);
+    StrToBigInt(b, &y);
+
+    return DoPrimeRange(&x, &y, times, threadNum, NULL, NULL, NULL);
+}
+
+// generate a random prime for RSA by specify bit length and miller-rabin test times
+// the highest two bits are 1, so p > sqrt(2) * 2^(bitLen-1) as FIPS 186 requires,
+// and the product of two such primes has exactly 2 * bitLen bit
+// the sieve drops p = 1 mod e, which is gcd(p - 1, e) = 1 for a prime e, such as 65537,
+// for other e, DoGenRsaKey still checks that e has an inverse mod lambda
+// the candidates must pass the Fermat test to base 2 before the Miller-Rabin test
+// e must be odd, at least 3 and less than 2^31, bitLen at least 32
+// return NULL and set ERROR_ARGUMENT if they are not, or ERROR_OVERFLOW if bitLen is beyond BigInt
+BigInt* DoGenRsaPrime(int bitLen, int times, unsigned int e, BigInt* result)
+{
+    int i, k, num, over;
+    unsigned long minPrime;
+    char pass[FERMAT_BATCH];
+    BigInt t;
+    BigInt cand[FERMAT_BATCH];
+    Sieve sv;
+
+    // with e = 1 or an even e, every candidate is sieved out
+    if (bitLen < 32 || e < 3 || e % 2 == 0 || e > 0x7fffffffU)
+    {
+        SetError(ERROR_ARGUMENT);
+        return NULL;
+    }
+
+    if (bitLen > SIGN_BIT)
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    // all the candidates are not less than 2^(bitLen-1)
+    minPrime = bitLen > 32 ? 0xffffffffUL : 1UL << (bitLen - 1);
+
+    while (1)
+    {
+        DoGetOddRandBigInt(bitLen, &t);
+        t.bit[bitLen - 2] = 1;  // the highest two bits are 1
+        DoSieveInit(&sv, &t, 1, 0, e, minPrime);
+        num = 0;
+
+        while (1)
+        {
+            for (i = 0; i < SIEVE_WINDOW; i++)
+            {
+                if (sv.composite[i])
+                    continue;
+
+                LongToBigInt(2 * i, &t);
+                DoAdd(&sv.base, &t, &cand[num]);  // cand = base + 2i
+
+                // beyond bitLen bit, test the rest of the batch
+                over = GetTrueValueLen(&cand[num]) > bitLen;
+                if (!over && ++num < FERMAT_BATCH)
+                    continue;
+
+                // the Fermat test of a batch runs in AVX2 lanes
+                DoFermatTestBatch(cand, num, pass);
+
+                for (k = 0; k < num; k++)
+                {
+                    if (pass[k] && DoMillerRabin(&cand[k], times))
+                        return CopyBigInt(&cand[k], result);
+                }
+
+                num = 0;
+
+                if (over)
+                    break;
+            }
+
+            if (i < SIEVE_WINDOW || !DoSieveNext(&sv))  // beyond bitLen bit, start again
+                break;
+        }
+    }
+}
+
+// thread function of DoGenRsaPrime
+void* RsaPrimeThread(void* arg)
+{
+    RsaPrimeTask* task = (RsaPrimeTask*)arg;
+
+    task->seeded = SeedSecureRand();
+    if (task->seeded)
+        DoGenRsaPrime(task->bitLen, task->times, task->e, &task->result);
+
+    return NULL;
+}
+
+// generate RSA key pair by specify bit length of n and miller-rabin test times
+// e must be odd, at least 3 and less than 2^31, bitLen must be even and at least 64
+// p and q are generated in parallel by the ChaCha20 CSPRNG, and the calling
+// thread is switched to it
+// as FIPS 186 requires, |p - q| > 2^(bitLen/2 - 100) and d > 2^(bitLen/2),
+// otherwise they are generated again
+// if you generate a big key, make sure the BIG_INT_BIT_LEN is enough
+// return NULL and set ERROR_ARGUMENT if bitLen or e is not one it takes, ERROR_OVERFLOW if n is beyond BigInt,
+// or ERROR_ENTROPY if the operating system gives no entropy for the CSPRNG
+RsaKey* DoGenRsaKey(int bitLen, int times, unsigned int e, RsaKey* key)
+{
+    int len, started;
+    Limb p[MAX_LIMBS], q[MAX_LIMBS], p1[MAX_LIMBS], q1[MAX_LIMBS];
+    Limb g[MAX_LIMBS], lambda[MAX_LIMBS], d[MAX_LIMBS], el[MAX_LIMBS] = {0};
+    Limb t[2 * MAX_LIMBS + 1], u[2 * MAX_LIMBS + 1];
+    RsaPrimeTask task;
+    Thread th;
+
+    // an odd bitLen would give n of bitLen - 1 bit
+    if (bitLen < 64 || bitLen % 2 != 0 || e < 3 || e % 2 == 0 || e > 0x7fffffffU)
+    {
+        SetError(ERROR_ARGUMENT);
+        return NULL;
+    }
+
+    if (bitLen > SIGN_BIT)
+    {
+        SetError(ERROR_OVERFLOW);
+        return NULL;
+    }
+
+    len = (bitLen + LIMB_BITS - 1) / LIMB_BITS;  // words of n
+    el[0] = e;
+    if (!SeedSecureRand())
+        return NULL;
+
+    while (1)
+    {
+        // p in a new thread, q in this thread
+        task.bitLen = bitLen / 2;
+        task.times = times;
+        task.e = e;
+        started = ThreadStart(&th, RsaPrimeThread, &task);
+
+        DoGenRsaPrime(bitLen / 2, times, e, &key->q);
+
+        if (started)
+            ThreadJoin(th);
+        else
+            RsaPrimeThread(&task);
+
+        if (!task.seeded)
+        {
+            SetError(ERROR_ENTROPY);
+            return NULL;
+        }
+
+        BigIntToLimbs(&task.result, p);
+        BigIntToLimbs(&key->q, q);
+
+        // p > q
+        if (LimbsCompare(p, q, len) < 0)
+        {
+            memcpy(t, p, len * sizeof(Limb));
+            memcpy(p, q, len * sizeof(Limb));
+            memcpy(q, t, len * sizeof(Limb));
+        }
+
+        // |p - q| > 2^(bitLen/2 - 100)
+        LimbsSub(t, p, q, len);
+        if (bitLen / 2 > 100 && LimbsBitLen(t, len) <= bitLen / 2 - 99)
+            continue;
+
+        memcpy(p1, p, len * sizeof(Limb));
+        memcpy(q1, q, len * sizeof(Limb));
+        p1[0]--;  // p1 = p - 1, p is odd, so there is no borrow
+        q1[0]--;  // q1 = q - 1
+
+        // lambda = lcm(p - 1, q - 1) = (p - 1) * (q - 1) / gcd(p - 1, q - 1)
+        LimbsGcd(p1, q1, len, g);
+        LimbsMul(t, p1, len, q1, len);
+        memset(u, 0, sizeof(u));
+        LimbsDivMod(t, LimbsLen(t, 2 * len), g, LimbsLen(g, len), u, g);
+        memcpy(lambda, u, len * sizeof(Limb));
+
+        // d = e^-1 mod lambda, d > 2^(bitLen/2)
+        if (!LimbsInverse(el, lambda, len, d) || LimbsBitLen(d, len) <= bitLen / 2)
+            continue;
+
+        break;
+    }
+
+    // n = p * q
+    LimbsMul(t, p, len, q, len);
+    LimbsToBigInt(t, len, &key->n);
+    LimbsToBigInt(el, len, &key->e);
+    LimbsToBigInt(d, len, &key->d);
+    LimbsToBigInt(p, len, &key->p);
+    LimbsToBigInt(q, len, &key->q);
+
+    // dp = d mod (p - 1), dq = d mod (q - 1)
+    LimbsDivMod(d, LimbsLen(d, len), p1, LimbsLen(p1, len), u, t);
+    LimbsToBigInt(t, LimbsLen(p1, len), &key->dp);
+    LimbsDivMod(d, LimbsLen(d, len), q1, LimbsLen(q1, len), u, t);
+    LimbsToBigInt(t, LimbsLen(q1, len), &key->dq);
+
+    // qInv = q^-1 mod p, q < p
+    LimbsInverse(q, p, len, t);
+    LimbsToBigInt(t, len, &key->qInv);
+
+    return key;
+}
+
+// generate RSA key pair with e = RSA_E, return n
+char* GenRsaKey(int bitLen, int times, char* n, char* d)
+{
+    RsaKey key;
+
+    ClearError();
+    if (DoGenRsaKey(bitLen, times, RSA_E, &key) == NULL)
+        return NULL;
+    BigIntToStr(&key.d, d);
+
+    return ResultToStr(&key.n, n);
+}
+
+#ifndef _WIN32
+// run the jobs of a batch taken from a lane, the result is put in job->n
+// fast: 64 bit is-prime together by MillerRabin64Batch
+// normal: trial division, then a Fermat test batch for the big is-prime, and next-prime one by one
+// slow: gen-prime
+void DaemonRunJobs(DaemonWorker* w, int lane, int num)
+{
+    int i, k, c = 0;
+    DaemonJob* job;
+    BigInt x, y;
+
+    if (lane == DAEMON_LANE_FAST)
+    {
+        for (i = 0; i < num; i++)
+            w->n64[i] = w->job[i]->len ? w->job[i]->n[0] : 0;
+
+        MillerRabin64Batch(w->n64, num, w->prime);
+
+        for (i = 0; i < num; i++)
+            w->job[i]->n[0] = w->prime[i];
+
+        return;
+    }
+
+    for (i = 0; i < num; i++)
+    {
+        job = w->job[i];
+
+        if (job->msg.op == DAEMON_OP_GEN_PRIME)
+        {
+            if (job->msg.flags & 1)
+                DoGenRandomPrime(job->bitLen, job->msg.times, &y);
+            else
+                DoGenPrime(job->bitLen, job->msg.times, &y);
+
+            job->len = BigIntToLimbs(&y, job->n);
+        }
+        else if (job->msg.op == DAEMON_OP_NEXT_PRIME)
+        {
+            LimbsToBigInt(job->n, job->len, &x);
+            DoNextPrime(&x, job->msg.times, &y);
+            job->len = BigIntToLimbs(&y, job->n);
+        }
+        else if ((k = LimbsTrialDivision(job->n, job->len, TrialBound(LIMB_BITS * job->len))) >= 0)
+        {
+            job->n[0] = k;
+        }
+        else
+        {
+            w->candJob[c] = job;
+            LimbsToBigInt(job->n, job->len, &w->cand[c++]);
+        }
+    }
+
+    // the big is-prime of all the clients share a Fermat test batch
+    DoFermatTestBatch(w->cand, c, w->pass);
+
+    for (i = 0; i < c; i++)
+        w->candJob[i]->n[0] = w->pass[i] && DoMillerRabinCached(&w->cand[i], w->candJob[i]->msg.times);
+}
+
+// worker thread of the daemon, it takes a batch from the first lane with a job
+// the slow lane is taken only if another worker is left for the cheap lanes
+void* DaemonWorkerThread(void* arg)
+{
+    int i, lane, max, num;
+    DaemonWorker* w = (DaemonWorker*)arg;
+    Daemon* dm = w->dm;
+    DaemonJob* job;
+
+    // the generations of the workers run at the same time, so they share no checkpoint,
+    // and the stdout of the daemon is not for their progress
+    GetContext()->quiet = 1;
+    GetContext()->noCheckpoint = 1;
+
+    while (1)
+    {
+        MutexLock(&dm->lock);
+
+        while (1)
+        {
+            if (dm->head[DAEMON_LANE_FAST] != NULL)
+                lane = DAEMON_LANE_FAST;
+            else if (dm->head[DAEMON_LANE_NORMAL] != NULL)
+                lane = DAEMON_LANE_NORMAL;
+            else if (dm->head[DAEMON_LANE_SLOW] != NULL && dm->slowBusy < dm->slowMax)
+                lane = DAEMON_LANE_SLOW;
+            else
+                lane = -1;
+
+            if (lane >= 0)
+                break;
+
+            CondWait(&dm->ready, &dm->lock);
+        }
+
+        max = lane == DAEMON_LANE_FAST ? 8 * MR64_LANES : lane == DAEMON_LANE_NORMAL ? FERMAT_BATCH : 1;
+        for (num = 0; num < max && dm->head[lane] != NULL; num++)
+        {
+            w->job[num] = dm->head[lane];
+            dm->head[lane] = dm->head[lane]->next;
+        }
+
+        if (lane == DAEMON_LANE_SLOW)
+            dm->slowBusy++;
+
+        MutexUnlock(&dm->lock);
+
+        DaemonRunJobs(w, lane, num);
+
+        MutexLock(&dm->lock);
+
+        if (lane == DAEMON_LANE_SLOW)
+        {
+            dm->slowBusy--;
+            CondBroadcast(&dm->ready);  // a waiting slow job can go now
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            job = w->job[i];
+            job->next = dm->done;
+            dm->done = job;
+        }
+
+        MutexUnlock(&dm->lock);
+
+        // wake up the I/O thread, if the pipe is full it is awake already
+        if (write(dm->wake[1], "", 1) < 0 && errno != EAGAIN)
+            printf("Can not wake up the daemon XD\n");
+    }
+
+    return NULL;
+}
+
+// close the connection of the client, the responses of its jobs are dropped
+void DaemonCloseClient(DaemonClient* c)
+{
+    close(c->fd);
+    free(c->out);
+    c->fd = -1;
+    c->serial++;
+    c->inLen = 0;
+    c->out = NULL;
+    c->outLen = c->outSize = 0;
+    c->pending = 0;
+}
+
+// the client has too many responses not sent or jobs not answered, its requests are not read until they go down,
+// so a client that sends and never reads can not make the daemon buffer without bound
+int DaemonBusy(DaemonClient* c)
+{
+    return c->outLen >= DAEMON_MAX_BACKLOG || c->pending >= DAEMON_MAX_PENDING;
+}
+
+// send as much of the responses of the client as the socket takes
+void DaemonFlush(DaemonClient* c)
+{
+    int n;
+
+    while (c->outLen > 0)
+    {
+        n = (int)send(c->fd, c->out, c->outLen, 0);
+        if (n < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                DaemonCloseClient(c);
+            return;
+        }
+
+        c->outLen -= n;
+        memmove(c->out, c->out + n, c->outLen);
+    }
+}
+
+// add a response with len bytes of payload to the responses of the client
+// return 0 and close the client if there is no memory for it
+int DaemonReply(DaemonClient* c, DaemonMsg* msg, void* payload, int len)
+{
+    int size = c->outLen + (int)sizeof(DaemonMsg) + len;
+    unsigned char* out;
+
+    if (size > c->outSize)
+    {
+        out = (unsigned char*)realloc(c->out, size * 2);
+        if (out == NULL)
+        {
+            DaemonCloseClient(c);
+            return 0;
+        }
+        c->out = out;
+        c->outSize = size * 2;
+    }
+
+    msg->len = len;
+    memcpy(c->out + c->outLen, msg, sizeof(DaemonMsg));
+    if (len > 0)
+        memcpy(c->out + c->outLen + sizeof(DaemonMsg), payload, len);
+    c->outLen = size;
+
+    return 1;
+}
+
+// make a job of a request of the client, return NULL if it is a bad request
+// payload: n in 64 bit words with the lowest first, or bitLen in 32 bit for gen-prime
+DaemonJob* DaemonParse(DaemonMsg* msg, unsigned char* payload, int* lane)
+{
+    int len;
+    unsigned int bitLen;
+    DaemonJob* job;
+
+    if (msg->op == DAEMON_OP_GEN_PRIME)
+    {
+        if (msg->len != sizeof(bitLen))
+            return NULL;
+
+        memcpy(&bitLen, payload, sizeof(bitLen));
+        if (bitLen < 8 || bitLen > DAEMON_MAX_BITS)
+            return NULL;
+
+        *lane = DAEMON_LANE_SLOW;
+    }
+    else if (msg->op == DAEMON_OP_IS_PRIME || msg->op == DAEMON_OP_NEXT_PRIME)
+    {
+        if (msg->len == 0 || msg->len % 8 != 0)
+            return NULL;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    job = (DaemonJob*)malloc(sizeof(DaemonJob));
+    if (job == NULL)
+    {
+        printf("Out of memory XD\n");
+        exit(1);
+    }
+
+    job->msg = *msg;
+    job->msg.flags &= 1;
+    if (job->msg.times == 0)
+        job->msg.times = 1;
+
+    if (msg->op == DAEMON_OP_GEN_PRIME)
+    {
+        job->bitLen = (int)bitLen;
+        job->len = 0;
+        return job;
+    }
+
+    job->len = len = (int)(msg->len / 8);
+    memcpy(job->n, payload, msg->len);
+    for (; len > 0 && job->n[len - 1] == 0; len--);
+    job->len = len;
+
+    // leave room for the next prime
+    if (len > 0 && LIMB_BITS * (len - 1) + 64 > DAEMON_MAX_BITS)
+    {
+        free(job);
+        return NULL;
+    }
+
+    *lane = msg->op == DAEMON_OP_IS_PRIME && len <= 1 ? DAEMON_LANE_FAST : DAEMON_LANE_NORMAL;
+
+    return job;
+}
+
+// read the requests of the client, and queue their jobs in the lanes
+// return the count of the jobs queued
+int DaemonRead(Daemon* dm, DaemonClient* clients, int slot)
+{
+    int n, lane, num = 0, size;
+    DaemonClient* c = &clients[slot];
+    DaemonMsg msg;
+    DaemonJob* job;
+
+    n = (int)recv(c->fd, c->in + c->inLen, sizeof(c->in) - c->inLen, 0);
+    if (n <= 0)
+    {
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+            DaemonCloseClient(c);
+        return 0;
+    }
+
+    c->inLen += n;
+
+    while (c->inLen >= (int)sizeof(DaemonMsg))
+    {
+        memcpy(&msg, c->in, sizeof(DaemonMsg));
+
+        // a request too big can not be skipped safely, so the connection is closed
+        if (msg.len > DAEMON_MAX_PAYLOAD)
+        {
+            DaemonCloseClient(c);
+            return num;
+        }
+
+        size = (int)(sizeof(DaemonMsg) + msg.len);
+        if (c->inLen < size)
+            break;
+
+        job = DaemonParse(&msg, c->in + sizeof(DaemonMsg), &lane);
+        if (job == NULL)
+        {
+            msg.flags = DAEMON_BAD_REQUEST;
+            if (!DaemonReply(c, &msg, NULL, 0))
+                return num;
+        }
+        else
+        {
+            job->client = slot;
+            job->serial = c->serial;
+            job->next = NULL;
+
+            MutexLock(&dm->lock);
+            if (dm->head[lane] == NULL)
+                dm->head[lane] = job;
+            else
+                dm->tail[lane]->next = job;
+            dm->tail[lane] = job;
+            MutexUnlock(&dm->lock);
+
+            c->pending++;
+            num++;
+        }
+
+        c->inLen -= size;
+        memmove(c->in, c->in + size, c->inLen);
+    }
+
+    return num;
+}
+
+// send the responses of the finished jobs to their clients
+void DaemonDeliver(Daemon* dm, DaemonClient* clients)
+{
+    unsigned char verdict;
+    DaemonJob *job, *next;
+    DaemonClient* c;
+
+    MutexLock(&dm->lock);
+    job = dm->done;
+    dm->done = NULL;
+    MutexUnlock(&dm->lock);
+
+    for (; job != NULL; job = next)
+    {
+        next = job->next;
+        c = &clients[job->client];
+
+        if (c->fd >= 0 && c->serial == job->serial)
+        {
+            job->msg.flags = DAEMON_OK;
+            c->pending--;
+
+            if (job->msg.op == DAEMON_OP_IS_PRIME)
+            {
+                verdict = (unsigned char)job->n[0];
+                DaemonReply(c, &job->msg, &verdict, 1);
+            }
+            else
+            {
+                DaemonReply(c, &job->msg, job->n, job->len * 8);
+            }
+        }
+
+        free(job);
+    }
+}
+
+// run the daemon on the Unix domain socket path with threadNum workers, at least 2, it never returns if it starts
+// a request is a DaemonMsg and its payload, the responses may come out of order, matched by the id
+// the jobs of all the clients are queued in 3 lanes: 64 bit is-prime, big is-prime and next-prime, gen-prime,
+// a worker takes a batch from the first lane with a job, so the cheap checks never wait behind a generation,
+// and the tables and caches stay warm in the process
+// return 0 if the socket can not be opened
+int RunDaemon(char* path, int threadNum)
+{
+    int i, k, num, fd;
+    int slot[DAEMON_MAX_CLIENTS];
+    char buf[256];
+    struct sockaddr_un addr;
+    struct pollfd pfd[DAEMON_MAX_CLIENTS + 2];
+    static DaemonClient clients[DAEMON_MAX_CLIENTS];
+    static Daemon dm;
+    DaemonWorker* w;
+    Thread t;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+        return 0;
+
+    // a worker is always left for the cheap lanes, so there are at least 2
+    if (threadNum < 2)
+        threadNum = 2;
+    if (threadNum > DAEMON_MAX_THREADS)
+        threadNum = DAEMON_MAX_THREADS;
+
+    signal(SIGPIPE, SIG_IGN);  // a closed client gives an error of send, not a signal
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 64) != 0 ||
+        pipe(dm.wake) != 0)
+    {
+        if (fd >= 0)
+            close(fd);
+        return 0;
+    }
+
+    fcntl(dm.wake[0], F_SETFL, O_NONBLOCK);
+    fcntl(dm.wake[1], F_SETFL, O_NONBLOCK);
+
+    // with no memory for it, the daemon runs with no cache
+    if (verdictCacheSize == 0)
+        InitVerdictCache(DAEMON_VERDICT_CACHE);
+
+    MutexInit(&dm.lock);
+    CondInit(&dm.ready);
+    dm.slowMax = threadNum - 1;
+
+    for (i = 0; i < DAEMON_MAX_CLIENTS; i++)
+        clients[i].fd = -1;
+
+    for (i = 0; i < threadNum; i++)
+    {
+        w = (DaemonWorker*)malloc(sizeof(DaemonWorker));
+        if (w != NULL)
+            w->dm = &dm;
+
+        if (w == NULL || !ThreadStart(&t, DaemonWorkerThread, w))
+        {
+            printf("Can not start the workers of the daemon XD\n");
+            exit(1);
+        }
+    }
+
+    while (1)
+    {
+        pfd[0].fd = fd;
+        pfd[0].events = POLLIN;
+        pfd[1].fd = dm.wake[0];
+        pfd[1].events = POLLIN;
+
+        for (num = 2, i = 0; i < DAEMON_MAX_CLIENTS; i++)
+        {
+            if (clients[i].fd < 0)
+                continue;
+
+            pfd[num].fd = clients[i].fd;
+            pfd[num].events = (DaemonBusy(&clients[i]) ? 0 : POLLIN) | (clients[i].outLen > 0 ? POLLOUT : 0);
+            slot[num++] = i;
+        }
+
+        if (poll(pfd, num, -1) < 0)
+            continue;
+
+        if (pfd[0].revents & POLLIN)
+        {
+            k = accept(fd, NULL, NULL);
+            for (i = 0; k >= 0 && i < DAEMON_MAX_CLIENTS && clients[i].fd >= 0; i++);
+
+            if (k >= 0 && i < DAEMON_MAX_CLIENTS)
+            {
+                fcntl(k, F_SETFL, O_NONBLOCK);
+                clients[i].fd = k;
+            }
+            else if (k >= 0)
+            {
+                close(k);  // too many clients
+            }
+        }
+
+        for (k = 0, i = 2; i < num; i++)
+        {
+            // a busy client is not polled for POLLIN, a hang up is still read so it is closed
+            if (pfd[i].revents & (POLLIN | POLLHUP | POLLERR))
+                k += DaemonRead(&dm, clients, slot[i]);
+        }
+
+        // the jobs read in this round are batched by the workers
+        if (k > 0)
+        {
+            MutexLock(&dm.lock);
+            CondBroadcast(&dm.ready);
+            MutexUnlock(&dm.lock);
+        }
+
+        if (pfd[1].revents & POLLIN)
+        {
+            while (read(dm.wake[0], buf, sizeof(buf)) > 0);
+            DaemonDeliver(&dm, clients);
+        }
+
+        for (i = 0; i < DAEMON_MAX_CLIENTS; i++)
+        {
+            if (clients[i].fd >= 0 && clients[i].outLen > 0)
+                DaemonFlush(&clients[i]);
+        }
+    }
+
+    return 1;
+}
+
+// read len bytes from the socket, return 0 if it is closed or fails first
+int SocketRead(int fd, void* buf, long long len)
+{
+    long long n;
+
+    for (; len > 0; len -= n, buf = (char*)buf + n)
+    {
+        n = read(fd, buf, len);
+        if (n <= 0 && !(n < 0 && errno == EINTR))
+            return 0;
+        if (n < 0)
+            n = 0;
+    }
+
+    return 1;
+}
+
+// write len bytes to the socket, return 0 if it is closed or fails first
+int SocketWrite(int fd, void* buf, long long len)
+{
+    long long n;
+
+    for (; len > 0; len -= n, buf = (char*)buf + n)
+    {
+        n = write(fd, buf, len);
+        if (n <= 0 && !(n < 0 && errno == EINTR))
+            return 0;
+        if (n < 0)
+            n = 0;
+    }
+
+    return 1;
+}
+
+// run a worker of the DoShardRange coordinator on the Unix domain socket path
+// it tests the shards it is given one by one, and returns when the coordinator closes the socket
+// return 0 if it can not connect, or set ERROR_MEMORY if there is no memory
+int RunShardWorker(char* path)
+{
+    int fd;
+    unsigned char* bits;
+    struct sockaddr_un addr;
+    ShardMsg msg;
+    ShardResult res;
+    BigInt a, b, t;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+        return 0;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+    {
+        if (fd >= 0)
+            close(fd);
+        return 0;
+    }
+
+    bits = (unsigned char*)malloc(SHARD_SIZE / 8);
+    if (bits == NULL)
+    {
+        close(fd);
+        SetError(ERROR_MEMORY);
+        return 0;
+    }
+
+    signal(SIGPIPE, SIG_IGN);  // a closed coordinator gives an error of write, not a signal
+
+    while (SocketRead(fd, &msg, sizeof(msg)) && msg.times > 0)
+    {
+        if (msg.size < 1 || msg.size > SHARD_SIZE)
+            break;
+
+        LimbsToBigInt(msg.a, MAX_LIMBS, &a);
+        DoAdd(&a, LongToBigInt((long)msg.size - 1, &t), &b);  // b = a + size - 1
+
+        res.id = msg.id;
+        res.count = DoPrimeRange(&a, &b, msg.times, 1, NULL, NULL, bits);
+
+        // with no memory, the closed socket gives the shard to another worker
+        if (res.count < 0)
+            break;
+
+        if (!SocketWrite(fd, &res, sizeof(res)) || !SocketWrite(fd, bits, (msg.size + 7) / 8))
+            break;
+    }
+
+    close(fd);
+    free(bits);
+
+    return 1;
+}
+
+// start a local worker process of DoShardRange, return its pid, or -1 if it can not be started
+// the child closes the sockets of the coordinator, so the workers see EOF when the coordinator closes them
+int ShardSpawn(char* path, int listenFd, ShardWorker* workers)
+{
+    int i, pid;
+
+    fflush(stdout);  // the child must not write the buffer again
+    pid = fork();
+
+    if (pid == 0)
+    {
+        close(listenFd);
+        for (i = 0; i < SHARD_MAX_WORKERS; i++)
+        {
+            if (workers[i].fd >= 0)
+                close(workers[i].fd);
+        }
+
+        _exit(RunShardWorker(path) ? 0 : 1);
+    }
+
+    return pid;
+}
+
+// the primes in [a, b] by worker processes, 0 <= a <= b, b - a < 2^62
+// the range is cut into shards of SHARD_SIZE numbers, and the coordinator gives them to the workers
+// connected to the Unix domain socket path: procNum local ones it forks, and any started by RunShardWorker
+// the shard of a dead worker is given to another one, after SHARD_RETRIES losses the coordinator tests it,
+// and it tests a shard itself when no worker is connected or starting
+// cb(p, arg) is called for each prime in order, it stops after limit primes, 0 for no limit
+// return the count of the primes, -1 if the socket can not be opened, or with ERROR_MEMORY if there is no memory
+long long DoShardRange(BigInt* a, BigInt* b, int times, char* path, int procNum, long long limit,
+                       PrimeRangeCallback cb, void* arg)
+{
+    int i, k, num, fd, window, idle, live, spawned, failed = 0;
+    int pid[SHARD_MAX_WORKERS], slot[SHARD_MAX_WORKERS + 1];
+    long long id, done, next, shardNum, count = 0;
+    unsigned long long total;
+    long long n;
+    Limb o, base[MAX_LIMBS], t[MAX_LIMBS];
+    struct sockaddr_un addr;
+    struct pollfd pfd[SHARD_MAX_WORKERS + 1];
+    ShardWorker workers[SHARD_MAX_WORKERS];
+    ShardSlot* shards;
+    ShardResult* res;
+    ShardMsg msg;
+    BigInt d, p, x, y;
+
+    if (a->bit[SIGN_BIT] == NEGATIVE || DoCompare(a, b) > 0)
+        return 0;
+
+    if (procNum < 0)
+        procNum = 0;
+    if (procNum > SHARD_MAX_WORKERS)
+        procNum = SHARD_MAX_WORKERS;
+
+    DoSub(b, a, &d);  // d = b - a
+    if (GetTrueValueLen(&d) > 62 || strlen(path) >= sizeof(addr.sun_path))
+        return -1;
+
+    memset(t, 0, sizeof(t));
+    BigIntToLimbs(&d, t);
+    total = t[0] + 1;
+    shardNum = (total + SHARD_SIZE - 1) / SHARD_SIZE;
+    memset(base, 0, sizeof(base));
+    BigIntToLimbs(a, base);
+
+    signal(SIGPIPE, SIG_IGN);  // a dead worker gives an error of write, not a signal
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 64) != 0)
+    {
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+
+    // the shards after the first unfinished one wait in the window, so the memory is bounded
+    window = (procNum > 0 ? procNum : 1) * SHARD_WINDOW;
+    shards = (ShardSlot*)calloc(window, sizeof(ShardSlot));
+    for (i = 0; shards != NULL && i < window; i++)
+    {
+        shards[i].bits = (unsigned char*)malloc(SHARD_SIZE / 8);
+        if (shards[i].bits == NULL)
+            break;
+    }
+
+    for (k = 0; k < SHARD_MAX_WORKERS; k++)
+    {
+        workers[k].fd = -1;
+        workers[k].in = NULL;
+    }
+
+    for (k = 0; shards != NULL && i == window && k < SHARD_MAX_WORKERS; k++)
+    {
+        workers[k].in = (unsigned char*)malloc(sizeof(ShardResult) + SHARD_SIZE / 8);
+        if (workers[k].in == NULL)
+            break;
+    }
+
+    if (k < SHARD_MAX_WORKERS)
+    {
+        for (k = 0; k < SHARD_MAX_WORKERS; k++)
+            free(workers[k].in);
+        for (i = 0; shards != NULL && i < window; i++)
+            free(shards[i].bits);
+        free(shards);
+        close(fd);
+        unlink(path);
+
+        SetError(ERROR_MEMORY);
+        return -1;
+    }
+
+    for (k = 0; k < procNum; k++)
+        pid[k] = ShardSpawn(path, fd, workers);
+    spawned = procNum;
+
+    done = next = 0;
+
+    while (done < shardNum && (limit == 0 || count < limit))
+    {
+        // the local workers that died are forked again, up to SHARD_RETRIES times each on average
+        for (live = 0, k = 0; k < procNum; k++)
+        {
+            if (pid[k] > 0 && waitpid(pid[k], NULL, WNOHANG) == pid[k])
+            {
+                pid[k] = -1;
+                if (spawned < procNum * (SHARD_RETRIES + 1))
+                {
+                    pid[k] = ShardSpawn(path, fd, workers);
+                    spawned++;
+                }
+            }
+            live += pid[k] > 0;
+        }
+
+        // give the pending shards to the idle workers, the lost ones first,
+        // but not the ones lost SHARD_RETRIES times, they are tested here below
+        for (k = 0; k < SHARD_MAX_WORKERS; k++)
+        {
+            if (workers[k].fd < 0 || workers[k].shard >= 0)
+                continue;
+
+            for (id = done; id < next && (shards[id % window].state != SHARD_PENDING ||
+                                          shards[id % window].tries >= SHARD_RETRIES); id++);
+
+            if (id == next && next < shardNum && next < done + window)
+            {
+                shards[next % window].state = SHARD_PENDING;
+                shards[next % window].tries = 0;
+                next++;
+            }
+            else if (id == next)
+            {
+                break;
+            }
+
+            memset(&msg, 0, sizeof(msg));
+            msg.times = times;
+            msg.id = id;
+            msg.size = total - id * SHARD_SIZE < SHARD_SIZE ? (long long)(total - id * SHARD_SIZE) : SHARD_SIZE;
+            memcpy(msg.a, base, sizeof(base));
+            o = (Limb)id * SHARD_SIZE;
+            LimbsAddTo(msg.a, MAX_LIMBS, &o, 1);  // a + id * SHARD_SIZE
+
+            shards[id % window].state = SHARD_RUNNING;
+            workers[k].shard = id;
+            workers[k].need = sizeof(ShardResult) + (int)((msg.size + 7) / 8);
+            workers[k].inLen = 0;
+
+            if (!SocketWrite(workers[k].fd, &msg, sizeof(msg)))
+            {
+                shards[id % window].state = SHARD_PENDING;
+                shards[id % window].tries++;
+                close(workers[k].fd);
+                workers[k].fd = -1;
+            }
+        }
+
+        // a shard lost too many times, or no worker to take it, is tested here
+        for (idle = 1, k = 0; k < SHARD_MAX_WORKERS; k++)
+            idle &= workers[k].fd < 0;
+
+        for (id = done; id < next || (idle && live == 0 && id < shardNum && id < done + window); id++)
+        {
+            if (id == next)
+            {
+                shards[next % window].state = SHARD_PENDING;
+                shards[next % window].tries = 0;
+                next++;
+            }
+
+            if (shards[id % window].state != SHARD_PENDING ||
+                (shards[id % window].tries < SHARD_RETRIES && !(idle && live == 0)))
+                continue;
+
+            n = total - id * SHARD_SIZE < SHARD_SIZE ? (long long)(total - id * SHARD_SIZE) : SHARD_SIZE;
+            memcpy(t, base, sizeof(base));
+            o = (Limb)id * SHARD_SIZE;
+            LimbsAddTo(t, MAX_LIMBS, &o, 1);
+            LimbsToBigInt(t, MAX_LIMBS, &x);
+            DoAdd(&x, LongToBigInt((long)n - 1, &y), &y);
+
+            shards[id % window].count = DoPrimeRange(&x, &y, times, 1, NULL, NULL, shards[id % window].bits);
+            if (shards[id % window].count < 0)
+            {
+                failed = 1;  // ERROR_MEMORY is set
+                break;
+            }
+
+            shards[id % window].state = SHARD_FINISHED;
+            break;  // take the new workers and results before the next one
+        }
+
+        if (failed)
+            break;
+
+        // the finished shards in order
+        while (done < next && shards[done % window].state == SHARD_FINISHED && (limit == 0 || count < limit))
+        {
+            n = total - done * SHARD_SIZE < SHARD_SIZE ? (long long)(total - done * SHARD_SIZE) : SHARD_SIZE;
+
+            if (cb == NULL && (limit == 0 || count + shards[done % window].count <= limit))
+            {
+                count += shards[done % window].count;
+            }
+            else
+            {
+                for (i = 0; i < n && (limit == 0 || count < limit); i++)
+                {
+                    if ((shards[done % window].bits[i / 8] >> (i % 8) & 1) == 0)
+                        continue;
+
+                    count++;
+                    if (cb == NULL)
+                        continue;
+
+                    memcpy(t, base, sizeof(base));
+                    o = (Limb)done * SHARD_SIZE + i;
+                    LimbsAddTo(t, MAX_LIMBS, &o, 1);  // p = a + done * SHARD_SIZE + i
+                    cb(LimbsToBigInt(t, MAX_LIMBS, &p), arg);
+                }
+            }
+
+            done++;
+        }
+
+        if (done == shardNum || (limit > 0 && count >= limit))
+            break;
+
+        pfd[0].fd = fd;
+        pfd[0].events = POLLIN;
+
+        for (num = 1, k = 0; k < SHARD_MAX_WORKERS; k++)
+        {
+            if (workers[k].fd < 0)
+                continue;
+
+            pfd[num].fd = workers[k].fd;
+            pfd[num].events = POLLIN;
+            slot[num++] = k;
+        }
+
+        // the timeout finds the local workers that died before they connected
+        if (poll(pfd, num, idle && live == 0 ? 0 : 100) <= 0)
+            continue;
+
+        if (pfd[0].revents & POLLIN)
+        {
+            i = accept(fd, NULL, NULL);
+            for (k = 0; i >= 0 && k < SHARD_MAX_WORKERS && workers[k].fd >= 0; k++);
+
+            if (i >= 0 && k < SHARD_MAX_WORKERS)
+            {
+                workers[k].fd = i;
+                workers[k].shard = -1;
+            }
+            else if (i >= 0)
+            {
+                close(i);  // too many workers
+            }
+        }
+
+        for (i = 1; i < num; i++)
+        {
+            if ((pfd[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+                continue;
+
+            k = slot[i];
+            n = workers[k].shard < 0 ? 0 : read(workers[k].fd, workers[k].in + workers[k].inLen,
+                                                  workers[k].need - workers[k].inLen);
+
+            if (n > 0)
+            {
+                workers[k].inLen += (int)n;
+                if (workers[k].inLen < workers[k].need)
+                    continue;
+
+                // a wrong id is a broken worker, it is dropped below
+                res = (ShardResult*)workers[k].in;
+                id = workers[k].shard;
+                if (res->id == id)
+                {
+                    shards[id % window].count = res->count;
+                    memcpy(shards[id % window].bits, workers[k].in + sizeof(ShardResult),
+                           workers[k].need - sizeof(ShardResult));
+                    shards[id % window].state = SHARD_FINISHED;
+                    workers[k].shard = -1;
+                    continue;
+                }
+            }
+            else if (n < 0 && (errno == EINTR || errno == EAGAIN))
+            {
+                continue;
+            }
+
+            // the worker is dead, its shard goes to another one
+            if (workers[k].shard >= 0)
+            {
+                shards[workers[k].shard % window].state = SHARD_PENDING;
+                shards[workers[k].shard % window].tries++;
+            }
+
+            close(workers[k].fd);
+            workers[k].fd = -1;
+        }
+    }
+
+    // the workers see EOF, and the local ones in the middle of a shard are stopped
+    for (k = 0; k < SHARD_MAX_WORKERS; k++)
+    {
+        if (workers[k].fd >= 0)
+            close(workers[k].fd);
+        free(workers[k].in);
+    }
+
+    for (k = 0; k < procNum; k++)
+    {
+        if (pid[k] > 0)
+        {
+            kill(pid[k], SIGTERM);
+            waitpid(pid[k], NULL, 0);
+        }
+    }
+
+    close(fd);
+    unlink(path);
+
+    for (i = 0; i < window; i++)
+        free(shards[i].bits);
+    free(shards);
+
+    return failed ? -1 : count;
+}
+#endif
+
+// print RSA key pair
+void PrintRsaKey(RsaKey* key)
+{
+    char s[BUFFER_SIZE];
+
+    printf("n=%s\n", BigIntToStr(&key->n, s));
+    printf("e=%s\n", BigIntToStr(&key->e, s));
+    printf("d=%s\n", BigIntToStr(&key->d, s));
+    printf("p=%s\n", BigIntToStr(&key->p, s));
+    printf("q=%s\n", BigIntToStr(&key->q, s));
+    printf("dp=%s\n", BigIntToStr(&key->dp, s));
+    printf("dq=%s\n", BigIntToStr(&key->dq, s));
+    printf("qInv=%s\n", BigIntToStr(&key->qInv, s));
+}
+
+// print a prime of DoShardRange
+void PrintPrime(BigInt* p, void* arg)
+{
+    char s[BUFFER_SIZE];
+
+    (void)arg;
+    puts(BigIntToStr(p, s));
+}
+
+int main(int argc, char* argv[])
+{
+    // printf("hello, world");
+
+    int i, threadNum = 4;
+    unsigned long a, b;
+    long long n;
+    char result[BUFFER_SIZE];
+    char remainder[BUFFER_SIZE];
+    char buf[BUFFER_SIZE] = "prime=";
+    char* daemonPath = NULL;
+    char* shardPath = NULL;
+    char* shardWorker = NULL;
+    BigInt x, y;
+
+    // -c file: save the search state of GenPrime and GenRandomPrime to file
+    // -r: continue from the checkpoint in the file after a restart
+    // -p file: keep the results of GenPrime and GenSafePrime in file, the next run takes them from it
+    // -b file: answer the numbers less than 2^32 by the prime bitmap in file
+    // -d path: run the daemon on the Unix domain socket path, -j n: with n workers
+    // -s path a b: print the primes in [a, b] by -j n local worker processes of the coordinator on path
+    // -k path: run a worker of the coordinator on path
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            SetCheckpoint(argv[++i], checkpointResume, checkpointInterval);
+        else if (strcmp(argv[i], "-r") == 0)
+            checkpointResume = 1;
+        else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc && !OpenPrimeCache(argv[++i]))
+            printf("Can not open the prime cache %s XD\n", argv[i]);
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc && !OpenPrimeBitmap(argv[++i]))
+            printf("Can not open the prime bitmap %s XD\n", argv[i]);
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            daemonPath = argv[++i];
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            threadNum = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc)
+            shardWorker = argv[++i];
+        else if (strcmp(argv[i], "-s") == 0 && i + 3 < argc)
+        {
+            shardPath = argv[++i];
+            StrToBigInt(argv[++i], &x);
+            StrToBigInt(argv[++i], &y);
+        }
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+        {
+            // -t file: write the small prime tables to file, then exit
+            if (!GenPrimeTable(argv[++i]))
+                printf("Can not write the prime table %s XD\n", argv[i]);
+            return 0;
+        }
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+        {
+            // -w file: write the prime bitmap to file, then exit
+            if (!GenPrimeBitmap(argv[++i]))
+                printf("Can not write the prime bitmap %s XD\n", argv[i]);
+            return 0;
+        }
+    }
+
+    // the daemon never returns if it starts
+    if (daemonPath != NULL)
+    {
+#ifndef _WIN32
+        RunDaemon(daemonPath, threadNum);
+        printf("Can not open the socket %s XD\n", daemonPath);
+#else
+        printf("The daemon needs Unix domain sockets XD\n");
+#endif
+        return 1;
+    }
+
+    if (shardPath != NULL || shardWorker != NULL)
+    {
+#ifndef _WIN32
+        if (shardWorker != NULL && !RunShardWorker(shardWorker))
+        {
+            printf("Can not connect to the coordinator %s XD\n", shardWorker);
+            return 1;
+        }
+
+        if (shardPath != NULL)
+        {
+            a = time(0);
+            n = DoShardRange(&x, &y, 5, shardPath, threadNum, 0, PrintPrime, NULL);
+            b = time(0);
+
+            if (n < 0)
+            {
+                printf("Can not open the socket %s XD\n", shardPath);
+                return 1;
+            }
+            printf("%lld primes, total t=%lds\n", n, b - a);
+        }
+
+        return 0;
+#else
+        printf("The sharded search needs Unix domain sockets XD\n");
+        return 1;
+#endif
+    }
+
+    // function: GenPrime(bitLen, times, result)
+    // generate prime by specify bit length and miller-rabin test times
+    // generate a 500bit prime may need about 3 hours
+    // generate a 100bit prime may need about 1 minute
+    // generate a 32bit prime may need about 4 seconds
+    // if you generate a big prime, make sure the BIG_INT_BIT_LEN is enough
+
+    // SeedRand(2014);  // fixed seed, for reproducible benchmark runs
+
+    a = time(0);
+    puts(strcat(buf, GenPrime(100, 5, result)));
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    
+    /*
+    // miller-rabin test
+    a = time(0);
+    printf("\n%s\n", MillerRabin("261", 5) ? "is prime" : "not prime");
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
+
+    /*
+    // deterministic Miller-Rabin test for 64 bit numbers
+    unsigned long long n64[3] = {4294967291ULL, 3825123056546413051ULL, 18446744073709551557ULL};
+    char isPrime[3];
+    printf("%d primes\n", MillerRabin64Batch(n64, 3, isPrime));
+    */
+
+    /*
+    // generate a random prime, the highest two bits are 1
+    a = time(0);
+    puts(GenRandomPrime(512, 5, result));
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
+
+    /*
+    // generate a random safe prime p = 2q + 1
+    a = time(0);
+    puts(GenSafePrime(1024, 5, 1, result));
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
+
+    /*
+    // generate a 2048 bit RSA key pair
+    RsaKey key;
+    a = time(0);
+    DoGenRsaKey(2048, 5, RSA_E, &key);
+    PrintRsaKey(&key);
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
+
+    /*
+    // Lucas-Lehmer test for the Mersenne number 2^p - 1
+    a = time(0);
+    printf("\n%s\n", LucasLehmer(521) ? "is prime" : "not prime");
+    b = time(0);
+    printf("total t=%lds\n", b - a);
+    */
+    
+    // some primes
+    // 4567, 124567, 3214567, 23456789, 55566677
+    // 1234567894987654321, 11111111111111111111111(23)
+    // 779711611410512054554699111109
+
+    // the biggest prime in 100bit
+    // 1267650600228229401496703205361
+
+    // the biggest prime in 512bit t=13284s
+    // 13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006083527
+
+    // the biggest prime in 1024bit t=20983s
+    // 179769313486231590772930519078902473361797697894230657273430081157732675805500963132708477322407536021120113879871393357658789768814416622492847430639474124377767893424865485276302219601246094119453082952085005768838150682342462881473913110540827237163350510684586298239947245938479716304835356329624224137111
+
+    // example: how to use BigInt
+    //puts(Add("2010", "4", result));
+    //puts(Sub("0", "2014", result));
+    //puts(Mul("2", "43", result));
+    //puts(Div("86", "10", result, remainder));
+    //puts(remainder);
+    //puts(Mod("-86", "10", result));
+    //puts(PowMod("7", "80", "86", result));
+
+    return 0;
+}
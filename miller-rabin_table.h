@@ -0,0 +1,4200 @@
+// generated by GenPrimeTable, run the program with -t file to write it again, do not edit
+// odd primes less than SMALL_PRIME_BOUND, their inverses mod 2^64 and (2^64 - 1) / p,
+// and the groups of the trial division with their product in a word
+
+#if SMALL_PRIME_NUM != 6541
+#error the table is of another SMALL_PRIME_BOUND
+#endif
+
+#define TRIAL_GROUP_NUM 1577  // count of the groups of the trial division
+
+const unsigned int smallPrime[SMALL_PRIME_NUM] = {
+    3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59,
+    61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137,
+    139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227,
+    229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313,
+    317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419,
+    421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509,
+    521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617,
+    619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727,
+    733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829,
+    839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947,
+    953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051,
+    1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171,
+    1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289,
+    1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427,
+    1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523,
+    1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619, 1621,
+    1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753,
+    1759, 1777, 1783, 1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879,
+    1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993, 1997, 1999, 2003, 2011,
+    2017, 2027, 2029, 2039, 2053, 2063, 2069, 2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129, 2131,
+    2137, 2141, 2143, 2153, 2161, 2179, 2203, 2207, 2213, 2221, 2237, 2239, 2243, 2251, 2267, 2269,
+    2273, 2281, 2287, 2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347, 2351, 2357, 2371, 2377, 2381,
+    2383, 2389, 2393, 2399, 2411, 2417, 2423, 2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521,
+    2531, 2539, 2543, 2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617, 2621, 2633, 2647, 2657, 2659,
+    2663, 2671, 2677, 2683, 2687, 2689, 2693, 2699, 2707, 2711, 2713, 2719, 2729, 2731, 2741, 2749,
+    2753, 2767, 2777, 2789, 2791, 2797, 2801, 2803, 2819, 2833, 2837, 2843, 2851, 2857, 2861, 2879,
+    2887, 2897, 2903, 2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999, 3001, 3011, 3019,
+    3023, 3037, 3041, 3049, 3061, 3067, 3079, 3083, 3089, 3109, 3119, 3121, 3137, 3163, 3167, 3169,
+    3181, 3187, 3191, 3203, 3209, 3217, 3221, 3229, 3251, 3253, 3257, 3259, 3271, 3299, 3301, 3307,
+    3313, 3319, 3323, 3329, 3331, 3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413, 3433,
+    3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511, 3517, 3527, 3529, 3533, 3539, 3541, 3547,
+    3557, 3559, 3571, 3581, 3583, 3593, 3607, 3613, 3617, 3623, 3631, 3637, 3643, 3659, 3671, 3673,
+    3677, 3691, 3697, 3701, 3709, 3719, 3727, 3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797, 3803,
+    3821, 3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907, 3911, 3917, 3919, 3923, 3929,
+    3931, 3943, 3947, 3967, 3989, 4001, 4003, 4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057, 4073,
+    4079, 4091, 4093, 4099, 4111, 4127, 4129, 4133, 4139, 4153, 4157, 4159, 4177, 4201, 4211, 4217,
+    4219, 4229, 4231, 4241, 4243, 4253, 4259, 4261, 4271, 4273, 4283, 4289, 4297, 4327, 4337, 4339,
+    4349, 4357, 4363, 4373, 4391, 4397, 4409, 4421, 4423, 4441, 4447, 4451, 4457, 4463, 4481, 4483,
+    4493, 4507, 4513, 4517, 4519, 4523, 4547, 4549, 4561, 4567, 4583, 4591, 4597, 4603, 4621, 4637,
+    4639, 4643, 4649, 4651, 4657, 4663, 4673, 4679, 4691, 4703, 4721, 4723, 4729, 4733, 4751, 4759,
+    4783, 4787, 4789, 4793, 4799, 4801, 4813, 4817, 4831, 4861, 4871, 4877, 4889, 4903, 4909, 4919,
+    4931, 4933, 4937, 4943, 4951, 4957, 4967, 4969, 4973, 4987, 4993, 4999, 5003, 5009, 5011, 5021,
+    5023, 5039, 5051, 5059, 5077, 5081, 5087, 5099, 5101, 5107, 5113, 5119, 5147, 5153, 5167, 5171,
+    5179, 5189, 5197, 5209, 5227, 5231, 5233, 5237, 5261, 5273, 5279, 5281, 5297, 5303, 5309, 5323,
+    5333, 5347, 5351, 5381, 5387, 5393, 5399, 5407, 5413, 5417, 5419, 5431, 5437, 5441, 5443, 5449,
+    5471, 5477, 5479, 5483, 5501, 5503, 5507, 5519, 5521, 5527, 5531, 5557, 5563, 5569, 5573, 5581,
+    5591, 5623, 5639, 5641, 5647, 5651, 5653, 5657, 5659, 5669, 5683, 5689, 5693, 5701, 5711, 5717,
+    5737, 5741, 5743, 5749, 5779, 5783, 5791, 5801, 5807, 5813, 5821, 5827, 5839, 5843, 5849, 5851,
+    5857, 5861, 5867, 5869, 5879, 5881, 5897, 5903, 5923, 5927, 5939, 5953, 5981, 5987, 6007, 6011,
+    6029, 6037, 6043, 6047, 6053, 6067, 6073, 6079, 6089, 6091, 6101, 6113, 6121, 6131, 6133, 6143,
+    6151, 6163, 6173, 6197, 6199, 6203, 6211, 6217, 6221, 6229, 6247, 6257, 6263, 6269, 6271, 6277,
+    6287, 6299, 6301, 6311, 6317, 6323, 6329, 6337, 6343, 6353, 6359, 6361, 6367, 6373, 6379, 6389,
+    6397, 6421, 6427, 6449, 6451, 6469, 6473, 6481, 6491, 6521, 6529, 6547, 6551, 6553, 6563, 6569,
+    6571, 6577, 6581, 6599, 6607, 6619, 6637, 6653, 6659, 6661, 6673, 6679, 6689, 6691, 6701, 6703,
+    6709, 6719, 6733, 6737, 6761, 6763, 6779, 6781, 6791, 6793, 6803, 6823, 6827, 6829, 6833, 6841,
+    6857, 6863, 6869, 6871, 6883, 6899, 6907, 6911, 6917, 6947, 6949, 6959, 6961, 6967, 6971, 6977,
+    6983, 6991, 6997, 7001, 7013, 7019, 7027, 7039, 7043, 7057, 7069, 7079, 7103, 7109, 7121, 7127,
+    7129, 7151, 7159, 7177, 7187, 7193, 7207, 7211, 7213, 7219, 7229, 7237, 7243, 7247, 7253, 7283,
+    7297, 7307, 7309, 7321, 7331, 7333, 7349, 7351, 7369, 7393, 7411, 7417, 7433, 7451, 7457, 7459,
+    7477, 7481, 7487, 7489, 7499, 7507, 7517, 7523, 7529, 7537, 7541, 7547, 7549, 7559, 7561, 7573,
+    7577, 7583, 7589, 7591, 7603, 7607, 7621, 7639, 7643, 7649, 7669, 7673, 7681, 7687, 7691, 7699,
+    7703, 7717, 7723, 7727, 7741, 7753, 7757, 7759, 7789, 7793, 7817, 7823, 7829, 7841, 7853, 7867,
+    7873, 7877, 7879, 7883, 7901, 7907, 7919, 7927, 7933, 7937, 7949, 7951, 7963, 7993, 8009, 8011,
+    8017, 8039, 8053, 8059, 8069, 8081, 8087, 8089, 8093, 8101, 8111, 8117, 8123, 8147, 8161, 8167,
+    8171, 8179, 8191, 8209, 8219, 8221, 8231, 8233, 8237, 8243, 8263, 8269, 8273, 8287, 8291, 8293,
+    8297, 8311, 8317, 8329, 8353, 8363, 8369, 8377, 8387, 8389, 8419, 8423, 8429, 8431, 8443, 8447,
+    8461, 8467, 8501, 8513, 8521, 8527, 8537, 8539, 8543, 8563, 8573, 8581, 8597, 8599, 8609, 8623,
+    8627, 8629, 8641, 8647, 8663, 8669, 8677, 8681, 8689, 8693, 8699, 8707, 8713, 8719, 8731, 8737,
+    8741, 8747, 8753, 8761, 8779, 8783, 8803, 8807, 8819, 8821, 8831, 8837, 8839, 8849, 8861, 8863,
+    8867, 8887, 8893, 8923, 8929, 8933, 8941, 8951, 8963, 8969, 8971, 8999, 9001, 9007, 9011, 9013,
+    9029, 9041, 9043, 9049, 9059, 9067, 9091, 9103, 9109, 9127, 9133, 9137, 9151, 9157, 9161, 9173,
+    9181, 9187, 9199, 9203, 9209, 9221, 9227, 9239, 9241, 9257, 9277, 9281, 9283, 9293, 9311, 9319,
+    9323, 9337, 9341, 9343, 9349, 9371, 9377, 9391, 9397, 9403, 9413, 9419, 9421, 9431, 9433, 9437,
+    9439, 9461, 9463, 9467, 9473, 9479, 9491, 9497, 9511, 9521, 9533, 9539, 9547, 9551, 9587, 9601,
+    9613, 9619, 9623, 9629, 9631, 9643, 9649, 9661, 9677, 9679, 9689, 9697, 9719, 9721, 9733, 9739,
+    9743, 9749, 9767, 9769, 9781, 9787, 9791, 9803, 9811, 9817, 9829, 9833, 9839, 9851, 9857, 9859,
+    9871, 9883, 9887, 9901, 9907, 9923, 9929, 9931, 9941, 9949, 9967, 9973, 10007, 10009, 10037, 10039,
+    10061, 10067, 10069, 10079, 10091, 10093, 10099, 10103, 10111, 10133, 10139, 10141, 10151, 10159, 10163, 10169,
+    10177, 10181, 10193, 10211, 10223, 10243, 10247, 10253, 10259, 10267, 10271, 10273, 10289, 10301, 10303, 10313,
+    10321, 10331, 10333, 10337, 10343, 10357, 10369, 10391, 10399, 10427, 10429, 10433, 10453, 10457, 10459, 10463,
+    10477, 10487, 10499, 10501, 10513, 10529, 10531, 10559, 10567, 10589, 10597, 10601, 10607, 10613, 10627, 10631,
+    10639, 10651, 10657, 10663, 10667, 10687, 10691, 10709, 10711, 10723, 10729, 10733, 10739, 10753, 10771, 10781,
+    10789, 10799, 10831, 10837, 10847, 10853, 10859, 10861, 10867, 10883, 10889, 10891, 10903, 10909, 10937, 10939,
+    10949, 10957, 10973, 10979, 10987, 10993, 11003, 11027, 11047, 11057, 11059, 11069, 11071, 11083, 11087, 11093,
+    11113, 11117, 11119, 11131, 11149, 11159, 11161, 11171, 11173, 11177, 11197, 11213, 11239, 11243, 11251, 11257,
+    11261, 11273, 11279, 11287, 11299, 11311, 11317, 11321, 11329, 11351, 11353, 11369, 11383, 11393, 11399, 11411,
+    11423, 11437, 11443, 11447, 11467, 11471, 11483, 11489, 11491, 11497, 11503, 11519, 11527, 11549, 11551, 11579,
+    11587, 11593, 11597, 11617, 11621, 11633, 11657, 11677, 11681, 11689, 11699, 11701, 11717, 11719, 11731, 11743,
+    11777, 11779, 11783, 11789, 11801, 11807, 11813, 11821, 11827, 11831, 11833, 11839, 11863, 11867, 11887, 11897,
+    11903, 11909, 11923, 11927, 11933, 11939, 11941, 11953, 11959, 11969, 11971, 11981, 11987, 12007, 12011, 12037,
+    12041, 12043, 12049, 12071, 12073, 12097, 12101, 12107, 12109, 12113, 12119, 12143, 12149, 12157, 12161, 12163,
+    12197, 12203, 12211, 12227, 12239, 12241, 12251, 12253, 12263, 12269, 12277, 12281, 12289, 12301, 12323, 12329,
+    12343, 12347, 12373, 12377, 12379, 12391, 12401, 12409, 12413, 12421, 12433, 12437, 12451, 12457, 12473, 12479,
+    12487, 12491, 12497, 12503, 12511, 12517, 12527, 12539, 12541, 12547, 12553, 12569, 12577, 12583, 12589, 12601,
+    12611, 12613, 12619, 12637, 12641, 12647, 12653, 12659, 12671, 12689, 12697, 12703, 12713, 12721, 12739, 12743,
+    12757, 12763, 12781, 12791, 12799, 12809, 12821, 12823, 12829, 12841, 12853, 12889, 12893, 12899, 12907, 12911,
+    12917, 12919, 12923, 12941, 12953, 12959, 12967, 12973, 12979, 12983, 13001, 13003, 13007, 13009, 13033, 13037,
+    13043, 13049, 13063, 13093, 13099, 13103, 13109, 13121, 13127, 13147, 13151, 13159, 13163, 13171, 13177, 13183,
+    13187, 13217, 13219, 13229, 13241, 13249, 13259, 13267, 13291, 13297, 13309, 13313, 13327, 13331, 13337, 13339,
+    13367, 13381, 13397, 13399, 13411, 13417, 13421, 13441, 13451, 13457, 13463, 13469, 13477, 13487, 13499, 13513,
+    13523, 13537, 13553, 13567, 13577, 13591, 13597, 13613, 13619, 13627, 13633, 13649, 13669, 13679, 13681, 13687,
+    13691, 13693, 13697, 13709, 13711, 13721, 13723, 13729, 13751, 13757, 13759, 13763, 13781, 13789, 13799, 13807,
+    13829, 13831, 13841, 13859, 13873, 13877, 13879, 13883, 13901, 13903, 13907, 13913, 13921, 13931, 13933, 13963,
+    13967, 13997, 13999, 14009, 14011, 14029, 14033, 14051, 14057, 14071, 14081, 14083, 14087, 14107, 14143, 14149,
+    14153, 14159, 14173, 14177, 14197, 14207, 14221, 14243, 14249, 14251, 14281, 14293, 14303, 14321, 14323, 14327,
+    14341, 14347, 14369, 14387, 14389, 14401, 14407, 14411, 14419, 14423, 14431, 14437, 14447, 14449, 14461, 14479,
+    14489, 14503, 14519, 14533, 14537, 14543, 14549, 14551, 14557, 14561, 14563, 14591, 14593, 14621, 14627, 14629,
+    14633, 14639, 14653, 14657, 14669, 14683, 14699, 14713, 14717, 14723, 14731, 14737, 14741, 14747, 14753, 14759,
+    14767, 14771, 14779, 14783, 14797, 14813, 14821, 14827, 14831, 14843, 14851, 14867, 14869, 14879, 14887, 14891,
+    14897, 14923, 14929, 14939, 14947, 14951, 14957, 14969, 14983, 15013, 15017, 15031, 15053, 15061, 15073, 15077,
+    15083, 15091, 15101, 15107, 15121, 15131, 15137, 15139, 15149, 15161, 15173, 15187, 15193, 15199, 15217, 15227,
+    15233, 15241, 15259, 15263, 15269, 15271, 15277, 15287, 15289, 15299, 15307, 15313, 15319, 15329, 15331, 15349,
+    15359, 15361, 15373, 15377, 15383, 15391, 15401, 15413, 15427, 15439, 15443, 15451, 15461, 15467, 15473, 15493,
+    15497, 15511, 15527, 15541, 15551, 15559, 15569, 15581, 15583, 15601, 15607, 15619, 15629, 15641, 15643, 15647,
+    15649, 15661, 15667, 15671, 15679, 15683, 15727, 15731, 15733, 15737, 15739, 15749, 15761, 15767, 15773, 15787,
+    15791, 15797, 15803, 15809, 15817, 15823, 15859, 15877, 15881, 15887, 15889, 15901, 15907, 15913, 15919, 15923,
+    15937, 15959, 15971, 15973, 15991, 16001, 16007, 16033, 16057, 16061, 16063, 16067, 16069, 16073, 16087, 16091,
+    16097, 16103, 16111, 16127, 16139, 16141, 16183, 16187, 16189, 16193, 16217, 16223, 16229, 16231, 16249, 16253,
+    16267, 16273, 16301, 16319, 16333, 16339, 16349, 16361, 16363, 16369, 16381, 16411, 16417, 16421, 16427, 16433,
+    16447, 16451, 16453, 16477, 16481, 16487, 16493, 16519, 16529, 16547, 16553, 16561, 16567, 16573, 16603, 16607,
+    16619, 16631, 16633, 16649, 16651, 16657, 16661, 16673, 16691, 16693, 16699, 16703, 16729, 16741, 16747, 16759,
+    16763, 16787, 16811, 16823, 16829, 16831, 16843, 16871, 16879, 16883, 16889, 16901, 16903, 16921, 16927, 16931,
+    16937, 16943, 16963, 16979, 16981, 16987, 16993, 17011, 17021, 17027, 17029, 17033, 17041, 17047, 17053, 17077,
+    17093, 17099, 17107, 17117, 17123, 17137, 17159, 17167, 17183, 17189, 17191, 17203, 17207, 17209, 17231, 17239,
+    17257, 17291, 17293, 17299, 17317, 17321, 17327, 17333, 17341, 17351, 17359, 17377, 17383, 17387, 17389, 17393,
+    17401, 17417, 17419, 17431, 17443, 17449, 17467, 17471, 17477, 17483, 17489, 17491, 17497, 17509, 17519, 17539,
+    17551, 17569, 17573, 17579, 17581, 17597, 17599, 17609, 17623, 17627, 17657, 17659, 17669, 17681, 17683, 17707,
+    17713, 17729, 17737, 17747, 17749, 17761, 17783, 17789, 17791, 17807, 17827, 17837, 17839, 17851, 17863, 17881,
+    17891, 17903, 17909, 17911, 17921, 17923, 17929, 17939, 17957, 17959, 17971, 17977, 17981, 17987, 17989, 18013,
+    18041, 18043, 18047, 18049, 18059, 18061, 18077, 18089, 18097, 18119, 18121, 18127, 18131, 18133, 18143, 18149,
+    18169, 18181, 18191, 18199, 18211, 18217, 18223, 18229, 18233, 18251, 18253, 18257, 18269, 18287, 18289, 18301,
+    18307, 18311, 18313, 18329, 18341, 18353, 18367, 18371, 18379, 18397, 18401, 18413, 18427, 18433, 18439, 18443,
+    18451, 18457, 18461, 18481, 18493, 18503, 18517, 18521, 18523, 18539, 18541, 18553, 18583, 18587, 18593, 18617,
+    18637, 18661, 18671, 18679, 18691, 18701, 18713, 18719, 18731, 18743, 18749, 18757, 18773, 18787, 18793, 18797,
+    18803, 18839, 18859, 18869, 18899, 18911, 18913, 18917, 18919, 18947, 18959, 18973, 18979, 19001, 19009, 19013,
+    19031, 19037, 19051, 19069, 19073, 19079, 19081, 19087, 19121, 19139, 19141, 19157, 19163, 19181, 19183, 19207,
+    19211, 19213, 19219, 19231, 19237, 19249, 19259, 19267, 19273, 19289, 19301, 19309, 19319, 19333, 19373, 19379,
+    19381, 19387, 19391, 19403, 19417, 19421, 19423, 19427, 19429, 19433, 19441, 19447, 19457, 19463, 19469, 19471,
+    19477, 19483, 19489, 19501, 19507, 19531, 19541, 19543, 19553, 19559, 19571, 19577, 19583, 19597, 19603, 19609,
+    19661, 19681, 19687, 19697, 19699, 19709, 19717, 19727, 19739, 19751, 19753, 19759, 19763, 19777, 19793, 19801,
+    19813, 19819, 19841, 19843, 19853, 19861, 19867, 19889, 19891, 19913, 19919, 19927, 19937, 19949, 19961, 19963,
+    19973, 19979, 19991, 19993, 19997, 20011, 20021, 20023, 20029, 20047, 20051, 20063, 20071, 20089, 20101, 20107,
+    20113, 20117, 20123, 20129, 20143, 20147, 20149, 20161, 20173, 20177, 20183, 20201, 20219, 20231, 20233, 20249,
+    20261, 20269, 20287, 20297, 20323, 20327, 20333, 20341, 20347, 20353, 20357, 20359, 20369, 20389, 20393, 20399,
+    20407, 20411, 20431, 20441, 20443, 20477, 20479, 20483, 20507, 20509, 20521, 20533, 20543, 20549, 20551, 20563,
+    20593, 20599, 20611, 20627, 20639, 20641, 20663, 20681, 20693, 20707, 20717, 20719, 20731, 20743, 20747, 20749,
+    20753, 20759, 20771, 20773, 20789, 20807, 20809, 20849, 20857, 20873, 20879, 20887, 20897, 20899, 20903, 20921,
+    20929, 20939, 20947, 20959, 20963, 20981, 20983, 21001, 21011, 21013, 21017, 21019, 21023, 21031, 21059, 21061,
+    21067, 21089, 21101, 21107, 21121, 21139, 21143, 21149, 21157, 21163, 21169, 21179, 21187, 21191, 21193, 21211,
+    21221, 21227, 21247, 21269, 21277, 21283, 21313, 21317, 21319, 21323, 21341, 21347, 21377, 21379, 21383, 21391,
+    21397, 21401, 21407, 21419, 21433, 21467, 21481, 21487, 21491, 21493, 21499, 21503, 21517, 21521, 21523, 21529,
+    21557, 21559, 21563, 21569, 21577, 21587, 21589, 21599, 21601, 21611, 21613, 21617, 21647, 21649, 21661, 21673,
+    21683, 21701, 21713, 21727, 21737, 21739, 21751, 21757, 21767, 21773, 21787, 21799, 21803, 21817, 21821, 21839,
+    21841, 21851, 21859, 21863, 21871, 21881, 21893, 21911, 21929, 21937, 21943, 21961, 21977, 21991, 21997, 22003,
+    22013, 22027, 22031, 22037, 22039, 22051, 22063, 22067, 22073, 22079, 22091, 22093, 22109, 22111, 22123, 22129,
+    22133, 22147, 22153, 22157, 22159, 22171, 22189, 22193, 22229, 22247, 22259, 22271, 22273, 22277, 22279, 22283,
+    22291, 22303, 22307, 22343, 22349, 22367, 22369, 22381, 22391, 22397, 22409, 22433, 22441, 22447, 22453, 22469,
+    22481, 22483, 22501, 22511, 22531, 22541, 22543, 22549, 22567, 22571, 22573, 22613, 22619, 22621, 22637, 22639,
+    22643, 22651, 22669, 22679, 22691, 22697, 22699, 22709, 22717, 22721, 22727, 22739, 22741, 22751, 22769, 22777,
+    22783, 22787, 22807, 22811, 22817, 22853, 22859, 22861, 22871, 22877, 22901, 22907, 22921, 22937, 22943, 22961,
+    22963, 22973, 22993, 23003, 23011, 23017, 23021, 23027, 23029, 23039, 23041, 23053, 23057, 23059, 23063, 23071,
+    23081, 23087, 23099, 23117, 23131, 23143, 23159, 23167, 23173, 23189, 23197, 23201, 23203, 23209, 23227, 23251,
+    23269, 23279, 23291, 23293, 23297, 23311, 23321, 23327, 23333, 23339, 23357, 23369, 23371, 23399, 23417, 23431,
+    23447, 23459, 23473, 23497, 23509, 23531, 23537, 23539, 23549, 23557, 23561, 23563, 23567, 23581, 23593, 23599,
+    23603, 23609, 23623, 23627, 23629, 23633, 23663, 23669, 23671, 23677, 23687, 23689, 23719, 23741, 23743, 23747,
+    23753, 23761, 23767, 23773, 23789, 23801, 23813, 23819, 23827, 23831, 23833, 23857, 23869, 23873, 23879, 23887,
+    23893, 23899, 23909, 23911, 23917, 23929, 23957, 23971, 23977, 23981, 23993, 24001, 24007, 24019, 24023, 24029,
+    24043, 24049, 24061, 24071, 24077, 24083, 24091, 24097, 24103, 24107, 24109, 24113, 24121, 24133, 24137, 24151,
+    24169, 24179, 24181, 24197, 24203, 24223, 24229, 24239, 24247, 24251, 24281, 24317, 24329, 24337, 24359, 24371,
+    24373, 24379, 24391, 24407, 24413, 24419, 24421, 24439, 24443, 24469, 24473, 24481, 24499, 24509, 24517, 24527,
+    24533, 24547, 24551, 24571, 24593, 24611, 24623, 24631, 24659, 24671, 24677, 24683, 24691, 24697, 24709, 24733,
+    24749, 24763, 24767, 24781, 24793, 24799, 24809, 24821, 24841, 24847, 24851, 24859, 24877, 24889, 24907, 24917,
+    24919, 24923, 24943, 24953, 24967, 24971, 24977, 24979, 24989, 25013, 25031, 25033, 25037, 25057, 25073, 25087,
+    25097, 25111, 25117, 25121, 25127, 25147, 25153, 25163, 25169, 25171, 25183, 25189, 25219, 25229, 25237, 25243,
+    25247, 25253, 25261, 25301, 25303, 25307, 25309, 25321, 25339, 25343, 25349, 25357, 25367, 25373, 25391, 25409,
+    25411, 25423, 25439, 25447, 25453, 25457, 25463, 25469, 25471, 25523, 25537, 25541, 25561, 25577, 25579, 25583,
+    25589, 25601, 25603, 25609, 25621, 25633, 25639, 25643, 25657, 25667, 25673, 25679, 25693, 25703, 25717, 25733,
+    25741, 25747, 25759, 25763, 25771, 25793, 25799, 25801, 25819, 25841, 25847, 25849, 25867, 25873, 25889, 25903,
+    25913, 25919, 25931, 25933, 25939, 25943, 25951, 25969, 25981, 25997, 25999, 26003, 26017, 26021, 26029, 26041,
+    26053, 26083, 26099, 26107, 26111, 26113, 26119, 26141, 26153, 26161, 26171, 26177, 26183, 26189, 26203, 26209,
+    26227, 26237, 26249, 26251, 26261, 26263, 26267, 26293, 26297, 26309, 26317, 26321, 26339, 26347, 26357, 26371,
+    26387, 26393, 26399, 26407, 26417, 26423, 26431, 26437, 26449, 26459, 26479, 26489, 26497, 26501, 26513, 26539,
+    26557, 26561, 26573, 26591, 26597, 26627, 26633, 26641, 26647, 26669, 26681, 26683, 26687, 26693, 26699, 26701,
+    26711, 26713, 26717, 26723, 26729, 26731, 26737, 26759, 26777, 26783, 26801, 26813, 26821, 26833, 26839, 26849,
+    26861, 26863, 26879, 26881, 26891, 26893, 26903, 26921, 26927, 26947, 26951, 26953, 26959, 26981, 26987, 26993,
+    27011, 27017, 27031, 27043, 27059, 27061, 27067, 27073, 27077, 27091, 27103, 27107, 27109, 27127, 27143, 27179,
+    27191, 27197, 27211, 27239, 27241, 27253, 27259, 27271, 27277, 27281, 27283, 27299, 27329, 27337, 27361, 27367,
+    27397, 27407, 27409, 27427, 27431, 27437, 27449, 27457, 27479, 27481, 27487, 27509, 27527, 27529, 27539, 27541,
+    27551, 27581, 27583, 27611, 27617, 27631, 27647, 27653, 27673, 27689, 27691, 27697, 27701, 27733, 27737, 27739,
+    27743, 27749, 27751, 27763, 27767, 27773, 27779, 27791, 27793, 27799, 27803, 27809, 27817, 27823, 27827, 27847,
+    27851, 27883, 27893, 27901, 27917, 27919, 27941, 27943, 27947, 27953, 27961, 27967, 27983, 27997, 28001, 28019,
+    28027, 28031, 28051, 28057, 28069, 28081, 28087, 28097, 28099, 28109, 28111, 28123, 28151, 28163, 28181, 28183,
+    28201, 28211, 28219, 28229, 28277, 28279, 28283, 28289, 28297, 28307, 28309, 28319, 28349, 28351, 28387, 28393,
+    28403, 28409, 28411, 28429, 28433, 28439, 28447, 28463, 28477, 28493, 28499, 28513, 28517, 28537, 28541, 28547,
+    28549, 28559, 28571, 28573, 28579, 28591, 28597, 28603, 28607, 28619, 28621, 28627, 28631, 28643, 28649, 28657,
+    28661, 28663, 28669, 28687, 28697, 28703, 28711, 28723, 28729, 28751, 28753, 28759, 28771, 28789, 28793, 28807,
+    28813, 28817, 28837, 28843, 28859, 28867, 28871, 28879, 28901, 28909, 28921, 28927, 28933, 28949, 28961, 28979,
+    29009, 29017, 29021, 29023, 29027, 29033, 29059, 29063, 29077, 29101, 29123, 29129, 29131, 29137, 29147, 29153,
+    29167, 29173, 29179, 29191, 29201, 29207, 29209, 29221, 29231, 29243, 29251, 29269, 29287, 29297, 29303, 29311,
+    29327, 29333, 29339, 29347, 29363, 29383, 29387, 29389, 29399, 29401, 29411, 29423, 29429, 29437, 29443, 29453,
+    29473, 29483, 29501, 29527, 29531, 29537, 29567, 29569, 29573, 29581, 29587, 29599, 29611, 29629, 29633, 29641,
+    29663, 29669, 29671, 29683, 29717, 29723, 29741, 29753, 29759, 29761, 29789, 29803, 29819, 29833, 29837, 29851,
+    29863, 29867, 29873, 29879, 29881, 29917, 29921, 29927, 29947, 29959, 29983, 29989, 30011, 30013, 30029, 30047,
+    30059, 30071, 30089, 30091, 30097, 30103, 30109, 30113, 30119, 30133, 30137, 30139, 30161, 30169, 30181, 30187,
+    30197, 30203, 30211, 30223, 30241, 30253, 30259, 30269, 30271, 30293, 30307, 30313, 30319, 30323, 30341, 30347,
+    30367, 30389, 30391, 30403, 30427, 30431, 30449, 30467, 30469, 30491, 30493, 30497, 30509, 30517, 30529, 30539,
+    30553, 30557, 30559, 30577, 30593, 30631, 30637, 30643, 30649, 30661, 30671, 30677, 30689, 30697, 30703, 30707,
+    30713, 30727, 30757, 30763, 30773, 30781, 30803, 30809, 30817, 30829, 30839, 30841, 30851, 30853, 30859, 30869,
+    30871, 30881, 30893, 30911, 30931, 30937, 30941, 30949, 30971, 30977, 30983, 31013, 31019, 31033, 31039, 31051,
+    31063, 31069, 31079, 31081, 31091, 31121, 31123, 31139, 31147, 31151, 31153, 31159, 31177, 31181, 31183, 31189,
+    31193, 31219, 31223, 31231, 31237, 31247, 31249, 31253, 31259, 31267, 31271, 31277, 31307, 31319, 31321, 31327,
+    31333, 31337, 31357, 31379, 31387, 31391, 31393, 31397, 31469, 31477, 31481, 31489, 31511, 31513, 31517, 31531,
+    31541, 31543, 31547, 31567, 31573, 31583, 31601, 31607, 31627, 31643, 31649, 31657, 31663, 31667, 31687, 31699,
+    31721, 31723, 31727, 31729, 31741, 31751, 31769, 31771, 31793, 31799, 31817, 31847, 31849, 31859, 31873, 31883,
+    31891, 31907, 31957, 31963, 31973, 31981, 31991, 32003, 32009, 32027, 32029, 32051, 32057, 32059, 32063, 32069,
+    32077, 32083, 32089, 32099, 32117, 32119, 32141, 32143, 32159, 32173, 32183, 32189, 32191, 32203, 32213, 32233,
+    32237, 32251, 32257, 32261, 32297, 32299, 32303, 32309, 32321, 32323, 32327, 32341, 32353, 32359, 32363, 32369,
+    32371, 32377, 32381, 32401, 32411, 32413, 32423, 32429, 32441, 32443, 32467, 32479, 32491, 32497, 32503, 32507,
+    32531, 32533, 32537, 32561, 32563, 32569, 32573, 32579, 32587, 32603, 32609, 32611, 32621, 32633, 32647, 32653,
+    32687, 32693, 32707, 32713, 32717, 32719, 32749, 32771, 32779, 32783, 32789, 32797, 32801, 32803, 32831, 32833,
+    32839, 32843, 32869, 32887, 32909, 32911, 32917, 32933, 32939, 32941, 32957, 32969, 32971, 32983, 32987, 32993,
+    32999, 33013, 33023, 33029, 33037, 33049, 33053, 33071, 33073, 33083, 33091, 33107, 33113, 33119, 33149, 33151,
+    33161, 33179, 33181, 33191, 33199, 33203, 33211, 33223, 33247, 33287, 33289, 33301, 33311, 33317, 33329, 33331,
+    33343, 33347, 33349, 33353, 33359, 33377, 33391, 33403, 33409, 33413, 33427, 33457, 33461, 33469, 33479, 33487,
+    33493, 33503, 33521, 33529, 33533, 33547, 33563, 33569, 33577, 33581, 33587, 33589, 33599, 33601, 33613, 33617,
+    33619, 33623, 33629, 33637, 33641, 33647, 33679, 33703, 33713, 33721, 33739, 33749, 33751, 33757, 33767, 33769,
+    33773, 33791, 33797, 33809, 33811, 33827, 33829, 33851, 33857, 33863, 33871, 33889, 33893, 33911, 33923, 33931,
+    33937, 33941, 33961, 33967, 33997, 34019, 34031, 34033, 34039, 34057, 34061, 34123, 34127, 34129, 34141, 34147,
+    34157, 34159, 34171, 34183, 34211, 34213, 34217, 34231, 34253, 34259, 34261, 34267, 34273, 34283, 34297, 34301,
+    34303, 34313, 34319, 34327, 34337, 34351, 34361, 34367, 34369, 34381, 34403, 34421, 34429, 34439, 34457, 34469,
+    34471, 34483, 34487, 34499, 34501, 34511, 34513, 34519, 34537, 34543, 34549, 34583, 34589, 34591, 34603, 34607,
+    34613, 34631, 34649, 34651, 34667, 34673, 34679, 34687, 34693, 34703, 34721, 34729, 34739, 34747, 34757, 34759,
+    34763, 34781, 34807, 34819, 34841, 34843, 34847, 34849, 34871, 34877, 34883, 34897, 34913, 34919, 34939, 34949,
+    34961, 34963, 34981, 35023, 35027, 35051, 35053, 35059, 35069, 35081, 35083, 35089, 35099, 35107, 35111, 35117,
+    35129, 35141, 35149, 35153, 35159, 35171, 35201, 35221, 35227, 35251, 35257, 35267, 35279, 35281, 35291, 35311,
+    35317, 35323, 35327, 35339, 35353, 35363, 35381, 35393, 35401, 35407, 35419, 35423, 35437, 35447, 35449, 35461,
+    35491, 35507, 35509, 35521, 35527, 35531, 35533, 35537, 35543, 35569, 35573, 35591, 35593, 35597, 35603, 35617,
+    35671, 35677, 35729, 35731, 35747, 35753, 35759, 35771, 35797, 35801, 35803, 35809, 35831, 35837, 35839, 35851,
+    35863, 35869, 35879, 35897, 35899, 35911, 35923, 35933, 35951, 35963, 35969, 35977, 35983, 35993, 35999, 36007,
+    36011, 36013, 36017, 36037, 36061, 36067, 36073, 36083, 36097, 36107, 36109, 36131, 36137, 36151, 36161, 36187,
+    36191, 36209, 36217, 36229, 36241, 36251, 36263, 36269, 36277, 36293, 36299, 36307, 36313, 36319, 36341, 36343,
+    36353, 36373, 36383, 36389, 36433, 36451, 36457, 36467, 36469, 36473, 36479, 36493, 36497, 36523, 36527, 36529,
+    36541, 36551, 36559, 36563, 36571, 36583, 36587, 36599, 36607, 36629, 36637, 36643, 36653, 36671, 36677, 36683,
+    36691, 36697, 36709, 36713, 36721, 36739, 36749, 36761, 36767, 36779, 36781, 36787, 36791, 36793, 36809, 36821,
+    36833, 36847, 36857, 36871, 36877, 36887, 36899, 36901, 36913, 36919, 36923, 36929, 36931, 36943, 36947, 36973,
+    36979, 36997, 37003, 37013, 37019, 37021, 37039, 37049, 37057, 37061, 37087, 37097, 37117, 37123, 37139, 37159,
+    37171, 37181, 37189, 37199, 37201, 37217, 37223, 37243, 37253, 37273, 37277, 37307, 37309, 37313, 37321, 37337,
+    37339, 37357, 37361, 37363, 37369, 37379, 37397, 37409, 37423, 37441, 37447, 37463, 37483, 37489, 37493, 37501,
+    37507, 37511, 37517, 37529, 37537, 37547, 37549, 37561, 37567, 37571, 37573, 37579, 37589, 37591, 37607, 37619,
+    37633, 37643, 37649, 37657, 37663, 37691, 37693, 37699, 37717, 37747, 37781, 37783, 37799, 37811, 37813, 37831,
+    37847, 37853, 37861, 37871, 37879, 37889, 37897, 37907, 37951, 37957, 37963, 37967, 37987, 37991, 37993, 37997,
+    38011, 38039, 38047, 38053, 38069, 38083, 38113, 38119, 38149, 38153, 38167, 38177, 38183, 38189, 38197, 38201,
+    38219, 38231, 38237, 38239, 38261, 38273, 38281, 38287, 38299, 38303, 38317, 38321, 38327, 38329, 38333, 38351,
+    38371, 38377, 38393, 38431, 38447, 38449, 38453, 38459, 38461, 38501, 38543, 38557, 38561, 38567, 38569, 38593,
+    38603, 38609, 38611, 38629, 38639, 38651, 38653, 38669, 38671, 38677, 38693, 38699, 38707, 38711, 38713, 38723,
+    38729, 38737, 38747, 38749, 38767, 38783, 38791, 38803, 38821, 38833, 38839, 38851, 38861, 38867, 38873, 38891,
+    38903, 38917, 38921, 38923, 38933, 38953, 38959, 38971, 38977, 38993, 39019, 39023, 39041, 39043, 39047, 39079,
+    39089, 39097, 39103, 39107, 39113, 39119, 39133, 39139, 39157, 39161, 39163, 39181, 39191, 39199, 39209, 39217,
+    39227, 39229, 39233, 39239, 39241, 39251, 39293, 39301, 39313, 39317, 39323, 39341, 39343, 39359, 39367, 39371,
+    39373, 39383, 39397, 39409, 39419, 39439, 39443, 39451, 39461, 39499, 39503, 39509, 39511, 39521, 39541, 39551,
+    39563, 39569, 39581, 39607, 39619, 39623, 39631, 39659, 39667, 39671, 39679, 39703, 39709, 39719, 39727, 39733,
+    39749, 39761, 39769, 39779, 39791, 39799, 39821, 39827, 39829, 39839, 39841, 39847, 39857, 39863, 39869, 39877,
+    39883, 39887, 39901, 39929, 39937, 39953, 39971, 39979, 39983, 39989, 40009, 40013, 40031, 40037, 40039, 40063,
+    40087, 40093, 40099, 40111, 40123, 40127, 40129, 40151, 40153, 40163, 40169, 40177, 40189, 40193, 40213, 40231,
+    40237, 40241, 40253, 40277, 40283, 40289, 40343, 40351, 40357, 40361, 40387, 40423, 40427, 40429, 40433, 40459,
+    40471, 40483, 40487, 40493, 40499, 40507, 40519, 40529, 40531, 40543, 40559, 40577, 40583, 40591, 40597, 40609,
+    40627, 40637, 40639, 40693, 40697, 40699, 40709, 40739, 40751, 40759, 40763, 40771, 40787, 40801, 40813, 40819,
+    40823, 40829, 40841, 40847, 40849, 40853, 40867, 40879, 40883, 40897, 40903, 40927, 40933, 40939, 40949, 40961,
+    40973, 40993, 41011, 41017, 41023, 41039, 41047, 41051, 41057, 41077, 41081, 41113, 41117, 41131, 41141, 41143,
+    41149, 41161, 41177, 41179, 41183, 41189, 41201, 41203, 41213, 41221, 41227, 41231, 41233, 41243, 41257, 41263,
+    41269, 41281, 41299, 41333, 41341, 41351, 41357, 41381, 41387, 41389, 41399, 41411, 41413, 41443, 41453, 41467,
+    41479, 41491, 41507, 41513, 41519, 41521, 41539, 41543, 41549, 41579, 41593, 41597, 41603, 41609, 41611, 41617,
+    41621, 41627, 41641, 41647, 41651, 41659, 41669, 41681, 41687, 41719, 41729, 41737, 41759, 41761, 41771, 41777,
+    41801, 41809, 41813, 41843, 41849, 41851, 41863, 41879, 41887, 41893, 41897, 41903, 41911, 41927, 41941, 41947,
+    41953, 41957, 41959, 41969, 41981, 41983, 41999, 42013, 42017, 42019, 42023, 42043, 42061, 42071, 42073, 42083,
+    42089, 42101, 42131, 42139, 42157, 42169, 42179, 42181, 42187, 42193, 42197, 42209, 42221, 42223, 42227, 42239,
+    42257, 42281, 42283, 42293, 42299, 42307, 42323, 42331, 42337, 42349, 42359, 42373, 42379, 42391, 42397, 42403,
+    42407, 42409, 42433, 42437, 42443, 42451, 42457, 42461, 42463, 42467, 42473, 42487, 42491, 42499, 42509, 42533,
+    42557, 42569, 42571, 42577, 42589, 42611, 42641, 42643, 42649, 42667, 42677, 42683, 42689, 42697, 42701, 42703,
+    42709, 42719, 42727, 42737, 42743, 42751, 42767, 42773, 42787, 42793, 42797, 42821, 42829, 42839, 42841, 42853,
+    42859, 42863, 42899, 42901, 42923, 42929, 42937, 42943, 42953, 42961, 42967, 42979, 42989, 43003, 43013, 43019,
+    43037, 43049, 43051, 43063, 43067, 43093, 43103, 43117, 43133, 43151, 43159, 43177, 43189, 43201, 43207, 43223,
+    43237, 43261, 43271, 43283, 43291, 43313, 43319, 43321, 43331, 43391, 43397, 43399, 43403, 43411, 43427, 43441,
+    43451, 43457, 43481, 43487, 43499, 43517, 43541, 43543, 43573, 43577, 43579, 43591, 43597, 43607, 43609, 43613,
+    43627, 43633, 43649, 43651, 43661, 43669, 43691, 43711, 43717, 43721, 43753, 43759, 43777, 43781, 43783, 43787,
+    43789, 43793, 43801, 43853, 43867, 43889, 43891, 43913, 43933, 43943, 43951, 43961, 43963, 43969, 43973, 43987,
+    43991, 43997, 44017, 44021, 44027, 44029, 44041, 44053, 44059, 44071, 44087, 44089, 44101, 44111, 44119, 44123,
+    44129, 44131, 44159, 44171, 44179, 44189, 44201, 44203, 44207, 44221, 44249, 44257, 44263, 44267, 44269, 44273,
+    44279, 44281, 44293, 44351, 44357, 44371, 44381, 44383, 44389, 44417, 44449, 44453, 44483, 44491, 44497, 44501,
+    44507, 44519, 44531, 44533, 44537, 44543, 44549, 44563, 44579, 44587, 44617, 44621, 44623, 44633, 44641, 44647,
+    44651, 44657, 44683, 44687, 44699, 44701, 44711, 44729, 44741, 44753, 44771, 44773, 44777, 44789, 44797, 44809,
+    44819, 44839, 44843, 44851, 44867, 44879, 44887, 44893, 44909, 44917, 44927, 44939, 44953, 44959, 44963, 44971,
+    44983, 44987, 45007, 45013, 45053, 45061, 45077, 45083, 45119, 45121, 45127, 45131, 45137, 45139, 45161, 45179,
+    45181, 45191, 45197, 45233, 45247, 45259, 45263, 45281, 45289, 45293, 45307, 45317, 45319, 45329, 45337, 45341,
+    45343, 45361, 45377, 45389, 45403, 45413, 45427, 45433, 45439, 45481, 45491, 45497, 45503, 45523, 45533, 45541,
+    45553, 45557, 45569, 45587, 45589, 45599, 45613, 45631, 45641, 45659, 45667, 45673, 45677, 45691, 45697, 45707,
+    45737, 45751, 45757, 45763, 45767, 45779, 45817, 45821, 45823, 45827, 45833, 45841, 45853, 45863, 45869, 45887,
+    45893, 45943, 45949, 45953, 45959, 45971, 45979, 45989, 46021, 46027, 46049, 46051, 46061, 46073, 46091, 46093,
+    46099, 46103, 46133, 46141, 46147, 46153, 46171, 46181, 46183, 46187, 46199, 46219, 46229, 46237, 46261, 46271,
+    46273, 46279, 46301, 46307, 46309, 46327, 46337, 46349, 46351, 46381, 46399, 46411, 46439, 46441, 46447, 46451,
+    46457, 46471, 46477, 46489, 46499, 46507, 46511, 46523, 46549, 46559, 46567, 46573, 46589, 46591, 46601, 46619,
+    46633, 46639, 46643, 46649, 46663, 46679, 46681, 46687, 46691, 46703, 46723, 46727, 46747, 46751, 46757, 46769,
+    46771, 46807, 46811, 46817, 46819, 46829, 46831, 46853, 46861, 46867, 46877, 46889, 46901, 46919, 46933, 46957,
+    46993, 46997, 47017, 47041, 47051, 47057, 47059, 47087, 47093, 47111, 47119, 47123, 47129, 47137, 47143, 47147,
+    47149, 47161, 47189, 47207, 47221, 47237, 47251, 47269, 47279, 47287, 47293, 47297, 47303, 47309, 47317, 47339,
+    47351, 47353, 47363, 47381, 47387, 47389, 47407, 47417, 47419, 47431, 47441, 47459, 47491, 47497, 47501, 47507,
+    47513, 47521, 47527, 47533, 47543, 47563, 47569, 47581, 47591, 47599, 47609, 47623, 47629, 47639, 47653, 47657,
+    47659, 47681, 47699, 47701, 47711, 47713, 47717, 47737, 47741, 47743, 47777, 47779, 47791, 47797, 47807, 47809,
+    47819, 47837, 47843, 47857, 47869, 47881, 47903, 47911, 47917, 47933, 47939, 47947, 47951, 47963, 47969, 47977,
+    47981, 48017, 48023, 48029, 48049, 48073, 48079, 48091, 48109, 48119, 48121, 48131, 48157, 48163, 48179, 48187,
+    48193, 48197, 48221, 48239, 48247, 48259, 48271, 48281, 48299, 48311, 48313, 48337, 48341, 48353, 48371, 48383,
+    48397, 48407, 48409, 48413, 48437, 48449, 48463, 48473, 48479, 48481, 48487, 48491, 48497, 48523, 48527, 48533,
+    48539, 48541, 48563, 48571, 48589, 48593, 48611, 48619, 48623, 48647, 48649, 48661, 48673, 48677, 48679, 48731,
+    48733, 48751, 48757, 48761, 48767, 48779, 48781, 48787, 48799, 48809, 48817, 48821, 48823, 48847, 48857, 48859,
+    48869, 48871, 48883, 48889, 48907, 48947, 48953, 48973, 48989, 48991, 49003, 49009, 49019, 49031, 49033, 49037,
+    49043, 49057, 49069, 49081, 49103, 49109, 49117, 49121, 49123, 49139, 49157, 49169, 49171, 49177, 49193, 49199,
+    49201, 49207, 49211, 49223, 49253, 49261, 49277, 49279, 49297, 49307, 49331, 49333, 49339, 49363, 49367, 49369,
+    49391, 49393, 49409, 49411, 49417, 49429, 49433, 49451, 49459, 49463, 49477, 49481, 49499, 49523, 49529, 49531,
+    49537, 49547, 49549, 49559, 49597, 49603, 49613, 49627, 49633, 49639, 49663, 49667, 49669, 49681, 49697, 49711,
+    49727, 49739, 49741, 49747, 49757, 49783, 49787, 49789, 49801, 49807, 49811, 49823, 49831, 49843, 49853, 49871,
+    49877, 49891, 49919, 49921, 49927, 49937, 49939, 49943, 49957, 49991, 49993, 49999, 50021, 50023, 50033, 50047,
+    50051, 50053, 50069, 50077, 50087, 50093, 50101, 50111, 50119, 50123, 50129, 50131, 50147, 50153, 50159, 50177,
+    50207, 50221, 50227, 50231, 50261, 50263, 50273, 50287, 50291, 50311, 50321, 50329, 50333, 50341, 50359, 50363,
+    50377, 50383, 50387, 50411, 50417, 50423, 50441, 50459, 50461, 50497, 50503, 50513, 50527, 50539, 50543, 50549,
+    50551, 50581, 50587, 50591, 50593, 50599, 50627, 50647, 50651, 50671, 50683, 50707, 50723, 50741, 50753, 50767,
+    50773, 50777, 50789, 50821, 50833, 50839, 50849, 50857, 50867, 50873, 50891, 50893, 50909, 50923, 50929, 50951,
+    50957, 50969, 50971, 50989, 50993, 51001, 51031, 51043, 51047, 51059, 51061, 51071, 51109, 51131, 51133, 51137,
+    51151, 51157, 51169, 51193, 51197, 51199, 51203, 51217, 51229, 51239, 51241, 51257, 51263, 51283, 51287, 51307,
+    51329, 51341, 51343, 51347, 51349, 51361, 51383, 51407, 51413, 51419, 51421, 51427, 51431, 51437, 51439, 51449,
+    51461, 51473, 51479, 51481, 51487, 51503, 51511, 51517, 51521, 51539, 51551, 51563, 51577, 51581, 51593, 51599,
+    51607, 51613, 51631, 51637, 51647, 51659, 51673, 51679, 51683, 51691, 51713, 51719, 51721, 51749, 51767, 51769,
+    51787, 51797, 51803, 51817, 51827, 51829, 51839, 51853, 51859, 51869, 51871, 51893, 51899, 51907, 51913, 51929,
+    51941, 51949, 51971, 51973, 51977, 51991, 52009, 52021, 52027, 52051, 52057, 52067, 52069, 52081, 52103, 52121,
+    52127, 52147, 52153, 52163, 52177, 52181, 52183, 52189, 52201, 52223, 52237, 52249, 52253, 52259, 52267, 52289,
+    52291, 52301, 52313, 52321, 52361, 52363, 52369, 52379, 52387, 52391, 52433, 52453, 52457, 52489, 52501, 52511,
+    52517, 52529, 52541, 52543, 52553, 52561, 52567, 52571, 52579, 52583, 52609, 52627, 52631, 52639, 52667, 52673,
+    52691, 52697, 52709, 52711, 52721, 52727, 52733, 52747, 52757, 52769, 52783, 52807, 52813, 52817, 52837, 52859,
+    52861, 52879, 52883, 52889, 52901, 52903, 52919, 52937, 52951, 52957, 52963, 52967, 52973, 52981, 52999, 53003,
+    53017, 53047, 53051, 53069, 53077, 53087, 53089, 53093, 53101, 53113, 53117, 53129, 53147, 53149, 53161, 53171,
+    53173, 53189, 53197, 53201, 53231, 53233, 53239, 53267, 53269, 53279, 53281, 53299, 53309, 53323, 53327, 53353,
+    53359, 53377, 53381, 53401, 53407, 53411, 53419, 53437, 53441, 53453, 53479, 53503, 53507, 53527, 53549, 53551,
+    53569, 53591, 53593, 53597, 53609, 53611, 53617, 53623, 53629, 53633, 53639, 53653, 53657, 53681, 53693, 53699,
+    53717, 53719, 53731, 53759, 53773, 53777, 53783, 53791, 53813, 53819, 53831, 53849, 53857, 53861, 53881, 53887,
+    53891, 53897, 53899, 53917, 53923, 53927, 53939, 53951, 53959, 53987, 53993, 54001, 54011, 54013, 54037, 54049,
+    54059, 54083, 54091, 54101, 54121, 54133, 54139, 54151, 54163, 54167, 54181, 54193, 54217, 54251, 54269, 54277,
+    54287, 54293, 54311, 54319, 54323, 54331, 54347, 54361, 54367, 54371, 54377, 54401, 54403, 54409, 54413, 54419,
+    54421, 54437, 54443, 54449, 54469, 54493, 54497, 54499, 54503, 54517, 54521, 54539, 54541, 54547, 54559, 54563,
+    54577, 54581, 54583, 54601, 54617, 54623, 54629, 54631, 54647, 54667, 54673, 54679, 54709, 54713, 54721, 54727,
+    54751, 54767, 54773, 54779, 54787, 54799, 54829, 54833, 54851, 54869, 54877, 54881, 54907, 54917, 54919, 54941,
+    54949, 54959, 54973, 54979, 54983, 55001, 55009, 55021, 55049, 55051, 55057, 55061, 55073, 55079, 55103, 55109,
+    55117, 55127, 55147, 55163, 55171, 55201, 55207, 55213, 55217, 55219, 55229, 55243, 55249, 55259, 55291, 55313,
+    55331, 55333, 55337, 55339, 55343, 55351, 55373, 55381, 55399, 55411, 55439, 55441, 55457, 55469, 55487, 55501,
+    55511, 55529, 55541, 55547, 55579, 55589, 55603, 55609, 55619, 55621, 55631, 55633, 55639, 55661, 55663, 55667,
+    55673, 55681, 55691, 55697, 55711, 55717, 55721, 55733, 55763, 55787, 55793, 55799, 55807, 55813, 55817, 55819,
+    55823, 55829, 55837, 55843, 55849, 55871, 55889, 55897, 55901, 55903, 55921, 55927, 55931, 55933, 55949, 55967,
+    55987, 55997, 56003, 56009, 56039, 56041, 56053, 56081, 56087, 56093, 56099, 56101, 56113, 56123, 56131, 56149,
+    56167, 56171, 56179, 56197, 56207, 56209, 56237, 56239, 56249, 56263, 56267, 56269, 56299, 56311, 56333, 56359,
+    56369, 56377, 56383, 56393, 56401, 56417, 56431, 56437, 56443, 56453, 56467, 56473, 56477, 56479, 56489, 56501,
+    56503, 56509, 56519, 56527, 56531, 56533, 56543, 56569, 56591, 56597, 56599, 56611, 56629, 56633, 56659, 56663,
+    56671, 56681, 56687, 56701, 56711, 56713, 56731, 56737, 56747, 56767, 56773, 56779, 56783, 56807, 56809, 56813,
+    56821, 56827, 56843, 56857, 56873, 56891, 56893, 56897, 56909, 56911, 56921, 56923, 56929, 56941, 56951, 56957,
+    56963, 56983, 56989, 56993, 56999, 57037, 57041, 57047, 57059, 57073, 57077, 57089, 57097, 57107, 57119, 57131,
+    57139, 57143, 57149, 57163, 57173, 57179, 57191, 57193, 57203, 57221, 57223, 57241, 57251, 57259, 57269, 57271,
+    57283, 57287, 57301, 57329, 57331, 57347, 57349, 57367, 57373, 57383, 57389, 57397, 57413, 57427, 57457, 57467,
+    57487, 57493, 57503, 57527, 57529, 57557, 57559, 57571, 57587, 57593, 57601, 57637, 57641, 57649, 57653, 57667,
+    57679, 57689, 57697, 57709, 57713, 57719, 57727, 57731, 57737, 57751, 57773, 57781, 57787, 57791, 57793, 57803,
+    57809, 57829, 57839, 57847, 57853, 57859, 57881, 57899, 57901, 57917, 57923, 57943, 57947, 57973, 57977, 57991,
+    58013, 58027, 58031, 58043, 58049, 58057, 58061, 58067, 58073, 58099, 58109, 58111, 58129, 58147, 58151, 58153,
+    58169, 58171, 58189, 58193, 58199, 58207, 58211, 58217, 58229, 58231, 58237, 58243, 58271, 58309, 58313, 58321,
+    58337, 58363, 58367, 58369, 58379, 58391, 58393, 58403, 58411, 58417, 58427, 58439, 58441, 58451, 58453, 58477,
+    58481, 58511, 58537, 58543, 58549, 58567, 58573, 58579, 58601, 58603, 58613, 58631, 58657, 58661, 58679, 58687,
+    58693, 58699, 58711, 58727, 58733, 58741, 58757, 58763, 58771, 58787, 58789, 58831, 58889, 58897, 58901, 58907,
+    58909, 58913, 58921, 58937, 58943, 58963, 58967, 58979, 58991, 58997, 59009, 59011, 59021, 59023, 59029, 59051,
+    59053, 59063, 59069, 59077, 59083, 59093, 59107, 59113, 59119, 59123, 59141, 59149, 59159, 59167, 59183, 59197,
+    59207, 59209, 59219, 59221, 59233, 59239, 59243, 59263, 59273, 59281, 59333, 59341, 59351, 59357, 59359, 59369,
+    59377, 59387, 59393, 59399, 59407, 59417, 59419, 59441, 59443, 59447, 59453, 59467, 59471, 59473, 59497, 59509,
+    59513, 59539, 59557, 59561, 59567, 59581, 59611, 59617, 59621, 59627, 59629, 59651, 59659, 59663, 59669, 59671,
+    59693, 59699, 59707, 59723, 59729, 59743, 59747, 59753, 59771, 59779, 59791, 59797, 59809, 59833, 59863, 59879,
+    59887, 59921, 59929, 59951, 59957, 59971, 59981, 59999, 60013, 60017, 60029, 60037, 60041, 60077, 60083, 60089,
+    60091, 60101, 60103, 60107, 60127, 60133, 60139, 60149, 60161, 60167, 60169, 60209, 60217, 60223, 60251, 60257,
+    60259, 60271, 60289, 60293, 60317, 60331, 60337, 60343, 60353, 60373, 60383, 60397, 60413, 60427, 60443, 60449,
+    60457, 60493, 60497, 60509, 60521, 60527, 60539, 60589, 60601, 60607, 60611, 60617, 60623, 60631, 60637, 60647,
+    60649, 60659, 60661, 60679, 60689, 60703, 60719, 60727, 60733, 60737, 60757, 60761, 60763, 60773, 60779, 60793,
+    60811, 60821, 60859, 60869, 60887, 60889, 60899, 60901, 60913, 60917, 60919, 60923, 60937, 60943, 60953, 60961,
+    61001, 61007, 61027, 61031, 61043, 61051, 61057, 61091, 61099, 61121, 61129, 61141, 61151, 61153, 61169, 61211,
+    61223, 61231, 61253, 61261, 61283, 61291, 61297, 61331, 61333, 61339, 61343, 61357, 61363, 61379, 61381, 61403,
+    61409, 61417, 61441, 61463, 61469, 61471, 61483, 61487, 61493, 61507, 61511, 61519, 61543, 61547, 61553, 61559,
+    61561, 61583, 61603, 61609, 61613, 61627, 61631, 61637, 61643, 61651, 61657, 61667, 61673, 61681, 61687, 61703,
+    61717, 61723, 61729, 61751, 61757, 61781, 61813, 61819, 61837, 61843, 61861, 61871, 61879, 61909, 61927, 61933,
+    61949, 61961, 61967, 61979, 61981, 61987, 61991, 62003, 62011, 62017, 62039, 62047, 62053, 62057, 62071, 62081,
+    62099, 62119, 62129, 62131, 62137, 62141, 62143, 62171, 62189, 62191, 62201, 62207, 62213, 62219, 62233, 62273,
+    62297, 62299, 62303, 62311, 62323, 62327, 62347, 62351, 62383, 62401, 62417, 62423, 62459, 62467, 62473, 62477,
+    62483, 62497, 62501, 62507, 62533, 62539, 62549, 62563, 62581, 62591, 62597, 62603, 62617, 62627, 62633, 62639,
+    62653, 62659, 62683, 62687, 62701, 62723, 62731, 62743, 62753, 62761, 62773, 62791, 62801, 62819, 62827, 62851,
+    62861, 62869, 62873, 62897, 62903, 62921, 62927, 62929, 62939, 62969, 62971, 62981, 62983, 62987, 62989, 63029,
+    63031, 63059, 63067, 63073, 63079, 63097, 63103, 63113, 63127, 63131, 63149, 63179, 63197, 63199, 63211, 63241,
+    63247, 63277, 63281, 63299, 63311, 63313, 63317, 63331, 63337, 63347, 63353, 63361, 63367, 63377, 63389, 63391,
+    63397, 63409, 63419, 63421, 63439, 63443, 63463, 63467, 63473, 63487, 63493, 63499, 63521, 63527, 63533, 63541,
+    63559, 63577, 63587, 63589, 63599, 63601, 63607, 63611, 63617, 63629, 63647, 63649, 63659, 63667, 63671, 63689,
+    63691, 63697, 63703, 63709, 63719, 63727, 63737, 63743, 63761, 63773, 63781, 63793, 63799, 63803, 63809, 63823,
+    63839, 63841, 63853, 63857, 63863, 63901, 63907, 63913, 63929, 63949, 63977, 63997, 64007, 64013, 64019, 64033,
+    64037, 64063, 64067, 64081, 64091, 64109, 64123, 64151, 64153, 64157, 64171, 64187, 64189, 64217, 64223, 64231,
+    64237, 64271, 64279, 64283, 64301, 64303, 64319, 64327, 64333, 64373, 64381, 64399, 64403, 64433, 64439, 64451,
+    64453, 64483, 64489, 64499, 64513, 64553, 64567, 64577, 64579, 64591, 64601, 64609, 64613, 64621, 64627, 64633,
+    64661, 64663, 64667, 64679, 64693, 64709, 64717, 64747, 64763, 64781, 64783, 64793, 64811, 64817, 64849, 64853,
+    64871, 64877, 64879, 64891, 64901, 64919, 64921, 64927, 64937, 64951, 64969, 64997, 65003, 65011, 65027, 65029,
+    65033, 65053, 65063, 65071, 65089, 65099, 65101, 65111, 65119, 65123, 65129, 65141, 65147, 65167, 65171, 65173,
+    65179, 65183, 65203, 65213, 65239, 65257, 65267, 65269, 65287, 65293, 65309, 65323, 65327, 65353, 65357, 65371,
+    65381, 65393, 65407, 65413, 65419, 65423, 65437, 65447, 65449, 65479, 65497, 65519, 65521
+};
+
+const Limb trialInv[SMALL_PRIME_NUM] = {
+    0xaaaaaaaaaaaaaaabULL, 0xcccccccccccccccdULL, 0x6db6db6db6db6db7ULL, 0x2e8ba2e8ba2e8ba3ULL,
+    0x4ec4ec4ec4ec4ec5ULL, 0xf0f0f0f0f0f0f0f1ULL, 0x86bca1af286bca1bULL, 0xd37a6f4de9bd37a7ULL,
+    0x34f72c234f72c235ULL, 0xef7bdef7bdef7bdfULL, 0x14c1bacf914c1badULL, 0x8f9c18f9c18f9c19ULL,
+    0x82fa0be82fa0be83ULL, 0x51b3bea3677d46cfULL, 0x21cfb2b78c13521dULL, 0xcbeea4e1a08ad8f3ULL,
+    0x4fbcda3ac10c9715ULL, 0xf0b7672a07a44c6bULL, 0x193d4bb7e327a977ULL, 0x7e3f1f8fc7e3f1f9ULL,
+    0x9b8b577e613716afULL, 0xa3784a062b2e43dbULL, 0xf47e8fd1fa3f47e9ULL, 0xa3a0fd5c5f02a3a1ULL,
+    0x3a4c0a237c32b16dULL, 0xdab7ec1dd3431b57ULL, 0x77a04c8f8d28ac43ULL, 0xa6c0964fda6c0965ULL,
+    0x90fdbc090fdbc091ULL, 0x7efdfbf7efdfbf7fULL, 0x03e88cb3c9484e2bULL, 0xe21a291c077975b9ULL,
+    0x3aef6ca970586723ULL, 0xdf5b0f768ce2cabdULL, 0x6fe4dfc9bf937f27ULL, 0x5b4fe5e92c0685b5ULL,
+    0x1f693a1c451ab30bULL, 0x8d07aa27db35a717ULL, 0x882383b30d516325ULL, 0xed6866f8d962ae7bULL,
+    0x3454dca410f8ed9dULL, 0x1d7ca632ee936f3fULL, 0x70bf015390948f41ULL, 0xc96bdb9d3d137e0dULL,
+    0x2697cc8aef46c0f7ULL, 0xc0e8f2a76e68575bULL, 0x687763dfdb43bb1fULL, 0x1b10ea929ba144cbULL,
+    0x1d10c4c0478bbcedULL, 0x63fb9aeb1fdcd759ULL, 0x64afaa4f437b2e0fULL, 0xf010fef010fef011ULL,
+    0x28cbfbeb9a020a33ULL, 0xff00ff00ff00ff01ULL, 0xd624fd1470e99cb7ULL, 0x8fb3ddbd6205b5c5ULL,
+    0xd57da36ca27acdefULL, 0xee70c03b25e4463dULL, 0xc5b1a6b80749cb29ULL, 0x47768073c9b97113ULL,
+    0x2591e94884ce32adULL, 0xf02806abc74be1fbULL, 0x7ec3e8f3a7198487ULL, 0x58550f8a39409d09ULL,
+    0xec9e48ae6f71de15ULL, 0x2ff3a018bfce8063ULL, 0x7f9ec3fcf61fe7b1ULL, 0x89f5abe570e046d3ULL,
+    0xda971b23f1545af5ULL, 0x79d5f00b9a7862a1ULL, 0x4dba1df32a128a57ULL, 0x87530217b7747d8fULL,
+    0x30baae53bb5e06ddULL, 0xee70206c12e9b5b3ULL, 0xcdde9462ec9dbe7fULL, 0xafb64b05ec41cf4dULL,
+    0x02944ff5aec02945ULL, 0x2cb033128382df71ULL, 0x1ccacc0c84b1c2a9ULL, 0x19a93db575eb3a0bULL,
+    0xcebeef94fa86fe2dULL, 0x6faa77fb3f8df54fULL, 0x68a58af00975a751ULL, 0xd56e36d0c3efac07ULL,
+    0xd8b44c47a8299b73ULL, 0x02d9ccaf9ba70e41ULL, 0x0985e1c023d9e879ULL, 0x2a343316c494d305ULL,
+    0x70cb7916ab67652fULL, 0xd398f132fb10fe5bULL, 0x6f2a38a6bf54fa1fULL, 0x211df689b98f81d7ULL,
+    0x0e994983e90f1ec3ULL, 0xad671e44bed87f3bULL, 0xf9623a0516e70fc7ULL, 0x4b7129be9dece355ULL,
+    0x190f3b7473f62c39ULL, 0x63dacc9aad46f9a3ULL, 0xc1108fda24e8d035ULL, 0xb77578472319bd8bULL,
+    0x473d20a1c7ed9da5ULL, 0xfbe85af0fea2c8fbULL, 0x58a1f7e6ce0f4c09ULL, 0x1a00e58c544986f3ULL,
+    0x7194a17f55a10dc1ULL, 0x7084944785e33763ULL, 0xba10679bd84886b1ULL, 0xebe9c6bb31260967ULL,
+    0x97a3fe4bd1ff25e9ULL, 0x6c6388395b84d99fULL, 0x8c51da6a1335df6dULL, 0x46f3234475d5add9ULL,
+    0x905605ca3c619a43ULL, 0xcee8dff304767747ULL, 0xff99c27f00663d81ULL, 0xacca407f671ddc2bULL,
+    0xe71298bac1e12337ULL, 0xfa1e94309cd09045ULL, 0xbebccb8e91496b9bULL, 0x312fa30cc7d7b8bdULL,
+    0x6160ff9e9f006161ULL, 0x6b03673b5e28152dULL, 0xfe802ffa00bfe803ULL, 0xe66fe25c9e907c7bULL,
+    0x3f8b236c76528895ULL, 0xf6f923bf01ce2c0dULL, 0x6c3d3d98bed7c42fULL, 0x30981efcd4b010e7ULL,
+    0x6f691fc81ebbe575ULL, 0xb10480ddb47b52cbULL, 0x74cd59ed64f3f0d7ULL, 0x0105cb81316d6c0fULL,
+    0x9be64c6d91c1195dULL, 0x71b3f945a27b1f49ULL, 0x77d80d50e508fd01ULL, 0xa5eb778e133551cdULL,
+    0x18657d3c2d8a3f1bULL, 0x2e40e220c34ad735ULL, 0xa76593c70a714919ULL, 0x1eef452124eea383ULL,
+    0x38206dc242ba771dULL, 0x4cd4c35807772287ULL, 0x83de917d5e69ddf3ULL, 0x882ef0403b4a6c15ULL,
+    0xf8fb6c51c606b677ULL, 0xb4abaac446d3e1fdULL, 0xa9f83bbe484a14e9ULL, 0x0bebbc0d1ce874d3ULL,
+    0xbd418eaf0473189fULL, 0x44e3af6f372b7e65ULL, 0xc87fdace4f9e5d91ULL, 0xec93479c446bd9bbULL,
+    0xdac4d592e777c647ULL, 0xa63ea8c8f61f0c23ULL, 0xe476062ea5cbbb6fULL, 0xdf68761c69daac27ULL,
+    0xb813d737637aa061ULL, 0xa3a77aac1fb15099ULL, 0x17f0c3e0712c5825ULL, 0xfd912a70ff30637bULL,
+    0xfbb3b5dc01131289ULL, 0x856d560a0f5acdf7ULL, 0x96472f314d3f89e3ULL, 0xa76f5c7ed2253531ULL,
+    0x816eae7c7bf69fe7ULL, 0xb6a2bea4cfb1781fULL, 0xa3900c53318e81edULL, 0x60aa7f5d9f148d11ULL,
+    0x6be8c0102c7a505dULL, 0x8ff3f0ed28728f33ULL, 0x680e0a87e5ec7155ULL, 0xbbf70fa49fe829b7ULL,
+    0xd69d1e7b6a50ca39ULL, 0x1a1e0f46b6d26aefULL, 0x7429f9a7a8251829ULL, 0xd9c2219d1b863613ULL,
+    0x91406c1820d077adULL, 0x521f4ec02e3d2b97ULL, 0xbb8283b63dc8eba5ULL, 0x431eda153229ebbfULL,
+    0xaf0bf78d7e01686bULL, 0xa9ced0742c086e8dULL, 0xc26458ad9f632df9ULL, 0xbbff1255dff892afULL,
+    0xcbd49a333f04d8fdULL, 0xec84ed6f9cfdeff5ULL, 0x97980cc40bda9d4bULL, 0x777f34d524f5cbd9ULL,
+    0x2797051d94cbbb7fULL, 0xea769051b4f43b81ULL, 0xce7910f3034d4323ULL, 0x92791d1374f5b99bULL,
+    0x89a5645cc68ea1b5ULL, 0x5f8aacf796c0cf0bULL, 0xf2e90a15e33edf99ULL, 0x8e99e5feb897c451ULL,
+    0xaca2eda38fb91695ULL, 0x5d9b737be5ea8b41ULL, 0x4aefe1db93fd7cf7ULL, 0xa0994ef20b3f8805ULL,
+    0x103890bda912822fULL, 0xb441659d13a9147dULL, 0x1e2134440c4c3f21ULL, 0x263a27727a6883c3ULL,
+    0x78e221472ab33855ULL, 0x95eac88e82e6faffULL, 0xf66c258317be8dabULL, 0x09ee202c7cb91939ULL,
+    0x8d2fca1042a09ea3ULL, 0x82779c856d8b8bf1ULL, 0x3879361cba8a223dULL, 0xf23f43639c3182a7ULL,
+    0xa03868fc474bcd13ULL, 0x651e78b8c5311a97ULL, 0x8ffce639c00c6719ULL, 0xf7b460754b0b61cfULL,
+    0x7b03f3359b8e63b1ULL, 0xa55c5326041eb667ULL, 0x647f88ab896a76f5ULL, 0x8fd971434a55a46dULL,
+    0x9fbf969958046447ULL, 0x9986feba69be3a81ULL, 0xa668b3e6d053796fULL, 0x97694e6589f4e09bULL,
+    0x37890c00b7721dbdULL, 0x5ac094a235f37ea9ULL, 0x31cff775f2d5d65fULL, 0xddad8e6b36505217ULL,
+    0x5a27df897062cd03ULL, 0xe2396fe0fdb5a625ULL, 0xb352a4957e82317bULL, 0xd8ab3f2c60c2ea3fULL,
+    0x6893f702f0452479ULL, 0x9686fdc182acf7e3ULL, 0x6854037173dce12fULL, 0x7f0ded1685c27331ULL,
+    0xeeda72e1fe490b7dULL, 0x9e7bfc959a8e6e53ULL, 0x49b314d6d4753dd7ULL, 0x2e8f8c5ac4aa1b3bULL,
+    0xb8ef723481163d33ULL, 0x6a2ec96a594287b7ULL, 0xdba41c6d13aab8c5ULL, 0xc2adbe648dc3aaf1ULL,
+    0x87a2bade565f91a7ULL, 0x4d6fe8798c01f5dfULL, 0x3791310c8c23d98bULL, 0xf80e446b01228883ULL,
+    0x9aed1436fbf500cfULL, 0x7839b54cc8b24115ULL, 0xc128c646ad0309c1ULL, 0x14de631624a3c377ULL,
+    0x3f7b9fe68b0ecbf9ULL, 0x284ffd75ec00a285ULL, 0x37803cb80dea2ddbULL, 0x86b63f7c9ac4c6fdULL,
+    0x8b6851d1bd99b9d3ULL, 0xb62fda77ca343b6dULL, 0x1f0dc009e34383c9ULL, 0x496dc21ddd35b97fULL,
+    0xb0e96ce17090f82bULL, 0xaadf05acdd7d024dULL, 0xcb138196746eafb5ULL, 0x347f523736755d61ULL,
+    0xd14a48a051f7dd0bULL, 0x474d71b1ce914d25ULL, 0x386063f5e28c1f89ULL, 0x1db7325e32d04e73ULL,
+    0xfef748d3893b880dULL, 0x2f3351506e935605ULL, 0x7a3637fa2376415bULL, 0x4ac525d2baa21969ULL,
+    0x3a11c16b42cd351fULL, 0x6c7abde0049c2a11ULL, 0x54dad0303e069ac7ULL, 0xebf1ac9fdfe91433ULL,
+    0xfafdda8237cec655ULL, 0xdce3ff6e71ffb739ULL, 0xbed5737d6286db1bULL, 0xe479e431fe08b4dfULL,
+    0x9dd9b0dd7742f897ULL, 0x8f09d7402c5a5e87ULL, 0x9216d5c4d958738dULL, 0xb3139ba11d34ca63ULL,
+    0x47d54f7ed644afafULL, 0x92a81d85cf11a1b1ULL, 0x754b26533253bdfdULL, 0xbbe0efc980bfd467ULL,
+    0xc0d8d594f024dca1ULL, 0x8238d43bcaac1a65ULL, 0x27779c1fae6175bbULL, 0xa746ca9af708b2c9ULL,
+    0x93f3cd9f389be823ULL, 0x5cb4a4c04c489345ULL, 0xbf6047743e85b6b5ULL, 0x61c147831563545fULL,
+    0xedb47c0ae62dee9dULL, 0x0a3824386673a573ULL, 0xa4a77d19e575a0ebULL, 0xa2bee045e066c279ULL,
+    0xc23618de8ab43d05ULL, 0x266b515216cb9f2fULL, 0xe279edd9e9c2e85bULL, 0xd0c591c221dc9c53ULL,
+    0x06da8ee9c9ee7c21ULL, 0x9dfebcaf4c27e8c3ULL, 0x49aeff9f19dd6de5ULL, 0x86976a57a296e9c7ULL,
+    0xa3b9abf4872b84cdULL, 0x34fca6483895e6efULL, 0x34b5a333988f873dULL, 0xd9dd4f19b5f17be1ULL,
+    0xb935b507fd0ce78bULL, 0xb450f5540660e797ULL, 0x63ff82831ffc1419ULL, 0x8992f718c22a32fbULL,
+    0x5f3253ad0d37e7bfULL, 0x007c0ffe0fc007c1ULL, 0x4d8ebadc0c0640b1ULL, 0xe2729af831037bdbULL,
+    0xb8f64bf30feebfe9ULL, 0xda93124b544c0bf5ULL, 0x9cf7ff0b593c539fULL, 0xd6bd8861fa0e07d9ULL,
+    0x5cfe75c0bd8ab891ULL, 0x43e808757c2e862bULL, 0x90caa96d595c9d93ULL, 0x8fd550625d07135fULL,
+    0x76b010a86e209f2dULL, 0xecc0426447769b25ULL, 0xe381339caabe3295ULL, 0xd1b190a2d0c7673fULL,
+    0xc3bce3cf26b0e7ebULL, 0x5f87e76f56c61ce3ULL, 0xc06c6857a124b353ULL, 0x38c040fcba630f75ULL,
+    0xd078bc4fbd533b21ULL, 0xde8e15c5dd354f59ULL, 0xca61d53d7414260fULL, 0xb56bf5ba8eae635dULL,
+    0x44a72cb0fb6e3949ULL, 0x879839a714f45bcdULL, 0x02a8994fde5314b7ULL, 0xb971920cf2b90135ULL,
+    0x8a8fd0b7df9a6e8bULL, 0xb31f9a84c1c6eaadULL, 0x92293b02823c6d83ULL, 0xeee77ff20fe5ddcfULL,
+    0x0e1ea0f6c496c11dULL, 0xfdf2d3d6f88ccb6bULL, 0xfa9d74a3457738f9ULL, 0xefc3ca3db71a5785ULL,
+    0x8e2071718d0d6dafULL, 0xbc0fdbfeb6cfabfdULL, 0x1eeab613e5e5aee9ULL, 0x2d2388e90e9e929fULL,
+    0x81dbafba588ddb43ULL, 0x52eebc51c4799791ULL, 0x1c6bc4693b45a047ULL, 0x06eee0974498874dULL,
+    0xd85b7377a9953cb9ULL, 0x4b6df412d4caf56fULL, 0x6b8afbbb4a053493ULL, 0xcc5299c96ac7720bULL,
+    0xadce84b5c710aa99ULL, 0x9d673f5aa3804225ULL, 0xe6541268efbce7f7ULL, 0xfcf41e76cf5be669ULL,
+    0x5c3eb5dc31c383cbULL, 0x301832d11d8ad6c3ULL, 0x2e9c0942f1ce450fULL, 0x97f3f2be37a39a5dULL,
+    0xe8b7d8a9654187c7ULL, 0xb5d024d7da5b1b55ULL, 0xb8ba9d6e7ae3501bULL, 0xf50865f71b90f1dfULL,
+    0x739c1682847df9e1ULL, 0xc470a4d842b90ed1ULL, 0x1fb1be11698cc409ULL, 0xd8d5512a7cd35d15ULL,
+    0xa5496821723e07f9ULL, 0xbcc8c6d7abaa8167ULL, 0x52c396c95eb619a1ULL, 0x6eb7e380878ec74bULL,
+    0x3d5513b504537157ULL, 0x314391f8862e948fULL, 0xdc0b17cfcd81f5ddULL, 0x2f6bea3ec89044b3ULL,
+    0xce13a05869f1b57fULL, 0x7593474e8ace3581ULL, 0x07fc329295a05e4dULL, 0xb05377cba4908d23ULL,
+    0xe7b2131a628aa39bULL, 0x9031dbed7de01527ULL, 0x76844b1c670aa9a9ULL, 0x6a03f4533b08915fULL,
+    0x1dbca579db0a3999ULL, 0x002ffe800bffa003ULL, 0x478ab1a3e936139dULL, 0x66e722bc4c5cc095ULL,
+    0x7a8f63c717278541ULL, 0xdf6eee24d292bc2fULL, 0x9fc20d17237dd569ULL, 0xcdf9932356bda2edULL,
+    0x97b5e332e80f68d7ULL, 0x46eee26fd875e2e5ULL, 0x3548a8e65157a611ULL, 0xc288d03be9b71e3bULL,
+    0x8151186db38937abULL, 0x7800b910895a45f1ULL, 0xaee0b024182eec3dULL, 0x96323eda173b5713ULL,
+    0x0ed0dbd03ae77c8bULL, 0xf73800b7828dc119ULL, 0x1b61715ec22b7ca5ULL, 0xa8533a991ead64bfULL,
+    0x7f6c7290e46c2e77ULL, 0x6325e8d907b01db1ULL, 0x28909f70152a1067ULL, 0xea7077af0997a0f5ULL,
+    0x7e605cad10c32e6dULL, 0x471b33570635b38fULL, 0xab559fa997a61bb3ULL, 0xad4bdae562bddab9ULL,
+    0x055e1b2f2ed62f45ULL, 0x03cd328b1a2dca9bULL, 0xd28f4e08733218a9ULL, 0xb6800b077f186293ULL,
+    0x6fbd138c3fd9c207ULL, 0xb117ccd12ae88a89ULL, 0x2f1a1a044046bcebULL, 0x548aba0b060541e3ULL,
+    0xcf4e808cea111b2fULL, 0xdbec1b4fa855a475ULL, 0xe3f794eb600d7821ULL, 0x34fae0d9a11f7c59ULL,
+    0xf006b0ccbbac085dULL, 0x3f45076dc3114733ULL, 0xeef49bfa58a1a1b7ULL, 0x12c4218bea691fa3ULL,
+    0xbc7504e3bd5e64f1ULL, 0x4ee21c292bb92fadULL, 0x34338b7327a4bacfULL, 0x3fe5c0833d6fccd1ULL,
+    0xb1e70743535203c1ULL, 0xefbb5dcdfb4e43d3ULL, 0xca68467ca5394f9fULL, 0x8c51c081408b97a1ULL,
+    0x3275a899dfa5dd65ULL, 0x9e674cb62e1b78bbULL, 0xa37ff5bb2a998d47ULL, 0x792a999db131a22bULL,
+    0x1b48841bc30d29b9ULL, 0xf06721d2011d3471ULL, 0x93fd2386dff85ebdULL, 0x4ce72f54c07ed9b5ULL,
+    0xd6d0fd3e71dd827bULL, 0x856405fb1eed819dULL, 0x8ea8aceb7c443989ULL, 0x34a13026f62e5873ULL,
+    0x1eea0208ec0af4f7ULL, 0x63679853cea598cbULL, 0xc30b3ebd61f2d0edULL, 0x7eb9037bc7f43bc3ULL,
+    0xa583e6f6ce016411ULL, 0xf1938d895f1a74c7ULL, 0x80cf1491c1e81e33ULL, 0x3c0f12886ba8f301ULL,
+    0x0e4b786e0dfcc5abULL, 0x672684c93f2d41efULL, 0xe00757badb35c51bULL, 0xd6d84afe66472edfULL,
+    0xfbbc0eedcbbfb6e1ULL, 0x250f43aa08a84983ULL, 0x04400e927b1acaa5ULL, 0x56572be34b9d3215ULL,
+    0x87964ef7781c62bfULL, 0x29ed84051c06e9afULL, 0xb00acd11ed3f87fdULL, 0x06307881744152d9ULL,
+    0x7a786459f5c1ccc9ULL, 0x1308125d74563281ULL, 0x395310a480b3e34dULL, 0x35985baa8b202837ULL,
+    0x96304a6e052b3223ULL, 0xbd8265fc9af8fd45ULL, 0x1b6d0b383ec58e0bULL, 0xc21a7c3b68b28503ULL,
+    0x236fa180fbfd6007ULL, 0xc42accd440ed9595ULL, 0x7acf7128236ba3f7ULL, 0xf909367a987b9c79ULL,
+    0xb64efb252bfba705ULL, 0x980d4f5a7e4cd25bULL, 0xe1ecc4ef27b0c37dULL, 0x9111aebb81d72653ULL,
+    0x8951f985cb2c67edULL, 0xc439d4fc54e0b5d7ULL, 0xe857bf31896d533bULL, 0xb614bb4cb5023755ULL,
+    0x938a89e5473bf1ffULL, 0xeac481aca34de039ULL, 0x14b961badf4809a7ULL, 0x76784fecba352435ULL,
+    0xefa689bb58aef5e1ULL, 0xb2b2c4db9c3a8197ULL, 0x2503bc992279f8cfULL, 0xd2ab9aec5ca1541dULL,
+    0x3e78ba1460f99af3ULL, 0x0a01426572cfcb63ULL, 0xbea857968f3cbd67ULL, 0x78db213eefe659e9ULL,
+    0x963e8541a74d35f5ULL, 0x9e22d152776f2e43ULL, 0x05d10d39d1e1f291ULL, 0x374468dccaced1ddULL,
+    0x8d145c7d110c5ad5ULL, 0x3251a39f5acb5737ULL, 0xa66e50171443506fULL, 0x124f69ad91dd4cbdULL,
+    0xec24f8f2a61a2793ULL, 0xb472148e656b7a51ULL, 0x0adf9570e1142f07ULL, 0x89bf33b065119789ULL,
+    0x8f0149803cb291ebULL, 0x8334b63afd190a31ULL, 0x920908d50d6aba7dULL, 0x57d8b018c5a33d53ULL,
+    0xea1773092dc27ee5ULL, 0xcae5f38b7bf2e00fULL, 0x2bd02df34f695349ULL, 0xddfecd5be62e2eb7ULL,
+    0xdbf849ebec96c4a3ULL, 0xda31d4d0187357c5ULL, 0xe34e21cc2d5418a7ULL, 0x68ca5137a9e574adULL,
+    0x3eaa0d0f804bfd19ULL, 0x554fb753cc20e9d1ULL, 0x797afcca1300756bULL, 0x8b8d950b52eeea77ULL,
+    0xfb6cd166acabc185ULL, 0x4eb6c5ed9437a7afULL, 0xd1eddbd91b790cdbULL, 0x93d714ea4d8948e9ULL,
+    0x3ca13ed8145188d3ULL, 0x829086016da89c57ULL, 0xd7da1f432124a543ULL, 0x7ead5581632fb07fULL,
+    0x35443837f63ec3bdULL, 0x89e2b200e5519461ULL, 0xe9ae44f0b7289c0bULL, 0x94387a277b9fa817ULL,
+    0xc84f1a58abfc2c25ULL, 0x71101d8e3c83377bULL, 0xc024abe5c50ba69dULL, 0x15de4eb365a65d73ULL,
+    0x09ed28a76bcca931ULL, 0x816bffbf4a00205bULL, 0x1f5c71543d558069ULL, 0xf25c64d0ec53b859ULL,
+    0x96c02c2ef1e0ff0fULL, 0x19a804816870a333ULL, 0x6de49add0971c555ULL, 0x528087e684c71aabULL,
+    0xa94152c269bcdeefULL, 0x0379450a3c2b6bdfULL, 0xd2cd38bafe5373e1ULL, 0xc29df2bea71d8badULL,
+    0xc15862775f302e83ULL, 0x1016af2fe55ede09ULL, 0x3d26dbd9d1910715ULL, 0x621dab2dfaf3dfbfULL,
+    0xb6f1d7ac287338b1ULL, 0x8d9e9f0c3f9e7fd9ULL, 0x60a93f8762e914bbULL, 0xb14371f247c159c9ULL,
+    0x6dd3b484471d4eb3ULL, 0xcd172f4701c1684dULL, 0x0372e686ed8bb537ULL, 0xbc07f7ca65c5b071ULL,
+    0xab2b6170c3f78d9bULL, 0xf3d74f461fe6f5b5ULL, 0xdbc13f4b31f3230bULL, 0xd1420716e3f1572dULL,
+    0xd5be2fd4d805464fULL, 0xc68b97c136943851ULL, 0x9e27918af7cfb473ULL, 0x5ec8ab6c36ac7f41ULL,
+    0x964076331dd90979ULL, 0x30198eff77b002d7ULL, 0x3af7cb9583ece011ULL, 0x34ce06f643d9883bULL,
+    0x79f767e528708c55ULL, 0x185332d2ef2313cdULL, 0x43b611b84c8332a3ULL, 0xc2e215e4f43bb63dULL,
+    0xf94b9dd22ce44e97ULL, 0xd895834a1db166a5ULL, 0x347d2f16d19b8d09ULL, 0x1b54d4dc45b7d98dULL,
+    0x117ac30d9a044877ULL, 0x0e10b78a67a526e9ULL, 0x92da68a818688a9fULL, 0xcf2b6c87f741f84bULL,
+    0xd264f9bd41e18ed9ULL, 0x733cbeaa97166d8fULL, 0xc9f475b021d22e81ULL, 0x731f76f2ec4c852bULL,
+    0xdaf6f0c978f69945ULL, 0x749c8ad20c61ec93ULL, 0x09307ff8bd3c1261ULL, 0x334a69fb5a486e2dULL,
+    0x1f36c7bf31578617ULL, 0x31ebbcc279ea6103ULL, 0x42e2aad119f466ebULL, 0x106ec05a0ab1450dULL,
+    0xb1b38db92a99e731ULL, 0x784ae377e67071e7ULL, 0x3e9e1471ba6671d7ULL, 0x82c29b59d4d73d0fULL,
+    0xc23dd07128b5525dULL, 0x4d4e5ce0e9245133ULL, 0xc8fd1057c09f8cc5ULL, 0xea1516e94f394035ULL,
+    0xb5e3319c564ee9dfULL, 0x126a69f90d822d8bULL, 0x501ed6348857aa19ULL, 0xde344a324eee1c83ULL,
+    0x1dd9690cb2c406d1ULL, 0x08d6c5178d5e4387ULL, 0x4cea4050a3e8fdc1ULL, 0xc114a06acc83f777ULL,
+    0x20b060ebc0ea01dbULL, 0xfe50045acb78c99fULL, 0x291a68705b196e91ULL, 0xc1042c724273e2bbULL,
+    0x2cee680bb165b7c9ULL, 0xfd2ff9f12e0776d5ULL, 0x166a5da63af2cc6fULL, 0xedd16a5930408d27ULL,
+    0x2adf30c26528844fULL, 0x9a48d6572b5eec7bULL, 0x6e8bf2877503cb9dULL, 0xea27a191a7045389ULL,
+    0x6eb091f34dd45d3fULL, 0xdc8a6cabb2937d41ULL, 0xbc2f04f254922a05ULL, 0x41431f4d6eb38631ULL,
+    0x7bd717435a08291fULL, 0x4232df9c91fc1a55ULL, 0xa4651e1d5382eab7ULL, 0x7cfb5409de4cf3c5ULL,
+    0xcdd636fb068b9929ULL, 0xee8f95e740462c97ULL, 0x490f97b3a758b4a5ULL, 0x641431563c441287ULL,
+    0xb743dad3ec45916bULL, 0x7b188be8f55c878dULL, 0xd805648b2ca54ef9ULL, 0x76dbe6eef60123afULL,
+    0x3711525e6a9e8867ULL, 0x85c2215cb383d8f5ULL, 0xe58f554c89825857ULL, 0x8fbd3b17c01dacd9ULL,
+    0x4c8c39dc7aedee65ULL, 0x653ac6dda86cd3b3ULL, 0x0d61c6791a9c2c81ULL, 0xb627a30090354237ULL,
+    0x83a89a539c527c23ULL, 0x28c8c09330e90d71ULL, 0xee1178d27b1f029bULL, 0xcecc740b37860ab5ULL,
+    0x79736fde910c485fULL, 0x6873d51f2487234fULL, 0x2a112180614fb973ULL, 0xcb04cea98508f4ebULL,
+    0xc2fcd2c527e28d7dULL, 0x980203ee10393c69ULL, 0x3fa90a1d7d75681fULL, 0xdbf3bfefef217cc3ULL,
+    0x66a17fd3087b41e5ULL, 0x962195d496fbbd3bULL, 0xc705a86155443e49ULL, 0x3f298ee0be6febffULL,
+    0xaa99b084e62fa613ULL, 0x1f000cb7d0b46fe1ULL, 0x9ed7858637c9b2cfULL, 0x4d871aaf27c106fbULL,
+    0x2e6a467cdc75a4f3ULL, 0xe9d938fb696dde8dULL, 0x40ec71b0b1554485ULL, 0x3aae12f861e5f3e9ULL,
+    0xa97565873959f843ULL, 0x0b5a960c09fbca8fULL, 0x463fe3d268012c91ULL, 0xe59a6bd5f5ee1bddULL,
+    0x6542e84d7775ce45ULL, 0x8b6eef58fd9effa9ULL, 0x58993dbb9f98075fULL, 0x2997955a810acf61ULL,
+    0x76e3d2f5077db451ULL, 0xb37c1d2867e30907ULL, 0x53ce6e09bd8d8695ULL, 0x39db291ea2a6b0e3ULL,
+    0xddd265ab9c58847dULL, 0x5beca8562dddd0cbULL, 0xb69031c153ddbed7ULL, 0xd03c2271b42a6fcdULL,
+    0xcd6fd19e63e40ea3ULL, 0xf7687aa8e4fd7bf1ULL, 0x649dfda112a272a7ULL, 0xecf7866a56d526dfULL,
+    0x72bbf1cfdaebfeadULL, 0x55f6a48df7055719ULL, 0x80060bffcfa00183ULL, 0x8a104f309919b087ULL,
+    0x98fa7db7652f6a15ULL, 0x5d7d1b3df70f7ac1ULL, 0x16ab7b5e04cc1f6bULL, 0x78a5bfd2e5ececf9ULL,
+    0x6506392e171d869fULL, 0xc3fc12e221ef146dULL, 0xf8aa132822c33657ULL, 0x894496574f536f43ULL,
+    0x8b2546b08fb4cbd5ULL, 0x043bbb561bd1aa7fULL, 0x2412c7cc4ea7a12bULL, 0x6f0bd406dd71696fULL,
+    0xad475c6988d54b71ULL, 0xd812e5d48dbbba27ULL, 0x22aaca437ba04893ULL, 0xdba6ff1fecd5f09dULL,
+    0x13016d3396286773ULL, 0xc746494631bcfa41ULL, 0xd14888565bf6a10dULL, 0xc002ef885f0adf05ULL,
+    0xe5a04da7fee6ade7ULL, 0xc114ce5468593bc7ULL, 0x0bb6747dd7f577b7ULL, 0x395ce5a20f285839ULL,
+    0x6eee8be66e8618efULL, 0x52acf64297f1241bULL, 0x361dcc48a364093dULL, 0x342d6f475d72e629ULL,
+    0x5e978bd46410d413ULL, 0xcc3433d75ba015adULL, 0x1c83b7628458d4fbULL, 0xf9ca45637e38f809ULL,
+    0xcbed792ffaf6b115ULL, 0x9abd961d8c0e8c8dULL, 0xe69572fa659340afULL, 0x9187e7483a6436fdULL,
+    0x1e9c726993bed9d9ULL, 0x243554db91976365ULL, 0x04d06ff994c0088fULL, 0x25b76abcb74889ddULL,
+    0x3a409642893c779bULL, 0x8f8f620d8bc0c927ULL, 0x6f9f196b3369855fULL, 0x92a522bb0638ed99ULL,
+    0x96270f1efdd7004fULL, 0xb4844b380fdaa79dULL, 0x108936aa5f9c1495ULL, 0x0b60f606f104c9ebULL,
+    0xc663dfe8263b302fULL, 0xc91a280b9110b15bULL, 0x0904287118d10969ULL, 0x160d36a5d31bf553ULL,
+    0xe84f5fda3c67ad21ULL, 0xbd85701f72d4b6edULL, 0x4c50cf5924dee1c3ULL, 0x2455aaf1633bb6e5ULL,
+    0xd775b39f549b8ac7ULL, 0x87fcdda7a252cb49ULL, 0x53df2e3bd254a739ULL, 0x8915e69623a5f7efULL,
+    0x1ef24c80742dd08bULL, 0xb4d87aaa6fb1e897ULL, 0x788573e8b92dbbfbULL, 0x02527b137b0878c1ULL,
+    0x1870a7c8dee9f4f5ULL, 0x39b99e40910a224bULL, 0x45821c0abd4df247ULL, 0x10fe2b2f50e02fb3ULL,
+    0x5762b90c043f0345ULL, 0x82a67b9193b27bbdULL, 0xa6e914e28ec37693ULL, 0x835d9a4facaf445fULL,
+    0x48def8175884f82dULL, 0xae900e2d7c9a6f7bULL, 0x1c08431bdd18be89ULL, 0xb370a66d684fd83fULL,
+    0xb4be33e18f93b279ULL, 0x310c50872a7dd5e3ULL, 0x447ab1281276697dULL, 0xc2f122216b2a6c21ULL,
+    0xab99c8b5ae1c3059ULL, 0xb78e17a2227d593bULL, 0xabf97d03f7269c5dULL, 0x867aefc9fdbfe7ffULL,
+    0xf7f7ad182e47d5b7ULL, 0x50dff95a9847721bULL, 0xe4cb8a0e83cb6a35ULL, 0x8da72ecdf9247a1dULL,
+    0xc5b04bfc87f31d87ULL, 0xe2dcf622ea2b00f3ULL, 0xb9ce9f2e4972f46bULL, 0x1ed785c911bf59f9ULL,
+    0x4ddb8a4eed70e085ULL, 0x81e93b4df68c24fdULL, 0xee0d0812afcd8357ULL, 0xf62e3ba72268a891ULL,
+    0x3194d367c8154147ULL, 0xd096ede8e30c20d5ULL, 0xd68624d27b87a77fULL, 0xb728fcdc11c8204dULL,
+    0x9d6b6038077e066fULL, 0xaa732d7a4a360d93ULL, 0x36af98a423972db5ULL, 0xc31d00da12940f17ULL,
+    0xed85352107410b25ULL, 0x829c85ee6db8567bULL, 0xef60258952cc6d89ULL, 0xcf28c2e0da787741ULL,
+    0x57567d8494af28f7ULL, 0x2c7c98518f174031ULL, 0xb28b363a36825ae7ULL, 0xed1ffeb64f9ae769ULL,
+    0xcbbb0115e9b9a31fULL, 0x8d3c5fecb7f9e4edULL, 0x816271698195cfc3ULL, 0x9ac939d1c2b1d35dULL,
+    0xdd9fb7017b0ec455ULL, 0xc94cab1e57276e3dULL, 0x8b8806b117c79913ULL, 0xa9e63292a3269fd1ULL,
+    0x76da5710f1e989fbULL, 0xdded6688d83a918dULL, 0x4e446b6a305428f9ULL, 0x4ddaca7a3696cfb1ULL,
+    0x7eadc4eb87f26ed3ULL, 0x76c13a0ff04c00c9ULL, 0xcbf800504d2a2681ULL, 0x0731dada6c4fec9bULL,
+    0xbcb52a664e63f627ULL, 0xf1f9abda071c2aa9ULL, 0xf262ffa620ffe20bULL, 0x93774a3d57199a99ULL,
+    0xfb3541cd467a1903ULL, 0x6828cab6b4fe8f51ULL, 0x12ac03e3d624cc9dULL, 0x6363bd1e9bb7d7f7ULL,
+    0x334cfd676a484d2fULL, 0xd511acd86f143a53ULL, 0x73fc2490e0062be5ULL, 0x10780dda36b78b55ULL,
+    0xabf601274064e0abULL, 0x3ef3e4ca27e4a2cdULL, 0x9216a26e690a16f1ULL, 0xbae4849e6034bda7ULL,
+    0xf943a0520e01e9e1ULL, 0x7c89958f48f6658bULL, 0xe67128750e0545a5ULL, 0xc6c9e1d414516ccfULL,
+    0x805307f996e9e81dULL, 0x3eddd2cff46ad5bfULL, 0x35582c1aeb5aae85ULL, 0x4973c88573ef6eb1ULL,
+    0x3063f627c1e715d9ULL, 0x711ad679a8dcc243ULL, 0x51c224a17a3db4b3ULL, 0x612325ca50ddaed5ULL,
+    0x9929a7b6b7958b37ULL, 0xa78d222e5a857bb9ULL, 0x3ad0ffe3198d139bULL, 0x08b4659ac547ed17ULL,
+    0x1752e8904aff1003ULL, 0x60745c37ee4e5925ULL, 0x29e2da1f6557ee51ULL, 0x80d78c24ac49cb89ULL,
+    0xc56c3b495c8d1f79ULL, 0xcf5bdf9f5088ac2fULL, 0x8a44800e4fae4e7dULL, 0xdd76384277e578e7ULL,
+    0x20b1562d2703facbULL, 0xef56caf96e9d8e3bULL, 0xf54061416aede033ULL, 0xe0bc78c21a26e4ffULL,
+    0x0524f92731a179cdULL, 0x5d3b4ad7deafec8bULL, 0x508828f744da88adULL, 0x6e82014031710bcfULL,
+    0xadf3b77a22595dd1ULL, 0x0d8f0c03f7ea8a87ULL, 0x2c49e3483c3a05f3ULL, 0xccecbc98c91274c1ULL,
+    0x273a08941bb71e77ULL, 0xdead5a1e3f341bafULL, 0x83eee092593309fdULL, 0x4af5f1bd3ae87ce9ULL,
+    0x4ca85ad2301c9e6dULL, 0x1b19592cd31a3943ULL, 0x3e7aa05e6dcd81bbULL, 0x86336cecb02ba47fULL,
+    0xa96b30d0c8a44b2bULL, 0xb7c63fa0cfca0571ULL, 0x8eaf59b405a642b5ULL, 0xdf29e9cbb536dc17ULL,
+    0xed14132c82c1d43fULL, 0xaf68778e34caab0dULL, 0xa4f04a3368941d31ULL, 0xe9960969357c07e7ULL,
+    0xeb47b62b7360b469ULL, 0x64c653d779ae730fULL, 0x479702d3319915c7ULL, 0xef3c3eebc6803239ULL,
+    0x93807b1a2e3c0e1bULL, 0x8167e33e3f478029ULL, 0x60cb76e38c339397ULL, 0xae34788ffe4bc283ULL,
+    0x4b6246a0c6c093a5ULL, 0x872e594b12b03efbULL, 0xbc0ae83ce9045b15ULL, 0x0ad30a3917e0968dULL,
+    0x124ef5a4e1c7cd63ULL, 0x5b98fe0e9fe17aafULL, 0x414306cfe45400fdULL, 0xa06d1b4fd391e8bbULL,
+    0x11939803a60c2381ULL, 0x668c11cc37ea6b23ULL, 0x83f9b2089dc10645ULL, 0x65dc8ae47af277a9ULL,
+    0x6e2368b9c685770bULL, 0x3ea137aeba5a6b2dULL, 0x735f57adca48f19dULL, 0x69a8de0ba1b18107ULL,
+    0x8fb84bdf5822bd79ULL, 0xb8fab3b748562721ULL, 0xa6c658ea10a65c3bULL, 0xe56381f33ab5e549ULL,
+    0xe3c224da14988139ULL, 0x438c253e6d99f513ULL, 0xc1b99f8841a3a6e1ULL, 0x63fa18c79c54fa8bULL,
+    0xe7f6f609619d0d1dULL, 0x7b39ef3b70afc109ULL, 0x73922c61ca7452bfULL, 0x28d96828332372c1ULL,
+    0x6b6e92968c4e8463ULL, 0x571861f084962edbULL, 0xd935c64f140f1ef5ULL, 0x96459f8fd72a4c4bULL,
+    0x410ba9a2a18242d9ULL, 0xcf90979f89870391ULL, 0x10f94ff26bc00addULL, 0xa6619fbb9da139b3ULL,
+    0x765a23334efb03d5ULL, 0x6f2f613b5e631837ULL, 0x666b99bfbcd368b9ULL, 0x922b78eb01ed45bdULL,
+    0x7079a199c31de6a9ULL, 0xa181abcda167be5fULL, 0x2f6dbbcab3a9822dULL, 0xc5a83ff0e43eba17ULL,
+    0x28c68613dda7d97bULL, 0x5cf33ed49efa5007ULL, 0x9125fdead661590dULL, 0xaee67f478c7325e7ULL,
+    0x735b1274a0e89653ULL, 0x733b56eae1a4e621ULL, 0x1944ffb316ffe65dULL, 0xf26bc3cfd2a01449ULL,
+    0xb5827ba68b83e201ULL, 0xac139507e48eefb7ULL, 0xeb7676b25834fda3ULL, 0xad898f4763da5c1bULL,
+    0xea906f224398f9a7ULL, 0xa8aff3caca28cdadULL, 0x46c53aa36b19b083ULL, 0x9ada32b09603e8cfULL,
+    0xd31f842ef5d8e915ULL, 0x6124af44730a33f9ULL, 0x828ec4c2b6e64a85ULL, 0x3d6f49df999638afULL,
+    0x7641460a0ea89b65ULL, 0x97703f98fb7fe291ULL, 0xd343c209e3e6b7b9ULL, 0x4e5fc01f6a41406fULL,
+    0xb78a05b08aa4bcbdULL, 0x3434a14919d34561ULL, 0xccead7dee120f525ULL, 0xe1375a2bccd87673ULL,
+    0xf727d51420a57141ULL, 0x2c3b68cfbcebb00dULL, 0xda91e2f3e17542f7ULL, 0xb55f6100ae95d6e3ULL,
+    0x6a0c608e0bbaa975ULL, 0xac5f2fc151c016cbULL, 0xb1e5af8146e4d00fULL, 0x6e283d3b112602c7ULL,
+    0xf9a48bcb76c96e55ULL, 0xa776780ca4c0e101ULL, 0x8d40a2d47d99c7c5ULL, 0x4ed9d8a7aedcefefULL,
+    0x55c5cf9586072313ULL, 0x62c640e386ef1f09ULL, 0xdb876e7feb8b02f9ULL, 0x5b85ac1558bdf263ULL,
+    0xb2b13930c2a889b1ULL, 0xdf53c897124f8c57ULL, 0x68a69390fdce78ddULL, 0x5a1e8f0261e6e7b3ULL,
+    0xcce38a9ccaab014dULL, 0xb0cd4811fe6a8171ULL, 0x911c24573e445027ULL, 0x9e86401e61cac4a9ULL,
+    0xfd2731405f265eb5ULL, 0x3f4c00205c05b02dULL, 0xe92e3d0a829a974fULL, 0xdec216e5aa47169dULL,
+    0xa0397bf3448bcd73ULL, 0x9ecf538d7efa905bULL, 0xb1037b5f84886421ULL, 0x941bb5a5e99e83d7ULL,
+    0xf35fb6cff87b10c3ULL, 0xde7a61b7b2a0913bULL, 0xffefff7ffbffdfffULL, 0xed39f9339c94d0f1ULL,
+    0x5e6857f5c89eba13ULL, 0x597ee5007793a235ULL, 0xae5b807b69974f97ULL, 0x5669491a56417c19ULL,
+    0x48e977afb0ef2fa5ULL, 0x1b645813a0b7dafbULL, 0x0c2cfc30747d8977ULL, 0x9caefaf424881885ULL,
+    0x96a2b427facd28b1ULL, 0x619e325a834a3b9fULL, 0xbc0258bd75db614bULL, 0x6c3a67a8d325916dULL,
+    0x744285b9383f6fd9ULL, 0x792d5f45b4c7b947ULL, 0x9afa9d0a8ec258d5ULL, 0xbc88d62b178355b9ULL,
+    0x08174acf9b79c361ULL, 0x5323b91ad88ada03ULL, 0x3ecca4146efa2851ULL, 0xc1eed34a7971e589ULL,
+    0x0de35e7852c78febULL, 0x0cd8e8a7b77e5e0dULL, 0xd64028de188224cbULL, 0x3aa0c760bda6f2d7ULL,
+    0x24cf602012773ce5ULL, 0xef7b5e9592df0e0fULL, 0x2724f615c53cea33ULL, 0x8d0445f29abedeffULL,
+    0x76a2b82410d295c5ULL, 0x2f9ec39ee294d11bULL, 0x3c49d6fc0e17e91dULL, 0x3d1b08cf9d5d6ec1ULL,
+    0xbee559fae482a0f9ULL, 0x3f41c760c30655afULL, 0x764c964ba0a416e9ULL, 0x4cbfc0ae9aa326d3ULL,
+    0x09782247fa7c7a9fULL, 0x461b34965141ebbbULL, 0x546ae72f730e1fd5ULL, 0x7c4183984c9caf4dULL,
+    0x443893efae8721bdULL, 0x2148abb7f4546e27ULL, 0x303b78ff41b00261ULL, 0x3eff7ecc31c1d54fULL,
+    0x5c8dd7d22ed3757bULL, 0xbafe5e4872a2849dULL, 0xa4deaba77a16ee41ULL, 0x6a57edc34ef54ff7ULL,
+    0xb0181d14018961e7ULL, 0xf2fa1f98ff613e75ULL, 0x164df29b02a033edULL, 0xc001e328b9aac659ULL,
+    0xf80401c48b6aaf11ULL, 0x59feffad1258c25dULL, 0xa663c3607f21c133ULL, 0xec984cea279318abULL,
+    0xa04683ec23600c39ULL, 0x8af765ad7ec08cefULL, 0x1ce90ab3bc8fe813ULL, 0x528a3d970b83e1e1ULL,
+    0x016f6125575d29adULL, 0xa5f962b7db3d8c83ULL, 0xc8d70658bc59f6d1ULL, 0xf9656c8dc7052c09ULL,
+    0xe1ef7ec2bbda1763ULL, 0x707aa6c7c667b4afULL, 0x3f4f300341cf6f4bULL, 0x08fb60d325fdd957ULL,
+    0x6b3af4d2fa2a52bbULL, 0x5194721cf6af1dddULL, 0xe15471c083b99d7fULL, 0xe11e724fe594864dULL,
+    0x50a1ba159b270337ULL, 0x90f7a3a7f007de71ULL, 0xa6b2f2dad15773b5ULL, 0xd961c5d3ceaa795fULL,
+    0x97503b970652a10bULL, 0x63ab4f5c61985b07ULL, 0xb10263a8d57b6895ULL, 0x0c40268f29a10953ULL,
+    0xd52a84beb78ca121ULL, 0xd70c4b500a8bcaedULL, 0xcb8bc0e50ea18ae5ULL, 0x72ea5984bbbb3ec7ULL,
+    0xf00ffea10823dfabULL, 0xc02dab1d24645b39ULL, 0x83a36d8d1ccb10a3ULL, 0x865ba87ec3351c97ULL,
+    0x3d51c4c905e32919ULL, 0xa063231a01a603cfULL, 0x7209600da2fc8ffbULL, 0x6cabe5c15791571dULL,
+    0x6ed50b8a2a21f78dULL, 0x5c39327c880705b1ULL, 0x93766ad6c0e618dbULL, 0xd7ff522f04c7f4e9ULL,
+    0x9632957db9a2764bULL, 0x3870b60df29df143ULL, 0xfd9b3e995b9a832bULL, 0xfae1b64336879b6fULL,
+    0x5b4f64dd92900fbdULL, 0xf36f28233aa65417ULL, 0x3f7d0af5b6813825ULL, 0x2dd65d861f364551ULL,
+    0xed16be65ff45cc3fULL, 0x913517022715630dULL, 0xa2f8fc6528c56679ULL, 0x7cb887131df1fd7dULL,
+    0x5f80678112d24c75ULL, 0xd80a7a37c96239cbULL, 0xcbfcc59631976b0fULL, 0xf4fc05acb7422d3bULL,
+    0x281d221bf7372e49ULL, 0xc45d9daa1a2708cdULL, 0xab8b955979fe47a3ULL, 0xebdb17947d9353a7ULL,
+    0x71c652b85552f829ULL, 0xf150b965bde7b819ULL, 0xfa82319db4c69315ULL, 0x6607c749f35debc1ULL,
+    0xf7abf1c5266a486bULL, 0x2b714da81f83b485ULL, 0x00f659777687379fULL, 0x83020f7045e2b757ULL,
+    0x49eb67e096416843ULL, 0x754b18ec3b5505c9ULL, 0x5ed330eb790d74d5ULL, 0x1bc8a6cff7ab9b7fULL,
+    0x6a228e8dc982344dULL, 0xf67e43e9d1492193ULL, 0xbfe5ca8b81debf61ULL, 0x8feefd5b137db24fULL,
+    0x5acccf96f3b6a99dULL, 0x4e0e1a4cb8968073ULL, 0xa318d4913a9bba0dULL, 0x1b3bc4508f1220e3ULL,
+    0x6c1874bc953c6805ULL, 0xca1e3d2f0a9d0ee7ULL, 0xc81f0bf7dbbe1b69ULL, 0x830652164c71d375ULL,
+    0x34b96716c144971fULL, 0xf15c8349a044675dULL, 0xea0f6b88dc19dcc7ULL, 0xc3fecf6822d44633ULL,
+    0xb1cac32b2858db01ULL, 0xc7a9cb1ec2d438b7ULL, 0xcd5160970c616d1bULL, 0x64019e0ad6156729ULL,
+    0xe4693042c08efa97ULL, 0x99cc8957f34f13d1ULL, 0xabb47c7edbd3da15ULL, 0xa09ee04e26608f6bULL,
+    0x18c6db9cc91c3c63ULL, 0xc1b56ec75d3fd1afULL, 0x65c3b47c020787bbULL, 0xb50c3d1d171e1a81ULL,
+    0x015bb06d814aa545ULL, 0x11e2755e2239c09bULL, 0x9e1319d4d99caa27ULL, 0x19489b7a1c7288b5ULL,
+    0x26ceda1f4fedb65fULL, 0x4725e236a2a1ad03ULL, 0xd4d56ad761730351ULL, 0x72debea0f35c3d95ULL,
+    0xef77488300a94f05ULL, 0x4babae383b08c12fULL, 0x5c809ef3fa660a69ULL, 0x81baac7f3f62de21ULL,
+    0x715e37ffca0e2bc7ULL, 0x087ad341dcf98c49ULL, 0x82973cf13e92b6cdULL, 0x51a4ff653a46b5a3ULL,
+    0x3f021364229408efULL, 0x8e1687c272db793dULL, 0xa1e74f3c2750e997ULL, 0x6be32c934626d619ULL,
+    0xcaffd118fed27c1dULL, 0x3e2cf01f6379c2f3ULL, 0x53f4cf2f3f24c9bfULL, 0xde6ab42333c8f363ULL,
+    0x0ef38db642bf0ddbULL, 0xc14f750f8414c1e9ULL, 0xfca3e0a430a71b6dULL, 0x89196248031fc9d9ULL,
+    0x54be5ab3afc1f88fULL, 0x82d879344fefc8b3ULL, 0xc4ae6c822b2a1981ULL, 0xc06f57bd51a9d82bULL,
+    0xed53be205080386fULL, 0xc2affc451c004f93ULL, 0xa095f848b4d5755fULL, 0x9c1110a019a62d25ULL,
+    0x4f61a68a73d0f87bULL, 0xa3aaa877162939ebULL, 0x645900cc9d46d379ULL, 0xd9f3ad9d2aeb8ee3ULL,
+    0x6520bb0fe391e27dULL, 0xfd110f4f617ee175ULL, 0xe944dc600f9dc80fULL, 0x7dc794305c68d55dULL,
+    0x2f40082faf5d80a7ULL, 0x13f336257ef04529ULL, 0xadf2c9bfe0fc331dULL, 0xb589d4991af43e87ULL,
+    0xe288f19faa816985ULL, 0x19dca71f9be8b4dbULL, 0x62308f9914d29dfdULL, 0xdd26efec163ff49fULL,
+    0xd72e59739b6fcd43ULL, 0xb14b8f482930fa65ULL, 0x57e9159f6b8e55bbULL, 0xbcf3f6c6cf52e247ULL,
+    0xe867194b2c07987fULL, 0x7e8c1d348619ebbdULL, 0xcf72338efc3ce693ULL, 0xc9a64859770696b5ULL,
+    0xb2a71a33e6ae1017ULL, 0xed67240f6c078f4fULL, 0xbe7b7a7f0148df7bULL, 0xc75b758a3bc3ae89ULL,
+    0xed1bd8a86fafe841ULL, 0x34b4234dac2abf0dULL, 0xdef9319a487b9131ULL, 0x127a3231307655cbULL,
+    0x80367d8ef65be70fULL, 0x6ab7ff001331c2abULL, 0x3fa1aa1bd4bac5b7ULL, 0x3a4d0d5ba89c66c5ULL,
+    0x4d3b50a01a59e21bULL, 0x6bc40edc5e737213ULL, 0x07a07d388dc553dfULL, 0x469f5625ba795be1ULL,
+    0xc376f4adde3630d1ULL, 0x042cd53ad317af15ULL, 0x8a4637ce8127c7bfULL, 0x3b5a1532e97c49f9ULL,
+    0x53b021bbb0ba20b1ULL, 0x8394a7698980c7d3ULL, 0x1f63d185a93cebf5ULL, 0xa1e436953c807ba1ULL,
+    0x418a6ebc74547357ULL, 0x6136d92b2e7e67ddULL, 0xf709b3e898481781ULL, 0x37b41e737295d727ULL,
+    0xfaa86f45b15ef35fULL, 0x3c9e35f6ea77dc73ULL, 0x6a2a5e360d671295ULL, 0x8a516a5ec3906741ULL,
+    0x21bf7de7f343d07dULL, 0x06d48bbd1e09d769ULL, 0x9fb5976327879353ULL, 0xfd61cb9760dd931fULL,
+    0x8637f477889074e5ULL, 0x802ede94c2ff18c7ULL, 0x1a10d30fc6a689abULL, 0x3d17c4e7fcaf3bcdULL,
+    0x076713b3261be7f1ULL, 0x4c6b13f62d5e9ae1ULL, 0xc12f60ebb3ab4e8bULL, 0x2afc63359ae646bfULL,
+    0x09b6fb530614b077ULL, 0x08951e25c35172f5ULL, 0x10a50bc3cc7ee06dULL, 0x007ba4237342f6d9ULL,
+    0x32bb55fe36c9558fULL, 0x9a16561cfe6e9eddULL, 0xfea6a6d82e0f2d2bULL, 0x5e6b7280bc054c37ULL,
+    0xebe86b38dc06d56fULL, 0x94088e7b34781493ULL, 0xf4b5b35edca9fa61ULL, 0xb7414747cf05ee17ULL,
+    0x1255de8b88198903ULL, 0x0fc30f671354c63fULL, 0x31d49026b21b0eebULL, 0x59c9a3c6264bc77dULL,
+    0x950b668ec855d9e7ULL, 0x41d204d2916463cbULL, 0x0d93a0149d933e59ULL, 0x890721b3d1589be5ULL,
+    0xa232341c51e8973bULL, 0xb03ed9ee9ee3d601ULL, 0x7103bb43aa88301bULL, 0xa70693d6df71e835ULL,
+    0x8adb021c9da5e1adULL, 0xa51c90cbae5b5ccfULL, 0xa168c71bc5aaacafULL, 0x64f0ab37c5fb82fdULL,
+    0x6697f17637a6b19fULL, 0x7f4ddd231345776dULL, 0xac49150d6a043243ULL, 0x487ac16b8d726f65ULL,
+    0xd39e1843a8458abbULL, 0x25df3583c07cf42bULL, 0xcacc04fbeeca6bb9ULL, 0x04ad78bf9e376d23ULL,
+    0xb9b398c86c61f527ULL, 0x16bd48a143a7abb5ULL, 0xd0e1d422bc54bb89ULL, 0xdc9d8bb0866c8a73ULL,
+    0xe5944e779233c40dULL, 0x52a97b9e866fd205ULL, 0xdd42fafbead0fd75ULL, 0xe4f3b63968346acbULL,
+    0xd72d8d50ebfc2dc3ULL, 0xe4baf3d213b38611ULL, 0xe402b2eb214b5033ULL, 0x18bf7bc35c48571bULL,
+    0xd5fc6e6649ec9497ULL, 0x05e17c135b0f4dd1ULL, 0x6bc1af1e70bbc7fbULL, 0x631a1c726f858415ULL,
+    0x05b03958a1dd44bfULL, 0xbad1f6fdda128663ULL, 0x614d3c84e81a0bafULL, 0xefb50b3d21f279fdULL,
+    0xf8193f5f4cdf14d9ULL, 0x9ccbd7902d519665ULL, 0x9c77ffd0d8f9938fULL, 0xdc0d85f7dbc0fbb3ULL,
+    0xbf1c384d55c30f45ULL, 0x0f1862ec106d0427ULL, 0xf4880ff6d33ff8a9ULL, 0xf4677da6abeb600bULL,
+    0xe86676d2d6f6c42dULL, 0x1d86032928a7a899ULL, 0x02c4366a219be795ULL, 0x416ec05ef9b8b905ULL,
+    0x55593883049fb7d7ULL, 0xdee48ffee834a4c3ULL, 0x41aaac9bb9a5653bULL, 0xda2886727af0a649ULL,
+    0x43c49edc49338955ULL, 0x704bf0778a752239ULL, 0x89dca353f4d542efULL, 0x1adab0980d9bcba7ULL,
+    0x4100a83461f7e38bULL, 0xe28dff97b5389acfULL, 0x07bc7fda5be2c61dULL, 0x935864c348d60209ULL,
+    0x2f1785fa1461e3c1ULL, 0xfdd5bc4bb0297f67ULL, 0x350916589e345be9ULL, 0x6c54c161128823d9ULL,
+    0xecb9f1d4dd636d47ULL, 0x2df936cdde9c1381ULL, 0x0b6e61b15a08d937ULL, 0xd83940b9381bd19bULL,
+    0xddf532abcd59ef5fULL, 0xa10c9a16848e1725ULL, 0xcffd7e8e98fa627bULL, 0xc213026497ce7107ULL,
+    0xea0df9b45187d8e3ULL, 0x7e8f7fcf70195a2fULL, 0xbfe2097f4683ef53ULL, 0x628824e638321721ULL,
+    0xd4cd67eda48678cbULL, 0x97753beb6cf36b59ULL, 0x8fcfedd70194820fULL, 0x529b6f8b0316d2ffULL,
+    0x33bf0fca57fdb0b7ULL, 0xd3aacad2a015fd35ULL, 0xace997f8057f0edfULL, 0x8dce9bc7aa9223f3ULL,
+    0x32cb2134f56ac76bULL, 0xcc97a942c13854f9ULL, 0xd2db7766e3dad385ULL, 0xcd3a3e2ffef136a1ULL,
+    0x5c8008758c153c6dULL, 0x354ca5ed8f04f391ULL, 0x0e2fd4c7d87858b9ULL, 0x11c20b5b3932c0b5ULL,
+    0x3abc15208056f661ULL, 0x638fc7954c74c699ULL, 0x0a7014a82496497bULL, 0xef0b4fa8d60f189dULL,
+    0xce1ea1b92ab6c90dULL, 0x605b92dcf06183f7ULL, 0xa9f42c14dcc1b25bULL, 0x7fba3d42350fce1fULL,
+    0x85c57093d043d201ULL, 0xb78a4a7594286cabULL, 0xf4b3ce609841dfb7ULL, 0xbd76fa33b9bad0c5ULL,
+    0x0bbc6784f4f54e29ULL, 0x054fe5fb45f7cddfULL, 0x3487d58656ba3dadULL, 0xf09a3181a81e51a5ULL,
+    0x9ee617291ac67cfbULL, 0x3e19ec22e16ce787ULL, 0xc1696197c3f16009ULL, 0x1af6e582e300c1bfULL,
+    0xf5304617434e9d67ULL, 0x3765e2f6a8bd51d3ULL, 0xe3da2ebbc082f08fULL, 0x70ab1c82ea6adbc9ULL,
+    0xc4514c1226ed917fULL, 0x90cca52d8cfe9a4dULL, 0x14f4af4a44c01f9bULL, 0x03223c2451223127ULL,
+    0xe5b84dbeff3fc7b5ULL, 0x214cc8f520f4f50bULL, 0x73e5d840a8c4092dULL, 0x8c3d6cb13fb75a51ULL,
+    0xa237def2cace0f07ULL, 0x186cff099a7d6141ULL, 0xd84f35c886fb71ebULL, 0xcd670dc8256f6e05ULL,
+    0xfa77fb0b98b8595bULL, 0x2dc1304ab55b04d7ULL, 0x7686a91a892209c3ULL, 0xb55432f521d645cdULL,
+    0xf25451e56c940f39ULL, 0xa6e946ae189da4a3ULL, 0x41d7d80e729aa1f1ULL, 0x12eadb13be985097ULL,
+    0xf99338c396bddd19ULL, 0x929cba50092460c1ULL, 0x94a3109b5d460b8dULL, 0xd331b61ebe996263ULL,
+    0x53468c6ba6c8a185ULL, 0x1b07e212e4e279b1ULL, 0x76ed63cf6a462c67ULL, 0xd755268f25c20f8fULL,
+    0x04a826f0c3e1e8ddULL, 0x82232aa4609d01d5ULL, 0x8ac9e0cd74f01081ULL, 0x8ed955fa91dbd72bULL,
+    0x6c8dccd45287202dULL, 0x623df867e2a15303ULL, 0x416e4b9945e0177bULL, 0xc29ca7145480b8ebULL,
+    0x464d195f3be2772fULL, 0x6573564478608931ULL, 0x7801d6c034283453ULL, 0x1b53ed324a00a075ULL,
+    0xc0df1ee014b573d7ULL, 0x0a697468becb85e5ULL, 0x1e71a4b5befbc45dULL, 0x2fc6f7aec97d6249ULL,
+    0xd050fe5008ffd001ULL, 0x802d49118b3f9ec5ULL, 0xfd8722cbf5f1ff8bULL, 0xecfae9adbb9a6c19ULL,
+    0xcc26145dfef68587ULL, 0x937ab927154b28f3ULL, 0x576a88adf69b4cfdULL, 0x554c822407dc17e9ULL,
+    0xc40c534cbe817fd3ULL, 0x6ac0436f4bd7eb57ULL, 0x61d9a4f651759091ULL, 0x0d9dad30bfc739c9ULL,
+    0x7df2ad5c89aec8d5ULL, 0xac13357140dc484dULL, 0x69dae56af7899071ULL, 0x7f93f9fd52f91abdULL,
+    0x21445d2e3da4030bULL, 0x1245025d032f7399ULL, 0x0f4fa7a9cc3cd589ULL, 0x0439d9cd544b3f3fULL,
+    0x541dee92e99790f7ULL, 0x1584fd8fa5d2b4e3ULL, 0x29d9c66ff8762831ULL, 0x88c608f7d497c2e7ULL,
+    0xe41c3cd023af8b1fULL, 0xc8c7732016e80cedULL, 0xfe8c8ece4790fe0fULL, 0xc1a0d1b75bda5a33ULL,
+    0x3832760739e96c55ULL, 0x1c86172327a4c1abULL, 0x7ee8b0b086c2ad39ULL, 0x5049f99ac5ee9b29ULL,
+    0x2c7458d3d9d092e1ULL, 0x7e9605fb3d422e97ULL, 0x6885e31554e646a5ULL, 0x4b452ceb18516d09ULL,
+    0x9f64bf62cc7fe36bULL, 0x61526231cec2b98dULL, 0x11df6b567ba0d063ULL, 0x146b87816d9daaf5ULL,
+    0x2019462193bc32a1ULL, 0xf92881100d475a57ULL, 0xe29a3605384e8065ULL, 0x05282466a6985bbbULL,
+    0x8f9b77811f0d8e7fULL, 0x279fa4f87988af71ULL, 0x96bba13cca0692a9ULL, 0x7199d361c2c6aa5fULL,
+    0x588fdb97b0e70299ULL, 0xad6e2e159d077751ULL, 0x77a14f09627d46ebULL, 0x96cfc3e46ff03ff7ULL,
+    0xaafe934132f37f7dULL, 0xd949c0d13eae6253ULL, 0x910e29389fc1d3e5ULL, 0xcbdd03f15985dfc7ULL,
+    0x4b018007ae3bcdffULL, 0x562ded7e3614fc39ULL, 0x092001eab7050d3dULL, 0xd55113069bae25a7ULL,
+    0xd11b32c8f1da2035ULL, 0x8e066b6045898a19ULL, 0xbc75ac3a145b101dULL, 0xbe04ce7bfa5bf5e9ULL,
+    0xad339ae5041c31f5ULL, 0x84931a2d72cfdf4bULL, 0x078e8c62eed7ea43ULL, 0xe5d8c7b549b36c8fULL,
+    0xd5fbead55ea28dddULL, 0xad90fdf57f654747ULL, 0x924b50f64601dcb3ULL, 0xcf92cd893053e045ULL,
+    0x52edc20f748c01a9ULL, 0x5b026e087e96695fULL, 0x0af500e36ec65517ULL, 0xb0470a33bd9e0125ULL,
+    0x925f812256fbcc7bULL, 0x09304a23d8f54b07ULL, 0xb73e15c72c208779ULL, 0x4d4139be84bc22e3ULL,
+    0xfac3c118e5b9942fULL, 0x343521e808076631ULL, 0xa37bec97e019c559ULL, 0xa3fbd64ad093fae5ULL,
+    0xafb45119b137363bULL, 0xcc1c03d85ef3ef49ULL, 0xcf7013c10da8cab7ULL, 0x37324ef3e5a4b0adULL,
+    0xd52e2463d3fcf383ULL, 0x4790dee2488ff3cfULL, 0x3b12ec55b0fcc71dULL, 0xa801b78987ee5cc1ULL,
+    0x120f043160e78677ULL, 0x20d47ad484ccc4d3ULL, 0xe70161d151eee89fULL, 0x79f59c82a7d03857ULL,
+    0x1df35bc6fa256143ULL, 0x9719b6f504af29bbULL, 0x097b1336ce48c6c9ULL, 0xb30fe77456c38c7fULL,
+    0xc38247f1de06f32bULL, 0x761cb47109967061ULL, 0x9d4a8a3c26a7980bULL, 0x6b7f4639f02ba825ULL,
+    0xef065c609793e289ULL, 0x8d617121adb9dc41ULL, 0x061eda861c61d9e3ULL, 0x26700855fba39c5bULL,
+    0x4d50742eeb905cc3ULL, 0x94c874e6a4fe5d11ULL, 0xcf3d2fd673c1c155ULL, 0xe6fb8edaca8fcc01ULL,
+    0x0c1a0c2db7bc3aefULL, 0xbe61d26945d7b61bULL, 0xb6c5aad056e9e829ULL, 0xece774213d828613ULL,
+    0x63830dfff631c187ULL, 0x3202904a6238be8dULL, 0x04034965902328fdULL, 0xb3a71e8ce30df767ULL,
+    0xf19b66e8631bed4bULL, 0x844894d37c589bd9ULL, 0xb5b93bb8f75bf565ULL, 0xde49c8f4dba40b81ULL,
+    0x24c0393f96079323ULL, 0x97faac6437520c71ULL, 0x84fdd03233268b27ULL, 0x34aad4d603aff1b5ULL,
+    0xd6f37b69a20c932dULL, 0x9eaa08b18337a24fULL, 0x4c32e67e305bf073ULL, 0xde33dee277162579ULL,
+    0xba8b10a3dd3e435bULL, 0x13be43d0b8e00f21ULL, 0x2face3a5dcd43c11ULL, 0xc5b672896806caffULL,
+    0x22d371d484f7e939ULL, 0x2797dfe7498452a7ULL, 0x48d35268a4ee3535ULL, 0xff52b022001ce2a5ULL,
+    0x788260bb1206cdfbULL, 0xd5ce5de4c28cdbf3ULL, 0xc2808dcfaa5f5ac1ULL, 0xf6b73ee3827c33b1ULL,
+    0x3cd487f80f21f46dULL, 0xbb178fdc5df2c98fULL, 0xbc730ab8d683eb91ULL, 0x550bea143cd33447ULL,
+    0x94e53e18f19561b3ULL, 0xdf3ec2ebd3cdabd5ULL, 0xbe575bacf0ce0a81ULL, 0x7eb3c12e5e011545ULL,
+    0x1064acbed1ad496fULL, 0x482f9d3090c84ea9ULL, 0x34de243a47132893ULL, 0x2a53f27ff410ee61ULL,
+    0x4eb6423d19b5b807ULL, 0x0f5eec4b1ad0ad95ULL, 0x544dc5e97c9aba3fULL, 0xbd5aa405223e62ebULL,
+    0xb24b9b04ec375b7dULL, 0x9de196f4ce13ca75ULL, 0xc02e4e53ab7a0dd7ULL, 0xadc02e47754f990fULL,
+    0x390433c2519026cdULL, 0xd9a628173f5b57b7ULL, 0x0e1345c8d8797af1ULL, 0x6cab580e09dd298bULL,
+    0x71fc1ff5f62562d1ULL, 0x5d166a00421dec1dULL, 0xc65273226fe35f87ULL, 0x02d240351b4f32f3ULL,
+    0x32888929744bf285ULL, 0xa6c032ac629f20afULL, 0x213eade1c6297ddbULL, 0xf37ceb016ab3b1e9ULL,
+    0xfc945dc94f46eda1ULL, 0xeffe87a75a51c643ULL, 0xbb857c0a5cdc4365ULL, 0xc029118bb9860123ULL,
+    0xc56706df937e286fULL, 0xa61b4065d6309d25ULL, 0xa4042b6076cae04fULL, 0xe4715f270d2cef89ULL,
+    0xbef4370888609e73ULL, 0x1147e0e7d24ea605ULL, 0xcf9ecd85bcc1e231ULL, 0xabef9a436008becbULL,
+    0xc974d3c39c460159ULL, 0x400f230f0bc56ac7ULL, 0xc87a071724d0c901ULL, 0xcc569987ea9f6babULL,
+    0x80278b420edd86b7ULL, 0x57735305c9f54b13ULL, 0xdb86de8814ff38bfULL, 0x342e3f001728c38dULL,
+    0x15febbdcc3b66af9ULL, 0x50423f19ba767fafULL, 0xff0f8d44549ad4f5ULL, 0x7e9e5d1163a8aca1ULL,
+    0x25c6e9274aaba0ddULL, 0x6ae3f1a81a17887fULL, 0xee12099ce22be345ULL, 0xc77461461d95b40bULL,
+    0x8a56eb9bbfae5c99ULL, 0x144c8670a1d10b03ULL, 0x4746002de3ed9279ULL, 0xd6e06c532d95497dULL,
+    0x3c7f14073b1e441fULL, 0x0c67e4f8c2a1d911ULL, 0x1d9928202c0a393bULL, 0x2a2fec45f8f5b9c7ULL,
+    0xebe65db7a1e3d4cdULL, 0xbb5b32a855ca93a3ULL, 0x603075ba9fbd4be1ULL, 0xe13c04c4ccc582fbULL,
+    0x143a91b6183b5a1dULL, 0xfa46a4dc12d7d7c1ULL, 0x291081ed8e3df177ULL, 0xdeb12e2236bfd163ULL,
+    0xf9b70794c382cbdbULL, 0x02182cba82d03367ULL, 0xd59120a898d8239fULL, 0x0595ed06ca9bb96dULL,
+    0xe1dbbeb84080268fULL, 0x6dddbc0012248891ULL, 0x900c2df4d8e500d5ULL, 0x1e76c78b96f9e66fULL,
+    0x3ffa58971a069ba9ULL, 0x0578d31cb811ef17ULL, 0xf6ddd8c042942507ULL, 0x4a6c7943218e860dULL,
+    0xe14e2bfd88d96179ULL, 0xbbe965d54b91ce2fULL, 0xfacf2c01c273407dULL, 0x17c03dedaaf43ae7ULL,
+    0xac9b63e8033c5f75ULL, 0x8dc1de357b670b21ULL, 0xd9e820c451eacccbULL, 0x183651cb8a4ec6ffULL,
+    0x9b9a768da3b0c701ULL, 0x98f11094c1ca5135ULL, 0xe48129f3b6b3be8bULL, 0xddaa7f5c7c1b3aadULL,
+    0xf8879e7314857319ULL, 0xb244960b0463adcfULL, 0xbb37a5030eb16615ULL, 0xa9dff79dc55956c1ULL,
+    0x7a48d7fbac05a785ULL, 0x264e1312f3b54ed3ULL, 0x515e460c39e42b43ULL, 0xfd567e494091e0c9ULL,
+    0x6edff0f889a0c7d5ULL, 0x8fa85d9d9ebb9d2bULL, 0xd4e6da83d4f8a623ULL, 0xbc3c1ac07049a771ULL,
+    0xf1b0a28cfb4249bdULL, 0x44d8fe480ab18493ULL, 0xbf46899ac41dea61ULL, 0x0deda60c09a4de17ULL,
+    0x43860634ce28bd4fULL, 0xe0df80ff1db91d7bULL, 0x3f11a6a75d2ca373ULL, 0x2e220babfa1cb63fULL,
+    0xc749b7fe7a3f5b05ULL, 0x904e40e0877de675ULL, 0xbe2c641cf2fe5bedULL, 0x06fe1e3713f126c3ULL,
+    0xfe83fa8ba484150fULL, 0x43ad8ef6415de933ULL, 0x28e366ff161dc0abULL, 0x4d73de74eb5aa01bULL,
+    0xe5fc2d859640c53dULL, 0xf94e9c9aa484c1dfULL, 0xa7f8fbe3ddf39597ULL, 0x06c6034432f4b483ULL,
+    0x031c44ceb27aded1ULL, 0x2db7a4301a133f63ULL, 0xe08d061665234eb1ULL, 0xbcc62a30907e65d3ULL,
+    0xa163b2844190174bULL, 0x50454ff207284157ULL, 0x5e71d1d25e94df65ULL, 0x67779828164d0fc9ULL,
+    0xf3fd0faafadb6b37ULL, 0xfca8678a003d1d2dULL, 0xf5b86f6be4850999ULL, 0x0a451d1b55e3c307ULL,
+    0x7214828ae02e4205ULL, 0x6fcf51ac568d2e7dULL, 0x80ecf5ff15368921ULL, 0x751fe78cacd9f2edULL,
+    0x0f6da082e4d39dc3ULL, 0x04bb9e7e0a6a6e3bULL, 0x3f740a3d44333255ULL, 0x11c6b079323e87abULL,
+    0x22559090ebf015f1ULL, 0xd8ead59e3e17a713ULL, 0xbc629076ca9308e1ULL, 0xcef60a3f5840cc8bULL,
+    0x28520f835abacca5ULL, 0xd72776146e6e4309ULL, 0x4928460d880a1f8dULL, 0x20e317500495c0dbULL,
+    0x6fc3e132cd665ce9ULL, 0x9577780aa518e09fULL, 0x8541dcf952372591ULL, 0xab3fdea4fece6bb3ULL,
+    0xee2fa08b48f40481ULL, 0x69621395c6ecaab9ULL, 0x5abadcaf3804b293ULL, 0x46cc0e27f3ca205fULL,
+    0x2c3ed6c5bcf8342dULL, 0x7be26dbc5ff4bc17ULL, 0x5894224072c0e025ULL, 0x64cbb391f1909207ULL,
+    0x1ff29ad0cc695a89ULL, 0x0ab9d6890b540cebULL, 0x271e49b0062791e3ULL, 0x38ca5a3e2827fd31ULL,
+    0x13226894432de7e7ULL, 0x3fd42da01b414821ULL, 0xeb7e9f558b7ae1cbULL, 0xb57adf0f4b56585dULL,
+    0x95fe3bb431efc3ffULL, 0xb789bdb44e0fc401ULL, 0xabc12fbe306472c5ULL, 0x3c4441fe5e5434f1ULL,
+    0xbe2a4da6802cbba7ULL, 0x22fefc41ef003fdfULL, 0x21c287dee36d2019ULL, 0x87f2946352ee361dULL,
+    0x354d0399d878f06bULL, 0xb2a5d8d5b36d5aafULL, 0x661929fd617d67dbULL, 0x8678520c185293d3ULL,
+    0xaf150307b30a156dULL, 0x5672a28056dc9043ULL, 0xa20eca8b13ac0491ULL, 0x3fa61c95f7d65c4dULL,
+    0x8beb2f86ae9bf9b9ULL, 0xbd2838a4a5e70327ULL, 0xf689462fd8b1ab17ULL, 0x1334fe01beffd19dULL,
+    0x61b3a63fd6e9333fULL, 0x51045c3495dbc4f7ULL, 0x94591ee571d59c31ULL, 0x5c34e7cc57de7b75ULL,
+    0x34b7cc5990fa7f1fULL, 0x543eaee3a94b3411ULL, 0xaa25b1a0809944c7ULL, 0xf55cd9dc1af215abULL,
+    0x138223377215d9c5ULL, 0xbe385606b5e7cf29ULL, 0x08b8fddb2dacd513ULL, 0x580e0146b21afedfULL,
+    0x360029e0f36b86e1ULL, 0x76daae6a596a1aa5ULL, 0x44515fa3732605fbULL, 0x6c1c6caa9cba0887ULL,
+    0xfdf58487e92432bfULL, 0xc2ffda640fff376bULL, 0x08300d485ac3c18fULL, 0x8b067e4026892fbbULL,
+    0x3a063739bf66eaddULL, 0x06f238b548aa9cc9ULL, 0x08af8911633c19b3ULL, 0x129457d78ebc334dULL,
+    0x717040b5eada2371ULL, 0x53ed19ccb9ae1227ULL, 0xbf9d51ea063330b5ULL, 0x6607c04dd610d503ULL,
+    0x943116d7a61f394fULL, 0x473941215e0a889dULL, 0x7015834bed45ff73ULL, 0xa961ca982f48d241ULL,
+    0x1a17250c38426c79ULL, 0xc4abf3403f29a92fULL, 0xd856a6d06580a33bULL, 0x78343dd9facedecdULL,
+    0x04c9a0aabdecb039ULL, 0xd05e1ac7f8e8f0efULL, 0x763e8bc0e80272f1ULL, 0x96da78c781a67435ULL,
+    0x2676ac7d9811618bULL, 0xc8a49b67af0c3e19ULL, 0x769596dc1717c8cfULL, 0xf37de6e31be4ecfbULL,
+    0xd709e938e97ed1c1ULL, 0xaa115b4202578d67ULL, 0x4e86bd7ed680334bULL, 0x5c927cb8f3bd436dULL,
+    0x2f7b92d18ed0fb47ULL, 0x9fbbe88372a20181ULL, 0x5ed6a87865342737ULL, 0xc8fa3c632ffb2561ULL,
+    0xa00dc6619ab26789ULL, 0x89079235e80f2c95ULL, 0xb390a1699592313fULL, 0x1bd1cb22251fe1ebULL,
+    0x87b7fd9414d6900dULL, 0xedf03b60891a3b79ULL, 0x9a914a3c80c594e7ULL, 0xedf97a2328f78d53ULL,
+    0xda901e47c9ed8521ULL, 0x1c5c863d6591f4d7ULL, 0x1eaee1fbf6c8b00fULL, 0x2a2d5e2e317ec0ffULL,
+    0xa35542621fa114a3ULL, 0xb175cb3fb5e6a7c5ULL, 0x5f5f880736a7a687ULL, 0xac526db9bfc241f3ULL,
+    0x4df17bc51c931015ULL, 0xed138644b50c50c1ULL, 0x42d25cea73c618e9ULL, 0x226e9e46287ddc9fULL,
+    0x7e45d1166235da6dULL, 0x31155704059d6c57ULL, 0xae13307a41e2fac9ULL, 0x06c1d4bf77e971d5ULL,
+    0xda0ea2c189cff023ULL, 0xe3b2ea4e5fee6171ULL, 0x09642deb8d7b7c25ULL, 0x87b9d8c02323b03fULL,
+    0x039adf6a087ec505ULL, 0xcad69ee7baef705bULL, 0xa5a294e96fa91075ULL, 0x689d98a2da868859ULL,
+    0x4492801205e9f0c3ULL, 0x53d3a59ad048d111ULL, 0x85ca457b41c71555ULL, 0x86e7168280f19a13ULL,
+    0x9324215ecb1f43e1ULL, 0xb87d57896491dbadULL, 0xa2d29a8031de7e83ULL, 0x3e345fe6937718d1ULL,
+    0xcf2c109fa2dbafbfULL, 0x3781e4054a760c6bULL, 0xc008f6566ad4d28dULL, 0xb91b04bd1d3193f5ULL,
+    0x7b117983d43263a1ULL, 0x9a7767d4e55edb57ULL, 0xa5b9bfa599f5c965ULL, 0x07b7b876e5348537ULL,
+    0x25d64688336b8071ULL, 0x4de991225c7c730bULL, 0x0b12c2767f186399ULL, 0xd392ddd285c60851ULL,
+    0xeed12202c0229d07ULL, 0xf6c3475163a5ba95ULL, 0xd6fc58812611bb53ULL, 0x01c9c4f5b7d37b1fULL,
+    0x2f2ec055c51067c3ULL, 0x5fc65e6b98be80c7ULL, 0xec2d206dd4b08149ULL, 0xce45e6914e579d39ULL,
+    0x86284fd2fbcd82a3ULL, 0xbd01c475f8c6cff1ULL, 0x1c78c54a1b42063dULL, 0x84527b8a243482e1ULL,
+    0x90dd1b60ac45a1fbULL, 0xd709c4d5a86ec91dULL, 0xbdaa7ce15ad4eff3ULL, 0x53c66eef106a2ebfULL,
+    0x9e17c7cee8a1f6e9ULL, 0x181d7b8add65086dULL, 0x642019ecf407e343ULL, 0x0f90cb9716b6e847ULL,
+    0x73b2d8e39c1f75b3ULL, 0x6c80c5269126049bULL, 0xd7ef4f5a8fc8b103ULL, 0xe56a5a7b59e36c07ULL,
+    0x8e42d73f5b780195ULL, 0x0ab1518a7cc0ae3fULL, 0xef24e370d2d7dbe3ULL, 0x4f583c9310eb41d7ULL,
+    0x396be19b148d0d0fULL, 0x61b2460608f23f3bULL, 0x604c271b6ba2b049ULL, 0x7ce32518575e3acdULL,
+    0x6024593c5a918bb7ULL, 0x26011e9b31d1fa29ULL, 0xd37204a0bc42b9dfULL, 0x77866f0330bb7d8bULL,
+    0xde75ce173f227a19ULL, 0x62efd913f5aa44cfULL, 0x70db02a41b589a6bULL, 0xf3e86b3b16a951dbULL,
+    0x12f7171c6aeaaafdULL, 0x0293b83471df1dd3ULL, 0x24848310d3dfe1a1ULL, 0xf40d1006fb9732bbULL,
+    0xd0e4da34308cc6d5ULL, 0xf59c60e29b4f9c2bULL, 0x91253505a32f664dULL, 0xf024cae676f1d3b9ULL,
+    0xbfb033326e4bbe71ULL, 0xdbfd0e7de0035d27ULL, 0xa6874220c19853b5ULL, 0x4573f46d50561b9dULL,
+    0x782cb0e833a3ec0dULL, 0xe8fd149dae6792e3ULL, 0xebdf60896f69655bULL, 0x1430c196ccdda575ULL,
+    0xbe24731eb93d12cbULL, 0xf4a593e026b86e11ULL, 0x573ba9871fbbbab7ULL, 0x6862e609a2244befULL,
+    0x477f65886cd178dfULL, 0x2ce363dbf55620adULL, 0x2c606ffbf312fc97ULL, 0x997fb1e762f96ffbULL,
+    0x1fa8e05aeeaae287ULL, 0x4ac436af16fbbb09ULL, 0x17a32c7f1db2f3afULL, 0x8265f5df4cd95867ULL,
+    0x930e13f7a2207cd9ULL, 0xb121b63d52eccc23ULL, 0x1eb7b6b13334b745ULL, 0xc5e6a2a2d046529bULL,
+    0x120913ad27b8ec2dULL, 0xc221c95830d51099ULL, 0xbc67f44c6a14f34fULL, 0x5aab887c2e9cd29dULL,
+    0xa3ddb105012a8f95ULL, 0x527610241e468df7ULL, 0xff2141600cbde32fULL, 0x9aa49dde8edf4021ULL,
+    0x1d743d8f1a421fd7ULL, 0x85ad0c077ac7ccc3ULL, 0x5dd67464493291e5ULL, 0x09f6e767c04c4d11ULL,
+    0x4cb8d6cad11d0e49ULL, 0x21e129ba7a248a39ULL, 0xf9979ff16bc527a3ULL, 0x88beec9962b533a7ULL,
+    0xe473d37149748b8bULL, 0xd0a7d709a3999819ULL, 0x7f7acdeb73b5f4f3ULL, 0xb65711379409abbfULL,
+    0x109c52521d9e2e8dULL, 0xab8694f9ce5c6563ULL, 0xd8d44e66606784b1ULL, 0x76822c67ea929fdbULL,
+    0x5aaef55cfb02c3e9ULL, 0x8bd5f329a7c6cd6dULL, 0x33eb3ffd31c19a8fULL, 0x2697893f20bd2a2bULL,
+    0xc1a14731cfb85a6fULL, 0xbc767e0a49869f61ULL, 0x3bc58dd14bae032dULL, 0x0cee8a06c9499603ULL,
+    0xf59a734b9dbdbf25ULL, 0x17c57588630ad695ULL, 0xb60bf500c55d2b3fULL, 0xc97055d51ce31579ULL,
+    0xce3408a8640eeee7ULL, 0xaeeac819ad4e1753ULL, 0x04649e9d13a53d49ULL, 0x459d2911d10f2633ULL,
+    0xe71bc655cd42bfcdULL, 0x36d11a6517534bf1ULL, 0x318a7967d8464d1bULL, 0xd13e8768d4ee5183ULL,
+    0x1b45ad20e13af3d1ULL, 0x32e29d8947074ac1ULL, 0x7abd37d01503bcf9ULL, 0x56290db075f046dbULL,
+    0x414b640e04fd8ffdULL, 0xe3f72dcac1931ea1ULL, 0x9140da5ae5182447ULL, 0x1f5f4841bcda1bd5ULL,
+    0x5c29d81586c17a7fULL, 0x53ea3496b8cb396fULL, 0x688e9186d40b160bULL, 0xa407fad54d5f6625ULL,
+    0x5f8824da2fac314fULL, 0xa7f258f14598b773ULL, 0x6babca0e96d9ebf7ULL, 0x87181110d283ea69ULL,
+    0x2089d2b2b7c127cbULL, 0x8e1037235561890fULL, 0x7a7d4e3484987e5dULL, 0x7804759a17780bc7ULL,
+    0x9a3bf7d43b23ba01ULL, 0x13951a862d7314abULL, 0x852d0c7e64c72839ULL, 0x72143c5605e8741bULL,
+    0x6c6050bf605465adULL, 0xf34c8fdbbc6ec997ULL, 0x8a092538feb424fbULL, 0x4ba52568da29c809ULL,
+    0x965869cfadc40115ULL, 0x5b9d571dfce5b66bULL, 0xc4ffa4ec0ffedc8dULL, 0xa97a43f62a52bdf5ULL,
+    0x1aa26ae81e4f43c9ULL, 0x3d0d6870b64aa8b3ULL, 0x6f3d7e2619f5797fULL, 0xf81d295860c9f981ULL,
+    0x2a665213dfd97123ULL, 0xe8a41494b72fec45ULL, 0xb7ca2f8e06f06fb5ULL, 0x375d144ef833bd99ULL,
+    0x0f0d244194b04251ULL, 0x99705dd0b9989af7ULL, 0xf8a76135ab60b379ULL, 0x6ca51f06fd9d002fULL,
+    0x8030cbff7de0015bULL, 0xec46fc1e1970c27dULL, 0x4697cbf63c5cf51fULL, 0x07232a37b77106edULL,
+    0xde533713da4b9b49ULL, 0x3b7d9d035d826dcdULL, 0x6532bb97776fc7efULL, 0x33545474ddbf60a7ULL,
+    0x5184e28cb707208bULL, 0xbe0cd821d6d34519ULL, 0x77cd89f799645fcfULL, 0x7beb9bd762d3131dULL,
+    0x0e5d083de3f27709ULL, 0x37727fd6b4a28a63ULL, 0xb431c2d2929e4985ULL, 0xf233cc1e57f961b1ULL,
+    0xd3dc1237767344f5ULL, 0xac3744a31dd4f78fULL, 0xf4e2d0b3d6f59991ULL, 0x6c68cce6954fa9d5ULL,
+    0x10d61e668e7e7f2bULL, 0xecf1c0f27b0ece37ULL, 0xcc317c74cf485eb9ULL, 0x872c09aa455c1ca9ULL,
+    0x6ec4e3831b09482dULL, 0xc2435f4167c3a151ULL, 0x93d3ad51cd67a83fULL, 0xf3117d09ef8760ebULL,
+    0x350e2a6d742025e3ULL, 0x57b1bd833c3d4875ULL, 0xdef8e40cdade3c21ULL, 0x11e4b8cd36272de5ULL,
+    0xdeaf76da0807ab33ULL, 0xad1a0a4e143fb801ULL, 0xb5f1ddd18ba0a5b7ULL, 0x2e4726e8472e03a3ULL,
+    0x115450dc707ec21bULL, 0xa822109dc9369429ULL, 0xaaccfba8dbfcba35ULL, 0xd7b44ff440e210d1ULL,
+    0x9bd4dd6f10208f15ULL, 0x343017afc0e8e177ULL, 0xbaffae98fd2a74fdULL, 0x77539c343f6a7fe9ULL,
+    0x2048f91a7e83a7d3ULL, 0x74767a9808ba2443ULL, 0x8d46919c73270165ULL, 0x2b5ab23f1d0ba1c9ULL,
+    0x4b5045df3d97b727ULL, 0x622599b8a0c25d93ULL, 0x9832c757950b9b61ULL, 0x5a7e972d562d3d89ULL,
+    0x4670557e5bc8e405ULL, 0x590be4d6645634edULL, 0x88cbb13046dbe60fULL, 0x12ed4ad821a8f8c7ULL,
+    0x01cb52d2839f69abULL, 0x7681b0cb7992adc5ULL, 0x9903b51626010329ULL, 0x475fefcec43ff2dfULL,
+    0xd4a24fbbfdfa2d83ULL, 0x8e7f98d9fd13bc87ULL, 0x9303665d4fd5d615ULL, 0x96286d13a3cae18dULL,
+    0x0e08359088cd6bfdULL, 0x505e676cb9b3804bULL, 0x94bd58db5ec4d6d9ULL, 0xa3593f1ffdd22865ULL,
+    0x042e04a801da03bbULL, 0x57368f250e86c627ULL, 0x0bd9b85aad586903ULL, 0x4ec5751946971c9dULL,
+    0x9b656aa52d17f65bULL, 0x7a89ac18daa6b21fULL, 0x558f15e31d69ba21ULL, 0x246e28314267cbedULL,
+    0x61f0a7c9fb96b9d7ULL, 0x33623dbf39fa30abULL, 0x784506c3d16364efULL, 0x0499df5fd012c835ULL,
+    0xf5d7d4ba852fb58bULL, 0x1176028187788409ULL, 0xe3f608c0f5a4c5c1ULL, 0x537e41a036b8388dULL,
+    0x760d6cc1ddce4167ULL, 0xbacc97189870d9f5ULL, 0x5a15f5020e531243ULL, 0xa8f077a49a62fed5ULL,
+    0x00c74aa3f00df581ULL, 0x58bef6a5d17e5b37ULL, 0x855c218a8d544bb9ULL, 0x2d8c4e46256b946fULL,
+    0x8add5d393c49be51ULL, 0xde8f781a00ab35ebULL, 0x6982c9dfa91ea40dULL, 0xa461a8a188fc9e7dULL,
+    0xae1bddf608bca153ULL, 0xef5ec616e03fa2e5ULL, 0xee3293ff69ae240fULL, 0xbfb414bd360532b7ULL,
+    0xa0e86672ae53a8a3ULL, 0xccc8064a00d37bc5ULL, 0x82d134d07cad371bULL, 0xc09be88495ff70dfULL,
+    0x6066a0ff14eed8adULL, 0x921b6c60727b2dd1ULL, 0xc351de511c5a55f3ULL, 0x0a37b9bd0f6d196bULL,
+    0xe1ea15550cca96f9ULL, 0x33eebf2401a54ce9ULL, 0x998695da0a28ee6dULL, 0x7810a6f210d67665ULL,
+    0x1bc6471b200dfe47ULL, 0x076a511e3b07f54dULL, 0x5b48be9a436b5025ULL, 0x42c3a48861c15b7bULL,
+    0x710a8041f03a8a9dULL, 0xc6e71bed90f2c173ULL, 0x119265a10659a43fULL, 0x9c69b581f23301e3ULL,
+    0x38aded767ccd8469ULL, 0x46270b3e70f76475ULL, 0x2125f8e8b5e3301fULL, 0xc56d048bd70b51cbULL,
+    0x217e6cea0fc8f9edULL, 0x9518e9391b633c59ULL, 0x87467d11f2b34511ULL, 0x8a4644f3f477e5c7ULL,
+    0x70f10a4d568fb401ULL, 0xf18ecdcb5c6d61b7ULL, 0x486cdfe72caae2c5ULL, 0x6d4c1cc46d7122efULL,
+    0x460af63bf62b233dULL, 0x05a30ccfa8c0ae13ULL, 0x056ccd63732237e1ULL, 0x4d559410c02fe3a5ULL,
+    0xa97d6bd5f3cb8efbULL, 0x27d8ad8aa2fa1d63ULL, 0x871b6b70427250fdULL, 0x731a8d64e0bb5f67ULL,
+    0x90919705fbbb57a1ULL, 0xbac2e3a9c5b40f57ULL, 0x629d4e99e7f538bbULL, 0xd765b24c8cdc5dc9ULL,
+    0xcfbc70e50803737fULL, 0x6cca601e84045645ULL, 0x81cf0724b5a0b19bULL, 0xa9216888816747a9ULL,
+    0x4fef200b3ff88005ULL, 0x5572314c5de9f721ULL, 0x2458448df23e06d7ULL, 0xb1aaec1a0bb92411ULL,
+    0x2da0a36eb599ac3bULL, 0x979831267c833055ULL, 0x75d3c707063177cdULL, 0xbb24afb5dfe501efULL,
+    0xfb15abeeeeb64513ULL, 0x243a1e6849845297ULL, 0xfe28e042c52c9f19ULL, 0xcca7a6f72d4819cfULL,
+    0x80474bca79e475fbULL, 0xcf43bcd8461b42c1ULL, 0x48675e1168b31bb1ULL, 0x2f26978cad312ae9ULL,
+    0x5550ec4bb7481c6dULL, 0x6d1be9d5a88d7743ULL, 0x74472bacdb15f281ULL, 0xc34ff999d903292bULL,
+    0x1d876f100dd2bd45ULL, 0x4a768ef20a6395bdULL, 0x5228be9ae9695093ULL, 0x6d7c042b9bc1db51ULL,
+    0xad76ba20c473297bULL, 0xa3e67142bc2f5c79ULL, 0xc95a6372fcbf992fULL, 0xd347ac3cff3df5e7ULL,
+    0x5ae27ad4eb98b621ULL, 0xbbdefe86346217e5ULL, 0x80362c3f0c38e449ULL, 0x712812faa70ab533ULL,
+    0x551ea56b8ccc4ecdULL, 0x83e0461d7f1f4da3ULL, 0xb2275d6b048bc9a7ULL, 0x7684ae16f8a32e29ULL,
+    0xfecbef414d76e435ULL, 0x120332bfeb880083ULL, 0xcf58da9969cf141dULL, 0x76056538a046c787ULL,
+    0x1b60be302fa63915ULL, 0x3744bda8ef2808afULL, 0x1b11258c8e8925dbULL, 0x0875b24af37b8d9fULL,
+    0x0a92db9c5c30ed57ULL, 0x771c8ec69df0bbc9ULL, 0x8c5c27c949997a4dULL, 0x38431f5bcf432923ULL,
+    0x76b3befc24b53271ULL, 0x916d7a5b30fb0cbdULL, 0xa20cbf48ce7fe793ULL, 0xbbbe1ef49e0f1561ULL,
+    0x028df602b841c84fULL, 0x897c488780d5107bULL, 0xd912216a413aaf9dULL, 0xc319f78b142d4141ULL,
+    0xc48898fe4fec4e05ULL, 0x9055ded595c0ca31ULL, 0x2db3431c593e84e7ULL, 0xe70c2dac14ef6959ULL,
+    0x25536002d60d8c33ULL, 0x4082629fc479eeb7ULL, 0x4a58becd193def39ULL, 0xc0b94a3986199d29ULL,
+    0x238e21e32aab34adULL, 0xf10efdf0f85bd8a5ULL, 0xddfdf4ab0fe320bfULL, 0x567c3c301461d2f9ULL,
+    0x9095584a115baa4bULL, 0x89468a1b54445c57ULL, 0x4dfc18d405971265ULL, 0x11fc0c556e08c8ddULL,
+    0x33c2da57cb8f37b3ULL, 0xe91ba8b56ccff081ULL, 0xc05149c7d673514dULL, 0x4f2e290470504637ULL,
+    0x055aa0f283b05171ULL, 0x1da82273fd8a002dULL, 0x49a01145fc1bc499ULL, 0x219ba0c5fba8674fULL,
+    0x7789e103b9ccbe07ULL, 0xe31d7ca1e53c1d73ULL, 0x8353a33a608e572fULL, 0xf1af6beb02914069ULL,
+    0x73e2658225cb1453ULL, 0xaf7694725de38555ULL, 0xad8ef82fe6ffafffULL, 0x9740ba5f6938daabULL,
+    0x108738c33e1b0a13ULL, 0x95e9a81976c4f235ULL, 0xc57135fabc4c4c19ULL, 0xc7b54b17d9cc821dULL,
+    0x9b45b917d6d39fbfULL, 0x86befb4745ba428dULL, 0xeb28e54e177e5977ULL, 0x6ae11cd8790273dbULL,
+    0xe1e0f24367317091ULL, 0x56db9958b2768947ULL, 0x8d3bedddb1c67e2bULL, 0x304a772b6d014d9bULL,
+    0xf36c328eb78ccb5fULL, 0x173e065ff8759361ULL, 0xd6be5fb83dbf8d07ULL, 0xc7156706bf0cc979ULL,
+    0x2dc6207cb3fa687dULL, 0x8bd014c510d374cbULL, 0xebe852f0b08e8ce5ULL, 0x7c4fd18acaf4de0fULL,
+    0xe51476338b153a33ULL, 0x6f77f27944884cb7ULL, 0x3b7fd2327790f2a3ULL, 0xe588fcfa2a05e5c5ULL,
+    0xfab86aad8fb8bff1ULL, 0x4db435205279f6a7ULL, 0x1702b2fb5a80668bULL, 0x6f3bce8eaf0562adULL,
+    0x17d71de9449a391dULL, 0xed237ee940300877ULL, 0xc4427b648c1970f9ULL, 0x53ffc121f9b04f91ULL,
+    0xfff36e6e000648c9ULL, 0xd42dac6dbe7b74b9ULL, 0xb81061801dd1ad6fULL, 0xc0734ef7d9773e27ULL,
+    0xd0cc6ff85b0bd261ULL, 0xb282a6e902056a0bULL, 0x0cf1f3e01bd34617ULL, 0x9a1827a573286489ULL,
+    0x09810edc96bebe41ULL, 0x5d64f3330b234be3ULL, 0x3d0ec68c2db52e5bULL, 0x773f99985968aa1fULL,
+    0x7f91047516ad7bcbULL, 0x652ccab10b43125dULL, 0xdd9b71d76befbfc7ULL, 0xf983d56ed17edc39ULL,
+    0x09d204691fd6481bULL, 0x484e435f22f3ed3dULL, 0x17d027900928ea29ULL, 0xbd44cd3f8a4c3813ULL,
+    0x7bf05d535a3ea9dfULL, 0x9cf6e83a22c9fd97ULL, 0x08bd8a981fcd0a6bULL, 0xb4a98a504c0af08dULL,
+    0xf5d43ac401cc6763ULL, 0x13a730dc0e6bd1a1ULL, 0xabcd9431a5088765ULL, 0x2125ce1a454da2bbULL,
+    0xb6e04df5bef5ed81ULL, 0x9ff71638f1559b9bULL, 0xb775f7efa1444d27ULL, 0x48f76af7e0b8c3b5ULL,
+    0xe8a8b8fc2a0f452dULL, 0xb5e575c8d0bd1803ULL, 0x7651c61f45dcb651ULL, 0xd98691cc7bba2273ULL,
+    0x90ec0d190c3d6debULL, 0xea8863d5864ccef7ULL, 0x0a31efbdb53a6779ULL, 0x73b2086c9f755953ULL,
+    0x08ce6e553da81aedULL, 0xd6c437d06f56c5c3ULL, 0xc7b54c355a16acffULL, 0x06642a831f98643dULL,
+    0x8dc221f422fd0735ULL, 0x53c400a01f2d748bULL, 0xb18a8d53a2be3cc1ULL, 0x61b80452c472478dULL,
+    0x05c38d27a37d6677ULL, 0x9de6860e93371e63ULL, 0x6a4200126ce598f5ULL, 0xa10e8bf349c3c64bULL,
+    0xcd4bb894045bec81ULL, 0x0ad9497054dfd32bULL, 0x79191b0566410237ULL, 0xd5c73397b0a16b6fULL,
+    0xac430c436e465fbdULL, 0xf020586c6c9150a9ULL, 0x9a56cbd91c3c085fULL, 0xcb59f67659480f03ULL,
+    0xf9a23cf075e9c289ULL, 0x1f8ad896422f7053ULL, 0x0741fcbc0eebb459ULL, 0xeef05b4f6e8d3b0fULL,
+    0x289891843c157d3bULL, 0x8cc331f134eb805dULL, 0x8378966a7a25bf33ULL, 0x26f445f4a46fabffULL,
+    0x1d59ef08b88e1ac5ULL, 0x84ab3eddf18f1cf1ULL, 0x05572c4844fc961bULL, 0x7046343fb017c829ULL,
+    0xe0172e53883f5e1dULL, 0x7c593f77f78ba187ULL, 0x9e847849fccb64f3ULL, 0x765e4f6720f5bbc1ULL,
+    0xdc7a4c92c993ddf9ULL, 0x69a6d818313d0fdbULL, 0xf71536b962e208fdULL, 0x35cf5583dba3079fULL,
+    0xfdd7d2f70d614fa1ULL, 0x7bf4641ef0f7b843ULL, 0xe26c79565c20d565ULL, 0x0581bc246d78ec91ULL,
+    0x9dd7dcb5faf64a6fULL, 0x742539a5a215ec71ULL, 0x67451438ae70d1b5ULL, 0x5f00dcbdcb4b8f99ULL,
+    0x416567e8ab9e7a7bULL, 0x8d139e2e8cbc0a0dULL, 0x5e584ef26df48431ULL, 0x7e67493a8c30671fULL,
+    0xa0a3f01fd86dc359ULL, 0x618a8ba4015db3c3ULL, 0xc6b7ad0c4c98acc7ULL, 0xb2094b9f47e16855ULL,
+    0x40490305c64d08b7ULL, 0x77ab705235af81c5ULL, 0xd1c666a0277afd13ULL, 0x9892d7bb229bca97ULL,
+    0x7c369f18ed5dc183ULL, 0xc5759008d2ee0909ULL, 0xd3ad5c6f5bc12a15ULL, 0x7b2723e7aa31a1afULL,
+    0xc009c07ec67013b1ULL, 0x269170578a2fd2d3ULL, 0x870e5eb2d55bd44bULL, 0xb95ba007de5ef657ULL,
+    0xcb56d6e15e36a98fULL, 0xfba5d1b15adf04c9ULL, 0xc48d351f53805b4dULL, 0xf9b3d89a513f7a27ULL,
+    0xeab4e0a7bb8b1e99ULL, 0x1a9274acaa84d351ULL, 0xfa7b50dc73af9807ULL, 0x2a6b80491ce5d479ULL,
+    0x67a90e272992da69ULL, 0x37a503515627edd7ULL, 0xc2a50ca6840b4fe5ULL, 0x2af79c7fd7ca4b3bULL,
+    0x9f70b9837ea22f55ULL, 0x75c44920523105a3ULL, 0xe827e13af2bdd8efULL, 0x6c4dbd639d41c93dULL,
+    0x7f109f4684f441a7ULL, 0xe45b9f2d5bae098bULL, 0x5331c9ffbea6b0cfULL, 0x8a6c6c5a88d294fbULL,
+    0x64dde400b224b809ULL, 0x12a4f2546ecc99bfULL, 0xa54c1fd8523b4363ULL, 0x90fb36e3b128d285ULL,
+    0x3849162c7c8b2df5ULL, 0x2829f55f16f5859fULL, 0x4f02e78c8fa0a643ULL, 0x599927e070e8aa91ULL,
+    0x07a53a01751649ddULL, 0x27ba8d81c04f282bULL, 0x05ff603ff957ffb9ULL, 0x407592959f865c45ULL,
+    0xf8bbb603f37a086fULL, 0x1dedc7897c4c9f93ULL, 0xbab21cae7d457d25ULL, 0xd7f0384aa7d63251ULL,
+    0x567a309f6360327dULL, 0x25ff260218245cd7ULL, 0x3ff4f585ca6db23bULL, 0x04e592d29b6ea8ffULL,
+    0x831beb14d690a901ULL, 0x724bd2726f1fddcdULL, 0x27bc113c680366b7ULL, 0x85591229d7663ca3ULL,
+    0x6987d9810d030b1bULL, 0xe7c7e4e948d464dfULL, 0xb1083a7b994f908bULL, 0x964d6e6b09c02277ULL,
+    0x27f71c76fdacb985ULL, 0xd918d33ca63bc49fULL, 0xa8ffe5a1d0008ca1ULL, 0x41ffb3dde9f84a65ULL,
+    0xe4ca004c1961b247ULL, 0x88fd61ebf39c19d5ULL, 0xaa261669f22d4eb9ULL, 0xfd086eec1bfb4c61ULL,
+    0xeb140b1699403c99ULL, 0x9a5f8c4fb2155f4fULL, 0xc4a4af43eb571e9dULL, 0x1adda60f55eb0f0dULL,
+    0x1d0c9b18a7596131ULL, 0xb56866d77fa7185bULL, 0x945926fd6ad80dedULL, 0xa0bc245879d1b70fULL,
+    0x627f8d1b308712abULL, 0xf5d8c5cb81efb6c5ULL, 0xd5cfeb1ad59b96efULL, 0x37a42d2f6624b73dULL,
+    0xd157964620eb9797ULL, 0x2f2bdc05f175a683ULL, 0x7fc762c4c41bb7a5ULL, 0xfc3238383e09e4fdULL,
+    0x54430c1f1a0517d3ULL, 0x5c72a9bb2ba63bf5ULL, 0xfdee332391097165ULL, 0xe9ea66e12404068fULL,
+    0x3b016f94017e0cbbULL, 0xead1f79d2d09c6b3ULL, 0xbf1f399af9252a45ULL, 0x40edadfb4818a727ULL,
+    0x88ab93a5ca011b0bULL, 0x4f0dff4cfab5cb99ULL, 0x877017a38528e203ULL, 0xb839729171efd59dULL,
+    0xa02ae9a744646295ULL, 0x7a14421d8ad83741ULL, 0x1803dff6fd1ae8f7ULL, 0x3ed4fb820b19bf5bULL,
+    0xd47acb25bed2207dULL, 0x9b0e58bc3a49631fULL, 0x1417856705db9811ULL, 0x0899202dad4ce949ULL,
+    0xcd755d5d180ea6ffULL, 0x7a7d4f311b1bd9abULL, 0x99c9dff705326ea7ULL, 0x35d2e84959ed5913ULL,
+    0xae32775aef8a6ae1ULL, 0xed6a73f0e650518dULL, 0xaa2018ba43656863ULL, 0xe4d558ad86a28785ULL,
+    0xc3ab27cab865a267ULL, 0x71cb3fc0429ac2f5ULL, 0x422d515e6168eeddULL, 0x66a030fe72539db3ULL,
+    0x56ed3f62074decb9ULL, 0xa79db1a09e37eaa9ULL, 0xb9ed5db1c824825fULL, 0x79429e07df164f51ULL,
+    0xfd615069c695fd7bULL, 0x1ec744b324a6a995ULL, 0xd40b2da8e9469f31ULL, 0xdee15140b159fa53ULL,
+    0x2697d034ddd5b3cbULL, 0xe4a95e7bb3860e59ULL, 0x65294472014febe5ULL, 0x4998da586d7be73bULL,
+    0x63ecec9a12d4ca5dULL, 0x683733d0385ba5ffULL, 0xac8975f077a3a601ULL, 0x383efc973f7c84c5ULL,
+    0x8f349832e551d6f1ULL, 0x5592e984beff801bULL, 0x35c1e80bcf787da7ULL, 0x66a3c1e7e07ca1dfULL,
+    0x1d9d2d051747e219ULL, 0x02cb573bb0792ccfULL, 0x8740ef08475f6ef3ULL, 0x2ec9bf7b77146e85ULL,
+    0x214a6da2370145d3ULL, 0xc8f509b379b62157ULL, 0x7f3001f20cc19f47ULL, 0x01a2ab856e61657fULL,
+    0x59323b74efa38e4dULL, 0x8eaa904a02a0a0bdULL, 0xa7f76fa67a08fbb5ULL, 0x669dc3a4dbee0961ULL,
+    0x2484f86b9828290bULL, 0xc4ab250744d6e999ULL, 0x1a6b3d9f407cda73ULL, 0x6db20673b7d10d5bULL,
+    0x2a4a701ba2ecd2edULL, 0x7a497b711520140fULL, 0xacf89ff24863a033ULL, 0xdd01a8d88e2c1255ULL,
+    0xbf1fa8717d58a501ULL, 0x267ddfffa60933efULL, 0x0cf131144662d129ULL, 0x7ab1a1bad6db60dfULL,
+    0x91922ca783a048adULL, 0x6059814f8e738b83ULL, 0x8eca7b1594b2d415ULL, 0xe92e6fd8e9e786f9ULL,
+    0xc7d713a97724d663ULL, 0x32f357786c719057ULL, 0x8d00fead5d001ec9ULL, 0x00edbe3fc8c27a37ULL,
+    0x2931cc5023cfd427ULL, 0xc26b7d5a8ad4b00bULL, 0x462064297cab0d51ULL, 0x280cd001eae2ae79ULL,
+    0x8f45bf3531e8057dULL, 0xac4e4985a6daf4c3ULL, 0x073079fda1013511ULL, 0xf311a6ab0778b53bULL,
+    0x0677dcf3ba08d955ULL, 0x5bf2a7ae89fe10cdULL, 0x9d3e87cbc253f239ULL, 0xcd9c4923c6da4fa3ULL,
+    0xf113210e16bf12efULL, 0xa6969e6f73214635ULL, 0xb8cf07e8ff1f0019ULL, 0xa288cad00a966acfULL,
+    0x2984cf6ba029fefbULL, 0x97303defe306d209ULL, 0xcd0e45ae65ee8d77ULL, 0x2d44d5cc24b58d63ULL,
+    0x9004ae2b71e63c85ULL, 0xf5d6dbdfce6e6cb1ULL, 0xd69623e562e4828fULL, 0x634cd8b4c11593ddULL,
+    0x0caf974fc2923d47ULL, 0x4fbaa1095fc8fcd5ULL, 0x25d39fb9cb31a937ULL, 0x3c4a64b265a5d9b9ULL,
+    0x122cebad3d2f8b17ULL, 0x24b4982085897e95ULL, 0x361d9088cdb9133fULL, 0x564bdf2f4b1033ebULL,
+    0x6051bcb9ef567d79ULL, 0x04aa4588fda97c31ULL, 0x18aa87bd37e456e7ULL, 0x179ac6a2d76f5b75ULL,
+    0x40acde8009a460e5ULL, 0xe83804375f01a549ULL, 0x6b188590378ee7cdULL, 0x785d1e46bdd386a3ULL,
+    0x739b4e60d8f1f51bULL, 0xf352f67e38deaaa7ULL, 0x3fcb10fb6f55af29ULL, 0x52f552b364ebdbd1ULL,
+    0x4d2af9d53fd36215ULL, 0xcb61561ea5c332c1ULL, 0x362eb88be2483c77ULL, 0xc0fbb94f514499afULL,
+    0x5864e31a693cb7fdULL, 0x4f49d08c06208ad3ULL, 0x547db40aebe18c6dULL, 0x531fcf01f5926e57ULL,
+    0x61cf6d3b28c53465ULL, 0xd6ac22ca79f07cc9ULL, 0x4e9ad660f68b05bdULL, 0x8bfa25c8c95fbe0bULL,
+    0xcbb7191f6c0f9699ULL, 0x7f80ec63ca7f0e25ULL, 0xee9bb6f9dd689889ULL, 0x744306cb5cb8b241ULL,
+    0x03a2e2c56cd253f7ULL, 0x277a6370f771025bULL, 0xb95bbdcd56d6e5e7ULL, 0x6b7443ccfd58e275ULL,
+    0x82564f325fade2c3ULL, 0xebd961539daef311ULL, 0x410785afd7506755ULL, 0xe28a5d2f875aafb7ULL,
+    0x3c0d7b697c4e20c5ULL, 0xe643d70db9241c1bULL, 0x0a9da1b398ab4c13ULL, 0x4858fbfeaec2a5e1ULL,
+    0x34fd144691053197ULL, 0xbbaf972a82577083ULL, 0x5c5bf4a8d54da1a5ULL, 0x4673c9172d1c3ad1ULL,
+    0xc671e112c0e23009ULL, 0x6c569a4d5fb7048dULL, 0xf97774eeb8fdf3f9ULL, 0x7cfbfb8c4a696d67ULL,
+    0xb292675b86b311d9ULL, 0x1ea155db0c8676bbULL, 0x90e174feb81001ddULL, 0x3d4cac0726e6ea4dULL,
+    0x445426f766969923ULL, 0xaaa6284ee20f3d5fULL, 0x3a966fc3fc68592dULL, 0xb712a9830ebbb84fULL,
+    0xd127748cc264df07ULL, 0x2ea5ec62eeee3673ULL, 0xbdf50e5ed3644169ULL, 0x4907b2187cbb2e55ULL,
+    0x22bc09222a92df39ULL, 0x0abab62adab071f1ULL, 0xc04296843ae52097ULL, 0x7f8db69df6a6b3fbULL,
+    0xc173bcbc6e743b1dULL, 0xecf64406422d21f3ULL, 0x7a4bac7f14e59a77ULL, 0xd31ba3522e00fc67ULL,
+    0x2fbbb6b8e9f7ecf5ULL, 0xa551072e693c1a4bULL, 0x938630a93be8ba6dULL, 0x8e7e03d578a42a47ULL,
+    0xd9cdbfb6f01ca7b3ULL, 0x8940fb17dd43f3bdULL, 0xb59d865823e684a9ULL, 0x28881c0666554461ULL,
+    0xaf146db800eb677bULL, 0x403cd51f68965395ULL, 0x3dade836b6f5c70dULL, 0x1ae062879fe4472fULL,
+    0x3936f5f37fbbe17dULL, 0x80918149b8efddcbULL, 0x50afadbfe9fa43d7ULL, 0x84618fbf7ca3d333ULL,
+    0x73b8d7448bdc90f1ULL, 0x08724102f6eb4f8bULL, 0x4f4e81909138e6cfULL, 0xdc5f1431c37d5587ULL,
+    0x63b9c760f42ce3dbULL, 0xbac1dad4c819fb9fULL, 0x0824c3fc790b516dULL, 0x4a3fe8c48f954c43ULL,
+    0x916f1d8f41b944bbULL, 0xd50e20dbead009c9ULL, 0x1f4f4a269a84984dULL, 0x8989bc14694925b5ULL,
+    0x946f2cfc44100325ULL, 0x8f23d784312ae473ULL, 0xf9bc765f28030f3fULL, 0x61331ade9f468c05ULL,
+    0x0d5f1baec24e1f69ULL, 0x17c0d2c11a1b5b1fULL, 0xe976b293e9027759ULL, 0xee849d8de8814b5dULL,
+    0xd85d68d153817d39ULL, 0xe1f4cf96008e6defULL, 0x2b70e49bcc5e911bULL, 0x9a395c3d6af21113ULL,
+    0x73ef2a1e9ab596a5ULL, 0x7017dcdd39623d09ULL, 0x1335c3f45d732063ULL, 0xfd17a94958cc93fdULL,
+    0x3a8ec732f1fa1a67ULL, 0x2d0fc999f628e6d3ULL, 0x9d026eb377401d8fULL, 0xc65d02bd3e2938c9ULL,
+    0x845505b6126f9437ULL, 0x7e48661bdd593e23ULL, 0xd79624d6218e7f71ULL, 0x0068f21cf66ae49bULL,
+    0x89ee9ad5e2842cb5ULL, 0xddf83dfb3090449dULL, 0x68e96da5a6e10ff7ULL, 0x081196eed4678879ULL,
+    0xd00e3ba6e14b7305ULL, 0xdb6c97e6e863a221ULL, 0x767a9fd48ba26f11ULL, 0xaae26593527b9dffULL,
+    0x24c08b0d5a33cc39ULL, 0xe8c6c1adf920f5a7ULL, 0x6f4a2b5ba8cb7035ULL, 0xe84e824c4993a1e1ULL,
+    0xb775af350cd8ed97ULL, 0x5c7223c5e44a26f3ULL, 0x424ecbbcc950adc1ULL, 0x2e451446afc7d763ULL,
+    0x115a25d111e426b1ULL, 0x46db7f91587e31dbULL, 0x8c99a9bc1d3c799fULL, 0x40a876f31f8e7f6dULL,
+    0x9369f79319687c2bULL, 0x4172d05c0dd73045ULL, 0x3b73f977a58458bdULL, 0x9bfc3a36374fb393ULL,
+    0xde3c01e8025a395fULL, 0x33d52397aa70b52dULL, 0x9c1e09ab03bd5125ULL, 0x9031b3530f63c67dULL,
+    0xcf273ecc6e85b0e7ULL, 0xf08343289d66c953ULL, 0xcf8a04d5bfee8575ULL, 0x804496662c6c9559ULL,
+    0xb2dd12ec44d25833ULL, 0xf81c5d609eb69cffULL, 0x1f4968e603e5f1cdULL, 0x493472a5f48d23c5ULL,
+    0x472330b69f4504a7ULL, 0x5fb8006750ed7735ULL, 0xee680780514dc3cfULL, 0x38b3fb9b73262cc1ULL,
+    0x2d29d6c1686bc16bULL, 0x3ea73755237ed3afULL, 0x8ff1fded4d6ab89fULL, 0xd6619a73fe450857ULL,
+    0xcfe760ed33ba1e65ULL, 0x1f9b4701b311fd91ULL, 0x760fd31eac956647ULL, 0x0d4edfa4f9656dd5ULL,
+    0x0ae7aad9d6735c7fULL, 0x811407be4847037bULL, 0x44472cd72121ac41ULL, 0x9f139d7e336b230dULL,
+    0x709c8efa5243ec69ULL, 0xc541d962a37ca459ULL, 0x3ee43f4abb36acc3ULL, 0xf0ca36db3edf2b0fULL,
+    0x71942c7587cef05dULL, 0x0a11d1bde70f9c01ULL, 0xe9129b9a0d4c66abULL, 0x2f12cdaaee0e6a39ULL,
+    0xae682caeefbe4b3dULL, 0xbe346eb282881fe1ULL, 0xc053b6646316cb97ULL, 0x9ca30bcf66d13a83ULL,
+    0x86bd702e23244a09ULL, 0xf53f86143f3c086bULL, 0x8358701494d0cdf9ULL, 0xeb183201749c32afULL,
+    0xf2b2c5436cd08ff5ULL, 0xb7bb13ca55fe7757ULL, 0x72c6834295ef4bddULL, 0x271de50a41b7f44dULL,
+    0x084b5852d2e5fe45ULL, 0x46b950dd9b84599bULL, 0x7634b156abf3b75fULL, 0x1a06386bb6d36f0bULL,
+    0xc0f6095b84c87603ULL, 0x4c06de43ab7a2b41ULL, 0x6400acbcbb9f1cf7ULL, 0x1da09be55e7cf579ULL,
+    0x008e24dd58b0f753ULL, 0x879d030a971e0c11ULL, 0xf96c6771236d9cc7ULL, 0x1540d6debbcb1d49ULL,
+    0xddd107a674353ea3ULL, 0xa38e4ae6b8372bf1ULL, 0xcbe0df14e4e55ee1ULL, 0x59a397fdb50701cfULL,
+    0x7e76ba75d1c8f909ULL, 0xc219efd254400abfULL, 0x9f454b46d589fc63ULL, 0x3f37b9a2a26d5b85ULL,
+    0x65817ec5720526dbULL, 0xb95b4464c5145667ULL, 0xfa866ac19b01369fULL, 0xd6e1f68445fdbb91ULL,
+    0xc361d57e1cf2fbd5ULL, 0x72f289ebd0246545ULL, 0x30bb015e6107196fULL, 0x8aeed2089ac3809bULL,
+    0x9f25cb5b84ecbe61ULL, 0x70daa4f2880ffa2dULL, 0x418fb3add1344625ULL, 0x7ac666f75bde1089ULL,
+    0xcda6a427bca1d10dULL, 0xd5bf47f3d46207cbULL, 0xe8393477a0d0bb3bULL, 0x211d3b288c06dd33ULL,
+    0x95efe6be7f5b99ffULL, 0x3f5738ded0a39a01ULL, 0xfafdd57b637427b7ULL, 0x8494081bcfef8c35ULL,
+    0xf03386e5628a9619ULL, 0x7468b49a2e6732d1ULL, 0xaa201a9b46cf82f3ULL, 0x0dbb03cde3b2a9c1ULL,
+    0x54d1823e70256377ULL, 0xf41d0d34c6974285ULL, 0x215836520c2259d3ULL, 0xc7338137506abda1ULL,
+    0x12fc29f8d5e1aebbULL, 0x4e13c4a31a00c2d5ULL, 0xe4f9a1a6e11cefb9ULL, 0xc4a8b5b30e805123ULL,
+    0x7b4965197de634bdULL, 0xff7bbec4f5857927ULL, 0xea7112eac8660f93ULL, 0x2d11e7c19be3d79dULL,
+    0xd80eb82079cdbf89ULL, 0xdb1f11cc0efc280dULL, 0xffd827ec0009f605ULL, 0x2f0b86807b3fb231ULL,
+    0x02ca1b140d1a0ecbULL, 0x86e4d2b12b9411c3ULL, 0x1a2596a7b376955dULL, 0xd269b75422d4bbabULL,
+    0xc65f22a51ab57b1bULL, 0x7508e00546cc0529ULL, 0x2c130baa783054dfULL, 0x3576f0ca1bdc9897ULL,
+    0xb3c356064c8991d1ULL, 0x197b17bf2027fe87ULL, 0x1768fb70264708bfULL, 0x6011a99acef9138dULL,
+    0xfb6e776b686d41b1ULL, 0x6fb13437c4c970d3ULL, 0x1f30686a3198d78fULL, 0x20427db1ee5a52c9ULL,
+    0xa6751dc94bf7d881ULL, 0xb6552e971a17794dULL, 0x728b7c4229133971ULL, 0x03228ff0b86f5b03ULL,
+    0x97150628e4308b95ULL, 0x1444e4cf878fa841ULL, 0xf39eda34d9eadd05ULL, 0x718404f7baea141fULL,
+    0xd6e418c181017dedULL, 0xd19c6a41dba382abULL, 0xba4392c4879ba639ULL, 0x0ff38be1c00588f1ULL,
+    0xfdd1b68b526b4fa7ULL, 0xe18842946c1627a5ULL, 0xddba2b322be30609ULL, 0x421a7fbc751630f3ULL,
+    0x5887e8bf510787bfULL, 0xf6deac43dcd26a8dULL, 0xd5a861a5e3722163ULL, 0x2a035b0dd0d91085ULL,
+    0x3ecdec5a482b0367ULL, 0x2f888d9a83285fe9ULL, 0xd7757bdd8b1eabf5ULL, 0x26b15247d43d594bULL,
+    0xab21fdaea5d3a7d9ULL, 0xd23196d397890443ULL, 0x48827243d8be5891ULL, 0x37956301f12bdd37ULL,
+    0xd5e06e7136fb6ba9ULL, 0xb523ae5f420eb35fULL, 0x12ac86ae7984e051ULL, 0xf73c3c610ab8d295ULL,
+    0xfa633f14d12ed60dULL, 0x3b8acdfaad28f031ULL, 0x6ea51be6529f0ae7ULL, 0x023168cc0b7adb21ULL,
+    0xb4cdd259435a34e5ULL, 0x556cea9fe43fc60fULL, 0x7273ae34dbee96ffULL, 0xe9531c7732109701ULL,
+    0x73509128de761aa3ULL, 0x0d513f15725f8dc5ULL, 0x934d72b13d235ea7ULL, 0x0d8341c69ef04319ULL,
+    0x7c009207c6e17dcfULL, 0x838c5d4a91076b6bULL, 0xb9545bae80407077ULL, 0xfa67d9ee94a4d8f9ULL,
+    0xe6c01a21f9f10dafULL, 0xdff083ec60e4a06dULL, 0x20eaa59b813a7b43ULL, 0x7ddef061446d3791ULL,
+    0x2ac35570d4c0ed2bULL, 0x6445186ff672dcb9ULL, 0x45d615455f48a627ULL, 0x501389e5aa1a120bULL,
+    0x6227e7db24046d7bULL, 0x9858788f438dfc9dULL, 0x7800d511f11cf373ULL, 0xdabe62a9bbd2a641ULL,
+    0x8307b96e75072d0dULL, 0xdab8a07e188cd65bULL, 0xa580cebdf2ae921fULL, 0xb227145a18a623cbULL,
+    0x951511711f3aabedULL, 0x62777468127f27c7ULL, 0x60d7cb1ba4d0e3b7ULL, 0xd76ea53a8ee30483ULL,
+    0x719bfec1da356b87ULL, 0xc4b09f30776dfd15ULL, 0xd07629fa73058f63ULL, 0x79bc6d2207fd1157ULL,
+    0x95867392594bc5d9ULL, 0x188df438793695ddULL, 0x45a0b704fca0e4b3ULL, 0x61287cbce8c43b37ULL,
+    0xdf0ed686dd826845ULL, 0x3ebd7f329b609671ULL, 0x0f7908744699439bULL, 0x983089e382c0990bULL,
+    0x724cde4e41372541ULL, 0x5353810db34dcf79ULL, 0x96974aef6e0a5921ULL, 0xd82db9565e5908d7ULL,
+    0x884895bacc34a9cdULL, 0xfa56eca3037723efULL, 0xe2b5b3480085e5f1ULL, 0xaab769170b9a1c8bULL,
+    0xb40af00cfda85497ULL, 0x2c99813c7d4a1ca5ULL, 0xe2feb4213d3f1309ULL, 0xa371a56e0c1a24c1ULL,
+    0x28eab19f6d9fb067ULL, 0x0df9299340232ce9ULL, 0x7b9e35543d94b09fULL, 0x0c75f6a35bbaccddULL,
+    0x3fd81f2c68456a37ULL, 0x1533ce6a8d1b7ab9ULL, 0x69575a88687c6a9bULL, 0xcc2dd81615e187bdULL,
+    0x6388cdd5502df05fULL, 0xf8af9c59e26da795ULL, 0x32e0fdee2969843fULL, 0x7791425b79699853ULL,
+    0x7fae2163a8751821ULL, 0x5dca05b9ca48230fULL, 0x9e37fbc7126f93ffULL, 0x4ac147a4fabb80cdULL,
+    0x704e4cb09e3a3029ULL, 0x102489d527f7f019ULL, 0x0563c7ae2098f283ULL, 0x7a416bccb8736cd1ULL,
+    0x095c974d7410861dULL, 0xd51d033d733130fdULL, 0x6672afb64fb01be9ULL, 0xce676b3afb56e3d3ULL,
+    0xad27b00d6f70ef9fULL, 0x67e5f2703cf6656dULL, 0xfb60da2677c1ef57ULL, 0x9e282f48e8e218bbULL,
+    0x49de04426af72d47ULL, 0x15966bf98c356cd5ULL, 0xef4610f031fc422bULL, 0x1153b9706413326fULL,
+    0x7434937c5b68d471ULL, 0x5eef6a26d7e9d327ULL, 0xa20b954d479b9993ULL, 0x02eb0ea0b6587761ULL,
+    0x2ae9e29b08a8f799ULL, 0x0e8745fdfe826a4fULL, 0xe610e8b72f34227bULL, 0xb38f381afdac94f7ULL,
+    0x5a2e32a58b3598e3ULL, 0xbbe26fbc4780dbc3ULL, 0x20033b0aa7d3df5dULL, 0x4356675e70fc1055ULL,
+    0xa44f0bb5cbc929c5ULL, 0x06ee9b0de440e1efULL, 0x1ba46a3e93dbe6adULL, 0x64644cd8c2e23297ULL,
+    0x4a71e5db5744e983ULL, 0xbd3ee3ba81e1cbd1ULL, 0x3de904f8b3f67109ULL, 0xf0856c6cc82c02bfULL,
+    0x851751bdb5ea89afULL, 0x2a4efc05be094ef5ULL, 0xec65fe7b7aa0f6a1ULL, 0xa87d3570b80c7fbbULL,
+    0x8dd7b80610a469b3ULL, 0x913844501cc9527fULL, 0x2bc4f8b54894b89bULL, 0x5fea1a0a6b8096a9ULL,
+    0xa80fafe2f5f0b22dULL, 0x7569449ea9cdbb51ULL, 0xff43003effeb0007ULL, 0x612504e93670a241ULL,
+    0x6f77ff0d702deaebULL, 0x9e550b80adb24705ULL, 0x324744fbd1eb792fULL, 0xfdfaaa6c863fc653ULL,
+    0xef5966bb9afc63c7ULL, 0x36445692959a2cabULL, 0xbd1abc0f4c34f13dULL, 0xff9e5595ab2da9a7ULL,
+    0x7706d5e37a570e19ULL, 0x235aa9bf43403cfbULL, 0x7321aa73b3fa3af3ULL, 0x10f30a74c95c748dULL,
+    0xe24e2143058371ddULL, 0x68baeb508f3fcb47ULL, 0x2345f0a179fc40b3ULL, 0x8957f39ecf11d181ULL,
+    0x7f8668e3c3bf67b9ULL, 0xf4e994a6bac9df9bULL, 0x2336b393bc89ecbdULL, 0x96bfb30d7a7b2d5fULL,
+    0x9bd15e16324c7c95ULL, 0xb844b29b540a013fULL, 0xae141c51333246cbULL, 0x62ef996e34d14959ULL,
+    0x1a84423a7ec75a3bULL, 0x3eef364aeb5af349ULL, 0xed84eeecc7c86c33ULL, 0x88fdcb369d59f7c5ULL,
+    0x3b29ad82416261f1ULL, 0x573ea49b0279b8a7ULL, 0x01607af7071e4cdfULL, 0xb8cfba7e4bad37cfULL,
+    0x34fc405493406015ULL, 0x3512890d53026185ULL, 0x49480d01ce37acdbULL, 0x0897a065fe8274a1ULL,
+    0x9ec04584c7c22a6dULL, 0x75cbb33ee98bcac9ULL, 0xc0f3f8c9d9cec1d5ULL, 0x16064b98f18d972bULL,
+    0x829890b1304e314dULL, 0xbe5930d82335cf6fULL, 0x841dff9fa91f5e93ULL, 0x7595a690f2688eb5ULL,
+    0x412618c6dbfb3c0bULL, 0xadb91145a25c474fULL, 0xd0f75c803a70469dULL, 0x5ad5acc82906fd73ULL,
+    0xf2059a1bb93b803fULL, 0x09eb8d2e3cbcbde3ULL, 0x0a26e8930c1a1505ULL, 0xa4e91da9a1dec05bULL,
+    0xf522e1570fdef3e7ULL, 0x48abf5ab0a004dcbULL, 0x1ddab3c4eab95859ULL, 0x1d8f633424b2a111ULL,
+    0x5681a396ec89845dULL, 0xfbb1f0959e4f01c7ULL, 0x8f6f4544241c6555ULL, 0x4c4ca37340907eefULL,
+    0xd6a26053a42fec29ULL, 0x4f70de7947930bdfULL, 0x0d049c1bed21ff97ULL, 0x8e4f32cb28100afbULL,
+    0xda30f4cc8ec07e09ULL, 0x25734c634320a6afULL, 0x93978b8b148ed8b1ULL, 0x1cd2c0dc794f7b67ULL,
+    0x18d33307771d914bULL, 0x97e82b2e51e5dfddULL, 0x1ac55d1007d2f9c9ULL, 0xc45ebb871add5537ULL,
+    0x058fdae59146d245ULL, 0x85b52e93b3115071ULL, 0x98deca11bcb9f72dULL, 0x4460be93e2c80a03ULL,
+    0x21ae9ebb8b705473ULL, 0xfa1374fb2f3dbfebULL, 0x6e7727b7260350f7ULL, 0xe077fda8e58e962fULL,
+    0xd7c002d5a20dccedULL, 0x948a40063bf36ce5ULL, 0x7d25342536695149ULL, 0x165ad13a7d1e8effULL,
+    0xff3aefcc9c53b3cdULL, 0x79489c6adc48563dULL, 0xc4fcd8248f6052e1ULL, 0x02629adc1700f1fbULL,
+    0x77d52583b17577b1ULL, 0x1ab6da75eb9ec6e9ULL, 0xf0d3d99329ff6af5ULL, 0xd06e38db86e02a9fULL,
+    0xbbb1a60f5d04984bULL, 0x2f57688cba672ed9ULL, 0x7888a7ce7457252bULL, 0xd2db5013df328437ULL,
+    0x2292fa3bb5cc51bdULL, 0x96f264207a741a25ULL, 0x6c08674dbb8f06ebULL, 0x1a9ecedd10d47879ULL,
+    0xe0349633ddba2be3ULL, 0x112202cb41d58731ULL, 0x1624612404f42253ULL, 0x47b52f060cdf9221ULL,
+    0x557649c7a242dd0fULL, 0x082935613889f25dULL, 0x56a7bb017714f133ULL, 0x8f3cd1994e2a5bb7ULL,
+    0x6d83e11b102cbef1ULL, 0xfcfe5c669ef1e5a7ULL, 0xa42f151d0dd6ca29ULL, 0xf46d4cce5eb459adULL,
+    0xd27c4efedec814cfULL, 0xd78778c3be9f96f3ULL, 0x8f394c5c1ab5ea6bULL, 0xa7f54b59c848fafdULL,
+    0x602b5b12c4608957ULL, 0x38dbd9ba25cd0e91ULL, 0x818644af51f90747ULL, 0x15540770f9294d7fULL,
+    0x25d7450e6de66c6fULL, 0x1438a87922cbc8bdULL, 0x5246081473e92393ULL, 0xa0b9a13f9e4cd10bULL,
+    0x0ce73f90f6358c7bULL, 0x68ecc57ed402aef7ULL, 0xa387784fef69e2e3ULL, 0x36425bc24b08ca05ULL,
+    0xd7c2e7fe1e7ea0e7ULL, 0x0f244cddf6aeed69ULL, 0xfe5f4fafebce62cbULL, 0xc7bb93f0068afc0fULL,
+    0x3a26f424b599295dULL, 0x14551f28e1e6ba55ULL, 0x185aa25db6520fabULL, 0xb7a874bf9a3393c5ULL,
+    0x1080d45a7010d0e1ULL, 0xa0ca8e6b06bab383ULL, 0xea64813a57097c15ULL, 0xaeb7ed108d142867ULL,
+    0xb6b6a71e435284d3ULL, 0xf589efd3c35d70a1ULL, 0xf9721726fd034c7fULL, 0xe44b9963853bcc81ULL,
+    0xd2fa31036b598d4dULL, 0x1444a52825980745ULL, 0x5c687caa1b6da29bULL, 0xc02df173d5d3e85fULL,
+    0xad7647389a06ef03ULL, 0xae6fc964dfc7df95ULL, 0xb80bae114b999c41ULL, 0x5f73e0df96261679ULL,
+    0xa98f2219260d081fULL, 0xe9290757c73091edULL, 0x985a36c0c406efd7ULL, 0xc667e3eb32a25d3bULL,
+    0x45102fd407f5bb3dULL, 0x6450600cf4284613ULL, 0xd3c3eb2b6421fba5ULL, 0x27e15e7fe8df3a09ULL,
+    0x60e80f3588717bbfULL, 0x1881b75074059bc1ULL, 0xfaa0feecffc8fff5ULL, 0x04f068dd10c69843ULL,
+    0x13a8f2601a194ab3ULL, 0x22dfa402b62d41b9ULL, 0x33fa33301ffc6e45ULL, 0x1e4c7ae902085193ULL,
+    0x576e44900d4df317ULL, 0xd482518c3387e603ULL, 0xee3c35c86ae15451ULL, 0x9eab341e5490a907ULL,
+    0x6aa0fad9ddeb5189ULL, 0x585c12ca8b5c0375ULL, 0xc5a3f4bd904fcf21ULL, 0xa823ed6b9ea75ed7ULL,
+    0x05279adadb677633ULL, 0x3b21a8a723f2e8b7ULL, 0x95c8ff41d67cc6dfULL, 0x2338b0cea6949eadULL,
+    0xcd5b2deb08629bf3ULL, 0x5216d7a5730a0a15ULL, 0xb6cdb5e2023bcb85ULL, 0xad24a4fb2295269fULL,
+    0xebd2ff952b000f43ULL, 0xcdfc2b47f1e6f447ULL, 0x54895213db9e90b9ULL, 0x54c0822192198a23ULL,
+    0xa528608ee5e0eb71ULL, 0xe5662901c7015a27ULL, 0xdb8ccf15e074b8b5ULL, 0x9b4d4d6be3e0ae61ULL,
+    0xeefbd7fbda28e217ULL, 0x24bc3ae458ba909dULL, 0x49d14c08de490089ULL, 0x6a1d82117b090773ULL,
+    0x48e2743b50080331ULL, 0x3c573283adb0ba69ULL, 0x4b4776514f59bfedULL, 0x77494bf5a7610ac3ULL,
+    0xd7715f2dc102ce5dULL, 0x854038f565844d33ULL, 0x4a804680608864abULL, 0xdc5b4f82e8d9b8efULL,
+    0x154c7bf75d888de1ULL, 0x05296bdd5fa549a5ULL, 0x32a4b024af0f74fbULL, 0xabbac0008a915115ULL,
+    0x2205b331af3c79bfULL, 0xd541808b8a20d6fdULL, 0x0b019d04f101bb4bULL, 0x3e9abbbcbe0479d9ULL,
+    0x6ccb8e9eb8cba88fULL, 0xaaddd10b0d181ebbULL, 0x1367f521f19b124dULL, 0xb5b07c0a16d3c123ULL,
+    0x8595c337ddf1255fULL, 0xb6fd026aef7f479dULL, 0x70111ddc89704707ULL, 0x883f632e89df69ebULL,
+    0x5884ef3fa1c49553ULL, 0x748e09454288c51fULL, 0x2d9e7d63b45dba11ULL, 0x9bbdafec81912babULL,
+    0xe60bd8c7905abdcdULL, 0xc966bda9f11b0b13ULL, 0xe6cc0ecf36ea0335ULL, 0x617b8e23e089cce1ULL,
+    0x5a0d46463b7df0a5ULL, 0x2468416eb095631dULL, 0xb98527228e7818c1ULL, 0x0d0d495fbd34da63ULL,
+    0x6a7200c9a12260e9ULL, 0x4f3a8d6677fc94f5ULL, 0xba780bba66e3a49fULL, 0xd9382fc1712f6991ULL,
+    0xccb23ca24de7c881ULL, 0x77633661ef08c017ULL, 0x5f8ee4f7f8500425ULL, 0x2fc95462f2b10f7bULL,
+    0xbf3bd030831a5e89ULL, 0xd613ebed9915ef0dULL, 0x4a37e7e517252f2fULL, 0x6a9dabb2dbd3097dULL,
+    0xc20bba7f1c920c21ULL, 0xd24eb57c6281d059ULL, 0x4ab0fb34a775970fULL, 0xdc24a61a8723f93bULL,
+    0x1c5d635075c29a49ULL, 0xcd82f1f626f975b7ULL, 0x163d68cc7caee3adULL, 0x944cfe02d8948683ULL,
+    0x4d510d44ce691a1dULL, 0xcb3cf4370eaddf15ULL, 0xf75b4fc6b02c8bdbULL, 0x38e6dd4f10074fe9ULL,
+    0xfac21a90ecfc2ba1ULL, 0x8f1be0477ace5165ULL, 0x3324bfd2d772e147ULL, 0xd7c44d43291471c9ULL,
+    0x80c47ed36a45962bULL, 0x955c973ec518c04dULL, 0x233515b5c92a2f23ULL, 0x2a6934d5dcda92bdULL,
+    0x76db811fa71a8727ULL, 0x04470f97e1076b61ULL, 0xa73ff2bdc7ffab25ULL, 0x81a2badadb1ef73fULL,
+    0x962d45bab9ce9f5bULL, 0xd7f9724054348769ULL, 0xd4a96a20d05e1f75ULL, 0x45a9fdbbcab284edULL,
+    0x4183c3dba9ded233ULL, 0x1ca6e75910308701ULL, 0x56df785c7997a4b7ULL, 0xba2c9fd795e0faadULL,
+    0x01b9919fd1c87d83ULL, 0xb2071c62c2aaa509ULL, 0xd7b5c553711df6bfULL, 0x5a7bbffd5c9c4863ULL,
+    0x73b5448b03b78267ULL, 0xace91e47eecba2f5ULL, 0x20b9d4103e569257ULL, 0xcffd3b868707a6d9ULL,
+    0xa538a84d00dd53bbULL, 0x3df53957d8516771ULL, 0x0eb0cc1f4a1e8c9bULL, 0xcf8d6de8c452820bULL,
+    0x167cc83ffa36b903ULL, 0x1c3881d84e907d4fULL, 0x0dd47f1bc0222f51ULL, 0xba88cb8ec8d8b407ULL,
+    0x0fa8a20e4dcaf079ULL, 0xd2a5b261a6b91b05ULL, 0xee74c1c788cbed2fULL, 0xa41629628558f77dULL,
+    0x9bcd157e7a447669ULL, 0x7df00ae3c888c73bULL, 0x7c82e3e2a5b417c7ULL, 0xec01ef3a9ddb85ffULL,
+    0xf1a65bce12d542cdULL, 0xc01cd6af0c0d34efULL, 0x8d61ceb2ef75b6f1ULL, 0xfef7c8c22a1e853dULL,
+    0x959573e87253d013ULL, 0xb844d7445769058bULL, 0x7f4ee8df862f5597ULL, 0x129254847f63e5a5ULL,
+    0x57eb864ad200ff63ULL, 0xcca0703646691167ULL, 0xc716a1d9aaa72de9ULL, 0x33ba57d09a6a619fULL,
+    0x6d4f78f616e4a76dULL, 0xf2dd244bc72cb5d9ULL, 0xb4a76da28de84ed5ULL, 0xeefb5345a19bb39bULL,
+    0x588f7c108a75db93ULL, 0xa61293da957c215fULL, 0x337b036ee115e961ULL, 0x8395620801c2dd2dULL,
+    0x1d601d6a8716f2e5ULL, 0x3bc0a92a2f7ae15dULL, 0xf3d184a3a5692749ULL, 0x0b1f210c38188501ULL,
+    0x5b35b56fc38e6ca7ULL, 0xd356160c2b50b129ULL, 0x373de6ffa6961f35ULL, 0xc5e471b2c9d26b83ULL,
+    0xf6e08c82ef203f1dULL, 0x07ab665984b82a87ULL, 0xcaa2f683827aa5f3ULL, 0x5f8a70f7f697bbafULL,
+    0xc82abf13e3afa9fdULL, 0x07d47d2eec68a09fULL, 0x8e3482c0132ee591ULL, 0xcdad9046a09cce47ULL,
+    0x60b6172a80e0d423ULL, 0x21dfb849b7ea7293ULL, 0xfa143cec9c802861ULL, 0x144809404c145899ULL,
+    0xc6965e184dcfbb4fULL, 0x12179f2f3c4cab7bULL, 0x5c7d1878ab14d5f7ULL, 0x33b5dcd6560a945bULL,
+    0xdc24b43a34160c59ULL, 0x3d0c67430949d4c3ULL, 0xc21a9c6c279a130fULL, 0xf18ec4e2239d1511ULL,
+    0xcec0df814741b955ULL, 0xf588d94e924631b7ULL, 0x312fe3c3a0d12029ULL, 0x4caf4d7133bcfe13ULL,
+    0x32ae09adb9495cd1ULL, 0x0be8235babfbf987ULL, 0x66942089bf6c35f9ULL, 0xf9372f10a5c8df57ULL,
+    0xef586cdd9f2cd3d9ULL, 0x8e29933fb25888bbULL, 0x3881169c176bc381ULL, 0x12905a0ea95f0b23ULL,
+    0x1afadabebee8019bULL, 0x1a3235bd7c98170bULL, 0x6f349736108cdc7dULL, 0x1587658472fb1f53ULL,
+    0xf0f8a865e8f4e0edULL, 0x822636f5ec0940e5ULL, 0xc1c02043dbed04c7ULL, 0x62a79dc4eae3d5abULL,
+    0x90a9cee8e9162139ULL, 0x119bf0bfb5d29513ULL, 0x8514535935082d35ULL, 0x061e4591b21fc5fbULL,
+    0xbbbcd2db3dd16109ULL, 0x0c9feddb81dd53f3ULL, 0xeaf61f9a0e83f2bfULL, 0xe2ba2483658c8d8dULL,
+    0xeb64c1eeefe30385ULL, 0x9391b9dca6d4cedbULL, 0xd71b119750adfae9ULL, 0xec0dbfdcc7ecec4bULL,
+    0xc1d7dfecdeb4aaddULL, 0xda1debb51c496c47ULL, 0x41d476bda4f60d45ULL, 0xf1f5706efdf4016fULL,
+    0x9dc8b4ecceaf5e5fULL, 0xa14dcfb37c53ee25ULL, 0x534aab42b6e7f007ULL, 0xe700ee35861ca595ULL,
+    0x9c446c70d49e723fULL, 0xbb3454ff2e62bfe3ULL, 0x5f73e06f21dcd37dULL, 0x019ec59dfa4c2a59ULL,
+    0x8373505f6bd967e5ULL, 0x282c42c5b2830533ULL, 0x431df18a46038201ULL, 0x90bd4dd23ec49ecdULL,
+    0x6e53f8fe376ffe19ULL, 0x2d3dc45151f65083ULL, 0xfb6954a5813f88cfULL, 0x6fb698c7dcb1641dULL,
+    0x061f6196cc9e91c1ULL, 0x99ac40d973fd3e6bULL, 0x1af4dfaa99c5cb77ULL, 0xbc25a59663b08efdULL,
+    0x874083293fbca5a1ULL, 0x82077be9f185bd57ULL, 0x92e6ce48b2033e43ULL, 0xaf528334ff338291ULL,
+    0x27ebd1677af356bbULL, 0x91fffbf3a2398bc9ULL, 0xe75f8adddac36ad5ULL, 0x7b5193e60d9b0271ULL,
+    0xe901df3893cc3793ULL, 0x874529d1fc61f7b5ULL, 0xec021db40f514917ULL, 0x89273dee045f9525ULL,
+    0xa2d1f45e48de2789ULL, 0xef9858d183f91673ULL, 0x01613ead63bc895bULL, 0x1546081e547abd1fULL,
+    0x4dfac0a4e4d739c3ULL, 0x0b29a2254af4b211ULL, 0x57dfed99e8a3a2c7ULL, 0x572dc35041a5dc33ULL,
+    0x92f61baf4281231bULL, 0x6ea92a942c08d83dULL, 0x463ec54807fe6d29ULL, 0x61affa97409a79d1ULL,
+    0x179bcf8a63a393fbULL, 0x707ce2279990bf09ULL, 0x472e70bfc424d015ULL, 0x36786dd2284f856bULL,
+    0x135d620ca5e29263ULL, 0xa5450b002e3b98d3ULL, 0x2c8750157aae64a1ULL, 0x9b46746acafcfa4bULL,
+    0x1c8ac760f95e6265ULL, 0x8df7bb47856ebac9ULL, 0x54056d2129591637ULL, 0x1131726ccdc0db45ULL,
+    0x450bb16642b6374fULL, 0xda7802515babb69dULL, 0xc3450ee91b16e8ebULL, 0xd9475ca9d0f7ca79ULL,
+    0x0a3410beabf88505ULL, 0x23397c017890272fULL, 0x942bfe87c827b5e5ULL, 0x99e064bda38e2aabULL,
+    0xb1dcb708454a0ba3ULL, 0x987a21b00d5e6eefULL, 0x58c36fefa2af4f3dULL, 0x93d082c25ff64235ULL,
+    0xabedacb9782f03e1ULL, 0xa4eae7c4a03c2f8bULL, 0xe79c013766bb6fbfULL, 0x4f5fb167e93b8fc1ULL,
+    0x8a1965e9787f2977ULL, 0x928028e8080b4963ULL, 0xc53e5ccac7fe316dULL, 0x856000bf4e255947ULL,
+    0xe875ee17b9dd4245ULL, 0x32f90dc2a0909e6fULL, 0x4b801cde651e4abdULL, 0x1b2ef57793db672dULL,
+    0x44efe780ba077a03ULL, 0xb68352827ba4e325ULL, 0x9f807c487cf77a95ULL, 0xbb73a467d4f39979ULL,
+    0xfddf5fbe286be4e3ULL, 0x954348fb69b472e7ULL, 0x0320a623bed77b53ULL, 0x0cb7a52fa244c321ULL,
+    0x2149ec97077092d7ULL, 0x24c3a18cc8882b5dULL, 0x68fadc3d3dfe7effULL, 0x160f055f0c3123cdULL,
+    0x1a23124b8d3935c5ULL, 0x0d9827f841014b29ULL, 0x5de4f0410f244935ULL, 0x28a5c791956065cfULL,
+    0xe7a60664c3e537d1ULL, 0x54f8e38022aaaff3ULL, 0x10c7a82d9ce6136bULL, 0xcc1f64dae4476adbULL,
+    0x8fe82058d09db6e9ULL, 0x4b4f7c09dcf41a9fULL, 0xb4bffc8a4c58bfd5ULL, 0xf3d6647f4b1d3e7fULL,
+    0x5dca09ae46ea44b9ULL, 0xccf1ef2a0ef3fc93ULL, 0x321a57033f850cb5ULL, 0xfcc4ae08deb01617ULL,
+    0x3477562bd85d754fULL, 0x88b567823b6a157bULL, 0x97dc6b252d551b73ULL, 0x05003934a6d6eff7ULL,
+    0xe52c63e237747a1fULL, 0x05ea051f3b5d4bb7ULL, 0x107503b6e19dac39ULL, 0xc22b77026fda3d3dULL,
+    0x74b0f93ea83279dfULL, 0xe6854857b7c5c9adULL, 0x3da5cf497fdd96d1ULL, 0xc37c2bd72b9648fbULL,
+    0x5ab6802c39566dbfULL, 0x1212416c112a5a6bULL, 0x590dc774a87b408dULL, 0x8e1c81b728e70ff9ULL,
+    0xc2d66614ac8b54afULL, 0x82678f484a0fa1a1ULL, 0xc6d82fc7733d1c8fULL, 0xbd5e8cf0cd650cb3ULL,
+    0x3c6977d5e2e5bd81ULL, 0x4b13aed11665264dULL, 0x942f1596d95ceb9bULL, 0x99625c89e1ce8651ULL,
+    0xb37e36ac00c3db9dULL, 0x99b245ae62f60895ULL, 0x04a437d1efdd9ef7ULL, 0xa4b6c5577e87442fULL,
+    0xb421b8fe3042a67dULL, 0xa93659e7bf43b91fULL, 0x57ac3cc28f702e11ULL, 0xa947946f81129f49ULL,
+    0xc42b939014e32a55ULL, 0xdb959f67dddfb0a3ULL, 0xfc0e7dfd7ba21f13ULL, 0xce04c6202ab4c0e1ULL,
+    0x61cbe550a838c919ULL, 0x8e520ae6c251c4a5ULL, 0x9906de0f2af32ffbULL, 0x447cb80b8615f71dULL,
+    0x658eabc0f160ecbfULL, 0xb1713d1099f60cc1ULL, 0xbcfc65c815246d85ULL, 0x55e44bc18662a5b1ULL,
+    0x89a0fbb680a4b8dbULL, 0x93ff6bdd7e7d1867ULL, 0x4cd720ec88eee8f5ULL, 0x7f1539e4f3a1f66dULL,
+    0x5c61ec2376243cd9ULL, 0xcbd44452cf543b8fULL, 0xc960c15fb8bb3b6fULL, 0xc12edbb70cdff417ULL,
+    0x9cf918f5b9d9e551ULL, 0x3530009b7a6a9289ULL, 0xff6c5fe0ad9b09e3ULL, 0xd761502f744e9d7dULL,
+    0x2004204fdabe1fe7ULL, 0xab0e535045c4ec75ULL, 0xc595e807189ddfd7ULL, 0xb71061e2829e8459ULL,
+    0xd468454fcb7c51e5ULL, 0x3b635be77bef7bffULL, 0x58be93eec297a8cdULL, 0xb73dbbed9d84ecf1ULL,
+    0x11c7235610b3e61bULL, 0xe72b6eaa6a164b8bULL, 0x320f0f2c3b5bf7adULL, 0x786935d29c0bb4f3ULL,
+    0x1b91747ee08d8bc1ULL, 0x85d13c102d99e577ULL, 0x081e0d0b962812afULL, 0x5a437cf3b1c51fa1ULL,
+    0x8b2eb76807ac8d6dULL, 0x42ec65117dce9547ULL, 0x9c28e6ec47eeea2bULL, 0x07a86bbd17e8c323ULL,
+    0x765925d4813bbc71ULL, 0x184f39f6d03026bdULL, 0x505733442e865f99ULL, 0x69689e07b3d9524fULL,
+    0x84ae10b3a3330805ULL, 0x16ea0c897870e0cbULL, 0xbf6574e872672a0fULL, 0x5a2cd115a7f9ec11ULL,
+    0x38c078d05b177cc7ULL, 0x3d2fd457a5609939ULL, 0xb57cb25e3462d1c5ULL, 0xc3e44d369fc0dc63ULL,
+    0x4028cebd052371afULL, 0xdb1a5222ab5de3b1ULL, 0xef475c89662df6f5ULL, 0xb7b2ee4cb1bd244bULL,
+    0x3532b7a33e8b4c65ULL, 0x27d521da1f9c798fULL, 0x08c20183699891b3ULL, 0xfc47257f78d63037ULL,
+    0xb14b49440aecd60bULL, 0x0419b5c21e92da2dULL, 0xbb34c4a5e225ee99ULL, 0x118f4c2793a66807ULL,
+    0x4685d3694c5fef05ULL, 0xccfe277fe4431a5bULL, 0x011d039440c48b7dULL, 0x849369a8a319ee53ULL,
+    0xf842fc646b4a7e21ULL, 0x1933b5f465587ac3ULL, 0xd8708f6ea82b2c49ULL, 0xb183f96704377f55ULL,
+    0x6dc1c638e1db79ffULL, 0xff3d2f78fd9ae839ULL, 0x4938c23e50e7a8efULL, 0xec816f83c8e711a7ULL,
+    0x2caa7e21e48c7de1ULL, 0x88244ef7684480cfULL, 0x1b90ee4a66158809ULL, 0xa7ad58880c7469bfULL,
+    0x5b872f245b4289c1ULL, 0x4be964dedf742285ULL, 0x6cf447b419822b4bULL, 0x0cccb46dec7099ddULL,
+    0x43a80d43dd59a2d5ULL, 0xa65869cae9115f37ULL, 0xcf063f8d68186da9ULL, 0x2e912adc6adbf12dULL,
+    0x2e6c5a655010c117ULL, 0xf39fd0b96ba7987bULL, 0x7d5a8a15924d3707ULL, 0x69f331349303d9ebULL,
+    0xe63cccd2e0e7080dULL, 0x7f8d1c766b74c02fULL, 0x453489c1f9939231ULL, 0x3e66635cc125cce7ULL,
+    0xc4012804ebfab159ULL, 0xbc96ccd3a149680fULL, 0x38a9983f9afd755dULL, 0xe76a969c628320a7ULL,
+    0x7b7f1236df5a7335ULL, 0xdfd42ffc90e834dfULL, 0xa50fb10bdfc5ff83ULL, 0x9d116059b70c1fcfULL,
+    0x6516e40cde80d31dULL, 0x92a962a63120f277ULL, 0xfb273993e0e150e9ULL, 0xbc1acdb2070c50d3ULL,
+    0x1a334b05039c6d43ULL, 0x4a0bf9c4bded5991ULL, 0xe74cc3eb01708247ULL, 0x4d74c375a267387fULL,
+    0xb371595671f2594dULL, 0x623b07a29442b76fULL, 0x21ff470651971c61ULL, 0x448086ece69b0c99ULL,
+    0x92d8c9cc9b5f7f7bULL, 0xab3e69136d9f2573ULL, 0xfedda02579ab5f0dULL, 0xbfb9c472559109f7ULL,
+    0x5db93b024a4de5e3ULL, 0x473434f70adf0875ULL, 0x326719a5763e69c7ULL, 0x808e1afba3dc62abULL,
+    0x1d69a6ee7d925429ULL, 0x4fb99582516c1213ULL, 0x0f3c86e8c72cf3dfULL, 0x87a69d37f810fbe1ULL,
+    0x5805d078de2dad87ULL, 0x3eb10eb3c2324f15ULL, 0xf53641819c62046bULL, 0xdffa99cdced5c0b1ULL,
+    0x13920aa956481ba1ULL, 0x1c19c6d4b57e1357ULL, 0x5ac83f994dd216b3ULL, 0xda778757e0a6304dULL,
+    0x6696636c95a43871ULL, 0xb747132d27a9d59bULL, 0x37a5e5c9372c1f2dULL, 0xe7d5b8d1fc9f7e2fULL,
+    0xc626ed04fa290f5bULL, 0x1eb09de02439dfc3ULL, 0x9686dc837cbf14e5ULL, 0x42e4b66743b9d03bULL,
+    0xa40575d79a35d455ULL, 0xe4c9bab07735d539ULL, 0x33071d5399fcfaa3ULL, 0xb664b21a7bc787f1ULL,
+    0x2006c4bd3289a913ULL, 0xad924168bfddee8bULL, 0xf964eabf0b045697ULL, 0xfcd7ed6568f7aea5ULL,
+    0xe8134c0f12059509ULL, 0xe3645d55a9e0a18dULL, 0x28667d85218dd785ULL, 0x3312636056ec5fb1ULL,
+    0xdd1da0928e607267ULL, 0x2b3e2ea0a435404bULL, 0xc4eb04cea079b681ULL, 0xf51537682d8779bdULL,
+    0x2cfdae8903d0b493ULL, 0x08582255f0e14d7bULL, 0xbda811d53b9eac89ULL, 0xd00fe95a29b5aeebULL,
+    0xff961d2f76e1dd2fULL, 0xb127ee1026e46f31ULL, 0xbc1e080d4a0e4a53ULL, 0xe59a6dec265dc50fULL,
+    0x00ef60fe74bf1a5dULL, 0xa9131c84be511933ULL, 0x20f340d5cd9b75ffULL, 0xb2ee06ff713431a3ULL,
+    0x521bcabbbc993229ULL, 0x6f1234e3bed1758bULL, 0xd8ed9d526b79f81dULL, 0xd20a84525ec485c1ULL,
+    0x070b1d5dea2587f9ULL, 0xc9e5771305ce4cafULL, 0x01d7d3ff55c595d3ULL, 0x23be94eb1b5e519fULL,
+    0x99e3346cda410f65ULL, 0xd216e4d67eb06f47ULL, 0x5007bdd9899bbfc9ULL, 0x6403c869840bde4dULL,
+    0x3539b64489f1790bULL, 0x04e36606caab347bULL, 0xeb6c9c36d211939dULL, 0xda11cd2209e70541ULL,
+    0x8a6c54f11b0b16f7ULL, 0x5e3f8ff2be2b0ae3ULL, 0x7f5aedcb46e67205ULL, 0xc89a6416caee0e31ULL,
+    0x00c54ac504b408e7ULL, 0x340ed38e8ac72611ULL, 0x8d6746caaabe515dULL, 0xb19572072650f2b7ULL,
+    0xa12cd0e5950c7339ULL, 0x278bf4c0976d3bc5ULL, 0xc6d267d80576f71bULL, 0xac2a011400c6b8e1ULL,
+    0xc394522150719067ULL, 0x00a72905b45b20f5ULL, 0x8f2106119c979571ULL, 0x9056c7385d414a9bULL,
+    0xf6b8018bffbe000bULL, 0x5a04bd75bc5d4899ULL, 0xfa14589254a9ab4fULL, 0x7c1143059a888173ULL,
+    0x39f48b1c1916557dULL, 0x08d115ac70094469ULL, 0x0aab0c4a900c7853ULL, 0x145e1c2725ecf821ULL,
+    0x3f37438d7c4ba5c7ULL, 0xafe2dacdd4de2955ULL, 0xaace0520f36f73ffULL, 0x34050e3b39849fa3ULL,
+    0xe475e5512f016ba7ULL, 0x3b043b7756d29635ULL, 0x951bf2ba8ddc2397ULL, 0x3a19b75bbf37a209ULL,
+    0x21793525f1d66cf3ULL, 0x4e301e74366f5d77ULL, 0x866386d2cfd197dbULL, 0xfd01fcd9dcfda7f5ULL,
+    0xf0452840ffaa528fULL, 0xd9a72d1fab7d72b3ULL, 0x4905db845bfbb381ULL, 0xab56814a9f34a9b9ULL,
+    0xbb1505f46e8f126fULL, 0x367ef540c60307a9ULL, 0x31e2c5c3f7618f5fULL, 0xbc8afb213cec5b17ULL,
+    0x4295130f1ee70e03ULL, 0x3a9df750384cb725ULL, 0x46f6bd149afa3c51ULL, 0x9eb127a1d4f7120dULL,
+    0x30ff741019c8ab75ULL, 0x680a8140b62918cbULL, 0xb14fc2921f190b59ULL, 0x3d5017b990336c3bULL,
+    0xdf3311cb38a87301ULL, 0xbe0e38fd5e9dd6a3ULL, 0x7269a65f699609c5ULL, 0xf43222c2b8100a8bULL,
+    0x8135358551105f19ULL, 0x37e8605d227ab887ULL, 0x1d9ed3d4d0bb02c1ULL, 0x88612c67e144dad3ULL,
+    0xd31c6dc0f2330e9fULL, 0x7ac58d40b9f89391ULL, 0x6615552ebad94cc9ULL, 0x52335ef9ee1f634dULL,
+    0x1c094bc60c63d371ULL, 0x31ae27230c4f1093ULL, 0xa662e0399b174a17ULL, 0xfde7568aec3e5e25ULL,
+    0x81fc8acb1bf3b89dULL, 0x79aef3f596b7690dULL, 0xe66d70f5e12e2fe3ULL, 0x2a7d3d528820525bULL,
+    0xfaf3cbf8ec072269ULL, 0xab7e63ae9a276e1fULL, 0xbad12d0c80f7f65dULL, 0x0a147848866643c7ULL,
+    0xd11efa5f96c37201ULL, 0xfb34fd926323d13dULL, 0xceda0db14adf6ddfULL, 0xad2d047ed422ddadULL,
+    0xac5cc778955b7ab1ULL, 0xfb2cd4206402634bULL, 0xf4c9318a3dd5e1d9ULL, 0xfb6fdd4afb29c6bbULL,
+    0x6a41b0a2be6a51ddULL, 0xf5fa1e405cfc7bc9ULL, 0x715f1c83580d317fULL, 0x7adc89f8cd74e445ULL,
+    0xd13c5f329f3cf271ULL, 0x34870e0a22aafc03ULL, 0x45da96ab4629884fULL, 0xea7894f6fe9afa51ULL,
+    0xc70025a9d0755c95ULL, 0x2b4febf0d7f1d2f7ULL, 0xae6323c2daefb82fULL, 0xa24fb86a5e56f95bULL,
+    0x2b37f00a312ebd53ULL, 0xe8a4323028a4a4d7ULL, 0xf8fb6393192ea9c3ULL, 0x50c4a2c0d83892c7ULL,
+    0x4cf960a0011e70ffULL, 0x7e8e889b6120483dULL, 0x925879b19d52ab35ULL, 0xe634dbca348d188bULL,
+    0x9b804bfd91c598a5ULL, 0xbca94d946c42e0bfULL, 0xf8ededddc8e6ab8dULL, 0x797a7828cfbe0263ULL,
+    0xa8e2014c39cc8cdbULL, 0xb129e7b59b80c8e9ULL, 0xf4d3f9801d750a6dULL, 0x9edf7c2061f4f0d9ULL,
+    0xe4abf900290c5191ULL, 0xa6cd3cd30566772bULL, 0x73a8cfb418b74b45ULL, 0x4f90053ca27b54a9ULL,
+    0xebc5ee3793a8cc5fULL, 0xaea54fcd53ddf303ULL, 0xce4a75958d4fac25ULL, 0x68dba01af1f6b77bULL,
+    0x35becd2b90c07e07ULL, 0xdaba111315dac689ULL, 0xfac35545e724ba79ULL, 0x96941353fe6a317dULL,
+    0x4c523540cc2bf421ULL, 0x54349b8b40707f0fULL, 0xb4253396102f0249ULL, 0x976fbfe6abe5ddb7ULL,
+    0x979ec1aaf5e63ec5ULL, 0x5a1a7f52c655a7a7ULL, 0x132603348de49f8bULL, 0x3af2a1a83da90badULL,
+    0xb545df55c824c8d1ULL, 0x98325056a6042587ULL, 0xcf9af08490cbc8f3ULL, 0x0e09a9dc37437fc1ULL,
+    0xa1a30426f4fc3c6bULL, 0xaaa4297e91ac86afULL, 0x40f539c409ac33dbULL, 0x600ca11b6261f965ULL,
+    0x56c1d36e429c94bbULL, 0xa3e186cfee2ce84dULL, 0x720c93dbf1075723ULL, 0x147909dead25babdULL,
+    0x7aaf7f8a45d4d593ULL, 0xcf46e64166ea75b5ULL, 0x89dc049df1d4c64fULL, 0xa9c7a86256fe7589ULL,
+    0xa89e018faf6bff41ULL, 0x86d94c0f0ef46e0dULL, 0x3618ab92be872b1fULL, 0x0eb9f31f80954759ULL,
+    0xded32cf9de540c55ULL, 0x1142bb87988f61abULL, 0xb0f1a44f1ab5e11bULL, 0xe8f10407be5bce97ULL,
+    0x28000e1ad17dd1fbULL, 0xc9318a0e4eb9ce15ULL, 0x016235e659e3598dULL, 0x200c8d76e60fe5afULL,
+    0xc4f4d853f46957b1ULL, 0x13dbc37efc43d2a1ULL, 0x780143f4cdb0fa57ULL, 0xd5d2907916a2a5b3ULL,
+    0xaf0024f188dabf4dULL, 0x780b0b4c5ab032a9ULL, 0xa563dfc715057cb5ULL, 0xe06a0f0e20fa8b73ULL,
+    0xfea5f47c783e3195ULL, 0xcaead910839e7e41ULL, 0x312b11fa7fae5879ULL, 0x7760c3ee335ade69ULL,
+    0x25025d87ec170253ULL, 0x71290717b7b073e5ULL, 0x641a10b490cc3f11ULL, 0x8fef01fe6c926f3bULL,
+    0xbfc4cf92b8216049ULL, 0x7430763cb19a28abULL, 0x1c14824f72d1ad3dULL, 0xd75496f66d1f71e1ULL,
+    0xa8b125a87adbf4cfULL, 0xf3db52f55e287dc1ULL, 0x19055dd41fdb7777ULL, 0xbca82112ddf67967ULL,
+    0xb925e5fa85c48a43ULL, 0x33e25d132408ee91ULL, 0xe303f091a0572dddULL, 0x379a0a24e76af6d5ULL,
+    0x1887cc4a738dcc2bULL, 0x80d286fa6c9b9337ULL, 0x6cd44489355a8045ULL, 0xe8c26fdb6ff5a1a9ULL,
+    0x39c20fb31233d161ULL, 0x4b8ef49edcbad803ULL, 0xc98331b1d3dca125ULL, 0x57e84822d75bd389ULL,
+    0x6e14cfbba313dd3fULL, 0x5fec982a3ecf2debULL, 0xa48970a1e2ef1c0dULL, 0xdd85daed68c0c2e3ULL,
+    0x87664cf1efb2167dULL, 0x156401c5487080e7ULL, 0x4f3e3d16946260d7ULL, 0xd1efbc62829dd63bULL,
+    0x2cdb1f9909686d01ULL, 0x2cf3edbf306320a3ULL, 0x6ee53e4e20c2bdf1ULL, 0x1f490bf542431929ULL,
+    0x6e935917021d28dfULL, 0xc4648cc247cacdf3ULL, 0x4b51f1273fd25c15ULL, 0xd95c7ec47ae9116bULL,
+    0x64d8d7f2968ed1fdULL, 0x3ac09f4ba735c9bbULL, 0x6974060b49e41fbdULL, 0x9be96c8613031c27ULL,
+    0x8f52ba65b63ee417ULL, 0xf3186bd73dd2537bULL, 0x6708f8700f46029dULL, 0xa324e2f68bed3df7ULL,
+    0x6b2499b4f5970fe7ULL, 0xe487575b93ed5c75ULL, 0x460264c2d08371edULL, 0x7fc29128e3d4fb0fULL,
+    0x24e160bb81061dc7ULL, 0x4144bf89158f6c01ULL, 0x1c053708c2ed3a39ULL, 0x38cd76eb8b46561bULL,
+    0x818e0a74a1615bbfULL, 0x1d187d3b3c995e8dULL, 0xf81df0d3cc059563ULL, 0xd4b483f7d3ee02afULL,
+    0x132fb4d8539e8d4bULL, 0xc0578bb8b5134757ULL, 0x5f771507911e3bd9ULL, 0x8bade287ddaa9565ULL,
+    0xb439c90e86f42ab3ULL, 0x2832a9b72b2c2b27ULL, 0x447d56c034f7875fULL, 0xa9ac59cc51d5332dULL,
+    0xb98857871e36b99dULL, 0xee96f07a812fbbebULL, 0xc01da9648807af21ULL, 0xa9db35f627953ed7ULL,
+    0x536ce0db3f15efcdULL, 0x0ef6816ebb758939ULL, 0x795b3a143e29f2a7ULL, 0x56524040cd912ee1ULL,
+    0xa3260c6069578a97ULL, 0xfc47910b2cbb82a5ULL, 0xfe1026ecffe2d51dULL, 0x65a900a2fa59c909ULL,
+    0x3b64ae6535dc4c63ULL, 0x8ce9db1ab28f2667ULL, 0xad1d65eb56c666f5ULL, 0x3636c6bd6bbd069fULL,
+    0xccdffbee93b1d2ddULL, 0xf9b4b29734edaa81ULL, 0x23bcc741eae870b9ULL, 0x36cd1fa57e60e96fULL,
+    0xe4a5e72cb96bc893ULL, 0x7bd37cd0b6c1465fULL, 0x5939e7b889f39625ULL, 0x7404c87e129c9351ULL,
+    0xeb6331fb4fa35807ULL, 0x523b6735f91ee089ULL, 0x4c368594698b4d95ULL, 0x0f45d7ab2522512fULL,
+    0x484d1ffa3c5357cbULL, 0x81d9e2431ec59259ULL, 0x215f6c8f4e5e1c49ULL, 0xbb4ba391655d65dfULL,
+    0x204619d25cce70cfULL, 0x48c980bc58a902d1ULL, 0x9943055527e28c1dULL, 0x5024be58f84fd2f3ULL,
+    0x1dc2678e351a3115ULL, 0xec93e78122392b6dULL, 0x0778e0641b71c86fULL, 0x61c0f015c7129fb5ULL,
+    0x91b06d4d3e28cd61ULL, 0x5adf18af9c0fb117ULL, 0x11a62462f3806d99ULL, 0xeb717d563338f941ULL,
+    0xc9e99ffcd11b9ee3ULL, 0x706367d76bbd8231ULL, 0x58247094d5e4315bULL, 0x61f14d0dc72036edULL,
+    0xc26aa7fb2d3b580fULL, 0x5ac95d2199b20433ULL, 0x00160a9c2f2eb655ULL, 0xb2b0314144fa0fc5ULL,
+    0x992709af5b1577efULL, 0x92c134cff76c003dULL, 0x39268d70d6c9acadULL, 0x6ad918a436f56f83ULL,
+    0xc12ea5a625213bfbULL, 0x83857fb1470ece87ULL, 0xa64a8d64e7792709ULL, 0xf703fc892a8e2d6bULL,
+    0x139e5b48d9640af9ULL, 0xfe4ee4f0001b11b1ULL, 0xe07556f4492dc0d3ULL, 0xa4d7820d25ad74f5ULL,
+    0xe5eddddc103ea78fULL, 0xf31d7c648477287fULL, 0xaefc23a9dd1d7e37ULL, 0x788595b0653b1e9bULL,
+    0x02049394fc90782dULL, 0x53b23ca2e2215151ULL, 0xfaf6d83c0f5ef607ULL, 0x61f4c8f9131d90ebULL,
+    0xcb4ca22230862d05ULL, 0x8190768ee390d85bULL, 0xb799367814b47869ULL, 0x3d9b09a1549ad8c3ULL,
+    0xb26074de7fb359c7ULL, 0xf171522ac55474cdULL, 0xb731c8d779fa7639ULL, 0x1e7dcb1b681f33a3ULL,
+    0x8b496355a502773dULL, 0x089dad0c451c8419ULL, 0xd2a3eba13efbaecfULL, 0xc52b0bec36d680f3ULL,
+    0xb97fd51fcf0777c1ULL, 0xdeb6ca61a02fb0b1ULL, 0x3188eb67c2bf5443ULL, 0x70b46ec3530bc68fULL,
+    0x4bc3120698b7a781ULL, 0xef94e30d28de762bULL, 0xaaa1b71bafd4ad37ULL, 0xdc62143df88b8f17ULL,
+    0xb1de59b5d9b6b051ULL, 0x31a6efc49923ed89ULL, 0xde0751c002eed73fULL, 0xc5fea01451b8d7ebULL,
+    0xb60a3937b4a70179ULL, 0x0fe54cc846d56e2fULL, 0x4178637cd2eeff75ULL, 0xf2a31d3e6e8d6ccbULL,
+    0x184eb704cacd535dULL, 0x7712d55bbf98a949ULL, 0x30306caadf19b233ULL, 0xa57473987a92ddc5ULL,
+    0x202d5be678f62ea7ULL, 0x86d3f32c6dcba2dfULL, 0xe97e8066cb5b1319ULL, 0x4097a7463ed61fd1ULL,
+    0x98b461c2e05ad7f3ULL, 0x955cb639db8c0615ULL, 0xe8d0f5ddd248f6c1ULL, 0x5eb0ebcecee14077ULL,
+    0x0ed5c8d90f3ba8f9ULL, 0x26c7d32e10d712dbULL, 0xec86b5150ceb67d5ULL, 0x9ed8a30dde31774dULL,
+    0x6135715358554771ULL, 0xa68ca78baf2ee9bdULL, 0xbdae45695e0a2493ULL, 0x77e1dbce923e3225ULL,
+    0xd750008542c45d4fULL, 0x49cc07fcb8cc563fULL, 0x0a2854bef38f57f7ULL, 0xaf4cf4401cb6c3e3ULL,
+    0xaf40b00518f5fb05ULL, 0xea6b4b1c4f0469e7ULL, 0x0c1e626b0576fbedULL, 0xca25f9b992133711ULL,
+    0x79cd18f1d94e8933ULL, 0xf0475977492914efULL, 0x566eafd9ae49401bULL, 0xf6e6ff658226b013ULL,
+    0x56699384741ff1adULL, 0x5544303ef1f7df63ULL, 0x636c94c44ed43cafULL, 0x7563c743e2d792fdULL,
+    0x040e54fe877af167ULL, 0x34ebf70256a189a1ULL, 0x0987b878d610e5ddULL, 0xfae7f0ee8121257fULL,
+    0xb242d79dccff7d23ULL, 0xe24dd4a3d6c66671ULL, 0xbc4bac342e8abbb5ULL, 0x71654d7072116307ULL,
+    0xbdc9dd7b7fe165ebULL, 0xa358255eabe606f7ULL, 0x244be32378382c2fULL, 0x825da2fba7e03dc3ULL,
+    0xa0561e586dd10e3bULL, 0x13f73fe7a21846c7ULL, 0x80027a3c3f2664ffULL, 0xa049a91874f04ca7ULL,
+    0xe670232c9e76ff35ULL, 0x421a4f4397752497ULL, 0x97f641b738c08bcfULL, 0x3fc4357a19f71f1dULL,
+    0xb7ece285b0aabf8dULL, 0xb00f596c85398db1ULL, 0x752323fa34dffce9ULL, 0x65b1d56f6b35be4bULL,
+    0xfdb5aa7f4ba7238fULL, 0xe72f212f31a6ae47ULL, 0x184cfdade1001f45ULL, 0x805cf8c180a3ba9bULL,
+    0x3c83c366d897d7bdULL, 0x4e6a319eda91c05fULL, 0xa366ca1551e80861ULL, 0x49e53c37b02e5c17ULL,
+    0x475a499eb7c2cd51ULL, 0x811504e9aefe3207ULL, 0x8286d429e40af795ULL, 0x298c6e8c45762b0dULL,
+    0xceec0b45786c31e3ULL, 0x661e6f4da0968b2fULL, 0x4730caf274c19475ULL, 0x4ddc1bed8f953649ULL,
+    0x5a30a7129f0f6401ULL, 0x19f00b95b63fd4f1ULL, 0x1f4ff2fc5b12f38bULL, 0x2baf093056c74283ULL,
+    0xd007e35df5be2acfULL, 0x00ac144e6f32d61dULL, 0xdc8a079d41e615f9ULL, 0x704893f89a9ffc85ULL,
+    0xb22a79d3598cbf9fULL, 0xc558d88780e2b56dULL, 0x9ae04e5cabd6bf57ULL, 0x2db85154c333237fULL,
+    0x72daac55e7eca327ULL, 0x14eaf2b9aae2c9b5ULL, 0x4c1982e1e948f70bULL, 0x45b02edf1cb03a4fULL,
+    0x2eebdb6d7b1f4873ULL, 0xc0181704a358d33fULL, 0x05506660854df341ULL, 0x4eebd87ea6c816e7ULL,
+    0xcb8de063c3fe2369ULL, 0x757c6d675e1988cbULL, 0x31937df6bbc9fb59ULL, 0x28816c91b5ded411ULL,
+    0x5d962ba242b16055ULL, 0xbe4b6cc49b486301ULL, 0x71a0e7377e48ca3dULL, 0x106acd02e1ef0297ULL,
+    0xe72137b3b408baa5ULL, 0x144990fd24c39bd1ULL, 0xe149e4eb8a652215ULL, 0xc4680263cd3a77fdULL,
+    0xa0dd75daaba64ad3ULL, 0xd22c9e518c64c6a1ULL, 0x63a1ce5d64f3b227ULL, 0x0cfca193cdc73e5fULL,
+    0xd66cea7a15b5022dULL, 0x3d8cd40692335699ULL, 0xabfcbaafc57b3aebULL, 0x4f8fd453d2ef25d7ULL,
+    0x341f3b3d578ba2c3ULL, 0xb3a76d3f5d7e47e5ULL, 0x4685131d5be6b311ULL, 0xbf234cef4d507da3ULL,
+    0x7150b84cde2079a7ULL, 0xdba6d62e8784018bULL, 0xada96326b740f197ULL, 0x7dd8eab9e83761a5ULL,
+    0xb197b040a09b8cfbULL, 0x9a8a57aea67a8af3ULL, 0xe570642db79bab77ULL, 0xfb2afbc973756ab1ULL,
+    0x20de87dc469d55dbULL, 0x94dd94b1efbf3d9fULL, 0x7881370b8e90808fULL, 0xb6649a6b3d81a181ULL,
+    0x19db532f3405c737ULL, 0xfe3bed685230c06fULL, 0x5f940b12b8e03cbdULL, 0xed21cef7a272c561ULL,
+    0xb08c3d798b5d407bULL, 0x5215b56ca689cc95ULL, 0x972db3b08081d13fULL, 0xa8c4d543e2e29d5dULL,
+    0xc38b061edc53c349ULL, 0x8537b6143760bc33ULL, 0x763fe773162455cdULL, 0x14aaf28561d5888bULL,
+    0x47ca93d115eb07cfULL, 0x859637e970754687ULL, 0x0755d4e14f02e1f3ULL, 0xbccf07c128f8656bULL,
+    0x5f53df7cd896fcdbULL, 0xc4f88a2fb90644a1ULL, 0x08b1965bbde34265ULL, 0x78c8d76436b69dbbULL,
+    0xe4b2389a10b7ea47ULL, 0x300c2389e5b411d5ULL, 0xb6a3094215f386b9ULL, 0xd8cc504be8cf9f6fULL,
+    0xcb51da62b47a0171ULL, 0xdfa8c5aa96e1b3bdULL, 0x7022c76a4f648c0bULL, 0x507a57891d6a174fULL,
+    0x2213996ea3a5277bULL, 0x3aa7183186b37041ULL, 0xc32bee0cce2971f7ULL, 0x395a3a9c1697dc1fULL,
+    0x65678311515285edULL, 0x316815a93e3690c3ULL, 0x4b16c32a37b3d45dULL, 0x270fc18063ff6001ULL,
+    0xcc2103b7b2acaec5ULL, 0xaa69a7025ab6e3e1ULL, 0x3d3c7b1f27ab5afbULL, 0x95a11835c6714e09ULL,
+    0xfe2d847a3cab4fbfULL, 0xb629420765f276afULL, 0x43635b9301aa4b67ULL, 0x07f84465e60b8fd3ULL,
+    0x0fe98d9bbffa03a1ULL, 0x44f3fa641a002fddULL, 0x56fb055d8adbc9c9ULL, 0x35e7a7480983b3a9ULL,
+    0xe6ebcf0344cae5b5ULL, 0x7a8b6e2f0a865a03ULL, 0x160f0bc7798b4d9dULL, 0x3ad7e5dde3d03d07ULL,
+    0x13a3ffe025a05a95ULL, 0x7cf6377d7d8d7979ULL, 0xb4d2c228ac09df69ULL, 0x0b1f2d538f3a5b53ULL,
+    0x7e7e19d8c6ab1b1fULL, 0xc0282ce6236a1cedULL, 0xdab03365c84a5011ULL, 0x182e796acc33783bULL,
+    0x9d291706ca107c55ULL, 0x6878c7c6e9ec03cdULL, 0xb885adb94c6222a3ULL, 0xf4e469ec97462defULL,
+    0xdfd0843800726ff1ULL, 0xaa4607563917d113ULL, 0x2a399ea4b7d78b19ULL, 0x42e15873b1b445cfULL,
+    0xbea171cf6773691dULL, 0x180af6cda69ceec1ULL, 0x0f134264ed5c4adbULL, 0x9f7119eebea066ddULL,
+    0x8b0ce2ea0f719fd5ULL, 0x4d19fbb4197b5437ULL, 0x278c458d06e08945ULL, 0x3993b35cda155e2dULL,
+    0x194ae6826d855103ULL, 0xd69bc7e995b36a25ULL, 0xd9865dbb9ed10c07ULL, 0x642f348a4d5c56ebULL,
+    0xe69b18e18e32350dULL, 0x49b31e7bf9bfabcbULL, 0x03cab7615c02e3e5ULL, 0xb91bd631470d4133ULL,
+    0xb6da13057fc32bb7ULL, 0xd10716df4af2781bULL, 0x3af01b23392e1d8bULL, 0x4a068c9092b81a19ULL,
+    0xf52c3a4795e5e4cfULL, 0xaa984090d10976d1ULL, 0x4215a807f0133a6bULL, 0x13f0f07a29466777ULL,
+    0xdc7ac27da1856685ULL, 0x5eb1a71b1bebfa43ULL, 0x15860c136cc027c9ULL, 0x952fa715339766d5ULL,
+    0xe5ddd2f1dd9a3c2bULL, 0x1606a8328c8f73b9ULL, 0xb8f5d7ba42293523ULL, 0x34a6358119175e71ULL,
+    0x7b84e94f56a218bdULL, 0xad62029eadb57393ULL, 0xde13963bc4cf2199ULL, 0xf8e9a1a522f1f44fULL,
+    0x317273512ca0dc7bULL, 0x38ad31c1d2d55273ULL, 0x27580e98ea648c0dULL, 0xc7de89fbcfacf631ULL,
+    0x3cbc099ac26970e7ULL, 0xaf30efdafc62bec7ULL, 0x19b606bc6cc85d01ULL, 0x634779b29b0bdb39ULL,
+    0x96bda364d9f918dfULL, 0x0d1cc1a365fca0e1ULL, 0xca28e71323c90383ULL, 0x270d63a1a823d5d1ULL,
+    0xd506ae7ae3a9bef9ULL, 0x02da759995d685b1ULL, 0x8cf09d39ca4e41fdULL, 0x72254260174c39bbULL,
+    0x212c7a778afd56c9ULL, 0x5e7b73b9f2e5c3b3ULL, 0x284c8fe70ccfb237ULL, 0xe718a411a1240c27ULL,
+    0x7d569ef0bd37b85fULL, 0xbc92c8147bc18c2dULL, 0xe83b3222668ab099ULL, 0x708a50cd5f30934fULL,
+    0x9af87e382edcaa07ULL, 0x7d10ee7858a82df7ULL, 0x2c3bfcff366d7d7dULL, 0x88281587fac6a053ULL,
+    0x84d14d06c146e021ULL, 0x7bc65429f42ce1edULL, 0x661c0da46bcbbfd7ULL, 0xa077431a6e1fed11ULL,
+    0xcd423199e208d155ULL, 0x77bd9bb156ef5bffULL, 0x82821caf53ddcaefULL, 0xb3330b44406b3e35ULL,
+    0x9f5ccfaa8197dfe1ULL, 0x096375b35e672b8bULL, 0x2e0ae78d9e528b97ULL, 0x0fb8c873343694f3ULL,
+    0x8e0b5b72b8f73485ULL, 0xcf4a3af6930c8767ULL, 0xf81bb287b33c63e9ULL, 0x28a9041e4b5efd4bULL,
+    0x96a11f163e3f2bd9ULL, 0x1985354296bd0bddULL, 0x8d96f0e6828e199bULL, 0xa61e509df414a193ULL,
+    0x5846c810db7c5f25ULL, 0xfd3cdf3c5fcc2189ULL, 0x1150dfd6a1942bebULL, 0xe47eb2bc08473a0dULL,
+    0xbf137c2c8a6da0e3ULL, 0xa955788a49863431ULL, 0x8159905bec83747dULL, 0xf2ca517426e39f21ULL,
+    0x67a588fa0d4758e5ULL, 0x3f3fec35d0cb0a0fULL, 0xc47453a34aed143bULL, 0x9e13938338a65affULL,
+    0x6f83400d91feebf1ULL, 0x8075069b0fc5c719ULL, 0x31e37bcb918af183ULL, 0x51f9d689708e451dULL,
+    0x9e482d8f83c2ebf3ULL, 0x69a05b968b040f6bULL, 0x66ff639ab22ee6dbULL, 0x1454fb05d91702d3ULL,
+    0xec82ec70591abea1ULL, 0xc77c38066e902c65ULL, 0xfd05407a9cb5c447ULL, 0xbb4874eaade38b4dULL,
+    0x94cb9290f0f3da23ULL, 0x5ae7c3f2b0a42a27ULL, 0xdd1aff22f47608b5ULL, 0x797a08390a5db60bULL,
+    0x76a0c2243b85b217ULL, 0x94c1a014ab37ce99ULL, 0xfa0d2a0210346a41ULL, 0x52e5f21cfdf7910dULL,
+    0x38908480aa9f57e3ULL, 0x728b00ab5cb7fa5bULL, 0x848fb8e60add8a69ULL, 0x8d9182ebcbeeda75ULL,
+    0x96cc3e31602d561fULL, 0x3ea52930d5a3c7cbULL, 0x5bb7e380ad968259ULL, 0xf10245854fb5abc7ULL,
+    0xfe049119f5fc9d33ULL, 0x1532822be99db4abULL, 0xad0994d70aeb18c5ULL, 0x47e08eb817bd05adULL,
+    0x55261ba2915ea115ULL, 0x119d441807f02bf9ULL, 0x5b7bade767a47363ULL, 0xfdc1dd8c2f4262b1ULL,
+    0xda19dbec1da55df5ULL, 0xb3321f96d6bb6ebbULL, 0xd2549d6a296fda71ULL, 0x1c3a47c388d2679bULL,
+    0x9d2b48af20e64da9ULL, 0xe52c98ffb1aa2403ULL, 0xd404c65c2651979dULL, 0x1e8eecdf9206ae73ULL,
+    0xeb55b68ffc10e941ULL, 0x394a0da885ae5379ULL, 0xc19406e1e903b605ULL, 0x26985ab0d660a02fULL,
+    0x58f83febab0d627dULL, 0xb01376d0f6b4951fULL, 0x2ab8372b84370cd7ULL, 0x735a12d22b678a11ULL,
+    0x296767ae35d7fac7ULL, 0xf669b70d5c0e58ffULL, 0xec376dfdc90367efULL, 0xf0c1889f1b83703dULL,
+    0xf08d33a6feb9c08bULL, 0x37cbfa606c28e519ULL, 0x4aae8f0c0a8d40a5ULL, 0x84705e9a100ed38dULL,
+    0xb0b4a81abaf4e985ULL, 0x51982ce403d93467ULL, 0x76a0967d365f30e9ULL, 0x3fc0ea5e53fb326dULL,
+    0xdedc83932bab4d43ULL, 0x9b384150c120978fULL, 0x19af23eb1d1d8e9bULL, 0x15ec707e81556bbdULL,
+    0x6b162e451fed1b03ULL, 0xb65129366d674151ULL, 0x6d04ee46391b2e89ULL, 0x136a8f52e197483fULL,
+    0x5784453522282279ULL, 0x72ac458742cb1131ULL, 0x75a4544b6dd63be7ULL, 0xd4da135bb8f9d5cbULL,
+    0x0ecf63a52c95cde5ULL, 0xa57bc84163784b33ULL, 0xd7bb1a6e7391e4cdULL, 0x5a602d831d82a3a3ULL,
+    0xa9014d7d4a5f5a35ULL, 0x2b232fcb31757419ULL, 0xdb4965984842d683ULL, 0x8bb2441d82878d87ULL,
+    0x7a6a579b236bf0f3ULL, 0x3ff4f963586714fdULL, 0x06a86cf32743b39fULL, 0x1dc081938c75a165ULL,
+    0x41756415885c10d5ULL, 0x8b6038c37e2b766fULL, 0xf36cd384ee9d5727ULL, 0x722100537b427b99ULL,
+    0xe8f139103c39059dULL, 0x171f576c544fe741ULL, 0x5b3b8d44daa198f7ULL, 0x5c8c9b4b8b82cae7ULL,
+    0xa7ebde7ceb0ed4edULL, 0xeea9595971aeb455ULL, 0x1624f3dda99074b7ULL, 0xb1653d53fe21891bULL,
+    0x1328de345b9c8913ULL, 0x4af968eaab4c0fd1ULL, 0x7275425c03615c87ULL, 0x1a476bb2c6bb7509ULL,
+    0xeb09d33499592b6bULL, 0xca4e3857ee65167fULL, 0x99f3e831085ee74dULL, 0x6776d18f221ccc37ULL,
+    0xb067562dc220b623ULL, 0x40d53d6e2a05dc9bULL, 0xe1876cb876fbd20bULL, 0xf51c118fb0b3ff51ULL,
+    0xa0866cc5bfb2b373ULL, 0xd81fe7aeb4b26641ULL, 0x6d3124dfccf14669ULL, 0x693891010abe521fULL,
+    0x967477cc8a3536c3ULL, 0x2b0fd198c7f77b55ULL, 0x1ec47b4e2204d53dULL, 0xf6045cc6458d2da7ULL,
+    0xd7e85bb33910d81dULL, 0x73e53024905a2409ULL, 0x92b4fd6bd00a9ef3ULL, 0x2afe9bafeb3bdf77ULL,
+    0xc440b5839ebc9e85ULL, 0x4964fb010d03e167ULL, 0x3835658d1803fde9ULL, 0x67df451af2c379f5ULL,
+    0xc40620490b3fb243ULL, 0x8ecb3fad03f5d691ULL, 0xc92e1dc243ed9581ULL, 0x3cec28e380e0742bULL,
+    0x17ad1d97a4dc2845ULL, 0xf3e97723a005d0bdULL, 0xffe8000bfffa0003ULL, 0xddf78e0194cfc53fULL,
+    0x0ec937f3dddf440dULL, 0xf6daa02489818f79ULL, 0x70d4ca481ea8cd59ULL, 0x79fba8bcf059c40fULL,
+    0x7bf949655f385501ULL, 0xd577833e08aa69cdULL, 0x98837cdcf276d2b7ULL, 0xe1f8f2fad96848a3ULL,
+    0x3acd1ed0beba1bc5ULL, 0xccfc16d84d4da5f1ULL, 0x5086f0c359b58129ULL, 0x83b5b8a6dd488585ULL,
+    0xc4ee0810aac78cd3ULL, 0x7c95b802a8e8b591ULL, 0x79b2a5cc619771bbULL, 0xd3659b2266af3ab9ULL,
+    0xfc0c9c185b6a32b5ULL, 0xdf113114ee8d4c17ULL, 0x2403908ffc5d8b4fULL, 0x9e1c0e8ef095ea89ULL,
+    0xa09b3850a3536173ULL, 0x0ffb6f71bffd6441ULL, 0x733ae01a448b9b0dULL, 0xcc0bb5ab1079e45bULL,
+    0x494ffcbdbc1c77e7ULL, 0xd78f95c6a9ea0475ULL, 0x73265239c686e511ULL, 0xc809d0fff88e685dULL,
+    0x2fb9f20e7a77a733ULL, 0xcc8f79927e170955ULL, 0x71bd067b321ca239ULL, 0x3a93a38e4377c33dULL,
+    0xff830da904b94e13ULL, 0xc393a773557a0397ULL, 0x9bfac622e002c987ULL, 0xc927037176ad8209ULL,
+    0xfea4440e5f71868dULL, 0x644ef38d28d6eaafULL, 0xecc83b76c270ff67ULL, 0xa700f21ab35ca3d3ULL,
+    0x7be25239d082f7a1ULL, 0x87ea53ea7d7f354bULL, 0x0c7cbbb6e2a3137fULL, 0x3ba1ab7cdb195b23ULL,
+    0xf7669ae9be2f519bULL, 0xa8e8cc3f9c4339b5ULL, 0xa7e27c41724cb799ULL, 0x94a054b1c065ee03ULL,
+    0x5cd428248d6a2a4fULL, 0xce13238719afae95ULL, 0x7ca733029eed1369ULL, 0x6a100bc0ff119721ULL,
+    0x28b774c6e307a6d7ULL, 0xe05add2829de9bc3ULL, 0x736cdc9a72a090e5ULL, 0xe682f81e644cc411ULL,
+    0x877ee901c36bd4c7ULL, 0xc15ab0cd71605549ULL, 0x57e8be15246217cdULL, 0x46642584d58bc2bfULL,
+    0xe9414d89c49cdd8dULL, 0x2523742b68f41edbULL, 0x21ae439d806b0ef5ULL, 0x0307373a755aee9fULL,
+    0x319ef61028e0bc6dULL, 0xcb47dda631359281ULL, 0x70024dc377f67661ULL, 0xf92715e99ef6722dULL,
+    0x961b9cce833faaebULL, 0x55c4caa7a8c50fe3ULL, 0x7a32a9a385eacb31ULL, 0xcf8b90d5d0cb237dULL,
+    0x48c0058596858653ULL, 0x91674837fc4615d7ULL, 0xba35a2e763adb33bULL, 0xff69e4daf93ed65dULL,
+    0xa0b29a4fc56a8449ULL, 0xbd360d8d51bb51ffULL, 0xb2ab6ae3eabceecdULL, 0x2733a09d8ac04c1bULL,
+    0x0370986e946c718bULL, 0x4a42fb379e64a083ULL, 0xf91316e3456ea3f9ULL, 0xc72f36245cc83a85ULL,
+    0xdfb66228c44ba8afULL, 0x0118737e4e1bb9e9ULL, 0x6b6a5f2efbe075a1ULL, 0xb353a3d284da8d57ULL,
+    0x7913b49e2bf98e43ULL, 0xea170e73ac0d5291ULL, 0x1fc92ebbc537c923ULL, 0x370d9b12362eb06fULL,
+    0x3d409bc79f188793ULL, 0x3e407951cc4347b5ULL, 0xb17ed72e884e1917ULL, 0x75458588187ef789ULL,
+    0x2b506e7ff38ca00dULL, 0xa4f1c8fb76bc6a31ULL, 0xc58a0f9079f406cbULL, 0xc336fcc7ea2e5eedULL,
+    0xe5c7e4254c950959ULL, 0xf033ab79f4a60d5dULL, 0xab33358a6d295e55ULL, 0xe9ef9497cf3b8f39ULL,
+    0x3955ef5b0a98731bULL, 0x3370e0fe220fd097ULL, 0x0c230d547efc9783ULL, 0x9c22f459b41ee3fbULL,
+    0x4cc26de1a24cd56bULL, 0xef04bd7e923307afULL, 0xd4e3b1e9618dac67ULL, 0xaa17b5f59c321cf5ULL,
+    0x4baf36b4f725b265ULL, 0x0234a6ac5c7d68ddULL, 0xdd065d6473cf107fULL, 0x9e004ebffcb80023ULL,
+    0xf8c01efadb8934a9ULL, 0x23c6a0611e40ac5fULL, 0xce42cef041dcfc0bULL, 0xc3eea056299cd303ULL,
+    0xfddda907903a5e07ULL, 0xb8dfc072b89cbd73ULL, 0xf49417c69e91f72fULL, 0xcf0cc492ef89117dULL,
+    0x22fdaff5e88e2555ULL, 0x636472f6ea709ccdULL, 0x5b40bf8c0dd59f3dULL, 0x5398fe58fb13aa13ULL,
+    0x4d44578964a33fbfULL, 0x787f228059535fc1ULL, 0x7ba9bfe2977ff977ULL, 0x670fb7d8edbd9963ULL,
+    0xcaa718ea59f698b1ULL, 0xee6b3343760113dbULL, 0xc26ee9779fe7dfd9ULL, 0x1dfdf2e35863aeb3ULL,
+    0x44a683eb091248d5ULL, 0x65bd98c0a6691537ULL, 0x94779a5d0fa09245ULL, 0x68786404248f9851ULL,
+    0x065c01f80b8abf3fULL, 0x03508a60652e34e3ULL, 0xca3ae0920e66562fULL, 0xd31c4bd36d589321ULL,
+    0x3f2aeb8b14f72759ULL, 0x4bf6cc640abd2ce5ULL, 0xb709827028c5da33ULL, 0x0f3687dc57c973cdULL,
+    0x36d839fad079ecb7ULL, 0x2ea0673163645ff1ULL, 0x9b29b905afa61b29ULL, 0x9e8975c5a7359935ULL,
+    0x42f44607fbb58adfULL, 0x227fd9b6b64707d1ULL, 0x702c23dbb0c4dec1ULL, 0xbaf134b7e411ef85ULL,
+    0x5adb6997179016d3ULL, 0xb6fb62179317186dULL, 0xe48e3720294bdbbbULL, 0xe926c2ca62d7e8c9ULL,
+    0x1e738d454d8d0e7fULL, 0x60ebc6a7912e8299ULL, 0xcb53a42e92b5657bULL, 0x33dc98b5b8aa0489ULL,
+    0x9902a93dcd383e3fULL, 0x755b83000a13ce5bULL, 0x15ac88097d8d2e75ULL, 0xa566c07c1e5523edULL,
+    0xdff4aba128e81f11ULL, 0x7746a6e20b17b25dULL, 0xf08e780233c34e01ULL, 0x6d65f0cdd8c4e81bULL,
+    0xb5f499cb56c08d3dULL, 0xc0f3f807242649dfULL, 0x2da27c50c0706da5ULL, 0xc103989d667e3dbfULL,
+    0x5a64fed9a3dddff9ULL, 0x16e758d406a92dd3ULL, 0xbaaf2e6352d35f4bULL, 0xfb283ffcc57ffdd9ULL,
+    0x2cb5298357d72765ULL, 0xcaa0910bf36d5cb3ULL, 0xf608a92f18d58d81ULL, 0x13cb2664e4fca523ULL,
+    0xfc3d1967e0f81199ULL, 0xc38eae080bdccb07ULL, 0x398683de68b35895ULL, 0x089bf638bc180debULL,
+    0x95f24045176e6ef7ULL, 0xa3ee93379a22755bULL, 0xe208d6deed8b6f49ULL, 0x898fe460c9d87a55ULL,
+    0x250034ead7d64cffULL, 0xd80387ce8743cfabULL, 0xa737f32cfae0cb39ULL, 0x0b65e3bb2d269df1ULL,
+    0xd6263e73bc9fa735ULL, 0xe35a9f06d39b8c97ULL, 0x7cb2e2c2b3e114a5ULL, 0x705208500628bcbfULL,
+    0x297abcaa6712e78dULL, 0x5315fe40172e1647ULL, 0xf812686b48639dd5ULL, 0x2a331b869efb8c81ULL,
+    0x079a71c6cb52a237ULL, 0x870ef0dea8f7629bULL, 0x41248d6618937a93ULL, 0x74188f42bcc2fc2dULL,
+    0x5e0c568873d6530dULL, 0xc3d342788cbd59e3ULL, 0x2c9e709ec602d021ULL, 0x5c6cc1e0a87629cbULL,
+    0x0f224effce33a1e5ULL, 0xf1b138ab72c19e49ULL, 0x48058de1fefd37a3ULL, 0xe0d0797a1234bac5ULL,
+    0x8d76c1afd26b361bULL, 0x861c5fee0dabc3a7ULL, 0xb2ec074d7e83fe1dULL, 0x8c28adf28fee8315ULL,
+    0x721b374ab542386bULL, 0x735f6ea15b017df9ULL, 0x5a53c1bec31d5bd3ULL, 0xdeed944aa898dd6dULL,
+    0xf1486be465212757ULL, 0x6107be3dd8645843ULL, 0x453737f059fd6547ULL, 0xe7492120baa31323ULL,
+    0x5234d71abdc676bdULL, 0x033616831eb371b5ULL, 0x8f96042c28ed999dULL, 0x85fbc8bd7b34bb3fULL,
+    0xf74f020a9c71db41ULL, 0x07aab94cbda5ccf7ULL, 0xf84db7565e7dc375ULL, 0x9e3b4bf9c94230cbULL,
+    0xad3a5efbc835e8edULL, 0x4ee638b507964cc7ULL, 0x347f00b672f84b01ULL, 0x3f1a956d7d1621c5ULL,
+    0xb05e4a3814cf99efULL, 0x7440721960f062a5ULL, 0x6336927c64f7babfULL, 0xedaba94fc4132c63ULL,
+    0x02f02f301bc89657ULL, 0x0840844c012b2ad9ULL, 0xd4cb4ac12f02498fULL, 0x96ec7c22479177bbULL,
+    0x77d8e5cf08b0a4c9ULL, 0x37b046c6f79f0037ULL, 0x288e5f966bb49545ULL, 0xe6b0f9411affcea9ULL,
+    0x899ef0292316260bULL, 0x00358c5975bc9d03ULL, 0x7a75cc56b8e1c14fULL, 0x54fa3d1ccb9ec773ULL,
+    0xa012206a1eb2db7dULL, 0x8e08dfd9d1b1461fULL, 0x3a2b27afa6318dd7ULL, 0xb5aae09baaf9efe5ULL,
+    0x810928f133cccf55ULL, 0x546454f2669b49ffULL, 0xdfb003f48d39b839ULL, 0x8b7eff72042f3413ULL,
+    0x6d9b5a309b074619ULL, 0xf98ceb14dfe250cfULL, 0xc9f46b55438934fbULL, 0x04735a775c065809ULL,
+    0xb299f9623abc1377ULL, 0xc33a96a17d5a9567ULL, 0x603d3ee2a7ab31e9ULL, 0xf341ba86b9ad259fULL,
+    0x774a5d2cf7037b4bULL, 0x3955ff9828d3688fULL, 0xcee6db3d9f99c82bULL, 0x4fc7a2c68e7a2f37ULL,
+    0xbc3c86200ee53f93ULL, 0xb88bc96527a0e55fULL, 0x7e5534295380412dULL, 0xb3ce5212a4b9d251ULL,
+    0xd49599e03892e87bULL, 0x5c3ea25121909ce7ULL, 0x780e7b3be38a5553ULL, 0x899d9b65dd7f0d21ULL,
+    0xcf07a0af258c3ecbULL, 0x7e7e71d975b416e5ULL, 0x4ef68c695f1f380fULL, 0xb38f60cdcad07dcdULL,
+    0x6626e840a346efc5ULL, 0xdfbecd69f931ab1bULL, 0x71e15cfc74abc335ULL, 0x0e591cff1961d519ULL,
+    0x33b644eaa443231dULL, 0x572588851681c277ULL, 0x6f916cb71f0d8dfdULL, 0x378afb8e8986ea65ULL,
+    0xbd8e2d6c18dce971ULL, 0xa9733c0e0dbcdbbdULL, 0x143a4280d5f5dc99ULL, 0xf351eb5a52675841ULL,
+    0x7d7902db41f035e3ULL, 0xa22c3507fb150131ULL, 0x0ebb41463985b85bULL, 0xfd3e5aa16abd570fULL,
+    0x94bafa7b7f08fc5dULL, 0x003a6d14e4c535b7ULL, 0x929f2d75566f36efULL, 0xc4dafa157affd21bULL,
+    0xe173747cb1d72429ULL, 0x8248a24711dccbe1ULL, 0x10915ba00ec53797ULL, 0xe32ae9732ed24683ULL,
+    0xbcbcf8bd99fa57a5ULL, 0xec0d22e31b09b609ULL, 0xe2f03535554684fdULL, 0xe0be04ef5312e357ULL,
+    0x38c707027fcd57ddULL, 0xf44b3e7b2f4e804dULL, 0x3221b0376471259bULL, 0x802e722d17906f2dULL,
+    0x236ad6370ba59e4fULL, 0x8ea0101c7f7ba507ULL, 0x8b8ddef8305f0295ULL, 0xc7bb0591cf67d741ULL,
+    0xbd46c58bbdbc88f7ULL, 0x3da249cc633df405ULL, 0x09793514a3eec07dULL, 0x1062b99038802fc3ULL,
+    0xdaed975215fb88c7ULL, 0x759883b1f4be8949ULL, 0xf34db2a1c60679abULL, 0xd54a0995be91ce3dULL,
+    0x8ee860295125f913ULL, 0xa1924304b74dd135ULL, 0x3b4f07990db32dcfULL, 0xada522ea2c166509ULL,
+    0x564f069fca45b7f3ULL, 0x9db7047c33f72077ULL, 0x1e812c75875a2fb1ULL, 0xd80a50468316904bULL,
+    0xd9727a5a7c1f1d2bULL, 0x63a17670f02b8cb9ULL, 0x8c89d11489f23145ULL, 0xafcb7e2200a84c9bULL,
+    0xd6806ae5dce18aa9ULL, 0x1fb1381b47bd6a61ULL, 0xad782a5bd69c5e17ULL, 0x0835360637131225ULL,
+    0xc1676ec9c2cc7407ULL, 0xa19c285e154da3e3ULL, 0x810a95f196823f31ULL, 0x2d1fe3978ec16675ULL,
+    0x53a2a39fa07749d7ULL, 0x46487cfda913950fULL, 0x459743a0d320b849ULL, 0x48581db74fcf93b7ULL,
+    0xe7d5a55e6ba324c5ULL, 0x8c95275cda5e1da7ULL, 0xbc6588b4a242d1adULL, 0xa3afe01d0cdd8219ULL,
+    0x110f532ab5703483ULL, 0x1a8e1e29c29c55c1ULL, 0x79dfa316314799dbULL, 0x28de2f1c051672fdULL,
+    0x229fdd25123a219fULL, 0xeae47855e3b969a1ULL, 0xc72880078dca676dULL, 0xf339dbbcc0648fc9ULL,
+    0x636a9b73be9a0ed5ULL, 0x5e9cfd68fe81057fULL, 0x963a85c60365a961ULL, 0xd4a75cd111bac90bULL,
+    0x2dae7b7e0c28dc4fULL, 0x4926ec044e63e39dULL, 0x498197d39377b53fULL, 0x524d02ac05eed541ULL,
+    0x08e30837b82d5ae3ULL, 0x7798700a049ced75ULL, 0x720ad73e20e85acbULL, 0x8d1e7c48f150f611ULL,
+    0x0757bb96dc16b255ULL, 0xcc5f935b798b4339ULL, 0xb9b56816720300dfULL, 0xe788866f99530497ULL,
+    0xb027bface98e4ca5ULL, 0xf9609ec55d0d7415ULL, 0x2b5469492a3c296bULL, 0x0476ae2d23497663ULL,
+    0x534a54f61e2f7bafULL, 0xf2692e039e68fcd3ULL, 0x08873670c42328a1ULL, 0x415940e10be784d9ULL,
+    0x40883ef550278665ULL, 0x080cec65725d6571ULL, 0x36807b80e4957427ULL, 0x3d00ce0a752aa2b5ULL,
+    0xe336a07ca14ead51ULL, 0x9e8c575aeaf04e79ULL, 0x0ef7a54fda426b2fULL, 0x660a8cf85700c853ULL,
+    0x79cf08ab16bcd9e5ULL, 0x67f34633052a75c7ULL, 0xb99486e4577b1649ULL, 0x5d37b437ad68ceabULL,
+    0x38e013e72483e635ULL, 0x548769838163d38bULL, 0x73f0e36b28609efbULL, 0x8743d9015816bcf3ULL,
+    0x0e280aaa9c2953c1ULL, 0x089d84d355d6f68dULL, 0xc63ff8dd66e6f7f5ULL, 0xc9b47b90ea70228fULL,
+    0x4ec7538866efdd47ULL, 0xd2c448eddcfa722bULL, 0x1b864c3b1f48e26fULL, 0xd1af39912677d7a9ULL,
+    0xe726f10162255e03ULL, 0xc7e232cbd4d2e107ULL, 0xc93f6917397c8989ULL, 0xc179415ed1251c31ULL,
+    0xd982c1a49b4a9c7dULL, 0xed653ea8c0ed8721ULL, 0xd69790853326bc3bULL, 0x7049bcaa4f7642ffULL,
+    0x0457be5de94959c5ULL, 0x0fd8255b9f844aa7ULL, 0xc91629c44b9f4f29ULL, 0xb424054f19c9ed35ULL,
+    0xe4196eb59c4f6d1dULL, 0x8690b47f8db2d2c1ULL, 0xf88274236f2839afULL, 0x6dc83d7966a9bae9ULL,
+    0x8596ed06d3eede9fULL, 0xf062c3d4623ca6a1ULL, 0xe1d37dd7dcfc0e57ULL, 0xbe750589bb818743ULL,
+    0x2e1127dbfa726391ULL, 0x27b20b479ea10223ULL, 0xf2c6481d6a6bc16fULL, 0x4ccb95ae9177a5bdULL,
+    0x90c8ec274d7b6093ULL, 0x842c9dfc1636b0b5ULL, 0xc8a6332fb0f8397bULL, 0xfb00e15486717f73ULL,
+    0x18981e0d74ca7705ULL, 0xe3aad8126af4bb31ULL, 0x8c60e0f9eadc6fcbULL, 0x0d1c657f177a82c3ULL,
+    0x6674f4e81a28110fULL, 0x35313d831f8c4fb7ULL, 0xec8bb351c7943039ULL, 0xd5a90effb08a213dULL,
+    0xe6d7e7f964da45e1ULL, 0x871e46e769d72dadULL, 0xe305f2a71e5ed197ULL, 0x250684f6368a41d3ULL,
+    0x9c4bbff99cba05f5ULL, 0x5c06de586094608fULL, 0xb2f6d92c1ec4a1ddULL, 0xdeb4319fb9454bc9ULL,
+    0xd49fb035559d017fULL, 0xb3a4ff35208b3923ULL, 0x5e32034e63783445ULL, 0x08716236b5560f9bULL,
+    0x0a6878121696dd5fULL, 0x5ce9fcacb9e6c599ULL, 0x0e072476490cca51ULL, 0x0824b49cb37abf9dULL,
+    0x3c0ae2a70b927f07ULL, 0x31bc572fd551882fULL, 0x421ae6aa687de169ULL, 0xdeabce2ea4830d53ULL,
+    0x2a96c63c30b7ceedULL, 0xfaef40d2df4974d7ULL, 0x7e894856aec78a3bULL, 0x7daacdf776f9a349ULL,
+    0x9dbff648efbc94a3ULL, 0x34c456f7859d53fbULL, 0x219ad4798dfc7f09ULL, 0x1bb9d943e34a9185ULL,
+    0x0089ca4fc10a8cf5ULL, 0xde72880a131d5c9fULL, 0x1b7eaba287767543ULL, 0x46a5f3996e462191ULL,
+    0x1ae6a26dd96d47b3ULL, 0x499fbb54b964d637ULL, 0x1a19827a33bd66b9ULL, 0x15878fdcd59a9b45ULL,
+    0x851b90fba431369bULL, 0xbda5d60de98ce461ULL, 0x23e62f81decefc25ULL, 0x94001005ecdb9689ULL,
+    0x8648eff291e7e72fULL, 0x8a62fe2b9718817dULL, 0xa3f9e43844ec9075ULL, 0x89a6398148dfc421ULL,
+    0x5f4663f719527dcbULL, 0xc779818f7060f13bULL, 0x6792a2d917ae0ccdULL, 0x9410393aeec830f1ULL,
+    0xeeb0613661490a1bULL, 0x567f676933a29c29ULL, 0x13ffbab975badc19ULL, 0x40a42d24f2f486cfULL,
+    0x5d0597e7e62698d1ULL, 0x579992aca68af587ULL, 0x6558db5c978c18f3ULL, 0xcdb7ed51932ae977ULL,
+    0xdbc464b05de3f16dULL, 0x8c9c2cabf9094965ULL, 0x8f32c59cadfeb8d5ULL, 0x824c7abecf1eff7fULL,
+    0x196f7528da7b0071ULL, 0xc3068eb4cb612593ULL, 0xa92cf218f60fee7bULL, 0x1edc3db5d3422d9dULL,
+    0xd6f1524bd8cb8473ULL, 0x051e5ff3e2a5975bULL, 0xccd2a420369832e7ULL, 0x9a05ebf94ce7bf69ULL,
+    0xdfa2f3d327d26e0fULL, 0x1bf4e896b8263011ULL, 0x4890344f50803f01ULL, 0xe8bb6338d204b1abULL,
+    0xe3b0688512ff1d39ULL, 0xc36f60a5e5fd863dULL, 0x078a4c430ddd0b29ULL, 0xce500b58febdf583ULL,
+    0x08cc98db963921fbULL, 0xd510371177b4c487ULL, 0xc00054c5d673a98dULL, 0xfac6498f492400f9ULL,
+    0x364c8859937186d3ULL, 0x90eff05e34a24bbbULL, 0xbc4cee46ccfad8c9ULL, 0x5829f7d2ce8af5b3ULL,
+    0xdea194008ee17e81ULL, 0x259e9b090c0dde23ULL, 0x138253da9d4d6945ULL, 0xd29c3784fa1dce27ULL,
+    0x36786b915b1b8195ULL, 0x77ecf76041e536ebULL, 0x6050be2226021305ULL, 0xd5fa9ff6ebcb5253ULL,
+    0x7f5f91e9214b4221ULL, 0x6246b9f05fa2c1d7ULL, 0x8e15d88664fb3dffULL, 0x616024c8022f78abULL,
+    0xdb7510c6d349bacdULL, 0xf67cdff1a7866ef1ULL, 0x9d234a7de2ab41e1ULL, 0x05fe8c3a65f9c4cfULL,
+    0x183cbf681c362dbfULL, 0xfabc18ee71ac7763ULL, 0x4b32a5f58d624685ULL, 0x6804529aadfcd1dbULL,
+    0x305115d48b9821f5ULL, 0x9f1a726aa431b747ULL, 0xfc0e6073ac1accb3ULL, 0xaa582e1c59f046d5ULL,
+    0x0f518daa791953b9ULL, 0xb73edd89915c1c6fULL, 0x40bf1abd8d66ab9bULL, 0x39bce28d93e1d95fULL,
+    0xa26701103d3cc517ULL, 0x01dd4a40c43dbc7bULL, 0x4bfd3a1fc947c895ULL, 0x7225df81ae5f042fULL,
+    0xb2b3e0c5ea00667dULL, 0xc7c46febe2c092cbULL, 0x95672a8a10763cffULL, 0xb2768d2d39883d01ULL,
+    0xef22bd1ca8533ab7ULL, 0x948ca64826588df1ULL, 0xae66794c23e77f1bULL, 0xe9f428c7fd6aa4a7ULL,
+    0xfb1dcf055ae1a0adULL, 0xd4f80976a589f677ULL, 0x441da38275e39ef9ULL, 0xcc1ce5da04e273afULL,
+    0x1fe7991c5907b66dULL, 0x7c515edda52ea857ULL, 0x59062cfede859d91ULL, 0x55f4a78d9fd2fc7fULL,
+    0x768120b821d6e32bULL, 0x9c9921673f7cbd4dULL, 0xf2774e31379a6fbdULL, 0x8de1c98e4bcadab5ULL,
+    0x1a60e03c065bb417ULL, 0x28d297dfa9299825ULL, 0x9e9430de7478529dULL, 0xbc88f92e10952c3fULL,
+    0x54bd3706dc1e0df7ULL, 0xf9d09cfb6dc8c9e3ULL, 0x8a74cb06e39c7531ULL, 0xf10c3d95f9f18c5bULL,
+    0x9ce1a939b10699cbULL, 0x2334752d18e24459ULL, 0x57e84715d6cacb0fULL, 0x7c324e1c560f3c01ULL,
+    0x97b3c2ea507db7dfULL, 0x0ae212a04b862ba5ULL, 0x73b965f672cfd6fbULL, 0x89de8963e5463187ULL,
+    0x617279751f7e18fdULL, 0xc872c7d3b59e6767ULL, 0x3a9208b528f4dfa1ULL, 0xc25877b1c3d11a8fULL,
+    0xf1ee21fe572d80bbULL, 0x69faebfccdf4c137ULL, 0x1fc53b2686c37c71ULL, 0x8f804ec7ba4b4fa9ULL,
+    0x2bfd6a8f3713e1b5ULL, 0xd8bc7b7380b9832dULL, 0x78a976aca0215907ULL, 0xc9f243f6044ce073ULL,
+    0x7d3cf46dd34a9579ULL, 0xd2b7a9224599c22fULL, 0x9ebd99c442ec335bULL, 0xdb0a5ac4cd81c3c3ULL,
+    0xaed4225861b1ac11ULL, 0x168c1364f26b3cc7ULL, 0x67cf1320e9b45939ULL, 0xc934fdef63bd0d13ULL,
+    0x32d188ca13a22535ULL, 0x597a84687446cac1ULL, 0x826a566d324f5477ULL, 0x237f0cbc6345a3b1ULL,
+    0xafa23506ea78d69fULL, 0x49ced0a4c4653f43ULL, 0x0b0bf7f4f024398fULL, 0x30967926812c22ddULL,
+    0x8c82d6a69f3fa447ULL, 0x84f51a6f414b5dbdULL, 0xf02292eddb981893ULL, 0xf93ea144a965165fULL,
+    0xef9728339ca45e61ULL, 0xfcbc980117c39217ULL, 0x2dc4672cb72652ebULL, 0x4eb5cb239978fde7ULL,
+    0x2d2777dc375fae53ULL, 0x784edacf8df1090fULL, 0xcfa2fb10aef77d33ULL, 0x0e5014c2887bf41bULL,
+    0xb072e91a0709198bULL, 0x67c006c7e1c4dc1dULL, 0xfd4a960f626249c1ULL, 0x07185218225490afULL,
+    0x8e0f4c2e2a3e06fdULL, 0x685e0449104a21e9ULL, 0xa9d4097f08e57b6dULL, 0xfc96fa43351e424dULL,
+    0xb460c0e718b3ba71ULL, 0x4b1073743c0b1927ULL, 0x67d25dfe8f649d61ULL, 0x2816ac00957b3d99ULL,
+    0x8ac9a43688e1587bULL, 0x80f18aec190f5f89ULL, 0xad86fac8949deee3ULL, 0x8694fbbab9809605ULL,
+    0x56c0c924a9d34175ULL, 0x45ba2c16a9a0b1c3ULL, 0xc22480d264c36a11ULL, 0x3e25b17cf907f6b7ULL,
+    0x25c78079896d5fc5ULL, 0x221be0324e95a529ULL, 0xdba997f1d10a3b13ULL, 0xb8a2ca76e14220a5ULL,
+    0xa467994e07cd31d1ULL, 0x7010c90574c9f709ULL, 0x0610a51adfab1467ULL, 0xc70e2db0aaaef24bULL,
+    0xbdd7a11dd0686457ULL, 0xc1edd709856eb5bbULL, 0x94097215b05a90ddULL, 0xd19e3e631ea6f87fULL,
+    0x94742fbeaf14c82dULL, 0xdd33febd0134e573ULL, 0x4ed2b9cb0a6b2b95ULL, 0xfb84fd17675f4841ULL,
+    0x0749771e76d2df2fULL, 0xb7eca9ec36a0397dULL, 0x99448e775cbdbc21ULL, 0x4d22b3226e014a49ULL,
+    0xa90cc6977578cd55ULL, 0x242175ed63bf37ffULL, 0x558e13a0fc4e22abULL, 0x82b4e3d308f128f1ULL,
+    0xb71b35a794803a35ULL, 0x361e682692142797ULL, 0x0b46a5ff40275419ULL, 0xbf032956c744a609ULL,
+    0x77fe0adb4cd727bfULL, 0xe8d294213f00bbdbULL, 0xd5ad4a60ece0a367ULL, 0x4cdc000f53f5a443ULL,
+    0x4379993fb6e77781ULL, 0xdd27ecd016423a45ULL, 0xb94d6dc229a7566fULL, 0xae7bea0b04b3959bULL,
+    0xa4fff4836fffc2bdULL, 0x2a2ff58d87ab1b61ULL, 0x342237bb16189507ULL, 0x3e4d98a5d9773e2fULL,
+    0x40d2019f8d1e307dULL, 0x6097830def75f353ULL, 0x3f129fe659c84f75ULL, 0x9ca7cbca9ddebccbULL,
+    0x973019163987cad7ULL, 0x85b6084aa788d4e5ULL, 0xaf12a0c78c6b660fULL, 0x4c28dc7cda517949ULL,
+    0x9c4229a85b559bcdULL, 0x1d44d910078f47f1ULL, 0x8f2662c592c8fea7ULL, 0x3091857667b88329ULL,
+    0x68ddfee0551f72dfULL, 0xb19fb32cb5dd1dcfULL, 0xc95dea1f757b3c87ULL, 0x411a17ec00f95615ULL,
+    0xa64996b0b3c0c6c1ULL, 0xeb3e1066c27662dbULL, 0x2ef174682f8dd29fULL, 0xd6c46ff241e71b43ULL,
+    0x22bab1ffd4cc50c9ULL, 0xfaa14519cd90b7d5ULL, 0xc8551129cb507cb9ULL, 0x1bff2fb40832356fULL,
+    0x14134e78a18e4627ULL, 0x977e34fb8d0704b5ULL, 0x95f7b32ab2122d4fULL, 0x52c605162a729c9dULL,
+    0xff312a6f3d24263fULL, 0xde050663429913e3ULL, 0x97af072dbe0f2669ULL, 0x761c2a9f0ac6321fULL,
+    0x66f42aa85788c3cbULL, 0x2cafbc175b2416c3ULL, 0x887a414bb7633601ULL, 0xcb6b02a0dc0283b7ULL,
+    0x05d4a6af118be439ULL, 0x9d5a4e82185441adULL, 0xba051d0609c30b87ULL, 0xf8ff70f323500409ULL,
+    0xd282f2dd96ea2f63ULL, 0x5ad5f99ac535e2fdULL, 0x57029fc4b2cb55d3ULL, 0xeb78ed7f7a9165d9ULL,
+    0xd574bc463d65eabbULL, 0x42e730968ceb35ddULL, 0x3f73fcc7ba30f57fULL, 0x2dc6b366e4890845ULL,
+    0x6b2bac4202a7e39bULL, 0x53d1dce386ec0bb5ULL, 0x1e1aff071a17d15fULL, 0x4f8ee415367f539dULL,
+    0xed15506334a2ea73ULL, 0x0c47c9e82dceb5ebULL, 0x593e02ede09b6f79ULL, 0xaef942cdc7b11569ULL,
+    0xe16eb1670b2ee2edULL, 0x4ec488efcfd322e5ULL, 0xd7a70f2fb25e77abULL, 0x8db7265da2e549cdULL,
+    0xb9643bdf14603339ULL, 0xd1b85143b8031ca7ULL, 0x0c4e39580b390119ULL, 0xe9b2975ce5396f1dULL,
+    0x5330f6d03a05d5f3ULL, 0x7361d9410633b0dbULL, 0x66876247ab9ccce9ULL, 0x7146dd70b2570e4bULL,
+    0x35e2aaf7dcf46e6dULL, 0x1948f09ea1649591ULL, 0xc347e8240b570a37ULL, 0xb45384856b8558a9ULL,
+    0xd7e05f6492f5905fULL, 0x426be4f5cb34db7bULL, 0x84bc002d3cebca89ULL, 0x2333f028707bfcebULL,
+    0x6cf0f13c99416d31ULL, 0x8387a5605954157dULL, 0xe8909f9385ce57e7ULL, 0x3e2a09b8e23ae475ULL,
+    0x3797d6236feabc59ULL, 0x5d38ed749d6f33ffULL, 0x5a18605436de62c5ULL, 0x7747f86f5bc3d029ULL,
+    0x06fb3e2a9d145635ULL, 0xaf92d17a2d8c438bULL, 0x1f0c477372f59283ULL, 0x4ff1d25251b143c1ULL,
+    0x1e5cee072850e06bULL, 0xadfbd1e43a2b4c85ULL, 0xd83841cf35e9bbe9ULL, 0x5f84c723d21ad7a1ULL,
+    0xa9f3835dbd4869b9ULL, 0xba6ba515ca403b23ULL, 0x0a738d3d7db47471ULL, 0xf112ded6afb43993ULL,
+    0x4b6fa5898952470bULL, 0x4af3957555e81b17ULL, 0xb26ed73a160f0c31ULL, 0xba6eb86ab56410edULL,
+    0x57c3ea45fddccb59ULL, 0x6fd321307e7ed139ULL, 0x2dd497cd7bcf1a3dULL, 0xf4ba8622a9966edfULL,
+    0xa8bad589898486adULL, 0xb433d5a3b9a56bd1ULL, 0x23fb8971f3527215ULL, 0xabdcaab3d03ba2bfULL,
+    0x949922220cd9b4f9ULL, 0x5a8ecb5340829bb1ULL, 0xddb722ab5ade6e67ULL, 0x3f0bf96f8eca9ad3ULL,
+    0xe4fb9080c58f1c4bULL, 0x8298eb5cc9e2fe57ULL, 0xda36ff1c08957281ULL, 0x88356e4a8363589bULL,
+    0xc2d6e25807968227ULL, 0xe1616d411d6b0e5fULL, 0x532c038edc96ef73ULL, 0xdb178237fac04241ULL,
+    0xffd9715d1d0a125bULL, 0xd832df60f842e269ULL, 0x9210a8b52e1da7edULL, 0x0ec2699cf8f3f5d7ULL,
+    0x41f0eb04af908311ULL, 0xc58b1db0853a03c7ULL, 0xcf093a8acb577755ULL, 0x59d0f399843acda3ULL,
+    0xb4a305c00901913dULL, 0x9c41afe294de35e1ULL, 0x88af1b27c8f138cfULL, 0x02b343752d5c7b77ULL,
+    0xb5fdd68e3fa51a85ULL, 0xa943a880d9c33ab1ULL, 0xb92de83fd6c2336dULL, 0x18853e1cc70ce0b3ULL,
+    0xfefe203489219ad5ULL, 0xb80a2f9bd82a906fULL, 0x6714e36c9fd87f9bULL, 0x60b47285a927a5a9ULL,
+    0x0db5a3f2bd92692dULL, 0x2fbcb7c9744bf917ULL, 0x148424b5236f6f07ULL, 0x98aa6b1db28eab79ULL,
+    0xa341ba28950604e7ULL, 0x6b82b81ca8177975ULL, 0x5121a0898154e6cbULL, 0x6b739fe58d8064d7ULL,
+    0x3186669dd31fbee5ULL, 0x48543ae4362ced5dULL, 0xafd13e2e21116eb7ULL, 0x41342fee9cc004a3ULL,
+    0xc8f1a0091dd11d29ULL, 0x2febd8d53a5c1687ULL, 0xf0c4086f5fa331f3ULL, 0x7b7df77b21590185ULL,
+    0x5f80fa08a22cb5fdULL, 0x3d50b0eb67714c9fULL, 0xb4a3ee8b458a14a1ULL, 0xb8835807c0daca6dULL,
+    0x2e26c53f17aa9265ULL, 0x34afbbe77edd6ac9ULL, 0xe17914df9b9961d5ULL, 0x765c54d2fda256b9ULL,
+    0xcc1806be59f7fe93ULL, 0x06f48a8bc9eb2eb5ULL, 0x1c4a9a47ea634499ULL, 0x677eedc1dcb0777bULL,
+    0x315ce04217d4e69dULL, 0xdb5e397f140bd70dULL, 0x3585bd197150b505ULL, 0xb8d12569af43e931ULL,
+    0x3f6a1b2237b83f0fULL, 0xed087a7523864111ULL, 0x6dfd5fe2eb0ca1c7ULL, 0x3bba8b44825b7a1bULL,
+    0xe19f5fe8c7447f3dULL, 0x008fea8d0afaabdfULL, 0xfa284fc21d82b3e1ULL, 0x232d874c5d46aafbULL,
+    0x6939c18603c64715ULL, 0xb00b995b2a347963ULL, 0xfce88f0e96c446afULL, 0xcd16026d8b29bfd9ULL,
+    0x18e8dc592df28e8fULL, 0x86dd96929daf6f81ULL, 0xd2d7f3745462a84dULL, 0x6dd69713557883a9ULL,
+    0x5d428e5a90ec4b5fULL, 0x2a1b4f856018630bULL, 0xf1bcf4a81844aa03ULL, 0x98c7a336c59daa95ULL,
+    0x3a5d89359bcbbf41ULL, 0xae5916f6e7bb9c05ULL, 0x6be342615b4342d7ULL, 0xa8a62a70e45e2effULL,
+    0x353db465868121abULL, 0xf2da402c620176a7ULL, 0x4a37105100eea6a5ULL, 0xeee539775d3215cfULL,
+    0x31d939614b14bec1ULL, 0x9de43eff7f98aa67ULL, 0x7bf74e6b779866e9ULL, 0x40dd0351d0920af5ULL,
+    0xfe93b358baecced9ULL, 0x72eb232daf0ad343ULL, 0x70725c80d19fcf91ULL, 0xe38f9486afa35847ULL,
+    0xbb9e7c771716efd5ULL, 0x69175397bc116e81ULL, 0x6967663e91c42437ULL, 0x452a8e5e7bb8f1bdULL,
+    0xb779af7e4dcbf2a9ULL, 0x81b4736d4042d751ULL, 0xb42fbc55b00ff195ULL, 0xf41d7645b529a6ebULL,
+    0x571f3fb19d0ddf7dULL, 0x4d890ae8879bb1e7ULL, 0x484bcff47d30fbcbULL, 0xdc42e09f8bbb2dffULL,
+    0x591685eb84ecccc5ULL, 0x41d4e15b78985ef1ULL, 0x487f5fc387d785a7ULL, 0x5191375d021e29dfULL,
+    0xa598092c024d701dULL, 0x933482506aa036f3ULL, 0xb4acf8b819873777ULL, 0xe79551c89d9155e9ULL,
+    0x03b046f52acb51a1ULL, 0xffc1f1f5afa08f6dULL, 0x575021118488f7c9ULL, 0x4c19e6957748ed7fULL,
+    0xf2a804e6ffbf8c2bULL, 0xbb7849e82a5e43b9ULL, 0xa0491b310ca38523ULL, 0xc5b5551481bc43b5ULL,
+    0x51e3ca50addf710bULL, 0x859e46667dbbb517ULL, 0x63890653990c2c7bULL, 0x82b8a6139db39d3fULL,
+    0xcd2193620d244ef7ULL, 0x3261eb7c92f102cbULL, 0xeab618b3d4832559ULL, 0xbbd58aef2f55de11ULL,
+    0x22c4290be4606833ULL, 0x7412a2d7d9d15a55ULL, 0xcea510548453e43dULL, 0x1cfa4133ade870e1ULL,
+    0x91265ce226d75383ULL, 0xf0a5070c523ad16bULL, 0x5bede20aa6129e63ULL, 0xd8dccf16218c91fdULL,
+    0x5ea8db4a1428ecd9ULL, 0x4519fc828ab924ddULL, 0x40cf4ceb6d0e13b3ULL, 0x63131d05b2588237ULL,
+    0xdadfa0dd93bc429bULL, 0x6c9edac0df86dc27ULL, 0x63e26c0efcc5dc2dULL, 0xcfd37b7c81b79551ULL,
+    0xf19ba9977833b679ULL, 0x4628c2d481babcc3ULL, 0xdc1a0edbfbde2155ULL, 0xa9155ee4674ad8cdULL,
+    0xccd486b2d8c79aefULL, 0xee6d3663ab425b3dULL, 0xa795187f1dbf5b97ULL, 0x8f6eb11ec540f2cfULL,
+    0x33c0d53bcc2e46fbULL, 0xf78c034c5d76e4f3ULL, 0x33ddf3e4e2f35563ULL, 0x4ddbb10dd25933e9ULL,
+    0x9de720e19142879fULL, 0x05e518a396a04d4bULL, 0x4abe0015b1a1fbd9ULL, 0x0513da8f89436b81ULL,
+    0x31d78a828fed1a2bULL, 0x7301c147ed4ae1b9ULL, 0xd54b7f4bf0830e45ULL, 0x79d0f78e4ed5699bULL,
+    0x999db1c578d556bdULL, 0x727904d4645af32dULL, 0x74fb0068ba048603ULL, 0x3935ab579644f451ULL,
+    0xd725f6154a678a0dULL, 0xc41dd26be40ea375ULL, 0x546b3c138f776f21ULL, 0xeefc7b507d2310cbULL,
+    0x61ac8405e170fed7ULL, 0x3e92413e42ea375dULL, 0xdbf79ac42f4fad49ULL, 0x0947a228e70d4ea3ULL,
+    0x74496db264e301c5ULL, 0xb4cd048c36cc3d1bULL, 0x7f6cda860e2466dfULL, 0xcf3e18a69db6028bULL,
+    0xabf8e396c2e063d1ULL, 0x48d23ca9fe90951dULL, 0x621b8cb79bb4f087ULL, 0x736fdfaaee482cf9ULL,
+    0x87927848552822e9ULL, 0xba53f4fee60cc69fULL, 0xd28dbcca8920546dULL, 0x9ff72721f5967657ULL,
+    0x389e43d2e5849447ULL, 0x4e3453a2f5ce2a23ULL, 0x724d3b330aec8b71ULL, 0xfd54d24a7846fa27ULL,
+    0xd62d27c02c9f309dULL, 0xbe1ec73886caa089ULL, 0x0145c1fe7e5c3a41ULL, 0xd353cd59632c5bf7ULL,
+    0xa25d3970eeb9261fULL, 0x24e89d3ebc02f90fULL, 0x6be0760147d76e5dULL, 0x0c8c417b8c74ed33ULL,
+    0x6c18cd68c8b304abULL, 0x28ff84d19b2d58efULL, 0xce27312de203e9a5ULL, 0x0d1883f4ed00c2d1ULL,
+    0x01ae20cf727da66bULL, 0xe66d726f41dd76fdULL, 0xa5145f38b64eadf5ULL, 0x83f1a6cd83be4da1ULL,
+    0xa00c15c3a3e398b3ULL, 0x11d5d00d0d6bb24dULL, 0xa95cef3e02c00f37ULL, 0xe885435101945fb5ULL,
+    0xbafa99b22b43212dULL, 0x2b8d6e6fdb8e404fULL, 0xaa0b50ebf8915495ULL, 0x6c00e0197aba09ebULL,
+    0xe96b212a21cb0af7ULL, 0x404993e53f044969ULL, 0x37e1f48615b6ed21ULL, 0xd51405576498f6e5ULL,
+    0xe3711efc524fe739ULL, 0x2eb037482f81bca3ULL, 0x7f2200e229a6f9f1ULL, 0x41a76ddc43c9c03dULL,
+    0x65f8aef701616ce1ULL, 0x8f597ea658e52897ULL, 0x237d571addee98bfULL, 0xbb27f45e39df238dULL,
+    0x4bcaa9217e203985ULL, 0xe79eb3dfb2940467ULL, 0xd577fea03cc19d43ULL, 0xf015037517816fb3ULL,
+    0x22f7caa83dce6f2bULL, 0x6ad159b47d9acc61ULL, 0x3cfcaf39fa426017ULL, 0x064ab6c89b4ea425ULL,
+    0xa9d112645b391151ULL, 0x2cc2eb6940c7af7bULL, 0x63b312ce211f9b95ULL, 0xb448ae47350715e3ULL,
+    0xa6856b40d1a8e131ULL, 0xc48c55ab1e7f4c53ULL, 0x1102c39e9a309b33ULL, 0xf926770bf6c318f1ULL,
+    0xd0c1baaec99a978bULL, 0x633e6845d79783adULL, 0x7be030b462804419ULL, 0xb871cce69df12683ULL,
+    0xcf4bc8662c236ecfULL, 0xa4edb540120e5d87ULL, 0xd5365d36799e2085ULL, 0x6d4468a2ad0564fdULL,
+    0xec109e008220c357ULL, 0x04672329b9318cbbULL, 0xa18b91d26c65466fULL, 0x146c5d2e7c0de871ULL,
+    0x96c03a336eff0b61ULL, 0x4d46d908b0be4b25ULL, 0xda9d80943a8e973fULL, 0x95e1291ee63ad405ULL,
+    0x84c5534ab92d9ae7ULL, 0x152a5a9be3b17f59ULL, 0xb3f186ef3edb135dULL, 0xd2ba886d518f7233ULL,
+    0x51b74ea5fe38d913ULL, 0x6083026fa8899aadULL, 0x30ca10372cd6c9fbULL, 0x05c252440ccc4509ULL,
+    0xb1b9ca2cee967b6bULL, 0x97c06928e27bd18dULL, 0x0f6364a9cdfa9dafULL, 0x68db3832fc4e0fb1ULL,
+    0xf436464235ad2267ULL, 0x61c1eb4693681865ULL, 0x4a1061cb9dbea58fULL, 0x1f96c7b020e3f3bbULL,
+    0x6855bfab89ef40c9ULL, 0x5d4a4fb1f3696681ULL, 0xc54db572ff7b0623ULL, 0x3444e3a9f05d0771ULL,
+    0xd1e215eb3884025fULL, 0xe9fa548846fa662dULL, 0x51b237db9384da99ULL, 0xeabdf88cb3ee0c9dULL,
+    0x2e108dfc6da5e65bULL, 0x30c1c2cfd49b86c3ULL, 0x15d3b4250e4af711ULL, 0xa90953c2def1b7c7ULL,
+    0x0ed950d99e5b25ffULL, 0x31f7cedde5c5e2cdULL, 0xb98d7a28c140d439ULL, 0xd254819b83e561a3ULL,
+    0x352445232b60d4efULL, 0xf85d818fb3eb253dULL, 0x38937ba591e6b835ULL, 0x4725e5f3bddba58bULL,
+    0x83c65600440f6219ULL, 0xedf84b08d90a15bfULL, 0x393cef3b1326aeb1ULL, 0x91d036bd0760cde9ULL,
+    0xd3a23169beecc9f5ULL, 0x0ea18cf9c222019fULL, 0x56bb8e57194fa691ULL, 0x0a3d58a429e91f47ULL,
+    0x33dcddce025ef4b3ULL, 0xe0f3458972f2eed5ULL, 0x88dfd6903b5f7845ULL, 0xcd5af4da5503c15fULL,
+    0x6c9665f9c5b3647bULL, 0x4436c4c622e67095ULL, 0xde499aee5e7325ebULL, 0x3707f9d207285f79ULL,
+    0x227ead70255998d7ULL, 0x8fef8e0dbffb9d59ULL, 0x3cf75f6ba90f815dULL, 0xf1d70459abe375f1ULL,
+    0xecb73666ffb40ca7ULL, 0xae4fc903c638bf35ULL, 0xaa8038a8a0152c8bULL, 0x677bf593e12bc8adULL,
+    0x7cc5b0b30ee09dd1ULL, 0xb6ae0de4e0bb45f3ULL, 0x9e51517f07e5096bULL, 0x1723707dd62c49fdULL,
+    0x2e0e93722da91057ULL, 0x4b2e4367d5737943ULL, 0xec0dfaff1edac1bbULL, 0xbf1263e1bbe0e54dULL,
+    0x0503bd441f7fe36fULL, 0xfd1f21292ae14571ULL, 0x132325b24b694025ULL, 0xba114e8478eb5b4fULL,
+    0xe6689d1b6e16ba89ULL, 0x227fa1114b7675f7ULL, 0x1534d160fc99f1e3ULL, 0x1dcb8fc566c78905ULL,
+    0x64098c8c409674c3ULL, 0xb6b3b13df11455c7ULL, 0x3ce774a67d24d2c5ULL, 0x0b9b0896e9e6d397ULL,
+    0xcc55fad0484cfcd1ULL, 0x69e936c6c0de5209ULL, 0xe2e696678c3d13bfULL, 0x0123b1d41ed9d5f9ULL,
+    0x5e44db03253decb1ULL, 0x75c0722175e6c7a1ULL, 0x1dab366a5cf4028fULL, 0x8bf90d013ab113ddULL,
+    0x69b372f1c5a0a2b3ULL, 0x21c40601065cbc4dULL, 0xc52d1f85b376a19bULL, 0xc069e4e6a0c5b7a9ULL,
+    0xa64954fa0c6489b5ULL, 0x8d2ee89218bd3f5fULL, 0x62cb61707e878799ULL, 0x9159dec9de92319dULL,
+    0x267ac174070cc107ULL, 0x46fe5b03442cfe95ULL, 0xc1b97e9c99e924f7ULL, 0x683661c6e8eaaa2fULL,
+    0xadc58e29b073db5bULL, 0x9784936c9ca97c7dULL, 0xc0f696575161df1fULL, 0x2a94763907992549ULL,
+    0x6c8a9672e48271efULL, 0xfef483fcb9a68a3dULL, 0x69396498dc662aa7ULL, 0x7aa5ea5b76ba3a8bULL,
+    0x774ba4e1b9a64d1dULL, 0xb4cf0ca012f30109ULL, 0xebcc828aa1136edbULL, 0xb8f80d8dc7075e67ULL,
+    0x1ba7a8decb16be9fULL, 0xc8e85d793c8d82d9ULL, 0x346d3290e217218fULL, 0xac9e5d731b9043d5ULL,
+    0x7eb4eaae09865837ULL, 0xef444aa92c8ea8b9ULL, 0xb75a561266ee4093ULL, 0xd251ee03d5d24661ULL,
+    0x27216ed1a34b3503ULL, 0xc7606e1ba04e123fULL, 0x71ae5b4f9e62990dULL, 0x977bcdfd49275fe3ULL,
+    0xdcd106eded05092fULL, 0x74f17e5dcc4ae5d7ULL, 0x800409a4bf31ca59ULL, 0xd3c16709f8c807e5ULL,
+    0x4c591dc8f8a9265dULL, 0xbbf66542db73a533ULL, 0x10e37cccd7de3da3ULL, 0x36b81bb314319e29ULL,
+    0x23e49d4620059e19ULL, 0x25b43ff39dd04af3ULL, 0x55beecfad90e2915ULL, 0xf64ca45edd4e31c1ULL,
+    0x4ff4697f28138a85ULL, 0x76e4ae9f43dd78afULL, 0x8e90a5b8f2f889e9ULL, 0xe22a3631480d21d3ULL,
+    0x17d4259c8a0445a1ULL, 0x9fc401c7c645db65ULL, 0x38499c93da425b47ULL, 0xc173f04e06ce0ad5ULL,
+    0xba3f122245b8e02bULL, 0x13c34748986c8127ULL, 0x6f879ca2862497b5ULL, 0x83da091516c28561ULL,
+    0x509667a67f4ae917ULL, 0x403803a0661e3e05ULL, 0x777d0ee0b23a3a31ULL, 0x6650cd6bcb7ef4e7ULL,
+    0x82f32e8c5e0556cbULL, 0xeb54b556d1085211ULL, 0xbc1f175865f05d5dULL, 0x8fca8c4b23402101ULL,
+    0xde3877683d3a5f39ULL, 0xef98ee60c8afc31bULL, 0x6f4455c873a1dcdfULL, 0x5dff18483b8ae783ULL,
+    0xc9301f783a9a33fbULL, 0x50783501d9a90687ULL, 0x8802f9724b7f7015ULL, 0xab45d2b48b073263ULL,
+    0x2d5173e50b6c25fdULL, 0x3fa372aec30438d3ULL, 0x9ebb46c60e22cc57ULL, 0xfa02d1e6a379a0d9ULL,
+    0x34c1350bad105dbbULL, 0xf3522e44d5cc414dULL, 0x70380bfd556ab637ULL, 0x732cf5d1081e04a9ULL,
+    0x42de0c307d464c0bULL, 0x7bbb8603ff3b2303ULL, 0xbca3bb647510569dULL, 0x7405cf9ba8712e07ULL,
+    0x05cf4be13c3188ebULL, 0x33be4f48bf1531f7ULL, 0x44d65b6f4437617dULL, 0xddab6a55fa543111ULL,
+    0xc39ec81277edd13bULL, 0x54e5b85a1a38caabULL, 0xaf465f927028eccdULL, 0x34385a36bcaa57a7ULL,
+    0x81fbbe43f058e235ULL, 0x914347b6f14a8f97ULL, 0x9a4a25ad00ac6fa5ULL, 0x444346f05bb3721dULL,
+    0x75a9785e59cb328dULL, 0x666e9ddea58063dbULL, 0x810ee50ebbfee091ULL, 0x7d0ec22e842bfeb3ULL,
+    0x1faf3394c9043e6fULL, 0x147142606b4aeabdULL, 0x54d3c9ab23183b5fULL, 0xcc0279683e43fd07ULL,
+    0x9bd1989c3ef52589ULL, 0x55425b3025a5587dULL, 0xdc1ddec2310a12e7ULL, 0x6a8d2a167dc764cbULL,
+    0xa9a12010a4cd383bULL, 0xef8db5e6f06de149ULL, 0xee568cb324c01f01ULL, 0xcfc04118910252adULL,
+    0x896c1420bdbb4b19ULL, 0x0d6eda349aa8d7d1ULL, 0xff88a4a60421291dULL, 0xe1f6bd5a6360b36bULL,
+    0xbdb2049ff0cd95afULL, 0x077ebdf0089756e9ULL, 0x4904edf22a5f82a1ULL, 0x9c6ed001a1e95065ULL,
+    0xfd2eecfbe59dbf91ULL, 0x565651c718684847ULL, 0x5ef35d9a3dfcde7fULL, 0xddfe2e91d40e352bULL,
+    0xe94eabb07dc7e4b9ULL, 0x533684f0bcdfae27ULL, 0x5d817db73b5d2a25ULL, 0x39d05aaa8c6bc49dULL,
+    0x6dc139dc6d35bb73ULL, 0x58446e4d08900e3fULL, 0x0beb890558b62e41ULL, 0x84ba4ff0c3ca3be3ULL,
+    0xe3a2e14e929b1731ULL, 0x9f3078329b9173edULL, 0x95a0c6ff1c406d0fULL, 0xe12e591123cc2fc7ULL,
+    0xad6f0bab32fb0355ULL, 0x133e0ba2f5e858abULL, 0xfc1f035da5375a29ULL, 0x28f83474e2f6cc83ULL,
+    0xa782e4cde91fbda5ULL, 0xf22da4637cef4515ULL, 0x7da6a4af75e4fa6bULL, 0xe0aaa56372a32967ULL,
+    0x2197daa4906d7dd3ULL, 0xcd26c8ce6a185dddULL, 0x56a32c0945cbe7c9ULL, 0x6a53be1e4aca4337ULL,
+    0xcee613248adcb3b5ULL, 0x3128f6872ab80803ULL, 0xee2c634ae6d9b44fULL, 0x2bdf18f58aeb1273ULL,
+    0x125407884b0aad41ULL, 0xd4e140b9f92ed779ULL, 0x0f92b936043dda05ULL, 0xe3df5ba4c671c55bULL,
+    0x1bb813384e777d69ULL, 0x164cd629961e063bULL, 0xba91b0ba28cdca55ULL, 0x710743b27bb61cffULL,
+    0x953f412efebc6df1ULL, 0x65c57429dc39648bULL, 0x3efbf2092a685c97ULL, 0x8497fb1ad28e6919ULL,
+    0x6237688043091b09ULL, 0x000c64884455fdf3ULL, 0xda8f84e2b67b0d85ULL, 0x5dfce96b4cbe45b1ULL,
+    0x999264a6acf2b867ULL, 0x101335fc940a389fULL, 0xba1337e67e27b64bULL, 0x7aeb3b3a5029dcd9ULL,
+    0xc01a2ae6814c94ddULL, 0x3fe6656318bce647ULL, 0x2a78f6e7afc8edd5ULL, 0x2af15e2744afc32bULL,
+    0xdad0bddc0067785fULL, 0x9008140e2c16a30dULL, 0x632683ad3ce0a679ULL, 0x589a1fc56d305531ULL,
+    0xd99fd5bb6036a021ULL, 0x9e652864d0ceaf33ULL, 0xf088ea24f4ef1bffULL, 0x52adac268b0f1c01ULL,
+    0x8a86ca56cca787a3ULL, 0x394e6dfba45e93a7ULL, 0x93b20d09cc663829ULL, 0x8e7c179e0f08eb8bULL,
+    0x54dbc913574cba83ULL, 0x869e93d08377f4d1ULL, 0x6b9b2c0e6c8c54f3ULL, 0xa15c59231e9b8577ULL,
+    0x7431411276b84df9ULL, 0xb5fa629afb3affdbULL, 0xde802351263cf8fdULL, 0x520494445896c565ULL,
+    0xed1c7305dec65c91ULL, 0xc8a8530f4623ba6fULL, 0x2bb2b28fdafbff99ULL, 0xa4a7cb8f8c34f24fULL,
+    0x054ffe4043ffe99dULL, 0xcee301ba00769cf7ULL, 0xebee1d8dd929a805ULL, 0x1e34e34422a1135bULL,
+    0xebe5630e6ba63359ULL, 0x40b3355324b0a3c3ULL, 0x4fb238a1766da75dULL, 0x88ccddca44b778b7ULL,
+    0xcefac4632404dee1ULL, 0xe69e5f252b2eaeadULL, 0x114248651c41e087ULL, 0x4baecfe856ff8abfULL,
+    0x7767c28d7befe58dULL, 0x5d6317710e657c63ULL, 0x95f83661d65bd667ULL, 0x8a0bb0f5b77d6657ULL,
+    0x3262fc7b8699ec65ULL, 0x360edc75a6d302ddULL, 0xcab3a2d950994b4dULL, 0xa377e2d438c19a23ULL,
+    0x35ccb242abd7009bULL, 0x55666d4fd13f760bULL, 0xb12eba8ed21b7a2dULL, 0x11560efebe10012fULL,
+    0x0d91471d7ed88839ULL, 0xd776c0aef9becaf1ULL, 0xa96af758b874b93dULL, 0xe3999843d46b8413ULL,
+    0x53ba739f0e730c35ULL, 0x91aba7ed78a41de1ULL, 0x5056f72cfb521619ULL, 0xc4c9aa6793f72809ULL,
+    0xe11a459a91c409bfULL, 0x4ca4e5e277bc4ddbULL, 0x6fb693fb39756567ULL, 0xb92e10e6ea84cb4bULL,
+    0xcc765e3f97d9388fULL, 0xc8e57de6e92539ddULL, 0x4b8b0e63e4e95981ULL, 0x54ff72f5103f182bULL,
+    0xad9008893c904c45ULL, 0xe155d9183067786fULL, 0xf4d0b4e61421b4bdULL, 0xc1dcf1fe2ba7e403ULL,
+    0x85651fe6e4236d25ULL, 0x3dafc0f60d7ad707ULL, 0x762597a5e3a5c495ULL, 0xe3b99c0346a7a80dULL,
+    0x66a2137464f4cee3ULL, 0xeffd04fc7ecb227dULL, 0x0096cae5629d8ecbULL, 0x4ee22caf1da05159ULL,
+    0x4e4a78bc6af5080fULL, 0x619e6dc3af07a23bULL, 0x0a32c1f2efa8cdcdULL, 0x45a8f67dc3ba3fc5ULL,
+    0x54c494e08da8c0a7ULL, 0xa304b870ab0fd4dfULL, 0x46bd8536e787bfcfULL, 0xa9a7fa6e13b1a815ULL,
+    0xa7eda1e7b9e29277ULL, 0xcb2d81b03a74baf9ULL, 0xdae9dcbbc565f4dbULL, 0xf5380dbaabcbddfdULL,
+    0x2f746285ba8bfca1ULL, 0xb989cebe69b64457ULL, 0x0c069ebc03c90d43ULL, 0x6b550f4bd0c6d87fULL,
+    0x3b3c2d361639beb9ULL, 0xd53e4d41a722b971ULL, 0x6e0c89cf2f2bff0dULL, 0x185c871948de5d05ULL,
+    0xcc3a292ccb39fbe7ULL, 0x7acbe796ccd1a875ULL, 0x0be3e5ef0d09941fULL, 0xf80b5966a7f86059ULL,
+    0x787507910a7b2911ULL, 0xdde2933a586e0b33ULL, 0xd62c5176d23f1801ULL, 0x914b107e661e05b7ULL,
+    0x9e0f28f36bd906efULL, 0x857b8c10e81bf429ULL, 0x40c6ce615c64b213ULL, 0xb3041f21263d70d1ULL,
+    0xca7e854a6c5452fbULL, 0x1dd8ec92f33b4d87ULL, 0x9c738dc1594cef15ULL, 0x99a69ab14d4da163ULL,
+    0xcf2e6aad546d2eafULL, 0x9d06f80cb4f160b1ULL, 0x3a7095df7adb27d9ULL, 0x963adbb24ee7a7ddULL,
+    0x1e99f8861b2901c9ULL, 0xe57307aa9738759bULL, 0x12e0eb1231f4bf2dULL, 0x053595a7f2e63b99ULL,
+    0xa7e0441345536e4fULL, 0xd3f00897e55c5295ULL, 0xa7581a1385d8d353ULL, 0xd94129a18e5a5b21ULL,
+    0x6740b3fee23494edULL, 0x10e2c208b2c67fc3ULL, 0xd46c83e798edb4e5ULL, 0x8ab499b11c7bc9abULL,
+    0x344ca362dc919aa3ULL, 0x8a24276c6e94e5efULL, 0xedb3a3ff80981e3dULL, 0xd118682a74aadea7ULL,
+    0x32de011278964ea5ULL, 0x41f190e4ae1539fbULL, 0x6b8648926e2607f3ULL, 0xd7057fe0b9dc5863ULL,
+    0x11f9c03fe9c7ffb1ULL, 0x64472ec9c3b5b29fULL, 0xf083d52b77f7e04bULL, 0x7b3658ad304e36d9ULL,
+    0x399b45a7970c8db3ULL, 0x8051acb942246d2bULL, 0x301ee558df6e156fULL, 0x1a520d738d7419bdULL,
+    0xc75f29eaba193a61ULL, 0x34188f1c1b204c89ULL, 0x2f46a472258119e7ULL, 0xa6f21c0deffc19d7ULL,
+    0x78f748aa79c9650fULL, 0xc5afff3f81f346f1ULL, 0xe6dd7d1f7ca2d229ULL, 0x99da889e8ad29ccfULL,
+    0xa5cf81234c3e981dULL, 0x931e14ece15f326bULL, 0x585c5c2352765e85ULL, 0xafd626deb715f19fULL,
+    0x166bb5c24f0faf65ULL, 0xcf19cd3fe46d9691ULL, 0x5bca970f941f5ed5ULL, 0x433a103a9adc7e4dULL,
+    0x4e8689d8de05abb9ULL, 0x7af1afc757d60925ULL, 0xe52dae03a381d47bULL, 0x9b2cb42db8d7fb89ULL,
+    0xd67e296692adca73ULL, 0x6aabaa8df3b5040dULL, 0x10b25903122cb6f7ULL, 0x2c9c090bd82faae3ULL,
+    0xb6cb3c217fcd511fULL, 0x59bcf7357541c2edULL, 0xc4069fa382156dc3ULL, 0x5b55fa386052f15dULL,
+    0x8e8d02ab04b81501ULL, 0x8096dbea32c292b7ULL, 0x0fa2ce30c00a1339ULL, 0xdc18ea76df968dd1ULL,
+    0x6f4fc22b52169309ULL, 0x068bdcaf0cfc84bfULL, 0x4ebd8f60fd4d4cd3ULL, 0xa564951f0b26f8a1ULL,
+    0xd03c6d9fb517ee4bULL, 0x9ad55e36a190d38fULL, 0x7bc5dc5fcfc35481ULL, 0x85dfceade34e554dULL,
+    0x890f30ad5e6bf2b5ULL, 0x559851fad092b703ULL, 0xa7a26b859ea07d51ULL, 0x9aa728dbd32ee207ULL,
+    0x3744fdce99dd2441ULL, 0x429e94373572f57dULL, 0x35ccf25a4b8a901fULL, 0xe6c022fe7a7429e5ULL,
+    0xdbe0154a0888c955ULL, 0x410264c510d93fa3ULL, 0xc5adb9244f5f0e13ULL, 0x5dd6acd44ec997e1ULL,
+    0x07f3c560f6bf7019ULL, 0xddf7941a86882c85ULL, 0x2fd361c12917dcb1ULL, 0x7e1e92535ad047f5ULL,
+    0x46e4cc1a581363d9ULL, 0xf6a71bb52335f28fULL, 0xff490ce9000e12b3ULL, 0x8dd91a58140b5725ULL,
+    0x6aea054c1e5d5989ULL, 0x3f18ddc60160833fULL, 0xd8f3ca16d99823ebULL, 0xfa43ccc3808aed79ULL,
+    0x01cc861990a09a2fULL, 0x13bc1f76dc64c6e7ULL, 0xbfdec400dc7b4b75ULL, 0xac1226a3f0e366d7ULL,
+    0x49266c81593eab59ULL, 0x323c01218c1a0c3bULL, 0xf7d017b353ef5f5dULL, 0xe45eca6eade0f0b7ULL,
+    0x8e6a7158013fa3f1ULL, 0x0bbfd03a18ce4edfULL, 0x8369b8443beb79cfULL, 0x71a5e561fdc85887ULL,
+    0xbdab8951509b5215ULL, 0xf7a78dfedcaaa2c1ULL, 0x28754532cb37a7fdULL, 0xeb2eb421e4268ae9ULL,
+    0xd08c476fe98d7ad3ULL, 0x5e95cd1f67467c6dULL, 0xcf3f0ebcdb57d743ULL, 0xa6070c9a82aaecc9ULL,
+    0xef2c6f1ef67b5223ULL, 0xaec5f83245edf5bdULL, 0x0814a0df0ae1cf73ULL, 0x5d92e4f3eab8090dULL,
+    0x903a30bf413755e7ULL, 0xb3497ad4aa60c269ULL, 0xff4185d525cdbfcbULL, 0xd321a1eedff087edULL,
+    0xdf7f06ee26ac6311ULL, 0x71bb09b861cc965dULL, 0x62386b8b98a3e3c7ULL, 0x117d23f939f11533ULL,
+    0x839d7170f4330039ULL, 0x3e5f06eb208240efULL, 0x011cecd3c3088e29ULL, 0x5b485166bae615e1ULL,
+    0x3fbe324d136263f9ULL, 0x266ccaadaa6368afULL, 0xe99b99a0e705034bULL, 0x45686a79b7f64d57ULL,
+    0x32341c99fa7066bbULL, 0x85570e2b3b67c0b3ULL, 0x80eed2741d915181ULL, 0xf96bc42d461a350bULL,
+    0x424c105737a79c03ULL, 0x6c2fcc54ec9ca141ULL, 0xa2c2e95f7aa88b79ULL, 0xf4e9a75c3c82da7dULL,
+    0xa327aa6e4b364d1fULL, 0x4dfb1e6dfd20d521ULL, 0x54bc7b3a13b64211ULL, 0xa80c140edf41d313ULL,
+    0xc7677ea4a3cb9097ULL, 0xfaa4efa1befcb7cfULL, 0x507b825e1c874b8dULL, 0x79a788af8b75e185ULL,
+    0x398c0b9cee200a4bULL, 0xedae3a084b8cc543ULL, 0xb97a3f3d257ff191ULL, 0x3688c483ead8869bULL,
+    0x3db1e7d97fe6e3bdULL, 0x8e0117ed44eade93ULL, 0x4390a40f1b706c5fULL, 0x74e86e3fba4e4c25ULL,
+    0x1745552d760d577bULL, 0xd24682fd06b5f8ebULL, 0x4799115ccd36b70dULL, 0x8ea3db6505f97453ULL,
+    0x673910f897939421ULL, 0x54cc64a78340d859ULL, 0xd5c02d10e0ff1001ULL, 0x00f20af004bb47a7ULL,
+    0xa9a0d62a63695235ULL, 0x37ebfa0d91728bdfULL, 0x8b2a44291f084e83ULL, 0xe39ae4ddd8d256cfULL,
+    0x319ea46ee33ee21dULL, 0x4dba4d0ec136dc6bULL, 0x977996b25a2bb977ULL, 0x101891834d5026afULL,
+    0xed25f50b1a2b2b57ULL, 0xaf66116d90383c43ULL, 0xe5053c77cbdcd091ULL, 0x1a90b1db0367e947ULL,
+    0x9c8cce57f7ea79c9ULL, 0xb957f751f8c22e6fULL, 0x4f2f8d91fbc9430bULL, 0x3165bfd1761ab399ULL,
+    0x452c0158a12df325ULL, 0x363071b8759bd473ULL, 0x0c4c9ca1372a7f3fULL, 0x07fca4e352350e0dULL,
+    0x6d6d0b3bd4dbf4e3ULL, 0x5be9dbffa6b4e75bULL, 0x0329f07ad5348f69ULL, 0x63c5e5e35d37d4cbULL,
+    0xa2f71f0515bae759ULL, 0xf00010fffef00011ULL, 0x9b50282bfd64d0c7ULL, 0x91791e7945c5acb7ULL,
+    0x6d5722e59703d63dULL, 0xe3187ba9e9c70113ULL, 0xa40638825a7fd2e1ULL, 0x2f0533ecb6db9487ULL,
+    0xfe3beeb4b5946e15ULL, 0xc4ff909e414783fdULL, 0x33ab6e1a374196ddULL, 0x8839f14c8c7345b3ULL,
+    0x8f97ce7c91f0b945ULL, 0x0d29e5620720d49bULL, 0xe1a320c790dc8e2dULL, 0x4d0171ac6513054fULL,
+    0xd7f718d18941bc07ULL, 0x96e1af8190acbf7dULL, 0xb0a876f5042791d7ULL, 0xa8928636f79f13e5ULL,
+    0xd376fc2f8e577355ULL, 0x328f0b9b12903c39ULL, 0xc00c6d3f0bf5bcefULL, 0x8239679ca36a9813ULL,
+    0xbdd635ab499f6035ULL, 0xc554a688b5384d8bULL, 0xe8445a89bd5f5d97ULL, 0xe27878984deb58fbULL,
+    0x5393d270a94b16f3ULL, 0xaa22b2fa3dd81dc1ULL, 0x69b6078d272c1967ULL, 0x11e1b525d8cfe99fULL,
+    0x6eb7588125136f6dULL, 0x4083be602d03bdd9ULL, 0x2afcd84b97208747ULL, 0xcc961dfed2154d81ULL,
+    0x75c527f9b36dfb9bULL, 0xf43ae62a28b99517ULL, 0x2a880867de581651ULL, 0x03db4bcf54a90c7bULL,
+    0x7507db50ef9d7389ULL, 0x4614603807051895ULL, 0x02d3749c8f037d3fULL, 0x1494842d68e3b953ULL,
+    0xdd80fd7193f13ae5ULL, 0xcd225e0f021a7c0fULL, 0xe6e3e2bee4d72f49ULL, 0xc647667bae560cffULL,
+    0xcee9d5433feee1cdULL, 0x7c942bdc4d77c0a3ULL, 0xaf0746e3a30cb929ULL, 0xc7147e34a0cd9cc1ULL,
+    0x1de86774f8fa24e9ULL, 0xcb2d10d5e05e04d3ULL, 0x2e2f42db53de289fULL, 0xec6f8915f5a37857ULL,
+    0xae53f3a921bc69bbULL, 0xfe24ba647541d647ULL, 0xb6e7711399229c23ULL, 0x391530a2104ccb6fULL,
+    0xee641f238472434fULL, 0x5aa831b8e7591c41ULL, 0xcb09bb9464fa4531ULL, 0xd37baad01cacafe7ULL,
+    0x5102b5904f8c1f33ULL, 0xe9bc13b869cc56abULL, 0x10b1beb092aada39ULL, 0x14f570d32b4e7ac5ULL,
+    0xe4ca831da8b4f61bULL, 0x502fe8bbcd6b8fe1ULL, 0xa32a67bbcf9607adULL, 0x071a06f4485c2a83ULL,
+    0x002295b1fef9fe8dULL, 0x925f992c326a3563ULL, 0x380ae737d89c68fdULL, 0x5f15397c9c212d4bULL,
+    0xb642d575f8be3bddULL, 0x8dedbbde375acb7fULL, 0x6469ca882930e44dULL, 0x9b4704a85cf0d323ULL,
+    0x2b058c4247c01fa9ULL, 0x90a7c24acbef5f0bULL, 0xc8603b3fe164ef99ULL, 0xd2d7fe4463eee24fULL,
+    0x8def6f74292ba695ULL, 0x375c269dfd8a5bebULL, 0x4739c6e59cede753ULL, 0xea28f1a96e97c71fULL,
+    0x58415bcb8f4388e5ULL, 0x99e937a897891dabULL, 0xf638dd0e1b942ea3ULL, 0x1759c248aacf92a7ULL,
+    0x9cd5fa2a94e8cee1ULL, 0x3286b2145aa27719ULL, 0xb8330f13b9e7751dULL, 0x4e0ad20602702477ULL,
+    0x8c9b2ddf123373b1ULL, 0xbae6a1c2d0a0344bULL, 0x9b4a4917753b8f43ULL, 0x6afd20e1e115c12bULL,
+    0x6fcc32b5e28e5545ULL, 0x3fbf1bf864c1adbdULL, 0x1627746c101b8ea9ULL, 0x37268620aac03351ULL,
+    0x50a36059fd90f807ULL, 0x0acc4ce57c273479ULL, 0x769374c936a5f12fULL, 0xef8637d278578331ULL,
+    0x20e8da2d4d93fe53ULL, 0xda5657ca4d8fbc49ULL, 0x1f00a150496fcd33ULL, 0xffbe71b9017166cdULL,
+    0x766088b343be97b7ULL, 0xcf9b23bac29365a3ULL, 0x892edd43658b48c5ULL, 0x490f7a9575a72c1dULL,
+    0x71dd2d3fc4fe9f87ULL, 0x21c6d0b14326bddbULL, 0x0b6e3e3e4eef49d3ULL, 0x096cac903fd62da1ULL,
+    0x871cc30bfe19c557ULL, 0x9c10e4f55daf93c9ULL, 0xd8d9ef3a9c04c97fULL, 0x601460e0f1095fb9ULL,
+    0x47190aa52c4de927ULL, 0xa0e8a9c2d34aff93ULL, 0x6f785f6158addd25ULL, 0x5d419d1b7e203ee3ULL,
+    0x0130e19d60ec9175ULL, 0x3edde7c0a5a8451fULL, 0x5dd5313801a701c3ULL, 0x7313a51d38f9c739ULL,
+    0xdb360e5630a917efULL, 0x52102471965170a5ULL, 0x4a856d4dd06f01d1ULL, 0x008fe98bca88cd6bULL,
+    0x1f5b8a9fd73dbfafULL, 0xb93e967cc576b1b1ULL, 0x02d48838c40b4dfdULL, 0x129a3a691b50424bULL,
+    0xdf1a6bf5587b08d9ULL, 0x875956ec423205bbULL, 0x6ddee7ca9054c2c9ULL, 0xa98f9b16a5674881ULL,
+    0x88f45e74472f1e37ULL, 0x5e2d3f9b6fe4a971ULL, 0xc5298b6c4d4c46b5ULL, 0x6e54718b60d6645fULL,
+    0x754c129f9b99182dULL, 0x24e16cf863c4f151ULL, 0x88746ab676e53573ULL, 0xf2659d845c887b95ULL,
+    0x1863c964b1d4af2fULL, 0x8d0e3d6c2d6f785bULL, 0x0663bdaadc942bd7ULL, 0xd4fc5b9002e778c3ULL,
+    0x5758e56074491911ULL, 0xcf0707410fbf07ffULL, 0xda01cc59d0c514cdULL, 0x17252abd1273d3a3ULL,
+    0x46ca317b7aec8be1ULL, 0xb6ff17e27000f797ULL, 0x5b60f7b205e417a5ULL, 0x4990475c1ac49a1dULL,
+    0x03a20e820a413177ULL, 0x4557a1957efecfe9ULL, 0xe4912506e581494bULL, 0x2e8afb03104cf96dULL,
+    0xfac2587f9d97668fULL, 0x582d7fe9d88bc891ULL, 0x6ae0545ba69a6147ULL, 0x9a547d525c5026b3ULL,
+    0xb4e2f12de7174781ULL, 0x63e73342db058a45ULL, 0xab9a3d1cf29a235fULL, 0x0bf523f403a6eb61ULL,
+    0x15093cba41a34203ULL, 0x3054db86b682767bULL, 0xf2901bdaedef6507ULL, 0x889ca2156874a179ULL,
+    0x1e8b20b2a791ace3ULL, 0x145407a2dae26031ULL, 0x41fc78bc7d9f7ae7ULL, 0x7022448f4aa19f75ULL,
+    0xeef401e1586c9ad7ULL, 0xbfcc52d55581360fULL, 0xfce218dcb70a4949ULL, 0x67aa0e0c64ce06ffULL,
+    0x37f1e63b556517f1ULL, 0x12082e57220f9135ULL, 0x46386499a96c7aadULL, 0xc47edbba0799bfd1ULL,
+    0x792b25c339a20c87ULL, 0xfbed6e4ba61b77f3ULL, 0x3f0315d0273896c1ULL, 0x6634e80486467dafULL,
+    0x9fe800ee2ac9a29fULL, 0x24099b9d56c16aa1ULL, 0x7e9e6b7ca46cf865ULL, 0x7c014c84db5aa791ULL,
+    0xce0d96ce8bcfb047ULL, 0xaa4993ebba8854b5ULL, 0x1073b027ee16020bULL, 0xae0c70df9996ba99ULL,
+    0xe908d67a5a0b3c89ULL, 0x597dc6b6dfac9b05ULL, 0x7908101a0eaf6e59ULL, 0x5c396d3badc5ab55ULL,
+    0xb4e46832549b53b7ULL, 0x91a16320bbbce4c5ULL, 0x2d9934de4937e01bULL, 0x7d0e3671a53909e1ULL,
+    0x6f43803ff68891adULL, 0x1af416753879f5bfULL, 0xa4a6d13eb4d3a26bULL, 0xf03d6d1f345a8eb1ULL,
+    0x9bc74bef9f8fa5d3ULL, 0x1fa66cafd8321f65ULL, 0xc3ee732177b9d4b3ULL, 0x826160d4dfae2527ULL,
+    0x0c9703d5b792b9a9ULL, 0x1a4a9ffbc94d5bb5ULL, 0x8f76f549e2f73003ULL, 0xdc066de102b33a73ULL,
+    0xff1a4745000f5095ULL, 0xf30a39af35bde569ULL, 0x232a5c4334b1411fULL, 0x27ab37cf80c778d7ULL,
+    0xe6971088e6aa72e5ULL, 0x7b94a99a125493efULL, 0xb7cf8a0cd915eca7ULL, 0xdeb302299588e713ULL,
+    0x882efaa320f80ca5ULL, 0x32fb8d94ea3c2bcfULL, 0x5b19122f739474bfULL, 0x9341700a1fd03e77ULL,
+    0xcba2eea77d10b585ULL, 0x5c0d2fe8a5e9bcddULL, 0xbbc52a8f033b95d5ULL, 0x2ee64cdb5a3bc36fULL,
+    0xfa94010892f25a9bULL, 0xd345477f0c666d51ULL, 0x23c959d1e46bd207ULL, 0x668faef893894cebULL,
+    0x41a0a28fb5f6cb0dULL, 0xf03d2b9c624021cbULL, 0xe6d719ba389d8c59ULL, 0xcf2519476639153bULL,
+    0x7b620cd1380f0401ULL, 0x0e5300b7c1986019ULL, 0xaf7216d879637987ULL, 0x5a75df907e4913c1ULL,
+    0xe26a67c5eeee306bULL, 0x826c725200b49aafULL, 0xf6e5c1246c068be9ULL, 0xf5a2774e037ea7a1ULL,
+    0x9f4c584236bb556dULL, 0x34245dfbeb6a6d65ULL, 0x5bdd3064d60c08bbULL, 0x2aa15f36da7cadc9ULL,
+    0xab017e1a02e7eebdULL, 0xbf21ca3aa1f24327ULL, 0x3a4ce70c4cc08993ULL, 0x06749c5f7ba4eb17ULL,
+    0x2846a092c349119dULL, 0x18ed87542ced220dULL, 0xf56b25c9e4e75005ULL, 0x872586a803d3cbc3ULL,
+    0x3143c1978ea1ae33ULL, 0x012b732494e319c5ULL, 0x9215b1d004de51efULL, 0x0a081d8dc67b0f29ULL,
+    0x5ff3bd470a2fd983ULL, 0xc9587f8e40873bd1ULL, 0x60ea142c22706bb1ULL, 0x28f9512b8f3717fdULL,
+    0x7a54c636e497ce57ULL, 0xf9d8276d7edd9465ULL, 0x81b8eb94985b018fULL, 0xf42e38743cdd59b3ULL,
+    0x583ee3ff8add734dULL, 0xc1093f4988395227ULL, 0x39780f6d0eff06a9ULL, 0x69ebfa5e9b0ede5fULL,
+    0x1bf468e16768f699ULL, 0x24a5bec0e6cf7007ULL, 0x2f06269f8b5dac79ULL, 0x99a57f7357d9f7edULL,
+    0x7efc637b1f5842c3ULL, 0x1850ddd6f1cde33bULL, 0x932fa5bc87da1cabULL, 0x11f99952a6b01ecdULL,
+    0x2eafbb48fc67f039ULL, 0x328a5b09c36bb435ULL, 0x4c48f2c8949a9197ULL, 0xc0dd5201f58f08cfULL,
+    0xb671904af2de11c1ULL, 0x243fe10b280b5b63ULL, 0x1f0bc0f8e6f06a85ULL, 0x7af6229f7ac2cd67ULL,
+    0xb018d8789c76dd9fULL, 0x648f3b124c85734bULL, 0x50f1b03f347c71d9ULL, 0xeccd60e4809261ddULL,
+    0x979e63ad769530b3ULL, 0xe24c2fd0ec24606fULL, 0xad8262e7035fcf9bULL, 0x0c80ba887f8cdcbdULL,
+    0x40c3505f1497b793ULL, 0x24906b23bc469d5fULL, 0x529d76d39133e07bULL, 0x62b185fc0d046c95ULL,
+    0x11dab6be0270d4e7ULL, 0xbec4e8997f49b959ULL, 0x47dd83c374614a3bULL, 0x1d8cd1dee3773d5dULL,
+    0x7490606dcaca3eb7ULL, 0x567713070fb3e7c5ULL, 0x00ab9827eb65bb35ULL, 0xf4ffd8df71e9c783ULL,
+    0x206774761466a7cfULL, 0xa80a1f3c542022f9ULL, 0x8ba8a6ecb7845185ULL, 0xddc8f2844f4718d3ULL,
+    0x0662dddc54671a6dULL, 0x6f241527d13de191ULL, 0xf66f2e06311ec07fULL, 0x4284f5e223a7214dULL,
+    0xd96b5e11fe393023ULL, 0xcab178561e033f6fULL, 0x7d4270b194ac7eb5ULL, 0x94cbbad3f3afb817ULL,
+    0x681d61fc4cbe1499ULL, 0x9e934ecc8b8b11f7ULL, 0xfa7728271df59069ULL, 0x202722994c2e0f0fULL,
+    0x58862fdccdf01111ULL
+};
+
+const Limb trialLim[SMALL_PRIME_NUM] = {
+    0x5555555555555555ULL, 0x3333333333333333ULL, 0x2492492492492492ULL, 0x1745d1745d1745d1ULL,
+    0x13b13b13b13b13b1ULL, 0x0f0f0f0f0f0f0f0fULL, 0x0d79435e50d79435ULL, 0x0b21642c8590b216ULL,
+    0x08d3dcb08d3dcb08ULL, 0x0842108421084210ULL, 0x06eb3e45306eb3e4ULL, 0x063e7063e7063e70ULL,
+    0x05f417d05f417d05ULL, 0x0572620ae4c415c9ULL, 0x04d4873ecade304dULL, 0x0456c797dd49c341ULL,
+    0x04325c53ef368eb0ULL, 0x03d226357e16ece5ULL, 0x039b0ad12073615aULL, 0x0381c0e070381c0eULL,
+    0x033d91d2a2067b23ULL, 0x03159721ed7e7534ULL, 0x02e05c0b81702e05ULL, 0x02a3a0fd5c5f02a3ULL,
+    0x0288df0cac5b3f5dULL, 0x027c45979c95204fULL, 0x02647c69456217ecULL, 0x02593f69b02593f6ULL,
+    0x0243f6f0243f6f02ULL, 0x0204081020408102ULL, 0x01f44659e4a42715ULL, 0x01de5d6e3f8868a4ULL,
+    0x01d77b654b82c339ULL, 0x01b7d6c3dda338b2ULL, 0x01b2036406c80d90ULL, 0x01a16d3f97a4b01aULL,
+    0x01920fb49d0e228dULL, 0x01886e5f0abb0499ULL, 0x017ad2208e0ecc35ULL, 0x016e1f76b4337c6cULL,
+    0x016a13cd15372904ULL, 0x01571ed3c506b39aULL, 0x015390948f40feacULL, 0x014cab88725af6e7ULL,
+    0x0149539e3b2d066eULL, 0x013698df3de07479ULL, 0x0125e22708092f11ULL, 0x0120b470c67c0d88ULL,
+    0x011e2ef3b3fb8744ULL, 0x0119453808ca29c0ULL, 0x0112358e75d30336ULL, 0x010fef010fef010fULL,
+    0x0105197f7d734041ULL, 0x00ff00ff00ff00ffULL, 0x00f92fb2211855a8ULL, 0x00f3a0d52cba8723ULL,
+    0x00f1d48bcee0d399ULL, 0x00ec979118f3fc4dULL, 0x00e939651fe2d8d3ULL, 0x00e79372e225fe30ULL,
+    0x00dfac1f74346c57ULL, 0x00d578e97c3f5fe5ULL, 0x00d2ba083b445250ULL, 0x00d161543e28e502ULL,
+    0x00cebcf8bb5b4169ULL, 0x00c5fe740317f9d0ULL, 0x00c2780613c0309eULL, 0x00bcdd535db1cc5bULL,
+    0x00bbc8408cd63069ULL, 0x00b9a7862a0ff465ULL, 0x00b68d31340e4307ULL, 0x00b2927c29da5519ULL,
+    0x00afb321a1496fdfULL, 0x00aceb0f891e6551ULL, 0x00ab1cbdd3e2970fULL, 0x00a87917088e262bULL,
+    0x00a513fd6bb00a51ULL, 0x00a36e71a2cb0331ULL, 0x00a03c1688732b30ULL, 0x009c69169b30446dULL,
+    0x009baade8e4a2f6eULL, 0x00980e4156201301ULL, 0x00975a750ff68a58ULL, 0x009548e4979e0829ULL,
+    0x0093efd1c50e726bULL, 0x0091f5bcb8bb02d9ULL, 0x008f67a1e3fdc261ULL, 0x008e2917e0e702c6ULL,
+    0x008d8be33f95d715ULL, 0x008c55841c815ed5ULL, 0x0088d180cd3a4133ULL, 0x00869222b1acf1ceULL,
+    0x0085797b917765abULL, 0x008355ace3c897dbULL, 0x00824a4e60b3262bULL, 0x0080c121b28bd1baULL,
+    0x007dc9f3397d4c29ULL, 0x007d4ece8fe88139ULL, 0x0079237d65bcce50ULL, 0x0077cf53c5f7936cULL,
+    0x0075a8accfbdd11eULL, 0x007467ac557c228eULL, 0x00732d70ed8db8e9ULL, 0x0072c62a24c3797fULL,
+    0x007194a17f55a10dULL, 0x006fa549b41da7e7ULL, 0x006e8419e6f61221ULL, 0x006d68b5356c207bULL,
+    0x006d0b803685c01bULL, 0x006bf790a8b2d207ULL, 0x006ae907ef4b96c2ULL, 0x006a37991a23aeadULL,
+    0x0069dfbdd4295b66ULL, 0x0067dc4c45c8033eULL, 0x00663d80ff99c27fULL, 0x0065ec17e3559948ULL,
+    0x00654ac835cfba5cULL, 0x00645c854ae10772ULL, 0x006372990e5f901fULL, 0x006325913c07beefULL,
+    0x006160ff9e9f0061ULL, 0x0060cdb520e5e88eULL, 0x005ff4017fd005ffULL, 0x005ed79e31a4dccdULL,
+    0x005d7d42d48ac5efULL, 0x005c6f35ccba5028ULL, 0x005b2618ec6ad0a5ULL, 0x005a2553748e42e7ULL,
+    0x0059686cf744cd5bULL, 0x0058ae97bab79976ULL, 0x0058345f1876865fULL, 0x005743d5bb24795aULL,
+    0x005692c4d1ab74abULL, 0x00561e46a4d5f337ULL, 0x005538ed06533997ULL, 0x0054c807f2c0bec2ULL,
+    0x005345efbc572d36ULL, 0x00523a758f941345ULL, 0x005102370f816c89ULL, 0x0050cf129fb94acfULL,
+    0x004fd31941cafdd1ULL, 0x004fa1704aa75945ULL, 0x004f3ed6d45a63adULL, 0x004f0de57154ebedULL,
+    0x004e1cae8815f811ULL, 0x004cd47ba5f6ff19ULL, 0x004c78ae734df709ULL, 0x004c4b19ed85cfb8ULL,
+    0x004bf093221d1218ULL, 0x004aba3c21dc633fULL, 0x004a6360c344de00ULL, 0x004a383e9f74d68aULL,
+    0x0049e28fbabb9940ULL, 0x0048417b57c78cd7ULL, 0x0047f043713f3a2bULL, 0x00474ff2a10281cfULL,
+    0x00468b6f9a978f91ULL, 0x0045f13f1caff2e2ULL, 0x0045a5228cec23e9ULL, 0x0045342c556c66b9ULL,
+    0x0044c4a23feeced7ULL, 0x0043c5c20d3c9fe6ULL, 0x00437e494b239798ULL, 0x0043142d118e47cbULL,
+    0x0042ab5c73a13458ULL, 0x004221950db0f3dbULL, 0x0041bbb2f80a4553ULL, 0x0040f391612c6680ULL,
+    0x0040b1e94173fefdULL, 0x004050647d9d0445ULL, 0x004030241b144f3bULL, 0x003f90c2ab542cb1ULL,
+    0x003f71412d59f597ULL, 0x003f137701b98841ULL, 0x003e79886b60e278ULL, 0x003e5b1916a7181dULL,
+    0x003dc4a50968f524ULL, 0x003da6e4c9550321ULL, 0x003d4e4f06f1def3ULL, 0x003c4a6bdd24f9a4ULL,
+    0x003c11d54b525c73ULL, 0x003bf5b1c5721065ULL, 0x003bbdb9862f23b4ULL, 0x003b6a8801db5440ULL,
+    0x003b183cf0fed886ULL, 0x003aabe394bdc3f4ULL, 0x003a5ba3e76156daULL, 0x003a0c3e953378dbULL,
+    0x0038f03561320b1eULL, 0x0038d6ecaef5908aULL, 0x003859cf221e6069ULL, 0x0037f7415dc9588aULL,
+    0x00377df0d3902626ULL, 0x00373622136907faULL, 0x0036ef0c3b39b92fULL, 0x0036915f47d55e6dULL,
+    0x0036072cf3f866fdULL, 0x0035d9b737be5ea8ULL, 0x0035961559cc81c7ULL, 0x0035531c897a4592ULL,
+    0x00353ceebd3e98a4ULL, 0x0034fad381585e5eULL, 0x00347884d1103130ULL, 0x00340dd3ac39bf56ULL,
+    0x003351fdfecc140cULL, 0x00333d72b089b524ULL, 0x0033148d44d6b261ULL, 0x0032d7aef8412458ULL,
+    0x0032c3850e79c0f1ULL, 0x00328766d59048a2ULL, 0x00325fa18cb11833ULL, 0x00324bd659327e22ULL,
+    0x0032246e784360f4ULL, 0x0031afa5f1a33a08ULL, 0x00319c63ff398e70ULL, 0x003162f7519a86a7ULL,
+    0x0030271fc9d3fc3cULL, 0x002ff104ae89750bULL, 0x002fbb62a236d133ULL, 0x002f74997d2070b4ULL,
+    0x002ed84aa8b6fce3ULL, 0x002e832df7a46dbdULL, 0x002e0e0846857cabULL, 0x002decfbdfb55ee6ULL,
+    0x002ddc876f3ff488ULL, 0x002dbbc1d4c482c4ULL, 0x002d8af0e0de0556ULL, 0x002d4a7b7d14b30aULL,
+    0x002d2a85073bcf4eULL, 0x002d1a9ab13e8be4ULL, 0x002ceb1eb4b9fd8bULL, 0x002c8d503a79794cULL,
+    0x002c404d708784edULL, 0x002c31066315ec52ULL, 0x002c1297d80f2664ULL, 0x002c037044c55f6bULL,
+    0x002be5404cd13086ULL, 0x002bb845adaf0cceULL, 0x002b5f62c639f16dULL, 0x002b07e6734f2b88ULL,
+    0x002ace569d8342b7ULL, 0x002a791d5dbd4dcfULL, 0x002a4eff8113017cULL, 0x002a3319e156df32ULL,
+    0x002a0986286526eaULL, 0x0029d29551d91e39ULL, 0x0029b7529e109f0aULL, 0x00298137491ea465ULL,
+    0x0029665e1eb9f9daULL, 0x002909752e019a5eULL, 0x0028ef35e2e5efb0ULL, 0x0028c815aa4b8278ULL,
+    0x0028bb1b867199daULL, 0x0028a13ff5d7b002ULL, 0x00287ab3f173e755ULL, 0x00286dead67713bdULL,
+    0x002847bfcda6503eULL, 0x002808c1ea6b4777ULL, 0x00278d0e0f23ff61ULL, 0x002768863c093c7fULL,
+    0x0027505115a73ca8ULL, 0x00274441a61dc1b9ULL, 0x0026b5c166113cf0ULL, 0x00269e65ad07b18eULL,
+    0x002692c25f877560ULL, 0x002658fa7523cd11ULL, 0x0026148710cf0f9eULL, 0x002609363b22524fULL,
+    0x0025d1065a1c1122ULL, 0x0025a48a382b863fULL, 0x0025837190eccdbcULL, 0x00256292e95d510cULL,
+    0x002541eda98d068cULL, 0x0024e15087fed8f5ULL, 0x0024c18b20979e5dULL, 0x0024ac7b336de0c5ULL,
+    0x0024a1fc478c60bbULL, 0x002463801231c009ULL, 0x0024300fd506ed33ULL, 0x0023f314a494da81ULL,
+    0x0023cadedd2fad3aULL, 0x00237b7ed2664a03ULL, 0x0023372967dbaf1dULL, 0x00231a308a371f20ULL,
+    0x002306fa63e1e600ULL, 0x0022fd6731575684ULL, 0x0022ea507805749cULL, 0x0022e0cce8b3d720ULL,
+    0x0022b1887857d161ULL, 0x00227977fcc49cc0ULL, 0x00225db37b5e5f4fULL, 0x0022421b91322ed6ULL,
+    0x0021f05b35f52102ULL, 0x0021e75de5c70d60ULL, 0x0021a01d6c19be96ULL, 0x0021974a6615c81aULL,
+    0x00213767697cf36aULL, 0x00211d9f7fad35f1ULL, 0x0020fb7d9dd36c18ULL, 0x0020e2123d661e0eULL,
+    0x0020d135b66ae990ULL, 0x0020c8cded4d7a8eULL, 0x0020b80b3f43ddbfULL, 0x002096b9180f46a6ULL,
+    0x00207de7e28de5daULL, 0x002054dec8cf1fb3ULL, 0x00204cb630b3aab5ULL, 0x00202428adc37bebULL,
+    0x001fec0c7834def4ULL, 0x001fc46fae98a1d0ULL, 0x001facda430ff619ULL, 0x001f7e17dd8e15e5ULL,
+    0x001f765a3556a4eeULL, 0x001f66ea49d802f1ULL, 0x001f5f3800faf9c0ULL, 0x001f38f4e6c0f1f9ULL,
+    0x001f0b8546752578ULL, 0x001f03ff83f001f0ULL, 0x001ec853b0a3883cULL, 0x001ec0ee573723ebULL,
+    0x001eaad38e6f6894ULL, 0x001e9c28a765fe53ULL, 0x001e94d8758c2003ULL, 0x001e707ba8f65e68ULL,
+    0x001e53a2a68f574eULL, 0x001e1380a56b438dULL, 0x001dbf9f513a3802ULL, 0x001db1d1d58bc600ULL,
+    0x001d9d358f53de38ULL, 0x001d81e6df6165c7ULL, 0x001d4bdf7fd40e30ULL, 0x001d452c7a1c958dULL,
+    0x001d37cf9b902659ULL, 0x001d1d3a5791e97bULL, 0x001ce89fe6b47416ULL, 0x001ce219f3235071ULL,
+    0x001cd516dcf92139ULL, 0x001cbb33bd1c2b8bULL, 0x001ca7e7d2546688ULL, 0x001c94b5c1b3dbd3ULL,
+    0x001c87f7f9c241c1ULL, 0x001c6202706c35a9ULL, 0x001c5bb8a9437632ULL, 0x001c174343b4111eULL,
+    0x001c04d0d3e46b42ULL, 0x001bfeb00fbf4308ULL, 0x001bec5dce0b202dULL, 0x001be03444620037ULL,
+    0x001bce09c66f6fc3ULL, 0x001ba40228d02b30ULL, 0x001b9225b1cf8919ULL, 0x001b864a2ff3f53fULL,
+    0x001b80604150e49bULL, 0x001b6eb1aaeaacf3ULL, 0x001b62f48da3c8ccULL, 0x001b516babe96092ULL,
+    0x001b2e9cef1e0c87ULL, 0x001b1d56bedc849bULL, 0x001b0c267546aec0ULL, 0x001ae45f62024fa0ULL,
+    0x001ad917631b5f54ULL, 0x001ac83d18cb608fULL, 0x001aa6c7ad8c063fULL, 0x001a90a7b1228e2aULL,
+    0x001a8027c03ba059ULL, 0x001a7533289deb89ULL, 0x001a2ed7ce16b49fULL, 0x0019fefc0a279a73ULL,
+    0x0019e4b0cd873b5fULL, 0x0019cfcdfd60e514ULL, 0x0019c56932d66c85ULL, 0x0019b5e1ab6fc7c2ULL,
+    0x0019b0b8a62f2a73ULL, 0x0019a149fc98942cULL, 0x001969517ec25b85ULL, 0x00194b3083360ba8ULL,
+    0x00194631f4bebdc1ULL, 0x00191e84127268fdULL, 0x00190adbb543984fULL, 0x001901130bd18200ULL,
+    0x0018e3e6b889ac94ULL, 0x0018c233420e1ec1ULL, 0x0018aa5872d92bd6ULL, 0x0018a5989945ccf9ULL,
+    0x00189c1e60b57f60ULL, 0x0018893fbc8690b9ULL, 0x00187b2bb3e1041cULL, 0x00186d27c9cdcfb8ULL,
+    0x001863d8bf4f2c1cULL, 0x00185f33e2ad7593ULL, 0x001855ef75973e13ULL, 0x001848160153f134ULL,
+    0x001835b72e6f0656ULL, 0x00182c922d83eb39ULL, 0x0018280243c0365aULL, 0x00181a5cd5898e73ULL,
+    0x001803c0961773aaULL, 0x0017ff4005ffd001ULL, 0x0017e8d670433edbULL, 0x0017d7066cf4bb5dULL,
+    0x0017ce285b806b1fULL, 0x0017af52cdf27e02ULL, 0x0017997d47d01039ULL, 0x00177f7ec2c6d0baULL,
+    0x00177b2f3cd00756ULL, 0x00176e4a22f692a0ULL, 0x001765b94271e11bULL, 0x001761732b044ae4ULL,
+    0x00173f7a5300a2bcULL, 0x001722112b48be1fULL, 0x001719b7a16eb843ULL, 0x00170d3c99cc5052ULL,
+    0x0016fcad7aed3bb6ULL, 0x0016f051b8231ffdULL, 0x0016e81beae20643ULL, 0x0016c3721584c1d8ULL,
+    0x0016b34c2ba09663ULL, 0x00169f3ce292ddcdULL, 0x00169344b2220a0dULL, 0x001687592593c1b1ULL,
+    0x00167787f1418ec9ULL, 0x001663e190395ff2ULL, 0x00164c7a4b6eb5b3ULL, 0x0016316a061182fdULL,
+    0x001629ba914584e4ULL, 0x00161e3d57de21b2ULL, 0x001612cc01b977f0ULL, 0x00160efe30c525ffULL,
+    0x0015da45249ec5deULL, 0x0015d68ab4acff92ULL, 0x0015c3f989d1eb15ULL, 0x0015b535ad11b8f0ULL,
+    0x0015addb3f424ec1ULL, 0x00159445cb91be6bULL, 0x00158d0199771e63ULL, 0x00157e87d9b69e04ULL,
+    0x001568f58bc01ac3ULL, 0x00155e3c993fda9bULL, 0x001548eacc5e1e6eULL, 0x001541d8f91ba6a7ULL,
+    0x00153747060cc340ULL, 0x001514569f93f7c4ULL, 0x00150309705d3d79ULL, 0x0014ff97020cf5bfULL,
+    0x0014e42c114cf47eULL, 0x0014b835bdcb6447ULL, 0x0014b182b53a9ab7ULL, 0x0014ae2ad094a3d3ULL,
+    0x00149a320ea59f96ULL, 0x001490441de1a2fbULL, 0x001489aacce57200ULL, 0x001475f82ad6ff99ULL,
+    0x00146c2cfe53204fULL, 0x00145f2ca490d4a1ULL, 0x001458b2aae0ec87ULL, 0x00144bcb0a3a3150ULL,
+    0x001428a1e65441d4ULL, 0x00142575a6c210d7ULL, 0x00141f2025ba5c46ULL, 0x00141bf6e35420fdULL,
+    0x001409141d1d313aULL, 0x0013dd8bc19c3513ULL, 0x0013da76f714dc8fULL, 0x0013d13e50f8f49eULL,
+    0x0013c80e37ca3819ULL, 0x0013bee69fa99ccfULL, 0x0013b8d0ede55835ULL, 0x0013afb7680bb054ULL,
+    0x0013acb0c3841c96ULL, 0x00139a9c5f434fdeULL, 0x0013949cf33a0d9dULL, 0x001382b4a00c31b0ULL,
+    0x00137fbbc0eedcbbULL, 0x001370ecf047b069ULL, 0x00136df9790e3155ULL, 0x0013567dd8defd5bULL,
+    0x0013539261fdbc34ULL, 0x00133c564292d28aULL, 0x001333ae178d6388ULL, 0x0013170ad00d1fd7ULL,
+    0x0013005f01db0947ULL, 0x0012f51d40342210ULL, 0x0012ef815e4ed950ULL, 0x0012ecb4abccd827ULL,
+    0x0012e71dc1d3d820ULL, 0x0012e45389a16495ULL, 0x0012c5d9226476ccULL, 0x0012badc391156fdULL,
+    0x0012aa78e412f522ULL, 0x0012a251f5f47fd1ULL, 0x001294cb85c53534ULL, 0x0012921963beb65eULL,
+    0x00128cb777c69ca8ULL, 0x001284aa6cf07294ULL, 0x001281fcf6ac7f87ULL, 0x001279f937367db9ULL,
+    0x00126cad0488be94ULL, 0x00126a06794646a2ULL, 0x00125a2f2bcd3e95ULL, 0x00124d108389e6b1ULL,
+    0x00124a73083771acULL, 0x00123d6acda0620aULL, 0x00122b4b2917eafdULL, 0x00122391bfce1e2fULL,
+    0x00121e6f1ea579f2ULL, 0x001216c09e471568ULL, 0x00120c8cb9d93909ULL, 0x001204ed58e64ef9ULL,
+    0x0011fd546578f00cULL, 0x0011e9310b8b4c9cULL, 0x0011da3405db9911ULL, 0x0011d7b6f4eb055dULL,
+    0x0011d2bee748c145ULL, 0x0011c1706ddce7a7ULL, 0x0011ba0fed2a4f14ULL, 0x0011b528538ed64aULL,
+    0x0011ab61404242acULL, 0x00119f378ce81d2fULL, 0x001195889ece79daULL, 0x00118e4c65387077ULL,
+    0x001187161d70e725ULL, 0x00116cd6d1c85239ULL, 0x001165bbe7ce86b1ULL, 0x0011635ee344ce36ULL,
+    0x0011579767b6d679ULL, 0x00114734711e2b54ULL, 0x0011428b90147f05ULL, 0x00113b92f3021636ULL,
+    0x001126cabc886884ULL, 0x0011247eb1b85976ULL, 0x0011190bb01efd65ULL, 0x0011091de0fd679cULL,
+    0x001104963c7e4e0bULL, 0x00110253516420b0ULL, 0x0010f70db7c41797ULL, 0x0010e75ee2bf9ecdULL,
+    0x0010e2e91c6e0676ULL, 0x0010da049b9d428dULL, 0x0010c6248fe3b1a2ULL, 0x0010c1c03ed690ebULL,
+    0x0010bb2e1379e3a2ULL, 0x0010b8fe7f61228eULL, 0x0010b4a10d60a4f7ULL, 0x0010ae192681ec0fULL,
+    0x0010abecfbe5b0aeULL, 0x00109eefd568b96dULL, 0x00109a9ff178b40cULL, 0x00108531e22f9ff9ULL,
+    0x00106ddec1af4417ULL, 0x0010614174a4911dULL, 0x00105f291f0448e7ULL, 0x00105afa0ef32891ULL,
+    0x001054b777bd2530ULL, 0x00104e79a97fb69eULL, 0x00104c661eafd845ULL, 0x0010462ea939c933ULL,
+    0x00102f8baa442836ULL, 0x00102d7ff7e94004ULL, 0x0010275ff9f13c02ULL, 0x001017213fcbb4d3ULL,
+    0x00101112234579d1ULL, 0x00100501907d271cULL, 0x00100300901b0510ULL, 0x000ffd008fe5050fULL,
+    0x000ff10e02dd5084ULL, 0x000fe13b9c80c67fULL, 0x000fdf4384be37adULL, 0x000fdb54cbe8766eULL,
+    0x000fd5725ca6ff32ULL, 0x000fc7c84684c6fbULL, 0x000fc3e5265dbaa8ULL, 0x000fc1f44e0cae12ULL,
+    0x000fb0921c50a7afULL, 0x000f999fd70cbc6bULL, 0x000f9023fd5339d0ULL, 0x000f8a78ce671475ULL,
+    0x000f8895fee86574ULL, 0x000f7f2ecb084b10ULL, 0x000f7d4eb7d10c29ULL, 0x000f73f52277a3c3ULL,
+    0x000f7217c598961cULL, 0x000f68cbb1448f42ULL, 0x000f633d0276e4c5ULL, 0x000f6163ac20ec79ULL,
+    0x000f582ba2bc16c6ULL, 0x000f5654f43290a0ULL, 0x000f4d2a23810bc6ULL, 0x000f47af4d6a2f27ULL,
+    0x000f4066f2b6e652ULL, 0x000f2555048e3a92ULL, 0x000f1c64588a5bf6ULL, 0x000f1a9be09cb411ULL,
+    0x000f11b7d5259d39ULL, 0x000f0aa284e7f802ULL, 0x000f0556e5e3b7f2ULL, 0x000efc8bcbc808e5ULL,
+    0x000eecd1a690efbbULL, 0x000ee79aed6d65f2ULL, 0x000edd386114d83aULL, 0x000ed2e44366e5e2ULL,
+    0x000ed12cf8e17f64ULL, 0x000ec1cd284b2b2dULL, 0x000ebcb44cadda1eULL, 0x000eb9505943771dULL,
+    0x000eb43d57efeadcULL, 0x000eaf2dd4c00b03ULL, 0x000ea0141c1ba6a6ULL, 0x000e9e68805f05a7ULL,
+    0x000e96142b87e431ULL, 0x000e8a7acd811b8cULL, 0x000e8587db3e001dULL, 0x000e823d186d44dcULL,
+    0x000e8098463ee194ULL, 0x000e7d4fbfb3ee1dULL, 0x000e69bba6981ffaULL, 0x000e681c5cf7d707ULL,
+    0x000e5e684930e334ULL, 0x000e5993247dc92dULL, 0x000e4cbfee201016ULL, 0x000e465ee7daf979ULL,
+    0x000e4199de07af5cULL, 0x000e3cd8031d4f40ULL, 0x000e2ea56c157eb2ULL, 0x000e221e5d4d3c73ULL,
+    0x000e208f09a841c7ULL, 0x000e1d716a945161ULL, 0x000e18c78ec8fd4dULL, 0x000e173a4a162079ULL,
+    0x000e1294881bb494ULL, 0x000e0df1d5f24661ULL, 0x000e063ec7f50b1eULL, 0x000e01a4313dc53dULL,
+    0x000df8780f47c350ULL, 0x000def57e8eb9666ULL, 0x000de1bdf3f63d46ULL, 0x000de03cb5099809ULL,
+    0x000ddbbaecc84bc9ULL, 0x000dd8bb5ca73db6ULL, 0x000dcb4d529a6e07ULL, 0x000dc55da73dea60ULL,
+    0x000db3ad2585011fULL, 0x000db0becf636a79ULL, 0x000daf481ca6fefbULL, 0x000dac5ba7565daeULL,
+    0x000da7fb4e419d19ULL, 0x000da6867a88d327ULL, 0x000d9dd005f50b02ULL, 0x000d9aeb01f763f7ULL,
+    0x000d90d31dd5804aULL, 0x000d7b6453358f31ULL, 0x000d744e69d900e4ULL, 0x000d7011a317260eULL,
+    0x000d67a0126e7c19ULL, 0x000d5dd39e775bd7ULL, 0x000d59a4f2990168ULL, 0x000d52b24cb6269dULL,
+    0x000d4a6571da4f04ULL, 0x000d49044eac6581ULL, 0x000d4642e40d1129ULL, 0x000d4222e81fe723ULL,
+    0x000d3ca6e8c89f41ULL, 0x000d388ce29d4edcULL, 0x000d31bc7b7d8013ULL, 0x000d306071c13fd5ULL,
+    0x000d2da935479b1aULL, 0x000d2430aa043597ULL, 0x000d2025bc6c7db7ULL, 0x000d1c1d4ad1732bULL,
+    0x000d196e5f46f8c8ULL, 0x000d156a0c9293e8ULL, 0x000d1413d26e0aeeULL, 0x000d0d68c6a4128fULL,
+    0x000d0c142eaf3837ULL, 0x000d01792ab9d70dULL, 0x000cf990317775bcULL, 0x000cf44f8c38790aULL,
+    0x000ce88d96d10e45ULL, 0x000ce5f39b07e906ULL, 0x000ce20e98148847ULL, 0x000cda4b9c30ccd7ULL,
+    0x000cd9015ae32495ULL, 0x000cd524244aca36ULL, 0x000cd14940099cf6ULL, 0x000ccd70ac089a07ULL,
+    0x000cbb9c535c4371ULL, 0x000cb7d0b46fe0ffULL, 0x000caefe5d7135f4ULL, 0x000cac7b5f00f0cdULL,
+    0x000ca7785ceddbeaULL, 0x000ca13a2a86e1dbULL, 0x000c9c4009753007ULL, 0x000c94d02e64bfabULL,
+    0x000c89b8c9c875efULL, 0x000c87447737277eULL, 0x000c860aaa2514e3ULL, 0x000c8397c813f1b9ULL,
+    0x000c74fa805d6d56ULL, 0x000c6db8a1f5cdfeULL, 0x000c6a1add9e2398ULL, 0x000c68e6be826648ULL,
+    0x000c5f4e25fc9df0ULL, 0x000c5bb8bf2ad1cdULL, 0x000c58256b316cedULL, 0x000c4fd5ad917b5bULL,
+    0x000c49ecb3ea4d7aULL, 0x000c41b00b7d950aULL, 0x000c3f57990b87a1ULL, 0x000c2ddcb31250f8ULL,
+    0x000c2a63b3651432ULL, 0x000c26ecae1db72eULL, 0x000c2377a18c051eULL, 0x000c1ede9efcec29ULL,
+    0x000c1b6e258d13a0ULL, 0x000c19243f5399bbULL, 0x000c17ff9f400305ULL, 0x000c112865703b94ULL,
+    0x000c0dbfaea33225ULL, 0x000c0b7af12ddfb9ULL, 0x000c0a58e464462cULL, 0x000c06f40512eef2ULL,
+    0x000bfa9275a2b247ULL, 0x000bf7367402cdf0ULL, 0x000bf61833f4f921ULL, 0x000bf3dc543a74a1ULL,
+    0x000be9d9302a7115ULL, 0x000be8bd6e051e01ULL, 0x000be6868804d5a6ULL, 0x000bdfe6c4359f0eULL,
+    0x000bdeccdb0b5c3aULL, 0x000bdb8058ee429aULL, 0x000bd94e5c1b371fULL, 0x000bcb1d293b1af3ULL,
+    0x000bc7db8db0c1a5ULL, 0x000bc49bbdfd2662ULL, 0x000bc2723240f402ULL, 0x000bbe217c2b7c13ULL,
+    0x000bb8c10aab27b2ULL, 0x000ba7ad528a7e79ULL, 0x000b9f3611b48c5eULL, 0x000b9e2806e5e7c4ULL,
+    0x000b9aff0c4913feULL, 0x000b98e4aedd581cULL, 0x000b97d7c94b7dc2ULL, 0x000b95be902d9d9eULL,
+    0x000b94b23c872b90ULL, 0x000b8f77714d15a1ULL, 0x000b882d0beff6a1ULL, 0x000b850ff9852703ULL,
+    0x000b82fd86db8806ULL, 0x000b7edadd32f76cULL, 0x000b79b3b4df3b7bULL, 0x000b769e6d59833fULL,
+    0x000b6c636b5141ffULL, 0x000b6a59ceae8801ULL, 0x000b6955461e38f7ULL, 0x000b6648c2dc6bc2ULL,
+    0x000b572282260209ULL, 0x000b552072bde889ULL, 0x000b511e7552f9c4ULL, 0x000b4c1ff34a5c0eULL,
+    0x000b4922f58d4aa2ULL, 0x000b46278c16b967ULL, 0x000b42301cd99b49ULL, 0x000b3f385dd77e4eULL,
+    0x000b394d8ef8f0f6ULL, 0x000b375601507c14ULL, 0x000b3463f76be376ULL, 0x000b3368f6c4a07cULL,
+    0x000b3078fc1c25f0ULL, 0x000b2e84854e93e5ULL, 0x000b2b971aa909a4ULL, 0x000b2a9da39d6bc8ULL,
+    0x000b25c0dc29a0fcULL, 0x000b24c8698449a7ULL, 0x000b1d0ae579aefeULL, 0x000b1a2698ea2f9eULL,
+    0x000b108dc4186078ULL, 0x000b0ea463b00212ULL, 0x000b08ec37007962ULL, 0x000b024778cc023cULL,
+    0x000af515df36a88eULL, 0x000af24635f6561eULL, 0x000ae8f1b92baeafULL, 0x000ae715eee11f8eULL,
+    0x000adec0b0a3bb36ULL, 0x000adb10aa4c956fULL, 0x000ad84e49752245ULL, 0x000ad6782597f0c2ULL,
+    0x000ad3b81a0d72feULL, 0x000acd52beced79eULL, 0x000aca9755063254ULL, 0x000ac7dd4cafb12aULL,
+    0x000ac354f80dca44ULL, 0x000ac26d5c2b8ad2ULL, 0x000abde997dabd3dULL, 0x000ab883aa1100a0ULL,
+    0x000ab4ed637f5a0bULL, 0x000ab074e9febf52ULL, 0x000aaf90778c2039ULL, 0x000aab1c7684f034ULL,
+    0x000aa78f20ebbb3eULL, 0x000aa23f8dafd4ccULL, 0x000a9dd69cad5934ULL, 0x000a935004a07302ULL,
+    0x000a9270690f3d14ULL, 0x000a90b1a0aa5d30ULL, 0x000a8d35c9d731e9ULL, 0x000a8a9a6a51f16cULL,
+    0x000a88de370f596bULL, 0x000a856786adae36ULL, 0x000a7da4c77d3161ULL, 0x000a7959f863d4a1ULL,
+    0x000a76c85e80c195ULL, 0x000a743806dc44c4ULL, 0x000a735d866dfa0aULL, 0x000a70cedb02531eULL,
+    0x000a6c8e842c770fULL, 0x000a67791215dd74ULL, 0x000a66a0a51d363dULL, 0x000a626893011861ULL,
+    0x000a5fe22c55c089ULL, 0x000a5d5cffb77275ULL, 0x000a5ad90c4186e5ULL, 0x000a578057e7c2ebULL,
+    0x000a54ff3bb10e91ULL, 0x000a50d5683edc94ULL, 0x000a4e57854b3df4ULL, 0x000a4d8328c4b800ULL,
+    0x000a4b06e01d97b3ULL, 0x000a488bca2c4449ULL, 0x000a4611e6132ed5ULL, 0x000a41f40f39e646ULL,
+    0x000a3eab5c3e44e9ULL, 0x000a34ddd50561e0ULL, 0x000a326d60e94186ULL, 0x000a2985a81ce614ULL,
+    0x000a28b72e26f82eULL, 0x000a217aa3479693ULL, 0x000a1fe05c62df4bULL, 0x000a1cad538aebf9ULL,
+    0x000a18b05f490083ULL, 0x000a0ccc4c28fc31ULL, 0x000a09a544d01ffeULL, 0x000a0294aa53e9a2ULL,
+    0x000a01041a6aaed5ULL, 0x000a003c01680870ULL, 0x0009fc5558a971c8ULL, 0x0009f9ff9c3c03e5ULL,
+    0x0009f9389b864ab9ULL, 0x0009f6e4534bdca8ULL, 0x0009f557687235c2ULL, 0x0009ee633c0391abULL,
+    0x0009eb4f28e0bb39ULL, 0x0009e6b49e92e4bbULL, 0x0009dfd4ccbd0045ULL, 0x0009d9c0828536c1ULL,
+    0x0009d77ad449f777ULL, 0x0009d6b92b28ee48ULL, 0x0009d231a476ed51ULL, 0x0009cfef711bf120ULL,
+    0x0009cc2e1448b765ULL, 0x0009cb6e26cbc64dULL, 0x0009c7b03b4a9c67ULL, 0x0009c6f0fd980ab1ULL,
+    0x0009c4b3f3a30c3fULL, 0x0009c0fb29436687ULL, 0x0009bbca025b7aecULL, 0x0009ba4f4421e52cULL,
+    0x0009b1783809ff03ULL, 0x0009b0bc5b4d2eacULL, 0x0009aae172fd8b9cULL, 0x0009aa26954607edULL,
+    0x0009a681e758a022ULL, 0x0009a5c7b284942eULL, 0x0009a2264ecc5558ULL, 0x00099aebb39be56fULL,
+    0x0009997ae1a9faacULL, 0x000998c2a22b6900ULL, 0x000997527603f8a8ULL, 0x00099473685e4d50ULL,
+    0x00098eba72512a13ULL, 0x00098c96d8dee9e1ULL, 0x00098a743453554eULL, 0x000989be33c9e6bdULL,
+    0x0009857c692e9a59ULL, 0x00097fd540c05c9eULL, 0x00097d04302ed944ULL, 0x00097b9c48289935ULL,
+    0x0009798133ece717ULL, 0x00096f07c683689eULL, 0x00096e55d6393fc5ULL, 0x00096addad861696ULL,
+    0x00096a2c5a2cf0cfULL, 0x00096818fc825ebaULL, 0x000966b74027f48aULL, 0x000964a56850b8edULL,
+    0x000962947990eb36ULL, 0x00095fd4a4c885e0ULL, 0x00095dc5d3954fdeULL, 0x00095c671ddfe516ULL,
+    0x0009584d6340ddf1ULL, 0x00095641de84afccULL, 0x000953893c386521ULL, 0x00094f7740d87794ULL,
+    0x00094e1cb70c9ce0ULL, 0x00094962ecbcc7ceULL, 0x00094559c69059cfULL, 0x000941ff7e640716ULL,
+    0x000939fd7a24b099ULL, 0x000937ff22c014bdULL, 0x000934050872c09eULL, 0x00093209446d56f6ULL,
+    0x0009316033b5bd22ULL, 0x00092a22b9a79374ULL, 0x000927838edba206ULL, 0x000921a2e7112833ULL,
+    0x00091e623d5660d0ULL, 0x00091c6fc0cab8b6ULL, 0x000917e7d88028ebULL, 0x0009169d455585cdULL,
+    0x000915f81ef2d529ULL, 0x0009140938595d3aULL, 0x000910d2360a450eULL, 0x00090e417104eabdULL,
+    0x00090c55d0fdea28ULL, 0x00090b0e84c04f20ULL, 0x000909243fac6b70ULL, 0x0008ff9d0440d137ULL,
+    0x0008fb3192789d73ULL, 0x0008f80c0d5031e3ULL, 0x0008f76b3664f164ULL, 0x0008f3a80550abc3ULL,
+    0x0008f087c50e00c4ULL, 0x0008efe7fb408cc2ULL, 0x0008eaecce5c4fd7ULL, 0x0008ea4dccaaec0bULL,
+    0x0008e4ba9fbc2ff0ULL, 0x0008dd5688a3b7d6ULL, 0x0008d7d3821fd94fULL, 0x0008d5feb03c31d7ULL,
+    0x0008d12033cc9d30ULL, 0x0008cbac4dec6a82ULL, 0x0008c9dc80ab604bULL, 0x0008c942115dcc96ULL,
+    0x0008c3d7df67b539ULL, 0x0008c2a4bc35cb3bULL, 0x0008c0d8a4f1f264ULL, 0x0008c03f71cbf906ULL,
+    0x0008bd42abd9a107ULL, 0x0008bae051d7f6ffULL, 0x0008b7e735068135ULL, 0x0008b61f82c5fb08ULL,
+    0x0008b4588a74a05aULL, 0x0008b1fb0a7ed403ULL, 0x0008b0ccc5d8f5c8ULL, 0x0008af07f8ac5146ULL,
+    0x0008ae71328ffd49ULL, 0x0008ab8086624822ULL, 0x0008aaea3ab5ae89ULL, 0x0008a7661f7020feULL,
+    0x0008a63ab88aa8ddULL, 0x0008a47a35d020f3ULL, 0x0008a2ba68a3cebfULL, 0x0008a2254c852497ULL,
+    0x00089ea849898bb3ULL, 0x00089d7f3e285109ULL, 0x000899720af36739ULL, 0x00089442160d11dcULL,
+    0x0008931bd5875a22ULL, 0x000891630877aedfULL, 0x00088baaad83e38fULL, 0x00088a86b9090aa4ULL,
+    0x0008883fb99bf244ULL, 0x0008868b45e727eeULL, 0x00088568aef30d47ULL, 0x0008832468f0bcddULL,
+    0x00088202b9a4df76ULL, 0x00087e0f31872e9bULL, 0x00087c5ecd731f42ULL, 0x00087b3eea3bb388ULL,
+    0x00087751a6c67d78ULL, 0x000873f6e2f9d34aULL, 0x000872d938dcfc01ULL, 0x0008724a80151dbaULL,
+    0x000869f677f6cc1aULL, 0x000868db701df58dULL, 0x0008623f563a7d6dULL, 0x00086099ef0c8886ULL,
+    0x00085ef52d38fe87ULL, 0x00085bad981c7847ULL, 0x0008586893de7cfcULL, 0x0008549b491e9efeULL,
+    0x000852fb3859bea4ULL, 0x000851e631fc08f8ULL, 0x0008515bc9cde5f1ULL, 0x000850472f6185b3ULL,
+    0x00084b6defbc166bULL, 0x000849d17159854bULL, 0x0008469a54a20645ULL, 0x00084476f9401adeULL,
+    0x000842dd2e2dc25dULL, 0x000841cc543f58cbULL, 0x00083e9b6c3df688ULL, 0x00083e1382f22ff9ULL,
+    0x00083ae57a327933ULL, 0x000832fd15e00939ULL, 0x00082ecb9c6669acULL, 0x00082e45ba6652c4ULL,
+    0x00082cb47b00abaaULL, 0x000826fa5d0ce5aaULL, 0x000823598cfc6865ULL, 0x000821cc79da73f1ULL,
+    0x00081f37ff3d12c0ULL, 0x00081c21947b0acdULL, 0x00081a97404af5f7ULL, 0x00081a13f02d110eULL,
+    0x0008190d81c9877bULL, 0x000817016c0b3ffdULL, 0x00081473c50ac33eULL, 0x000812ec59f2d11aULL,
+    0x0008116582e237c8ULL, 0x00080b4fe85ec545ULL, 0x000807c7894d029aULL, 0x00080644e5d38d46ULL,
+    0x0008054374444cd2ULL, 0x00080341528987dfULL, 0x0008004002001000ULL, 0x0007fbc240cd92caULL,
+    0x0007f945ad35da8fULL, 0x0007f8c68c111089ULL, 0x0007f64bd3962107ULL, 0x0007f5cd1141e394ULL,
+    0x0007f4cfbbdfcd47ULL, 0x0007f35431d09b88ULL, 0x0007ee670b5ec5b9ULL, 0x0007ecede39462f1ULL,
+    0x0007ebf2c1862473ULL, 0x0007e885b3145b90ULL, 0x0007e78ba7f07025ULL, 0x0007e70eb9866fafULL,
+    0x0007e6150af40f2eULL, 0x0007e2ad0c799bc4ULL, 0x0007e1383c54568dULL, 0x0007de50388de096ULL,
+    0x0007d8869ac54f49ULL, 0x0007d61fc634d5aaULL, 0x0007d4af94d0dcbbULL, 0x0007d2c57a54c5e7ULL,
+    0x0007d06229d12d53ULL, 0x0007cfe8134944efULL, 0x0007c8c7b743f5e7ULL, 0x0007c7d57328b239ULL,
+    0x0007c66a7b5e4d91ULL, 0x0007c5f19b7ea617ULL, 0x0007c31d901d97e0ULL, 0x0007c22cac053676ULL,
+    0x0007bee358dcfe46ULL, 0x0007bd7ba18bb750ULL, 0x0007b58ed4c9485dULL, 0x0007b2c6a742300dULL,
+    0x0007b0ecfb860611ULL, 0x0007af8a500a1665ULL, 0x0007ad3c4dd8b785ULL, 0x0007acc677dc4383ULL,
+    0x0007abdaf642d305ULL, 0x0007a744bb263cb0ULL, 0x0007a4fbab8d73d4ULL, 0x0007a3289a6adcf2ULL,
+    0x00079f8513be21a6ULL, 0x00079f10e14e6304ULL, 0x00079cccb470a424ULL, 0x000799a2b85cdd3cULL,
+    0x000798bbc761a875ULL, 0x000798486371f3d6ULL, 0x000795952afcd47aULL, 0x0007943c46ef6427ULL,
+    0x000790a6e76250e9ULL, 0x00078f4fc30c8cebULL, 0x00078d86fa3f322fULL, 0x00078ca2e6ab1963ULL,
+    0x00078adb60c8d110ULL, 0x000789f7ee54a2e9ULL, 0x000788a3270d45b7ULL, 0x000786dd830b068eULL,
+    0x00078589d3fc977dULL, 0x000784369c9cc9e3ULL, 0x0007819193ec69e8ULL, 0x0007803fc21df1feULL,
+    0x00077f5ecd89bceeULL, 0x00077e0dc16d411eULL, 0x00077cbd2b9b81c4ULL, 0x00077afd1b701e63ULL,
+    0x0007770ff3671515ULL, 0x000776312467a5c2ULL, 0x000771da22f49238ULL, 0x000770fc8a7a9ba1ULL,
+    0x00076e64f5cfa392ULL, 0x00076df689f80c4eULL, 0x00076bcf2ed12008ULL, 0x00076a84f7dc140bULL,
+    0x00076a16ff0b5309ULL, 0x000767f1e1dae976ULL, 0x0007656094d837b3ULL, 0x000764f3344f247bULL,
+    0x000764189921dda4ULL, 0x00075fd684e9545fULL, 0x00075e90739b7a15ULL, 0x00075838b0f595e7ULL,
+    0x000756f53f9ebfceULL, 0x0007561ddc858b97ULL, 0x0007546faa5526e9ULL, 0x00075257006dd319ULL,
+    0x00074fd49601c555ULL, 0x00074e9405d29df4ULL, 0x00074e29437d1334ULL, 0x000748579e5e295cULL,
+    0x000747ed91eea69bULL, 0x000746afb4f70c05ULL, 0x000745dc0885ddd9ULL, 0x000745724456afeeULL,
+    0x00074225d2b117e6ULL, 0x00073fae73956bafULL, 0x00073f4562c550a7ULL, 0x00073e0a77ab20f5ULL,
+    0x00073bfe87d04c69ULL, 0x00073a5c368c6febULL, 0x00073579ad9acb41ULL, 0x0007330ae22973e4ULL,
+    0x000731d419f7d98dULL, 0x00072e3235030eabULL, 0x00072cfd0e8c3508ULL, 0x00072c2f2ea65edeULL,
+    0x0007296009d8e40dULL, 0x0007282c81d4c763ULL, 0x0007275fb5c77f02ULL, 0x000724fa63f76782ULL,
+    0x0007236266c77ad3ULL, 0x00072230e042e08aULL, 0x00071fcf0550bb74ULL, 0x00071f0416cf5919ULL,
+    0x00071dd405abc4f4ULL, 0x00071b75134b8ad7ULL, 0x00071a4631a9b6cfULL, 0x000717e99c86a9f6ULL,
+    0x000717850015468fULL, 0x00071461ad33a1a4ULL, 0x000710796b26e1acULL, 0x00070fb1e26027b8ULL,
+    0x00070f4e2e7ecce6ULL, 0x00070d5c4fe359b8ULL, 0x000709ded78034caULL, 0x00070852da10190dULL,
+    0x0007078d1c95b4d1ULL, 0x000704da5af8e617ULL, 0x00070415607121d8ULL, 0x000703b2f35e56bfULL,
+    0x0007028becd50964ULL, 0x0006fe5565a6c742ULL, 0x0006fd3021a277a1ULL, 0x0006fa854d564742ULL,
+    0x0006f96148a8087fULL, 0x0006f83da3611ce2ULL, 0x0006f658636e1e4bULL, 0x0006f535bbabf653ULL,
+    0x0006f4d4ee25a988ULL, 0x0006f2f1882f1f75ULL, 0x0006f290f9ad3a0cULL, 0x0006f1cffc17fb02ULL,
+    0x0006f16f8d013870ULL, 0x0006ed4d77e55fdeULL, 0x0006eced85e24bcdULL, 0x0006ec2dc0fe6791ULL,
+    0x0006eb0e6764fd45ULL, 0x0006e9ef6aebc58eULL, 0x0006e7b288a51304ULL, 0x0006e694a27d73e2ULL,
+    0x0006e3faf093b753ULL, 0x0006e220a456cb53ULL, 0x0006dfe8cc4e4e77ULL, 0x0006decd69717e97ULL,
+    0x0006dd541e23c554ULL, 0x0006dc97b52a2970ULL, 0x0006d5ff17941edeULL, 0x0006d371d4012c57ULL,
+    0x0006d14366ed629cULL, 0x0006d02cb6256b55ULL, 0x0006cf731c62a4c7ULL, 0x0006ce5cffc2bebbULL,
+    0x0006ce005f440535ULL, 0x0006cbd56adace7dULL, 0x0006cac0752977e5ULL, 0x0006c89791faa5b8ULL,
+    0x0006c5b8851e72f8ULL, 0x0006c55ccf4124d7ULL, 0x0006c392d3522526ULL, 0x0006c2251e47dc4eULL,
+    0x0006be3a872000d7ULL, 0x0006bddf9bb7a1d3ULL, 0x0006bbbee025e011ULL, 0x0006baaf033bb216ULL,
+    0x0006b9f9f4e96df6ULL, 0x0006b8eaa6becc74ULL, 0x0006b5bebc3ecd05ULL, 0x0006b564b506c984ULL,
+    0x0006b3494fa5206dULL, 0x0006b23c1bef92c4ULL, 0x0006b188d30de23eULL, 0x0006af6fd92445e1ULL,
+    0x0006ae0a9804cd17ULL, 0x0006acff08ff23b3ULL, 0x0006aae8e5d30bb1ULL, 0x0006aa372444360cULL,
+    0x0006a92cc74e07dbULL, 0x0006a719069323bbULL, 0x0006a60fa280c422ULL, 0x0006a5b73e305952ULL,
+    0x0006a3a5a4ddb046ULL, 0x0006a19554c7de38ULL, 0x0006a0e5830ad957ULL, 0x00069e7f435ad500ULL,
+    0x00069d788b89a6bfULL, 0x00069abd84523f00ULL, 0x000699b7f64e39ceULL, 0x00069960d8f24fdcULL,
+    0x000697adccc0eefaULL, 0x0006965264328940ULL, 0x00069346c2f283f7ULL, 0x0006924382a19007ULL,
+    0x00068c8c4acd5266ULL, 0x00068c3687b62238ULL, 0x0006878973286d2aULL, 0x00068734331a64a0ULL,
+    0x0006838caf297316ULL, 0x0006828e40d874f9ULL, 0x0006823982a82879ULL, 0x000680924cdbc150ULL,
+    0x00067e978e24af0cULL, 0x00067e433703c77dULL, 0x00067d4664f09cf6ULL, 0x00067c9e03991fa5ULL,
+    0x00067b4da73b5283ULL, 0x000677b3664b3c74ULL, 0x000676b8920a5a23ULL, 0x0006766506d754f2ULL,
+    0x000674c3cd424d1eULL, 0x000673769cfde890ULL, 0x000672d0373716d8ULL, 0x000671d6dd628ef0ULL,
+    0x0006708adab20b9fULL, 0x00066fe50b70e017ULL, 0x00066df46590f0b4ULL, 0x00066b0d9d11e028ULL,
+    0x0006691fe0bf8498ULL, 0x000665eb8e555333ULL, 0x00066547e038c2ddULL, 0x00066452985b48bbULL,
+    0x0006635d99f07a92ULL, 0x000662176369b241ULL, 0x0006617478ef1384ULL, 0x000661230fdfb43eULL,
+    0x00065e98eb133ba3ULL, 0x00065cb2a2c7c290ULL, 0x00065c61b2ec9829ULL, 0x00065acd7c308dcaULL,
+    0x0006598aad93b4e4ULL, 0x000657f7df4a69e8ULL, 0x000657a76795910eULL, 0x000657069015cb26ULL,
+    0x00065615888d2e0fULL, 0x000653e437a9fb99ULL, 0x000652044bbeeb7bULL, 0x00064e9751927718ULL,
+    0x00064d59567b6ef3ULL, 0x000649043f57deceULL, 0x000648b5412c0fceULL, 0x000648175c16de75ULL,
+    0x00064503b2b52e68ULL, 0x0006446686fd4857ULL, 0x00064417fcabd341ULL, 0x0006437aff183f39ULL,
+    0x00064156793e6e1aULL, 0x00063fcf917758a3ULL, 0x00063dfb76f74b90ULL, 0x00063dad8d2d38ecULL,
+    0x00063bdab1cf3febULL, 0x0006396ddfc288e2ULL, 0x000639206775bab8ULL, 0x000634e6e81e738cULL,
+    0x000633b2f5ccfab1ULL, 0x0006306681a1c307ULL, 0x00062f344d3550f3ULL, 0x00062e9b5f5cf2beULL,
+    0x00062db631f59f37ULL, 0x00062cd146e48698ULL, 0x00062abc23bfba9fULL, 0x00062a24129714c8ULL,
+    0x000628f448174adbULL, 0x0006272d7364bb61ULL, 0x0006264a6b60976eULL, 0x00062567a4c4c58aULL,
+    0x000624d099faac13ULL, 0x000621df1634a6d1ULL, 0x00062148b8dbb906ULL, 0x00061ea578a6303dULL,
+    0x00061e5a95610f82ULL, 0x00061c99d7f0879aULL, 0x00061bb9d995a12dULL, 0x00061b24a8f71a73ULL,
+    0x00061a4515620c0fULL, 0x0006183c601617daULL, 0x000615a0e1e2f4c2ULL, 0x0006142f041ba3c5ULL,
+    0x000613079ddc8cf1ULL, 0x00061196fb9d49e4ULL, 0x00060cffedd90036ULL, 0x00060c24610ad7c5ULL,
+    0x00060ab7008af671ULL, 0x000609dc1961711aULL, 0x00060901702557b8ULL, 0x000608b89acfc043ULL,
+    0x000607de43fcb3b2ULL, 0x00060599346ebef5ULL, 0x000604bfbf4cf2b7ULL, 0x00060477508dc93bULL,
+    0x000602c546eeb206ULL, 0x000601ec9dca8ae0ULL, 0x0005fdfcad1dd7f9ULL, 0x0005fdb4e0c1f5bfULL,
+    0x0005fc4e47afc186ULL, 0x0005fb2fdf7a2bb0ULL, 0x0005f8f44fc9dfd9ULL, 0x0005f81e67dae102ULL,
+    0x0005f7018fa56898ULL, 0x0005f62c3323b326ULL, 0x0005f4c91d56c2a5ULL, 0x0005f17789b14c73ULL,
+    0x0005eeb6608aabe7ULL, 0x0005ed56c0dcc8dfULL, 0x0005ed108142f803ULL, 0x0005ebb1a4bcffcaULL,
+    0x0005eb6b8c1aea6dULL, 0x0005e9c7804fd405ULL, 0x0005e93bb01bb547ULL, 0x0005e86a2833825dULL,
+    0x0005e5b15ad4ceaeULL, 0x0005e5264b93c4f4ULL, 0x0005e4e0cd8e2000ULL, 0x0005e3405facd612ULL,
+    0x0005e0d1692441abULL, 0x0005df783044a3ccULL, 0x0005df3337e5c293ULL, 0x0005dddabce0ac54ULL,
+    0x0005dd95ea6aa25bULL, 0x0005dd0c5868fe25ULL, 0x0005da5df7d0a097ULL, 0x0005d83aa10c1f81ULL,
+    0x0005d4c486ef93c2ULL, 0x0005d43c91455574ULL, 0x0005d32cf02fb0ffULL, 0x0005d261783bdafaULL,
+    0x0005d1d9f1c4d90eULL, 0x0005d043f21a1d91ULL, 0x0005cf7945340b59ULL, 0x0005ce6b5f258978ULL,
+    0x0005ccd73d836eb9ULL, 0x0005cb43f766471cULL, 0x0005ca7aa671b13bULL, 0x0005c9f48ed29db3ULL,
+    0x0005c8e8a84d30e0ULL, 0x0005c609e0d4e6acULL, 0x0005c5c738aa78a3ULL, 0x0005c3b2cf799dc7ULL,
+    0x0005c1e22dbe770fULL, 0x0005c096ff7bb26fULL, 0x0005bfd091874f63ULL, 0x0005be4455e115d4ULL,
+    0x0005bcb8ef594341ULL, 0x0005baecaedc1e87ULL, 0x0005ba27c6e84379ULL, 0x0005b9a49ef67ecdULL,
+    0x0005b716369b563dULL, 0x0005b6939b098788ULL, 0x0005b50c5417a1a7ULL, 0x0005b448ff16204fULL,
+    0x0005b407ee5b0776ULL, 0x0005b344deef197eULL, 0x0005b282039af646ULL, 0x0005b07b6373fce3ULL,
+    0x0005af789d97d750ULL, 0x0005acb2d6b43687ULL, 0x0005ac7272949f4dULL, 0x0005a8ef4ec63aadULL,
+    0x0005a7ef3571d956ULL, 0x0005a72f5dd3e12cULL, 0x0005a6af94fb62eaULL, 0x0005a431faaac8c1ULL,
+    0x0005a3b2b8d2f355ULL, 0x0005a23579b7995cULL, 0x00059f3d565432dcULL, 0x00059cc6468cb462ULL,
+    0x00059c485294487fULL, 0x00059b4cacd797c0ULL, 0x00059a129991c1e5ULL, 0x000599d3d9680839ULL,
+    0x000597de9d8743c0ULL, 0x000597a00eae0426ULL, 0x000596292843369fULL, 0x000594b305febc4fULL,
+    0x000590931e316e3aULL, 0x0005905532188f18ULL, 0x00058fd96a0bb04eULL, 0x00058f1fe64a0c76ULL,
+    0x00058dad6fa77e03ULL, 0x00058cf47ca0e17eULL, 0x00058c3bb9b2fb2aULL, 0x00058b45ab267bbeULL,
+    0x00058a8d582962cfULL, 0x00058a1290c2392aULL, 0x000589d53506a44aULL, 0x0005891d41aba014ULL,
+    0x0005863f5099a5c0ULL, 0x000585c547a45c3eULL, 0x00058364563b0d54ULL, 0x00058234a212e490ULL,
+    0x0005817ea7e29403ULL, 0x000580c8dca3754eULL, 0x00057f216337cdabULL, 0x00057ea893d7e7c9ULL,
+    0x00057df383a862afULL, 0x00057d3ea20fa724ULL, 0x00057d0261340825ULL, 0x00057b994874569cULL,
+    0x00057ae501a5f6e1ULL, 0x000579b8f27605b0ULL, 0x0005797cfed2e625ULL, 0x00057851897f6993ULL,
+    0x0005779e1a18fcb0ULL, 0x0005754947a8d715ULL, 0x000574d2276e36b0ULL, 0x000571cdc3fb7dc1ULL,
+    0x000571573b8d1b72ULL, 0x0005711bfee50650ULL, 0x0005706a6721817fULL, 0x00056de0bd57fdcbULL,
+    0x00056da5cbf6ecaeULL, 0x00056ae40097b0f0ULL, 0x00056a6ea4606229ULL, 0x000569bebf469a3aULL,
+    0x00056984277df050ULL, 0x0005690f06c8bbd7ULL, 0x0005685f7ad5d0cfULL, 0x000565a3072596e2ULL,
+    0x000564f458ec2be9ULL, 0x0005640bb5496dbbULL, 0x0005639780da4177ULL, 0x0005635d6df90de9ULL,
+    0x00055f8516fb9245ULL, 0x00055ed7f3bfa35bULL, 0x00055df15ddbe616ULL, 0x00055c2519d0ceb1ULL,
+    0x00055accb0f4a467ULL, 0x00055a935af3b950ULL, 0x00055974f4d20c94ULL, 0x0005593bbb8e179bULL,
+    0x0005581de4e7386dULL, 0x000557729d5e4aa8ULL, 0x0005568e80a82688ULL, 0x0005561c8ed4d45eULL,
+    0x00055538e425e9e0ULL, 0x000553e3f243b853ULL, 0x000551749af9a9f4ULL, 0x000550cafd47a820ULL,
+    0x00054f3fdc2910f1ULL, 0x00054ecf2166f177ULL, 0x00054bf42a4a7181ULL, 0x00054b83fb48be74ULL,
+    0x00054b4beabda325ULL, 0x000549fbe8c729f5ULL, 0x000548e4664f25acULL, 0x000548051dc4f4d6ULL,
+    0x000547959520fa1fULL, 0x000546b6bb0478f0ULL, 0x00054568fd823160ULL, 0x000544f9e2fa17abULL,
+    0x000543759607daa9ULL, 0x000542cf704f3e54ULL, 0x00054115291c3890ULL, 0x0005406f994378d9ULL,
+    0x00053f9318d3bcd6ULL, 0x00053f24f3b94089ULL, 0x00053e7fdde9c0ddULL, 0x00053ddaf0aa066dULL,
+    0x00053cff48a91910ULL, 0x00053c5ab9d41c0fULL, 0x00053b48d01e6897ULL, 0x00053a00b1b41799ULL,
+    0x000539ca11989667ULL, 0x000539264c05cb66ULL, 0x00053882ae8720a6ULL, 0x000536cf2360e377ULL,
+    0x000535f5c8300971ULL, 0x00053552f239fba5ULL, 0x000534b044003e78ULL, 0x0005336b5e879685ULL,
+    0x0005325d1837b3d5ULL, 0x0005322717521973ULL, 0x000531852eec6c54ULL, 0x00052fa061e2f337ULL,
+    0x00052f34d61979f9ULL, 0x00052e93a512b94bULL, 0x00052df29b2ea2b5ULL, 0x00052d51b85ef753ULL,
+    0x00052c1067c40921ULL, 0x00052a2f9292300eULL, 0x0005295a4e8303a6ULL, 0x000528ba88985ac4ULL,
+    0x000527b094878fb7ULL, 0x000526dc1e58e8a2ULL, 0x000524ff0e352c64ULL, 0x000524953979d7b3ULL,
+    0x0005232356b6177aULL, 0x00052285108c3ed2ULL, 0x000520ab224f9920ULL, 0x00051fa46a651231ULL,
+    0x00051ed28954aaa7ULL, 0x00051dcc8e61406aULL, 0x00051c92b8234d55ULL, 0x00051c5e78623937ULL,
+    0x00051bc1d224d627ULL, 0x00051a88f6177c1aULL, 0x00051950af97ca9eULL, 0x000515ab593d504dULL,
+    0x00051543f757c83eULL, 0x000514a9034650efULL, 0x000513daa1e3009dULL, 0x0005137389bed852ULL,
+    0x000512d9042e88deULL, 0x000512a58a7e1165ULL, 0x0005123ea359ada1ULL, 0x000510705cbd09a2ULL,
+    0x00050f3ce463d8b5ULL, 0x00050ea35ee1a31dULL, 0x00050dd6e57249f4ULL, 0x00050d3db4bcbaadULL,
+    0x00050ca4a8495fb8ULL, 0x00050c3eb41ae53eULL, 0x00050a74b00922f3ULL, 0x00050a41e011029eULL,
+    0x000509dc4c20fc8eULL, 0x000509a9882824feULL, 0x000507498f9b1dccULL, 0x000506e47339fc81ULL,
+    0x0005064ce66cee97ULL, 0x000505b57d4d6f05ULL, 0x00050454bd274aebULL, 0x0005016362905607ULL,
+    0x000500cd20da42f4ULL, 0x00050069089db4efULL, 0x0004ffd30194f1c3ULL, 0x0004fea75ce3f68eULL,
+    0x0004fe11bf23156eULL, 0x0004fc20031d9401ULL, 0x0004fbbca59e5190ULL, 0x0004faf61904b041ULL,
+    0x0004fa92e9e3197fULL, 0x0004f9ccb9e45c70ULL, 0x0004f9383e5308cdULL, 0x0004f8a3e55b719eULL,
+    0x0004f84112940b42ULL, 0x0004f55dcdd594f7ULL, 0x0004f52ca386ec61ULL, 0x0004f437091368d3ULL,
+    0x0004f310cd180832ULL, 0x0004f24cf0e8cb45ULL, 0x0004f15872c3bda8ULL, 0x0004f0951e958b42ULL,
+    0x0004ee4c8b38392aULL, 0x0004edbabac992c2ULL, 0x0004ec977ee4dbf8ULL, 0x0004ec3688cc2375ULL,
+    0x0004eae3a0ccb143ULL, 0x0004ea82edb2fe99ULL, 0x0004e9f1fce3f4ddULL, 0x0004e9c1b409e72aULL,
+    0x0004e71f3c800273ULL, 0x0004e5cf0fb5010dULL, 0x0004e44fb8c3370dULL, 0x0004e41fde5fa4e7ULL,
+    0x0004e3010cc539beULL, 0x0004e271d538d712ULL, 0x0004e2126d118790ULL, 0x0004e0363e5b75b9ULL,
+    0x0004df48aef149c9ULL, 0x0004deba511411e1ULL, 0x0004de2c13b31a5fULL, 0x0004dd9df6c3461dULL,
+    0x0004dce0ad3cc41bULL, 0x0004dbf4622bc54fULL, 0x0004dad94b319781ULL, 0x0004d98fa8664d2eULL,
+    0x0004d8a49f17fc36ULL, 0x0004d75c27692a30ULL, 0x0004d5e597ec345cULL, 0x0004d49e93e5cf34ULL,
+    0x0004d3b56870ae12ULL, 0x0004d26f8bf863e7ULL, 0x0004d1e418ed87b0ULL, 0x0004d070d55487edULL,
+    0x0004cfe5d58e46caULL, 0x0004cf2cb1445355ULL, 0x0004cea1fa8dec82ULL, 0x0004cd30abf45f0eULL,
+    0x0004cb6440f3521fULL, 0x0004ca7e8cb2b067ULL, 0x0004ca50a629cd83ULL, 0x0004c9c70729e0c3ULL,
+    0x0004c96b58fc5a93ULL, 0x0004c93d8709f6fdULL, 0x0004c8e1ed6c02c4ULL, 0x0004c7cf72ad1b51ULL,
+    0x0004c7a1bf8287aaULL, 0x0004c6bd72d64ce8ULL, 0x0004c68fd41fb693ULL, 0x0004c6070c66684fULL,
+    0x0004c4128ad82430ULL, 0x0004c38a518b199fULL, 0x0004c35cefde5c3fULL, 0x0004c30236a60767ULL,
+    0x0004c16a9c00f749ULL, 0x0004c0b5cb299af7ULL, 0x0004bfd411965d51ULL, 0x0004bf1fb965081aULL,
+    0x0004bd30da4a9a47ULL, 0x0004bd03f14447bdULL, 0x0004bc2395fb7335ULL, 0x0004ba908f573df9ULL,
+    0x0004b957d17f8789ULL, 0x0004b8fe945b6d60ULL, 0x0004b8d1fab98569ULL, 0x0004b878d1542d82ULL,
+    0x0004b6e8399ae57fULL, 0x0004b6bbc75c57b8ULL, 0x0004b662ecb0a4a4ULL, 0x0004b5ddbd3531cfULL,
+    0x0004b52c5648909dULL, 0x0004b44edefa525cULL, 0x0004b4229daec072ULL, 0x0004b18c4fb78b19ULL,
+    0x0004b1343816242eULL, 0x0004aea121b53205ULL, 0x0004ae754afebcfaULL, 0x0004ad9a497f75feULL,
+    0x0004ad6e86008c52ULL, 0x0004abe536499cb1ULL, 0x0004ab8df2516624ULL, 0x0004aa05dddb610dULL,
+    0x0004a983657e3970ULL, 0x0004a85366155beeULL, 0x0004a77aa0adf387ULL, 0x0004a74f4f74af29ULL,
+    0x0004a6f8b6746a33ULL, 0x0004a548760738f6ULL, 0x0004a2417d218a74ULL, 0x0004a1c0b5cccbdfULL,
+    0x0004a16aeb1bba9dULL, 0x0004a0ea5256885cULL, 0x00049fbeaf9a8f98ULL, 0x00049f692f385b71ULL,
+    0x00049dbe66503e07ULL, 0x00049ce975372833ULL, 0x00049bbfd7ad3160ULL, 0x000499ed57dfa5b3ULL,
+    0x0004996e5dbf5b92ULL, 0x000499441074678aULL, 0x000496caf50c1999ULL, 0x000495ce756347a9ULL,
+    0x000494fc5ddbe192ULL, 0x00049382f0c9a3b9ULL, 0x00049359101a9875ULL, 0x0004930557b73d73ULL,
+    0x000491e0b08286a1ULL, 0x000491637109cbcaULL, 0x00048f991811d0eeULL, 0x00048e232002d8d5ULL,
+    0x00048df9a174e836ULL, 0x00048d00e8172e3cULL, 0x00048c84b32f1b22ULL, 0x00048c31f3f4b3b3ULL,
+    0x00048b8c98c2295eULL, 0x00048b39fcc504c6ULL, 0x00048a94e7f67dd8ULL, 0x00048a1937181007ULL,
+    0x0004894b4ac2abd9ULL, 0x00048922243ffeddULL, 0x0004882b7a611e13ULL, 0x000486ba3fd3de68ULL,
+    0x000485ed84c78378ULL, 0x000484cf5ebc577bULL, 0x0004838904d0451eULL, 0x0004826c0d090055ULL,
+    0x0004821abb7a83b0ULL, 0x000481a0d69d8bedULL, 0x000481270b7d7098ULL, 0x000480fe78298529ULL,
+    0x00048084cf4de379ULL, 0x00048033c2533abdULL, 0x0004800b401c2046ULL, 0x00047dd54b9a0731ULL,
+    0x00047dacf3fbb837ULL, 0x00047b7951feb44eULL, 0x00047b00d29526a9ULL, 0x00047ad8adbc2311ULL,
+    0x00047a886c779802ULL, 0x00047a101f9e11dfULL, 0x000478f7ce6202e6ULL, 0x000478a7d05a43bbULL,
+    0x000477b81945294eULL, 0x000476a0ed1e2534ULL, 0x0004756285ee218bULL, 0x0004744c7d1173a7ULL,
+    0x000473fd25b1d3daULL, 0x000473863753ee43ULL, 0x000472e7cac0b9bdULL, 0x000472711637c2feULL,
+    0x0004722200f0132cULL, 0x000471ab759c40a5ULL, 0x0004713502f79e68ULL, 0x000470bea8fa7782ULL,
+    0x0004702101f57e91ULL, 0x00046fd23ed7d7eeULL, 0x00046f34d95ada6dULL, 0x00046ee636f6fa4dULL,
+    0x00046dd3544e8bafULL, 0x00046c99cf93547eULL, 0x00046bfd4e31a459ULL, 0x00046b880987dd54ULL,
+    0x00046b39e93ff3d9ULL, 0x00046a4fc915bfabULL, 0x000469b3e973ecc3ULL, 0x0004687cab05c4bbULL,
+    0x00046855cf469b66ULL, 0x00046793aca821b9ULL, 0x000466f88dd59819ULL, 0x000466ab0e6c7a9cULL,
+    0x00046636e348cfbaULL, 0x00046440920562f7ULL, 0x000463cce642d79dULL, 0x0004630c522f9ad3ULL,
+    0x00046272719f29b4ULL, 0x000462259125f5f7ULL, 0x000461b2542cd7ddULL, 0x000460cc212d8aebULL,
+    0x00045fc007a7900dULL, 0x00045d8336db1de4ULL, 0x00045d3703047309ULL, 0x00045c2c9f58aecfULL,
+    0x00045a8b03029a1dULL, 0x000459f374b0299cULL, 0x000459106c6d098fULL, 0x000458c4d3908be9ULL,
+    0x000458538184e131ULL, 0x000457bc8d578cc8ULL, 0x0004570015b3006cULL, 0x0004568f1fc5fa45ULL,
+    0x00045587e5dc245dULL, 0x000454cc2d690cacULL, 0x0004545baa04b39bULL, 0x000454362df6173bULL,
+    0x0004537ae7aec023ULL, 0x0004529a806e3a63ULL, 0x000451ba740bcf79ULL, 0x000450b582d2cec3ULL,
+    0x00045045d36a4e48ULL, 0x00044fd63a94a87fULL, 0x00044e87f7407bd1ULL, 0x00044dce9b0ae0a5ULL,
+    0x00044d5f819f2a80ULL, 0x00044ccb828fbf3bULL, 0x00044b7f15ed71d4ULL, 0x00044b3551ef2074ULL,
+    0x00044ac6be7ec8d2ULL, 0x00044aa1e7a01c6eULL, 0x00044a3371d4ef17ULL, 0x0004497b8980e55bULL,
+    0x00044956c8d40bfdULL, 0x0004489f2a59fd9fULL, 0x0004480c7164298bULL, 0x0004479e806d2249ULL,
+    0x00044730a5822a03ULL, 0x00044679bee6e63bULL, 0x0004465531b5e4b7ULL, 0x0004450ca8b8883bULL,
+    0x0004445678e86a46ULL, 0x00044432103b7679ULL, 0x00044357cf1ba8f0ULL, 0x0004430f221cbc20ULL,
+    0x000442a230c2a452ULL, 0x0004421110c86543ULL, 0x0004415bdf167d6eULL, 0x00044082bfb486efULL,
+    0x00043f85ddb759a8ULL, 0x00043ead797569acULL, 0x00043e656b2bbf37ULL, 0x00043dd56b3f7954ULL,
+    0x00043d21a0fdcc3dULL, 0x00043cb5ddce0c47ULL, 0x00043c4a300370fcULL, 0x00043ae3dc3e31deULL,
+    0x00043a9c4e4d3619ULL, 0x000439a227e85d9cULL, 0x00043884d293c299ULL, 0x0004378ba34ade26ULL,
+    0x000436d9ec6906ffULL, 0x0004364bea9c467cULL, 0x0004359a9ce600f4ULL, 0x000434c62626ad46ULL,
+    0x000434a2c52bb71fULL, 0x00043364c4d845f8ULL, 0x000432faee771e2aULL, 0x000432278027dc77ULL,
+    0x000431778e63c0c6ULL, 0x000430a4b84b8d1aULL, 0x000430819ca9dec7ULL, 0x0004303b6c4b1068ULL,
+    0x00043018578d7ce6ULL, 0x00042f460b476acaULL, 0x00042edd041194f8ULL, 0x00042e970ab33474ULL,
+    0x00042e0b336203b0ULL, 0x00042dc5556b9ec7ULL, 0x00042ac72450cd7dULL, 0x00042a81b359f1b6ULL,
+    0x00042a5efe424a4bULL, 0x00042a199ad96e14ULL, 0x000429f6ec87c870ULL, 0x00042949a6c29285ULL,
+    0x0004287a03bc5d9fULL, 0x000428125090b2fdULL, 0x000427aab19771d2ULL, 0x000426b937bbe4b1ULL,
+    0x000426744d9f373bULL, 0x0004260cff34b783ULL, 0x000425a5c4df3a7fULL, 0x0004253e9e98e5afULL,
+    0x000424b535650b2fULL, 0x0004244e3dd6081fULL, 0x000421e61356a2aeULL, 0x000420b30a55e04cULL,
+    0x0004206ee7a49166ULL, 0x00042008c412a0a7ULL, 0x00041fe6bc9abcccULL, 0x00041f1abdd08191ULL,
+    0x00041eb4dbf77030ULL, 0x00041e4f0dc976a5ULL, 0x00041de95340e374ULL, 0x00041da58c77ceffULL,
+    0x00041cb8994ec213ULL, 0x00041b4516cb5e7fULL, 0x00041a7ae0f3a43fULL, 0x00041a5934df8b94ULL,
+    0x0004192a893279f4ULL, 0x00041882ae0980dfULL, 0x0004181e111ccdabULL, 0x0004166af28a2dd3ULL,
+    0x000414da8ca6a36aULL, 0x00041497eec91f08ULL, 0x00041476a309bcd7ULL, 0x0004143411e8b49eULL,
+    0x00041412cc86a6bcULL, 0x000413d0481e73fbULL, 0x000412e7bb6190c3ULL, 0x000412a55d0e042bULL,
+    0x00041241df65cc81ULL, 0x000411de74b879f7ULL, 0x0004115a03f8f1e7ULL, 0x000410518763ac3fULL,
+    0x00040f8b820ddd12ULL, 0x00040f6a887e3f58ULL, 0x00040cb7f1b31672ULL, 0x00040c765c54332dULL,
+    0x00040c5594c13cc5ULL, 0x00040c140bd34a92ULL, 0x00040a8b840c90c9ULL, 0x00040a29908fa966ULL,
+    0x000409c7af9d5100ULL, 0x000409a7136a6a66ULL, 0x00040881f21ab04bULL, 0x00040840e4d462baULL,
+    0x0004075d76dd4c8fULL, 0x000406fc1d42bfc4ULL, 0x00040536c304ea5fULL, 0x00040414247506daULL,
+    0x000403328c47c934ULL, 0x000402d1fba4eff8ULL, 0x0004023132e7d6c9ULL, 0x00040170846f981aULL,
+    0x000401506e6438e2ULL, 0x000400f0384d3217ULL, 0x0004003002401b01ULL, 0x0003fe50b5f33d62ULL,
+    0x0003fdf10fb3e73cULL, 0x0003fdb1557a9521ULL, 0x0003fd51cd0a3d1eULL, 0x0003fcf25675cdceULL,
+    0x0003fc13dc72fecdULL, 0x0003fbd45dadedeaULL, 0x0003fbb4a14224b0ULL, 0x0003fa38660bb6faULL,
+    0x0003f9f92267da98ULL, 0x0003f99a4bae33a4ULL, 0x0003f93b869eb9abULL, 0x0003f7a1a703b42fULL,
+    0x0003f7045a23c6f1ULL, 0x0003f5e9b0d1aa03ULL, 0x0003f58b9b59c6eeULL, 0x0003f50e448a711fULL,
+    0x0003f4b057c5089bULL, 0x0003f4527c689b16ULL, 0x0003f27e38180db1ULL, 0x0003f23fe94f1082ULL,
+    0x0003f1852b0605e2ULL, 0x0003f0cab1ba15d3ULL, 0x0003f0aba435214aULL, 0x0003efb37ccf3604ULL,
+    0x0003ef9480780b31ULL, 0x0003ef3796e06ab8ULL, 0x0003eef9af552382ULL, 0x0003ee402652f175ULL,
+    0x0003ed2a58ddb86fULL, 0x0003ed0b8464c963ULL, 0x0003ecaf1251d53aULL, 0x0003ec717a61ff8aULL,
+    0x0003eae1d69738d1ULL, 0x0003ea29ceca7e76ULL, 0x0003e9cde4359fd9ULL, 0x0003e9164197ab50ULL,
+    0x0003e8d91a57fee6ULL, 0x0003e76acb866d86ULL, 0x0003e5fd88758fa5ULL, 0x0003e5474af9b71bULL,
+    0x0003e4ec452ef57dULL, 0x0003e4cdf19c7ef9ULL, 0x0003e41822e5b878ULL, 0x0003e270ecb6c158ULL,
+    0x0003e1f843d368e0ULL, 0x0003e1bbfa5bfad8ULL, 0x0003e16199dde51cULL, 0x0003e0ad0a29e58dULL,
+    0x0003e08ef8980ee7ULL, 0x0003df80ac59ddf5ULL, 0x0003df26b3a3ddb3ULL, 0x0003deeac19197a3ULL,
+    0x0003de90e40d7b80ULL, 0x0003de3716d49727ULL, 0x0003dd0c358b9536ULL, 0x0003dc1d9cb32e2eULL,
+    0x0003dbffd1b0022bULL, 0x0003dba67b6d1820ULL, 0x0003db4d3550ac58ULL, 0x0003da41c3b69ee3ULL,
+    0x0003d9ad6dd6c278ULL, 0x0003d95482ec9eb5ULL, 0x0003d936e2d9c547ULL, 0x0003d8fba80be74aULL,
+    0x0003d88547cb0013ULL, 0x0003d82c9244bfcdULL, 0x0003d7d3ecb97d10ULL, 0x0003d671f6041b85ULL,
+    0x0003d5868993e594ULL, 0x0003d52e5dfdef15ULL, 0x0003d4b8e72c75bdULL, 0x0003d4263a2dace0ULL,
+    0x0003d3ce4dd54562ULL, 0x0003d30163a78133ULL, 0x0003d1c00e529035ULL, 0x0003d14b6962acc6ULL,
+    0x0003d06272ed368bULL, 0x0003d00b3320e630ULL, 0x0003cfee2153c3c7ULL, 0x0003cf3fdadb516aULL,
+    0x0003cf05d131e283ULL, 0x0003cee8cef43baeULL, 0x0003cdaa2815834aULL, 0x0003cd367c1de0d8ULL,
+    0x0003cc329d929c26ULL, 0x0003ca493a3ac703ULL, 0x0003ca2c7ff68690ULL, 0x0003c9d65b5dbfafULL,
+    0x0003c8d44943edbaULL, 0x0003c89b028e90c0ULL, 0x0003c84525300fd6ULL, 0x0003c7ef5709687eULL,
+    0x0003c77d067b1766ULL, 0x0003c6ee47bc2176ULL, 0x0003c67c33da11d8ULL, 0x0003c57be96e2e77ULL,
+    0x0003c526997c316cULL, 0x0003c4edc1e54a93ULL, 0x0003c4d1589c8616ULL, 0x0003c4988b0f9dccULL,
+    0x0003c42704042d9bULL, 0x0003c3444605ca87ULL, 0x0003c327f5c56b5bULL, 0x0003c27e373118ceULL,
+    0x0003c1d4b466e926ULL, 0x0003c1800963c017ULL, 0x0003c08261b2c303ULL, 0x0003c04a15b72ce1ULL,
+    0x0003bff5b01c5bb2ULL, 0x0003bfa15955f046ULL, 0x0003bf4d11600257ULL, 0x0003bf30fcad778fULL,
+    0x0003bedcc8721f56ULL, 0x0003be348c4db9bbULL, 0x0003bda88741555aULL, 0x0003bc90f7c84d2fULL,
+    0x0003bbe98997204eULL, 0x0003baeed2161e74ULL, 0x0003bab72cf11168ULL, 0x0003ba63c1613c6bULL,
+    0x0003ba47f61930daULL, 0x0003b969d612a684ULL, 0x0003b94e1956f170ULL, 0x0003b8c381de3e22ULL,
+    0x0003b801be40d12eULL, 0x0003b7ca70439eb1ULL, 0x0003b62c73d0630dULL, 0x0003b610e740fd4aULL,
+    0x0003b5874066ed69ULL, 0x0003b4e246656174ULL, 0x0003b4c6ccf7ca9bULL, 0x0003b37d97c2d0cbULL,
+    0x0003b32b6e24cbe5ULL, 0x0003b2509a198018ULL, 0x0003b1e355fa5effULL, 0x0003b15ae44a24f4ULL,
+    0x0003b13f9f1339f0ULL, 0x0003b09c20ce2c13ULL, 0x0003af70f6af9980ULL, 0x0003af1f80705d40ULL,
+    0x0003af045c262911ULL, 0x0003ae2b7204dbf5ULL, 0x0003ad1cd9876717ULL, 0x0003ac95c789da4fULL,
+    0x0003ac7ac897a82cULL, 0x0003abd8ef6fac3fULL, 0x0003ab374df2ac01ULL, 0x0003aa4543d90036ULL,
+    0x0003a9bf0255149eULL, 0x0003a91e19988076ULL, 0x0003a8cdb9edaca9ULL, 0x0003a8b2f26fa0a3ULL,
+    0x0003a82d23ed3377ULL, 0x0003a812659c8f3bULL, 0x0003a7c233d4c3baULL, 0x0003a73caa0c5bbbULL,
+    0x0003a64cab96acb3ULL, 0x0003a63208b20338ULL, 0x0003a59257357d99ULL, 0x0003a54292eec13eULL,
+    0x0003a50d6cfc7475ULL, 0x0003a4bdbf69b46cULL, 0x0003a4a3333edba3ULL, 0x0003a36516f3cabbULL,
+    0x0003a1f307ca4e2fULL, 0x0003a1d8a43e7c42ULL, 0x0003a1a3e1a4ca0dULL, 0x0003a1898296a887ULL,
+    0x0003a105bdbe152dULL, 0x0003a0eb67a7e4acULL, 0x0003a018ecab5b1aULL, 0x00039f7b4efbd338ULL,
+    0x00039f1258ebf483ULL, 0x00039df22e98c9fcULL, 0x00039dd80515f7c7ULL, 0x00039d89916b925aULL,
+    0x00039d554bb1c736ULL, 0x00039d3b2b0ba5b3ULL, 0x00039cb89deba738ULL, 0x00039c6a5aec7dfdULL,
+    0x00039b65db2b3df4ULL, 0x00039ac9d4f1010eULL, 0x00039a47f801b051ULL, 0x000399e02e5d2654ULL,
+    0x00039944abab5fcdULL, 0x000398f6fdfd8e08ULL, 0x000398a95d6806dbULL, 0x0003985bc9e77addULL,
+    0x00039828197f5c74ULL, 0x0003973fc771d37aULL, 0x00039725fe750dacULL, 0x000396f270d237d5ULL,
+    0x00039657ea96a33fULL, 0x0003957082953396ULL, 0x00039556d38ed826ULL, 0x000394bcd79678e3ULL,
+    0x0003946fecfb6d65ULL, 0x0003943cad14a642ULL, 0x000394230f4779b0ULL, 0x0003935654636383ULL,
+    0x000392bd043aadb8ULL, 0x00039223e7650099ULL, 0x00039171867cf7eeULL, 0x0003913e9c27daa7ULL,
+    0x000390d8d882ee9aULL, 0x00038ff43327168eULL, 0x00038fc1734a8733ULL, 0x00038f29559306ccULL,
+    0x00038e781dacba37ULL, 0x00038e2c3f62acdaULL, 0x00038de06dbc713cULL, 0x00038dade8fc67a9ULL,
+    0x00038d48f04ecec2ULL, 0x00038cfd44811a48ULL, 0x00038ccad8f6d578ULL, 0x00038bcf131304d5ULL,
+    0x00038b3845a88a19ULL, 0x00038abac0bad5fbULL, 0x00038a0b40efc87aULL, 0x000389d928e6550fULL,
+    0x000389c01ef5510eULL, 0x000388f801371540ULL, 0x000388df03b6d256ULL, 0x000388492fac53baULL,
+    0x000386d3764b7710ULL, 0x000386a1b92dcba2ULL, 0x0003865727c70d8fULL, 0x0003852d5d379843ULL,
+    0x00038435ca66d41cULL, 0x0003830d672626a8ULL, 0x000382922207eccdULL, 0x0003822f9caa1bfcULL,
+    0x0003819bfd18aad2ULL, 0x000381211d2be6a5ULL, 0x0003808dd6706cc9ULL, 0x0003804445334567ULL,
+    0x00037fb146eb4452ULL, 0x00037f1e78d28ef2ULL, 0x00037ed523d089d9ULL, 0x00037e736fd1ec6dULL,
+    0x00037db047c878c4ULL, 0x00037d05ca8e9d46ULL, 0x00037cbccd5ddeaeULL, 0x00037c8c2b3338c7ULL,
+    0x00037c4341e1db52ULL, 0x00037a8ec3a6e95fULL, 0x0003799cfcf9103fULL, 0x000379244ad639fcULL,
+    0x000377baf89e1af4ULL, 0x0003772ac380b279ULL, 0x00037712bf346c72ULL, 0x000376e2ba825224ULL,
+    0x000376caba1c47d3ULL, 0x0003757b3cbbcedfULL, 0x000374ebc25f84daULL, 0x0003744499024ea9ULL,
+    0x000373fd08528cd9ULL, 0x000372f7037669faULL, 0x00037297e25f36beULL, 0x00037268598305d4ULL,
+    0x00037192b0f1b367ULL, 0x0003714b8fbd83fcULL, 0x000370a5c433de83ULL, 0x00036fd0f583df82ULL,
+    0x00036fa1b91ab932ULL, 0x00036f5ae7fed1b8ULL, 0x00036f434f7e20deULL, 0x00036efc8d9475ddULL,
+    0x00036d6c6ecd756eULL, 0x00036c992e146959ULL, 0x00036c81bb63a04aULL, 0x00036bc652fc60e9ULL,
+    0x00036b80207d4134ULL, 0x00036aadcc74a615ULL, 0x00036a967405d188ULL, 0x0003697eafe8c150ULL,
+    0x00036950209f0e37ULL, 0x00036938dad6a797ULL, 0x000368f310ee0ec9ULL, 0x000368679e8ead22ULL,
+    0x00036821f6128d08ULL, 0x00036796c6741a8bULL, 0x00036722eb5b552aULL, 0x000366c6523f0f58ULL,
+    0x00036680ec540028ULL, 0x000365c812949e25ULL, 0x0003653da2c1d56cULL, 0x000364e170ae286fULL,
+    0x0003646e4d929251ULL, 0x000363cd4fa5f502ULL, 0x000362029dce060dULL, 0x000361bdf9bd063fULL,
+    0x000361a71accf96fULL, 0x00036162853c5517ULL, 0x00036134d23a89a4ULL, 0x000360abd6262ed6ULL,
+    0x0003600c3c2c5a20ULL, 0x00035fdead4910ceULL, 0x00035fc7e7a494efULL, 0x00035f9a5ff5753dULL,
+    0x00035f839deaa0d4ULL, 0x00035f561d6df57cULL, 0x00035efb2ad5ed97ULL, 0x00035eb701761159ULL,
+    0x00035e457f15e821ULL, 0x00035e0172649f27ULL, 0x00035dbd707022b6ULL, 0x00035da6c7810b95ULL,
+    0x00035d62d3d9ac46ULL, 0x00035d1eeae92d29ULL, 0x00035cdb0cad05b6ULL, 0x00035c5370479fb2ULL,
+    0x00035c0fb219540eULL, 0x00035b0123ed6335ULL, 0x00035a909ae6f6f2ULL, 0x00035a7a1ca296b8ULL,
+    0x00035a09b6f82853ULL, 0x000359c654e486eaULL, 0x0003593fb0785760ULL, 0x000358fc6e1ace95ULL,
+    0x000358b9364a54a1ULL, 0x0003581c87b365b2ULL, 0x000357d972fc8a0fULL, 0x0003579668c80191ULL,
+    0x000355531c73425dULL, 0x000354751e874dbeULL, 0x000354329c116cb8ULL, 0x000353c3d9af64a9ULL,
+    0x000353adb64357d6ULL, 0x0003533f1667f019ULL, 0x000352e6ab340d3eULL, 0x000352783f0458ebULL,
+    0x000351f3e30031cdULL, 0x0003516fb0287081ULL, 0x00035159abae8f1aULL, 0x00035117a5198ffbULL,
+    0x000350eba669e1c4ULL, 0x00035051cee3a393ULL, 0x00034fa2415e2546ULL, 0x00034f4a95d7cabbULL,
+    0x00034ec73689eaaeULL, 0x00034e859628b02fULL, 0x00034d954bb30c8dULL, 0x00034d7f7a3d5529ULL,
+    0x00034d1273d2256bULL, 0x00034cbb4fb8d979ULL, 0x00034c7a00702834ULL, 0x00034b8adeb39ba7ULL,
+    0x00034b75282aef4eULL, 0x00034a8699fcfde0ULL, 0x00034a45a1e5b467ULL, 0x000349ef115b2ca4ULL,
+    0x00034982f5b06a37ULL, 0x000349015f8392ebULL, 0x0003487ff139c042ULL, 0x0003486a62b78f0cULL,
+    0x000347feaac08aa1ULL, 0x000347be166c6d6dULL, 0x0003473d0b89b9d9ULL, 0x000347278d94435aULL,
+    0x000346fc94f690a2ULL, 0x000346665170a45dULL, 0x000345fb1d9349deULL, 0x000345e5b0178662ULL,
+    0x000345a56e36ef4bULL, 0x000344e4e3a9d3feULL, 0x000344ba2639c913ULL, 0x0003443a0816f7b8ULL,
+    0x000343e4b4742b84ULL, 0x00034324f7e1ed03ULL, 0x000342a555ac468eULL, 0x0003426593317d24ULL,
+    0x00034225da73bfccULL, 0x000341fb64b2839bULL, 0x000341bbbc2ae5d4ULL, 0x0003417c1d5a62f8ULL,
+    0x000340e7d084c8f4ULL, 0x000340bd7b1d4368ULL, 0x000340a8520694d4ULL, 0x0003402972106e51ULL,
+    0x00033faab8be8e75ULL, 0x00033f80838bd4cfULL, 0x00033f413bc787f5ULL, 0x00033e839e37c8f3ULL,
+    0x00033dc65715b6d7ULL, 0x00033d4857908b7eULL, 0x00033d335b5d49a0ULL, 0x00033c8b9ff78111ULL,
+    0x00033c0dffec97acULL, 0x00033bba550d1f69ULL, 0x00033afe5259df37ULL, 0x00033a9603f5dc00ULL,
+    0x000339874cb9c62eULL, 0x0003395db66ce372ULL, 0x0003391f5cd42c44ULL, 0x000338cc49590ab5ULL,
+    0x0003388e05b64bdeULL, 0x0003384fcb796a58ULL, 0x0003382654885e77ULL, 0x000338119aa0459cULL,
+    0x000337aa08b8e6f3ULL, 0x000336db32f057caULL, 0x000336b1e171f8beULL, 0x00033673eefb91eaULL,
+    0x0003362164df3ee9ULL, 0x000335f826073302ULL, 0x0003352a29d337c5ULL, 0x000334c3526b6125ULL,
+    0x000334aec40776a6ULL, 0x00033351ecac1340ULL, 0x0003333d70c49c0eULL, 0x000333147c082618ULL,
+    0x0003321f15825735ULL, 0x0003320aa8ef8f8fULL, 0x0003319032e5ea2bULL, 0x00033115e18100efULL,
+    0x000330b00ef43946ULL, 0x000330730333a376ULL, 0x0003305eabfa919eULL, 0x00032fe4b5e9aa5fULL,
+    0x00032eb46df18146ULL, 0x00032e77adfa0282ULL, 0x00032dfe4934ec89ULL, 0x00032d5ca5c29d98ULL,
+    0x00032ce395474f12ULL, 0x00032ccf6b5e522dULL, 0x00032bf1e04ee520ULL, 0x00032b3cf6d3d889ULL,
+    0x00032ac487efab7aULL, 0x00032a3833ba068dULL, 0x000329d4154db03fULL, 0x000329c012301068ULL,
+    0x00032948144075c1ULL, 0x000328d039db6523ULL, 0x000328a84e478ad3ULL, 0x0003289459f7e1b2ULL,
+    0x0003286c744cba2bULL, 0x00032830a32d51f2ULL, 0x000327b91b78debcULL, 0x000327a532f55d5aULL,
+    0x000327061226b0f4ULL, 0x0003265358215e02ULL, 0x0003263f813c83eeULL, 0x000324b383fc058cULL,
+    0x000324647ffe6dcdULL, 0x000323c6a687863cULL, 0x0003238b84f28668ULL, 0x0003233cbb08781cULL,
+    0x000322da545b7cb9ULL, 0x000322c6a91d75b4ULL, 0x0003229f55856835ULL, 0x000321ee8cfd32a5ULL,
+    0x000321a013f65c7fULL, 0x0003213e1244003eULL, 0x000320efbbc192d0ULL, 0x0003207a56b28007ULL,
+    0x000320533ca82efdULL, 0x00031fa376b56342ULL, 0x00031f8ff3b3b930ULL, 0x00031ee08374b1a1ULL,
+    0x00031e7f2d757783ULL, 0x00031e6bb8b4998dULL, 0x00031e44d20ae3b4ULL, 0x00031e316021e858ULL,
+    0x00031e0a7f275826ULL, 0x00031dbcc88de1fbULL, 0x00031cad407d423dULL, 0x00031c99e26a10e5ULL,
+    0x00031c5fcdd67728ULL, 0x00031b8b201b9472ULL, 0x00031b174e49e278ULL, 0x00031add72058e10ULL,
+    0x00031a5690cb0b80ULL, 0x000319a9694665b3ULL, 0x00031982f8f719c0ULL, 0x00031949577ad978ULL,
+    0x000318fc8d2ed6d2ULL, 0x000318c2ff36b67dULL, 0x000318897998bfa6ULL, 0x00031829ad71580eULL,
+    0x000317dd1ac9a9ccULL, 0x000317b6d702b1a8ULL, 0x000317a3b6823142ULL, 0x000316f7bb8b1f2cULL,
+    0x0003169850642cecULL, 0x0003165f1b25b643ULL, 0x000315a0a567c6a5ULL, 0x000314cf8dccb388ULL,
+    0x00031483a0a905b7ULL, 0x0003144ab8652276ULL, 0x0003132eaa1b2b7eULL, 0x00031308d9cc7b05ULL,
+    0x000312f5f301dc7aULL, 0x000312d02825bf0cULL, 0x000312264428d554ULL, 0x000311edb3211638ULL,
+    0x000310d357e97c6fULL, 0x000310c08c3e6910ULL, 0x0003109af79b87a7ULL, 0x0003104fd9210aedULL,
+    0x000310178bb501ffULL, 0x00030ff2073fbeedULL, 0x00030fb9c74ab4beULL, 0x00030f495f94870eULL,
+    0x00030ec664a44decULL, 0x00030d890271d6b6ULL, 0x00030d069d3d56e3ULL, 0x00030ccec8533569ULL,
+    0x00030ca994262a7aULL, 0x00030c96fb63f7c1ULL, 0x00030c5f366de810ULL, 0x00030c3a0ce1ad5aULL,
+    0x00030bb81751b972ULL, 0x00030b92fdae2f08ULL, 0x00030b80722f50b9ULL, 0x00030b48d4fd8ff6ULL,
+    0x00030a45b58a68abULL, 0x00030a3339e33d7fULL, 0x00030a0e453700fcULL, 0x000309d6dcc8f6c7ULL,
+    0x0003098d087bace6ULL, 0x00030930d2ce2e2dULL, 0x0003091e644b461dULL, 0x000308c248d84858ULL,
+    0x000308afdf93285aULL, 0x00030853de4f7c46ULL, 0x000308417a45e855ULL, 0x0003081cb4cfd00fULL,
+    0x000307095abde760ULL, 0x000306f706599c2cULL, 0x000306891e323a80ULL, 0x0003061b5533101fULL,
+    0x000305bff021d053ULL, 0x0003051ba3bff7b1ULL, 0x000304ae423cb829ULL, 0x0003042ecce62322ULL,
+    0x000303d3dbf63f9eULL, 0x000303c1ae583ff7ULL, 0x00030354ae9d0797ULL, 0x0003031e3a4a56f4ULL,
+    0x000302c3897f37c8ULL, 0x0003028d29a84fabULL, 0x0003020e67d8fd55ULL, 0x000301a1e2e632fdULL,
+    0x0003017dbd60f318ULL, 0x000300ff54c7261fULL, 0x000300db3e84d3e0ULL, 0x00030039043b5066ULL,
+    0x0003002701fb19c0ULL, 0x0002ffcd0362c670ULL, 0x0002ff8513afd8d6ULL, 0x0002ff6120e430c1ULL,
+    0x0002ff1945662048ULL, 0x0002febf85f3036dULL, 0x0002fe53ef1d6e8fULL, 0x0002fdb2c56e124bULL,
+    0x0002fd11df79e37dULL, 0x0002fcca7286f902ULL, 0x0002fc94e990ad69ULL, 0x0002fbf47b9c72f0ULL,
+    0x0002fb661976b5d5ULL, 0x0002fae9af181bd8ULL, 0x0002fab46958c33cULL, 0x0002fa7f2b097b7aULL,
+    0x0002fa267e5db5dfULL, 0x0002f9aa7c0de668ULL, 0x0002f98715171cb6ULL, 0x0002f95200d02c6cULL,
+    0x0002f940510818a0ULL, 0x0002f8d6439718d5ULL, 0x0002f86c53ae8bc5ULL, 0x0002f8490a445480ULL,
+    0x0002f8142248887bULL, 0x0002f7df41a933adULL, 0x0002f7759679cb5dULL, 0x0002f763fccd4833ULL,
+    0x0002f6d74cc1d516ULL, 0x0002f6c5ba6aa205ULL, 0x0002f65c5d73e9d4ULL, 0x0002f627b9f0e439ULL,
+    0x0002f604a6534d2eULL, 0x0002f589fb36eadbULL, 0x0002f55574e38f89ULL, 0x0002f53274b7b509ULL,
+    0x0002f520f5d853d3ULL, 0x0002f4b80d942d7eULL, 0x0002f41ae7a51623ULL, 0x0002f3f8048593c6ULL,
+    0x0002f2be990ddab5ULL, 0x0002f22244b2a326ULL, 0x0002f1ba306b47f0ULL, 0x0002f15238da668eULL,
+    0x0002f140e7b6b747ULL, 0x0002f11e47d2ad45ULL, 0x0002f10cf9123671ULL, 0x0002f0ea5df41eedULL,
+    0x0002f0a53141bf9eULL, 0x0002f03d8608264aULL, 0x0002f01afdf7fd56ULL, 0x0002eee4c3d5e1a3ULL,
+    0x0002eeb1285acffeULL, 0x0002ee168070ce62ULL, 0x0002ee055545b538ULL, 0x0002ed9e62c20fceULL,
+    0x0002ed48ae3dcec4ULL, 0x0002ed154b55f73eULL, 0x0002ecae9aa8698eULL, 0x0002ebe18dad4f75ULL,
+    0x0002eb9d4cf7babbULL, 0x0002eb6a249be0efULL, 0x0002eb37033fdc3eULL, 0x0002eaaecc77a1a9ULL,
+    0x0002ea48c3f44b33ULL, 0x0002ea37c53f0be0ULL, 0x0002e99ef3adac8fULL, 0x0002e94a288201d7ULL,
+    0x0002e8a0cbf90bdfULL, 0x0002e84c3a8e9f4bULL, 0x0002e83b52fa9549ULL, 0x0002e808a0d99d86ULL,
+    0x0002e770b3ded484ULL, 0x0002e74ef96909c3ULL, 0x0002e73e1d53e974ULL, 0x0002e5ed8c017e8eULL,
+    0x0002e5bb2a176200ULL, 0x0002e5aa604e95adULL, 0x0002e5242d5f12f7ULL, 0x0002e5136a6b38c1ULL,
+    0x0002e4f1e6c9accfULL, 0x0002e4aee89dc661ULL, 0x0002e41858fd0d73ULL, 0x0002e3c4ce4c8e17ULL,
+    0x0002e360a72779caULL, 0x0002e32e9dbf98c6ULL, 0x0002e31df1738b1dULL, 0x0002e2ca9f3e489eULL,
+    0x0002e288049908c7ULL, 0x0002e266bbc7141cULL, 0x0002e234d42bd70bULL, 0x0002e1d1192f4029ULL,
+    0x0002e1c07ca3c50eULL, 0x0002e16d7921686eULL, 0x0002e0d83b74728cULL, 0x0002e095fa89a346ULL,
+    0x0002e06451aaa01eULL, 0x0002e0433a236efcULL, 0x0002df9df1123d71ULL, 0x0002df7ceb5c8da1ULL,
+    0x0002df4b685abeb6ULL, 0x0002de22e214520bULL, 0x0002ddf18d9ccc67ULL, 0x0002dde11d98bb24ULL,
+    0x0002dd8ef88e779cULL, 0x0002dd5db7f4fd1fULL, 0x0002dc98f7a09473ULL, 0x0002dc67d809356eULL,
+    0x0002dbf55297df90ULL, 0x0002db729cc47a75ULL, 0x0002db41a49d81efULL, 0x0002daaee37805ccULL,
+    0x0002da9e98c144a3ULL, 0x0002da4d2e1414a3ULL, 0x0002d9aa8f1d39edULL, 0x0002d9595ac77421ULL,
+    0x0002d918711ec2ccULL, 0x0002d8e7c974e7d4ULL, 0x0002d8c75d49bd14ULL, 0x0002d896c0712168ULL,
+    0x0002d8868d99d711ULL, 0x0002d8359a32119fULL, 0x0002d8256bac5093ULL, 0x0002d7c463a1f6d3ULL,
+    0x0002d7a4115d6e5aULL, 0x0002d793e94ebf05ULL, 0x0002d7739b584cfdULL, 0x0002d7330805c51fULL,
+    0x0002d6e25ffc1888ULL, 0x0002d6b203bf7708ULL, 0x0002d6515e91a635ULL, 0x0002d5c096f64f66ULL,
+    0x0002d5502397bebfULL, 0x0002d4efdc6cfabeULL, 0x0002d46fa544c45dULL, 0x0002d42f9ab1172cULL,
+    0x0002d3ff9a300e51ULL, 0x0002d37fb7eec72dULL, 0x0002d33fd7bdb23dULL, 0x0002d31febdfbc8fULL,
+    0x0002d30ff6ff3d1cULL, 0x0002d2e01c971d21ULL, 0x0002d250b3582987ULL, 0x0002d191d4c60d8aULL,
+    0x0002d102effe104dULL, 0x0002d0b3a5c7c2dbULL, 0x0002d05496eef970ULL, 0x0002d044c1903a34ULL,
+    0x0002d02518e93883ULL, 0x0002cfb660880016ULL, 0x0002cf675f61939cULL, 0x0002cf38009d5440ULL,
+    0x0002cf08a815ae0aULL, 0x0002ced955c965c1ULL, 0x0002ce4b843c7503ULL, 0x0002cded179b7ad5ULL,
+    0x0002cddd5d3fce39ULL, 0x0002cd017481c187ULL, 0x0002cc745cd623f7ULL, 0x0002cc06c62067d6ULL,
+    0x0002cb89b09fd7d2ULL, 0x0002cb2bfd29a752ULL, 0x0002cabecac9f5c5ULL, 0x0002ca03e6817459ULL,
+    0x0002c9a698ff2958ULL, 0x0002c8fbca2b5d60ULL, 0x0002c8cd42db98acULL, 0x0002c8bdc1c51ea2ULL,
+    0x0002c870467199f7ULL, 0x0002c832564ec9a1ULL, 0x0002c813624714dfULL, 0x0002c803e9458009ULL,
+    0x0002c7e4f946a959ULL, 0x0002c778c673881aULL, 0x0002c71c22c3fc23ULL, 0x0002c6edd9f79a8cULL,
+    0x0002c6cf021d6faeULL, 0x0002c6a0c35a71b3ULL, 0x0002c634f2f6952eULL, 0x0002c6162b252cd3ULL,
+    0x0002c606c83c95a4ULL, 0x0002c5e8046b69c7ULL, 0x0002c5019ca9f02eULL, 0x0002c4d399daf1e8ULL,
+    0x0002c4c444e9a543ULL, 0x0002c4964a103d69ULL, 0x0002c449b53ba028ULL, 0x0002c43a6640c67fULL,
+    0x0002c35514dce96eULL, 0x0002c2ad4889976dULL, 0x0002c29e0b5d46b2ULL, 0x0002c27f92fd50d1ULL,
+    0x0002c251e35a69c5ULL, 0x0002c215025c07f9ULL, 0x0002c1e7607fe04aULL, 0x0002c1b9c48946eeULL,
+    0x0002c140416db611ULL, 0x0002c0e53a8b49cbULL, 0x0002c08a4b25400fULL, 0x0002c05cdc3e092dULL,
+    0x0002c020517bbd6dULL, 0x0002c00210018c01ULL, 0x0002bff2f03e0ad9ULL, 0x0002bf3da5b673d3ULL,
+    0x0002bee323726264ULL, 0x0002bec4fd338129ULL, 0x0002be97c8ae5c9bULL, 0x0002be5b8bb29f52ULL,
+    0x0002be2e64bcb3dfULL, 0x0002be0143949526ULL, 0x0002bdb619347473ULL, 0x0002bda712a94488ULL,
+    0x0002bd7a02e3d6afULL, 0x0002bd1ff4b3dc2eULL, 0x0002bc4e2d6a29ddULL, 0x0002bbe578d167b0ULL,
+    0x0002bbb8a2b74796ULL, 0x0002bb9ac1d6bae0ULL, 0x0002bb412e8272deULL, 0x0002bb0583b222f6ULL,
+    0x0002bad8ca442ecaULL, 0x0002ba7f689160d4ULL, 0x0002ba61a26a3eaeULL, 0x0002ba34fdf19e0cULL,
+    0x0002b9cce9b17c13ULL, 0x0002b9a05839a728ULL, 0x0002b947465c1e2cULL, 0x0002b8fd1e2c0d0fULL,
+    0x0002b8d0a73a9322ULL, 0x0002b8a435f517fdULL, 0x0002b868fd13e738ULL, 0x0002b83c99063192ULL,
+    0x0002b8103aa0ddf0ULL, 0x0002b7f2a981705cULL, 0x0002b7e3e1e2d77dULL, 0x0002b7c65487ae61ULL,
+    0x0002b78b41586032ULL, 0x0002b732b75e2a89ULL, 0x0002b715390ce2edULL, 0x0002b6ae12a27f63ULL,
+    0x0002b629a07b09a0ULL, 0x0002b5e0218ab59fULL, 0x0002b5d1706be6a2ULL, 0x0002b55bfdd77ab1ULL,
+    0x0002b52ffd1f7d03ULL, 0x0002b49d785d4193ULL, 0x0002b4718fcfd1d9ULL, 0x0002b4286dec8bb5ULL,
+    0x0002b3edf788507eULL, 0x0002b3d0c00a224eULL, 0x0002b2f5ee648faeULL, 0x0002b1f00faa435bULL,
+    0x0002b198f182b854ULL, 0x0002b15ee9a04c68ULL, 0x0002b0bf86422584ULL, 0x0002b068b4ed04ccULL,
+    0x0002b05a3ed4dcc8ULL, 0x0002b02ee031655dULL, 0x0002afd8334d8813ULL, 0x0002af64c40e797bULL,
+    0x0002af398453582dULL, 0x0002af0e4a09142eULL, 0x0002aeffe27b0144ULL, 0x0002ae7e59a543d8ULL,
+    0x0002ae6197342594ULL, 0x0002ada6e2013c0aULL, 0x0002ad8a319a8dd2ULL, 0x0002ad50d8006b14ULL,
+    0x0002accff174554fULL, 0x0002ac8869df391fULL, 0x0002ac4f3b5c7b81ULL, 0x0002ac07cea6cfcfULL,
+    0x0002abdcfafb15ccULL, 0x0002ab7921ecea3cULL, 0x0002ab5ca01f0814ULL, 0x0002aace3abdb9e1ULL,
+    0x0002aa31dc80f3d4ULL, 0x0002a9b221b909dfULL, 0x0002a95d151856c0ULL, 0x0002a9246dcbc342ULL,
+    0x0002a85e6e5b411aULL, 0x0002a809b66382dbULL, 0x0002a7df62509092ULL, 0x0002a7b51382417cULL,
+    0x0002a77cb29f5bc4ULL, 0x0002a75270180c5bULL, 0x0002a6fdfacc89f6ULL, 0x0002a6554f268e47ULL,
+    0x0002a5e50b3e678aULL, 0x0002a582ee4a7ee3ULL, 0x0002a566eb3bfb53ULL, 0x0002a504f2c4423dULL,
+    0x0002a4b10fc45c25ULL, 0x0002a487260f9675ULL, 0x0002a44156c01db7ULL, 0x0002a3eda42fa664ULL,
+    0x0002a362533f889eULL, 0x0002a33892f6783cULL, 0x0002a31cc04e7497ULL, 0x0002a2e521ded1d0ULL,
+    0x0002a2681edf3429ULL, 0x0002a214e1419235ULL, 0x0002a1982b554209ULL, 0x0002a152f6a3e9c4ULL,
+    0x0002a1452102109fULL, 0x0002a1297772e8a7ULL, 0x0002a09f49b8d565ULL, 0x0002a05a481f6f38ULL,
+    0x00029ff9c40ece5cULL, 0x00029fde35b30c9eULL, 0x00029fb4e465f619ULL, 0x00029fa71fc2ac1dULL,
+    0x00029f625108b7d3ULL, 0x00029ebd6727c300ULL, 0x00029e41ecdffa6fULL, 0x00029e34376d7985ULL,
+    0x00029e18ce371235ULL, 0x00029d8fe1c2305dULL, 0x00029d22800e603dULL, 0x00029cc2e7ddcb67ULL,
+    0x00029c7eb072686eULL, 0x00029c1f4706d735ULL, 0x00029bf66b532deaULL, 0x00029bdb30f7591eULL,
+    0x00029bb25d96d642ULL, 0x00029b2a6baf7ed5ULL, 0x00029b01ade81516ULL, 0x00029abdd1fea300ULL,
+    0x00029a9521793b25ULL, 0x00029a8792674545ULL, 0x00029a36438f7cbdULL, 0x00029a0da3937f7fULL,
+    0x00029942cde256abULL, 0x000298ff4cc3304fULL, 0x000298c955b9be68ULL, 0x000298a0e231c0fbULL,
+    0x00029885ed3dc82bULL, 0x0002985d81e930daULL, 0x00029827a51dd32fULL, 0x0002971ad7f12fdeULL,
+    0x0002970d6cfe97fbULL, 0x000296f298ba5f83ULL, 0x000296e52f68ae0eULL, 0x00029694c2e24942ULL,
+    0x0002961c44a8f66eULL, 0x0002960183e4e348ULL, 0x000295d966cc4342ULL, 0x000295a3f23ab279ULL,
+    0x000295612ca80cacULL, 0x0002953922faecccULL, 0x000294c12304102cULL, 0x000294494e938548ULL,
+    0x0002943c00c401d0ULL, 0x000293ec3927b983ULL, 0x00029381f7a5c09fULL, 0x0002934ce3b892b7ULL,
+    0x000293251a61a929ULL, 0x0002930a96d28e60ULL, 0x000292e2d57b82cfULL, 0x000292bb18f0073cULL,
+    0x000292addb278253ULL, 0x000291564f422622ULL, 0x000290fa0e2cc52aULL, 0x000290dfb7313411ULL,
+    0x0002905c23ef4b67ULL, 0x00028ff30741ab43ULL, 0x00028fe5e609e87bULL, 0x00028fcba52e0023ULL,
+    0x00028fa447d4b38eULL, 0x00028f559b4dce94ULL, 0x00028f4880628c67ULL, 0x00028f2132c5aba6ULL,
+    0x00028ed2a5af2057ULL, 0x00028e842b6c8cd1ULL, 0x00028e5cf558a28dULL, 0x00028e42d3e770f5ULL,
+    0x00028de76f483fc7ULL, 0x00028da6370934b6ULL, 0x00028d7f1b880fdfULL, 0x00028d5804b49a48ULL,
+    0x00028cfce19ed024ULL, 0x00028cbbd81ed5ffULL, 0x00028c60e092d94eULL, 0x00028bf909430aacULL,
+    0x00028bc529ffa96fULL, 0x00028b9e47f77d26ULL, 0x00028b5091d079a4ULL, 0x00028b36ae8c721dULL,
+    0x00028b02ee306079ULL, 0x00028a74c7934cacULL, 0x00028a4e0da24eedULL, 0x00028a412602f4efULL,
+    0x000289cd1870dfd8ULL, 0x0002893f78f38c17ULL, 0x00028918e3cd5432ULL, 0x0002890c08701c0cULL,
+    0x0002889869107044ULL, 0x00028871e7c22de3ULL, 0x0002880b4ff28d43ULL, 0x000287b1a5ba7b98ULL,
+    0x00028771a90b0e09ULL, 0x0002874b4ab2fd57ULL, 0x000286fe9ba5c445ULL, 0x000286f1d59267d4ULL,
+    0x000286cb865ee22fULL, 0x000286b1fec1b464ULL, 0x0002867ef592adccULL, 0x0002860c3e576674ULL,
+    0x000285bfdacb3224ULL, 0x0002855a1cd02bf5ULL, 0x0002854d6751d5a3ULL, 0x00028533fdd58751ULL,
+    0x000284db1c633946ULL, 0x000284c1bbe6619dULL, 0x0002848f00ea27f3ULL, 0x00028442f765ef1cULL,
+    0x000283f6ffd034abULL, 0x000283396323b754ULL, 0x000282d47068adf8ULL, 0x000282a202ec1097ULL,
+    0x00028288cf252b07ULL, 0x0002827c35ff7879ULL, 0x000282566d850870ULL, 0x000281cc09c0fdd5ULL,
+    0x00028180a6a3eb49ULL, 0x0002814e6e66927dULL, 0x0002810fb3276e36ULL, 0x000280ea157ed9d4ULL,
+    0x000280c47c4019a7ULL, 0x0002809ee76a66e4ULL, 0x0002804747ef8229ULL, 0x00028021c1c7b808ULL,
+    0x00027fb149af6ee9ULL, 0x00027f72df25c02bULL, 0x00027f2808f8f7e0ULL, 0x00027f1b91a5715dULL,
+    0x00027edd444e6a50ULL, 0x00027ed0cfe554a8ULL, 0x00027eb7e8880e1cULL, 0x00027e1637f20eb3ULL,
+    0x00027dfd5f1ec5adULL, 0x00027db2e03fd507ULL, 0x00027d813fff609fULL, 0x00027d6872c4866aULL,
+    0x00027cf8ef1910ffULL, 0x00027cc76bc3f3c1ULL, 0x00027c89926b9929ULL, 0x00027c330fe92aeaULL,
+    0x00027bd04e63deaaULL, 0x00027bab4db8f0efULL, 0x00027b86515c540eULL, 0x00027b5507924268ULL,
+    0x00027b177614dfb3ULL, 0x00027af28aea0448ULL, 0x00027ac158084a76ULL, 0x00027a9c76df96f4ULL,
+    0x00027a52c167e774ULL, 0x00027a1561ec975cULL, 0x0002799ac68feb1dULL, 0x0002795d8aa7ad59ULL,
+    0x0002792c9672cc2fULL, 0x000279141f2eb9b9ULL, 0x000278cac4b95984ULL, 0x0002782c1052433bULL,
+    0x000277be5f914280ULL, 0x000277a604918964ULL, 0x0002775cfed5950bULL, 0x000276ef95de52daULL,
+    0x000276cb25f8a08cULL, 0x00027615358ac361ULL, 0x000275f0ded905d5ULL, 0x000275c071c6048eULL,
+    0x0002759c24da4fb8ULL, 0x000275172e95b076ULL, 0x000274cebfea81eeULL, 0x000274c2af17bed6ULL,
+    0x000274aa8ed5c857ULL, 0x0002748661eb578dULL, 0x00027462392a7787ULL, 0x000274562c818293ULL,
+    0x00027419f4228a7dULL, 0x0002740dea3eec9cULL, 0x000273f5d7da0e3dULL, 0x000273d1bfb84448ULL,
+    0x000273adabbc756bULL, 0x000273a1a5ff0fbcULL, 0x0002737d978a1d9fULL, 0x000272f985f220c6ULL,
+    0x0002728da0dfa34dULL, 0x00027269b2198f14ULL, 0x000271fdfe7da53cULL, 0x000271b645fbe4ffULL,
+    0x000271867ec603fdULL, 0x0002713ee1a1f328ULL, 0x0002711b1935bac5ULL, 0x000270df7eefd6a8ULL,
+    0x00027098080172daULL, 0x0002708c2070873fULL, 0x0002702cf43cd721ULL, 0x0002702110c07332ULL,
+    0x00026fe5a61cebe7ULL, 0x00026fd9c557b82fULL, 0x00026f9e6845ce93ULL, 0x00026f33a9ff72ceULL,
+    0x00026f101d5bb262ULL, 0x00026e99bb297cb0ULL, 0x00026e821352057dULL, 0x00026e764012d814ULL,
+    0x00026e52c90739f4ULL, 0x00026dd0e1be04f3ULL, 0x00026dad7d8764f5ULL, 0x00026d8a1d57e33eULL,
+    0x00026d2014ed34b4ULL, 0x00026cfcc4d34dd2ULL, 0x00026caa6edce951ULL, 0x00026c63ed68715eULL,
+    0x00026c06045ef2dbULL, 0x00026bfa493d7b32ULL, 0x00026bd71a82c437ULL, 0x00026bb3efc60ddcULL,
+    0x00026b9c802a5b32ULL, 0x00026b4a877d2438ULL, 0x00026b0455e0c5faULL, 0x00026aecf38b1525ULL,
+    0x00026ae14309d49eULL, 0x00026a782259dc28ULL, 0x00026a1acded921fULL, 0x0002694936d405c3ULL,
+    0x00026903795e01f0ULL, 0x000268e0a08b75c8ULL, 0x0002688f60976e36ULL, 0x000267ed20d40680ULL,
+    0x000267e18d415c3cULL, 0x0002679c20f3c773ULL, 0x0002677970ab2615ULL, 0x000267341bd2e752ULL,
+    0x000267117741f7f2ULL, 0x000266fa610c26ecULL, 0x000266eed6979cd6ULL, 0x000266929288eea4ULL,
+    0x000265e5dd78d44dULL, 0x000265b7dfb5fb72ULL, 0x0002652e0fbcc8a3ULL, 0x0002650ba569a372ULL,
+    0x0002645fcbac5078ULL, 0x00026426987ef561ULL, 0x0002641b2924875aULL, 0x000263b4522ce55aULL,
+    0x0002639d7c6e2931ULL, 0x0002637b3f023619ULL, 0x00026336cfa94d49ULL, 0x00026309389a9fadULL,
+    0x0002628bfc3c7b15ULL, 0x000262809c33e7f7ULL, 0x0002625e7ea5174bULL, 0x000261e18831a834ULL,
+    0x0002617b7038fd7aULL, 0x000261701a55e823ULL, 0x00026137733907c7ULL, 0x0002612c1fdd32daULL,
+    0x000260f385627740ULL, 0x00026049f4fde95eULL, 0x0002603eaa74cfc8ULL, 0x00025fa0c2ed7288ULL,
+    0x00025f7ef768333eULL, 0x00025f302b233c10ULL, 0x00025ed63621afb8ULL, 0x00025eb4811ff2abULL,
+    0x00025e4440cb135cULL, 0x00025dea919e0d7aULL, 0x00025ddf5d95ff89ULL, 0x00025dbdc3fa0c2eULL,
+    0x00025da75fa40735ULL, 0x00025cf4787b402eULL, 0x00025cde23045422ULL, 0x00025cd2f8e72a42ULL,
+    0x00025cbca5e95194ULL, 0x00025c9b2c8368a9ULL, 0x00025c9004dee90aULL, 0x00025c4d1fa7c63dULL,
+    0x00025c36d68a20b1ULL, 0x00025c156bf277f5ULL, 0x00025bf4050cd65aULL, 0x00025bb14255351aULL,
+    0x00025ba62350962cULL, 0x00025b84c8b7f551ULL, 0x00025b6e8e5e576aULL, 0x00025b4d39e9aac6ULL,
+    0x00025b20cf07e310ULL, 0x00025aff832919d8ULL, 0x00025ae9529f5b6fULL, 0x00025a7a78693e14ULL,
+    0x00025a6451a8e161ULL, 0x000259b3563889b7ULL, 0x0002597c1cf72e15ULL, 0x0002594ff6752b26ULL,
+    0x000258f7bce0143fULL, 0x000258ecb77f6898ULL, 0x000258739700698cULL, 0x000258689677f5f5ULL,
+    0x00025852969ca85dULL, 0x0002583199d95edeULL, 0x00025805a3cd9226ULL, 0x000257e4af7e6266ULL,
+    0x0002578ce05b0b84ULL, 0x00025740202fb1baULL, 0x0002572a3608487bULL, 0x000256c7ac297afdULL,
+    0x0002569beb10940bULL, 0x000256860ce9e86bULL, 0x00025618ce1b5c46ULL, 0x000255f80fd6fa2bULL,
+    0x000255b69e0e6457ULL, 0x000255753a977615ULL, 0x000255548e3925ecULL, 0x0002551e218c3b5eULL,
+    0x000255134033e4ecULL, 0x000254dcdf6c3dd2ULL, 0x000254d200749104ULL, 0x00025490cef67cccULL,
+    0x000253f8e8259cadULL, 0x000253b7e60a0461ULL, 0x000253567d73afbbULL, 0x0002534bacafacb8ULL,
+    0x000252ea6777b07aULL, 0x000252b46b300ca1ULL, 0x00025289420427a9ULL, 0x00025253575bd20aULL,
+    0x00025151127ef1feULL, 0x00025146547f5a4cULL, 0x00025130d9aadcdfULL, 0x00025110a4568c89ULL,
+    0x000250e5b8013afaULL, 0x000250b019528614ULL, 0x000250a561264c1fULL, 0x0002506fce199533ULL,
+    0x00024fcf4f018fefULL, 0x00024fc49ef54cc2ULL, 0x00024f048005c58bULL, 0x00024ee486fdfd46ULL,
+    0x00024eaf44f5a039ULL, 0x00024e8f5525a86dULL, 0x00024e84b0a4c927ULL, 0x00024e24f95d078eULL,
+    0x00024e0fb86737afULL, 0x00024defd9d52b78ULL, 0x00024dc561179f74ULL, 0x00024d7081f27da5ULL,
+    0x00024d2652b92b89ULL, 0x00024cd1a151d2c5ULL, 0x00024cb1e511d4afULL, 0x00024c67e5c87eebULL,
+    0x00024c52c4d4f906ULL, 0x00024be936d21413ULL, 0x00024bd41ef68051ULL, 0x00024bb47e037f54ULL,
+    0x00024ba9f3c971ccULL, 0x00024b75465260d3ULL, 0x00024b361c3973cfULL, 0x00024b2b968757a2ULL,
+    0x00024b0c07b41c69ULL, 0x00024accf439c535ULL, 0x00024aad6f91917aULL, 0x00024a8dee4bf35cULL,
+    0x00024a78ef5409eaULL, 0x00024a39fb70207dULL, 0x00024a2f7ec5277dULL, 0x00024a100b046d35ULL,
+    0x000249fb150e90c2ULL, 0x000249bc3c2b01feULL, 0x0002499cd4c71fbfULL, 0x00024972fad3e0f2ULL,
+    0x0002495e1018701dULL, 0x000249539b4a3163ULL, 0x000249343f1d1e7eULL, 0x000248d63ebc2b5eULL,
+    0x000248a212ae1db4ULL, 0x00024882c983a6fdULL, 0x0002485917d56a41ULL, 0x0002481a9876011fULL,
+    0x000247fb5dc9697eULL, 0x00024788f8878e19ULL, 0x0002477e9474a281ULL, 0x0002475f6a742a55ULL,
+    0x00024721206ec2aaULL, 0x000246c3ca537fa1ULL, 0x000246af1094f15fULL, 0x0002466692147e27ULL,
+    0x0002464785f51254ULL, 0x00024632d50c2df2ULL, 0x000245cb768a81aaULL, 0x000245ac7af200ccULL,
+    0x00024559ec25b7e1ULL, 0x00024530ad88b8d0ULL, 0x0002451c106bf706ULL, 0x000244f2da9527c1ULL,
+    0x00024481a4a3f0ccULL, 0x0002445884b05d16ULL, 0x0002441adfaeb4bbULL, 0x000243fc1216d0a0ULL,
+    0x000243dd47c42ff4ULL, 0x0002438b3c368254ULL, 0x0002434dc2c71e34ULL, 0x000242f1a5101f3cULL,
+    0x000242585f3cdd6eULL, 0x0002422f8d8535aaULL, 0x0002421b26d274c6ULL, 0x00024210f4034800ULL,
+    0x000241fc8f793d6dULL, 0x000241ddfb5ca9e5ULL, 0x000241599ee65f68ULL, 0x0002414547496b1eULL,
+    0x000240fe1fec8f70ULL, 0x000240844e5cfbd6ULL, 0x00024014d0c08af5ULL, 0x00023ff67028a353ULL,
+    0x00023fec50ac3e1cULL, 0x00023fcdf4598338ULL, 0x00023f9b6196b0e8ULL, 0x00023f7d0dcb9c6bULL,
+    0x00023f3656b31ab5ULL, 0x00023f180d8c8911ULL, 0x00023ef9c7963a3cULL, 0x00023ebd45386197ULL,
+    0x00023e8ae24e887fULL, 0x00023e6cab32cb15ULL, 0x00023e629988ff26ULL, 0x00023e2636f7248fULL,
+    0x00023df3ee84f618ULL, 0x00023db7a3348442ULL, 0x00023d8f78080d3bULL, 0x00023d352b71929dULL,
+    0x00023cdafb45653aULL, 0x00023ca8ecc477a4ULL, 0x00023c8ae84371bcULL, 0x00023c62e726e8ddULL,
+    0x00023c12f5b0dc88ULL, 0x00023bf500e61f93ULL, 0x00023bd70f3e5c9dULL, 0x00023baf273ee72eULL,
+    0x00023b5f67f33c76ULL, 0x00023afbd818be59ULL, 0x00023ae7f2b0678fULL, 0x00023ade0081564cULL,
+    0x00023aac4ac84bdcULL, 0x00023aa25aad3884ULL, 0x00023a70af5682e4ULL, 0x00023a352057255eULL,
+    0x00023a175d812711ULL, 0x000239efb3e34d2aULL, 0x000239d1f84be34eULL, 0x000239a07133c27fULL,
+    0x0002393d7cd346b6ULL, 0x0002390c0f86703cULL, 0x000238b32d33b5d2ULL, 0x00023832fad2f11dULL,
+    0x0002381f46f8d042ULL, 0x00023801bbc15aafULL, 0x0002376e31b7499fULL, 0x000237645e7038a7ULL,
+    0x00023750b8e75f43ULL, 0x0002372971ea5004ULL, 0x0002370c003e0550ULL, 0x000236d12610618fULL,
+    0x000236965818d466ULL, 0x0002363e3a029bfdULL, 0x0002362aa8d2dc73ULL, 0x000236038a81abd3ULL,
+    0x0002359812fc92e3ULL, 0x0002357acaed069eULL, 0x0002357108e9a51cULL, 0x0002353683e70edcULL,
+    0x00023490f769476cULL, 0x00023473ca90d9deULL, 0x0002341c561c6355ULL, 0x000233e217861897ULL,
+    0x000233c4fcbd5b5dULL, 0x000233bb49d004d1ULL, 0x00023333a3d720c4ULL, 0x000232efe952b5e9ULL,
+    0x000232a295cf7e77ULL, 0x0002325efe27b238ULL, 0x0002324bb13c6db8ULL, 0x000232082e727d16ULL,
+    0x000231ce5d8698b5ULL, 0x000231bb1a873d0dULL, 0x0002319e38820d6bULL, 0x0002318159751489ULL,
+    0x00023177ba6ef25eULL, 0x000230cac4509b65ULL, 0x000230b79319d8e6ULL, 0x0002309acbbe2210ULL,
+    0x0002303af333f747ULL, 0x00023001810108b0ULL, 0x00022f8ebfebc817ULL, 0x00022f7216ff4a9eULL,
+    0x00022f091a0aef8bULL, 0x00022eff90a3162fULL, 0x00022eb351196570ULL, 0x00022e5da277b4aeULL,
+    0x00022e2491f9687dULL, 0x00022deb8d23ddb5ULL, 0x00022d961bb8285cULL, 0x00022d8c9ef46321ULL,
+    0x00022d702a98e241ULL, 0x00022d53b924bf12ULL, 0x00022d374a9787cfULL, 0x00022d2457d5e6c8ULL,
+    0x00022d07ee1de6d2ULL, 0x00022cc5ad5f01cfULL, 0x00022cb2c2568f33ULL, 0x00022ca94d4dbed1ULL,
+    0x00022c415b1dc89bULL, 0x00022c1b984e8ac5ULL, 0x00022be2fdb38ab5ULL, 0x00022bc6b4b806b7ULL,
+    0x00022b9796cf24aaULL, 0x00022b7b557f48a5ULL, 0x00022b55ad8cf191ULL, 0x00022b1d3b330d09ULL,
+    0x00022ac8a52cecedULL, 0x00022a904f798e63ULL, 0x00022a7428e9fa54ULL, 0x00022a454453fff7ULL,
+    0x00022a3be45cdb70ULL, 0x000229d4d9a8a2baULL, 0x000229935b268267ULL, 0x000229774e3eb6d6ULL,
+    0x0002295b442e81cfULL, 0x0002294894625f0bULL, 0x000228f48ce7b117ULL, 0x000228d8901530cdULL,
+    0x0002287b59ca4410ULL, 0x00022814f58bb265ULL, 0x0002280ba87f06eeULL, 0x000227d3e0c71f14ULL,
+    0x000227647321a55aULL, 0x00022751e53b4410ULL, 0x000226fe7620198fULL, 0x000226ab2041e038ULL,
+    0x000226a1df622d5aULL, 0x0002263c2a48278fULL, 0x00022632ed22b700ULL, 0x0002262073c6145dULL,
+    0x000225e90f21006dULL, 0x000225c4278fb988ULL, 0x0002258cd57e7a60ULL, 0x0002255ec445e973ULL,
+    0x0002251e52bbab93ULL, 0x0002250bebed446bULL, 0x00022502b8fc74d8ULL, 0x000224affc621706ULL,
+    0x00022466861aba27ULL, 0x000223b85beed9aeULL, 0x0002239ce61f2ae4ULL, 0x0002238173103b7bULL,
+    0x0002236602c1a17fULL, 0x0002232f2a63c663ULL, 0x000223017e7a0b6fULL, 0x000222e61afcdee0ULL,
+    0x000222af5c3c180eULL, 0x0002228ae3274564ULL, 0x0002226f8b8919d2ULL, 0x0002225d52a4afb5ULL,
+    0x00022241ff954f1cULL, 0x000222024866717dULL, 0x00022179f1ddf529ULL, 0x0002215eb5877c40ULL,
+    0x0002213157021acdULL, 0x0002210d10d32e3fULL, 0x000220a968b1301cULL, 0x0002208e412945a8ULL,
+    0x0002206a10a9ff1eULL, 0x00022033d0ef04c2ULL, 0x00022006a414c0c0ULL, 0x00021ffd9c02b07cULL,
+    0x00021fd078277f8cULL, 0x00021fc771e1c7e4ULL, 0x00021fac60dc9a11ULL, 0x00021f7f4a7afc9fULL,
+    0x00021f7646e6c843ULL, 0x00021f49397d88a4ULL, 0x00021f133340c6e1ULL, 0x00021ec23e07ef1aULL,
+    0x00021e68664c208bULL, 0x00021e4d782d14e0ULL, 0x00021e3b8594a7d3ULL, 0x00021e17a3f3ec61ULL,
+    0x00021db50ff1d955ULL, 0x00021d9a339e4047ULL, 0x00021d7f59f472eaULL, 0x00021cf9418885dbULL,
+    0x00021cde77d1305eULL, 0x00021ca000cabc00ULL, 0x00021c853fe94d67ULL, 0x00021c4fc6173334ULL,
+    0x00021c1a56d8d43aULL, 0x00021bffa3300ff3ULL, 0x00021bd328499b42ULL, 0x00021bca43c9687fULL,
+    0x00021b9dd1ad15aeULL, 0x00021b18a7379d9eULL, 0x00021b0fc8db52a4ULL, 0x00021ac8e078c0c5ULL,
+    0x00021aa57345d238ULL, 0x00021a93be6b8a8cULL, 0x00021a8ae46e25c0ULL, 0x00021a705834c773ULL,
+    0x00021a20c33aa2d3ULL, 0x00021a0f171857d0ULL, 0x00021a0641769edbULL, 0x000219ebc24efa43ULL,
+    0x000219da19a7ad35ULL, 0x000219676da4dd1bULL, 0x00021955cdac8cbaULL, 0x0002193291338d03ULL,
+    0x0002191826e10790ULL, 0x000218ec261ce344ULL, 0x000218e35a06573fULL, 0x000218d1c2b69d6bULL,
+    0x000218b761e83bd1ULL, 0x000218943a32739fULL, 0x00021882a8119e0aULL, 0x000218684f089e65ULL,
+    0x000217e4b8a379edULL, 0x000217b028268402ULL, 0x000217a76667a7caULL, 0x0002178d22e2bc8eULL,
+    0x00021772e1f10402ULL, 0x0002176162bde70dULL, 0x00021709f7e28b4bULL, 0x000216a9f0175d8dULL,
+    0x000216870d130fa6ULL, 0x000216759d45ea20ULL, 0x0002166ce5cc8b3fULL, 0x0002165b77b42373ULL,
+    0x000215227bf6029eULL, 0x000214ffcbf30515ULL, 0x000214ee75a2cad3ULL, 0x000214cbcc64526fULL,
+    0x0002146c9233c035ULL, 0x00021463ebb0e036ULL, 0x000214529f82fa18ULL, 0x000214161dbb545dULL,
+    0x000213eaee05aa4eULL, 0x000213e24bb8ad6bULL, 0x000213d107f5f003ULL, 0x0002137ac5f5689fULL,
+    0x00021360ead033c3ULL, 0x00021335d87e40d4ULL, 0x000212e862b3e419ULL, 0x000212ce95caa829ULL,
+    0x00021278a7854a26ULL, 0x00021233fcecfad4ULL, 0x0002121a4188eaf6ULL, 0x000211f7f63b35eeULL,
+    0x000211de40aa3da8ULL, 0x000211cd1e56f811ULL, 0x000211778353139bULL, 0x000211443396d9d7ULL,
+    0x000210e63b38675dULL, 0x000210ddb1eea65aULL, 0x000210cca02ebc15ULL, 0x000210c417b88c00ULL,
+    0x00021090eabb5b3eULL, 0x000210664cce3eaeULL, 0x00021019a83f1c90ULL, 0x00021011258e8830ULL,
+    0x00020fb39a0f8221ULL, 0x00020f9a1cad1653ULL, 0x00020f4db34a1044ULL, 0x00020ece8a1dca59ULL,
+    0x00020ec61215d8daULL, 0x00020e9bbe036414ULL, 0x00020e6086ef7e97ULL, 0x00020e36432c7147ULL,
+    0x00020e14783fe5ccULL, 0x00020dd0ef6a7202ULL, 0x00020cfe53645debULL, 0x00020ce518cdff89ULL,
+    0x00020cbb11e10bbeULL, 0x00020c9977953fa5ULL, 0x00020c6f7cc359d7ULL, 0x00020c3d2571ca11ULL,
+    0x00020c23fd68a273ULL, 0x00020bd893c780f0ULL, 0x00020bd0340c802bULL, 0x00020b7428abd278ULL,
+    0x00020b5b13e895f0ULL, 0x00020b52b8303b27ULL, 0x00020b42018c8805ULL, 0x00020b28f1975050ULL,
+    0x00020b078ab6d70cULL, 0x00020aee805ae675ULL, 0x00020ad57864a5e8ULL, 0x00020aabc5c7b5ccULL,
+    0x00020a60c83a58bfULL, 0x00020a58747eaa3bULL, 0x000209fcecf0a2bdULL, 0x000209f49c639e6bULL,
+    0x000209b22183736bULL, 0x0002097803e20cc7ULL, 0x0002094e88edcedbULL, 0x00020935a8b935c9ULL,
+    0x0002092d5e840f4cULL, 0x000208fba6ce4a95ULL, 0x000208d23f9fdf31ULL, 0x0002087f84fddd12ULL,
+    0x0002086efc6b2479ULL, 0x0002083526ae3bbdULL, 0x0002081c614c6f23ULL, 0x0002080bdf055f47ULL,
+    0x0002077779a19081ULL, 0x0002076f3d97adc2ULL, 0x0002075ec64c617aULL, 0x0002074615506e6bULL,
+    0x00020714ba62e55cULL, 0x0002070c817a229cULL, 0x000206fc1070a415ULL, 0x000206c28d026600ULL,
+    0x000206914b11625cULL, 0x00020678ad9ab861ULL, 0x0002066845ed40aeULL, 0x0002064fac5b447fULL,
+    0x0002064779af6a0eULL, 0x0002062ee33a1b80ULL, 0x0002061e8037a846ULL, 0x000205cca0b4c650ULL,
+    0x000205a3baa6949aULL, 0x0002059b8d6a348dULL, 0x00020572af1bf966ULL, 0x0002055a2cd2b60eULL,
+    0x000205292f369d86ULL, 0x0002052105d8d895ULL, 0x000204bf2987a903ULL, 0x0002048e494165a7ULL,
+    0x0002045d72392fc1ULL, 0x000204450a2b882aULL, 0x0002042ca46c6870ULL, 0x0002041c61df91dfULL,
+    0x000203bae811b0c1ULL, 0x000203b2ca3f503dULL, 0x000203a28f5ebcf9ULL, 0x00020341438b3b29ULL,
+    0x00020339298c8b16ULL, 0x00020320dd17bae4ULL, 0x00020310ab651c08ULL, 0x000202f862c1d230ULL,
+    0x000202d80577bb4eULL, 0x00020297571642b1ULL, 0x0002027f19e226ecULL, 0x0002027705fd58beULL,
+    0x0002024ea6530355ULL, 0x0002021e3be32995ULL, 0x000201e5cb3a1cefULL, 0x000201cd9ebc9d75ULL,
+    0x00020144cd8a115eULL, 0x0002012cb02f3bacULL, 0x000200f4747f84c5ULL, 0x000200dc5eb0afebULL,
+    0x000200cc51686f9cULL, 0x000200c44b24c413ULL, 0x0002004c0b49acefULL, 0x0001fff40047fe50ULL,
+    0x0001ffd403c7acd7ULL, 0x0001ffc407072d28ULL, 0x0001ffac0dc5bd8eULL, 0x0001ff8c1a420d09ULL,
+    0x0001ff7c21ff3c32ULL, 0x0001ff74263d8b2bULL, 0x0001ff047bcb120dULL, 0x0001fefc83c515eaULL,
+    0x0001fee49d30ceedULL, 0x0001fed4af613d06ULL, 0x0001fe6d3dcd3c0eULL, 0x0001fe25b8ee12aaULL,
+    0x0001fdce6a9e8d58ULL, 0x0001fdc67c412f2dULL, 0x0001fdaeb2a40d08ULL, 0x0001fd6f4e84c8d5ULL,
+    0x0001fd578d099532ULL, 0x0001fd4fa25e8c36ULL, 0x0001fd1055e1317cULL, 0x0001fce0e6d584b5ULL,
+    0x0001fcd8ffda3be5ULL, 0x0001fca99b1d7486ULL, 0x0001fc99d0d4b413ULL, 0x0001fc82233e0cedULL,
+    0x0001fc6a77dbb185ULL, 0x0001fc3345dc485dULL, 0x0001fc0be0571289ULL, 0x0001fbf43ff5953dULL,
+    0x0001fbd4c2de7876ULL, 0x0001fba58e8d0e56ULL, 0x0001fb95d46516eaULL, 0x0001fb4f1abeb099ULL,
+    0x0001fb474038f840ULL, 0x0001fb1fff41d400ULL, 0x0001fb009c753048ULL, 0x0001fac1e2821b6bULL,
+    0x0001faaa60c72738ULL, 0x0001fa92e13a61e7ULL, 0x0001fa1d8424aadbULL, 0x0001fa15b3122f95ULL,
+    0x0001f9eea154aa0dULL, 0x0001f9a85d64207fULL, 0x0001f9a08fef94f9ULL, 0x0001f97990453b36ULL,
+    0x0001f95a61ab21c4ULL, 0x0001f94acbcf5d48ULL, 0x0001f92ba2f9f2f1ULL, 0x0001f8fcecedcab9ULL,
+    0x0001f89f9abaf852ULL, 0x0001f8045e49b133ULL, 0x0001f7fc9dc5d0d4ULL, 0x0001f7ce1fb00ceaULL,
+    0x0001f7a767d58439ULL, 0x0001f7902f93ef7eULL, 0x0001f761c57c7489ULL, 0x0001f75a09f82686ULL,
+    0x0001f72ba9dafa4fULL, 0x0001f71c366200b0ULL, 0x0001f7147d009b3fULL, 0x0001f7050af3f11cULL,
+    0x0001f6ede1a819d8ULL, 0x0001f6a8728ef3dbULL, 0x0001f6727ebb2cfbULL, 0x0001f644493cacfdULL,
+    0x0001f62d31ad3a81ULL, 0x0001f61dcdd0e170ULL, 0x0001f5e7f7ba9562ULL, 0x0001f574c1864b1fULL,
+    0x0001f56568f5bd8bULL, 0x0001f546baa5cfebULL, 0x0001f520660938c6ULL, 0x0001f501c02a90e6ULL,
+    0x0001f4eac6393fbcULL, 0x0001f4c47faae89cULL, 0x0001f47fa8ffcf1fULL, 0x0001f46116c69750ULL,
+    0x0001f451cf107795ULL, 0x0001f41c5b6b9f06ULL, 0x0001f3df52f2cfe8ULL, 0x0001f3c8739c867eULL,
+    0x0001f3a9f7c0239eULL, 0x0001f39abb36e553ULL, 0x0001f383e226fa98ULL, 0x0001f37c44ede233ULL,
+    0x0001f356364b81cbULL, 0x0001f34e9a76c704ULL, 0x0001f320f8588791ULL, 0x0001f311c428e8a8ULL,
+    0x0001f30a2a6a032eULL, 0x0001f2faf79dfea5ULL, 0x0001f2e42d283f46ULL, 0x0001f2c5cd1d75fcULL,
+    0x0001f2b69e7b1c58ULL, 0x0001f29fda4326dbULL, 0x0001f22691806fe3ULL, 0x0001f1cbc19fa3e0ULL,
+    0x0001f1a5f4c6dbdcULL, 0x0001f187bb6e8333ULL, 0x0001f143c7d22ba8ULL, 0x0001f11e0f9c5ba9ULL,
+    0x0001f116850e2d21ULL, 0x0001f0ffe6c30148ULL, 0x0001f0da38d85784ULL, 0x0001f0d2b058e8b4ULL,
+    0x0001f0c3a00975b9ULL, 0x0001f07fe1f041d1ULL, 0x0001f069515811ffULL, 0x0001f03c364e56e1ULL,
+    0x0001f034b298b797ULL, 0x0001eff89d1c2904ULL, 0x0001eff11b727cffULL, 0x0001ef9e9824b948ULL,
+    0x0001ef881c01b955ULL, 0x0001ef71a1e8e982ULL, 0x0001ef53acf3a47cULL, 0x0001ef105308ccedULL,
+    0x0001ef015dfbf773ULL, 0x0001eebe1a6fec8dULL, 0x0001ee914ce42d11ULL, 0x0001ee737308ce00ULL,
+    0x0001ee5d12018dceULL, 0x0001ee4e27c7761fULL, 0x0001ee03a222d745ULL, 0x0001eded4b395cadULL,
+    0x0001ed7db6f1759cULL, 0x0001ed2c03d2a357ULL, 0x0001ecff7ef921c4ULL, 0x0001ecf814479495ULL,
+    0x0001ece1d589a34cULL, 0x0001ec9f2559dd0bULL, 0x0001ec9055fb7202ULL, 0x0001ebab396e0d02ULL,
+    0x0001eb9c78b65fb3ULL, 0x0001eb9518af85b4ULL, 0x0001eb68dd2b9a4aULL, 0x0001eb52c265ac9eULL,
+    0x0001eb2def86c399ULL, 0x0001eb2692d089c6ULL, 0x0001eafa6b2d3e19ULL, 0x0001eace4b79a53fULL,
+    0x0001ea6775a7a047ULL, 0x0001ea601ee34df2ULL, 0x0001ea5172035639ULL, 0x0001ea1e1bdd8239ULL,
+    0x0001e9cd859fc09fULL, 0x0001e9b78fcb08f5ULL, 0x0001e9b03e497aecULL, 0x0001e99a4b14bb37ULL,
+    0x0001e98459d7a66dULL, 0x0001e95fcc25b97eULL, 0x0001e92ca88ab701ULL, 0x0001e91e0e0bc6f3ULL,
+    0x0001e916c1200226ULL, 0x0001e8f243c9c681ULL, 0x0001e8dc61995f8cULL, 0x0001e8bf370f629cULL,
+    0x0001e89ac6c767baULL, 0x0001e867cc4f43b8ULL, 0x0001e843690e8919ULL, 0x0001e82d9681d60fULL,
+    0x0001e82650c1e6b8ULL, 0x0001e7fab2cebeb0ULL, 0x0001e7aad02174a7ULL, 0x0001e7698733fabcULL,
+    0x0001e74c88d83a1dULL, 0x0001e7284fbef14dULL, 0x0001e6e729bb560aULL, 0x0001e6bbc4bb9ae7ULL,
+    0x0001e6b489fc272eULL, 0x0001e6892e0196b6ULL, 0x0001e67abbbad8b5ULL, 0x0001e64f6a0be33cULL,
+    0x0001e64832840fffULL, 0x0001e62420133a2dULL, 0x0001e61ce9d44069ULL, 0x0001e607485fefa0ULL,
+    0x0001e5c66f8e43daULL, 0x0001e5b0d5cb471bULL, 0x0001e59b3df3fb3aULL, 0x0001e52105c0713aULL,
+    0x0001e50b7ab08c53ULL, 0x0001e5044cc2c236ULL, 0x0001e4d93da6335bULL, 0x0001e4cae4fa3ccaULL,
+    0x0001e4b5618fbe16ULL, 0x0001e474e2c38634ULL, 0x0001e434751ee044ULL, 0x0001e42d4d8d2598ULL,
+    0x0001e3f4189af510ULL, 0x0001e3dea83c303aULL, 0x0001e3c939c399beULL, 0x0001e3aca96bfee8ULL,
+    0x0001e3973f60d979ULL, 0x0001e37392da0434ULL, 0x0001e333698f6246ULL, 0x0001e316eae552b3ULL,
+    0x0001e2f3514a4283ULL, 0x0001e2d6da2eb20bULL, 0x0001e2b34a03dfccULL, 0x0001e2ac2dcf6f69ULL,
+    0x0001e29df6076888ULL, 0x0001e25e055f801bULL, 0x0001e201c7a5aebaULL, 0x0001e1d740e6190aULL,
+    0x0001e1895d565f2eULL, 0x0001e18249e608ebULL, 0x0001e17423a50d33ULL, 0x0001e16d10d4630dULL,
+    0x0001e11f4f92a4b2ULL, 0x0001e10a1f398632ULL, 0x0001e0f4f0be1ad0ULL, 0x0001e0c38b892126ULL,
+    0x0001e08b2449e1e4ULL, 0x0001e07600fb7dc4ULL, 0x0001e02f98b7c336ULL, 0x0001e00c6c524da1ULL,
+    0x0001dfe23dd86a34ULL, 0x0001dfdb36d1ec28ULL, 0x0001df9c00d952b0ULL, 0x0001df08c39a0c1eULL,
+    0x0001defac27bad4bULL, 0x0001dea6ccf47036ULL, 0x0001de9fcf27f0fcULL, 0x0001de8ad6fc1ba8ULL,
+    0x0001de67e81d5ff1ULL, 0x0001de3e03668ce2ULL, 0x0001de3708a9592dULL, 0x0001de2219aa989cULL,
+    0x0001ddff3a1451f3ULL, 0x0001dde357abf01aULL, 0x0001ddd567b007d0ULL, 0x0001ddc0813c52f5ULL,
+    0x0001dd96b9d09687ULL, 0x0001dd6cf9b2d2c8ULL, 0x0001dd51285792fbULL, 0x0001dd4340e11d78ULL,
+    0x0001dd2e67342f36ULL, 0x0001dd04b950f9ceULL, 0x0001dc9ca66ca30cULL, 0x0001dc575db61c0aULL,
+    0x0001dc42989fef7dULL, 0x0001dbef9660e470ULL, 0x0001dbdada565caaULL, 0x0001dbb84f9da093ULL,
+    0x0001db8ee2f78bd6ULL, 0x0001db87fc3a13c7ULL, 0x0001db657d87af82ULL, 0x0001db208f242f1fULL,
+    0x0001db0be51f3fb5ULL, 0x0001daf73ce66163ULL, 0x0001dae9786a9c99ULL, 0x0001dac02fc0d4cdULL,
+    0x0001da900eb6d774ULL, 0x0001da6db3f1e5e5ULL, 0x0001da2fe9e36407ULL, 0x0001da06c174a5cfULL,
+    0x0001d9eb5522bb8aULL, 0x0001d9d6c5fa425bULL, 0x0001d9adad02c85eULL, 0x0001d99ffb9b240aULL,
+    0x0001d97014ebc3ecULL, 0x0001d94de3ca6992ULL, 0x0001d9470dc1d9bdULL, 0x0001d91e0db3b8d1ULL,
+    0x0001d8b7ac9dd9f5ULL, 0x0001d881248bf520ULL, 0x0001d87a546c2ba1ULL, 0x0001d85177cd5202ULL,
+    0x0001d83d0c2449d0ULL, 0x0001d82f700408e7ULL, 0x0001d828a23f3680ULL, 0x0001d81b074c22f3ULL,
+    0x0001d806a057d03bULL, 0x0001d7ae4be70a32ULL, 0x0001d7a0b7ffd3c8ULL, 0x0001d763a81a86f3ULL,
+    0x0001d75ce033c914ULL, 0x0001d74f50fc1bfdULL, 0x0001d73afb9efcafULL, 0x0001d70b9097afc9ULL,
+    0x0001d65503e1f1a9ULL, 0x0001d640c41781c4ULL, 0x0001d5918ed5d1c1ULL, 0x0001d58ad4513095ULL,
+    0x0001d555071c7ed0ULL, 0x0001d540dd565866ULL, 0x0001d52cb54ba29eULL, 0x0001d5046a67a473ULL,
+    0x0001d4ad3533152cULL, 0x0001d49fcd6e4174ULL, 0x0001d49919d574c1ULL, 0x0001d48500316a07ULL,
+    0x0001d43b5b96584bULL, 0x0001d42749fc1984ULL, 0x0001d42099d5368dULL, 0x0001d3f87ceede9aULL,
+    0x0001d3d066e7c7a2ULL, 0x0001d3bc5e776744ULL, 0x0001d39afee139f1ULL, 0x0001d35ef86b50a6ULL,
+    0x0001d3584dfc6443ULL, 0x0001d3305360afe1ULL, 0x0001d3085f9b6ed2ULL, 0x0001d2e719aef05cULL,
+    0x0001d2ab415ca270ULL, 0x0001d28364559041ULL, 0x0001d26f785fb66fULL, 0x0001d254eb12a66fULL,
+    0x0001d24103149ff6ULL, 0x0001d21fd9891f2cULL, 0x0001d20bf61296c6ULL, 0x0001d1f174184226ULL,
+    0x0001d1e4343c8a2bULL, 0x0001d1dd9497038fULL, 0x0001d1d055dc96d3ULL, 0x0001d18e2782ea86ULL,
+    0x0001d13ed57f6f84ULL, 0x0001d12b05378a83ULL, 0x0001d117369f9af1ULL, 0x0001d0f63761b3acULL,
+    0x0001d0c80d1b241eULL, 0x0001d0a7191775ffULL, 0x0001d0a0827310a0ULL, 0x0001d05815b59e43ULL,
+    0x0001d044590fdc85ULL, 0x0001d0165212d287ULL, 0x0001cff5773d3aecULL, 0x0001cfa020d33652ULL,
+    0x0001cf93029fd20cULL, 0x0001cf5803e715c8ULL, 0x0001cf3dd0669400ULL, 0x0001cf1688b3b4e6ULL,
+    0x0001ceef47a99866ULL, 0x0001cece968b874cULL, 0x0001cea761b26a6aULL, 0x0001ce93c9c3740bULL,
+    0x0001ce79ac6ee7a5ULL, 0x0001ce457a9d4fc8ULL, 0x0001ce31eaf82688ULL, 0x0001ce17d8af0898ULL,
+    0x0001ce044ce63f3cULL, 0x0001cdf0c2c4b31eULL, 0x0001cda92bc0af60ULL, 0x0001cda2aac2b5ceULL,
+    0x0001cd82288c558cULL, 0x0001cd4131d9faceULL, 0x0001cd20bd5c11c2ULL, 0x0001cd0d4674da57ULL,
+    0x0001cc7ebb50a4edULL, 0x0001cc44848329f6ULL, 0x0001cc31202e8377ULL, 0x0001cc10d1ed6ccaULL,
+    0x0001cc0a5c6bbcddULL, 0x0001cbfd71f3a1f9ULL, 0x0001cbea139b88b9ULL, 0x0001cbbce87a82bfULL,
+    0x0001cbb0025b5703ULL, 0x0001cb5c3c321a33ULL, 0x0001cb4f5b7f03eaULL, 0x0001cb48eb6ac86bULL,
+    0x0001cb224ebb440cULL, 0x0001cb022673941cULL, 0x0001cae86fdeb985ULL, 0x0001cadb95a8d474ULL,
+    0x0001cac1e365cd5cULL, 0x0001ca9b5d664236ULL, 0x0001ca8e87811a1eULL, 0x0001ca680a20dc79ULL,
+    0x0001ca4e64ccc9efULL, 0x0001ca07ecef1b8bULL, 0x0001c9ee525ab61bULL, 0x0001c9db204c3c1cULL,
+    0x0001c9bb25c75b39ULL, 0x0001c981a14bbc9eULL, 0x0001c96e7858ba55ULL, 0x0001c95b51007b45ULL,
+    0x0001c941c9b41a26ULL, 0x0001c92ea61984b4ULL, 0x0001c90863b26c7fULL, 0x0001c8fba451a3d4ULL,
+    0x0001c8e227b2162eULL, 0x0001c8a8d9aebd04ULL, 0x0001c88909e28f99ULL, 0x0001c862e32d2931ULL,
+    0x0001c84fd2367d98ULL, 0x0001c829b5103603ULL, 0x0001c8235b7d9f84ULL, 0x0001c8104fd55af9ULL,
+    0x0001c8039e475980ULL, 0x0001c7fd45c42d2bULL, 0x0001c7ca8805bb13ULL, 0x0001c7a4811f7247ULL,
+    0x0001c77e809102c5ULL, 0x0001c7523297c023ULL, 0x0001c7329275577bULL, 0x0001c706533f823fULL,
+    0x0001c6f35f5cb968ULL, 0x0001c6d3cc64afebULL, 0x0001c6adee9d1d5eULL, 0x0001c6a79f98c530ULL,
+    0x0001c681c92b8bd9ULL, 0x0001c66ee0516f1eULL, 0x0001c66245f51d59ULL, 0x0001c64f5fba1f8aULL,
+    0x0001c64913553a1fULL, 0x0001c6234ca266e7ULL, 0x0001c616b676d465ULL, 0x0001c5c4f75a1a05ULL,
+    0x0001c5b21e328cf6ULL, 0x0001c5799c1fcd4bULL, 0x0001c566c93a3442ULL, 0x0001c5476d34564aULL,
+    0x0001c5349e78fa39ULL, 0x0001c52e59e8a422ULL, 0x0001c4f5f8a1d7c2ULL, 0x0001c4d6ac348ab8ULL,
+    0x0001c4bda560921fULL, 0x0001c4b123001e0fULL, 0x0001c45fe463a5afULL, 0x0001c440acafb1f0ULL,
+    0x0001c4024a32f83aULL, 0x0001c3ef966895abULL, 0x0001c3bdbe87b231ULL, 0x0001c37f80226436ULL,
+    0x0001c35a2fba3f5fULL, 0x0001c33b1c19414aULL, 0x0001c32242ad1246ULL, 0x0001c30336bedcdeULL,
+    0x0001c2fd01ac1628ULL, 0x0001c2cb5f3be0c5ULL, 0x0001c2b8c522c079ULL, 0x0001c27ace8e936aULL,
+    0x0001c25bd9a795f3ULL, 0x0001c21dfc9b6a22ULL, 0x0001c2119f3ca219ULL, 0x0001c1b4f8988e3cULL,
+    0x0001c1aeccb59cfcULL, 0x0001c1a27571cd29ULL, 0x0001c189c8f2463aULL, 0x0001c15878120bd5ULL,
+    0x0001c1524eb8c59eULL, 0x0001c11ae22ef815ULL, 0x0001c10e930817a0ULL, 0x0001c1086bb56d15ULL,
+    0x0001c0f5f6c06eecULL, 0x0001c0d73731b716ULL, 0x0001c09fe8ffcd2dULL, 0x0001c07b11c5a07bULL,
+    0x0001c0501e516b0cULL, 0x0001c018f1636fc8ULL, 0x0001c00690189c5cULL, 0x0001bfd59404ba8dULL,
+    0x0001bf9867f9ef67ULL, 0x0001bf861138cec5ULL, 0x0001bf79d8386d15ULL, 0x0001bf6168384e0aULL,
+    0x0001bf4f15f88f71ULL, 0x0001bf42dff8cb0cULL, 0x0001bf3090391983ULL, 0x0001bf0bf538e232ULL,
+    0x0001bef3913788e5ULL, 0x0001bed517f3ba35ULL, 0x0001becf00329d73ULL, 0x0001beaa7528e9f7ULL,
+    0x0001be9831e1cfd2ULL, 0x0001be8c05dc1e63ULL, 0x0001be85f018f6dcULL, 0x0001be73afce3037ULL,
+    0x0001be5547f7722dULL, 0x0001be4f33b21e85ULL, 0x0001be1e977d0754ULL, 0x0001bdfa294791a6ULL,
+    0x0001bdcfb0384546ULL, 0x0001bdb15eb340f4ULL, 0x0001bd9f2fc47d4dULL, 0x0001bd86f37f8390ULL,
+    0x0001bd74c8069461ULL, 0x0001bd2010bc54a1ULL, 0x0001bd1a04e05ef9ULL, 0x0001bd07e248c13bULL,
+    0x0001bcd1835eb457ULL, 0x0001bc7702adcba1ULL, 0x0001bc109d4f22b9ULL, 0x0001bc0a98d0bd9bULL,
+    0x0001bbda7abbf7f4ULL, 0x0001bbb66b03c8e3ULL, 0x0001bbb068f6ebd4ULL, 0x0001bb7a5dd491deULL,
+    0x0001bb4a5efb2d5dULL, 0x0001bb3862173275ULL, 0x0001bb206881c4a5ULL, 0x0001bb02742c7abbULL,
+    0x0001baea806c2240ULL, 0x0001bacc935fde7cULL, 0x0001bab4a5727ac4ULL, 0x0001ba96bfac9516ULL,
+    0x0001ba1362fda553ULL, 0x0001ba017f4d4c65ULL, 0x0001b9ef9d0f8b26ULL, 0x0001b9e3b1b42befULL,
+    0x0001b9a8228eeff4ULL, 0x0001b99c3b0e4075ULL, 0x0001b996478b8313ULL, 0x0001b98a610134bbULL,
+    0x0001b960bf29c6cbULL, 0x0001b90d9303f352ULL, 0x0001b8f5d54d0206ULL, 0x0001b8e408b11edbULL,
+    0x0001b8b498c1b922ULL, 0x0001b88b1f2f210aULL, 0x0001b83259824cefULL, 0x0001b8209caa9bc4ULL,
+    0x0001b7c801e102c2ULL, 0x0001b7bc3433d3a2ULL, 0x0001b792e95288bcULL, 0x0001b7756f70c4a9ULL,
+    0x0001b763c1cefd5dULL, 0x0001b7521599431bULL, 0x0001b73a8787a15dULL, 0x0001b72ec1714610ULL,
+    0x0001b6f9cddb632eULL, 0x0001b6d687e43298ULL, 0x0001b6c4e708b5d6ULL, 0x0001b6bf07101d3eULL,
+    0x0001b67e71c229afULL, 0x0001b65b3f9a8b61ULL, 0x0001b643cbf8db9dULL, 0x0001b63236e51664ULL,
+    0x0001b60f10f8a76dULL, 0x0001b6035aea9447ULL, 0x0001b5da62a73a66ULL, 0x0001b5ceaf6a09c4ULL,
+    0x0001b5bd23ba58fbULL, 0x0001b5b74acfc8c0ULL, 0x0001b5ab99729eb7ULL, 0x0001b57703098686ULL,
+    0x0001b53ca39ded09ULL, 0x0001b52b23a0c506ULL, 0x0001b4fc7fd62dd5ULL, 0x0001b48de2ad503cULL,
+    0x0001b45f60689e5dULL, 0x0001b45990d265efULL, 0x0001b44df21cccddULL, 0x0001b43c85356afdULL,
+    0x0001b436b68ccd91ULL, 0x0001b3c2b1cff3faULL, 0x0001b3492262a1f8ULL, 0x0001b320ac4f103bULL,
+    0x0001b3151e3d68c1ULL, 0x0001b303ca497431ULL, 0x0001b2fe03f15165ULL, 0x0001b2b8c3c343e7ULL,
+    0x0001b29bef86eeefULL, 0x0001b28aa538832dULL, 0x0001b284e2174c74ULL, 0x0001b2510ccc095bULL,
+    0x0001b234464f1ef2ULL, 0x0001b211c38e1abeULL, 0x0001b20c03a121b7ULL, 0x0001b1de09b49183ULL,
+    0x0001b1d84b264f44ULL, 0x0001b1c710652319ULL, 0x0001b19925120ad6ULL, 0x0001b187ef546de4ULL,
+    0x0001b170ff22332dULL, 0x0001b16587f21605ULL, 0x0001b15fcc944219ULL, 0x0001b14326052b7bULL,
+    0x0001b131f71a574aULL, 0x0001b11b0fffe4eeULL, 0x0001b0fe72866cdeULL, 0x0001b0f8b9e2488dULL,
+    0x0001b0c542e9f001ULL, 0x0001b0978e18983dULL, 0x0001b080b74e8db0ULL, 0x0001b05e79a4b46dULL,
+    0x0001b02b274f1cd6ULL, 0x0001b008f72fa12dULL, 0x0001aff7e1271473ULL, 0x0001afd5b9238ff4ULL,
+    0x0001afb94695ffcdULL, 0x0001afa836da5838ULL, 0x0001af972877db62ULL, 0x0001af640565cc61ULL,
+    0x0001af41f4bf556fULL, 0x0001af1a3d73df8eULL, 0x0001af0ee5dacfacULL, 0x0001af093a479266ULL,
+    0x0001aeece2a40e63ULL, 0x0001aeb43e8a1404ULL, 0x0001aea3436978a6ULL, 0x0001ae81512c4813ULL,
+    0x0001ae705a0f61d7ULL, 0x0001ae4322f5ca7eULL, 0x0001adf9bdab532fULL, 0x0001adee753b3b7bULL,
+    0x0001adbbb695e27aULL, 0x0001adb613eb76c0ULL, 0x0001adaacf081f85ULL, 0x0001ad50bd30245eULL,
+    0x0001ad349f5aa59aULL, 0x0001ad1e23bcec95ULL, 0x0001ad0d4892482fULL, 0x0001ad020c878151ULL,
+    0x0001acf13391b38aULL, 0x0001ace05bee97b4ULL, 0x0001acb914964730ULL, 0x0001aca8415b0736ULL,
+    0x0001ac75cf94c7c4ULL, 0x0001ac6a9b7737a6ULL, 0x0001ac6501a0ae3eULL, 0x0001ac329fac2896ULL,
+    0x0001ac16a742e1deULL, 0x0001ac0049900ca4ULL, 0x0001abe457b9a46cULL, 0x0001abcdff482d7cULL,
+    0x0001abb2140252c3ULL, 0x0001abac7efde465ULL, 0x0001aba15564ec8cULL, 0x0001ab9098171f19ULL,
+    0x0001ab8b03f26788ULL, 0x0001ab6f2169b0e9ULL, 0x0001aafa2b3f62cdULL, 0x0001aae3eb3be1b2ULL,
+    0x0001aac28f8f5f06ULL, 0x0001aab7722915e5ULL, 0x0001aaa6c72584a8ULL, 0x0001aa74cde9fe1cULL,
+    0x0001aa6f412a9666ULL, 0x0001aa42e0620821ULL, 0x0001aa2cb3744aa0ULL, 0x0001aa219ddae5eeULL,
+    0x0001aa1c13458d0fULL, 0x0001aa00608415ddULL, 0x0001a9d99f815e29ULL, 0x0001a9b86d646bdbULL,
+    0x0001a99cc79570e7ULL, 0x0001a96586bc04f5ULL, 0x0001a95a7b7c66adULL, 0x0001a94466b5791eULL,
+    0x0001a928cff5ee78ULL, 0x0001a8c01a21d19bULL, 0x0001a8b517774974ULL, 0x0001a8a4948971a5ULL,
+    0x0001a89f13d88756ULL, 0x0001a8839287722aULL, 0x0001a84c9a948881ULL, 0x0001a83123f151ecULL,
+    0x0001a81033de7b58ULL, 0x0001a7ffbdc00a59ULL, 0x0001a7ded5585e6dULL, 0x0001a79799fae4d2ULL,
+    0x0001a776c1bae675ULL, 0x0001a76bd01ca27aULL, 0x0001a755ee92705bULL, 0x0001a7096afaacb2ULL,
+    0x0001a6f3939a6b17ULL, 0x0001a6e8a8c2c797ULL, 0x0001a6d2d4c44354ULL, 0x0001a691664ba8ccULL,
+    0x0001a6810dd76c57ULL, 0x0001a665d28f8fe7ULL, 0x0001a6500c102958ULL, 0x0001a63fb8a9bc0dULL,
+    0x0001a61435c3bb09ULL, 0x0001a5f399794b59ULL, 0x0001a5dddebedcbbULL, 0x0001a5c2b87b4e25ULL,
+    0x0001a5a228c6b8b5ULL, 0x0001a58c766e9255ULL, 0x0001a550d77e0938ULL, 0x0001a54097cc86b3ULL,
+    0x0001a53b2d8351ddULL, 0x0001a5201c2bc5e2ULL, 0x0001a51ab2b852b5ULL, 0x0001a50a77339883ULL,
+    0x0001a4ef6c1e22f4ULL, 0x0001a4df33ef46f1ULL, 0x0001a4cefd005a68ULL, 0x0001a4b9605de1ddULL,
+    0x0001a4a92c58e9b1ULL, 0x0001a49e5fb1c009ULL, 0x0001a47897c62788ULL, 0x0001a42d1c47d546ULL,
+    0x0001a41790425b78ULL, 0x0001a3ec7ed7ebc0ULL, 0x0001a3bc15cd28f1ULL, 0x0001a3a6955d649dULL,
+    0x0001a39bd5f8f845ULL, 0x0001a38bb7ea8a92ULL, 0x0001a35607552f1cULL, 0x0001a34b4c109be7ULL,
+    0x0001a31b082757a1ULL, 0x0001a30af3fc4a9bULL, 0x0001a30598341f3aULL, 0x0001a2c55580f48eULL,
+    0x0001a285268079cbULL, 0x0001a2751dd336ebULL, 0x0001a26516606a07ULL, 0x0001a2450b29a1b5ULL,
+    0x0001a22504db000bULL, 0x0001a21a592d12a9ULL, 0x0001a215038a638eULL, 0x0001a1da5e8790a6ULL,
+    0x0001a1d50a86b0f2ULL, 0x0001a1ba688bf93eULL, 0x0001a1aa6f637a30ULL, 0x0001a1952513d921ULL,
+    0x0001a17539adf163ULL, 0x0001a16a96f6e2b5ULL, 0x0001a13571839175ULL, 0x0001a105a82ca503ULL,
+    0x0001a0f5bcd3a93eULL, 0x0001a0eb209a8323ULL, 0x0001a0cb4f2c3eb5ULL, 0x0001a08bbadf4fa8ULL,
+    0x0001a07bd8d3d9ffULL, 0x0001a06bf7fe6c97ULL, 0x00019fdd46e63487ULL, 0x00019fc82b7f28ccULL,
+    0x00019fb85859c586ULL, 0x00019fadcc417b8cULL, 0x00019f694aad0879ULL, 0x00019f0a951e1357ULL,
+    0x00019f0011d500c4ULL, 0x00019efad0639751ULL, 0x00019ef04de6fda0ULL, 0x00019eac0ab4b916ULL,
+    0x00019e8c90cdc1a4ULL, 0x00019e6d1badb77eULL, 0x00019e62a05d46f3ULL, 0x00019e52e8631463ULL,
+    0x00019e43319a1da5ULL, 0x00019e2e3fbe1223ULL, 0x00019e0ed8ec4b49ULL, 0x00019df4b18b0e95ULL,
+    0x00019def76dd1a6eULL, 0x00019dd0198f6a94ULL, 0x00019da64f36870fULL, 0x00019d7755a83dedULL,
+    0x00019d67af8257ebULL, 0x00019d52d3d21c91ULL, 0x00019d43306f7cf0ULL, 0x00019d23ed36c9caULL,
+    0x00019cf5113f181dULL, 0x00019cdb0d6979baULL, 0x00019cd5d9d6a36bULL, 0x00019c499ad3f81fULL,
+    0x00019c3f3b22ce02ULL, 0x00019c3a0b7c5605ULL, 0x00019c201f30ee5cULL, 0x00019bd26ddaf001ULL,
+    0x00019bb3625207f3ULL, 0x00019b9eb290521aULL, 0x00019b945b770423ULL, 0x00019b7faed35003ULL,
+    0x00019b565bc66e8dULL, 0x00019b3239e98ce4ULL, 0x00019b1346826163ULL, 0x00019b03ce8e06c2ULL,
+    0x00019af97f3b579cULL, 0x00019aea09378be0ULL, 0x00019acb20ad1a58ULL, 0x00019abbae26315fULL,
+    0x00019ab6883b4f8bULL, 0x00019aac3cc8a62fULL, 0x00019a8838c7671aULL, 0x00019a695ef1aa57ULL,
+    0x00019a5f175cd7e1ULL, 0x00019a3b20e1bf49ULL, 0x00019a2bb92d2b4aULL, 0x000199ee25eb0545ULL,
+    0x000199dec3fddfa4ULL, 0x000199cf633838faULL, 0x000199b5c47f1bf0ULL, 0x000199970a418930ULL,
+    0x00019978549f863dULL, 0x00019945302145efULL, 0x0001991733cde32cULL, 0x00019907e1fde3f3ULL,
+    0x000198f8915393e4ULL, 0x000198cfbfd2e313ULL, 0x000198bb5a2097e0ULL, 0x000198b1280ad371ULL,
+    0x000198a1ddde4ad5ULL, 0x0001986eeee151a2ULL, 0x00019864c09b2446ULL, 0x0001981360ab8f25ULL,
+    0x0001980936f545b9ULL, 0x000197e5a8f36f07ULL, 0x000197cc474f54a8ULL, 0x000197c734292425ULL,
+    0x000197b7fb788cccULL, 0x000197998d7fd766ULL, 0x0001977101eefa49ULL, 0x0001976bf10e0e5cULL,
+    0x00019761cfacf3bfULL, 0x000197529e8d12e3ULL, 0x000197343fb34066ULL, 0x0001972f3054fee9ULL,
+    0x00019715e5607f69ULL, 0x00019701abacc164ULL, 0x000196f281b788edULL, 0x000196e8665f6801ULL,
+    0x000196e358e38892ULL, 0x000196ca1759e5cbULL, 0x000196a6c0dd3234ULL, 0x000196979dad6606ULL,
+    0x000196887b9e1056ULL, 0x0001966a3ae047a3ULL, 0x0001963ce233eec4ULL, 0x000195e7564b9fb3ULL,
+    0x000195d33a9c6eb2ULL, 0x000195ba1ace7dc9ULL, 0x000195ab093787d0ULL, 0x0001956ece0b71e2ULL,
+    0x0001955fc20bbd77ULL, 0x0001955abe4b5f81ULL, 0x00019541ad65d6faULL, 0x000195239d3674e6ULL,
+    0x0001951e9af2e6afULL, 0x000194d387d786faULL, 0x000194ba87a79d23ULL, 0x000194978c94242dULL,
+    0x00019479959c4cffULL, 0x0001945ba314612aULL, 0x00019433bbef19c6ULL, 0x00019424c748d2b4ULL,
+    0x00019415d3bdd3fcULL, 0x00019410d823c29dULL, 0x000193e4054032e1ULL, 0x000193da10a03833ULL,
+    0x000193cb229bcc12ULL, 0x000193808d117151ULL, 0x0001935dc82cdb55ULL, 0x00019353da29d63cULL,
+    0x00019344f60feff3ULL, 0x00019336130f7c62ULL, 0x000193311cf88669ULL, 0x000193223b6f25ffULL,
+    0x00019318505a70c4ULL, 0x0001930970a59a70ULL, 0x000192e6c044117bULL, 0x000192d7e4374c2aULL,
+    0x000192cdfccaa7faULL, 0x000192ba2f674e48ULL, 0x000192a17167deecULL, 0x00019283c49ec7b2ULL,
+    0x00019274efde1a06ULL, 0x00019225e8f6e015ULL, 0x0001920d3d2b99a5ULL, 0x000191f982b6d1c8ULL,
+    0x000191c34beffcc3ULL, 0x000191be5ef4a0edULL, 0x000191a5bfdb85b2ULL, 0x00019196fb7272ccULL,
+    0x0001915bf4a86ac2ULL, 0x000191484b9555fcULL, 0x0001913e77c4af6bULL, 0x000190f4d27cc5cfULL,
+    0x000190e61b132a50ULL, 0x000190e13382bfe3ULL, 0x000190c3c8a53535ULL, 0x0001909c963475e1ULL,
+    0x00019088ffdc03b1ULL, 0x0001907a505b6aebULL, 0x00019070869ed441ULL, 0x00019061d8e99294ULL,
+    0x0001904e484f03f3ULL, 0x000190272cd5d3afULL, 0x00019004fb0fe042ULL, 0x00018ff6553bd09dULL,
+    0x00018fe7b07a5590ULL, 0x00018fddede72abdULL, 0x00018fd90ccb50f1ULL, 0x00018fc0a909377aULL,
+    0x00018fa36873dca7ULL, 0x00018f9e88c58453ULL, 0x00018f778f99e3e0ULL, 0x00018f557bcf91eeULL,
+    0x00018f4bc05df994ULL, 0x00018f46e2d2b6eeULL, 0x00018f3d28173f27ULL, 0x00018f0c8989d637ULL,
+    0x00018ee0d1c2fa4fULL, 0x00018ec88c3ef792ULL, 0x00018ec3b1e5b3bcULL, 0x00018eab6fecd361ULL,
+    0x00018e9ce35bb41dULL, 0x00018e7fcd68c66cULL, 0x00018e3729180b3aULL, 0x00018e23ce8c6574ULL,
+    0x00018df849b24265ULL, 0x00018ddb4bbed91aULL, 0x00018dc326033146ULL, 0x00018dbe520480d5ULL,
+    0x00018dafd6bc7148ULL, 0x00018da15c824d74ULL, 0x00018d97b646c66bULL, 0x00018d7ac6635560ULL,
+    0x00018d5ddab5e34bULL, 0x00018d59092c6337ULL, 0x00018d4f66732057ULL, 0x00018d328114f3b7ULL,
+    0x00018d0730e857c5ULL, 0x00018ccd7f5c7950ULL, 0x00018cc8b152907eULL, 0x00018cb0acdfbe56ULL,
+    0x00018ca2453347a6ULL, 0x00018c8f11eddbecULL, 0x00018c68b0f61c3fULL, 0x00018c5583433e36ULL,
+    0x00018c472234cfe2ULL, 0x00018c2a633905c5ULL, 0x00018c1271ebe628ULL, 0x00018bf0f1c28e9eULL,
+    0x00018be297ff2dafULL, 0x00018bc5e7971d45ULL, 0x00018bb790f233eaULL, 0x00018ba93b573893ULL,
+    0x00018b9fad839532ULL, 0x00018b9ae6c60e5aULL, 0x00018b619ee14f57ULL, 0x00018b581482a9d0ULL,
+    0x00018b49c5d1aa44ULL, 0x00018b36b3d74e6aULL, 0x00018b2867909ee4ULL, 0x00018b1edff49dfcULL,
+    0x00018b1a1c52bd2bULL, 0x00018b1095673580ULL, 0x00018b024be26aefULL, 0x00018ae0f9b101e2ULL,
+    0x00018ad775869fd0ULL, 0x00018ac46e920cc8ULL, 0x00018aaca8745996ULL, 0x00018a73a573cbf9ULL,
+    0x00018a3ab2e96f9dULL, 0x00018a1e3fce59b0ULL, 0x00018a19825ab202ULL, 0x00018a0b4aaed5deULL,
+    0x000189eede6ab7dfULL, 0x000189bacd3d61d0ULL, 0x00018973e3413489ULL, 0x0001896f29e5b183ULL,
+    0x00018960fe8160a8ULL, 0x000189368273737bULL, 0x0001891eec29ad8bULL, 0x00018910c68c494aULL,
+    0x00018902a1f383b8ULL, 0x000188efc8125ef5ULL, 0x000188e65bcf6420ULL, 0x000188e1a5d948f3ULL,
+    0x000188d384a473ecULL, 0x000188bbfa391c25ULL, 0x000188a9271e620eULL, 0x00018891a1c67b99ULL,
+    0x0001888386525a48ULL, 0x00018870b8a087dcULL, 0x0001884b22a3fa78ULL, 0x0001883d0c406024ULL,
+    0x0001881c3146eb01ULL, 0x0001880e1e4226f1ULL, 0x00018804bccea81fULL, 0x000187cc7d859f66ULL,
+    0x000187b9c158ac31ULL, 0x000187a258a55d34ULL, 0x0001879daa710bcdULL, 0x0001878197906847ULL,
+    0x000187738fa27011ULL, 0x0001876a3592cf79ULL, 0x000187161f1d548dULL, 0x0001871174426d5aULL,
+    0x000186de2433d72eULL, 0x000186d027fa6b16ULL, 0x000186bd83e6fb85ULL, 0x000186af8a031ca1ULL,
+    0x0001869841154e98ULL, 0x00018685a2568f12ULL, 0x00018677ac71b421ULL, 0x0001865bc3a65824ULL,
+    0x0001864484b3944fULL, 0x00018623fe060952ULL, 0x0001860cc5b71168ULL, 0x000185fed874dff7ULL,
+    0x000185d516a53bdbULL, 0x000185b9451230e4ULL, 0x000185b4a2872998ULL, 0x00018598d5958157ULL,
+    0x0001858f922693f9ULL, 0x000185536690ada8ULL, 0x0001853c470ead08ULL, 0x0001851bec5bfb2dULL,
+    0x000184f6f900a293ULL, 0x000184cd6f9c6d23ULL, 0x000184bafc819dc9ULL, 0x000184917feb8253ULL,
+    0x00018475dc727e8cULL, 0x0001845a3ce7bee9ULL, 0x0001844c6e9b7591ULL, 0x00018427a29c16b8ULL,
+    0x0001840775d4b7f2ULL, 0x000183d05a0aafe7ULL, 0x000183b9686a4147ULL, 0x0001839de3a54546ULL,
+    0x0001838b8d4d66c2ULL, 0x0001835928ccc92bULL, 0x0001834b6cc1570bULL, 0x00018346d8f4ee86ULL,
+    0x0001832ff796452eULL, 0x000182a6e81078ecULL, 0x0001829938a5f997ULL, 0x00018294a90eeafeULL,
+    0x0001828b8a3371b6ULL, 0x000182794dc6f384ULL, 0x00018254da16ee6dULL, 0x00018234fa8074ebULL,
+    0x0001821e3971ab1fULL, 0x0001821093b23780ULL, 0x000181da0658cc16ULL, 0x000181cc656b0739ULL,
+    0x000181b12672adcaULL, 0x000181884f349905ULL, 0x00018151e8543de0ULL, 0x0001814d6072f375ULL,
+    0x0001810977069006ULL, 0x000181006ac71d9dULL, 0x000180fbe4d0363bULL, 0x000180e0c342070fULL,
+    0x000180d333e9fdebULL, 0x000180bc9c76b431ULL, 0x000180b818178742ULL, 0x000180af0faaa126ULL,
+    0x0001808f758456deULL, 0x00018081ebe63549ULL, 0x0001805dd6e8f7e0ULL, 0x0001805954c3335eULL,
+    0x00018042cb9c64afULL, 0x00018030c631293dULL, 0x00017fff40005fffULL, 0x00017fd24572b9d4ULL,
+    0x00017fc4c922f71aULL, 0x00017fbbcc1f3873ULL, 0x00017f73f326b15eULL, 0x00017f667d76c3f2ULL,
+    0x00017f3e2211c403ULL, 0x00017f352b5b8d0aULL, 0x00017f30b028b1fbULL, 0x00017f27ba137802ULL,
+    0x00017f233f311737ULL, 0x00017f1a49bcc94dULL, 0x00017f086015e1daULL, 0x00017e941a212578ULL,
+    0x00017e74d8468b1dULL, 0x00017e43c43f7047ULL, 0x00017e3f4eb0223fULL, 0x00017e0e4864b0d3ULL,
+    0x00017de1c1f11e21ULL, 0x00017dcb829b653eULL, 0x00017db9b83483e4ULL, 0x00017da37d88a809ULL,
+    0x00017d9f0bb5d060ULL, 0x00017d91b6dc47c0ULL, 0x00017d88d4250cb5ULL, 0x00017d69bde5c688ULL,
+    0x00017d60dd0b041dULL, 0x00017d538c893fa6ULL, 0x00017d27318ebd90ULL, 0x00017d1e53cccd19ULL,
+    0x00017d1107efdbcfULL, 0x00017d0c9985a78aULL, 0x00017cf20532552eULL, 0x00017cd77493ffcaULL,
+    0x00017cca2da875edULL, 0x00017cafa29827ebULL, 0x00017c8c4443794eULL, 0x00017c87d8ef2dc2ULL,
+    0x00017c6d571d0da5ULL, 0x00017c5743154815ULL, 0x00017c459b4db96eULL, 0x00017c3cc807498aULL,
+    0x00017c2f8be23a76ULL, 0x00017c2b22b4f420ULL, 0x00017bed6cf8782aULL, 0x00017bd300a4b07dULL,
+    0x00017bc165221fdbULL, 0x00017bab650a77eeULL, 0x00017b9101e4d639ULL, 0x00017b8c9c648440ULL,
+    0x00017b83d1b216b6ULL, 0x00017b650f76736cULL, 0x00017b2799f1df38ULL, 0x00017b160e4f8326ULL,
+    0x00017b08e6a6829bULL, 0x00017b00220d030fULL, 0x00017afbbfe73407ULL, 0x00017af2fbe972f2ULL,
+    0x00017ae5d6af6c45ULL, 0x00017ae175254b7fULL, 0x00017ac72e090723ULL, 0x00017a485efc7c19ULL,
+    0x00017a3b4595d190ULL, 0x00017a1cb8827bd9ULL, 0x00017a06e90c5697ULL, 0x00017a028ca866daULL,
+    0x000179f578171d6bULL, 0x000179b8796752c5ULL, 0x00017972dc22db1fULL, 0x0001796a2a4822c8ULL,
+    0x0001792901223c8dULL, 0x00017917a4a07d63ULL, 0x0001790aa04baa81ULL, 0x00017901f33d951aULL,
+    0x000178f4f0681622ULL, 0x000178daed6e9e9bULL, 0x000178c0ee0be668ULL, 0x000178bc992a0cf5ULL,
+    0x000178b3efb2d6a4ULL, 0x000178a6f23f2f71ULL, 0x00017899f5b0d914ULL, 0x0001787babdffd9cULL,
+    0x000178591455a826ULL, 0x00017847caf2a0baULL, 0x0001780705e1941eULL, 0x000177fe64c1c1ccULL,
+    0x000177fa1457ddfdULL, 0x000177e483c27d9fULL, 0x000177d34512df68ULL, 0x000177c65718f2b4ULL,
+    0x000177bdb8f0d8c4ULL, 0x000177b0cc726642ULL, 0x00017778d5e83f1dULL, 0x000177703b4dca5eULL,
+    0x000177566ddbee1bULL, 0x00017752214be340ULL, 0x0001773ca3f5c334ULL, 0x00017715fbc0d648ULL,
+    0x000176fc3ab4b4e0ULL, 0x000176e27d31b70bULL, 0x000176bbe78cc568ULL, 0x000176b79e862c1bULL,
+    0x000176af0cc43ce6ULL, 0x0001769559d84c7fULL, 0x0001768439daf51fULL, 0x0001766a8cce55efULL,
+    0x0001765529f42178ULL, 0x0001762a6b932e31ULL, 0x00017621e0453c84ULL, 0x00017610cad4fafbULL,
+    0x000175eea4a23fb0ULL, 0x000175d50c136accULL, 0x000175c3fda67893ULL, 0x000175b733da3444ULL,
+    0x000175951e0054a3ULL, 0x0001758415682deaULL, 0x0001756eccd90da2ULL, 0x0001755545c71d17ULL,
+    0x0001753781f06854ULL, 0x0001752ac1bf24fbULL, 0x00017522421a33a9ULL, 0x0001751143f98e57ULL,
+    0x000174f7c9af4a28ULL, 0x000174ef4c5c7b87ULL, 0x000174c4df89df1cULL, 0x000174b8272c7adeULL,
+    0x00017463703d8cafULL, 0x0001745283795b19ULL, 0x00017430ae8e14ddULL, 0x00017424004b9750ULL,
+    0x000173d7fcde3646ULL, 0x000173d3c4b2fde5ULL, 0x000173c71cc46522ULL, 0x000173bead4a849bULL,
+    0x000173b206cb6b1bULL, 0x000173adcf7cb249ULL, 0x0001737f7569f3b2ULL, 0x0001735991677924ULL,
+    0x000173555c1a3903ULL, 0x0001734053062291ULL, 0x00017333b51ee5caULL, 0x000172e813b202cbULL,
+    0x000172cab2929264ULL, 0x000172b187996aafULL, 0x000172a924b36163ULL, 0x000172836c59d8c6ULL,
+    0x00017272ab1a92a3ULL, 0x0001726a4b0c6520ULL, 0x0001724cfdd5fed0ULL, 0x0001723812aa23b0ULL,
+    0x00017233e3e9f831ULL, 0x0001721efb93f33cULL, 0x0001720e4368bd23ULL, 0x00017205e7e4217eULL,
+    0x00017201ba4610a7ULL, 0x000171dc23f60b6fULL, 0x000171bac133fcd1ULL, 0x000171a1bb16bf24ULL,
+    0x000171848d919c8cULL, 0x0001716fb90458a3ULL, 0x0001715293637e45ULL, 0x0001714616f4a569ULL,
+    0x000171399b5de691ULL, 0x000170e251da5805ULL, 0x000170cd8f92f639ULL, 0x000170c11c20caecULL,
+    0x000170b4a985d081ULL, 0x0001708b319248efULL, 0x000170767917cf77ULL, 0x00017065e73002f7ULL,
+    0x0001704d0f1f7a05ULL, 0x00017044c7d89322ULL, 0x0001702bf43f58d0ULL, 0x00017006bd1f9684ULL,
+    0x000170029b04b8f8ULL, 0x00016fedf1e2d14eULL, 0x00016fd108ff29ebULL, 0x00016fabe43d99a8ULL,
+    0x00016f9744d6d30bULL, 0x00016f722bbe7d89ULL, 0x00016f61b13752d9ULL, 0x00016f55564a38e4ULL,
+    0x00016f4d1a225567ULL, 0x00016f304a7edc1dULL, 0x00016f23f2e41b67ULL, 0x00016f0f62ba1862ULL,
+    0x00016ed1c00bd242ULL, 0x00016eb503be4f0aULL, 0x00016ea8b46b9387ULL, 0x00016e9c65ec6326ULL,
+    0x00016e94320d13e5ULL, 0x00016e7b98a2cbf7ULL, 0x00016e2dc8956e3eULL, 0x00016e2599a87987ULL,
+    0x00016e2182551ba6ULL, 0x00016e1953f494edULL, 0x00016e0d0f1343adULL, 0x00016dfcb48397f8ULL,
+    0x00016de42f694d54ULL, 0x00016dcfc3006b2bULL, 0x00016dc3830cd1dfULL, 0x00016d9ec81dae0bULL,
+    0x00016d928b7193dcULL, 0x00016d2cb1a95a7fULL, 0x00016d207c9ef688ULL, 0x00016d1859b6c3cbULL,
+    0x00016d0c26088006ULL, 0x00016cf3c11e3025ULL, 0x00016ce37fa6ea75ULL, 0x00016ccf2fdb09c2ULL,
+    0x00016c8e3fb1524cULL, 0x00016c82153c4c10ULL, 0x00016c558080cc39ULL, 0x00016c517385cfdeULL,
+    0x00016c3d33f8af95ULL, 0x00016c24eaae1aaeULL, 0x00016c0082d02f02ULL, 0x00016bfc77b8c690ULL,
+    0x00016bf056fc81caULL, 0x00016be8419c9814ULL, 0x00016babacbd7e3fULL, 0x00016b9b8872787eULL,
+    0x00016b8f6e2ae77fULL, 0x00016b8354b1902aULL, 0x00016b5f0d1a165dULL, 0x00016b4ae8750849ULL,
+    0x00016b46e1656c5dULL, 0x00016b3ed38ac885ULL, 0x00016b26ac1f4658ULL, 0x00016afe718eb55aULL,
+    0x00016aea579ddf73ULL, 0x00016ada44777b57ULL, 0x00016aaa138e77d9ULL, 0x00016a9602f454eaULL,
+    0x00016a91ffe681bcULL, 0x00016a85f7456239ULL, 0x00016a59de75fa86ULL, 0x00016a4dd98e5948ULL,
+    0x00016a49d81929f1ULL, 0x00016a25cef67d67ULL, 0x00016a11ccfc09ecULL, 0x000169f9cd872935ULL,
+    0x000169f5cded8511ULL, 0x000169b9de84c9c5ULL, 0x00016995f1ff376eULL, 0x0001697e02f20cdaULL,
+    0x0001694636ce6cd4ULL, 0x000169423b2b770cULL, 0x0001693648c9764eULL, 0x0001692e524dd435ULL,
+    0x00016922613cdfcaULL, 0x000169068727379cULL, 0x000168fa98b7b4c8ULL, 0x000168e2be36325dULL,
+    0x000168cedfdd4b19ULL, 0x000168befc5c8adeULL, 0x000168b70b227e78ULL, 0x0001689f398d6134ULL,
+    0x0001686ba8e89c3bULL, 0x00016857d7a9eac3ULL, 0x00016847fea2fa41ULL, 0x0001683c1cc7ed7cULL,
+    0x0001681c70ff0ca4ULL, 0x000168187bea2ce4ULL, 0x00016804b3cfb93eULL, 0x000167e11de67720ULL,
+    0x000167c57546a2b9ULL, 0x000167b99c06202dULL, 0x000167b1b64a1b0eULL, 0x000167a5de567fa2ULL,
+    0x0001678a3ed0fd3dULL, 0x0001676ab24581f0ULL, 0x00016766c117bab9ULL, 0x0001675aee1333ddULL,
+    0x000167530c7ed454ULL, 0x0001673b69d48dd6ULL, 0x000167140c4b8bbbULL, 0x0001670c2dd2c1e9ULL,
+    0x000166e4daa2a280ULL, 0x000166dcfe3b372bULL, 0x000166d134455bd8ULL, 0x000166b9a2ac5863ULL,
+    0x000166b5b55fe69aULL, 0x0001666f14b0b37aULL, 0x000166673d7124ddULL, 0x0001665b7b367224ULL,
+    0x000166578ff97045ULL, 0x00016643f9117752ULL, 0x000166400e581093ULL, 0x00016614fe070c65ULL,
+    0x0001660557c0693dULL, 0x000165f99bf1354bULL, 0x000165e60f4d5013ULL, 0x000165ce9c8d301aULL,
+    0x000165b72cdf6b5cULL, 0x000165940b1bdd68ULL, 0x00016578bcba8663ULL, 0x00016549f6ead4a7ULL,
+    0x00016503e521e0f5ULL, 0x000164fc1dbdd12aULL, 0x000164d53ddea519ULL, 0x000164a6a2cb37aaULL,
+    0x000164933b1ac389ULL, 0x0001648797812260ULL, 0x00016483b67925f9ULL, 0x0001644d70e4dd7eULL,
+    0x00016441d1d91126ULL, 0x0001641ef941a5d9ULL, 0x0001640f7ebc9fedULL, 0x00016407c1fb460dULL,
+    0x000163fc277aa2d0ULL, 0x000163ecaffc4373ULL, 0x000163e1173f3f1dULL, 0x000163d95c820891ULL,
+    0x000163d57f43a87fULL, 0x000163be519078cfULL, 0x0001638848002154ULL, 0x0001636593a92b0aULL,
+    0x0001634a9a4d304fULL, 0x0001632bcb7971f4ULL, 0x00016310dae1d3eeULL, 0x000162ee3dd675f2ULL,
+    0x000162db05f36242ULL, 0x000162cba78a111eULL, 0x000162c0219ab32eULL, 0x000162b87365914aULL,
+    0x000162aceeb57bb8ULL, 0x000162a16ac4df18ULL, 0x0001629211587145ULL, 0x00016267e24759beULL,
+    0x00016250e41bb3dbULL, 0x0001624d0f5eadc9ULL, 0x00016239e8eb9e14ULL, 0x0001621775b9e6bfULL,
+    0x0001620bfb7bd0deULL, 0x00016208283c1d52ULL, 0x000161e5beb6a3efULL, 0x000161d2a36cc857ULL,
+    0x000161ced16a2fc7ULL, 0x000161b7e7160401ULL, 0x000161a4d0bee527ULL, 0x000161827a85b2eaULL,
+    0x000161457fe93b05ULL, 0x0001613a134360c8ULL, 0x0001613275e88e68ULL, 0x000161270a7de3ecULL,
+    0x0001611b9fd03da3ULL, 0x0001610c680e9c1bULL, 0x00016100ff19b859ULL, 0x000160f596e19bbaULL,
+    0x000160e2957cbbf7ULL, 0x000160bc98d63788ULL, 0x000160b1350945c8ULL, 0x0001609a6fa425c5ULL,
+    0x00016087780ec2acULL, 0x000160784d0f4d18ULL, 0x000160655925c37cULL, 0x0001604ad3e4c1b6ULL,
+    0x0001603f776f64f2ULL, 0x0001602c89a1e7d9ULL, 0x000160120cece9a5ULL, 0x0001600a7c4ff3e1ULL,
+    0x00016006b420ae1fULL, 0x00015fdd1f7501c6ULL, 0x00015fbb217c1195ULL, 0x00015fb75b011426ULL,
+    0x00015fa47bd146a8ULL, 0x00015fa0b5d2ba04ULL, 0x00015f992a13d174ULL, 0x00015f737434678bULL,
+    0x00015f6bea669a03ULL, 0x00015f68259ebe47ULL, 0x00015f2820b4e4cbULL, 0x00015f245d6117a5ULL,
+    0x00015f0dcb1bbdfcULL, 0x00015f02830f9a1bULL, 0x00015eefb7427013ULL, 0x00015eebf5240ac6ULL,
+    0x00015ed92bc11b59ULL, 0x00015eb75fecfdcfULL, 0x00015eac1d6df9c8ULL, 0x00015e91da6a8103ULL,
+    0x00015e7b5af681e6ULL, 0x00015e64de658d97ULL, 0x00015e3bac2ec01fULL, 0x00015e2cb398d52cULL,
+    0x00015e2179ff6415ULL, 0x00015e038e9540f0ULL, 0x00015df8579ee52fULL, 0x00015de964c9e30cULL,
+    0x00015de1ebd9f76dULL, 0x00015dcb82f44b83ULL, 0x00015dc04f95021bULL, 0x00015db16188e46bULL,
+    0x00015da9eafd302fULL, 0x00015d66ce66cd09ULL, 0x00015d5ba1798123ULL, 0x00015d507543325dULL,
+    0x00015d2b3c618b08ULL, 0x00015cfe9c306ac2ULL, 0x00015cf375ec5a32ULL, 0x00015cdd2b87347bULL,
+    0x00015cbbc145ea78ULL, 0x00015ca933acafc1ULL, 0x00015ca57dfde1f6ULL, 0x00015c92f2c2ef45ULL,
+    0x00015c62c5308fa8ULL, 0x00015c57a8df330aULL, 0x00015c3a0b7ce235ULL, 0x00015c2b3eaf0d26ULL,
+    0x00015c2025e80020ULL, 0x00015c18c0728f25ULL, 0x00015bec664aacc3ULL, 0x00015bcb2a16cf20ULL,
+    0x00015bbc66b418e5ULL, 0x00015ba643f97c5eULL, 0x00015b90241024bdULL, 0x00015b7db6499b3eULL,
+    0x00015b5c8f36ed5bULL, 0x00015b4678adef33ULL, 0x00015b42ca87ae3aULL, 0x00015b16a6d17109ULL,
+    0x00015b0f4c9fa7b5ULL, 0x00015af93fe89eb4ULL, 0x00015ad83216687bULL, 0x00015ac22c5f0cb1ULL,
+    0x00015aa87e91b4f6ULL, 0x00015a9629530371ULL, 0x00015a927ee870d4ULL, 0x00015a8b2a4ed775ULL,
+    0x00015a5f353782b8ULL, 0x00015a493eda2157ULL, 0x00015a2fa2f21203ULL, 0x00015a1d5a794a45ULL,
+    0x00015a12631e1827ULL, 0x00015a0ebb7c8f4fULL, 0x00015a03c50e839aULL, 0x000159fc767d41e4ULL,
+    0x000159f181377bf2ULL, 0x000159c20d0d6d52ULL, 0x000159bac1426eebULL, 0x000159afd025b99fULL,
+    0x000159a4dfba4c20ULL, 0x000159a13a688a01ULL, 0x0001597924f813b1ULL, 0x0001596a93d75fbbULL,
+    0x00015949d1cb2d1aULL, 0x000159428b123bc0ULL, 0x00015921d09d2575ULL, 0x0001591346d8ac28ULL,
+    0x0001590c026c0194ULL, 0x000158e06e4cc746ULL, 0x000158dccd1eb470ULL, 0x000158c707a4e1a6ULL,
+    0x000158b144ea9946ULL, 0x000158aa049e171bULL, 0x000158a664951f5eULL, 0x000158483e68d890ULL,
+    0x00015844a06e1af2ULL, 0x000158241608af79ULL, 0x000158193e9a1fbeULL, 0x0001581204b18eecULL,
+    0x000158072e665ff3ULL, 0x000157f183dc2a62ULL, 0x000157ede7b3b743ULL, 0x000157e313aec035ULL,
+    0x000157cd6db05587ULL, 0x000157bb657138efULL, 0x000157acf9ce8703ULL, 0x000157a5c471535eULL,
+    0x000157a229dfc0beULL, 0x00015776f0f16a29ULL, 0x00015764f1c375a6ULL, 0x00015761588dcdbbULL,
+    0x0001574f5ba311b0ULL, 0x0001574bc2e136f1ULL, 0x000157362feb22c4ULL, 0x0001572b677460bfULL,
+    0x0001570b122076c2ULL, 0x000156c34ddc7764ULL, 0x000156b88c9c6770ULL, 0x00015694b7fb867eULL,
+    0x000156781345b1d5ULL, 0x000156747f052dacULL, 0x0001565f071428faULL, 0x000156544c1e065cULL,
+    0x000156426b57b0beULL, 0x0001562cf9ad593eULL, 0x0001562966fe8067ULL, 0x0001562241da1bf8ULL,
+    0x000156178ab2bd78ULL, 0x000155fe8c9d934cULL, 0x000155e92373532fULL, 0x000155d3bcf73615ULL,
+    0x000155ac88080cb8ULL, 0x000155a1d83f18ccULL, 0x000155939992a966ULL, 0x0001558c7aae7980ULL,
+    0x00015588eb58e16cULL, 0x0001556c7357cf47ULL, 0x0001554c72025d45ULL, 0x000155371f1e93f5ULL,
+    0x000155339190430eULL, 0x00015528e956f358ULL, 0x0001550c815461fbULL, 0x00015501db8b9729ULL,
+    0x000154fe4f192595ULL, 0x000154f3aa333ea7ULL, 0x000154ec91f87a4fULL, 0x000154d74b0d944fULL,
+    0x000154a2255f0205ULL, 0x00015493fbfcf1bcULL, 0x00015477acc0dd1aULL, 0x00015474232e1032ULL,
+    0x0001545450535665ULL, 0x00015442a4dd9275ULL, 0x00015418440b3addULL, 0x00015414bc73ad9dULL,
+    0x0001540a261d8b39ULL, 0x000153dfd35bb9ddULL, 0x000153d8c696f44bULL, 0x000153d54050a4dbULL,
+    0x000153ae801ddad6ULL, 0x000153aafab7f66cULL, 0x0001538ed2295b4fULL, 0x0001538b4d6b903cULL,
+    0x00015380bfa22c2bULL, 0x0001536ba6072309ULL, 0x000153649e135110ULL, 0x00015344fde49d50ULL,
+    0x00015336f17b36fcULL, 0x0001532febb63236ULL, 0x0001531759cea633ULL, 0x0001531055586c7bULL,
+    0x000152f0c4dc3756ULL, 0x000152c6b8046cc8ULL, 0x000152bc366fc72fULL, 0x000152b8b60df719ULL,
+    0x000152ae3557b422ULL, 0x0001529cb59a63b5ULL, 0x0001529935df4655ULL, 0x00015287b84d516fULL,
+    0x0001524552009bebULL, 0x0001523ad870ec15ULL, 0x00015229649d16d2ULL, 0x00015210f8ae1bedULL,
+    0x00015206825c16a1ULL, 0x000151fc0cafd209ULL, 0x000151d23c771316ULL, 0x000151cb456f175aULL,
+    0x000151c7ca06ab5fULL, 0x000151b2e715fa1dULL, 0x0001519711d955c0ULL, 0x0001517ebb0778e9ULL,
+    0x00015162ee6368f4ULL, 0x0001514e17e98f45ULL, 0x0001514a9f154ff4ULL, 0x0001514035065856ULL,
+    0x0001512edb05d991ULL, 0x00015101c62b6410ULL, 0x000150fad7b934cdULL, 0x000150f7609b7c25ULL,
+    0x000150e297683668ULL, 0x000150d833c4ba34ULL, 0x000150d147083287ULL, 0x000150bc8287d2a9ULL,
+    0x000150aeab9e691eULL, 0x00015099eb623297ULL, 0x00015088a2797730ULL, 0x000150698a1c23f4ULL,
+    0x0001505f2dee8f30ULL, 0x0001504703ff4819ULL, 0x00015016ba897d6cULL, 0x00015013481b330fULL,
+    0x00015008f13ceb6fULL, 0x00014ff7b7344b85ULL, 0x00014ff44568d3a7ULL, 0x00014fed6208212cULL,
+    0x00014fd5486ef962ULL, 0x00014f9acf828ed2ULL, 0x00014f975f9e8065ULL, 0x00014f8d105e74a5ULL,
+    0x00014f674889091aULL, 0x00014f63d9b314efULL, 0x00014f52b0931cf7ULL, 0x00014f3aad263492ULL,
+    0x00014f33d15fa6ccULL, 0x00014f3063975097ULL, 0x00014f14f7dae685ULL, 0x00014f0743ab529dULL,
+    0x00014ef624034aa3ULL, 0x00014eebdea8bd01ULL, 0x00014ede2dd574f1ULL, 0x00014ecd1260376bULL,
+    0x00014ebf641158a2ULL, 0x00014eb88d553cedULL, 0x00014eae4bc12fa1ULL, 0x00014eaae0b396f2ULL,
+    0x00014e8f8aca1610ULL, 0x00014e854bb93663ULL, 0x00014e7b0d48fd30ULL, 0x00014e5c55bba4ebULL,
+    0x00014e293057b36fULL, 0x00014e1157727416ULL, 0x00014e07201ae952ULL, 0x00014e0050e41397ULL,
+    0x00014dcd47a0efc1ULL, 0x00014dc9e12a6bddULL, 0x00014db8e1e3cca6ULL, 0x00014da11902d0b0ULL,
+    0x00014d9a4df4388bULL, 0x00014d785ad11efbULL, 0x00014d6763d6cae4ULL, 0x00014d59d2b30923ULL,
+    0x00014d530a8b2570ULL, 0x00014d457b0f42d3ULL, 0x00014d26fc40e2c3ULL, 0x00014d20362a5cceULL,
+    0x00014d088306b14cULL, 0x00014cfe5bdb121aULL, 0x00014cf7976b5c18ULL, 0x00014ccf02931dfaULL,
+    0x00014cc4dee8b041ULL, 0x00014cbabbdc6655ULL, 0x00014c9c566bcee4ULL, 0x00014c7df68871d9ULL,
+    0x00014c7a96e34a66ULL, 0x00014c3de8f94d94ULL, 0x00014c33ce24298bULL, 0x00014c22f81e8796ULL,
+    0x00014c0b68f45f45ULL, 0x00014bf73a0b5b4bULL, 0x00014bf080494294ULL, 0x00014be66a28e900ULL,
+    0x00014be30d96549fULL, 0x00014bb0a92a4946ULL, 0x00014ba696eab860ULL, 0x00014b9fe06ca701ULL,
+    0x00014b9c8547b481ULL, 0x00014b9274412f66ULL, 0x00014b638236568fULL, 0x00014b4202082da7ULL,
+    0x00014b3b4f9bce3fULL, 0x00014b19d78d55d4ULL, 0x00014b05c5f6c6e0ULL, 0x00014addaa152c83ULL,
+    0x00014ac2f23a07d7ULL, 0x00014aa4e88b733cULL, 0x00014a90e51ecdceULL, 0x00014a798eda65a1ULL,
+    0x00014a6f8f762153ULL, 0x00014a68e5894f35ULL, 0x00014a54e95f950fULL, 0x00014a1faa15825cULL,
+    0x00014a0bb6c66eaeULL, 0x00014a01be065ad4ULL, 0x000149f120c79bc0ULL, 0x000149e3d7634f6fULL,
+    0x000149d33d27196bULL, 0x000149c947d04b9aULL, 0x000149ab6b6737caULL, 0x000149a81a5ba8dbULL,
+    0x0001498d9465ffedULL, 0x0001497662af13c3ULL, 0x0001496c72f2cb8cULL, 0x00014948090b427fULL,
+    0x0001493e1c1a7732ULL, 0x0001492a440451c9ULL, 0x00014926f5917ee9ULL, 0x00014909368509cbULL,
+    0x000149029b044845ULL, 0x000148f564ce8af3ULL, 0x000148c3e2f6d320ULL, 0x000148b0199936feULL,
+    0x000148a981ac28d2ULL, 0x00014895bb7b36ddULL, 0x0001489270039c1bULL, 0x00014881f7ab443aULL,
+    0x00014843709aea53ULL, 0x0001481f483b7aebULL, 0x0001481bff238d30ULL, 0x000148156d2638d7ULL,
+    0x000147fe7041e72fULL, 0x000147f497259dd8ULL, 0x000147e0e6b31e52ULL, 0x000147b98ce4ee69ULL,
+    0x000147b2fed84d7cULL, 0x000147afb7eb28dbULL, 0x000147a92a4334c0ULL, 0x000147923c87a7abULL,
+    0x0001477e97e24bfcULL, 0x0001476e3b251b52ULL, 0x0001476af597e4b3ULL, 0x00014750cb888d8fULL,
+    0x00014746fcd6c178ULL, 0x000147265019a370ULL, 0x0001471fc7ef6d9bULL, 0x000146ff23059555ULL,
+    0x000146db41f05974ULL, 0x000146c7b33622cbULL, 0x000146c470fc0420ULL, 0x000146bdecb9afd7ULL,
+    0x000146baaab17938ULL, 0x000146a71fdd638aULL, 0x000146835214e533ULL, 0x0001465c4bfe25c1ULL,
+    0x000146528bed896cULL, 0x00014648cc720d5aULL, 0x000146458cbf5aa2ULL, 0x0001463bce0a9f76ULL,
+    0x000146354f3a408fULL, 0x0001462b917dd520ULL, 0x0001462852601f0eULL, 0x0001461817c3b17bULL,
+    0x00014604a05cce91ULL, 0x000145f12b48c1ceULL, 0x000145e7719daa74ULL, 0x000145e433dafbb0ULL,
+    0x000145da7af5f38aULL, 0x000145c090be5050ULL, 0x000145b39d2e250bULL, 0x000145a9e72f0390ULL,
+    0x000145a36e2c9c3dULL, 0x0001458650d09e64ULL, 0x00014572eacce2aaULL, 0x0001455f8718e0ecULL,
+    0x00014548eb078791ULL, 0x0001454275df73c3ULL, 0x0001452f17f0f49aULL, 0x0001452569d716bcULL,
+    0x00014518829a10b7ULL, 0x0001450ed5d8547aULL, 0x000144f1d307503dULL, 0x000144e82892ddd1ULL,
+    0x000144d80dc286d5ULL, 0x000144c4bc7d7eb5ULL, 0x000144ae35e9754fULL, 0x000144a48f7a4a79ULL,
+    0x0001449e20d71746ULL, 0x0001449144546917ULL, 0x0001446deb2dba12ULL, 0x0001446448907ecbULL,
+    0x00014461127ca444ULL, 0x000144342412bd33ULL, 0x00014417483c2c72ULL, 0x0001441413ae6821ULL,
+    0x000143f73d8ca1f6ULL, 0x000143e73a94f913ULL, 0x000143dd9ff6098eULL, 0x000143c73964b393ULL,
+    0x000143b73b2b9eedULL, 0x000143b40883f069ULL, 0x000143a40c301985ULL, 0x0001438dad94c70aULL,
+    0x00014384184484a2ULL, 0x0001437420ac4efcULL, 0x00014370ef57e21cULL, 0x0001434dd4dfac2cULL,
+    0x0001434443573457ULL, 0x00014337822d6c3bULL, 0x0001432df1f72738ULL, 0x00014314742a7eb4ULL,
+    0x0001430158746f54ULL, 0x000142f49c91ce97ULL, 0x000142d19d0f5586ULL, 0x000142ce6eef654bULL,
+    0x000142c812dfa2daULL, 0x000142b1d2a183c4ULL, 0x000142953b65804eULL, 0x000142822eb887f0ULL,
+    0x00014278a93a020eULL, 0x0001425298de8074ULL, 0x00014249162f05ddULL, 0x000142393d9f1c55ULL,
+    0x00014236127efe9bULL, 0x00014223110d352eULL, 0x000142003ee40c48ULL, 0x000141e3c7157580ULL,
+    0x000141da4aeeec96ULL, 0x000141bab1223b5aULL, 0x000141b137675c71ULL, 0x000141a16dc2b3f2ULL,
+    0x0001418b5610103fULL, 0x0001418506b4dd56ULL, 0x00014181df1f0a00ULL, 0x0001417868bca2dfULL,
+    0x000141657da37f9cULL, 0x00014142d467f173ULL, 0x0001412cc9b1e459ULL, 0x00014119e77dfbdaULL,
+    0x000141139c95a978ULL, 0x0001410a2caf8c8cULL, 0x000140fd98599cccULL, 0x000140db0582027fULL,
+    0x000140d7e1415032ULL, 0x000140c82cea0709ULL, 0x000140b55688adc8ULL, 0x000140a8c8d7b78bULL,
+    0x0001406a131dd41fULL, 0x00014066f112f457ULL, 0x0001405d8b506dbcULL, 0x0001404de2f06ef6ULL,
+    0x000140415d574d11ULL, 0x0001403b1ae8b773ULL, 0x00013ff97022734bULL, 0x00013fda34774ce7ULL,
+    0x00013fd3f6105e3fULL, 0x00013fa20b9e15c8ULL, 0x00013f8f57b7539eULL, 0x00013f7fc3784b77ULL,
+    0x00013f766b404f8dULL, 0x00013f63bc740c39ULL, 0x00013f510fd7126cULL, 0x00013f4df3489745ULL,
+    0x00013f3e65690012ULL, 0x00013f31f500995dULL, 0x00013f28a15521cdULL, 0x00013f2269db0030ULL,
+    0x00013f15fba0b4e3ULL, 0x00013f0fc4e083f4ULL, 0x00013ee766e4b741ULL, 0x00013ecb7a941f26ULL,
+    0x00013ec546ba6b72ULL, 0x00013eb8dfc05954ULL, 0x00013e8d7eed9f20ULL, 0x00013e8434dbf8b5ULL,
+    0x00013e6859e6e6a2ULL, 0x00013e5f11ffadebULL, 0x00013e4c83d0a7c6ULL, 0x00013e496c53fb47ULL,
+    0x00013e39f7cb3552ULL, 0x00013e30b297f53dULL, 0x00013e276deef5cfULL, 0x00013e11cfd3595fULL,
+    0x00013e0260b08d11ULL, 0x00013defdd4da2c9ULL, 0x00013dda46be26a2ULL, 0x00013db54b74e7dcULL,
+    0x00013dac0dfac64dULL, 0x00013da5e54b1f5aULL, 0x00013d871d719065ULL, 0x00013d65487ef74cULL,
+    0x00013d62357e9b90ULL, 0x00013d468d2931b2ULL, 0x00013d406868725cULL, 0x00013d3731b983e2ULL,
+    0x00013d24c5f69041ULL, 0x00013d21b435fc00ULL, 0x00013d092854b73aULL, 0x00013ced8f81a589ULL,
+    0x00013cd81bf6b2b7ULL, 0x00013cceeb558c9cULL, 0x00013cc5bb3cdc01ULL, 0x00013cbf9b782fe8ULL,
+    0x00013cb66c42d36dULL, 0x00013caa2e251485ULL, 0x00013c8ea5d7c386ULL, 0x00013c8888341fdbULL,
+    0x00013c732253a938ULL, 0x00013c4551c17743ULL, 0x00013c3f36f2cfd1ULL, 0x00013c23c13b36a6ULL,
+    0x00013c178e71698bULL, 0x00013c085047fca4ULL, 0x00013c054406762bULL, 0x00013bff2bb08ea5ULL,
+    0x00013bf2fbb94919ULL, 0x00013be0b5898454ULL, 0x00013bda9e9c8292ULL, 0x00013bc85b3e0c1dULL,
+    0x00013bacfa25c608ULL, 0x00013ba9efa6fd04ULL, 0x00013b97b1e92f12ULL, 0x00013b888011df3bULL,
+    0x00013b857646f4a9ULL, 0x00013b6d2a0ab1cdULL, 0x00013b610553c48aULL, 0x00013b5af3520ed9ULL,
+    0x00013b2d73b6fef4ULL, 0x00013b2a6bacb025ULL, 0x00013b2153e7529fULL, 0x00013af6ebe7fd45ULL,
+    0x00013af3e4ea1e84ULL, 0x00013ae4c2d4319bULL, 0x00013ae1bc2fae96ULL, 0x00013ac68304cc5cULL,
+    0x00013ab7654ae8ccULL, 0x00013aa23e1d4b97ULL, 0x00013a9c33716279ULL, 0x00013a74f3bb1dd9ULL,
+    0x00013a6be66b30a4ULL, 0x00013a50c19b9e41ULL, 0x00013a4aba106932ULL, 0x00013a2c97d0544bULL,
+    0x00013a238eaa53f3ULL, 0x00013a1d88dae825ULL, 0x00013a117ded6572ULL, 0x000139f668b70118ULL,
+    0x000139f064a29f42ULL, 0x000139de59c783faULL, 0x000139b7495e8491ULL, 0x0001399342d91fa9ULL,
+    0x0001398d4290ce26ULL, 0x0001396f4498e90cULL, 0x0001394e4d74d5b2ULL, 0x0001394b4e9b0801ULL,
+    0x000139305b8671bfULL, 0x0001390f719c09c3ULL, 0x0001390c73f5d0e4ULL, 0x0001390678d54190ULL,
+    0x000138f488d288c1ULL, 0x000138f18bafe94eULL, 0x000138e8949fb857ULL, 0x000138df9e1302a6ULL,
+    0x000138d6a809bceeULL, 0x000138d0aef738dcULL, 0x000138c7b9c8ea03ULL, 0x000138b2d506240bULL,
+    0x000138acdd51bb97ULL, 0x0001388913df3f42ULL, 0x0001387732384045ULL, 0x0001386e42292936ULL,
+    0x00013853750cff01ULL, 0x000138507afd316eULL, 0x0001383e9fcf5d3eULL, 0x00013814fda96fbdULL,
+    0x0001380030c0079eULL, 0x000137fa3fdb22adULL, 0x000137f156f06203ULL, 0x000137e5768202c0ULL,
+    0x000137c4d1fbc41dULL, 0x000137bbec1df794ULL, 0x000137aa21e85874ULL, 0x0001378f766633c5ULL,
+    0x000137839d6a7d22ULL, 0x0001377db1432053ULL, 0x0001376017debdd4ULL, 0x0001375737bfcf0cULL,
+    0x000137514d4879ccULL, 0x000137486e0160a0ULL, 0x00013745790671fbULL, 0x0001372adebb0199ULL,
+    0x0001372201a483f6ULL, 0x0001371c1932aa9aULL, 0x0001370a6135ac75ULL, 0x000136f8ab3d3e8bULL,
+    0x000136ecddb66f28ULL, 0x000136c3956be45dULL, 0x000136babe36b4acULL, 0x000136aef562bbcbULL,
+    0x000136a03b9b7f70ULL, 0x0001369d49d1bb66ULL, 0x00013679f8b6b737ULL, 0x00013668532c0409ULL,
+    0x00013659a015f918ULL, 0x000136365e5b5d87ULL, 0x0001362a9f8f7949ULL, 0x0001361bf250bc4aULL,
+    0x000135fe9bfd98daULL, 0x000135ed0475a413ULL, 0x000135e4397151f5ULL, 0x000135d2a4e7c7e9ULL,
+    0x000135c1125cc303ULL, 0x000135bb374a7a9fULL, 0x000135a6ba48b75dULL, 0x000135952cb8838cULL,
+    0x00013572178fc5e7ULL, 0x0001354071daf9eaULL, 0x000135262fa27c42ULL, 0x0001351a85698861ULL,
+    0x0001350bf1df3035ULL, 0x00013503339b7de1ULL, 0x000134e8fbc80577ULL, 0x000134dd562ce524ULL,
+    0x000134d783b3a346ULL, 0x000134cbdf69ac40ULL, 0x000134b49977981bULL, 0x000134a03f2448ebULL,
+    0x0001349786f771b8ULL, 0x00013491b71f9deaULL, 0x00013488ffc4f1c7ULL, 0x0001346627464a5cULL,
+    0x0001346340415a08ULL, 0x0001345a8b86705eULL, 0x00013454bdfa66beULL, 0x0001344c0a112ba4ULL,
+    0x00013449238a0a73ULL, 0x00013431f147d55fULL, 0x000134293f555e29ULL, 0x000134208de07d53ULL,
+    0x00013403973ab753ULL, 0x000133e0dcd62a67ULL, 0x000133db13dda20fULL, 0x000133d82f763c91ULL,
+    0x000133d266d12cfbULL, 0x000133be2a457cfaULL, 0x000133b8629aad58ULL, 0x0001339e62c99f0dULL,
+    0x0001339b7f8609d8ULL, 0x00013392d60e8eedULL, 0x0001338184962b0bULL, 0x0001337bbf324f78ULL,
+    0x000133678e0963ffULL, 0x00013361c99ef54aULL, 0x0001335ee77e83fdULL, 0x00013344f6c977a5ULL,
+    0x0001332deb9c59b6ULL, 0x00013325484f85ffULL, 0x0001331ca57f0bdeULL, 0x00013319c4aa837aULL,
+    0x00013302bff74e2cULL, 0x000132e5fef110f4ULL, 0x000132dd5faf3cfcULL, 0x000132d4c0e96b59ULL,
+    0x000132a9ae4f088eULL, 0x000132a3f102342bULL, 0x00013298770d83faULL, 0x0001328fdc264d31ULL,
+    0x0001326d755d767cULL, 0x000132568a76a9b9ULL, 0x0001324df34255f3ULL, 0x000132455c8956f2ULL,
+    0x00013239e9a7ca35ULL, 0x00013228bef03954ULL, 0x000131fddc8fd366ULL, 0x000131f825af9864ULL,
+    0x000131de71627b7cULL, 0x000131c4c1669f03ULL, 0x000131b95820481aULL, 0x000131b3a3cedf3dULL,
+    0x0001318e94ed646aULL, 0x000131805684d880ULL, 0x0001317d7d6587b9ULL, 0x0001315e2c8df78cULL,
+    0x00013152caee4d0cULL, 0x00013144921814faULL, 0x00013130ab25dafaULL, 0x000131282464d197ULL,
+    0x00013122757d36a0ULL, 0x00013108e50965b9ULL, 0x000130fd89c41651ULL, 0x000130ec8271ed7dULL,
+    0x000130c4ce1654cbULL, 0x000130c1f8751303ULL, 0x000130b977e24769ULL, 0x000130b3cd1936b0ULL,
+    0x000130a2ce01b84bULL, 0x0001309a4f2bfb98ULL, 0x0001307858918203ULL, 0x0001306fdc19cf3bULL,
+    0x000130648c3690c6ULL, 0x000130566989171cULL, 0x0001303a281e0b3eULL, 0x000130239128c9b5ULL,
+    0x0001301846f029ccULL, 0x00012fedf811d870ULL, 0x00012fe5834efe2dULL, 0x00012fdd0f0495e9ULL,
+    0x00012fd76c6b356eULL, 0x00012fd49b329596ULL, 0x00012fc685e00b6bULL, 0x00012fb2d09ddae1ULL,
+    0x00012faa5f254babULL, 0x00012f9c4dbcb937ULL, 0x00012f6f51fbf8cbULL, 0x00012f506ca21de8ULL,
+    0x00012f372a063a40ULL, 0x00012f345bc59cf6ULL, 0x00012f2ebf6c41f8ULL, 0x00012f2bf1538385ULL,
+    0x00012f265549e2e2ULL, 0x00012f1b1dd60850ULL, 0x00012efc499ea513ULL, 0x00012ef1154708c9ULL,
+    0x00012ed7e2894f1dULL, 0x00012ec7185ee073ULL, 0x00012e9ff28da498ULL, 0x00012e9d2718b7b4ULL,
+    0x00012e86cd4ce6aeULL, 0x00012e760c1e96e8ULL, 0x00012e5cedd3a020ULL, 0x00012e49675f13fcULL,
+    0x00012e3b7696ff09ULL, 0x00012e226205aba9ULL, 0x00012e11abf4a94eULL, 0x00012e09519d9aa2ULL,
+    0x00012ddccceec270ULL, 0x00012dcee628fa31ULL, 0x00012dbb7207699cULL, 0x00012db31c74658eULL,
+    0x00012da539853eacULL, 0x00012da272afe207ULL, 0x00012d949149568dULL, 0x00012d91cac278e2ULL,
+    0x00012d89777c55d1ULL, 0x00012d6af4bedea6ULL, 0x00012d682efc0592ULL, 0x00012d62a39d7e86ULL,
+    0x00012d5a52f19a50ULL, 0x00012d4f3d6dc4a5ULL, 0x00012d4163ae73f0ULL, 0x00012d3914d81e30ULL,
+    0x00012d25b4016a51ULL, 0x00012d1d66b1e9f9ULL, 0x00012d17de135792ULL, 0x00012d07456ff65fULL,
+    0x00012cddcfd786e9ULL, 0x00012cbcad2f370bULL, 0x00012cb465a90cceULL, 0x00012cac1e97932cULL,
+    0x00012ca115e064d8ULL, 0x00012c98cfdf0c7fULL, 0x00012c934c1ee996ULL, 0x00012c908a5244a7ULL,
+    0x00012c8b06dfd211ULL, 0x00012c82c2153b04ULL, 0x00012c77bc66eff5ULL, 0x00012c6f78ac09f5ULL,
+    0x00012c6735658464ULL, 0x00012c48ed45ffbbULL, 0x00012c302b2aad35ULL, 0x00012c252b8a685fULL,
+    0x00012c1fac07a37eULL, 0x00012c1cec599732ULL, 0x00012c04317f011aULL, 0x00012bfbf41df908ULL,
+    0x00012bf6761da676ULL, 0x00012bf3b730cb5cULL, 0x00012bddc1991848ULL, 0x00012bc51125fcf4ULL,
+    0x00012ba9a7316ee5ULL, 0x00012b9bf41869a9ULL, 0x00012b93bc701a8cULL, 0x00012b8b853b2d41ULL,
+    0x00012b6277f3f9f3ULL, 0x00012b5fbbbc0b90ULL, 0x00012b4f53791672ULL, 0x00012b2911da606fULL,
+    0x00012b20e07e0c7aULL, 0x00012b18af9495d2ULL, 0x00012b107f1df307ULL, 0x00012b0dc4653f8dULL,
+    0x00012afd651ccf78ULL, 0x00012aefc1bef1f6ULL, 0x00012ae4d98c5927ULL, 0x00012acc52033cb2ULL,
+    0x00012ab3ce807c43ULL, 0x00012aae5c7d7a38ULL, 0x00012aa3790feac8ULL, 0x00012a8afc403b2fULL,
+    0x00012a7d63501a04ULL, 0x00012a7aab461fe3ULL, 0x00012a549fed356bULL, 0x00012a51e8a14958ULL,
+    0x00012a4454e38a98ULL, 0x00012a3154ed46c9ULL, 0x00012a2be7ab02ccULL, 0x00012a29311cd6f9ULL,
+    0x00012a0084b43b18ULL, 0x000129f042d8d7ffULL, 0x000129d279618e04ULL, 0x000129af4d245c76ULL,
+    0x000129a1c82f5733ULL, 0x00012996f84da169ULL, 0x0001298edce84dc4ULL, 0x000129815ae5547cULL,
+    0x000129768d5e918bULL, 0x00012960f4ab654dULL, 0x0001294e11a0ff0fULL, 0x00012945fa33f4a8ULL,
+    0x0001293de337a7ddULL, 0x00012930688d97c8ULL, 0x0001291d8bad24beULL, 0x0001291576e40203ULL,
+    0x0001291013f1c456ULL, 0x0001290d628b65b9ULL, 0x000128ffec47014fULL, 0x000128efc65df62fULL,
+    0x000128ed158d7d81ULL, 0x000128e50366f7d4ULL, 0x000128d790cafde9ULL, 0x000128cccf951ebeULL,
+    0x000128c76f44fdd4ULL, 0x000128c4bf2f9fdaULL, 0x000128b74f7fb53dULL, 0x000128946600ea05ULL,
+    0x00012876e1ec084eULL, 0x0001286ed6312630ULL, 0x0001286c27b65d62ULL, 0x0001285c11da6be3ULL,
+    0x00012843f4563325ULL, 0x0001283e98fa231aULL, 0x0001281bcbdbfafeULL, 0x0001281671f3935eULL,
+    0x0001280bbeb748f5ULL, 0x000127fe5fc24956ULL, 0x000127f65a907c5aULL, 0x000127e3a5778ce3ULL,
+    0x000127d64a217c57ULL, 0x000127d39e688421ULL, 0x000127bb9713258aULL, 0x000127b3957f65cbULL,
+    0x000127a63e7fb6aaULL, 0x0001278b941c5ff2ULL, 0x000127839521de55ULL, 0x0001277b96961cebULL,
+    0x0001277642767417ULL, 0x000127564dc142bcULL, 0x00012753a4575e62ULL, 0x0001274e51a86e20ULL,
+    0x00012743acdde618ULL, 0x0001273bb1c6e309ULL, 0x000127266ba55536ULL, 0x00012713d0cba87dULL,
+    0x000126fe9068ca0dULL, 0x000126e6aba1f417ULL, 0x000126e4043acd3fULL, 0x000126deb5912e48ULL,
+    0x000126cecab9af73ULL, 0x000126cc23c089e5ULL, 0x000126bee19a0649ULL, 0x000126bc3aea2816ULL,
+    0x000126b44723cc9cULL, 0x000126a460e0940aULL, 0x00012697224d5317ULL, 0x0001268f30874521ULL,
+    0x000126873f2ee57aULL, 0x0001266cc875588bULL, 0x00012664d8f7db17ULL, 0x0001265f8ee10778ULL,
+    0x00012657a01a037eULL, 0x000126256c6ee5b3ULL, 0x00012620249f408fULL, 0x000126183942c766ULL,
+    0x0001260863d14922ULL, 0x000125f5ecf46317ULL, 0x000125f0a6d929b5ULL, 0x000125e0d5aa1758ULL,
+    0x000125d64b277134ULL, 0x000125c91f144fc6ULL, 0x000125b95225f18aULL, 0x000125a986ea93a0ULL,
+    0x0001259f005f328dULL, 0x00012599bd61efe1ULL, 0x00012591d9408de9ULL, 0x0001257f7143856aULL,
+    0x000125724cf8791cULL, 0x0001256a6af5a4f1ULL, 0x0001255aa8352d77ULL, 0x0001255807e9e7f6ULL,
+    0x0001254ae7261240ULL, 0x0001253348bb5dbdULL, 0x00012530a9248294ULL, 0x000125190ef3723aULL,
+    0x0001250bf3d1ccd1ULL, 0x00012501788ee3efULL, 0x000124f45f892157ULL, 0x000124f1c1125968ULL,
+    0x000124e20b455ae3ULL, 0x000124dccf0b8aefULL, 0x000124ca7dba6bc9ULL, 0x000124a5e1f721b1ULL,
+    0x000124a344e76d6eULL, 0x0001248e5e17e1f7ULL, 0x0001248bc173ae8fULL, 0x0001247441c6f5dbULL,
+    0x0001246c6d641f9bULL, 0x0001245f61add9bbULL, 0x000124578e691ae2ULL, 0x0001244d20099005ULL,
+    0x000124384586034aULL, 0x0001242608c39c17ULL, 0x000123fefbf0e79dULL, 0x000123f1f9fc71f3ULL,
+    0x000123d7f98d4264ULL, 0x000123d02d864a1aULL, 0x000123c32fbcf8b8ULL, 0x000123a406917db5ULL,
+    0x000123a16e1ac798ULL, 0x0001237d1c76144aULL, 0x0001237a84b0a42bULL, 0x0001236af707f23bULL,
+    0x000123563cbbd43dULL, 0x0001234e77a1df7dULL, 0x000123441c2448a8ULL, 0x00012315898af240ULL,
+    0x000123105dba952eULL, 0x0001230606a6f142ULL, 0x00012300db63a566ULL, 0x000122eec56a3129ULL,
+    0x000122df46a77a1aULL, 0x000122d25e47eeecULL, 0x000122c80b9b6c36ULL, 0x000122b890f8590aULL,
+    0x000122b36875116fULL, 0x000122abac080051ULL, 0x000122a15c1a84f1ULL, 0x0001229c346a0444ULL,
+    0x0001229479390882ULL, 0x0001228270b57f5eULL, 0x000122661eb5306bULL, 0x0001225bd3b66671ULL,
+    0x000122541bf1e080ULL, 0x0001224ef6fe8ae8ULL, 0x0001224c6496604aULL, 0x0001223f893c8098ULL,
+    0x00012237d2f8e6bcULL, 0x0001221e210d02afULL, 0x0001221149cbc7f7ULL, 0x0001220704cf7bcdULL,
+    0x000121ff518c68f1ULL, 0x000121f79eb1ffe7ULL, 0x000121db67bac16eULL, 0x000121c4561cece7ULL,
+    0x000121c1c628f7d7ULL, 0x000121ad482ad275ULL, 0x000121a599aacc3bULL, 0x0001218c019bb312ULL,
+    0x00012186e3bd3857ULL, 0x00012165a5ff0509ULL, 0x00012160897b7d51ULL, 0x0001214ea71b0c29ULL,
+    0x0001213290fa6f79ULL, 0x00012120b4480469ULL, 0x0001211b9a33a3e8ULL, 0x0001210c4d0b0358ULL,
+    0x00012104a7122c83ULL, 0x000120fa75123729ULL, 0x000120f55c57489dULL, 0x000120edb7952b1aULL,
+    0x000120e6133a9043ULL, 0x000120c4fa5d47e1ULL, 0x000120b84196dba6ULL, 0x000120b5b65e682bULL,
+    0x0001209ed3669513ULL, 0x00012087f40f5fbeULL, 0x00012082df5d9251ULL, 0x000120805515d917ULL,
+    0x0001206c04742b01ULL, 0x000120697a93742dULL, 0x00012052a3afaa79ULL, 0x0001204d90de59d2ULL,
+    0x00012045f4fa132fULL, 0x0001203bd0699febULL, 0x00012036be65ea1bULL, 0x0001202f23b5f763ULL,
+    0x0001201fef8a2cf0ULL, 0x0001201d670022e3ULL, 0x00012015cda67078ULL, 0x0001200e34b35958ULL,
+    0x00011feac590aef5ULL, 0x00011fbabcac5504ULL, 0x00011fb5af321f2dULL, 0x00011fab94c5f767ULL,
+    0x00011f97620e747dULL, 0x00011f7695b031e6ULL, 0x00011f718a9a6eb6ULL, 0x00011f6f052089f6ULL,
+    0x00011f626a68e6baULL, 0x00011f534bcecf11ULL, 0x00011f50c6dcb8a3ULL, 0x00011f442ecbe76fULL,
+    0x00011f3a1c56b9bfULL, 0x00011f328ef57ca5ULL, 0x00011f25f98aa759ULL, 0x00011f16e14bce91ULL,
+    0x00011f145d68d454ULL, 0x00011f07caa3252bULL, 0x00011f054703d745ULL, 0x00011ee71efb4b3bULL,
+    0x00011ee218ece8e6ULL, 0x00011ebc711bddaeULL, 0x00011e9bd697f46bULL, 0x00011e94518709c1ULL,
+    0x00011e8cccdb20a3ULL, 0x00011e7641351f1bULL, 0x00011e6ebe1cecbaULL, 0x00011e673b699430ULL,
+    0x00011e4bb4e0faa6ULL, 0x00011e49348c15caULL, 0x00011e3cb38b6b4eULL, 0x00011e26347dd625ULL,
+    0x00011e05bc196f7aULL, 0x00011e00bdec7e1fULL, 0x00011dea484a4e4bULL, 0x00011de04e07994cULL,
+    0x00011dd8d2ca8c31ULL, 0x00011dd157f1bae4ULL, 0x00011dc2636cac3bULL, 0x00011dae752a52b1ULL,
+    0x00011da6fc88ea6dULL, 0x00011d9d06f7f7ceULL, 0x00011d891deb450dULL, 0x00011d81a73db36bULL,
+    0x00011d77b446f756ULL, 0x00011d63d06de0bdULL, 0x00011d615424a16aULL, 0x00011d2d2c20c66dULL,
+    0x00011ce544f10f0dULL, 0x00011cdb5cdd4f5dULL, 0x00011cd669159210ULL, 0x00011ccefbbc9ad5ULL,
+    0x00011ccc820a5110ULL, 0x00011cc78ec6c8c4ULL, 0x00011cbda8c3dd15ULL, 0x00011ca9dece591aULL,
+    0x00011ca273c7cc9cULL, 0x00011c89bc7c8998ULL, 0x00011c84cb8af02cULL, 0x00011c75f9bdaf77ULL,
+    0x00011c67297b900dULL, 0x00011c5fc1ee998cULL, 0x00011c50f3fcb860ULL, 0x00011c4e7c7ac534ULL,
+    0x00011c4227955e4fULL, 0x00011c3fb0552654ULL, 0x00011c384ad63274ULL, 0x00011c1d2f4f781dULL,
+    0x00011c1ab8b3673fULL, 0x00011c0e684b122eULL, 0x00011c07055c6decULL, 0x00011bfd2cb7321dULL,
+    0x00011bf5caadf2b7ULL, 0x00011be97d78e14eULL, 0x00011bd8465f46b2ULL, 0x00011bd0e64109ccULL,
+    0x00011bc98684e9a4ULL, 0x00011bc49c3dfcd6ULL, 0x00011bae801a0a84ULL, 0x00011ba4ad96ec6cULL,
+    0x00011b986767d9f4ULL, 0x00011b8e966c5e10ULL, 0x00011b7af67f29baULL, 0x00011b69ccc9ebecULL,
+    0x00011b5d8bb2b51fULL, 0x00011b5b186837b9ULL, 0x00011b4ed8967908ULL, 0x00011b4c658d0e96ULL,
+    0x00011b3db43833c2ULL, 0x00011b365c2010bbULL, 0x00011b3176f0cd69ULL, 0x00011b18ff8e18f1ULL,
+    0x00011b0cc57284abULL, 0x00011b02fe1f19eaULL, 0x00011ac37ef54093ULL, 0x00011ab9bcb13432ULL,
+    0x00011aad8ace997aULL, 0x00011aa63a2e4b65ULL, 0x00011aa3ca0e655bULL, 0x00011a979a106085ULL,
+    0x00011a8ddad3aa5fULL, 0x00011a81acb9ca9fULL, 0x00011a7a5e5e7d62ULL, 0x00011a731063eb54ULL,
+    0x00011a6953ac3ecbULL, 0x00011a5d28b84d3eULL, 0x00011a5ab9daec0aULL, 0x00011a3ff91bf02bULL,
+    0x00011a3d8abf4aeaULL, 0x00011a38ae2629b6ULL, 0x00011a316390db04ULL, 0x00011a2061ab75cfULL,
+    0x00011a1b861372c1ULL, 0x00011a1918578058ULL, 0x000119fbf6cac9bcULL, 0x000119ed6845e593ULL,
+    0x000119e88e6f17b6ULL, 0x000119c90a8c1362ULL, 0x000119b33d36abe0ULL, 0x000119ae65601597ULL,
+    0x000119a721ee2157ULL, 0x0001199630ae6916ULL, 0x00011971e96fc823ULL, 0x0001196aa91bfe3bULL,
+    0x00011965d3c3f040ULL, 0x0001195e940f8abdULL, 0x0001195c29935254ULL, 0x0001194198f9a2b0ULL,
+    0x00011937f145ea05ULL, 0x000119331dabafbaULL, 0x0001192be093dcb2ULL, 0x0001192976f6744eULL,
+    0x0001190eefee3a5eULL, 0x00011907b4b3176dULL, 0x000118fe10f8681aULL, 0x000118eacb7ec59dULL,
+    0x000118e3921f9aebULL, 0x000118d2b85e07ceULL, 0x000118cde83ca336ULL, 0x000118c6b059baffULL,
+    0x000118b10aeadad1ULL, 0x000118a76d21221cULL, 0x0001189901aec2e3ULL, 0x00011891cc83cedeULL,
+    0x00011883634a397bULL, 0x0001186695478cf5ULL, 0x000118429c14c890ULL, 0x0001182f70482ab7ULL,
+    0x00011825db5d9caeULL, 0x000117fd29c75ba2ULL, 0x000117f3984cb859ULL, 0x000117d94b9a632dULL,
+    0x000117d2204545a4ULL, 0x000117c167419d59ULL, 0x000117b5769ccc67ULL, 0x0001179ffb38a414ULL,
+    0x0001178f48329bd8ULL, 0x0001178a8320f35eULL, 0x0001177c34e5ee33ULL, 0x00011772ac397650ULL,
+    0x0001176de821aaa5ULL, 0x000117430a9b2ad2ULL, 0x0001173be6f6b50eULL, 0x00011734c3afaf16ULL,
+    0x0001173262acc4b3ULL, 0x000117267e39d5dfULL, 0x000117241d752babULL, 0x0001171f5c0af44fULL,
+    0x000117079765df76ULL, 0x0001170076cb3294ULL, 0x000116f9568db9dfULL, 0x000116ed76f6513fULL,
+    0x000116df38c94a4fULL, 0x000116d81a3e66b8ULL, 0x000116d5bacf7327ULL, 0x000116a64e9de7caULL,
+    0x0001169cd4837788ULL, 0x00011695b95beccdULL, 0x0001167494c32049ULL, 0x0001166d7ba90223ULL,
+    0x0001166b1e0a38b2ULL, 0x0001165ced29941fULL, 0x00011647a68ec87fULL, 0x00011642eca48e2bULL,
+    0x000116269485e5baULL, 0x000116160e73d974ULL, 0x0001160efa2a858eULL, 0x00011607e63d74a2ULL,
+    0x000115fc1b29f697ULL, 0x000115e488031641ULL, 0x000115d8bfef72d6ULL, 0x000115c8431b18f6ULL,
+    0x000115b56db2353fULL, 0x000115a4f50e9c9bULL, 0x00011592246ed09cULL, 0x0001158b16db2d48ULL,
+    0x00011581affa606fULL, 0x0001155768e78911ULL, 0x00011552b722c56bULL, 0x00011544a2c887c1ULL,
+    0x000115368fdc32a4ULL, 0x0001152f86ef2de0ULL, 0x0001152176274d24ULL, 0x000114e6ea40c158ULL,
+    0x000114d8e0d64259ULL, 0x000114d1dca99dc6ULL, 0x000114cd2f6918e3ULL, 0x000114c62bd429acULL,
+    0x000114bf289a37a5ULL, 0x000114b5cf851d82ULL, 0x000114aecd1f5f5eULL, 0x000114a31f3fc928ULL,
+    0x000114a0c9648e9eULL, 0x000114951cb3cd5fULL, 0x00011492c7151f39ULL, 0x0001147dc646d5f1ULL,
+    0x000114721c8a5feeULL, 0x00011461ca299b80ULL, 0x0001144f253b9635ULL, 0x00011445d3b6065dULL,
+    0x0001143ed6fb6f5aULL, 0x0001143a2eb14dc0ULL, 0x00011422e7997e6aULL, 0x0001141e4040720fULL,
+    0x0001141beca2faabULL, 0x000114104b262f74ULL, 0x00011409512080fcULL, 0x000113f90b1ce449ULL,
+    0x000113e421a0aa69ULL, 0x000113d884d69cb8ULL, 0x000113ac6d261907ULL, 0x000113a0d50bf0acULL,
+    0x0001138bf8eb6b3eULL, 0x00011389a7c45d7dULL, 0x0001137e1296b3b5ULL, 0x0001137bc1ab7bcaULL,
+    0x0001136ddcf97d70ULL, 0x000113693bb88aaeULL, 0x00011366eb27028dULL, 0x000113624a21d388ULL,
+    0x0001135217c951aaULL, 0x0001134b275d4009ULL, 0x0001133f977017b8ULL, 0x000113365832285fULL,
+    0x00011308254cc2cfULL, 0x00011301389a6357ULL, 0x000112ea26219e1dULL, 0x000112e5894d2f44ULL,
+    0x000112d7b3bd9668ULL, 0x000112ce7b79324eULL, 0x000112c791add00aULL, 0x000112a06b68fe02ULL,
+    0x0001129736d9aa99ULL, 0x0001127de97dd0d4ULL, 0x00011274b73e8548ULL, 0x00011266ed074c4aULL,
+    0x0001125b703d8e63ULL, 0x000112592432c0f5ULL, 0x00011246c53eb8f5ULL, 0x0001121697b0bce7ULL,
+    0x00011208d6ecfed1ULL, 0x000111ffac84196fULL, 0x000111e67b0cad13ULL, 0x000111dd52effda8ULL,
+    0x000111c427c8f598ULL, 0x000111bb01f79f10ULL, 0x000111b426014fb6ULL, 0x0001118d4e0ae938ULL,
+    0x0001118b05726daeULL, 0x000111842be3895aULL, 0x0001117f9b0a6544ULL, 0x0001116fa145a3d1ULL,
+    0x00011168c915d924ULL, 0x000111568a432443ULL, 0x000111544294a267ULL, 0x0001113b30977dc1ULL,
+    0x000111345b077dc4ULL, 0x0001112b3ecf9e90ULL, 0x0001110fedcce036ULL, 0x000110f6e85688c6ULL,
+    0x000110f0163084cdULL, 0x000110edd0373d21ULL, 0x000110e02d2b1b7aULL, 0x000110dba1c9ea97ULL,
+    0x000110d4d100c74bULL, 0x000110c4eb29048cULL, 0x000110c060b03246ULL, 0x000110b74c32a6cbULL,
+    0x0001109c125a41ccULL, 0x00011097893d7afdULL, 0x00011090bbdac078ULL, 0x00011089eeceec99ULL,
+    0x00011087aa88f48dULL, 0x0001106ebe041d8cULL, 0x00011058197fbfa3ULL, 0x000110514f471bcbULL,
+    0x0001104cc8a6d48bULL, 0x0001103cf2a51294ULL, 0x000110386cb207a6ULL, 0x00011031a40d9b3bULL,
+    0x0001102adbbfbaa1ULL, 0x00011021d133cf40ULL, 0x0001101b09afc667ULL, 0x0001100fbde92d0dULL,
+    0x00011008f74ba68eULL, 0x00010fffef00010fULL, 0x00010ff9292c06f4ULL, 0x00010fe71b4770a5ULL,
+    0x00010fd75116ad4bULL, 0x00010fd08d48566fULL, 0x00010fc9c9d02ee9ULL, 0x00010fb0fff89229ULL,
+    0x00010faa3e1247daULL, 0x00010f8f39d54b9cULL, 0x00010f6b3c8961f3ULL, 0x00010f647e1afde8ULL,
+    0x00010f5044d26c75ULL, 0x00010f4987bb04e5ULL, 0x00010f355276cf95ULL, 0x00010f2a19ba5494ULL,
+    0x00010f212035165cULL, 0x00010eff7dcb3e8fULL, 0x00010eeb538cdcd5ULL, 0x00010ee49b781b69ULL,
+    0x00010ed2b2371a12ULL, 0x00010ec544d42f1dULL, 0x00010ebe8ea287e8ULL, 0x00010eb1233eb65bULL,
+    0x00010eaee6cf2f1bULL, 0x00010ea831b95662ULL, 0x00010ea3b92f6117ULL, 0x00010e965074557fULL,
+    0x00010e8d60b4969dULL, 0x00010e86ad47efdaULL, 0x00010e6e1e3af345ULL, 0x00010e653122a966ULL,
+    0x00010e5e7fb36e3cULL, 0x00010e5a09986613ULL, 0x00010e4a6d628ac8ULL, 0x00010e3f480d6d34ULL,
+    0x00010e2b3a5ea8e1ULL, 0x00010e14f5c46ab4ULL, 0x00010e09d4d7a1c1ULL, 0x00010e079b2ad8e6ULL,
+    0x00010e00ee5cd26dULL, 0x00010dfc7b57bc89ULL, 0x00010dfa41e34538ULL, 0x00010ddb215d92fdULL,
+    0x00010dc722887e8eULL, 0x00010dc4e9f4f9f6ULL, 0x00010db9cf9fcaa9ULL, 0x00010db326a9c5b3ULL,
+    0x00010dac7e07f116ULL, 0x00010da5d5ba4694ULL, 0x00010d964e4c3979ULL, 0x00010d69f9c6ab40ULL,
+    0x00010d4f67a8852cULL, 0x00010d4d310d3c5cULL, 0x00010d48c3f29ad5ULL, 0x00010d3fea2d11c4ULL,
+    0x00010d32a49bf99bULL, 0x00010d2e3860b432ULL, 0x00010d181d663a76ULL, 0x00010d13b20a0f26ULL,
+    0x00010cf05c61d0bbULL, 0x00010cdc8046e423ULL, 0x00010ccadb88b6a9ULL, 0x00010cc43e5a3707ULL,
+    0x00010c9c96180f2eULL, 0x00010c93c7a02b25ULL, 0x00010c8d2d2740a6ULL, 0x00010c88c65a2743ULL,
+    0x00010c822c6bc10dULL, 0x00010c72c6828786ULL, 0x00010c6e6092edeaULL, 0x00010c67c7f0b2f5ULL,
+    0x00010c4b3645a2ddULL, 0x00010c449f5db3fcULL, 0x00010c39a4934235ULL, 0x00010c2a46fa489dULL,
+    0x00010c168814c7dfULL, 0x00010c0b910fc67aULL, 0x00010c04fd47c70aULL, 0x00010bfe69d2679dULL,
+    0x00010bef1301b8a0ULL, 0x00010be41f36b073ULL, 0x00010bdd8d5e15eaULL, 0x00010bd6fbd7f6f1ULL,
+    0x00010bc7a98a50aaULL, 0x00010bc11916f716ULL, 0x00010ba6da812115ULL, 0x00010ba27b3d87c3ULL,
+    0x00010b932ef0d507ULL, 0x00010b7b2849b1c6ULL, 0x00010b726cc1a5cdULL, 0x00010b6554873739ULL,
+    0x00010b5a6bfbe779ULL, 0x00010b51b296e186ULL, 0x00010b449d909793ULL, 0x00010b31006d9719ULL,
+    0x00010b261c26c213ULL, 0x00010b12837d8b70ULL, 0x00010b09cec93745ULL, 0x00010aefb413b298ULL,
+    0x00010ae4d51ef25eULL, 0x00010adc2364ba61ULL, 0x00010ad7cabdfe61ULL, 0x00010abdb9ce66b4ULL,
+    0x00010ab7365e2eaeULL, 0x00010aa3adf5fbadULL, 0x00010a9d2bcb532aULL, 0x00010a9b0079d8d7ULL,
+    0x00010a902869fb20ULL, 0x00010a6fa584b5baULL, 0x00010a6d7af0cec7ULL, 0x00010a62a6948c97ULL,
+    0x00010a607c36bdecULL, 0x00010a5c27962a32ULL, 0x00010a59fd5364b2ULL, 0x00010a2eb77ef86aULL,
+    0x00010a2c8df93bcaULL, 0x00010a0e4c58b65cULL, 0x00010a05a892cfefULL, 0x000109ff2e1ca59dULL,
+    0x000109f8b3f74005ULL, 0x000109e5476b709dULL, 0x000109dece88e2f4ULL, 0x000109d405c2840fULL,
+    0x000109c4ee24f9f4ULL, 0x000109c09e91ae9dULL, 0x000109ad3a35c34bULL, 0x0001098cee907822ULL,
+    0x0001097991bea0b6ULL, 0x000109776b2943b3ULL, 0x0001096a846463bdULL, 0x0001094a48f4038bULL,
+    0x00010943d79acf36ULL, 0x00010923a58de30aULL, 0x0001091f5b34626fULL, 0x0001090c0e596316ULL,
+    0x000108ff3201a020ULL, 0x000108fd0d6764d4ULL, 0x000108f8c44d8c2eULL, 0x000108e9c58a79baULL,
+    0x000108e358e06fe1ULL, 0x000108d8a4764760ULL, 0x000108d238a0e3f7ULL, 0x000108c9a955aef9ULL,
+    0x000108c33e3a3b61ULL, 0x000108b88c682238ULL, 0x000108abb829842fULL, 0x000108a994e8b1b9ULL,
+    0x000108a32b5b438dULL, 0x00010896592efd6bULL, 0x0001088baafcfe21ULL, 0x000108898840ae60ULL,
+    0x00010876512f020fULL, 0x000108720c6fad09ULL, 0x0001085cb6c3f8eaULL, 0x0001085872d82d24ULL,
+    0x000108520d388aa5ULL, 0x00010843214d8dbbULL, 0x0001083cbcb60075ULL, 0x00010836586da04cULL,
+    0x0001081eeb5e9dbbULL, 0x0001081888876ed4ULL, 0x0001081225ff4c83ULL, 0x00010809a31a0bfbULL,
+    0x000107f67e97a0faULL, 0x000107e35cdb944bULL, 0x000107d8bd179cc4ULL, 0x000107d69d3de5c2ULL,
+    0x000107cbfe80ab92ULL, 0x000107c9dedb7d06ULL, 0x000107c38020748eULL, 0x000107bf4124da1cULL,
+    0x000107b8e2ed0f03ULL, 0x000107ac27699794ULL, 0x0001079910725bd7ULL, 0x00010796f19f0317ULL,
+    0x0001078c58014133ULL, 0x00010783ddb9c545ULL, 0x0001077fa0ca6266ULL, 0x0001076c9044e0f2ULL,
+    0x0001076a7228bfadULL, 0x000107641808a621ULL, 0x0001075dbe36f792ULL, 0x0001075764b3ae55ULL,
+    0x0001074cd031b0afULL, 0x0001074459fff9d4ULL, 0x00010739c7059851ULL, 0x000107336f3e222dULL,
+    0x0001072069bd267dULL, 0x00010713bcee1bc9ULL, 0x0001070b4a67108eULL, 0x000106fe9fa0d81fULL,
+    0x000106f84ab2d777ULL, 0x000106f4123f8814ULL, 0x000106edbdd39663ULL, 0x000106defa070913ULL,
+    0x000106ce1c49834fULL, 0x000106cc00b8c770ULL, 0x000106bf5c0a1650ULL, 0x000106bb256a64cbULL,
+    0x000106b4d3bbb5b6ULL, 0x0001068cd577593eULL, 0x000106868602bf7cULL, 0x0001068036dbcb76ULL,
+    0x0001066f6544b23aULL, 0x0001065a624f7282ULL, 0x0001063cfd6b4855ULL, 0x00010628028732c6ULL,
+    0x0001061d86575fdbULL, 0x000106173c3b54faULL, 0x00010610f26c8d41ULL, 0x00010602476112eeULL,
+    0x000105fe16cf9168ULL, 0x000105e2de618f59ULL, 0x000105deaed12627ULL, 0x000105d009656756ULL,
+    0x000105c5943dc08fULL, 0x000105b2c377938bULL, 0x000105a422f4f1fbULL, 0x00010586e6d6e084ULL,
+    0x00010584d08270aeULL, 0x00010580a3f326c9ULL, 0x00010572090a3364ULL, 0x0001056159ff3e01ULL,
+    0x0001055f444432d7ULL, 0x00010542178739baULL, 0x0001053bd7ee7e35ULL, 0x000105338399db4eULL,
+    0x0001052d44b39b5dULL, 0x00010509e5e914bfULL, 0x0001050194c373b3ULL, 0x000104fd6c638310ULL,
+    0x000104eab8574d29ULL, 0x000104e8a4804df7ULL, 0x000104d806f9266fULL, 0x000104cfb900b453ULL,
+    0x000104c97edf32dbULL, 0x000104a002ed4c08ULL, 0x00010497b885825bULL, 0x0001048513098d6dULL,
+    0x00010480eea01a95ULL, 0x00010461e1bb9740ULL, 0x0001045bacd7a81fULL, 0x0001044f43f2fcd9ULL,
+    0x0001044d3294fc47ULL, 0x0001042e3203b951ULL, 0x00010427ff964fc0ULL, 0x0001041dac3288b3ULL,
+    0x0001040f38d4178aULL, 0x000103e5f80b73faULL, 0x000103d78adc9d0eULL, 0x000103cd3ddab650ULL,
+    0x000103cb2e8d052cULL, 0x000103bed36a6bd8ULL, 0x000103b4885e0f8aULL, 0x000103ac4cea8538ULL,
+    0x000103a82f62d965ULL, 0x0001039ff4b7ac7dULL, 0x00010399c90ee9f4ULL, 0x000103939db13c2bULL,
+    0x00010376d7318645ULL, 0x00010374c942532dULL, 0x00010370ad7ce902ULL, 0x000103645af47c74ULL,
+    0x00010355fc254edaULL, 0x0001034591bdd02fULL, 0x0001033d5d518be2ULL, 0x0001031e9d5af962ULL,
+    0x0001030e39f500cbULL, 0x000102fbcc9c7162ULL, 0x000102f9c09f9566ULL, 0x000102ef852b8144ULL,
+    0x000102dd1c30d64eULL, 0x000102d6f9c78765ULL, 0x000102b64728f6eeULL, 0x000102b23169d55cULL,
+    0x0001029fd1264c7cULL, 0x00010299b1a449eaULL, 0x00010297a7341cbdULL, 0x0001028b69402eb5ULL,
+    0x00010281368234f9ULL, 0x0001026edd332038ULL, 0x0001026cd36ff1eeULL, 0x00010266b657c6cfULL,
+    0x0001025c867eb273ULL, 0x0001024e44db593eULL, 0x0001023bf2c6b61dULL, 0x0001021f78423362ULL,
+    0x000102195ed26c1bULL, 0x000102113d5ad343ULL, 0x00010200fbf4f60dULL, 0x000101fef3ed168bULL,
+    0x000101fae3f5e82bULL, 0x000101e6960d1ab9ULL, 0x000101dc704b7b77ULL, 0x000101d452aa2710ULL,
+    0x000101c211dd3138ULL, 0x000101b7eefaf25fULL, 0x000101b5e8196323ULL, 0x000101abc62bff0aULL,
+    0x000101a3ab9a86b5ULL, 0x0001019f9e82b8e4ULL, 0x000101998b1c29c6ULL, 0x0001018d652b1980ULL,
+    0x0001018752a08df7ULL, 0x0001017316e3fea2ULL, 0x0001016f0b53258cULL, 0x0001016d0596ed02ULL,
+    0x00010166f4931116ULL, 0x00010162e963d2a5ULL, 0x0001014eb35f52feULL, 0x00010144998dbdd6ULL,
+    0x0001012a5a22921bULL, 0x00010118315dcd3aULL, 0x0001010e1bd33cf7ULL, 0x0001010c179ca05bULL,
+    0x000100f9f31d77a9ULL, 0x000100f3e784c305ULL, 0x000100e3c9fc1a8bULL, 0x000100d5b1ccef83ULL,
+    0x000100d1ab2cbf88ULL, 0x000100b7832ec66fULL, 0x000100b37d80c106ULL, 0x000100a56a9db7a7ULL,
+    0x0001009b5e11f4dfULL, 0x0001008f500db7a9ULL, 0x000100814121d20aULL, 0x0001007b3b3572aeULL,
+    0x0001007535917b7dULL, 0x0001007131f70e0dULL, 0x000100632657d3f6ULL, 0x000100591efbc587ULL,
+    0x000100571d9b0fb2ULL, 0x000100390cb3d40aULL, 0x0001002705f1e7daULL, 0x0001001101211332ULL,
+    0x0001000f00e10d2fULL
+};
+
+const Limb trialProduct[TRIAL_GROUP_NUM] = {
+    0xe221f97c30e94e1dULL, 0x6329899ea9f2714bULL, 0x58edcb4c9ed39c8bULL, 0x09966ff94fd516fbULL,
+    0x3bd7632c1f36eb51ULL, 0x00fd14b3c90d88a9ULL, 0x02ad3dbe0cca85ffULL, 0x0787f9a02c3388a7ULL,
+    0x1113c5cc6d101657ULL, 0x2456c94f936bdb15ULL, 0x4236a30b85ffe139ULL, 0x805437b38eada69dULL,
+    0x00723e97bddcd2afULL, 0x00a5a792ee239667ULL, 0x00e451352ebca269ULL, 0x013a7955f14b7805ULL,
+    0x01d37cbd653b06ffULL, 0x0288fe4eca4d7cdfULL, 0x039fddb60d3af63dULL, 0x04cd73f19080fb03ULL,
+    0x0639c390b9313f05ULL, 0x08a1c420d25d388fULL, 0x0b4b5322977db499ULL, 0x0e94c170a802ee29ULL,
+    0x11f6a0e8356100dfULL, 0x166c8898f7b3d683ULL, 0x1babda0a0afd724bULL, 0x2471b07c44024abfULL,
+    0x2d866dbc2558ad71ULL, 0x3891410d45fb47dfULL, 0x425d5866b049e263ULL, 0x51f767298e2cf13bULL,
+    0x6d9f9ece5fc74f13ULL, 0x7f5ffdb0f56ee64dULL, 0x943740d46a1bc71fULL, 0xaf2d7ca25cec848fULL,
+    0xcec010484e4ad877ULL, 0xef972c3cfafbcd25ULL, 0x002a442c1ebb3be5ULL, 0x00303fa164bdc919ULL,
+    0x0036521ca14fd8e7ULL, 0x003ca3241ed069e3ULL, 0x0043885d3035c59bULL, 0x004e1aee1fa9d559ULL,
+    0x0054469dbe5d6c77ULL, 0x005e49791f7429a1ULL, 0x006b2ceda4198e53ULL, 0x007339d26e3d1ce3ULL,
+    0x007e2ee3b8aa6bf3ULL, 0x008ae9bb5cda9301ULL, 0x0096e917373cdca7ULL, 0x00a211e4fecdf953ULL,
+    0x00b8ff2efb3033cfULL, 0x00cbaca970bdfe31ULL, 0x00db2c9f75b49027ULL, 0x00ed9fb524fe759dULL,
+    0x01007595a2312fc7ULL, 0x0111eccd0898675fULL, 0x012546177b06c0bfULL, 0x013e5b450710a16fULL,
+    0x0164d74c38c8e863ULL, 0x01836887063c20bbULL, 0x01ab250719364c7bULL, 0x01d1d99745c88d5bULL,
+    0x01ec730b953d1a27ULL, 0x02021f7b6341a9abULL, 0x021e792f0d4ca61dULL, 0x0249015c16a93885ULL,
+    0x026f0f9a480c48e5ULL, 0x029bc3143b9a5a89ULL, 0x02d26abb44109333ULL, 0x030a7492f008069dULL,
+    0x0343b19b9edc33a7ULL, 0x0385a3fb2c68b433ULL, 0x03c555b3dbe9ef83ULL, 0x0411e43a3a8d394bULL,
+    0x04775710b7a55833ULL, 0x04b76972a22d55a1ULL, 0x0507bfe226ee0079ULL, 0x056a838dee32fff3ULL,
+    0x05ac8589165200e9ULL, 0x05f667749eb2f963ULL, 0x065dd3fc17e3c099ULL, 0x06e031d955a9fef9ULL,
+    0x0742ec64b53bfdffULL, 0x07a5cbcb6bae243dULL, 0x07f7fcb28a3d7137ULL, 0x086be427bf5de82dULL,
+    0x08d9ca434d0399a5ULL, 0x09638c123bcab351ULL, 0x09db5cdd2505eabdULL, 0x0a7882ea2d1e207fULL,
+    0x0b1a70a51fba0b75ULL, 0x0bbabeb6f4cc2177ULL, 0x0c68a56113938121ULL, 0x0ce86607deddbe4bULL,
+    0x0daca6d46347064fULL, 0x0e6f9cb2334ec11fULL, 0x0f25ac800485a171ULL, 0x0ff8f0253a89a32dULL,
+    0x10ccedf304c329c1ULL, 0x11bab365a0306ad1ULL, 0x12bc79f95534c5d9ULL, 0x136918855651cae7ULL,
+    0x1441022b5202f195ULL, 0x1597271595caf351ULL, 0x16d6d391503c0abbULL, 0x180c60c57c2aa2ebULL,
+    0x1931ed2425952793ULL, 0x1a4ad806a56da143ULL, 0x1bab1dcc65ac15dbULL, 0x1d309fb6e722f0e1ULL,
+    0x1e414485a1b107bfULL, 0x1f9aa68df17c076bULL, 0x212b81780b580e97ULL, 0x23006478f7a04647ULL,
+    0x244664b9e9752837ULL, 0x26cb4c8923562f31ULL, 0x2885c6c7b07c160fULL, 0x29cdb8dbe624c3c1ULL,
+    0x2b4a321722f3b1efULL, 0x2ca3b94e7373f36dULL, 0x2efa302d0838fad3ULL, 0x30b3fdb20c872a5bULL,
+    0x33591223fefd974bULL, 0x35c12a863f50eaa9ULL, 0x383533808bd74477ULL, 0x3ac02a15fc89c54dULL,
+    0x3e12cc83606624f3ULL, 0x405f92575cd90b87ULL, 0x42211307d533e619ULL, 0x44b8a22c7f3df3c3ULL,
+    0x46d3dca711bbaec5ULL, 0x49a4f62f2bee3201ULL, 0x4d746a3fda9d6ec3ULL, 0x5024bb19621ceac3ULL,
+    0x528d8d1989f23337ULL, 0x55b4c3f0688fa659ULL, 0x599291b29311407fULL, 0x5cc7a1b4f6df9823ULL,
+    0x5f42cbfa215ab3fdULL, 0x616db4fe760c22b9ULL, 0x65ad151b5817da41ULL, 0x6c2e75f079f3deefULL,
+    0x706dd813a4085937ULL, 0x73edc48854faa299ULL, 0x77f1e576ffed49b9ULL, 0x7cc13fe542982693ULL,
+    0x80cedb56d0c02049ULL, 0x858f4783e6ff5cf3ULL, 0x892e6d86008f82e3ULL, 0x8d040c52d7c6ab79ULL,
+    0x90b53592209da955ULL, 0x954fb9d96ab9ea1dULL, 0x9caf15af4ce7fcf7ULL, 0xa47dbf171698939fULL,
+    0xa9712f0456e54591ULL, 0xaeed828a42377403ULL, 0xb68603f5eadb8545ULL, 0xbb2bd5d42428b71dULL,
+    0xc165b45b4e412e49ULL, 0xc8348a8471e75ca3ULL, 0xce5ab711e7179571ULL, 0xd4287981935f5b7fULL,
+    0xdb9c1eff1b938a91ULL, 0xe2e20afc369136ffULL, 0xe78c749d7a119695ULL, 0xedfa86764fa767e1ULL,
+    0xf7780828d01fcef9ULL, 0x0009311da8eb3ea1ULL, 0x00096fc1b51999b5ULL, 0x00099d2dc5aa820bULL,
+    0x0009c18c1a21f755ULL, 0x000a019a0d84ce05ULL, 0x000a3837104af50bULL, 0x000a74ba276e925bULL,
+    0x000ad0c05b3ae661ULL, 0x000b0da5211cc3e7ULL, 0x000b36ca8c3991afULL, 0x000b6694790c60dfULL,
+    0x000b89a345c48d7dULL, 0x000bb02a8b8a132bULL, 0x000bd6468bb171ffULL, 0x000c17671b548641ULL,
+    0x000c57f07d496e1bULL, 0x000c814b88200ac3ULL, 0x000cb958ba8e9259ULL, 0x000cfaa956d67517ULL,
+    0x000d56380a0e8273ULL, 0x000d9c8b65d94f5bULL, 0x000dc90a482debcbULL, 0x000e0ac9922e6235ULL,
+    0x000e4aa6969c4449ULL, 0x000eb0ca4d2b0965ULL, 0x000f08c969789d43ULL, 0x000f3c97c77c730fULL,
+    0x000f7aa31273931bULL, 0x000fd32e0bae7a77ULL, 0x00102419fda6cc01ULL, 0x001058b57cd1fec9ULL,
+    0x0010a468ac696a55ULL, 0x0010d824894d6521ULL, 0x001131219641c957ULL, 0x001186346cb9c4a7ULL,
+    0x0011e75887c6bcbfULL, 0x001226c3d8919ad3ULL, 0x0012ae54ca9118b3ULL, 0x0012f2143ddeb927ULL,
+    0x0013522200caeeb3ULL, 0x0013a21ad000a461ULL, 0x0013ef7c7f69a93dULL, 0x001436a05ef17841ULL,
+    0x00147142f4cc4c17ULL, 0x0014b887295ec96dULL, 0x001501b9fe3efaadULL, 0x00156d3ebd5cfffbULL,
+    0x0015af86361077adULL, 0x0015fc898c07b90fULL, 0x00167c836a7cdf2bULL, 0x0016db56bc574209ULL,
+    0x00174097de2edf3bULL, 0x00178dbdb0cfb9fbULL, 0x0017e109fd2af3fbULL, 0x0018716adbb946f7ULL,
+    0x0018d7bc2e97eaefULL, 0x00192e69d59ba8dbULL, 0x00198a3cddb561c9ULL, 0x0019e876c274e4fdULL,
+    0x001a63555c2e680bULL, 0x001ad58f177dacbbULL, 0x001b29f0db4b3395ULL, 0x001ba4b691e66139ULL,
+    0x001bfc87fc12613dULL, 0x001c3e250dac9d87ULL, 0x001c944c9149df3bULL, 0x001cff79f4c205cdULL,
+    0x001d75566cb1adb3ULL, 0x001e3cd7b5975575ULL, 0x001e92a4033b7417ULL, 0x001f0502cb33d8c7ULL,
+    0x001f8943169b2d87ULL, 0x001ffcaebc1a4badULL, 0x0020730086c8cb89ULL, 0x0020d7b89585d217ULL,
+    0x002147bfe14a8231ULL, 0x0021ae6440d699bfULL, 0x0022306f8188c6fbULL, 0x0022a5af39a69703ULL,
+    0x00235eedc5de5805ULL, 0x002441e04ba35085ULL, 0x0024b8a97a3a59a5ULL, 0x00252362655a4d67ULL,
+    0x0025ab86b8cc3567ULL, 0x00260aea245bc247ULL, 0x0026b855f8b70077ULL, 0x002750993dd1e65bULL,
+    0x0027bafa8c9f7853ULL, 0x0028402b9d2d22ddULL, 0x0028a66d2d4fc087ULL, 0x00298166c0739b53ULL,
+    0x002a40d5220cbed9ULL, 0x002ab7670bbab197ULL, 0x002b5b38f61706dfULL, 0x002c3429fa1e037fULL,
+    0x002ceda9fa3b4a9fULL, 0x002d7b4d561f2739ULL, 0x002e05d3caae9813ULL, 0x002eb7851a14c29bULL,
+    0x002f3e1d077d25cfULL, 0x003010f41dbeb6edULL, 0x00311729b61dd159ULL, 0x00318dceb77a5837ULL,
+    0x00321cd33785cdf1ULL, 0x0032fdf49691bc63ULL, 0x0033b1c5f5f30cedULL, 0x0034a6c59cb6d8d7ULL,
+    0x00355c9029e55dd3ULL, 0x0035fb2d1ac371b7ULL, 0x0036b44bc2249a47ULL, 0x003750e273f3b60fULL,
+    0x00385ce9399c0f85ULL, 0x00391ecbd93a9e67ULL, 0x0039cd91131ee8e5ULL, 0x003a887d9033256bULL,
+    0x003b77f83e7b7b77ULL, 0x003c5f7ed2eca1bfULL, 0x003d367feec26269ULL, 0x003debdb2f48a479ULL,
+    0x003eab0afe5d537bULL, 0x003fd435f4d431e7ULL, 0x0040b45ff452cb31ULL, 0x00420775fbceaf6dULL,
+    0x0042c7627aefc08dULL, 0x0043e44dcc615d67ULL, 0x0044c330cdfdeb7dULL, 0x00456af335c23b75ULL,
+    0x004610d2c7c0027bULL, 0x0047384e9bf4bfadULL, 0x0047fa259c013ba3ULL, 0x0048950fc7f50b43ULL,
+    0x004956836a576163ULL, 0x004a7b8c3c557b65ULL, 0x004b771e5db917efULL, 0x004c5834105e9dfbULL,
+    0x004d37df06ec25d9ULL, 0x004e3707bf47eca5ULL, 0x004f77e5a59ceea7ULL, 0x00503ced574122d5ULL,
+    0x0050f93a4e9e43e9ULL, 0x005242764cb96dbfULL, 0x005373ff17a4f379ULL, 0x00544ac8e491c7d9ULL,
+    0x005534b35cc8f027ULL, 0x0056405cd1d8f29bULL, 0x0056ee39496a06ddULL, 0x0057cf4552f1e303ULL,
+    0x0058b59c4b50c127ULL, 0x0059a507c3dbf24bULL, 0x005a92a6fbea27b9ULL, 0x005b7e66124ac799ULL,
+    0x005cab65d44446efULL, 0x005de6905c90b503ULL, 0x005f37e803c461fdULL, 0x0060383597fe3f4fULL,
+    0x0061e147bd94922bULL, 0x0062cb93e709f30fULL, 0x0063bb5109ddbb39ULL, 0x0064b4ccd52a2a97ULL,
+    0x0065a00fb544939dULL, 0x0066bd48d7520557ULL, 0x00684ac380bf1aafULL, 0x006975d3e0fb99e1ULL,
+    0x006a96fad34eb5c9ULL, 0x006b9092527de0b5ULL, 0x006cfda2f8b38f6fULL, 0x006e72811aacaeabULL,
+    0x006fd5b0d3d77ca9ULL, 0x00710c5f58855659ULL, 0x0072c045f81a9571ULL, 0x00740178628c8d1fULL,
+    0x007518d8f35a1ee9ULL, 0x0076a24bc5928fc9ULL, 0x00788a7d5fa3bc21ULL, 0x007a0a454ddc12d9ULL,
+    0x007b9b6dbf0acbfbULL, 0x007cb724b29c97e9ULL, 0x007d80316c3aea0bULL, 0x007e9f02956774f9ULL,
+    0x007fd78ff30e55ddULL, 0x008176f93dcdee1bULL, 0x0083328f181f37ffULL, 0x00844c85844f1ec7ULL,
+    0x00854fb5954cd2e9ULL, 0x00871ee1f72316edULL, 0x0088f30d5a797dc9ULL, 0x008a8f2c1377c21dULL,
+    0x008c01286e805837ULL, 0x008e7712e261c25dULL, 0x008ffb253ef4179fULL, 0x00921fbe50feef75ULL,
+    0x00948a2d689dccf3ULL, 0x0095ffe36390e923ULL, 0x0098301d5150c82fULL, 0x009965ca922eda71ULL,
+    0x009a81df9eec8585ULL, 0x009c4ff7ceb26e9dULL, 0x009e7b7d2e8d6945ULL, 0x009f6c20cfec7617ULL,
+    0x00a1123741d60349ULL, 0x00a2d85d546633e9ULL, 0x00a4576a38b2e863ULL, 0x00a67b26cfff14d5ULL,
+    0x00a7a939b6101c2dULL, 0x00a8bb9c6b89238bULL, 0x00aa21a4d7b7405dULL, 0x00abdd00ad8a3843ULL,
+    0x00ad89beafbcecf3ULL, 0x00af157a9999de1fULL, 0x00b1110edec9a5e7ULL, 0x00b2ec08779af98fULL,
+    0x00b5ce53e09d2f3fULL, 0x00b7c5c4781d9095ULL, 0x00b96f6c6a96abddULL, 0x00bafc6885e3168fULL,
+    0x00bd0b3001c2ab99ULL, 0x00bf1e4f7b977da3ULL, 0x00c0ee974c1790efULL, 0x00c212689f25e9f9ULL,
+    0x00c38c7410bf9f6dULL, 0x00c53d3b77e95ec1ULL, 0x00c6d6676a24b785ULL, 0x00c8dc92eb084079ULL,
+    0x00cab7c97e4138b7ULL, 0x00ccb801fca0605bULL, 0x00cf6d7cde4092fbULL, 0x00d18469c261e6c3ULL,
+    0x00d3b42996b0bdb9ULL, 0x00d51ddde8b08f41ULL, 0x00d67b51630925a1ULL, 0x00d99e59550f2a79ULL,
+    0x00dad6953d7f1dd1ULL, 0x00dcad7b308da3e5ULL, 0x00de2292a6fcea5dULL, 0x00e1b23855987db9ULL,
+    0x00e334f8b6afdf7fULL, 0x00e50a7b9858495bULL, 0x00e7e682b8bf2479ULL, 0x00eb233492811e73ULL,
+    0x00ecd06546792379ULL, 0x00ee614fd24f6a7bULL, 0x00f075d4fedaff7fULL, 0x00f3f7d1dd9b8379ULL,
+    0x00f634c782b06375ULL, 0x00f85e2efe701057ULL, 0x00fc35555b41ed55ULL, 0x00fe88c851df5e87ULL,
+    0x010178b05712fdabULL, 0x01037c79874034cfULL, 0x0105b3f595bfc677ULL, 0x0108bbdd3e80d6e1ULL,
+    0x010b6784171f41e3ULL, 0x010ebed7b345c171ULL, 0x0110dec33752e3fbULL, 0x0112f95df390c71bULL,
+    0x0115857cb9505c11ULL, 0x011896b488206dddULL, 0x011c980326aa39b7ULL, 0x011faf4ab1583fd9ULL,
+    0x01220baffbb4ec13ULL, 0x01242dedee2cf32bULL, 0x0127288318f1acbfULL, 0x0129a270b7054fd5ULL,
+    0x012b5a5ab872cdbbULL, 0x012e62cc7d0c5137ULL, 0x013143b94b078845ULL, 0x0135191659b6b873ULL,
+    0x01371e6d3f15a77bULL, 0x013ae591040c738bULL, 0x013ec8d38cf64eabULL, 0x014109a378f8e2a9ULL,
+    0x0143e60be9b7a323ULL, 0x0145a782e07019ddULL, 0x014851f13198d22fULL, 0x014b448a295b1a93ULL,
+    0x014cf066cc1eda97ULL, 0x01509b6a2d694463ULL, 0x0153888c5514c6bfULL, 0x01560307d2667eabULL,
+    0x015a1186ebaca99fULL, 0x015d54d0562da4a1ULL, 0x016089df1dbd1c67ULL, 0x01640c263de87b6bULL,
+    0x0167be6ae7200d73ULL, 0x016b77f2cf3a4d03ULL, 0x016e09542573e129ULL, 0x01707e77c14553e1ULL,
+    0x017336530b2481cdULL, 0x0176bbcd2b4de353ULL, 0x017971f613e8e371ULL, 0x017ced5a3630bb53ULL,
+    0x017fabf200521269ULL, 0x01826e128127b82fULL, 0x0186305ea4ff0fe3ULL, 0x0188b968d29ee5c1ULL,
+    0x018b8812e2614827ULL, 0x018e9d947c879fb1ULL, 0x0191690bbb2b8975ULL, 0x0195526af351eac3ULL,
+    0x0198dcb201afa47fULL, 0x019b71865d1e1edfULL, 0x019ec0fbad93d86fULL, 0x01a266b389d857f5ULL,
+    0x01a61de64de776a1ULL, 0x01abb0f12d9694b9ULL, 0x01b11732d0b9014fULL, 0x01b4e781862fadabULL,
+    0x01b8a6265810186fULL, 0x01bc8f38b80fb199ULL, 0x01c3d614a01edffbULL, 0x01c7a111ba35aac9ULL,
+    0x01ccda1918d36df1ULL, 0x01d1309b2051b287ULL, 0x01d5a81d615749b9ULL, 0x01d9827a0e604545ULL,
+    0x01ded6186cacf0d7ULL, 0x01e3263dbb001387ULL, 0x01e639e9f683f351ULL, 0x01ea1481cf59a2d1ULL,
+    0x01ee85125a17f4d3ULL, 0x01f5289e1464e911ULL, 0x01f80f97a33bc0d9ULL, 0x01fa2467e7455179ULL,
+    0x01fca5cf98eec3b1ULL, 0x01ff0ecab9e59fe5ULL, 0x02026ca9626f9bfdULL, 0x0206dea1a602ef35ULL,
+    0x020a61c911337f61ULL, 0x02106f2b1309f57fULL, 0x0216ded5b9ec5121ULL, 0x021abc8524a0867fULL,
+    0x021df720da2d9d25ULL, 0x0222c0b0bb7a24cfULL, 0x0227842c29f87a33ULL, 0x022c07daf1caec59ULL,
+    0x0230dae199d4b645ULL, 0x0234eafd67c98f85ULL, 0x023834e8b38660e1ULL, 0x023bda2835948899ULL,
+    0x024042e3fa45c223ULL, 0x0244fc4333cfb5b3ULL, 0x0247fee86550e3afULL, 0x024b6cf30ea5fd81ULL,
+    0x0250829b6a84c113ULL, 0x0255bf2f2306c361ULL, 0x025c535aa7f5e583ULL, 0x026080ca5a7bf2ebULL,
+    0x02637fdb127b46ffULL, 0x026797ccf79c7f3bULL, 0x026d1a1cccc73c99ULL, 0x0272c5771db4d6d3ULL,
+    0x0277ecdbc181828fULL, 0x027cdcb2258487a3ULL, 0x0283732b66cf18c7ULL, 0x028a8713fd082d71ULL,
+    0x028fc3a0a032e5d7ULL, 0x0292ded2e441da69ULL, 0x0297121fc782b77dULL, 0x029f0449cc9ff6f9ULL,
+    0x02a4a2f14e2c958bULL, 0x02a8db4d5b0fda85ULL, 0x02ae03469a82a673ULL, 0x02b332b7dc69b1c1ULL,
+    0x02b5e6b09d249fcbULL, 0x02bc0f821cc8c845ULL, 0x02c276373272a055ULL, 0x02c74ac5c4b2774dULL,
+    0x02cb22171da031a7ULL, 0x02cf6579f5c55f35ULL, 0x02d705e1bdb390bdULL, 0x02ddbf17895a6381ULL,
+    0x02e3aefe09c42de5ULL, 0x02e8206f28d20955ULL, 0x02ed7f117b2327dfULL, 0x02f56ed0c704da69ULL,
+    0x02f88a12f25e2451ULL, 0x02fd131b841b40b1ULL, 0x0301a1a0b3902ea9ULL, 0x03055925fc58d879ULL,
+    0x0309de5cadbca4e3ULL, 0x0310cbcfd2b0891bULL, 0x0317fd19f60c9a4dULL, 0x031ccf9af41ec199ULL,
+    0x03229c99f241a3a7ULL, 0x03280009db526951ULL, 0x032c8613eccace03ULL, 0x0333d47383a88d7bULL,
+    0x033b696baf7c3b81ULL, 0x0341c21d06927029ULL, 0x03463cca1724ea87ULL, 0x034af6afa696db8bULL,
+    0x034fa2000c8b112dULL, 0x03548d7a1e704565ULL, 0x0358b871e1453919ULL, 0x03612d7fb9ab9847ULL,
+    0x0369dbb728a0b841ULL, 0x036cd818cc2e1d29ULL, 0x03752221dd54d4efULL, 0x037bf7fb5fb2ff1fULL,
+    0x0383a4caed84ec9fULL, 0x0389eaa5e65bfe1bULL, 0x0391ecbfb00ee5edULL, 0x0397dd4ca7c7ff7fULL,
+    0x039fe1dbf447811fULL, 0x03a5cee3a2607503ULL, 0x03acac3998e6d409ULL, 0x03b13e26015d5acbULL,
+    0x03b5e9abe9445bb7ULL, 0x03bc87c44ef9f2c5ULL, 0x03c3c5b7f6157b81ULL, 0x03cb65b47f066d95ULL,
+    0x03d3d5d109d15d57ULL, 0x03db4be06422bb69ULL, 0x03e33b83348942e9ULL, 0x03e737ee74ba429dULL,
+    0x03eb4da6a8fa5c67ULL, 0x03ef5031b4a64affULL, 0x03f78b5f10a31a23ULL, 0x040044e6e9df0bb1ULL,
+    0x0405ac465f11236fULL, 0x040f4a65869d592bULL, 0x0416bae1b618a8e1ULL, 0x041c7e2175eeb881ULL,
+    0x042474524212fcc1ULL, 0x043035434b149aebULL, 0x043bf75cafffc64fULL, 0x0443ec2284e30c93ULL,
+    0x04481a26b0b4a839ULL, 0x044e41154dbb09fdULL, 0x04534e9617c28679ULL, 0x045b337d4d5597b9ULL,
+    0x04629139384abf75ULL, 0x046a8b710c183935ULL, 0x04708dbe7550d787ULL, 0x04783847cd1f9be3ULL,
+    0x047f0e02d972ed25ULL, 0x048525846d30850fULL, 0x048a62fb62958bafULL, 0x04951dac5bfc2c2bULL,
+    0x049baff49dd1395dULL, 0x04a1caf7e8af85b9ULL, 0x04a91c809afbf3bdULL, 0x04ae5fad1e34a8bfULL,
+    0x04b241c33541fc09ULL, 0x04ba406302aa23c5ULL, 0x04c2b08c52443cbdULL, 0x04cade5e4ef71c2fULL,
+    0x04da04bdd8627dedULL, 0x04e5315af79ba153ULL, 0x04ecd20879e358d7ULL, 0x04f42bc5897ea255ULL,
+    0x04fe0ed11aac86afULL, 0x0506888972068255ULL, 0x05112889cf60e287ULL, 0x051ed3c0c55d0405ULL,
+    0x052792aab8b41b8dULL, 0x05329df7da95e2cfULL, 0x053ca69e541e15a5ULL, 0x05464e0045860f6bULL,
+    0x054eeaf49a03e005ULL, 0x055954a13d821ddbULL, 0x05629617909d1ccbULL, 0x056972a7c7cbba43ULL,
+    0x057491e36248a513ULL, 0x058051adfc3bec21ULL, 0x05886b3e3c8cd9c9ULL, 0x05908dc3fded79e1ULL,
+    0x0599dbf2a16de5bdULL, 0x05a2fc0748851a6dULL, 0x05adfd2d9fdee11dULL, 0x05b60def667a0fb9ULL,
+    0x05bdce2eace2b75bULL, 0x05c8bb1c839ff683ULL, 0x05d231dc198f1875ULL, 0x05d9d1b5dc5e8d9fULL,
+    0x05eaf0a230b22005ULL, 0x05f30502c290b0a9ULL, 0x05f9d0e54c6a4117ULL, 0x060231a8be86c16fULL,
+    0x060aba05f0dbfd6dULL, 0x061632ff9c470defULL, 0x061f2dfa454376ffULL, 0x0629c973f7ac0095ULL,
+    0x063492798845b205ULL, 0x064027252c0e1469ULL, 0x0647b3d0049db59bULL, 0x065124cd727a8597ULL,
+    0x065a00ed27265351ULL, 0x06646784a070a66bULL, 0x067285a1f9072bbfULL, 0x067ba4bb61b64513ULL,
+    0x0684eeab37910a39ULL, 0x068ee60abfb360bdULL, 0x0698657a2e761ac9ULL, 0x06a18b98618e9ddbULL,
+    0x06abc52aedaeb23dULL, 0x06b7bc304578a6c5ULL, 0x06c0c02e48fcf58fULL, 0x06c9467d22461b09ULL,
+    0x06d5caa4124b2953ULL, 0x06e34db23f109eefULL, 0x06f1d49ce730cb7dULL, 0x06ff5f5416393a93ULL,
+    0x0709bf8d69085151ULL, 0x070f27d3bacd0f31ULL, 0x07144dccf94d4105ULL, 0x071ee789a0a32a21ULL,
+    0x072d634246a579f1ULL, 0x0737462bb96e8fa5ULL, 0x07405f283b642771ULL, 0x074b06cdd98b2da3ULL,
+    0x07552bfbdf57e395ULL, 0x07609dccaa8ad539ULL, 0x076da8d969c008abULL, 0x0775affd2b471325ULL,
+    0x077f705c488c0067ULL, 0x07923231ed9bccbfULL, 0x07a2f068c5b37579ULL, 0x07ad4be7563471c9ULL,
+    0x07b8d989812915e1ULL, 0x07cd7c923b55ef0dULL, 0x07da107b9d77d701ULL, 0x07e5f69cdc834fc7ULL,
+    0x07f3b0acd71dbb55ULL, 0x07ff8deed331654dULL, 0x0810b32fa0809eebULL, 0x082133690c7663fbULL,
+    0x082d436d737e0e43ULL, 0x0838514396a42251ULL, 0x083ed920a3c25b47ULL, 0x0847124796f30fbbULL,
+    0x084df13ebd3538ddULL, 0x0859e3c5fbd6e1ddULL, 0x086afb9927bb2323ULL, 0x0876e650d72e9c91ULL,
+    0x0880878df71efee5ULL, 0x088dc919e33faadfULL, 0x089be30a3c1550f7ULL, 0x08a66dd76a1c60a1ULL,
+    0x08b2bf40d71ad8c9ULL, 0x08c4d8ed4609f921ULL, 0x08d70d8938e6b855ULL, 0x08e4ddc1ad35d0a9ULL,
+    0x08f11f02fbfec4a1ULL, 0x0906870cb12b0519ULL, 0x09104e69442a8cb9ULL, 0x091e0c440e516489ULL,
+    0x092d55af4933d6e7ULL, 0x0938105d2262175dULL, 0x0941d56b0465f463ULL, 0x094b227ee9ada823ULL,
+    0x095320ff468b4333ULL, 0x095c258661c7e56bULL, 0x0966b2cc6595b7c5ULL, 0x0973fae5ef6bca33ULL,
+    0x09815126d1c98139ULL, 0x098eb5a020a4d6b3ULL, 0x099db10d83de0847ULL, 0x09aadb69da0214e9ULL,
+    0x09b973fbfc7d90dfULL, 0x09cdd1b23230138bULL, 0x09d9ca4999f21551ULL, 0x09eadc4431af0b85ULL,
+    0x09fe208a9b5975b9ULL, 0x0a08ae56cd1f05d9ULL, 0x0a14dbe044bc968bULL, 0x0a2003eda8bed3a1ULL,
+    0x0a31cc37f97e0a49ULL, 0x0a40fc81b5af1213ULL, 0x0a4f29108d61fe95ULL, 0x0a5c21788f7d9b31ULL,
+    0x0a675615f79bd38dULL, 0x0a751eb13c4d642dULL, 0x0a8b5c2842cb1bd9ULL, 0x0a9d245c82c7e0bfULL,
+    0x0aa9a8768636bff3ULL, 0x0aba4aab66d9c3d3ULL, 0x0acbbe6d193c87d3ULL, 0x0ae046d4cb540dfbULL,
+    0x0af5dc5c08f0b8cdULL, 0x0b064652f3d0ae53ULL, 0x0b12c5dd98f8b673ULL, 0x0b262c03f517c40bULL,
+    0x0b3d5033fcfcf135ULL, 0x0b5181f699c1e587ULL, 0x0b62527e162ded35ULL, 0x0b6b6f6ea453b007ULL,
+    0x0b7844a668b3d19bULL, 0x0b8813b13de1f9d1ULL, 0x0b97c048948bc509ULL, 0x0ba7e24057ee9bcdULL,
+    0x0bb8ad133ed044cfULL, 0x0bcabaafabd0e6fdULL, 0x0bdf76c56a6992b9ULL, 0x0bf5e9a67f6b7c45ULL,
+    0x0c0401be20d91bcdULL, 0x0c1460092afbf4a7ULL, 0x0c26d6a65f868769ULL, 0x0c3e4c684a0df1bbULL,
+    0x0c4d0d11f2a55c53ULL, 0x0c58f921cdb0e5b3ULL, 0x0c70173703ff0c97ULL, 0x0c832cb78ce310dfULL,
+    0x0c904afb2b7fc7b1ULL, 0x0c9a5074b1bba0e1ULL, 0x0cae6d0d66686141ULL, 0x0cbfe44fcefbcf8bULL,
+    0x0cd6162d6dde9fb9ULL, 0x0ce8906e9fad99d7ULL, 0x0cf88da85928d19dULL, 0x0d0cad6993c065ddULL,
+    0x0d187e5c2c780933ULL, 0x0d24c5b8899d6cd9ULL, 0x0d356a0936a05ea3ULL, 0x0d3f2b12d27abdd5ULL,
+    0x0d4f089584461fefULL, 0x0d5ebdaf02c952fbULL, 0x0d743407e2ec94a3ULL, 0x0d8ca0385ff641d5ULL,
+    0x0da931441a3ce247ULL, 0x0db88a3d86b5db3dULL, 0x0dc7efdb7bd853c7ULL, 0x0ddf3d4e9a84bb9fULL,
+    0x0df1050820194285ULL, 0x0e06f05b64511f6fULL, 0x0e14527fe1d37b15ULL, 0x0e2943860ab731f5ULL,
+    0x0e44b74a88f68ff5ULL, 0x0e59a380f7e4e393ULL, 0x0e7ea49b73860a37ULL, 0x0e90c862d15d605fULL,
+    0x0ea428bc8f289135ULL, 0x0eaf664f3753362dULL, 0x0ebee521ab07d961ULL, 0x0ed5852da9f77a99ULL,
+    0x0ee74489707ef657ULL, 0x0efb377ce800db03ULL, 0x0f10ad4fa8a5366fULL, 0x0f21ac769b565831ULL,
+    0x0f308f2216a7d205ULL, 0x0f3c989bab6a0bf9ULL, 0x0f4bcce29eb7e503ULL, 0x0f5b891605357af1ULL,
+    0x0f739743ecd0f13fULL, 0x0f84aa8b52361023ULL, 0x0f97c23bbed23c73ULL, 0x0fa5822f78eff60fULL,
+    0x0fb5c262904a100fULL, 0x0fcf375e051de179ULL, 0x0fe51106bb0bee91ULL, 0x10013fb2f7f2db43ULL,
+    0x100ec50bc1b7bba3ULL, 0x10225b7cc443bb33ULL, 0x103f5cad7105cd19ULL, 0x1052dee99018b007ULL,
+    0x1065efe6e67f8751ULL, 0x1074373acf0c7821ULL, 0x1086e23806074fa7ULL, 0x10991974e9276851ULL,
+    0x10ac67d021dd830fULL, 0x10c78b4b943072d9ULL, 0x10d8ede9af16dcdfULL, 0x10f22f821fdea315ULL,
+    0x1112e8c602838acfULL, 0x1124425e3e79a837ULL, 0x112fda950440fb83ULL, 0x114760c52cc569a9ULL,
+    0x1161a77775f54e83ULL, 0x11755fae6c914b83ULL, 0x118bd5f74d794c77ULL, 0x11a14ea87a234f77ULL,
+    0x11ace13d6c882d71ULL, 0x11b9d30e4e1c9f41ULL, 0x11c4e72120e26857ULL, 0x11e86f502bb23e71ULL,
+    0x1200f821c5fd16ddULL, 0x120f302c10203aadULL, 0x1222ee3667d72ccdULL, 0x1238639e63cf19b1ULL,
+    0x124f074837d92bddULL, 0x12664e8f1d129405ULL, 0x1283ccc65f6120f1ULL, 0x12a1ffe05c404f51ULL,
+    0x12c959e280de5b31ULL, 0x12e085b68b5456a5ULL, 0x12f9305eb7cacff3ULL, 0x131317e1874667b9ULL,
+    0x1324cda19cb225ddULL, 0x13376b8faef70b43ULL, 0x1348a6a0a7196637ULL, 0x135d63a9dccb1adbULL,
+    0x137c53cf0d9e1fd5ULL, 0x1397a0a76be476d1ULL, 0x13a8d1cd9dce5d97ULL, 0x13b9784c19d0ff31ULL,
+    0x13d6c7e94e666f89ULL, 0x13ebabdd7382011fULL, 0x14072163e5932791ULL, 0x14193397ca154fa3ULL,
+    0x14330ea1c95b4b09ULL, 0x14458ae57c30909dULL, 0x146af5fac8ae48cfULL, 0x147f19ed8a8cbee5ULL,
+    0x14986eee12ac7965ULL, 0x14b6b60ca3ba7e75ULL, 0x14dfc96fd3edd9fbULL, 0x14fb4f87ffc35ff3ULL,
+    0x150d1a0df903884bULL, 0x151f8d5aafdd108fULL, 0x1534364a9c4858f1ULL, 0x155db4c4154deaf5ULL,
+    0x157a55e18e5e1a15ULL, 0x159301bc493e6323ULL, 0x15a8efceece8de67ULL, 0x15c8613d7d751ab3ULL,
+    0x15df19c5e6ccfc97ULL, 0x15fbe9c83b2da9f5ULL, 0x161886b2c45d36b1ULL, 0x16278229a321fc6bULL,
+    0x164300c36ab9f6cfULL, 0x166557394eb730a1ULL, 0x16a4aaac86d9fa91ULL, 0x16bff5f7ba08e451ULL,
+    0x16d8bdb7060d38f9ULL, 0x16eff6524286bb57ULL, 0x170addbd57b9ff93ULL, 0x172928f769cc1df3ULL,
+    0x1742468e7793bc2fULL, 0x17542b2f43136357ULL, 0x176d6a71e4ac0223ULL, 0x178b16da0c5424d9ULL,
+    0x17a731aa13f057e9ULL, 0x17cc257da82b6935ULL, 0x17ec329319a5223fULL, 0x1807f6aae9c04173ULL,
+    0x181f0f9810736237ULL, 0x183c5d0efecf2c1fULL, 0x18667302c65fc8e1ULL, 0x188a8ee0f58580efULL,
+    0x18a04ab71e6406e1ULL, 0x18bb484dccf50815ULL, 0x18d17df797560b49ULL, 0x18eae50767ef567fULL,
+    0x190aab7f180e3455ULL, 0x1923e531a51d6b0dULL, 0x193b6f1c68019bd7ULL, 0x195a18bc6d973449ULL,
+    0x196b0fb913ac70c9ULL, 0x19870d4201292493ULL, 0x19a7688f161f86c5ULL, 0x19c06132887e40e9ULL,
+    0x19d12f92d19ddb9fULL, 0x19efa89c74bbeae9ULL, 0x1a0c70af91e4f689ULL, 0x1a27814b4fcc9fd3ULL,
+    0x1a4efc2ae5cb5d51ULL, 0x1a7819589ee792e3ULL, 0x1a9496fdd7829cdbULL, 0x1ab6ac4b1769bd09ULL,
+    0x1ade0c8ba088cb73ULL, 0x1af9613fac05ae5fULL, 0x1b0f3ad4058a7001ULL, 0x1b34016e029e21fbULL,
+    0x1b5b8bcb79588a9bULL, 0x1b73e0ca779b1cb5ULL, 0x1b8a041cf99db477ULL, 0x1ba0352398431071ULL,
+    0x1bb0095dfcaa4ac5ULL, 0x1bd026b1d8977bf7ULL, 0x1bee18de4108106dULL, 0x1c136016ebec8059ULL,
+    0x1c502c5df1e51bafULL, 0x1c70d4a4e3c05b61ULL, 0x1c8ee5d305b9ffddULL, 0x1cb7e642a043d7a9ULL,
+    0x1cddf897099e74c9ULL, 0x1cf7b04f784f67b1ULL, 0x1d2123313f7ce825ULL, 0x1d5889c6e2f4da3bULL,
+    0x1d7c75ca389c574dULL, 0x1d96973a0deaf819ULL, 0x1db6c101aba39b5fULL, 0x1dd69f59a9086663ULL,
+    0x1def6384038b9da3ULL, 0x1e0b04b5148559c1ULL, 0x1e44ecc2bea40fd9ULL, 0x1e6406756b964ba7ULL,
+    0x1eabdebcc9aad8e5ULL, 0x1ec9a4803083dab3ULL, 0x1ee98cbb85d5356bULL, 0x1f06449d8c41ae03ULL,
+    0x1f23103362ebd2a3ULL, 0x1f360728362b87f3ULL, 0x1f53c758f09530ffULL, 0x1f7da7650bf245e9ULL,
+    0x1fa1063756db0073ULL, 0x1fc3abe578297009ULL, 0x1fe23d13cc2e1cf7ULL, 0x2005f01254c526a5ULL,
+    0x203593fffa82c52fULL, 0x205cf064922a5679ULL, 0x207889ce9f2362ebULL, 0x209809aa725cc34bULL,
+    0x20b6c5b7f7d68cf7ULL, 0x20d673675c0c21b7ULL, 0x20e80a623ca467adULL, 0x211ffe853012c315ULL,
+    0x213eaba3b3289c2fULL, 0x215a654ae4c9876fULL, 0x217f519a7f42c959ULL, 0x21a8ba33a1ee8cd7ULL,
+    0x21d24af8567b56edULL, 0x21f9cdd1e1e12009ULL, 0x22272ff3d1773357ULL, 0x2252fa2dcde67249ULL,
+    0x227b5fa2a071ec63ULL, 0x229f007b40525197ULL, 0x22c4871429382cf3ULL, 0x22ec6adb20d27e1dULL,
+    0x23011610f0bec4b1ULL, 0x2319655ee88c1555ULL, 0x234771fe97ec5045ULL, 0x2375396f02387c5bULL,
+    0x239b6d24c0281db7ULL, 0x23c73b1c16dc5423ULL, 0x23effd4cd9ff62a1ULL, 0x240f3812a94ecf9dULL,
+    0x242d9b6f6dd0bbf5ULL, 0x245a673c1e12bc47ULL, 0x24841c78e5ddf73bULL, 0x24cc45e98e1d6b15ULL,
+    0x2507b4ad4c0eacdbULL, 0x2531feae9b882527ULL, 0x2552fce38bea781bULL, 0x25731de209fcc34bULL,
+    0x259fa9bd13764207ULL, 0x25c5b2461ffb0693ULL, 0x2603427d5db949c1ULL, 0x263a65726cea8517ULL,
+    0x2661da7987d450c3ULL, 0x2688f262d993940dULL, 0x26a2969a3d763b43ULL, 0x26c38eff06b1d877ULL,
+    0x26ee5952670c861fULL, 0x2718c9ef8c4a6d91ULL, 0x274d2c7760f4842bULL, 0x27700ba8e99e00b1ULL,
+    0x27a3c7d92da9a68fULL, 0x27c95b1e9cc5080fULL, 0x27ea90c6b973e651ULL, 0x2805e30933795e93ULL,
+    0x281dc6c7fe1061d7ULL, 0x283fb0c90250fdb3ULL, 0x287f409487395565ULL, 0x28aefeeb1070dcafULL,
+    0x28d54e48939c5e0bULL, 0x290df5307a074d5bULL, 0x29391b84faca9565ULL, 0x295f49590a53a55bULL,
+    0x2990500d9c729537ULL, 0x29a340abe899502dULL, 0x29c2886d44169ac7ULL, 0x29eb2464cc37f105ULL,
+    0x2a26788781a885f7ULL, 0x2a52ff25e3d7c8c3ULL, 0x2a866cbd1e34ca6dULL, 0x2ab1aeeb82a0b25bULL,
+    0x2acffcd4a168d547ULL, 0x2af9e424a75879d3ULL, 0x2b129069c7923465ULL, 0x2b3b9a953d99ea99ULL,
+    0x2b632b512b1b9c7fULL, 0x2b8a51367febc0bfULL, 0x2bccac9412f3ea05ULL, 0x2bf308818eecb7f5ULL,
+    0x2c106610f2e737dfULL, 0x2c399aba85dec765ULL, 0x2c69619008c910f7ULL, 0x2c93e984b4ebbccdULL,
+    0x2cbfa4b630567687ULL, 0x2cde7e8a52b76bc9ULL, 0x2d06a316c33fad15ULL, 0x2d1d77d92b0d9ec1ULL,
+    0x2d393c57f42abfdfULL, 0x2d74bf0dda61aec5ULL, 0x2da61090e6d71d5dULL, 0x2deb5eb2dea21859ULL,
+    0x2e13a9d36daa766fULL, 0x2e2b722d65c4cbe1ULL, 0x2e4e5ad1d996eb2fULL, 0x2e7b59ded7d215b9ULL,
+    0x2ea996ffa4f5a98bULL, 0x2ecde6049aaba871ULL, 0x2f1004c8edc165f5ULL, 0x2f37efbeb8ca38afULL,
+    0x2f6083f022cee93bULL, 0x2f93623651a40f73ULL, 0x2fbf99442a98a9fbULL, 0x300101a7424195c9ULL,
+    0x304063d4183416fbULL, 0x307a45e2c38d0371ULL, 0x30bc6e66d8af9957ULL, 0x30f75249979da803ULL,
+    0x313f372dbc62e593ULL, 0x316f8073e677f381ULL, 0x31ac3395f9757cb9ULL, 0x31f57245fa15bfc7ULL,
+    0x321e9abc4804959fULL, 0x323e6bc8be97ba97ULL, 0x326a1e30f9ca3c33ULL, 0x32a84f48c3b1a9b1ULL,
+    0x32ecaedc1a557da3ULL, 0x3305206a86fe7279ULL, 0x33523d398fcf1557ULL, 0x33a353c928e6db19ULL,
+    0x33d4c35c0f2246adULL, 0x33f42e4baf989285ULL, 0x342061cda1c321abULL, 0x3447d476ea088969ULL,
+    0x3479b8bc8ca91175ULL, 0x349c7c3bc2bccc47ULL, 0x34d868b3ee6beb53ULL, 0x35017e72a826e039ULL,
+    0x3540383d6d21d365ULL, 0x35548f5f702b3023ULL, 0x35a7fe8d910f7ae5ULL, 0x35e570c3fdcf7b2fULL,
+    0x3644ca98fbe420e5ULL, 0x3673171f631e5671ULL, 0x3698b666fb5c43e9ULL, 0x36c2cf76bdd4fa7fULL,
+    0x3706e074fc2367e3ULL, 0x37271aa4046e4f9dULL, 0x375e350cccf22babULL, 0x379249ede9f5d59bULL,
+    0x37ca58a32a133bd3ULL, 0x37fb86f50d9671d9ULL, 0x3833e49f095765fdULL, 0x3869356c05878e8bULL,
+    0x38a09b4d61e58fb3ULL, 0x38c94a7acdff110dULL, 0x3913c4a5e305648bULL, 0x396a44f658ea6dc9ULL,
+    0x3995fea74f7123a7ULL, 0x39d0383f216e0291ULL, 0x3a19bb67271bc921ULL, 0x3a584fd321943afbULL,
+    0x3a8887a785ff1c61ULL, 0x3aacef3b3f63a7dbULL, 0x3aef4b30be712d3bULL, 0x3b31340ba01cd36dULL,
+    0x3b7f6238614f24bfULL, 0x3bb85e4adb858115ULL, 0x3bee254f1d442051ULL, 0x3c3190a24fe5be09ULL,
+    0x3c6904edbbe52585ULL, 0x3ca767ade6e732e5ULL, 0x3ce295e0cb9e57d3ULL, 0x3d2e5472ade057c1ULL,
+    0x3d5138be5b8a89f3ULL, 0x3d967cbd1a219a69ULL, 0x3de91a22cd2a4a71ULL, 0x3e28a5839a464aa1ULL,
+    0x3e7430ed9be40b0fULL, 0x3ea9055bc28e4c1bULL, 0x3eea8ad31ac5effbULL, 0x3f1e43c0085937bbULL,
+    0x3f5704fd98d83a7dULL, 0x3f9d4c825e02f34dULL, 0x3fd5af13fabf1775ULL, 0x40132abeb4791047ULL,
+    0x4073a1008f8cfacbULL, 0x40a405f751e50ab3ULL, 0x40d81700673988a5ULL, 0x4114ddf1e4614fa7ULL,
+    0x4154b0e607d36591ULL, 0x419288329b38fd25ULL, 0x41c5b7b73351a2bbULL, 0x41f3f56dacb55d7bULL,
+    0x423751787ca6f6a9ULL, 0x426ff76f899b6ef9ULL, 0x42ae98fce8af70bdULL, 0x42e03c738ae281fdULL,
+    0x431fe76f82bef75fULL, 0x438be0e0ece10b55ULL, 0x43f56aa543e484b3ULL, 0x443990478ecf09e7ULL,
+    0x44743f40a7ad7675ULL, 0x44967b84768962c1ULL, 0x44f5421613e2fe0bULL, 0x454c2a69a8cd73a7ULL,
+    0x4577bda5ccc4596fULL, 0x45b3376739bc2e39ULL, 0x45ef99e1bf3070b1ULL, 0x4629dd6de3fc433bULL,
+    0x467b0e94dae0dfc1ULL, 0x46b5aaf5f6458cffULL, 0x46e4f4d635e33dcfULL, 0x4727791a4673c2f5ULL,
+    0x4764cc5994261ec5ULL, 0x479e6e548afbae8fULL, 0x47e174f8fc0a7071ULL, 0x480d77cf7490f137ULL,
+    0x485d331b9abcc2b1ULL, 0x488edebeeebfb0c1ULL, 0x48d41c16eee6241fULL, 0x49279c7f9fe4b3b1ULL,
+    0x495cd2c17fb66835ULL, 0x499548a1d2b37465ULL, 0x49efbbd6d5e4e6c3ULL, 0x4a4823d466b53307ULL,
+    0x4a8d05eef29f1cbdULL, 0x4ad612f3fe563c45ULL, 0x4b29b22e3ea0de3fULL, 0x4b77fdc6f6cb3b5bULL,
+    0x4bc0e8b994a8f7ddULL, 0x4c16e9437c87212fULL, 0x4c535c8eeefa8859ULL, 0x4c9f548a27cad889ULL,
+    0x4cc8a2a52266909fULL, 0x4d0240da058db975ULL, 0x4d49d65a36ab2b1dULL, 0x4d94e297350efce9ULL,
+    0x4dd6519ee568fd71ULL, 0x4e364b8496f402a7ULL, 0x4e7c41bd8d4fd0b1ULL, 0x4eaa70f74507c651ULL,
+    0x4ee0f9ca60a3cffdULL, 0x4f1e4112f6925cc9ULL, 0x4f64cd37f573116bULL, 0x4fd96c139d8671efULL,
+    0x501a9cb15df9a3efULL, 0x5047d57a5aaecb8fULL, 0x509868ab95c5f627ULL, 0x50d2794cd19f3dd5ULL,
+    0x511bdb5ba9931db7ULL, 0x51511e48e23f3e31ULL, 0x518fcd7b94d8af5dULL, 0x51e9dad846c63161ULL,
+    0x5241a1ec6cbdd66fULL, 0x52836ed08b80a8c1ULL, 0x52c1f55ef9b5d037ULL, 0x52fe0acad2c9b4cfULL,
+    0x5348e4cb70fb570dULL, 0x538fa1ed137d3181ULL, 0x53d6889a188a7f7dULL, 0x542efe0045fbf099ULL,
+    0x54780a311c46cf01ULL, 0x54cc9e5fe38d9edbULL, 0x550ff015217315edULL, 0x55544b50c9567fe9ULL,
+    0x558abd57db593e41ULL, 0x55dbb7cc14644bcdULL, 0x56394cfdff13b789ULL, 0x56710dd9c9fb125fULL,
+    0x56cc72ed04af83f5ULL, 0x570e48df1173dce1ULL, 0x574d961f96c7e9fbULL, 0x5786c365fc34e0cfULL,
+    0x57b631ed0c844691ULL, 0x5811aeddaf81b35dULL, 0x5873c6069d7a6b3fULL, 0x58c500e50b21f7abULL,
+    0x590e4c4de504b359ULL, 0x5955f34cc109d03bULL, 0x599cdc47bf347457ULL, 0x5a0123e220f50347ULL,
+    0x5a6796bd80c15923ULL, 0x5aa8b51e9444ddf1ULL, 0x5aebcecef2d064e3ULL, 0x5b53f3dd52f1f909ULL,
+    0x5bcb456a19f18b9fULL, 0x5c2f86cb926b4b43ULL, 0x5c92399429da2ccfULL, 0x5cdecc4c3b32acf3ULL,
+    0x5d2e5c7c9c2f3091ULL, 0x5d8785a1dbe8c8b3ULL, 0x5dcd261587de99d7ULL, 0x5e37c2eb695e3379ULL,
+    0x5e9299a6406d57cdULL, 0x5ef45ff6378724cfULL, 0x5f4a09ef0a00d28bULL, 0x5f880c3fd31e2151ULL,
+    0x5fd29d590257d70dULL, 0x603c0f59ba9b23b9ULL, 0x607d6c7742ddd781ULL, 0x60e862a030ae207fULL,
+    0x6115c8a81343874dULL, 0x61490c071341f983ULL, 0x61870f4569a9ba8fULL, 0x61ca0b79e8fe2801ULL,
+    0x6223915f86ca78d9ULL, 0x6267d88eae836dbdULL, 0x62b7062d1c9deb77ULL, 0x63017c960d6cf9a7ULL,
+    0x6357e851c9c42d1bULL, 0x63c3430b98d954d9ULL, 0x64104b0c959fbd5dULL, 0x64578d673d42fe05ULL,
+    0x64a1f0103a74e53bULL, 0x64f274da9c260661ULL, 0x654c25378f8bd421ULL, 0x65ae10e725f95b1dULL,
+    0x660138af15ac7647ULL, 0x6671bd39f72309c3ULL, 0x66ca67df0447b737ULL, 0x6707fef0a97b30edULL,
+    0x676e37a47a938093ULL, 0x67ba4fef362eb5cdULL, 0x68251dabf86e9c8bULL, 0x687ace0988c62c67ULL,
+    0x691763a91855ade5ULL, 0x698b7ced5ef10067ULL, 0x69d397c5dcf51e4bULL, 0x6a08379754914231ULL,
+    0x6a72ba8eb2abcdebULL, 0x6ae5dd60539878b9ULL, 0x6b2ea9a9b0ac8bf5ULL, 0x6b768ef9b3e2e2abULL,
+    0x6be65501aa507c45ULL, 0x6c577e8a612eba45ULL, 0x6ca10782a6f8e971ULL, 0x6d03ffd241691df5ULL,
+    0x6d43509609639be5ULL, 0x6da3899cbb6f3f93ULL, 0x6e172185387adfb5ULL, 0x6e52a82e903984d9ULL,
+    0x6ea064064827146bULL, 0x6ef17e270d7b7143ULL, 0x6f4b544bb946f3a3ULL, 0x6fb243f4206eed27ULL,
+    0x70072e607c9cbd0dULL, 0x707518eaa59be129ULL, 0x70d8837726cd41c9ULL, 0x7129bf0a37268eb3ULL,
+    0x71ba37bd12540ebdULL, 0x723f37bea6524c05ULL, 0x729135e25d65985fULL, 0x72c39509abf2f56bULL,
+    0x7309c493ddb3966bULL, 0x7376979af3271a05ULL, 0x73eb705a88e31909ULL, 0x74472dcc8f99392fULL,
+    0x74b18d678388b52bULL, 0x75094d9052aff6bdULL, 0x75468192a019bfebULL, 0x75a54695eb9a3171ULL,
+    0x760afe300f9f6e37ULL, 0x7680ab162ba9aaf5ULL, 0x76fb31e467eefb4bULL, 0x775d42a0f5f4de41ULL,
+    0x77dab48dc6eaaabfULL, 0x787bc6ba9d8a758bULL, 0x78d5a753008c38e9ULL, 0x7932023e03bef407ULL,
+    0x7984465ec01cd293ULL, 0x79bd80b45825b0afULL, 0x7a1b84bd26056febULL, 0x7a789c0b8d8965b9ULL,
+    0x7ac49bde9b8da1b5ULL, 0x7b10bf4579adb6d1ULL, 0x7b63f6162304e4c9ULL, 0x7bbad24b38b035f7ULL,
+    0x7c2ee95f44f35d1bULL, 0x7c9ea8ba0b9ed957ULL, 0x7d0305a1d171bdabULL, 0x7d91cad9f46ad8a3ULL,
+    0x7e072cd67f571b0bULL, 0x7e74a1ab5eb1e6f9ULL, 0x7ed7bc4811e9c1d9ULL, 0x7f4a73d7b3b105c7ULL,
+    0x7f9d6f6ed7a7c0c3ULL, 0x800bebf7df94a029ULL, 0x80928a01f0a05d9bULL, 0x80fa7a4743a867d1ULL,
+    0x8144b0ef97f759d5ULL, 0x81f18abca18a7205ULL, 0x822eedcc31a19a2bULL, 0x82a3e76d26355215ULL,
+    0x833642737db9a033ULL, 0x83bcf03746ff871dULL, 0x8447ad1414f9a6a1ULL, 0x84bf4b8a413edc55ULL,
+    0x8503c8cec059a9f5ULL, 0x854d48eb72124ff5ULL, 0x859e44daf6f275d9ULL, 0x8611d9311fa2fe6dULL,
+    0x8692177789fa055dULL, 0x86c10903354849d1ULL, 0x87064c558c287131ULL, 0x877c0b7898bbfefbULL,
+    0x87c7cea3fbdc77e9ULL, 0x883cca9153ba8b65ULL, 0x88b493ca7f1efba5ULL, 0x893f76de76371ac7ULL,
+    0x898bf7c443d48465ULL, 0x89fe51e31cc5f833ULL, 0x8a6be95cb1baab41ULL, 0x8ae7a9ae0fef192dULL,
+    0x8b4ba69c31953393ULL, 0x8c050192feca5373ULL, 0x8c6854338cc585c7ULL, 0x8cd4cc96925b5bbdULL,
+    0x8d293117b8549011ULL, 0x8d6d1135d6298d2fULL, 0x8db252ab91fa2127ULL, 0x8e2c64689ba0d03dULL,
+    0x8e9b2d59d2ed13a1ULL, 0x8f1d9a7aa7ab0b23ULL, 0x8f76e7937538628dULL, 0x8fe523001f1ff397ULL,
+    0x904d1d01651edf2fULL, 0x90a0748c08adc9e3ULL, 0x911f075e7187f689ULL, 0x917e827c592cfb37ULL,
+    0x91c2a19e82a04307ULL, 0x921e7aa8656c8447ULL, 0x928a48f64072b50fULL, 0x930f66cfc4230665ULL,
+    0x937279fd18aa1aa7ULL, 0x93ddb2716d9fc9b9ULL, 0x94353a9b189270e9ULL, 0x9494e464bc92d201ULL,
+    0x950364f403230bcfULL, 0x955e1bf14215399fULL, 0x95e2758bf9af1dbdULL, 0x9650596c3ef9fc11ULL,
+    0x96b7bfdbd637ab0fULL, 0x9772efdcbc98d449ULL, 0x9802234378c7ba75ULL, 0x988588f23af6a0a7ULL,
+    0x99199350ec635a5dULL, 0x998680cce8e917a9ULL, 0x99ecd3ff99cc959bULL, 0x9a369f9245b31a93ULL,
+    0x9ab5f5a796908b15ULL, 0x9afbea930aac8387ULL, 0x9b6c98fe6b0e8e9fULL, 0x9bf6551f3f234adbULL,
+    0x9c7820b7d6f60733ULL, 0x9d11ce92774d1d51ULL, 0x9d892f652798a3fdULL, 0x9ddc9f36cea05d2dULL,
+    0x9e652f36ad81f6f9ULL, 0x9ecc895061df019dULL, 0x9f314822df609685ULL, 0x9f775a50c4febdf1ULL,
+    0x9ff011c0908c66cdULL, 0xa0b0f7361a03c523ULL, 0xa12a66c463a1b703ULL, 0xa17ddcf0b55c41a9ULL,
+    0xa1dccb7e4b4b111fULL, 0xa251319823b4a8efULL, 0xa3143bc528a0cb65ULL, 0xa3866fda087b8605ULL,
+    0xa419d0a7b27826bfULL, 0xa4a669b033766e6fULL, 0xa5151f341a8dc4d1ULL, 0xa58cb40c3715b5dfULL,
+    0xa679af9cb26d54f3ULL, 0xa71c2d29476e939bULL, 0xa77d91940da43f0dULL, 0xa7f95fbefd337987ULL,
+    0xa8583ae3b8737249ULL, 0xa8b8b35817d9c02dULL, 0xa914f116badd38f7ULL, 0xa97b9aa0ab889dcfULL,
+    0xa9ecbd9f96129d09ULL, 0xaa71429edb33198dULL, 0xaac6d2b3d16db9e9ULL, 0xab342ae3c6566e8dULL,
+    0xac22c8ca70e972dbULL, 0xac74854c87e5be5dULL, 0xacd0cc20971c8a41ULL, 0xad34ad377955b027ULL,
+    0xad89c8aa3d527521ULL, 0xae1ae3e166c7af8fULL, 0xaeb6df0427da9037ULL, 0xaf54c3a891ca606dULL,
+    0xafb3b24486e43143ULL, 0xb015cdb190e89e05ULL, 0xb09656f74dd6ab47ULL, 0xb106771c36cb89ebULL,
+    0xb18f1ce90576bd83ULL, 0xb282cdd863964edfULL, 0xb3480082f6aeaa89ULL, 0xb3e2d6aa2463a8a7ULL,
+    0xb46885a8e8386845ULL, 0xb4f322041c45961dULL, 0xb544e5bf154ff07fULL, 0xb5b5b2fe12d0ce51ULL,
+    0xb65218a1f623c40fULL, 0xb6fce5b2b9603fdfULL, 0xb79253d4d8e31f5bULL, 0xb81ba0b04f87ba93ULL,
+    0xb8c2f8b65e5dbf2dULL, 0xb9710a9ad06493d7ULL, 0xba17ba2fd1c3257bULL, 0xbaf61b66c0407bd9ULL,
+    0xbb699207f1cb6ee3ULL, 0xbbc0b025e6af5df9ULL, 0xbc2fbb7726d4257dULL, 0xbcc1fabf68e45135ULL,
+    0xbd2fe13a013c8b3bULL, 0xbda78af944967ea5ULL, 0xbe978c824a75b3d9ULL, 0xbefc9e21771514abULL,
+    0xbf46829d579f0bbbULL, 0xbfe76cc3e326dd0fULL, 0xc0a0fe537c994015ULL, 0xc14fb8aad09c4621ULL,
+    0xc1f6d0a00dc7a8c3ULL, 0xc2ca492e3042ee23ULL, 0xc3998cb10c422621ULL, 0xc44706fd4ddf92c5ULL,
+    0xc4bb7ad0595824fbULL, 0xc545831ae5bb5fffULL, 0xc6063edc4e1190c5ULL, 0xc66e411d7eefa17bULL,
+    0xc6ea46e645433fd5ULL, 0xc75aed45e12d50a1ULL, 0xc7fd99e350f77885ULL, 0xc859116638335e6bULL,
+    0xc8b9a7c5aa10ce33ULL, 0xc9386c16154d1677ULL, 0xc9d589729b77aed7ULL, 0xcacbf81f9b73dd11ULL,
+    0xcb7ad6e034d70d21ULL, 0xcc4d9d03cbc8f9e7ULL, 0xccc74f6fc65771c3ULL, 0xcd22b7f3e5131827ULL,
+    0xcdb63df383962815ULL, 0xce4a1118682d08f3ULL, 0xced91aff4f786c7fULL, 0xcf5e2b6817db886fULL,
+    0xcfdaf2e8df36a981ULL, 0xd0bb628a97f257abULL, 0xd1468a9abd1d8d0dULL, 0xd202321deb3dee0bULL,
+    0xd2f76ae84d105717ULL, 0xd3856a9ff003568fULL, 0xd407860538bc21d1ULL, 0xd4b8da2580f27f95ULL,
+    0xd5443d93d06c15fdULL, 0xd5be6c2a35530041ULL, 0xd6761329d76cee23ULL, 0xd72026e3ce461d25ULL,
+    0xd7cc602f2dcbc109ULL, 0xd891b3ece870a4d1ULL, 0xd935f445ac55a567ULL, 0xd9cc659b391ea1fdULL,
+    0xda588011b29f8c7bULL, 0xdafdbed6d230b645ULL, 0xdbb7008775e13a15ULL, 0xdc440590aa03412bULL,
+    0xdd23b00ebc523b0dULL, 0xde05d1ce30af7da9ULL, 0xded30350da8bc22dULL, 0xdf467290f0898a75ULL,
+    0xdfb83fd8756345bfULL, 0xe02c07e3fe53f7bfULL, 0xe0a73d268c58db33ULL, 0xe13fb6a95c9a2ec3ULL,
+    0xe1c81a74ec69d481ULL, 0xe262f8ee9c57065fULL, 0xe2fa81d51baef7f1ULL, 0xe34af45a09606249ULL,
+    0xe3db9afcad371c6fULL, 0xe44f26f46ef79fd5ULL, 0xe4b42ae7394e8453ULL, 0xe543a57ce981177bULL,
+    0xe5d8ee20969d7d31ULL, 0xe65677e5c92537f1ULL, 0xe6ec442aaff6d26fULL, 0xe7bbdffe85085767ULL,
+    0xe8cf0d35b99d3487ULL, 0xe962531690dfdd21ULL, 0xea196650483bcb0dULL, 0xeaf6655520134651ULL,
+    0xeb9f5bd744c1a43dULL, 0xec59a14b9c0c038bULL, 0xed1a01545650c087ULL, 0xedc9ca46d8b62b29ULL,
+    0xeec3f66465c24459ULL, 0xef8b83856e4b8a0bULL, 0xf064b5af015d07e3ULL, 0xf15d1e90b3b6e3ebULL,
+    0xf1d99948e76444b9ULL, 0xf25fdb5a44917fb1ULL, 0xf2fd6a78914d0445ULL, 0xf3f7cf3bee41b011ULL,
+    0xf4b515b34b3a1a6dULL, 0xf5a33d97461886e7ULL, 0xf62b137f47839d2fULL, 0xf6b8f8f5709466a9ULL,
+    0xf7a6a41dc49b879dULL, 0xf844d071935d4b4bULL, 0xf8f4e6c360f61dc3ULL, 0xf976453e077009bfULL,
+    0xf9f5dd43594d71e1ULL, 0xfa6dc9d49468538bULL, 0xfb38a4e94b0c6ba9ULL, 0xfc020700f1ab8ed5ULL,
+    0xfcc3f1e46fb9c8b9ULL, 0xfd8059698237104bULL, 0xfe1f539d8692f3c7ULL, 0xfeb49f686ca6b6b5ULL,
+    0x0000ffb905ded927ULL
+};
+
+const int trialFirst[TRIAL_GROUP_NUM + 1] = {
+    0, 15, 25, 34, 42, 50, 57, 64, 71, 78, 85, 92, 99, 105, 111, 117,
+    123, 129, 135, 141, 147, 153, 159, 165, 171, 177, 183, 189, 195, 201, 207, 213,
+    219, 225, 231, 237, 243, 249, 255, 260, 265, 270, 275, 280, 285, 290, 295, 300,
+    305, 310, 315, 320, 325, 330, 335, 340, 345, 350, 355, 360, 365, 370, 375, 380,
+    385, 390, 395, 400, 405, 410, 415, 420, 425, 430, 435, 440, 445, 450, 455, 460,
+    465, 470, 475, 480, 485, 490, 495, 500, 505, 510, 515, 520, 525, 530, 535, 540,
+    545, 550, 555, 560, 565, 570, 575, 580, 585, 590, 595, 600, 605, 610, 615, 620,
+    625, 630, 635, 640, 645, 650, 655, 660, 665, 670, 675, 680, 685, 690, 695, 700,
+    705, 710, 715, 720, 725, 730, 735, 740, 745, 750, 755, 760, 765, 770, 775, 780,
+    785, 790, 795, 800, 805, 810, 815, 820, 825, 830, 835, 840, 845, 850, 855, 860,
+    865, 870, 875, 880, 885, 890, 895, 900, 905, 910, 914, 918, 922, 926, 930, 934,
+    938, 942, 946, 950, 954, 958, 962, 966, 970, 974, 978, 982, 986, 990, 994, 998,
+    1002, 1006, 1010, 1014, 1018, 1022, 1026, 1030, 1034, 1038, 1042, 1046, 1050, 1054, 1058, 1062,
+    1066, 1070, 1074, 1078, 1082, 1086, 1090, 1094, 1098, 1102, 1106, 1110, 1114, 1118, 1122, 1126,
+    1130, 1134, 1138, 1142, 1146, 1150, 1154, 1158, 1162, 1166, 1170, 1174, 1178, 1182, 1186, 1190,
+    1194, 1198, 1202, 1206, 1210, 1214, 1218, 1222, 1226, 1230, 1234, 1238, 1242, 1246, 1250, 1254,
+    1258, 1262, 1266, 1270, 1274, 1278, 1282, 1286, 1290, 1294, 1298, 1302, 1306, 1310, 1314, 1318,
+    1322, 1326, 1330, 1334, 1338, 1342, 1346, 1350, 1354, 1358, 1362, 1366, 1370, 1374, 1378, 1382,
+    1386, 1390, 1394, 1398, 1402, 1406, 1410, 1414, 1418, 1422, 1426, 1430, 1434, 1438, 1442, 1446,
+    1450, 1454, 1458, 1462, 1466, 1470, 1474, 1478, 1482, 1486, 1490, 1494, 1498, 1502, 1506, 1510,
+    1514, 1518, 1522, 1526, 1530, 1534, 1538, 1542, 1546, 1550, 1554, 1558, 1562, 1566, 1570, 1574,
+    1578, 1582, 1586, 1590, 1594, 1598, 1602, 1606, 1610, 1614, 1618, 1622, 1626, 1630, 1634, 1638,
+    1642, 1646, 1650, 1654, 1658, 1662, 1666, 1670, 1674, 1678, 1682, 1686, 1690, 1694, 1698, 1702,
+    1706, 1710, 1714, 1718, 1722, 1726, 1730, 1734, 1738, 1742, 1746, 1750, 1754, 1758, 1762, 1766,
+    1770, 1774, 1778, 1782, 1786, 1790, 1794, 1798, 1802, 1806, 1810, 1814, 1818, 1822, 1826, 1830,
+    1834, 1838, 1842, 1846, 1850, 1854, 1858, 1862, 1866, 1870, 1874, 1878, 1882, 1886, 1890, 1894,
+    1898, 1902, 1906, 1910, 1914, 1918, 1922, 1926, 1930, 1934, 1938, 1942, 1946, 1950, 1954, 1958,
+    1962, 1966, 1970, 1974, 1978, 1982, 1986, 1990, 1994, 1998, 2002, 2006, 2010, 2014, 2018, 2022,
+    2026, 2030, 2034, 2038, 2042, 2046, 2050, 2054, 2058, 2062, 2066, 2070, 2074, 2078, 2082, 2086,
+    2090, 2094, 2098, 2102, 2106, 2110, 2114, 2118, 2122, 2126, 2130, 2134, 2138, 2142, 2146, 2150,
+    2154, 2158, 2162, 2166, 2170, 2174, 2178, 2182, 2186, 2190, 2194, 2198, 2202, 2206, 2210, 2214,
+    2218, 2222, 2226, 2230, 2234, 2238, 2242, 2246, 2250, 2254, 2258, 2262, 2266, 2270, 2274, 2278,
+    2282, 2286, 2290, 2294, 2298, 2302, 2306, 2310, 2314, 2318, 2322, 2326, 2330, 2334, 2338, 2342,
+    2346, 2350, 2354, 2358, 2362, 2366, 2370, 2374, 2378, 2382, 2386, 2390, 2394, 2398, 2402, 2406,
+    2410, 2414, 2418, 2422, 2426, 2430, 2434, 2438, 2442, 2446, 2450, 2454, 2458, 2462, 2466, 2470,
+    2474, 2478, 2482, 2486, 2490, 2494, 2498, 2502, 2506, 2510, 2514, 2518, 2522, 2526, 2530, 2534,
+    2538, 2542, 2546, 2550, 2554, 2558, 2562, 2566, 2570, 2574, 2578, 2582, 2586, 2590, 2594, 2598,
+    2602, 2606, 2610, 2614, 2618, 2622, 2626, 2630, 2634, 2638, 2642, 2646, 2650, 2654, 2658, 2662,
+    2666, 2670, 2674, 2678, 2682, 2686, 2690, 2694, 2698, 2702, 2706, 2710, 2714, 2718, 2722, 2726,
+    2730, 2734, 2738, 2742, 2746, 2750, 2754, 2758, 2762, 2766, 2770, 2774, 2778, 2782, 2786, 2790,
+    2794, 2798, 2802, 2806, 2810, 2814, 2818, 2822, 2826, 2830, 2834, 2838, 2842, 2846, 2850, 2854,
+    2858, 2862, 2866, 2870, 2874, 2878, 2882, 2886, 2890, 2894, 2898, 2902, 2906, 2910, 2914, 2918,
+    2922, 2926, 2930, 2934, 2938, 2942, 2946, 2950, 2954, 2958, 2962, 2966, 2970, 2974, 2978, 2982,
+    2986, 2990, 2994, 2998, 3002, 3006, 3010, 3014, 3018, 3022, 3026, 3030, 3034, 3038, 3042, 3046,
+    3050, 3054, 3058, 3062, 3066, 3070, 3074, 3078, 3082, 3086, 3090, 3094, 3098, 3102, 3106, 3110,
+    3114, 3118, 3122, 3126, 3130, 3134, 3138, 3142, 3146, 3150, 3154, 3158, 3162, 3166, 3170, 3174,
+    3178, 3182, 3186, 3190, 3194, 3198, 3202, 3206, 3210, 3214, 3218, 3222, 3226, 3230, 3234, 3238,
+    3242, 3246, 3250, 3254, 3258, 3262, 3266, 3270, 3274, 3278, 3282, 3286, 3290, 3294, 3298, 3302,
+    3306, 3310, 3314, 3318, 3322, 3326, 3330, 3334, 3338, 3342, 3346, 3350, 3354, 3358, 3362, 3366,
+    3370, 3374, 3378, 3382, 3386, 3390, 3394, 3398, 3402, 3406, 3410, 3414, 3418, 3422, 3426, 3430,
+    3434, 3438, 3442, 3446, 3450, 3454, 3458, 3462, 3466, 3470, 3474, 3478, 3482, 3486, 3490, 3494,
+    3498, 3502, 3506, 3510, 3514, 3518, 3522, 3526, 3530, 3534, 3538, 3542, 3546, 3550, 3554, 3558,
+    3562, 3566, 3570, 3574, 3578, 3582, 3586, 3590, 3594, 3598, 3602, 3606, 3610, 3614, 3618, 3622,
+    3626, 3630, 3634, 3638, 3642, 3646, 3650, 3654, 3658, 3662, 3666, 3670, 3674, 3678, 3682, 3686,
+    3690, 3694, 3698, 3702, 3706, 3710, 3714, 3718, 3722, 3726, 3730, 3734, 3738, 3742, 3746, 3750,
+    3754, 3758, 3762, 3766, 3770, 3774, 3778, 3782, 3786, 3790, 3794, 3798, 3802, 3806, 3810, 3814,
+    3818, 3822, 3826, 3830, 3834, 3838, 3842, 3846, 3850, 3854, 3858, 3862, 3866, 3870, 3874, 3878,
+    3882, 3886, 3890, 3894, 3898, 3902, 3906, 3910, 3914, 3918, 3922, 3926, 3930, 3934, 3938, 3942,
+    3946, 3950, 3954, 3958, 3962, 3966, 3970, 3974, 3978, 3982, 3986, 3990, 3994, 3998, 4002, 4006,
+    4010, 4014, 4018, 4022, 4026, 4030, 4034, 4038, 4042, 4046, 4050, 4054, 4058, 4062, 4066, 4070,
+    4074, 4078, 4082, 4086, 4090, 4094, 4098, 4102, 4106, 4110, 4114, 4118, 4122, 4126, 4130, 4134,
+    4138, 4142, 4146, 4150, 4154, 4158, 4162, 4166, 4170, 4174, 4178, 4182, 4186, 4190, 4194, 4198,
+    4202, 4206, 4210, 4214, 4218, 4222, 4226, 4230, 4234, 4238, 4242, 4246, 4250, 4254, 4258, 4262,
+    4266, 4270, 4274, 4278, 4282, 4286, 4290, 4294, 4298, 4302, 4306, 4310, 4314, 4318, 4322, 4326,
+    4330, 4334, 4338, 4342, 4346, 4350, 4354, 4358, 4362, 4366, 4370, 4374, 4378, 4382, 4386, 4390,
+    4394, 4398, 4402, 4406, 4410, 4414, 4418, 4422, 4426, 4430, 4434, 4438, 4442, 4446, 4450, 4454,
+    4458, 4462, 4466, 4470, 4474, 4478, 4482, 4486, 4490, 4494, 4498, 4502, 4506, 4510, 4514, 4518,
+    4522, 4526, 4530, 4534, 4538, 4542, 4546, 4550, 4554, 4558, 4562, 4566, 4570, 4574, 4578, 4582,
+    4586, 4590, 4594, 4598, 4602, 4606, 4610, 4614, 4618, 4622, 4626, 4630, 4634, 4638, 4642, 4646,
+    4650, 4654, 4658, 4662, 4666, 4670, 4674, 4678, 4682, 4686, 4690, 4694, 4698, 4702, 4706, 4710,
+    4714, 4718, 4722, 4726, 4730, 4734, 4738, 4742, 4746, 4750, 4754, 4758, 4762, 4766, 4770, 4774,
+    4778, 4782, 4786, 4790, 4794, 4798, 4802, 4806, 4810, 4814, 4818, 4822, 4826, 4830, 4834, 4838,
+    4842, 4846, 4850, 4854, 4858, 4862, 4866, 4870, 4874, 4878, 4882, 4886, 4890, 4894, 4898, 4902,
+    4906, 4910, 4914, 4918, 4922, 4926, 4930, 4934, 4938, 4942, 4946, 4950, 4954, 4958, 4962, 4966,
+    4970, 4974, 4978, 4982, 4986, 4990, 4994, 4998, 5002, 5006, 5010, 5014, 5018, 5022, 5026, 5030,
+    5034, 5038, 5042, 5046, 5050, 5054, 5058, 5062, 5066, 5070, 5074, 5078, 5082, 5086, 5090, 5094,
+    5098, 5102, 5106, 5110, 5114, 5118, 5122, 5126, 5130, 5134, 5138, 5142, 5146, 5150, 5154, 5158,
+    5162, 5166, 5170, 5174, 5178, 5182, 5186, 5190, 5194, 5198, 5202, 5206, 5210, 5214, 5218, 5222,
+    5226, 5230, 5234, 5238, 5242, 5246, 5250, 5254, 5258, 5262, 5266, 5270, 5274, 5278, 5282, 5286,
+    5290, 5294, 5298, 5302, 5306, 5310, 5314, 5318, 5322, 5326, 5330, 5334, 5338, 5342, 5346, 5350,
+    5354, 5358, 5362, 5366, 5370, 5374, 5378, 5382, 5386, 5390, 5394, 5398, 5402, 5406, 5410, 5414,
+    5418, 5422, 5426, 5430, 5434, 5438, 5442, 5446, 5450, 5454, 5458, 5462, 5466, 5470, 5474, 5478,
+    5482, 5486, 5490, 5494, 5498, 5502, 5506, 5510, 5514, 5518, 5522, 5526, 5530, 5534, 5538, 5542,
+    5546, 5550, 5554, 5558, 5562, 5566, 5570, 5574, 5578, 5582, 5586, 5590, 5594, 5598, 5602, 5606,
+    5610, 5614, 5618, 5622, 5626, 5630, 5634, 5638, 5642, 5646, 5650, 5654, 5658, 5662, 5666, 5670,
+    5674, 5678, 5682, 5686, 5690, 5694, 5698, 5702, 5706, 5710, 5714, 5718, 5722, 5726, 5730, 5734,
+    5738, 5742, 5746, 5750, 5754, 5758, 5762, 5766, 5770, 5774, 5778, 5782, 5786, 5790, 5794, 5798,
+    5802, 5806, 5810, 5814, 5818, 5822, 5826, 5830, 5834, 5838, 5842, 5846, 5850, 5854, 5858, 5862,
+    5866, 5870, 5874, 5878, 5882, 5886, 5890, 5894, 5898, 5902, 5906, 5910, 5914, 5918, 5922, 5926,
+    5930, 5934, 5938, 5942, 5946, 5950, 5954, 5958, 5962, 5966, 5970, 5974, 5978, 5982, 5986, 5990,
+    5994, 5998, 6002, 6006, 6010, 6014, 6018, 6022, 6026, 6030, 6034, 6038, 6042, 6046, 6050, 6054,
+    6058, 6062, 6066, 6070, 6074, 6078, 6082, 6086, 6090, 6094, 6098, 6102, 6106, 6110, 6114, 6118,
+    6122, 6126, 6130, 6134, 6138, 6142, 6146, 6150, 6154, 6158, 6162, 6166, 6170, 6174, 6178, 6182,
+    6186, 6190, 6194, 6198, 6202, 6206, 6210, 6214, 6218, 6222, 6226, 6230, 6234, 6238, 6242, 6246,
+    6250, 6254, 6258, 6262, 6266, 6270, 6274, 6278, 6282, 6286, 6290, 6294, 6298, 6302, 6306, 6310,
+    6314, 6318, 6322, 6326, 6330, 6334, 6338, 6342, 6346, 6350, 6354, 6358, 6362, 6366, 6370, 6374,
+    6378, 6382, 6386, 6390, 6394, 6398, 6402, 6406, 6410, 6414, 6418, 6422, 6426, 6430, 6434, 6438,
+    6442, 6446, 6450, 6454, 6458, 6462, 6466, 6470, 6474, 6478, 6482, 6486, 6490, 6494, 6498, 6502,
+    6506, 6510, 6514, 6518, 6522, 6526, 6530, 6534, 6538, 6541
+};
+